@@ -56,6 +56,7 @@
 #include "storage/utils.h"
 #include "util/file_utils.h"
 #include "util/monotime.h"
+#include "util/slow_op_trace.h"
 #include "util/starrocks_metrics.h"
 #include "util/stopwatch.hpp"
 #include "util/thread.h"
@@ -65,7 +66,6 @@ namespace starrocks {
 const uint32_t TASK_FINISH_MAX_RETRY = 3;
 const uint32_t PUBLISH_VERSION_MAX_RETRY = 3;
 const uint32_t PUBLISH_VERSION_SUBMIT_MAX_RETRY = 10;
-const size_t PUBLISH_VERSION_BATCH_SIZE = 10;
 
 std::atomic_ulong TaskWorkerPool::_s_report_version(time(nullptr) * 10000);
 std::mutex TaskWorkerPool::_s_task_signatures_locks[TTaskType::type::NUM_TASK_TYPE];
@@ -346,6 +346,7 @@ void* TaskWorkerPool::_create_tablet_worker_thread_callback(void* arg_this) {
             create_tablet_req = agent_task_req.create_tablet_req;
             worker_pool_this->_tasks.pop_front();
         }
+        SCOPED_SLOW_OP_TRACE("agent.create_tablet", config::slow_agent_task_trace_threshold_ms);
 
         TStatusCode::type status_code = TStatusCode::OK;
         std::vector<std::string> error_msgs;
@@ -408,6 +409,7 @@ void* TaskWorkerPool::_drop_tablet_worker_thread_callback(void* arg_this) {
             drop_tablet_req = agent_task_req.drop_tablet_req;
             worker_pool_this->_tasks.pop_front();
         }
+        SCOPED_SLOW_OP_TRACE("agent.drop_tablet", config::slow_agent_task_trace_threshold_ms);
 
         bool force_drop = drop_tablet_req.__isset.force && drop_tablet_req.force;
         TStatusCode::type status_code = TStatusCode::OK;
@@ -460,6 +462,7 @@ void* TaskWorkerPool::_alter_tablet_worker_thread_callback(void* arg_this) {
             agent_task_req = worker_pool_this->_tasks.front();
             worker_pool_this->_tasks.pop_front();
         }
+        SCOPED_SLOW_OP_TRACE("agent.alter_tablet", config::slow_agent_task_trace_threshold_ms);
         int64_t signatrue = agent_task_req.signature;
         LOG(INFO) << "get alter table task, signature: " << agent_task_req.signature;
         bool is_task_timeout = false;
@@ -653,6 +656,7 @@ void* TaskWorkerPool::_push_worker_thread_callback(void* arg_this) {
             continue;
         }
 
+        SCOPED_SLOW_OP_TRACE("agent.push", config::slow_agent_task_trace_threshold_ms);
         LOG(INFO) << "get push task. signature: " << agent_task_req.signature << " priority: " << priority
                   << " push_type: " << push_req.push_type;
         std::vector<TTabletInfo> tablet_infos;
@@ -744,7 +748,9 @@ Status TaskWorkerPool::_publish_version_in_parallel(void* arg_this, std::unique_
             while (retry_time++ < PUBLISH_VERSION_SUBMIT_MAX_RETRY) {
                 // submit publishing tablet version task to the threadpool.
                 st = threadpool->submit_func([&worker_pool_this, &tablet_rs, &statuses, idx, &version, &transaction_id,
-                                              &partition_id]() {
+                                              &partition_id, trace = Trace::CurrentTrace()]() {
+                    ADOPT_TRACE(trace);
+                    TRACE_COUNTER_SCOPE_LATENCY_US("publish_tablet_us");
                     const TabletInfo& tablet_info = tablet_rs.first;
                     const RowsetSharedPtr& rowset = tablet_rs.second;
                     auto& status = statuses[idx];
@@ -787,6 +793,7 @@ Status TaskWorkerPool::_publish_version_in_parallel(void* arg_this, std::unique_
 
         // wait until that all jobs in threadpool are done.
         threadpool->wait();
+        TRACE("published $0 tablets of partition $1", tablet_infos.size(), partition_id);
 
         // check status.
         for (size_t i = 0; i < tablet_infos.size(); ++i) {
@@ -805,6 +812,98 @@ Status TaskWorkerPool::_publish_version_in_parallel(void* arg_this, std::unique_
     return error_status;
 }
 
+void TaskWorkerPool::_publish_versions_in_batch(void* arg_this, std::unique_ptr<ThreadPool>& threadpool,
+                                                const std::vector<TAgentTaskRequest>& task_requests,
+                                                std::set<TTabletId>* tablet_ids, std::vector<size_t>* tablet_ns,
+                                                std::vector<std::vector<TTabletId>>* error_tablet_ids,
+                                                std::vector<Status>* statuses) {
+    TaskWorkerPool* worker_pool_this = (TaskWorkerPool*)arg_this;
+    struct PublishItem {
+        size_t task_index;
+        TTransactionId transaction_id;
+        TPartitionId partition_id;
+        TVersion version;
+        TabletInfo tablet_info;
+        RowsetSharedPtr rowset;
+        // Overwritten by the thread publishing it, the tablets not submitted are retried with their transactions.
+        Status status = Status::ServiceUnavailable("publish version threadpool is busy");
+    };
+    // The versions of a tablet are published in order by one thread, and the tablets are published in parallel.
+    std::map<TTabletId, std::vector<PublishItem>> tablet_items;
+    for (size_t i = 0; i < task_requests.size(); ++i) {
+        const auto& publish_version_req = task_requests[i].publish_version_req;
+        for (const auto& par_ver_info : publish_version_req.partition_version_infos) {
+            map<TabletInfo, RowsetSharedPtr> tablet_related_rs;
+            StorageEngine::instance()->txn_manager()->get_txn_related_tablets(
+                    publish_version_req.transaction_id, par_ver_info.partition_id, &tablet_related_rs);
+            (*tablet_ns)[i] += tablet_related_rs.size();
+            for (auto& [tablet_info, rowset] : tablet_related_rs) {
+                tablet_items[tablet_info.tablet_id].push_back(PublishItem{i, publish_version_req.transaction_id,
+                                                                          par_ver_info.partition_id,
+                                                                          par_ver_info.version, tablet_info, rowset});
+            }
+        }
+    }
+
+    Status submit_status;
+    for (auto& entry : tablet_items) {
+        auto& items = entry.second;
+        std::stable_sort(items.begin(), items.end(),
+                         [](const PublishItem& lhs, const PublishItem& rhs) { return lhs.version < rhs.version; });
+        uint32_t retry_time = 0;
+        while (retry_time++ < PUBLISH_VERSION_SUBMIT_MAX_RETRY) {
+            submit_status = threadpool->submit_func([worker_pool_this, &items, trace = Trace::CurrentTrace()]() {
+                ADOPT_TRACE(trace);
+                TRACE_COUNTER_SCOPE_LATENCY_US("publish_tablet_us");
+                for (auto& item : items) {
+                    // if rowset is null, it means this be received write task, but failed during write
+                    // and receive fe's publish version task
+                    // this be must return as an error tablet
+                    if (item.rowset == nullptr) {
+                        LOG(WARNING) << "Not found rowset of tablet: " << item.tablet_info.tablet_id << ", txn_id "
+                                     << item.transaction_id;
+                        item.status = Status::NotFound(fmt::format("Not found rowset of tablet: {}, txn_id: {}",
+                                                                   item.tablet_info.tablet_id, item.transaction_id));
+                        continue;
+                    }
+                    EnginePublishVersionTask engine_task(item.transaction_id, item.partition_id, item.version,
+                                                         item.tablet_info, item.rowset);
+                    item.status = worker_pool_this->_env->storage_engine()->execute_task(&engine_task);
+                    LOG_IF(WARNING, !item.status.ok())
+                            << "failed to publish version for tablet, tablet_id " << item.tablet_info.tablet_id
+                            << ", txn_id " << item.transaction_id << ", err: " << item.status;
+                }
+            });
+            if (submit_status.is_service_unavailable()) {
+                // Status::ServiceUnavailable is returned when all of the threads of the pool are busy.
+                SleepFor(MonoDelta::FromMilliseconds(50 * retry_time));
+                continue;
+            }
+            break;
+        }
+        if (!submit_status.ok()) {
+            break;
+        }
+    }
+    // wait until that all jobs in threadpool are done.
+    threadpool->wait();
+    TRACE("published $0 tablets of $1 transactions", tablet_items.size(), task_requests.size());
+
+    for (auto& [tablet_id, items] : tablet_items) {
+        for (auto& item : items) {
+            Status& status = (*statuses)[item.task_index];
+            if (!item.status.ok()) {
+                (*error_tablet_ids)[item.task_index].push_back(tablet_id);
+                // Use the first non-ok status as the status of the transaction.
+                if (status.ok()) {
+                    status = item.status;
+                }
+            }
+            tablet_ids->insert(tablet_id);
+        }
+    }
+}
+
 void* TaskWorkerPool::_publish_version_worker_thread_callback(void* arg_this) {
     TaskWorkerPool* worker_pool_this = (TaskWorkerPool*)arg_this;
 
@@ -835,12 +934,23 @@ void* TaskWorkerPool::_publish_version_worker_thread_callback(void* arg_this) {
                 break;
             }
 
-            while (!worker_pool_this->_tasks.empty() && task_requests.size() < PUBLISH_VERSION_BATCH_SIZE) {
+            size_t batch_size = std::max<size_t>(1, config::publish_version_batch_size);
+            while (!worker_pool_this->_tasks.empty() && task_requests.size() < batch_size) {
                 // collect some publish version tasks as a group.
                 task_requests.push_back(worker_pool_this->_tasks.front());
                 worker_pool_this->_tasks.pop_front();
             }
         }
+        // The tablets are published by the threads of |threadpool|, which attach to the trace of the group.
+        SCOPED_SLOW_OP_TRACE("agent.publish_version", config::slow_agent_task_trace_threshold_ms);
+
+        // All the tablets of the group are published in parallel first, and the failed transactions are retried one
+        // by one then.
+        std::vector<size_t> tablet_ns(task_requests.size(), 0);
+        std::vector<std::vector<TTabletId>> batch_error_tablet_ids(task_requests.size());
+        std::vector<Status> batch_statuses(task_requests.size());
+        _publish_versions_in_batch(arg_this, threadpool, task_requests, &tablet_ids, &tablet_ns,
+                                   &batch_error_tablet_ids, &batch_statuses);
 
         for (size_t i = 0; i < task_requests.size(); ++i) {
             auto& publish_version_task = task_requests[i];
@@ -849,24 +959,19 @@ void* TaskWorkerPool::_publish_version_worker_thread_callback(void* arg_this) {
                       << " group size: " << task_requests.size();
 
             auto& publish_version_req = publish_version_task.publish_version_req;
-            std::vector<TTabletId> error_tablet_ids;
+            std::vector<TTabletId> error_tablet_ids = std::move(batch_error_tablet_ids[i]);
+            Status status = batch_statuses[i];
+            size_t tablet_n = tablet_ns[i];
             uint32_t retry_time = 0;
-            Status status;
-
-            size_t tablet_n = 0;
-            while (retry_time < PUBLISH_VERSION_MAX_RETRY) {
+            while (!status.ok() && retry_time < PUBLISH_VERSION_MAX_RETRY) {
+                LOG(WARNING) << "publish version error, retry. [transaction_id=" << publish_version_req.transaction_id
+                             << ", error_tablets_size=" << error_tablet_ids.size() << "]";
+                ++retry_time;
+                SleepFor(MonoDelta::FromSeconds(1));
                 error_tablet_ids.clear();
-                status = _publish_version_in_parallel(arg_this, threadpool, publish_version_req, &tablet_ids, &tablet_n,
-                                                      &error_tablet_ids);
-                if (status.ok()) {
-                    break;
-                } else {
-                    LOG(WARNING) << "publish version error, retry. [transaction_id="
-                                 << publish_version_req.transaction_id
-                                 << ", error_tablets_size=" << error_tablet_ids.size() << "]";
-                    ++retry_time;
-                    SleepFor(MonoDelta::FromSeconds(1));
-                }
+                size_t retry_tablet_n = 0;
+                status = _publish_version_in_parallel(arg_this, threadpool, publish_version_req, &tablet_ids,
+                                                      &retry_tablet_n, &error_tablet_ids);
             }
 
             TFinishTaskRequest finish_task_request;
@@ -904,6 +1009,7 @@ void* TaskWorkerPool::_publish_version_worker_thread_callback(void* arg_this) {
         if (!st.ok()) {
             LOG(WARNING) << "failed to persist transactions, tablets num: " << tablets.size() << " err: " << st;
         }
+        TRACE("persisted the transactions of $0 tablets", tablets.size());
 
         tablet_ids.clear();
         tablets.clear();
@@ -1077,6 +1183,7 @@ void* TaskWorkerPool::_clone_worker_thread_callback(void* arg_this) {
             clone_req = agent_task_req.clone_req;
             worker_pool_this->_tasks.pop_front();
         }
+        SCOPED_SLOW_OP_TRACE("agent.clone", config::slow_agent_task_trace_threshold_ms);
 
         StarRocksMetrics::instance()->clone_requests_total.increment(1);
         LOG(INFO) << "get clone task. signature:" << agent_task_req.signature;
@@ -1173,6 +1280,7 @@ void* TaskWorkerPool::_storage_medium_migrate_worker_thread_callback(void* arg_t
             storage_medium_migrate_req = agent_task_req.storage_medium_migrate_req;
             worker_pool_this->_tasks.pop_front();
         }
+        SCOPED_SLOW_OP_TRACE("agent.storage_medium_migrate", config::slow_agent_task_trace_threshold_ms);
 
         TStatusCode::type status_code = TStatusCode::OK;
         std::vector<std::string> error_msgs;
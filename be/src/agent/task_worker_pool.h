@@ -102,6 +102,11 @@ private:
                                                const TPublishVersionRequest publish_version_req,
                                                std::set<TTabletId>* tablet_ids, size_t* tablet_n,
                                                std::vector<TTabletId>* error_tablet_ids);
+    static void _publish_versions_in_batch(void* arg_this, std::unique_ptr<ThreadPool>& threadpool,
+                                           const std::vector<TAgentTaskRequest>& task_requests,
+                                           std::set<TTabletId>* tablet_ids, std::vector<size_t>* tablet_ns,
+                                           std::vector<std::vector<TTabletId>>* error_tablet_ids,
+                                           std::vector<Status>* statuses);
     static void* _publish_version_worker_thread_callback(void* arg_this);
     static void* _clear_transaction_task_worker_thread_callback(void* arg_this);
     static void* _alter_tablet_worker_thread_callback(void* arg_this);
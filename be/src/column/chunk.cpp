@@ -8,15 +8,39 @@
 #include "gen_cpp/data.pb.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/descriptors.h"
+#include "simd/simd.h"
 #include "util/coding.h"
 
 namespace starrocks::vectorized {
 
 Chunk::Chunk() {
-    _slot_id_to_index.reserve(4);
     _tuple_id_to_index.reserve(1);
 }
 
+Chunk::Chunk(Chunk&& other) noexcept {
+    swap_chunk(other);
+}
+
+Chunk& Chunk::operator=(Chunk&& other) noexcept {
+    // Release the current columns now instead of leaving them to |other|.
+    Chunk tmp(std::move(other));
+    swap_chunk(tmp);
+    return *this;
+}
+
+const std::shared_ptr<const Chunk::SlotHashMap>& Chunk::_empty_slot_id_to_index() {
+    static const std::shared_ptr<const SlotHashMap> empty_map = std::make_shared<SlotHashMap>();
+    return empty_map;
+}
+
+Chunk::SlotHashMap* Chunk::_mutable_slot_id_to_index() {
+    if (_slot_id_to_index.use_count() > 1) {
+        _slot_id_to_index = std::make_shared<SlotHashMap>(*_slot_id_to_index);
+    }
+    // Only this chunk owns the map.
+    return const_cast<SlotHashMap*>(_slot_id_to_index.get());
+}
+
 Status Chunk::upgrade_if_overflow() {
     for (auto& column : _columns) {
         auto ret = column->upgrade_if_overflow();
@@ -57,24 +81,31 @@ bool Chunk::has_large_column() const {
 Chunk::Chunk(Columns columns, SchemaPtr schema) : _columns(std::move(columns)), _schema(std::move(schema)) {
     // bucket size cannot be 0.
     _cid_to_index.reserve(std::max<size_t>(1, columns.size() * 2));
-    _slot_id_to_index.reserve(std::max<size_t>(1, _columns.size() * 2));
     _tuple_id_to_index.reserve(1);
     rebuild_cid_index();
     check_or_die();
 }
 
 // TODO: FlatMap don't support std::move
-Chunk::Chunk(Columns columns, const SlotHashMap& slot_map) : _columns(std::move(columns)), _slot_id_to_index(slot_map) {
+Chunk::Chunk(Columns columns, const SlotHashMap& slot_map)
+        : _columns(std::move(columns)), _slot_id_to_index(std::make_shared<SlotHashMap>(slot_map)) {
     // when use _slot_id_to_index, we don't need to rebuild_cid_index
     _tuple_id_to_index.reserve(1);
 }
 
 // TODO: FlatMap don't support std::move
 Chunk::Chunk(Columns columns, const SlotHashMap& slot_map, const TupleHashMap& tuple_map)
-        : _columns(std::move(columns)), _slot_id_to_index(slot_map), _tuple_id_to_index(tuple_map) {
+        : _columns(std::move(columns)),
+          _slot_id_to_index(std::make_shared<SlotHashMap>(slot_map)),
+          _tuple_id_to_index(tuple_map) {
     // when use _slot_id_to_index, we don't need to rebuild_cid_index
 }
 
+Chunk::Chunk(Columns columns, std::shared_ptr<const SlotHashMap> slot_map, const TupleHashMap& tuple_map)
+        : _columns(std::move(columns)), _slot_id_to_index(std::move(slot_map)), _tuple_id_to_index(tuple_map) {
+    DCHECK(_slot_id_to_index != nullptr);
+}
+
 void Chunk::reset() {
     for (ColumnPtr& c : _columns) {
         c->reset_column();
@@ -111,13 +142,14 @@ void Chunk::append_column(ColumnPtr column, const FieldPtr& field) {
 }
 
 void Chunk::append_column(ColumnPtr column, SlotId slot_id) {
-    _slot_id_to_index[slot_id] = _columns.size();
+    (*_mutable_slot_id_to_index())[slot_id] = _columns.size();
     _columns.emplace_back(std::move(column));
     check_or_die();
 }
 
 void Chunk::update_column(ColumnPtr column, SlotId slot_id) {
-    _columns[_slot_id_to_index[slot_id]] = std::move(column);
+    DCHECK(is_slot_exist(slot_id));
+    _columns[_slot_id_to_index->find(slot_id)->second] = std::move(column);
     check_or_die();
 }
 
@@ -169,7 +201,7 @@ std::unique_ptr<Chunk> Chunk::clone_empty() const {
 }
 
 std::unique_ptr<Chunk> Chunk::clone_empty(size_t size) const {
-    if (_columns.size() == _slot_id_to_index.size()) {
+    if (_columns.size() == _slot_id_to_index->size()) {
         return clone_empty_with_slot(size);
     } else {
         return clone_empty_with_schema(size);
@@ -181,13 +213,13 @@ std::unique_ptr<Chunk> Chunk::clone_empty_with_slot() const {
 }
 
 std::unique_ptr<Chunk> Chunk::clone_empty_with_slot(size_t size) const {
-    DCHECK_EQ(_columns.size(), _slot_id_to_index.size());
-    Columns columns(_slot_id_to_index.size());
-    for (size_t i = 0; i < _slot_id_to_index.size(); i++) {
+    DCHECK_EQ(_columns.size(), _slot_id_to_index->size());
+    Columns columns(_slot_id_to_index->size());
+    for (size_t i = 0; i < _slot_id_to_index->size(); i++) {
         columns[i] = _columns[i]->clone_empty();
         columns[i]->reserve(size);
     }
-    return std::make_unique<Chunk>(columns, _slot_id_to_index);
+    return std::make_unique<Chunk>(std::move(columns), _slot_id_to_index, TupleHashMap());
 }
 
 std::unique_ptr<Chunk> Chunk::clone_empty_with_schema() const {
@@ -214,7 +246,7 @@ std::unique_ptr<Chunk> Chunk::clone_empty_with_tuple(size_t size) const {
         columns[i] = _columns[i]->clone_empty();
         columns[i]->reserve(size);
     }
-    return std::make_unique<Chunk>(columns, _slot_id_to_index, _tuple_id_to_index);
+    return std::make_unique<Chunk>(std::move(columns), _slot_id_to_index, _tuple_id_to_index);
 }
 
 std::unique_ptr<Chunk> Chunk::clone_unique() const {
@@ -245,6 +277,18 @@ void Chunk::rolling_append_selective(Chunk& src, const uint32_t* indexes, uint32
 }
 
 size_t Chunk::filter(const Buffer<uint8_t>& selection) {
+    // Most filters keep all the rows or none of them, e.g. the runtime filters and the conjuncts
+    // on the partition keys, don't compact the columns in this case.
+    const size_t rows = num_rows();
+    if (!_columns.empty() && selection.size() == rows) {
+        size_t selected = SIMD::count_nonzero(selection);
+        if (selected == rows) {
+            return rows;
+        } else if (selected == 0) {
+            set_num_rows(0);
+            return 0;
+        }
+    }
     for (auto& column : _columns) {
         column->filter(selection);
     }
@@ -310,7 +354,7 @@ void Chunk::check_or_die() {
     if (_columns.empty()) {
         CHECK(_schema == nullptr || _schema->fields().empty());
         CHECK(_cid_to_index.empty());
-        CHECK(_slot_id_to_index.empty());
+        CHECK(_slot_id_to_index->empty());
         CHECK(_tuple_id_to_index.empty());
     } else {
         for (const ColumnPtr& c : _columns) {
@@ -344,7 +388,7 @@ std::string Chunk::debug_row(uint32_t index) const {
 
 void Chunk::merge(Chunk&& src) {
     DCHECK_EQ(src.num_rows(), num_rows());
-    for (auto& it : src._slot_id_to_index) {
+    for (auto& it : *src._slot_id_to_index) {
         SlotId slot_id = it.first;
         size_t index = it.second;
         ColumnPtr& c = src._columns[index];
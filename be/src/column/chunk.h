@@ -30,9 +30,12 @@ public:
     Chunk(Columns columns, SchemaPtr schema);
     Chunk(Columns columns, const SlotHashMap& slot_map);
     Chunk(Columns columns, const SlotHashMap& slot_map, const TupleHashMap& tuple_map);
+    // Share the |slot_map| with the other chunks, it's copied when the slots of this chunk are changed.
+    Chunk(Columns columns, std::shared_ptr<const SlotHashMap> slot_map, const TupleHashMap& tuple_map);
 
-    Chunk(Chunk&& other) = default;
-    Chunk& operator=(Chunk&& other) = default;
+    // The moved chunk is left empty.
+    Chunk(Chunk&& other) noexcept;
+    Chunk& operator=(Chunk&& other) noexcept;
 
     ~Chunk() = default;
 
@@ -108,10 +111,10 @@ public:
     const ColumnPtr& get_column_by_slot_id(SlotId slot_id) const;
     ColumnPtr& get_column_by_slot_id(SlotId slot_id);
 
-    void set_slot_id_to_index(SlotId slot_id, size_t idx) { _slot_id_to_index[slot_id] = idx; }
-    bool is_slot_exist(SlotId id) const { return _slot_id_to_index.contains(id); }
+    void set_slot_id_to_index(SlotId slot_id, size_t idx) { (*_mutable_slot_id_to_index())[slot_id] = idx; }
+    bool is_slot_exist(SlotId id) const { return _slot_id_to_index->contains(id); }
     bool is_tuple_exist(TupleId id) const { return _tuple_id_to_index.contains(id); }
-    void reset_slot_id_to_index() { _slot_id_to_index.clear(); }
+    void reset_slot_id_to_index() { _slot_id_to_index = _empty_slot_id_to_index(); }
 
     void set_columns(const Columns& columns) { _columns = columns; }
 
@@ -181,7 +184,7 @@ public:
     DelCondSatisfied delete_state() const { return _delete_state; }
 
     const TupleHashMap& get_tuple_id_to_index_map() const { return _tuple_id_to_index; }
-    const SlotHashMap& get_slot_id_to_index_map() const { return _slot_id_to_index; }
+    const SlotHashMap& get_slot_id_to_index_map() const { return *_slot_id_to_index; }
 
     // Call `Column::reserve` on each column of |chunk|, with |cap| passed as argument.
     void reserve(size_t cap);
@@ -241,11 +244,16 @@ public:
 private:
     void rebuild_cid_index();
 
+    static const std::shared_ptr<const SlotHashMap>& _empty_slot_id_to_index();
+    SlotHashMap* _mutable_slot_id_to_index();
+
     Columns _columns;
     std::shared_ptr<Schema> _schema;
     ColumnIdHashMap _cid_to_index;
     // For compatibility
-    SlotHashMap _slot_id_to_index;
+    // Shared by the chunks cloned from this chunk, which are usually produced with the same slots. It's never
+    // null, and copied on write if shared.
+    std::shared_ptr<const SlotHashMap> _slot_id_to_index = _empty_slot_id_to_index();
     TupleHashMap _tuple_id_to_index;
     DelCondSatisfied _delete_state = DEL_NOT_SATISFIED;
 };
@@ -265,7 +273,7 @@ inline const ColumnPtr& Chunk::get_column_by_slot_id(SlotId slot_id) const {
 
 inline ColumnPtr& Chunk::get_column_by_slot_id(SlotId slot_id) {
     DCHECK(is_slot_exist(slot_id));
-    size_t idx = _slot_id_to_index[slot_id];
+    size_t idx = _slot_id_to_index->find(slot_id)->second;
     return _columns[idx];
 }
 
@@ -176,9 +176,18 @@ void FixedLengthColumnBase<T>::fnv_hash(uint32_t* hash, uint32_t from, uint32_t
 template <typename T>
 void FixedLengthColumnBase<T>::crc32_hash(uint32_t* hash, uint32_t from, uint32_t to) const {
     for (uint32_t i = from; i < to; ++i) {
-        if constexpr (IsDate<T> || IsTimestamp<T>) {
-            std::string str = _data[i].to_string();
-            hash[i] = HashUtil::zlib_crc_hash(str.data(), str.size(), hash[i]);
+        // Format the date and datetime on the stack, it's called for each row of the shuffled chunks.
+        if constexpr (IsDate<T>) {
+            char str[10];
+            int year, month, day;
+            date::to_date_with_cache(_data[i].julian(), &year, &month, &day);
+            date::to_string(year, month, day, str);
+            hash[i] = HashUtil::zlib_crc_hash(str, sizeof(str), hash[i]);
+        } else if constexpr (IsTimestamp<T>) {
+            char str[26];
+            int len = _data[i].to_string(str, sizeof(str));
+            DCHECK_GT(len, 0);
+            hash[i] = HashUtil::zlib_crc_hash(str, len, hash[i]);
         } else if constexpr (IsDecimal<T>) {
             int64_t int_val = _data[i].int_value();
             int32_t frac_val = _data[i].frac_value();
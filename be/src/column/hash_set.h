@@ -130,6 +130,37 @@ struct SliceKey16 {
     SliceKey16(SliceKey16&& x) noexcept { u.value = x.u.value; }
 };
 
+// SliceKey24 and SliceKey32 hold the keys of 3-5 narrow group by columns, e.g. tinyint+smallint+date+int,
+// which are too long for SliceKey16.
+struct SliceKey24 {
+    union U {
+        struct {
+            char data[23];
+            uint8_t size;
+        } __attribute__((packed));
+        uint64_t ui64[3];
+    } u;
+    static_assert(sizeof(u) == sizeof(u.ui64));
+    bool operator==(const SliceKey24& k) const {
+        return ((u.ui64[0] ^ k.u.ui64[0]) | (u.ui64[1] ^ k.u.ui64[1]) | (u.ui64[2] ^ k.u.ui64[2])) == 0;
+    }
+};
+
+struct SliceKey32 {
+    union U {
+        struct {
+            char data[31];
+            uint8_t size;
+        } __attribute__((packed));
+        uint64_t ui64[4];
+    } u;
+    static_assert(sizeof(u) == sizeof(u.ui64));
+    bool operator==(const SliceKey32& k) const {
+        return ((u.ui64[0] ^ k.u.ui64[0]) | (u.ui64[1] ^ k.u.ui64[1]) | (u.ui64[2] ^ k.u.ui64[2]) |
+                (u.ui64[3] ^ k.u.ui64[3])) == 0;
+    }
+};
+
 template <typename SliceKey, PhmapSeed seed>
 class FixedSizeSliceKeyHash {
 public:
@@ -138,9 +169,19 @@ public:
             return phmap_mix_with_seed<sizeof(size_t), seed>()(std::hash<int32_t>()(s.u.value));
         } else if constexpr (sizeof(SliceKey) == 8) {
             return phmap_mix_with_seed<sizeof(size_t), seed>()(std::hash<size_t>()(s.u.value));
-        } else {
+        } else if constexpr (sizeof(SliceKey) == 16) {
             static_assert(sizeof(s.u.value) == 16);
             return Hash128WithSeed<seed>()(s.u.value);
+        } else {
+            // CRC32 the key word by word, which is cheaper than combining the words one by one.
+            static_assert(sizeof(SliceKey) == 24 || sizeof(SliceKey) == 32);
+            constexpr uint64_t crc_seed = seed == PhmapSeed1 ? CRC_HASH_SEED1 : CRC_HASH_SEED2;
+            uint64_t hash = crc_hash_uint128(s.u.ui64[0], s.u.ui64[1], crc_seed);
+            hash = crc_hash_uint64(s.u.ui64[2], hash);
+            if constexpr (sizeof(SliceKey) == 32) {
+                hash = crc_hash_uint64(s.u.ui64[3], hash);
+            }
+            return phmap_mix_with_seed<sizeof(size_t), seed>()(hash);
         }
     }
 };
@@ -87,6 +87,8 @@ CONF_Int32(push_worker_count_high_priority, "3");
 CONF_Int32(publish_version_worker_count, "2");
 // The count of thread to publish version per partition.
 CONF_Int32(partition_publish_version_worker_count, "8");
+// The max number of the publish version tasks published together, the tablets of them are published in parallel.
+CONF_mInt32(publish_version_batch_size, "10");
 // The count of thread to clear transaction task.
 CONF_Int32(clear_transaction_task_worker_count, "1");
 // The count of thread to delete.
@@ -97,6 +99,9 @@ CONF_Int32(alter_tablet_worker_count, "3");
 CONF_Int32(clone_worker_count, "3");
 // The count of thread to clone.
 CONF_Int32(storage_medium_migrate_count, "1");
+// The max speed in MB/s to copy the files of a tablet migrated between the storage paths, so the
+// migration doesn't starve the queries on the same disks. 0 means unlimited.
+CONF_mInt64(storage_medium_migrate_speed_limit_mb_per_sec, "0");
 // The count of thread to check consistency.
 CONF_Int32(check_consistency_worker_count, "1");
 // The count of thread to upload.
@@ -115,8 +120,10 @@ CONF_mInt32(report_disk_state_interval_seconds, "60");
 CONF_mInt32(report_tablet_interval_seconds, "60");
 // The interval time(seconds) for agent report workgroup to FE.
 CONF_mInt32(report_workgroup_interval_seconds, "5");
-// The max download speed(KB/s).
+// The max download speed(KB/s) of one connection.
 CONF_mInt32(max_download_speed_kbps, "50000");
+// The files of a tablet downloaded in parallel by clone, each by its own connection.
+CONF_mInt32(clone_download_concurrency, "4");
 // The download low speed limit(KB/s).
 CONF_mInt32(download_low_speed_limit_kbps, "50");
 // The download low speed time(seconds).
@@ -165,6 +172,19 @@ CONF_Bool(compress_rowbatches, "true");
 // Compress ratio when shuffle row_batches in network, not in storage engine.
 // If ratio is less than this value, use uncompressed data instead.
 CONF_mDouble(rpc_compress_ratio_threshold, "1.1");
+// If true, each exchange channel of the pipeline engine switches among no compression, lz4 and zstd by
+// the measured compression cost and network cost, starting with the transmission_compression_type of the query.
+// It has no effect if the query doesn't compress the transmitted data.
+CONF_mBool(enable_adaptive_exchange_compression, "true");
+// Every this number of chunks, an exchange channel compresses the chunk with all the codecs to refresh their cost.
+CONF_mInt32(adaptive_exchange_compression_sample_interval, "64");
+// A hash shuffle exchange sink samples one of every this number of rows to find the hot keys, which alone take
+// more than the fair share of one receiver. They are reported in the profile as HotKeys and HotKeyRows.
+// 0 disables the detection.
+CONF_mInt32(exchange_skew_detection_sample_stride, "16");
+// If true, the hash shuffle exchange of the pipeline engine hands the chunks to the receivers in the same process
+// directly, without serialization and compression, even if the query doesn't enable exchange pass through.
+CONF_mBool(enable_shuffle_pass_through, "true");
 // Serialize and deserialize each returned row batch.
 CONF_Bool(serialize_batch, "false");
 // Interval between profile reports; in seconds.
@@ -197,6 +217,10 @@ CONF_mInt32(doris_scanner_queue_size, "1024");
 CONF_mInt32(doris_scanner_row_num, "16384");
 // Number of max hdfs scanners.
 CONF_Int32(max_hdfs_scanner_num, "50");
+// The max number of threads a FileScanNode of a load scans its scan ranges with, each thread scans a continuous group
+// of the scan ranges in order. The rows of different groups are loaded in any order, so keep it 1 unless the order
+// of the rows with the same key in different files doesn't matter.
+CONF_mInt32(file_scan_node_max_scanner_num, "1");
 // Number of max scan keys.
 CONF_mInt32(doris_max_scan_key_num, "1024");
 // The max number of push down values of a single column.
@@ -213,11 +237,22 @@ CONF_mInt64(column_dictionary_key_ratio_threshold, "0");
 CONF_mInt64(column_dictionary_key_size_threshold, "0");
 // The memory_limitation_per_thread_for_schema_change unit GB.
 CONF_mInt32(memory_limitation_per_thread_for_schema_change, "2");
+// The max number of rowsets of a tablet converted in parallel by a direct schema change.
+CONF_mInt32(schema_change_convert_parallelism, "4");
 
 CONF_mInt32(update_cache_expire_sec, "360");
 CONF_mInt32(file_descriptor_cache_clean_interval, "3600");
+// The number of the most queried tablets recorded in each storage root, whose segment metadata is loaded
+// in background after BE restarts. 0 means disabled.
+CONF_mInt32(storage_warmup_hot_tablet_num, "0");
+// The interval of recording the most queried tablets, they are also recorded when BE stops.
+CONF_mInt32(storage_warmup_record_interval_seconds, "600");
+// The pause between warming up two tablets, to limit the IO of warming up.
+CONF_mInt32(storage_warmup_interval_ms, "10");
 CONF_mInt32(disk_stat_monitor_interval, "5");
 CONF_mInt32(unused_rowset_monitor_interval, "30");
+// The max bytes of unused rowsets deleted per second from one data dir, 0 means no limit.
+CONF_mInt64(unused_rowset_delete_bytes_per_second_per_disk, "1073741824");
 CONF_String(storage_root_path, "${STARROCKS_HOME}/storage");
 // BE process will exit if the percentage of error disk reach this value.
 CONF_mInt32(max_percentage_of_error_disk, "0");
@@ -249,9 +284,45 @@ CONF_Int64(index_stream_cache_capacity, "10737418240");
 CONF_String(storage_page_cache_limit, "0");
 // whether to disable page cache feature in storage
 CONF_Bool(disable_storage_page_cache, "true");
+// The capacity in bytes of the cache of the segment footers, from which the column readers are created when
+// the columns are read for the first time. The footer of a segment evicted from the cache is read again
+// from the file when it's needed.
+CONF_Int64(segment_meta_cache_capacity, "268435456");
+// The capacity in bytes of the cache of the parquet footers and the orc file tails of the hive/iceberg/hudi
+// tables, which are read and parsed once per file per query otherwise. 0 means disabled.
+CONF_Int64(file_meta_cache_capacity, "268435456");
+// A scan of a tablet larger than this ratio of the page cache capacity only looks up the page cache,
+// without inserting the pages it reads, so that a large sequential scan doesn't evict the working set
+// of other queries. 0 means all the scans fill the page cache.
+CONF_mDouble(storage_page_cache_large_scan_ratio, "0.1");
+// The capacity in bytes of the local cache of the remote file blocks read by the hive/iceberg/hudi scans
+// on every SSD storage path, or on every storage path if there is no SSD one. 0 means disabled.
+CONF_Int64(block_cache_disk_capacity, "0");
+CONF_Int64(block_cache_block_size, "1048576");
+// The comma-separated tables whose blocks are admitted into the block cache, each of which is either
+// `table` or `database.table`. `*` admits all the tables.
+CONF_mString(block_cache_admission_tables, "*");
+// The number of adjacent data pages summarized by a granule of the in-memory skip index built on the
+// page zone maps of a column, the pages of a granule not matched by the predicates are skipped together.
+// Less than 2 means disabled.
+CONF_Int32(zone_map_pages_per_granule, "32");
 // whether to disable column pool
 CONF_Bool(disable_column_pool, "false");
 
+// The bytes of the data pages read ahead by a segment iterator in one window, 0 means disabled.
+// The pages to be read are coalesced into large reads, which are issued by the readahead thread pool
+// while the previous window is being decoded. It only takes effect when the page cache isn't used.
+// It can be overwritten by the session variable `segment_readahead_bytes`.
+CONF_mInt64(segment_readahead_bytes, "0");
+// The count of thread to read ahead the data pages of segments.
+CONF_Int32(segment_readahead_thread_pool_size, "8");
+// The max queue size of the readahead thread pool, the readahead is done by the scan thread if it's full.
+CONF_Int32(segment_readahead_thread_pool_queue_size, "1024");
+
+// Whether to evaluate the predicates on the dictionary of the string columns that are not all
+// dict-encoded, and filter the rows of the dict-encoded pages by the codes.
+CONF_mBool(enable_segment_page_predicate_pushdown, "true");
+
 CONF_mInt32(base_compaction_check_interval_seconds, "60");
 CONF_mInt64(min_base_compaction_num_singleton_deltas, "5");
 CONF_mInt64(max_base_compaction_num_singleton_deltas, "100");
@@ -291,11 +362,19 @@ CONF_Int32(max_compaction_concurrency, "-1");
 CONF_mInt32(base_compaction_trace_threshold, "120");
 CONF_mInt32(cumulative_compaction_trace_threshold, "60");
 CONF_mInt32(update_compaction_trace_threshold, "20");
+// Threshold to logging the trace of the slow RPCs and agent tasks, in milliseconds. Non-positive disables it.
+CONF_mInt64(slow_rpc_trace_threshold_ms, "3000");
+CONF_mInt64(slow_agent_task_trace_threshold_ms, "10000");
 
 // Max columns of each compaction group.
 // If the number of schema columns is greater than this,
 // the columns will be divided into groups for vertical compaction.
 CONF_Int64(vertical_compaction_max_columns_per_group, "5");
+// The number of column groups read and merged at the same time in vertical compaction, each by its own thread
+// and ahead of the column group being written. The memory limit of a compaction is shared by them.
+CONF_mInt32(vertical_compaction_max_parallel_column_groups, "4");
+// The max number of merged chunks buffered for each column group to be written in vertical compaction.
+CONF_mInt32(vertical_compaction_max_buffered_chunks, "4");
 
 CONF_mBool(enable_compaction, "true");
 CONF_Bool(enable_event_based_compaction_framework, "false");
@@ -308,6 +387,17 @@ CONF_mInt64(min_cumulative_compaction_size, "5368709120");
 // 20GB
 CONF_mInt64(min_base_compaction_size, "21474836480");
 
+// The I/O rate budget of the compaction tasks on each disk, in MB per second, counting both the bytes read and
+// written. A task is started only when its disk is not in debt of the budget. <= 0 means no limit.
+CONF_mInt64(compaction_io_budget_mb_per_disk, "0");
+// Compaction backs off, by halving its I/O budget and concurrency, when the average latency of the query
+// fragments exceeds this ratio of its moving average. <= 0 means never back off.
+CONF_mDouble(compaction_backoff_query_latency_ratio, "1.5");
+CONF_mInt32(compaction_query_latency_check_interval_sec, "10");
+// Prefer the compaction candidates saving more segments to read per byte rewritten,
+// rather than the ones with the highest compaction score.
+CONF_Bool(enable_compaction_io_efficiency_priority, "true");
+
 // Max row source mask memory bytes, default is 200M.
 // Should be smaller than compaction_mem_limit.
 // When the row source mask buffer exceeds this, it will be persisted to a temporary file on the disk.
@@ -340,6 +430,13 @@ CONF_mInt64(streaming_load_max_mb, "10240");
 // Therefore, it is necessary to limit the maximum number of
 // such data when using stream load to prevent excessive memory consumption.
 CONF_mInt64(streaming_load_max_batch_size_mb, "100");
+// The small csv stream loads with the header "group_commit: true" into the same table are grouped
+// into one load transaction on each BE. A group is committed after this interval since it is formed,
+// or once it has buffered |stream_load_group_commit_max_bytes| of data, whichever comes first.
+CONF_mInt32(stream_load_group_commit_interval_ms, "1000");
+CONF_mInt64(stream_load_group_commit_max_bytes, "67108864");
+// The stream loads larger than this are never grouped and are loaded in their own transactions.
+CONF_mInt64(stream_load_group_commit_max_body_bytes, "1048576");
 // The alive time of a TabletsChannel.
 // If the channel does not receive any data till this time,
 // the channel will be removed.
@@ -354,6 +451,16 @@ CONF_Int32(tablet_writer_open_rpc_timeout_sec, "60");
 // CONF_Int32(tablet_writer_rpc_timeout_sec, "600");
 // OlapTableSink sender's send interval, should be less than the real response time of a tablet writer rpc.
 CONF_mInt32(olap_table_sink_send_interval_ms, "10");
+// Whether OlapTableSink sends the data of the chunks in the brpc attachment instead of the protobuf message, which
+// saves a copy of the data on both sides. Disable it when rolling upgrade from the versions not reading it.
+CONF_mBool(olap_table_sink_send_chunk_in_attachment, "true");
+// The number of add_chunk rpcs a NodeChannel of OlapTableSink keeps in flight when the load doesn't set load_dop,
+// capped by max_load_dop. The receiver may apply the chunks of the in-flight rpcs in any order, so keep it 1
+// unless the order of the rows with the same key in one load doesn't matter.
+CONF_mInt32(olap_table_sink_default_parallel_request_size, "1");
+// The chunks deserialized by a TabletsChannel are kept for reusing their column buffers by the next requests,
+// unless their memory usage exceeds this limit.
+CONF_mInt64(tablets_channel_reusable_chunk_max_bytes, "67108864");
 
 // Fragment thread pool
 CONF_Int32(fragment_pool_thread_num_min, "64");
@@ -404,15 +511,32 @@ CONF_Bool(enable_quadratic_probing, "false");
 // for pprof
 CONF_String(pprof_profile_dir, "${STARROCKS_HOME}/log");
 
+// The host of the jaeger agent which the spans of the queries and loads are exported to. Tracing is disabled
+// if it's empty.
+CONF_String(jaeger_endpoint, "");
+CONF_Int32(jaeger_server_port, "6831");
+// The ratio of the queries and loads to be traced.
+CONF_Double(tracer_sample_ratio, "0.01");
+// The spans are exported in batches every tracer_export_interval_ms, the spans beyond the queue are dropped.
+CONF_Int32(tracer_max_queue_size, "2048");
+CONF_Int32(tracer_max_export_batch_size, "512");
+CONF_Int64(tracer_export_interval_ms, "5000");
+
 // for partition
 // CONF_Bool(enable_partitioned_hash_join, "false")
 CONF_Bool(enable_partitioned_aggregation, "true");
+// Whether the streaming pre-aggregation with a two-level hash map decides to aggregate or to stream the new keys
+// by each sub map, instead of streaming all the new keys once the hash map is full and reduces poorly overall.
+CONF_mBool(enable_streaming_preaggregation_by_partition, "true");
 
 // to forward compatibility, will be removed later
 CONF_mBool(enable_token_check, "true");
 
 // to open/close system metrics
 CONF_Bool(enable_system_metrics, "true");
+// The output of /metrics is rendered at most once in this period for each format, the scrapes in between
+// get the cached output. 0 to render it for every scrape.
+CONF_mInt32(metrics_cache_ttl_ms, "1000");
 
 CONF_mBool(enable_prefetch, "true");
 
@@ -437,7 +561,7 @@ CONF_String(scratch_dirs, "/tmp");
 // then only the first writable directory is used
 // CONF_Bool(allow_multiple_scratch_dirs_per_device, "false");
 
-// Linux transparent huge page.
+// Linux transparent huge page, the chunks of at least 2MB allocated by ChunkAllocator are advised to use huge pages.
 CONF_Bool(madvise_huge_pages, "false");
 
 // Whether use mmap to allocate memory.
@@ -460,12 +584,27 @@ CONF_mInt64(write_buffer_size, "104857600");
 CONF_Int64(load_process_max_memory_limit_bytes, "107374182400"); // 100GB
 CONF_Int32(load_process_max_memory_limit_percent, "30");         // 30%
 CONF_Bool(enable_new_load_on_memory_limit_exceeded, "false");
+// The MemTables of all the loads on a Backend share the memory of the load process: once they use more than
+// this percent of its limit, the largest MemTables are flushed first until they use less than half of it.
+CONF_mInt32(load_memtable_memory_percent, "60");
+// The write buffer size at which a MemTable of load is flushed by itself. It can be larger than
+// `write_buffer_size`, as the MemTables of small tablets can grow while the largest ones are flushed under
+// memory pressure, which makes fewer and larger segments.
+CONF_mInt64(load_memtable_max_buffer_size, "268435456");
 CONF_Int64(compaction_max_memory_limit, "-1");
 CONF_Int32(compaction_max_memory_limit_percent, "100");
 CONF_Int64(compaction_memory_limit_per_worker, "2147483648"); // 2GB
 CONF_String(consistency_max_memory_limit, "10G");
 CONF_Int32(consistency_max_memory_limit_percent, "20");
 CONF_Int32(update_memory_limit_percent, "60");
+// The capacity of the primary index cache in percentage of the update memory limit, the unused primary indexes
+// are evicted from the cache when it's full.
+CONF_Int32(update_index_cache_capacity_percent, "100");
+// When the primary index cache is full, the unused primary indexes larger than this percentage of the capacity are
+// evicted first, so that a single huge primary index cannot monopolize the cache. 0 means no limit.
+CONF_Int32(update_index_cache_max_entry_percent, "30");
+// Load the primary index of a tablet in background when its rowset is written, instead of blocking the load.
+CONF_mBool(enable_update_index_async_preload, "true");
 
 // Update interval of tablet stat cache.
 CONF_mInt32(tablet_stat_cache_update_interval_second, "300");
@@ -479,6 +618,15 @@ CONF_mInt32(priority_queue_remaining_tasks_increased_frequency, "512");
 // Sync tablet_meta when modifing meta.
 CONF_mBool(sync_tablet_meta, "false");
 
+// Pipeline the WAL writes and the memtable writes of the meta store, the concurrent writes are also grouped into one
+// WAL write by rocksdb.
+CONF_Bool(meta_store_pipelined_write, "true");
+// The options of the column families of the meta store, the defaults of rocksdb are 64MB, 2, 20 and 36.
+CONF_Int64(meta_store_write_buffer_size, "67108864");
+CONF_Int32(meta_store_max_write_buffer_number, "4");
+CONF_Int32(meta_store_level0_slowdown_writes_trigger, "40");
+CONF_Int32(meta_store_level0_stop_writes_trigger, "64");
+
 // Default thrift rpc timeout ms.
 CONF_mInt32(thrift_rpc_timeout_ms, "5000");
 
@@ -490,6 +638,9 @@ CONF_Bool(enable_metric_calculator, "true");
 
 // Max consumer num in one data consumer group, for routine load.
 CONF_mInt32(max_consumer_num_per_group, "3");
+// The max bytes buffered between the kafka consumers and the scanner of a routine load task. A larger buffer lets the
+// consumers keep fetching while the scanner parses a large batch.
+CONF_mInt64(routine_load_kafka_pipe_buffered_bytes, "4194304");
 
 // The size of thread pool for routine load task.
 // this should be larger than FE config 'max_concurrent_task_num_per_be' (default 5).
@@ -513,6 +664,9 @@ CONF_String(es_scroll_keepalive, "5m");
 // HTTP connection timeout for es.
 CONF_Int32(es_http_timeout_ms, "5000");
 
+// The number of sliced scrolls scanning each shard of es in parallel, each slice is scanned by a scanner.
+CONF_Int32(es_scroll_slices_per_shard, "1");
+
 // The max client cache number per each host.
 // There are variety of client cache in BE, but currently we use the
 // same cache size configuration.
@@ -536,6 +690,13 @@ CONF_mInt32(storage_flood_stage_usage_percent, "95"); // 95%
 CONF_mInt64(storage_flood_stage_left_capacity_bytes, "1073741824"); // 1GB
 // Number of thread for flushing memtable per store.
 CONF_Int32(flush_thread_num_per_store, "2");
+// Number of threads shared by all the memtable flushes to sort a large memtable and to encode the columns
+// of a large chunk in parallel, 0 to disable.
+CONF_Int32(memtable_flush_parallel_thread_num, "8");
+// A memtable is sorted in partitions of about this number of rows in parallel, and then merged.
+CONF_mInt64(memtable_parallel_sort_rows_per_partition, "262144");
+// The columns of a chunk of at least this number of rows are encoded in parallel by the segment writer.
+CONF_mInt64(segment_writer_parallel_append_min_rows, "65536");
 
 // Config for tablet meta checkpoint.
 CONF_mInt32(tablet_meta_checkpoint_min_new_rowsets_num, "10");
@@ -545,6 +706,9 @@ CONF_mInt32(tablet_meta_checkpoint_min_interval_secs, "600");
 CONF_Int64(brpc_max_body_size, "2147483648");
 // Max unwritten bytes in each socket, if the limit is reached, Socket.Write fails with EOVERCROWDED.
 CONF_Int64(brpc_socket_max_unwritten_bytes, "1073741824");
+// The number of connections to every other backend, over which the rpcs are spread by the fragment instance.
+// One connection is served by one brpc io thread at each end, which limits the throughput of the wide shuffles.
+CONF_Int32(brpc_connections_per_endpoint, "4");
 
 // Max number of txns for every txn_partition_map in txn manager.
 // this is a self protection to avoid too many txns saving in manager.
@@ -567,11 +731,18 @@ CONF_Int32(txn_shard_size, "1024");
 // Whether to continue to start be when load tablet from header failed.
 CONF_Bool(ignore_load_tablet_failure, "false");
 
+// The threads loading the tablets and the rowsets of one data dir when be starts.
+CONF_Int32(load_tablet_threads_per_data_dir, "8");
+
 // Whether to continue to start be when load tablet from header failed.
 CONF_Bool(ignore_rowset_stale_unconsistent_delete, "false");
 
 // The chunk size for vector query engine
 CONF_Int32(vector_chunk_size, "4096");
+// The max bytes of a chunk read by the olap scan of the pipeline engine. The chunk size is reduced if the
+// columns read are so wide, estimated by their average width in the segments, that a chunk exceeds it.
+// 0 means unlimited.
+CONF_mInt64(olap_scan_max_chunk_bytes, "33554432");
 
 // Valid range: [0-1000].
 // `0` will disable late materialization.
@@ -591,6 +762,25 @@ CONF_Int16(bitmap_max_filter_items, "30");
 // The bitmap max filter ratio, valid value range is: [0-1000].
 CONF_Int16(bitmap_max_filter_ratio, "1");
 
+// The number of bytes of each gram of the n-gram index built on string columns. Changing it only affects the
+// segments written afterwards, since the gram size is persisted in the index meta.
+CONF_Int32(ngram_index_gram_size, "3");
+
+// Whether to write the numeric columns by the encodings adapting to the values of each page, i.e. the
+// delta-of-delta encoding of integers and the decimal scaling encoding of floating point numbers. They are
+// not readable by the older versions, so enable it only after all the BEs are upgraded.
+CONF_mBool(enable_adaptive_numeric_encoding, "false");
+
+// Whether to compress the pages of the string columns by zstd with a dictionary trained on the first pages of
+// each column of a segment, which compresses the small pages much better. The dictionary is stored in the
+// segment footer. The segments are not readable by the older versions, so enable it only after all the BEs
+// are upgraded.
+CONF_mBool(enable_zstd_dict_compression, "false");
+// The bytes of the first pages of a column used to train the zstd dictionary.
+CONF_mInt64(zstd_dict_sample_bytes, "1048576");
+// The max size of the zstd dictionary of a column.
+CONF_mInt32(zstd_dict_max_size, "16384");
+
 CONF_Bool(bitmap_filter_enable_not_equal, "false");
 
 // Only 1 and 2 is valid.
@@ -635,6 +825,11 @@ CONF_Int16(tablet_max_versions, "1000");
 // The maximum number of pending versions allowed for a primary key tablet
 CONF_mInt32(tablet_max_pending_versions, "1000");
 
+// The maximum number of the small L1 tier files of a persistent primary index. When L0 is flushed but L1 is much
+// larger than L0, L0 is written into a new tier file instead of rewriting L1, and the tier files are merged when
+// the number of them reaches this value. 0 means L0 is always merged into L1.
+CONF_mInt32(persistent_index_max_l1_tier_files, "4");
+
 // NOTE: it will be deleted.
 CONF_mBool(enable_bitmap_union_disk_format_with_set, "false");
 
@@ -651,9 +846,63 @@ CONF_Int64(pipeline_io_buffer_size, "64");
 CONF_Int64(pipeline_sink_buffer_size, "64");
 // The degree of parallelism of brpc.
 CONF_Int64(pipeline_sink_brpc_dop, "8");
+// The max number of fragment instances on the same backend, whose pending requests are sent by one rpc.
+// 1 disables the batching, and every request is sent by its own rpc.
+CONF_mInt64(pipeline_sink_brpc_batch_size, "8");
+// Whether the exchange sink sends no more bytes to a receiver than the credit granted by the receiver.
+// Otherwise, a slow receiver only stops its senders by delaying the responses after its buffer is full.
+CONF_mBool(enable_exchange_credit_flow_control, "true");
+// If the session enables spilling, the exchange sink spills the requests waiting for a busy receiver to the local
+// disk instead of blocking, once the unsent bytes in memory exceed this threshold, or the receiver has
+// pipeline_sink_buffer_size requests waiting in memory.
+CONF_mInt64(pipeline_sink_spill_mem_threshold_bytes, "268435456");
 // Used to reject coming fragment instances, when the number of running drivers
 // exceeds it*pipeline_exec_thread_pool_thread_num.
 CONF_Int64(pipeline_max_num_drivers_per_exec_thread, "10240");
+// Whether each execution thread of pipeline engine has a local driver queue and steals drivers from the others,
+// instead of sharing a single driver queue. It doesn't affect the execution threads for resource group.
+CONF_Bool(pipeline_enable_work_stealing_driver_queue, "true");
+// Whether to split the big tablets into multiple morsels by segments and row ids, so that a skewed tablet
+// could be scanned by multiple drivers in parallel. Only for the tablets whose rows needn't be merged.
+CONF_mBool(pipeline_enable_split_tablet_scan, "true");
+// The minimum number of rows of a morsel split from a tablet.
+CONF_mInt64(pipeline_min_split_tablet_scan_rows, "262144");
+// Whether to split the big ranges of the ORC and Parquet files into multiple morsels by byte ranges, so that
+// a big file could be scanned by multiple drivers in parallel.
+CONF_mBool(pipeline_enable_split_hdfs_scan_range, "true");
+// The minimum number of bytes of a morsel split from a range of an ORC or Parquet file.
+CONF_mInt64(pipeline_min_split_hdfs_scan_range_size, "134217728");
+// The blocked drivers are re-checked by PipelineDriverPoller when the exchange receivers, sink buffers,
+// runtime filters, local exchangers and scan io tasks notify that their drivers may be unblocked.
+// All the blocked drivers are also checked at this interval, as the fallback of the missing notifications.
+CONF_mInt64(pipeline_poller_fallback_check_interval_us, "1000");
+// The period of the cpu bandwidth of the workgroups with cpu_hard_limit. A workgroup can consume at most
+// cpu_hard_limit*period cpu time by the pipeline drivers and scan tasks in each period, like cpu.cfs_period_us.
+CONF_mInt64(pipeline_cpu_hard_limit_period_us, "100000");
+// Whether to make the pipeline engine NUMA-aware on the machines with multiple NUMA nodes.
+// The executor threads are grouped and bound to the NUMA nodes, and all the drivers of a fragment instance
+// are scheduled by the executor threads of the same node, so they access the hash tables and chunks allocated
+// by themselves on the local node. ChunkAllocator also reuses the free chunks only from the local node.
+CONF_Bool(pipeline_enable_numa_aware_scheduling, "false");
+// The number of threads shared by the pipeline drivers to build the large hash tables of the broadcast joins,
+// which are shared by all the probe drivers of a fragment. 0 means the hash table is built by the build driver alone.
+CONF_Int32(pipeline_hash_join_build_thread_pool_thread_num, "8");
+// The minimum number of build rows of each parallel task to build a hash table of a broadcast join.
+CONF_mInt64(pipeline_hash_join_parallel_build_min_rows, "1048576");
+// The number of threads shared by the pipeline drivers to output the large two-level hash tables of the blocking
+// aggregations, by finalizing their sub tables in parallel. 0 means a hash table is output by its source driver alone.
+CONF_Int32(pipeline_agg_output_thread_pool_thread_num, "8");
+// The minimum number of groups of a two-level hash table of the blocking aggregation to output in parallel.
+CONF_mInt64(pipeline_agg_parallel_output_min_rows, "1048576");
+// Whether to extract the sub expressions repeated in the output expressions of a projection, which are not
+// extracted by the planner, and evaluate each of them once per chunk.
+CONF_mBool(enable_project_common_sub_expr_elimination, "true");
+// Whether to evaluate the trees of arithmetic, comparison and logic operators over numeric columns in fused loops
+// over tiles of rows, instead of node by node.
+CONF_mBool(enable_fused_expr_evaluation, "true");
+// Whether to evaluate a deterministic function of a single low-cardinality string column once per distinct
+// value of the column in a chunk, and map the results back to the rows.
+CONF_mBool(enable_function_dict_evaluation, "true");
 
 // The bitmap serialize version.
 CONF_Int16(bitmap_serialize_version, "1");
@@ -667,6 +916,16 @@ CONF_Int64(max_segment_file_size, "1073741824");
 // hdfsPreadFully() are always enabled for object storage.
 CONF_Bool(use_hdfs_pread, "true");
 
+// Enables the hedged reads of the hdfs client: if a positional read of a block does not return within the threshold,
+// a duplicate read is issued to another DataNode holding a replica of the block, and the first one returned is used.
+// These are applied when connecting to the namenode.
+CONF_Bool(hdfs_client_enable_hedged_read, "false");
+// The number of threads of the hdfs client to issue the hedged reads.
+CONF_Int32(hdfs_client_hedged_read_threadpool_size, "128");
+// The latency of a positional read in milliseconds to issue the hedged read. The reads slower than it are also
+// counted as slow reads in the query profile.
+CONF_Int32(hdfs_client_hedged_read_threshold_millis, "2500");
+
 // Rewrite partial semgent or not.
 // if true, partial segment will be rewrite into new segment file first and append other column data
 // if false, the data of other column will be append into partial segment file and rebuild segment footer
@@ -674,6 +933,11 @@ CONF_Bool(use_hdfs_pread, "true");
 // default: true
 CONF_Bool(rewrite_partial_segment, "true");
 
+// if true, the partial updates of primary key tablets are applied in column mode, i.e, the updated columns
+// of the existing rows are written into delta column files of their segments, instead of reading the other
+// columns and writing the full rows, which is much cheaper to update a few columns of a wide table.
+CONF_mBool(enable_column_mode_partial_update, "false");
+
 // Properties to access object storage
 CONF_String(object_storage_access_key_id, "");
 CONF_String(object_storage_secret_access_key, "");
@@ -687,11 +951,25 @@ CONF_Bool(enable_orc_late_materialization, "true");
 CONF_Int32(orc_file_cache_max_size, "2097152");
 // parquet reader, each column will reserve X bytes for read
 CONF_mInt32(parquet_buffer_stream_reserve_size, "1048576");
+// parquet reader, skip the pages which can't satisfy the min/max conjuncts by the page indexes of the columns.
+CONF_mBool(parquet_page_index_enable, "true");
+// parquet reader, read the columns without conjuncts only for the rows selected by the conjuncts on the other columns.
+CONF_mBool(parquet_late_materialization_enable, "true");
+// parquet reader, the column chunks of a row group not farther apart than this gap are read by one request.
+CONF_mInt64(parquet_coalesce_read_max_gap, "1048576");
+// parquet reader, the max size of a coalesced read. A larger column chunk is read page by page.
+// 0 means the column chunks are not coalesced.
+CONF_mInt64(parquet_coalesce_read_max_size, "8388608");
+// The number of threads shared by the parquet readers to read the coalesced column chunks concurrently.
+// 0 means the column chunks are read by the scan thread alone.
+CONF_Int32(parquet_read_thread_pool_thread_num, "16");
 
 // default: 16MB
 CONF_mInt64(experimental_s3_max_single_part_size, "16777216");
 // default: 16MB
 CONF_mInt64(experimental_s3_min_upload_part_size, "16777216");
+// The max number of parts an S3 output stream uploads concurrently in a multipart upload.
+CONF_mInt32(experimental_s3_max_upload_parts_in_flight, "4");
 
 CONF_Int64(max_load_dop, "16");
 
@@ -704,10 +982,29 @@ CONF_Int64(deliver_broadcast_rf_passthrough_bytes_limit, "131072");
 // in passthrough style, the number of inflight RPCs of parallel deliveries are issued is not exceeds this limit.
 CONF_Int64(deliver_broadcast_rf_passthrough_inflight_num, "10");
 CONF_Int64(send_rpc_runtime_filter_timeout_ms, "1000");
+// the number of the nodes that a node sends a global runtime filter to at the same time, and each of them forwards
+// the filter to its share of the rest nodes in the same way.
+CONF_mInt64(runtime_filter_forward_fanout, "4");
+// the global runtime filters whose serialized size is no less than this limit are compressed by lz4 on the wire.
+CONF_mInt64(runtime_filter_compress_bytes_threshold, "65536");
+// the global runtime filters whose serialized size exceeds this limit are shipped as min/max only.
+CONF_mInt64(runtime_filter_max_ship_bytes, "67108864");
 
 // enable optimized implementation of schema change
 CONF_Bool(enable_schema_change_v2, "true");
 
+// Spill to disk for operators of the pipeline engine, only takes effect when the session enables spilling.
+// An operator starts to spill once its own memory usage exceeds spill_operator_mem_limit_bytes,
+// or the query memory usage exceeds spill_query_mem_limit_ratio of the query memory limit.
+CONF_mInt64(spill_operator_mem_limit_bytes, "1073741824");
+CONF_mDouble(spill_query_mem_limit_ratio, "0.8");
+// The number of hash partitions a spilling operator splits its in-memory state into.
+CONF_mInt32(spill_partition_num, "16");
+
+// The new values of percentile_approx, percentile_hash and percentile_union are built with DDSketch instead of
+// TDigest, which has a bounded size and a relative error of 1%. The stored TDigest values are still readable.
+CONF_mBool(percentile_use_ddsketch, "false");
+
 } // namespace config
 
 } // namespace starrocks
@@ -3,6 +3,12 @@
 #include "common/tracer.h"
 
 #include <opentelemetry/exporters/jaeger/jaeger_exporter.h>
+#include <opentelemetry/sdk/trace/samplers/parent.h>
+#include <opentelemetry/sdk/trace/samplers/trace_id_ratio.h>
+
+#include <cstring>
+
+#include "common/config.h"
 
 namespace starrocks {
 
@@ -13,18 +19,42 @@ Tracer::Tracer(const std::string& service_name, const TracerOptions& tracer_opts
     init(service_name);
 }
 
+Tracer& Tracer::Instance() {
+    static Tracer tracer("starrocks_be",
+                         TracerOptions{config::jaeger_endpoint, config::jaeger_server_port,
+                                       config::tracer_sample_ratio,
+                                       static_cast<size_t>(config::tracer_max_queue_size),
+                                       static_cast<size_t>(config::tracer_max_export_batch_size),
+                                       config::tracer_export_interval_ms});
+    return tracer;
+}
+
 void Tracer::init(const std::string& service_name) {
+    if (_tracer_options.jaeger_endpoint.empty()) {
+        // The global provider is a no-op one unless it's set.
+        _enabled = false;
+        _tracer = opentelemetry::trace::Provider::GetTracerProvider()->GetTracer(service_name);
+        return;
+    }
     opentelemetry::exporter::jaeger::JaegerExporterOptions opts;
     opts.endpoint = _tracer_options.jaeger_endpoint;
     opts.server_port = _tracer_options.jaeger_server_port;
     auto jaeger_exporter = std::unique_ptr<opentelemetry::sdk::trace::SpanExporter>(
             new opentelemetry::exporter::jaeger::JaegerExporter(opts));
+    // The spans are exported by a background thread rather than the threads ending them.
+    sdktrace::BatchSpanProcessorOptions processor_opts;
+    processor_opts.max_queue_size = _tracer_options.max_queue_size;
+    processor_opts.max_export_batch_size = _tracer_options.max_export_batch_size;
+    processor_opts.schedule_delay_millis = std::chrono::milliseconds(_tracer_options.export_interval_ms);
     auto processor = std::unique_ptr<opentelemetry::sdk::trace::SpanProcessor>(
-            new opentelemetry::sdk::trace::SimpleSpanProcessor(std::move(jaeger_exporter)));
+            new opentelemetry::sdk::trace::BatchSpanProcessor(std::move(jaeger_exporter), processor_opts));
+    // Head-based sampling: the root spans are sampled by the ratio, and the others follow their parents.
+    auto sampler = std::unique_ptr<sdktrace::Sampler>(new sdktrace::ParentBasedSampler(
+            std::make_shared<sdktrace::TraceIdRatioBasedSampler>(_tracer_options.sample_ratio)));
     const auto jaeger_resource = opentelemetry::sdk::resource::Resource::Create(
             std::move(opentelemetry::sdk::resource::ResourceAttributes{{"service.name", service_name}}));
     const auto provider = opentelemetry::nostd::shared_ptr<opentelemetry::trace::TracerProvider>(
-            new opentelemetry::sdk::trace::TracerProvider(std::move(processor), jaeger_resource));
+            new opentelemetry::sdk::trace::TracerProvider(std::move(processor), jaeger_resource, std::move(sampler)));
     _tracer = provider->GetTracer(service_name, OPENTELEMETRY_SDK_VERSION);
 }
 
@@ -37,7 +67,7 @@ Span Tracer::start_trace(const std::string& trace_name) {
 }
 
 Span Tracer::add_span(const std::string& span_name, const Span& parent_span) {
-    const auto parent_ctx = parent_span->GetContext();
+    const auto parent_ctx = parent_span ? parent_span->GetContext() : SpanContext::GetInvalid();
     return add_span(span_name, parent_ctx);
 }
 
@@ -47,4 +77,77 @@ Span Tracer::add_span(const std::string& span_name, const SpanContext& parent_ct
     return _tracer->StartSpan(span_name, span_opts);
 }
 
+SpanContext Tracer::query_trace_context(const TUniqueId& query_id) const {
+    uint8_t trace_id[trace::TraceId::kSize];
+    memcpy(trace_id, &query_id.hi, sizeof(query_id.hi));
+    memcpy(trace_id + sizeof(query_id.hi), &query_id.lo, sizeof(query_id.lo));
+    // The span of the query itself is not exported, the spans of the fragment instances are its children.
+    uint64_t query_span_id = static_cast<uint64_t>(query_id.lo) | 1;
+    uint8_t span_id[trace::SpanId::kSize];
+    memcpy(span_id, &query_span_id, sizeof(query_span_id));
+    // The query id is mixed by fibonacci hashing before compared with the ratio.
+    uint64_t hash = static_cast<uint64_t>(query_id.hi ^ query_id.lo) * 0x9E3779B97F4A7C15ULL;
+    bool sampled = _enabled && static_cast<double>(hash) < _tracer_options.sample_ratio * 0x1p64;
+    return SpanContext(trace::TraceId(opentelemetry::nostd::span<const uint8_t, trace::TraceId::kSize>(trace_id)),
+                       trace::SpanId(opentelemetry::nostd::span<const uint8_t, trace::SpanId::kSize>(span_id)),
+                       trace::TraceFlags(sampled ? trace::TraceFlags::kIsSampled : 0), true);
+}
+
+std::string Tracer::to_trace_parent(const SpanContext& ctx) {
+    if (!ctx.IsValid()) {
+        return "";
+    }
+    char trace_id[2 * trace::TraceId::kSize];
+    ctx.trace_id().ToLowerBase16(trace_id);
+    char span_id[2 * trace::SpanId::kSize];
+    ctx.span_id().ToLowerBase16(span_id);
+    char flags[2];
+    ctx.trace_flags().ToLowerBase16(flags);
+
+    std::string trace_parent = "00-";
+    trace_parent.append(trace_id, sizeof(trace_id));
+    trace_parent.push_back('-');
+    trace_parent.append(span_id, sizeof(span_id));
+    trace_parent.push_back('-');
+    trace_parent.append(flags, sizeof(flags));
+    return trace_parent;
+}
+
+static bool parse_hex(const char* hex, size_t num_bytes, uint8_t* bytes) {
+    auto to_int = [](char c) -> int {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        return -1;
+    };
+    for (size_t i = 0; i < num_bytes; ++i) {
+        int high = to_int(hex[2 * i]);
+        int low = to_int(hex[2 * i + 1]);
+        if (high < 0 || low < 0) {
+            return false;
+        }
+        bytes[i] = static_cast<uint8_t>(high << 4 | low);
+    }
+    return true;
+}
+
+SpanContext Tracer::from_trace_parent(const std::string& trace_parent) {
+    // version(2)-trace_id(32)-span_id(16)-flags(2)
+    constexpr size_t kTraceParentSize = 2 + 1 + 2 * trace::TraceId::kSize + 1 + 2 * trace::SpanId::kSize + 1 + 2;
+    if (trace_parent.size() != kTraceParentSize || trace_parent.compare(0, 3, "00-") != 0 ||
+        trace_parent[35] != '-' || trace_parent[52] != '-') {
+        return SpanContext::GetInvalid();
+    }
+    uint8_t trace_id[trace::TraceId::kSize];
+    uint8_t span_id[trace::SpanId::kSize];
+    uint8_t flags;
+    if (!parse_hex(trace_parent.data() + 3, sizeof(trace_id), trace_id) ||
+        !parse_hex(trace_parent.data() + 36, sizeof(span_id), span_id) ||
+        !parse_hex(trace_parent.data() + 53, 1, &flags)) {
+        return SpanContext::GetInvalid();
+    }
+    return SpanContext(trace::TraceId(opentelemetry::nostd::span<const uint8_t, trace::TraceId::kSize>(trace_id)),
+                       trace::SpanId(opentelemetry::nostd::span<const uint8_t, trace::SpanId::kSize>(span_id)),
+                       trace::TraceFlags(flags), true);
+}
+
 } // namespace starrocks
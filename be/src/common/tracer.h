@@ -3,10 +3,14 @@
 #pragma once
 
 #include <opentelemetry/exporters/jaeger/jaeger_exporter.h>
-#include <opentelemetry/sdk/trace/simple_processor.h>
+#include <opentelemetry/sdk/trace/batch_span_processor.h>
 #include <opentelemetry/sdk/trace/tracer_provider.h>
 #include <opentelemetry/trace/provider.h>
 
+#include <string>
+
+#include "gen_cpp/Types_types.h"
+
 namespace starrocks {
 
 using Span = opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span>;
@@ -16,6 +20,12 @@ using SpanContext = opentelemetry::trace::SpanContext;
 struct TracerOptions {
     std::string jaeger_endpoint;
     int jaeger_server_port;
+    // The ratio of the traces to be sampled, the spans are sampled as their parents if they have.
+    double sample_ratio = 1.0;
+    // The spans are exported by a background thread in batches, the spans beyond the queue are dropped.
+    size_t max_queue_size = 2048;
+    size_t max_export_batch_size = 512;
+    int64_t export_interval_ms = 5000;
 };
 
 /**
@@ -44,6 +54,12 @@ class Tracer {
 public:
     Tracer(const std::string& service_name, const TracerOptions& tracer_opts = {"localhost", 6381});
 
+    // The tracer of the backend, configured by config::jaeger_endpoint. If it's empty, the tracer creates
+    // no-op spans, whose cost is negligible.
+    static Tracer& Instance();
+
+    bool is_enabled() const { return _enabled; }
+
     // Shutdown the tracer.
     void shutdown();
 
@@ -51,7 +67,8 @@ public:
     // this span represents a trace, since it has no parent.
     Span start_trace(const std::string& trace_name);
 
-    // Creates and returns a new span with `span_name` which parent span is `parent_span'.
+    // Creates and returns a new span with `span_name` which parent span is `parent_span', or a root span
+    // if `parent_span` is null.
     Span add_span(const std::string& span_name, const Span& parent_span);
 
     // Creates and return a new span with `span_name`
@@ -59,12 +76,24 @@ public:
     // parent_ctx contains the required information of the trace.
     Span add_span(const std::string& span_name, const SpanContext& parent_ctx);
 
+    // Returns the context of the trace of a query or a load, whose trace id is |query_id|. The spans of all
+    // the fragment instances on all the backends are in the same trace without the context from FE, and
+    // whether the trace is sampled is decided by the trace id, so it's the same on all the backends.
+    SpanContext query_trace_context(const TUniqueId& query_id) const;
+
+    // Converts the span context to and from the W3C traceparent header, e.g.
+    // 00-0af7651916cd43dd8448eb211c80319c-b7ad6b7169203331-01, which is propagated in the rpc requests.
+    // from_trace_parent returns an invalid context if |trace_parent| is malformed.
+    static std::string to_trace_parent(const SpanContext& ctx);
+    static SpanContext from_trace_parent(const std::string& trace_parent);
+
 private:
     // Init the tracer.
     void init(const std::string& service_name);
 
     opentelemetry::nostd::shared_ptr<opentelemetry::trace::Tracer> _tracer;
     TracerOptions _tracer_options;
+    bool _enabled = true;
 };
 
 } // namespace starrocks
@@ -7,8 +7,11 @@
 
 #include <atomic>
 
+#include "common/config.h"
 #include "runtime/hdfs/hdfs_fs_cache.h"
 #include "util/hdfs_util.h"
+#include "util/io_latency_metrics.h"
+#include "util/stopwatch.hpp"
 
 namespace starrocks {
 
@@ -25,6 +28,8 @@ public:
     ~HdfsInputStream() override;
 
     StatusOr<int64_t> read(void* data, int64_t size) override;
+    StatusOr<int64_t> read_at(int64_t offset, void* data, int64_t size) override;
+    Status read_at_fully(int64_t offset, void* data, int64_t size) override;
     StatusOr<int64_t> get_size() override;
     StatusOr<int64_t> position() override { return _offset; }
     StatusOr<std::unique_ptr<io::NumericStatistics>> get_numeric_statistics() override;
@@ -36,6 +41,11 @@ private:
     std::string _file_name;
     int64_t _offset;
     int64_t _file_size;
+
+    // latency of the positional reads, which may be issued concurrently.
+    std::atomic<int64_t> _num_preads{0};
+    std::atomic<int64_t> _pread_ns{0};
+    std::atomic<int64_t> _num_slow_preads{0};
 };
 
 HdfsInputStream::~HdfsInputStream() {
@@ -44,17 +54,44 @@ HdfsInputStream::~HdfsInputStream() {
 }
 
 StatusOr<int64_t> HdfsInputStream::read(void* data, int64_t size) {
+    ASSIGN_OR_RETURN(int64_t r, read_at(_offset, data, size));
+    _offset += r;
+    return r;
+}
+
+// hdfsPread doesn't touch the position of the file, so the positional reads can be issued concurrently.
+StatusOr<int64_t> HdfsInputStream::read_at(int64_t offset, void* data, int64_t size) {
     if (UNLIKELY(size > std::numeric_limits<tSize>::max())) {
         size = std::numeric_limits<tSize>::max();
     }
-    tSize r = hdfsPread(_fs, _file, _offset, data, static_cast<tSize>(size));
+    MonotonicStopWatch watch;
+    watch.start();
+    tSize r = hdfsPread(_fs, _file, offset, data, static_cast<tSize>(size));
+    const int64_t elapsed_ns = watch.elapsed_time();
+    IOLatencyMetrics::instance()->record(IOLatencyMetrics::kRemoteDisk, IOType::HDFS_READ, elapsed_ns);
+    _num_preads.fetch_add(1, std::memory_order_relaxed);
+    _pread_ns.fetch_add(elapsed_ns, std::memory_order_relaxed);
+    if (elapsed_ns >= config::hdfs_client_hedged_read_threshold_millis * 1000000L) {
+        _num_slow_preads.fetch_add(1, std::memory_order_relaxed);
+    }
     if (r == -1) {
         return Status::IOError(fmt::format("fail to hdfsPread {}: {}", _file_name, get_hdfs_err_msg()));
     }
-    _offset += r;
     return r;
 }
 
+Status HdfsInputStream::read_at_fully(int64_t offset, void* data, int64_t size) {
+    int64_t nread = 0;
+    while (nread < size) {
+        ASSIGN_OR_RETURN(auto n, read_at(offset + nread, static_cast<char*>(data) + nread, size - nread));
+        if (n == 0) {
+            return Status::IOError(fmt::format("cannot read fully {}", _file_name));
+        }
+        nread += n;
+    }
+    return Status::OK();
+}
+
 Status HdfsInputStream::seek(int64_t offset) {
     if (offset < 0) return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
     _offset = offset;
@@ -78,12 +115,16 @@ StatusOr<std::unique_ptr<io::NumericStatistics>> HdfsInputStream::get_numeric_st
     auto r = hdfsFileGetReadStatistics(_file, &hdfs_statistics);
     if (r != 0) return Status::InternalError(fmt::format("hdfsFileGetReadStatistics failed: {}", r));
     auto statistics = std::make_unique<io::NumericStatistics>();
-    statistics->reserve(4);
+    statistics->reserve(7);
     statistics->append("TotalBytesRead", hdfs_statistics->totalBytesRead);
     statistics->append("TotalLocalBytesRead", hdfs_statistics->totalLocalBytesRead);
     statistics->append("TotalShortCircuitBytesRead", hdfs_statistics->totalShortCircuitBytesRead);
     statistics->append("TotalZeroCopyBytesRead", hdfs_statistics->totalZeroCopyBytesRead);
     hdfsFileFreeReadStatistics(hdfs_statistics);
+
+    statistics->append("TotalPreadCount", _num_preads.load(std::memory_order_relaxed));
+    statistics->append("TotalPreadTimeNs", _pread_ns.load(std::memory_order_relaxed));
+    statistics->append("TotalSlowPreadCount", _num_slow_preads.load(std::memory_order_relaxed));
     return std::move(statistics);
 }
 
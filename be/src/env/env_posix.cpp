@@ -27,6 +27,7 @@
 #include "gutil/strings/substitute.h"
 #include "io/fd_input_stream.h"
 #include "util/errno.h"
+#include "util/io_latency_metrics.h"
 #include "util/slice.h"
 
 namespace starrocks {
@@ -432,6 +433,9 @@ public:
         }
         auto stream = std::make_shared<io::FdInputStream>(fd);
         stream->set_close_on_delete(true);
+        auto* io_latency_metrics = IOLatencyMetrics::instance();
+        stream->set_latency_histogram(
+                io_latency_metrics->histogram(io_latency_metrics->disk_index(fname), IOType::PREAD));
         return std::make_unique<RandomAccessFile>(std::move(stream), fname);
     }
 
@@ -49,6 +49,7 @@
 #include "exec/vectorized/hdfs_scan_node.h"
 #include "exec/vectorized/intersect_node.h"
 #include "exec/vectorized/jdbc_scan_node.h"
+#include "exec/vectorized/merge_join_node.h"
 #include "exec/vectorized/mysql_scan_node.h"
 #include "exec/vectorized/olap_meta_scan_node.h"
 #include "exec/vectorized/olap_scan_node.h"
@@ -359,11 +360,17 @@ Status ExecNode::create_tree_helper(RuntimeState* state, ObjectPool* pool, const
     if (*node_idx >= tnodes.size()) {
         return Status::InternalError("Failed to reconstruct plan tree from thrift.");
     }
-    const TPlanNode& tnode = tnodes[*node_idx];
+    const TPlanNode* tnode_ptr = &tnodes[*node_idx];
+    // The merge join which can't be executed by MergeJoinNode falls back to hash join.
+    if (tnode_ptr->node_type == TPlanNodeType::MERGE_JOIN_NODE &&
+        !vectorized::MergeJoinNode::is_supported(*tnode_ptr)) {
+        tnode_ptr = pool->add(new TPlanNode(vectorized::MergeJoinNode::to_hash_join_tnode(*tnode_ptr)));
+    }
+    const TPlanNode& tnode = *tnode_ptr;
 
-    int num_children = tnodes[*node_idx].num_children;
+    int num_children = tnode.num_children;
     ExecNode* node = nullptr;
-    RETURN_IF_ERROR(create_vectorized_node(state, pool, tnodes[*node_idx], descs, &node));
+    RETURN_IF_ERROR(create_vectorized_node(state, pool, tnode, descs, &node));
 
     // assert(parent != NULL || (node_idx == 0 && root_expr != NULL));
     if (parent != nullptr) {
@@ -442,6 +449,9 @@ Status ExecNode::create_vectorized_node(starrocks::RuntimeState* state, starrock
     case TPlanNodeType::CROSS_JOIN_NODE:
         *node = pool->add(new vectorized::CrossJoinNode(pool, tnode, descs));
         return Status::OK();
+    case TPlanNodeType::MERGE_JOIN_NODE:
+        *node = pool->add(new vectorized::MergeJoinNode(pool, tnode, descs));
+        return Status::OK();
     case TPlanNodeType::UNION_NODE:
         *node = pool->add(new vectorized::UnionNode(pool, tnode, descs));
         return Status::OK();
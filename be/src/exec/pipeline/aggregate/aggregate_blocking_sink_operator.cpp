@@ -19,8 +19,13 @@ void AggregateBlockingSinkOperator::close(RuntimeState* state) {
 
 Status AggregateBlockingSinkOperator::set_finishing(RuntimeState* state) {
     _is_finished = true;
+    _aggregator->release_reserved_mem();
 
-    if (!_aggregator->is_none_group_by_exprs()) {
+    if (_aggregator->has_spilled()) {
+        // The spilled partitions are re-aggregated by AggregateBlockingSourceOperator one by one
+        RETURN_IF_ERROR(_aggregator->finish_spill());
+        _aggregator->set_ht_eos();
+    } else if (!_aggregator->is_none_group_by_exprs()) {
         COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
         // If hash map is empty, we don't need to return value
         if (_aggregator->hash_map_variant().size() == 0) {
@@ -62,6 +67,7 @@ Status AggregateBlockingSinkOperator::push_chunk(RuntimeState* state, const vect
              _aggregator->get_aggr_phase() == AggrPhase2); // phase 2, keep it to make things safe
     const auto chunk_size = chunk->num_rows();
     DCHECK_LE(chunk_size, state->chunk_size());
+    _aggregator->reserve_mem(*chunk, !agg_group_by_with_limit);
 
     SCOPED_TIMER(_aggregator->agg_compute_timer());
     if (!_aggregator->is_none_group_by_exprs()) {
@@ -98,6 +104,12 @@ Status AggregateBlockingSinkOperator::push_chunk(RuntimeState* state, const vect
     _aggregator->update_num_input_rows(chunk_size);
     RETURN_IF_ERROR(_aggregator->check_has_error());
 
+    // The states of group by with limit are needed to decide whether to filter keys, so never spill them
+    if (!agg_group_by_with_limit && _aggregator->should_spill()) {
+        RETURN_IF_ERROR(_aggregator->spill_hash_map());
+    }
+    _aggregator->update_reserved_mem();
+
     return Status::OK();
 }
 } // namespace starrocks::pipeline
@@ -7,11 +7,13 @@
 namespace starrocks::pipeline {
 
 bool AggregateBlockingSourceOperator::has_output() const {
-    return _aggregator->is_sink_complete() && !_aggregator->is_ht_eos();
+    return _aggregator->is_sink_complete() &&
+           (!_aggregator->is_ht_eos() || _aggregator->has_pending_spilled_partitions());
 }
 
 bool AggregateBlockingSourceOperator::is_finished() const {
-    return _aggregator->is_sink_complete() && _aggregator->is_ht_eos();
+    return _aggregator->is_sink_complete() && _aggregator->is_ht_eos() &&
+           !_aggregator->has_pending_spilled_partitions();
 }
 
 Status AggregateBlockingSourceOperator::set_finished(RuntimeState* state) {
@@ -29,16 +31,25 @@ StatusOr<vectorized::ChunkPtr> AggregateBlockingSourceOperator::pull_chunk(Runti
     int32_t chunk_size = state->chunk_size();
     vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
 
+    if (_aggregator->is_ht_eos() && _aggregator->has_pending_spilled_partitions()) {
+        RETURN_IF_ERROR(_aggregator->restore_next_spilled_partition());
+        if (_aggregator->is_ht_eos()) {
+            return chunk;
+        }
+    }
+
     if (_aggregator->is_none_group_by_exprs()) {
         SCOPED_TIMER(_aggregator->get_results_timer());
         _aggregator->convert_to_chunk_no_groupby(&chunk);
     } else {
         if (false) {
         }
-#define HASH_MAP_METHOD(NAME)                                                                                     \
-    else if (_aggregator->hash_map_variant().type == vectorized::HashMapVariant::Type::NAME)                      \
-            _aggregator->convert_hash_map_to_chunk<decltype(_aggregator->hash_map_variant().NAME)::element_type>( \
-                    *_aggregator->hash_map_variant().NAME, chunk_size, &chunk);
+#define HASH_MAP_METHOD(NAME)                                                                  \
+    else if (_aggregator->hash_map_variant().type == vectorized::HashMapVariant::Type::NAME) { \
+        RETURN_IF_ERROR(_aggregator->convert_hash_map_to_chunk_in_parallel<                    \
+                        decltype(_aggregator->hash_map_variant().NAME)::element_type>(         \
+                *_aggregator->hash_map_variant().NAME, chunk_size, &chunk));                   \
+    }
         APPLY_FOR_VARIANT_ALL(HASH_MAP_METHOD)
 #undef HASH_MAP_METHOD
     }
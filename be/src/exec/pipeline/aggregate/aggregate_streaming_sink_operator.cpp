@@ -126,11 +126,11 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const size_t chunk_si
             SCOPED_TIMER(_aggregator->agg_compute_timer());
             if (false) {
             }
-#define HASH_MAP_METHOD(NAME)                                                                  \
-    else if (_aggregator->hash_map_variant().type == vectorized::HashMapVariant::Type::NAME) { \
-        TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_selection<typename decltype(      \
-                                    _aggregator->hash_map_variant().NAME)::element_type>(      \
-                *_aggregator->hash_map_variant().NAME, chunk_size));                           \
+#define HASH_MAP_METHOD(NAME)                                                                         \
+    else if (_aggregator->hash_map_variant().type == vectorized::HashMapVariant::Type::NAME) {        \
+        TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_partitioned_selection<typename decltype( \
+                                    _aggregator->hash_map_variant().NAME)::element_type>(             \
+                *_aggregator->hash_map_variant().NAME, chunk_size));                                  \
     }
             APPLY_FOR_VARIANT_ALL(HASH_MAP_METHOD)
 #undef HASH_MAP_METHOD
@@ -165,6 +165,9 @@ Status AggregateStreamingSinkOperator::_push_chunk_by_auto(const size_t chunk_si
             }
         }
 
+        // the new keys of some partitions may be aggregated
+        _mem_tracker->set(_aggregator->hash_map_variant().memory_usage() +
+                          _aggregator->mem_pool()->total_reserved_bytes());
         COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
     }
 
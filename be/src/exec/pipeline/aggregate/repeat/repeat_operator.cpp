@@ -28,13 +28,38 @@ bool RepeatOperator::has_output() const {
 }
 
 StatusOr<vectorized::ChunkPtr> RepeatOperator::pull_chunk(RuntimeState* state) {
-    ChunkPtr curr_chunk = _curr_chunk->clone_empty(_curr_chunk->num_rows());
-    curr_chunk->append_safe(*_curr_chunk, 0, _curr_chunk->num_rows());
+    ChunkPtr curr_chunk = _build_repeat_chunk();
     extend_and_update_columns(&curr_chunk);
-    eval_conjuncts_and_in_filters(_conjunct_ctxs, curr_chunk.get());
+    RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, curr_chunk.get()));
     return curr_chunk;
 }
 
+ChunkPtr RepeatOperator::_build_repeat_chunk() {
+    // The output of each repeat only differs from the input chunk in the null columns and the grouping
+    // columns, which are all const columns. The other columns are shared with the input chunk rather than
+    // copied, since the aggregation consuming the output only reads them. They still have to be copied
+    // if the chunk is filtered in place by the conjuncts.
+    const bool need_copy = !_conjunct_ctxs.empty() || !runtime_in_filters().empty();
+    const std::vector<SlotId>& null_slot_ids = _null_slot_ids[_repeat_times_last];
+    const auto& slot_id_to_index = _curr_chunk->get_slot_id_to_index_map();
+    DCHECK_EQ(_curr_chunk->num_columns(), slot_id_to_index.size());
+
+    Columns columns = _curr_chunk->columns();
+    if (need_copy) {
+        std::vector<bool> is_null_column(columns.size(), false);
+        for (auto slot_id : null_slot_ids) {
+            is_null_column[slot_id_to_index.at(slot_id)] = true;
+        }
+        for (size_t i = 0; i < columns.size(); ++i) {
+            // The null columns are replaced later, there is no need to copy them.
+            if (!is_null_column[i]) {
+                columns[i] = columns[i]->clone_shared();
+            }
+        }
+    }
+    return std::make_shared<vectorized::Chunk>(std::move(columns), slot_id_to_index);
+}
+
 void RepeatOperator::extend_and_update_columns(ChunkPtr* curr_chunk) {
     // extend virtual columns for gourping_id and grouping()/grouping_id() columns.
     for (int i = 0; i < _grouping_list.size(); ++i) {
@@ -57,6 +57,8 @@ private:
         return ConstColumn::create(column, num_rows);
     }
 
+    // Builds the output chunk of the current repeat from _curr_chunk.
+    ChunkPtr _build_repeat_chunk();
     void extend_and_update_columns(vectorized::ChunkPtr* curr_chunk);
 
     /*
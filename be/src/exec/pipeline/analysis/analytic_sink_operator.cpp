@@ -190,10 +190,7 @@ void AnalyticSinkOperator::_process_by_partition_for_unbounded_preceding_rows_fr
 void AnalyticSinkOperator::_process_by_partition_for_sliding_frame(size_t chunk_size, bool is_new_partition) {
     while (_analytor->current_row_position() < _analytor->partition_end() &&
            _analytor->window_result_position() < chunk_size) {
-        _analytor->reset_window_state();
-        FrameRange range = _analytor->get_sliding_frame_range();
-        _analytor->update_window_batch(_analytor->partition_start(), _analytor->partition_end(), range.start,
-                                       range.end);
+        _analytor->update_window_batch_for_sliding_frame();
 
         _analytor->update_window_result_position(1);
         int64_t result_start = _analytor->get_total_position(_analytor->current_row_position()) -
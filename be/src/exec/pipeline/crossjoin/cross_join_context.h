@@ -8,13 +8,17 @@
 #include "column/chunk.h"
 #include "column/vectorized_fwd.h"
 #include "exec/pipeline/context_with_dependency.h"
+#include "exec/vectorized/cross_join_range_predicate.h"
 
 namespace starrocks::pipeline {
 
 class CrossJoinContext final : public ContextWithDependency {
 public:
-    explicit CrossJoinContext(const int32_t num_right_sinkers)
-            : _num_right_sinkers(num_right_sinkers), _build_chunks(num_right_sinkers) {}
+    explicit CrossJoinContext(const int32_t num_right_sinkers,
+                              std::shared_ptr<const vectorized::CrossJoinRangePredicate> range_predicate = nullptr)
+            : _num_right_sinkers(num_right_sinkers),
+              _build_chunks(num_right_sinkers),
+              _range_predicate(std::move(range_predicate)) {}
 
     void close(RuntimeState* state) override {}
 
@@ -27,6 +31,11 @@ public:
 
     vectorized::Chunk* get_build_chunk(int32_t build_id) const { return _build_chunks[build_id].get(); }
 
+    // Sorted by the range predicate, if any, before the right sinker is finished.
+    vectorized::ChunkPtr* mutable_build_chunk(int32_t build_id) { return &_build_chunks[build_id]; }
+
+    const vectorized::CrossJoinRangePredicate* range_predicate() const { return _range_predicate.get(); }
+
     void set_build_chunk(const int32_t sinker_id, const vectorized::ChunkPtr& build_chunk) {
         _build_chunks[sinker_id] = build_chunk;
     }
@@ -47,6 +56,9 @@ private:
 
     // _build_chunks[i] contains all the rows from i-th CrossJoinRightSinkOperator.
     std::vector<vectorized::ChunkPtr> _build_chunks;
+
+    // Not null if the build rows matching a probe row can be found by binary search on the sorted build chunks.
+    std::shared_ptr<const vectorized::CrossJoinRangePredicate> _range_predicate;
 };
 
 } // namespace starrocks::pipeline
@@ -2,6 +2,8 @@
 
 #include "exec/pipeline/crossjoin/cross_join_left_operator.h"
 
+#include <tuple>
+
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
 #include "exec/exec_node.h"
@@ -185,14 +187,44 @@ void CrossJoinLeftOperator::_select_build_chunk(const int32_t unprocessed_build_
         _beyond_threshold_build_rows_index = 0;
         _probe_chunk_index = 0;
         _probe_rows_index = 0;
+        _build_range_begin = 0;
+        _build_range_end = 0;
     }
 }
 
+StatusOr<vectorized::ChunkPtr> CrossJoinLeftOperator::_pull_chunk_by_range(RuntimeState* state) {
+    vectorized::ChunkPtr chunk = nullptr;
+    _init_chunk(&chunk, state);
+
+    const auto* range_predicate = _cross_join_context->range_predicate();
+    while (chunk->num_rows() < state->chunk_size() && !_is_curr_probe_chunk_finished()) {
+        if (_build_range_begin < _build_range_end) {
+            size_t row_count = std::min(state->chunk_size() - chunk->num_rows(), _build_range_end - _build_range_begin);
+            _copy_joined_rows_with_index_base_probe(chunk, row_count, _probe_chunk_index - 1, _build_range_begin);
+            _build_range_begin += row_count;
+        } else if (_probe_chunk_index < _probe_chunk->num_rows()) {
+            std::tie(_build_range_begin, _build_range_end) =
+                    range_predicate->build_range(*_probe_chunk, _probe_chunk_index, *_curr_build_chunk);
+            ++_probe_chunk_index;
+        } else {
+            // _probe_chunk is done with _curr_build_chunk.
+            _select_build_chunk(_curr_build_index + 1, state);
+        }
+    }
+
+    RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, chunk.get()));
+    return chunk;
+}
+
 /*
  * This algorithm is the same as that CrossJoinNode,
  * and pull_chunk, need_input, push_chunk is splited from CrossJoinNode's get_next.
  */
 StatusOr<vectorized::ChunkPtr> CrossJoinLeftOperator::pull_chunk(RuntimeState* state) {
+    if (_cross_join_context->range_predicate() != nullptr) {
+        return _pull_chunk_by_range(state);
+    }
+
     vectorized::ChunkPtr chunk = nullptr;
     // we need a valid probe chunk to initialize the new chunk.
     _init_chunk(&chunk, state);
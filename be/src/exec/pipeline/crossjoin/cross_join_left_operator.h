@@ -91,6 +91,9 @@ private:
 
     void _select_build_chunk(int32_t build_index, RuntimeState* state);
 
+    // Join each probe row only with the build rows located by the range predicate of _cross_join_context.
+    StatusOr<vectorized::ChunkPtr> _pull_chunk_by_range(RuntimeState* state);
+
     void _init_chunk(vectorized::ChunkPtr* chunk, RuntimeState* state);
 
     void _copy_joined_rows_with_index_base_build(vectorized::ChunkPtr& chunk, size_t row_count, size_t probe_index,
@@ -142,6 +145,11 @@ private:
     // And is used when _probe_chunk_index == _probe_chunk->num_rows().
     size_t _probe_rows_index = 0;
 
+    // Used by _pull_chunk_by_range, the remaining range of _curr_build_chunk joined with
+    // the (_probe_chunk_index - 1)-th row of _probe_chunk.
+    size_t _build_range_begin = 0;
+    size_t _build_range_end = 0;
+
     bool _is_finished = false;
 
     std::vector<uint32_t> _buf_selective;
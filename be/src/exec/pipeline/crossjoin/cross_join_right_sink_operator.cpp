@@ -5,6 +5,7 @@
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "runtime/current_thread.h"
+#include "runtime/runtime_state.h"
 
 using namespace starrocks::vectorized;
 
@@ -33,4 +34,16 @@ Status CrossJoinRightSinkOperator::push_chunk(RuntimeState* state, const vectori
     return Status::OK();
 }
 
+Status CrossJoinRightSinkOperator::set_finishing(RuntimeState* state) {
+    _is_finished = true;
+    const auto* range_predicate = _cross_join_context->range_predicate();
+    ChunkPtr* build_chunk = _cross_join_context->mutable_build_chunk(_driver_sequence);
+    if (range_predicate != nullptr && *build_chunk != nullptr) {
+        RETURN_IF_ERROR(range_predicate->sort_build_chunk(state->cancelled_ref(), build_chunk));
+    }
+    // Used to notify cross_join_left_operator.
+    _cross_join_context->finish_one_right_sinker();
+    return Status::OK();
+}
+
 } // namespace starrocks::pipeline
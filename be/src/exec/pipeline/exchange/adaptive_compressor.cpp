@@ -0,0 +1,150 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/exchange/adaptive_compressor.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "gutil/strings/substitute.h"
+#include "util/block_compression.h"
+#include "util/time.h"
+
+namespace starrocks::pipeline {
+
+// Switch to another codec only if its cost is lower than this ratio of the cost of the current codec,
+// to avoid switching back and forth on noisy samples.
+static constexpr double kSwitchCostRatio = 0.9;
+
+AdaptiveCompressor::AdaptiveCompressor(CompressionTypePB compress_type, bool adaptive)
+        : _adaptive(adaptive && compress_type != CompressionTypePB::NO_COMPRESSION) {
+    _stats.push_back({CompressionTypePB::NO_COMPRESSION, nullptr, true, 0, 1});
+    if (_adaptive) {
+        for (auto type : {CompressionTypePB::LZ4, CompressionTypePB::ZSTD}) {
+            _stats.push_back({type, nullptr, false, 0, 1});
+        }
+    }
+    if (compress_type != CompressionTypePB::NO_COMPRESSION) {
+        auto it = std::find_if(_stats.begin(), _stats.end(),
+                               [compress_type](const CodecStat& stat) { return stat.type == compress_type; });
+        if (it == _stats.end()) {
+            _stats.push_back({compress_type, nullptr, false, 0, 1});
+            it = _stats.end() - 1;
+        }
+        _current = it - _stats.begin();
+    }
+}
+
+Status AdaptiveCompressor::init() {
+    for (auto& stat : _stats) {
+        RETURN_IF_ERROR(get_block_compression_codec(stat.type, &stat.codec));
+    }
+    return Status::OK();
+}
+
+Status AdaptiveCompressor::_compress(size_t index, const Slice& input, raw::RawString* output,
+                                     size_t* compressed_size) {
+    const BlockCompressionCodec* codec = _stats[index].codec;
+    DCHECK(codec != nullptr);
+    if (codec->exceed_max_input_size(input.size)) {
+        return Status::InternalError(
+                strings::Substitute("The input size for compression should be less than $0", codec->max_input_size()));
+    }
+    size_t max_compressed_size = codec->max_compressed_len(input.size);
+    if (output->size() < max_compressed_size) {
+        output->resize(max_compressed_size);
+    }
+    Slice compressed_slice{output->data(), output->size()};
+    RETURN_IF_ERROR(codec->compress(input, &compressed_slice));
+    *compressed_size = compressed_slice.size;
+    return Status::OK();
+}
+
+Status AdaptiveCompressor::_sample(const Slice& input, const std::function<double()>& network_ns_per_byte,
+                                   raw::RawString* output, size_t* compressed_size) {
+    // Sample the current codec last, so its output is kept in |output| if it's still the cheapest.
+    std::vector<size_t> indexes;
+    for (size_t i = 1; i < _stats.size(); i++) {
+        if (i != _current) {
+            indexes.push_back(i);
+        }
+    }
+    if (_current != 0) {
+        indexes.push_back(_current);
+    }
+
+    size_t last_index = 0;
+    for (size_t index : indexes) {
+        int64_t start = MonotonicNanos();
+        RETURN_IF_ERROR(_compress(index, input, output, compressed_size));
+        double ns_per_byte = static_cast<double>(MonotonicNanos() - start) / input.size;
+        double ratio = static_cast<double>(*compressed_size) / input.size;
+
+        auto& stat = _stats[index];
+        if (stat.sampled) {
+            stat.compress_ns_per_byte = (stat.compress_ns_per_byte + ns_per_byte) / 2;
+            stat.ratio = (stat.ratio + ratio) / 2;
+        } else {
+            stat.compress_ns_per_byte = ns_per_byte;
+            stat.ratio = ratio;
+            stat.sampled = true;
+        }
+        last_index = index;
+    }
+
+    _pick(network_ns_per_byte());
+    if (_current != 0 && _current != last_index) {
+        RETURN_IF_ERROR(_compress(_current, input, output, compressed_size));
+    }
+    return Status::OK();
+}
+
+void AdaptiveCompressor::_pick(double network_ns_per_byte) {
+    if (network_ns_per_byte < 0) {
+        return;
+    }
+    auto cost = [network_ns_per_byte](const CodecStat& stat) {
+        return stat.compress_ns_per_byte + stat.ratio * network_ns_per_byte;
+    };
+    size_t best = _current;
+    double best_cost = cost(_stats[_current]) * kSwitchCostRatio;
+    for (size_t i = 0; i < _stats.size(); i++) {
+        if (_stats[i].sampled && cost(_stats[i]) < best_cost) {
+            best = i;
+            best_cost = cost(_stats[i]);
+        }
+    }
+    if (best != _current) {
+        VLOG_ROW << "switch exchange compression from " << CompressionTypePB_Name(_stats[_current].type) << " to "
+                 << CompressionTypePB_Name(_stats[best].type) << ", network ns per byte: " << network_ns_per_byte;
+        _current = best;
+        _num_switches++;
+    }
+}
+
+Status AdaptiveCompressor::compress(const Slice& input, const std::function<double()>& network_ns_per_byte,
+                                    raw::RawString* output, CompressionTypePB* type) {
+    *type = CompressionTypePB::NO_COMPRESSION;
+    if (input.size == 0) {
+        return Status::OK();
+    }
+
+    size_t compressed_size = 0;
+    const int32_t sample_interval = std::max(1, config::adaptive_exchange_compression_sample_interval);
+    if (_adaptive && _num_chunks++ % sample_interval == 0) {
+        RETURN_IF_ERROR(_sample(input, network_ns_per_byte, output, &compressed_size));
+    } else if (_current != 0) {
+        RETURN_IF_ERROR(_compress(_current, input, output, &compressed_size));
+    }
+    if (_current == 0) {
+        return Status::OK();
+    }
+
+    double compress_ratio = static_cast<double>(input.size) / compressed_size;
+    if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
+        output->resize(compressed_size);
+        *type = _stats[_current].type;
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks::pipeline
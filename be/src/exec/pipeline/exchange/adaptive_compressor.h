@@ -0,0 +1,68 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "common/status.h"
+#include "gen_cpp/types.pb.h"
+#include "util/raw_container.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+class BlockCompressionCodec;
+
+namespace pipeline {
+
+// AdaptiveCompressor compresses the serialized chunks sent to one destination. If it's adaptive, it samples the
+// compression ratio and the compression time of every candidate codec periodically, and picks the codec with the
+// lowest estimated cost per uncompressed byte:
+//   cost = compress_ns_per_byte + compressed_size / uncompressed_size * network_ns_per_byte
+// where no compression costs network_ns_per_byte. So the fast links tend to send uncompressed data, while the slow
+// links tend to pay more CPU for zstd. The decompression cost at the receiver isn't taken into account.
+class AdaptiveCompressor {
+public:
+    // |compress_type| is used until the network cost is measured. If |compress_type| is NO_COMPRESSION,
+    // the data is never compressed even if |adaptive| is true.
+    AdaptiveCompressor(CompressionTypePB compress_type, bool adaptive);
+
+    Status init();
+
+    CompressionTypePB compress_type() const { return _stats[_current].type; }
+    int64_t num_switches() const { return _num_switches; }
+
+    // Compress |input| into |output|. |*type| is set to NO_COMPRESSION if |input| isn't compressed,
+    // and |output| should be ignored.
+    // |network_ns_per_byte| returns the measured network time to send one byte, or a negative value if
+    // it isn't measured yet. It's only called when the codec is re-picked.
+    Status compress(const Slice& input, const std::function<double()>& network_ns_per_byte, raw::RawString* output,
+                    CompressionTypePB* type);
+
+private:
+    struct CodecStat {
+        CompressionTypePB type;
+        const BlockCompressionCodec* codec;
+        bool sampled;
+        double compress_ns_per_byte;
+        // compressed size / uncompressed size.
+        double ratio;
+    };
+
+    Status _compress(size_t index, const Slice& input, raw::RawString* output, size_t* compressed_size);
+    // Compress |input| with every codec, and re-pick the codec. |output| holds the output of the picked codec.
+    Status _sample(const Slice& input, const std::function<double()>& network_ns_per_byte, raw::RawString* output,
+                   size_t* compressed_size);
+    void _pick(double network_ns_per_byte);
+
+    const bool _adaptive;
+    // The first one is always NO_COMPRESSION.
+    std::vector<CodecStat> _stats;
+    size_t _current = 0;
+    int64_t _num_chunks = 0;
+    int64_t _num_switches = 0;
+};
+
+} // namespace pipeline
+} // namespace starrocks
@@ -56,6 +56,10 @@ public:
     // be set to true.
     Status send_one_chunk(const vectorized::Chunk* chunk, int32_t driver_sequence, bool eos, bool* is_real_sent);
 
+    // Send the chunk owned by this channel, which is handed to the receiver without copying if
+    // the receiver is in the same process.
+    Status send_one_chunk(vectorized::ChunkUniquePtr chunk, int32_t driver_sequence);
+
     // Channel will sent input request directly without batch it.
     // This function is only used when broadcast, because request can be reused
     // by all the channels.
@@ -83,8 +87,13 @@ public:
 
     bool use_pass_through() const { return _use_pass_through; }
 
+    double network_ns_per_byte() const { return _parent->_buffer->network_ns_per_byte(_fragment_instance_id); }
+
 private:
     Status _close_internal(RuntimeState* state, FragmentContext* fragment_ctx);
+    // Append the chunk to _chunk_request, and send the request if it's large enough or eos is true.
+    Status _send_one_chunk(const vectorized::Chunk* chunk, vectorized::ChunkUniquePtr owned_chunk,
+                           int32_t driver_sequence, bool eos, bool* is_real_sent);
 
     bool _check_use_pass_through();
     void _prepare_pass_through();
@@ -100,6 +109,7 @@ private:
 
     bool _is_first_chunk = true;
     doris::PBackendService_Stub* _brpc_stub = nullptr;
+    std::unique_ptr<AdaptiveCompressor> _compressor;
 
     // If pipeline level shuffle is enable, the size of the _chunks
     // equals with dop of dest pipeline
@@ -107,6 +117,8 @@ private:
     // always be 1
     std::vector<std::unique_ptr<vectorized::Chunk>> _chunks;
     PTransmitChunkParamsPtr _chunk_request;
+    // The data of the chunks in _chunk_request.
+    butil::IOBuf _attachment;
     size_t _current_request_bytes = 0;
 
     bool _is_inited = false;
@@ -142,13 +154,17 @@ Status ExchangeSinkOperator::Channel::init(RuntimeState* state) {
         return Status::InternalError("no brpc destination");
     }
 
+    _compressor = std::make_unique<AdaptiveCompressor>(_parent->_compress_type,
+                                                       config::enable_adaptive_exchange_compression);
+    RETURN_IF_ERROR(_compressor->init());
+
     // _brpc_timeout_ms = std::min(3600, state->query_options().query_timeout) * 1000;
     // For bucket shuffle, the dest is unreachable, there is no need to establish a connection
     if (_fragment_instance_id.lo == -1) {
         _is_inited = true;
         return Status::OK();
     }
-    _brpc_stub = state->exec_env()->brpc_stub_cache()->get_stub(_brpc_dest_addr);
+    _brpc_stub = state->exec_env()->brpc_stub_cache()->get_stub(_brpc_dest_addr, _fragment_instance_id.lo);
     _prepare_pass_through();
 
     _is_inited = true;
@@ -163,9 +179,15 @@ Status ExchangeSinkOperator::Channel::add_rows_selective(vectorized::Chunk* chun
     }
 
     if (_chunks[driver_sequence]->num_rows() + size > state->chunk_size()) {
-        RETURN_IF_ERROR(send_one_chunk(_chunks[driver_sequence].get(), driver_sequence, false));
-        // we only clear column data, because we need to reuse column schema
-        _chunks[driver_sequence]->set_num_rows(0);
+        if (_use_pass_through) {
+            auto full_chunk = std::move(_chunks[driver_sequence]);
+            _chunks[driver_sequence] = full_chunk->clone_empty_with_slot(state->chunk_size());
+            RETURN_IF_ERROR(send_one_chunk(std::move(full_chunk), driver_sequence));
+        } else {
+            RETURN_IF_ERROR(send_one_chunk(_chunks[driver_sequence].get(), driver_sequence, false));
+            // we only clear column data, because we need to reuse column schema
+            _chunks[driver_sequence]->set_num_rows(0);
+        }
     }
 
     _chunks[driver_sequence]->append_selective(*chunk, indexes, from, size);
@@ -180,6 +202,18 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(const vectorized::Chunk* ch
 
 Status ExchangeSinkOperator::Channel::send_one_chunk(const vectorized::Chunk* chunk, int32_t driver_sequence, bool eos,
                                                      bool* is_real_sent) {
+    return _send_one_chunk(chunk, nullptr, driver_sequence, eos, is_real_sent);
+}
+
+Status ExchangeSinkOperator::Channel::send_one_chunk(vectorized::ChunkUniquePtr chunk, int32_t driver_sequence) {
+    bool is_real_sent = false;
+    const vectorized::Chunk* chunk_ptr = chunk.get();
+    return _send_one_chunk(chunk_ptr, std::move(chunk), driver_sequence, false, &is_real_sent);
+}
+
+Status ExchangeSinkOperator::Channel::_send_one_chunk(const vectorized::Chunk* chunk,
+                                                      vectorized::ChunkUniquePtr owned_chunk, int32_t driver_sequence,
+                                                      bool eos, bool* is_real_sent) {
     *is_real_sent = false;
     if (_chunk_request == nullptr) {
         _chunk_request = std::make_shared<PTransmitChunkParams>();
@@ -196,8 +230,14 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(const vectorized::Chunk* ch
         if (_use_pass_through) {
             size_t chunk_size = serde::ProtobufChunkSerde::max_serialized_size(*chunk);
             // -1 means disable pipeline level shuffle
-            _pass_through_context.append_chunk(_parent->_sender_id, chunk, chunk_size,
-                                               _parent->_is_pipeline_level_shuffle ? driver_sequence : -1);
+            int32_t pass_through_driver_sequence = _parent->_is_pipeline_level_shuffle ? driver_sequence : -1;
+            if (owned_chunk != nullptr) {
+                _pass_through_context.append_chunk(_parent->_sender_id, std::move(owned_chunk), chunk_size,
+                                                   pass_through_driver_sequence);
+            } else {
+                _pass_through_context.append_chunk(_parent->_sender_id, chunk, chunk_size,
+                                                   pass_through_driver_sequence);
+            }
             _current_request_bytes += chunk_size;
             COUNTER_UPDATE(_parent->_bytes_pass_through_counter, chunk_size);
         } else {
@@ -205,8 +245,9 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(const vectorized::Chunk* ch
                 _chunk_request->add_driver_sequences(driver_sequence);
             }
             auto pchunk = _chunk_request->add_chunks();
-            RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_is_first_chunk));
-            _current_request_bytes += pchunk->data().size();
+            RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_attachment, &_is_first_chunk,
+                                                     _compressor.get(), [this]() { return network_ns_per_byte(); }));
+            _current_request_bytes += pchunk->data_size();
         }
     }
 
@@ -215,10 +256,9 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(const vectorized::Chunk* ch
     if (_current_request_bytes > _parent->_request_bytes_threshold || eos) {
         _chunk_request->set_eos(eos);
         _chunk_request->set_use_pass_through(_use_pass_through);
-        butil::IOBuf attachment;
-        _parent->construct_brpc_attachment(_chunk_request, attachment);
-        TransmitChunkInfo info = {this->_fragment_instance_id, _brpc_stub, std::move(_chunk_request), attachment};
+        TransmitChunkInfo info = {this->_fragment_instance_id, _brpc_stub, std::move(_chunk_request), _attachment};
         _parent->_buffer->add_request(info);
+        _attachment.clear();
         _current_request_bytes = 0;
         _chunk_request.reset();
         *is_real_sent = true;
@@ -249,7 +289,12 @@ Status ExchangeSinkOperator::Channel::_close_internal(RuntimeState* state, Fragm
 
     if (!fragment_ctx->is_canceled()) {
         for (auto driver_sequence = 0; driver_sequence < _chunks.size(); ++driver_sequence) {
-            if (_chunks[driver_sequence] != nullptr) {
+            if (_chunks[driver_sequence] == nullptr) {
+                continue;
+            }
+            if (_use_pass_through) {
+                RETURN_IF_ERROR(send_one_chunk(std::move(_chunks[driver_sequence]), driver_sequence));
+            } else {
                 RETURN_IF_ERROR(send_one_chunk(_chunks[driver_sequence].get(), driver_sequence, false));
             }
         }
@@ -290,6 +335,12 @@ ExchangeSinkOperator::ExchangeSinkOperator(OperatorFactory* factory, int32_t id,
     // fragment_instance_id.lo == -1 indicates that the destination is pseudo for bucket shuffle join.
     std::optional<std::shared_ptr<Channel>> pseudo_channel;
 
+    // The shuffled chunks are always handed to the receivers in the same process directly if it's enabled by BE.
+    if (config::enable_shuffle_pass_through && (part_type == TPartitionType::HASH_PARTITIONED ||
+                                                 part_type == TPartitionType::BUCKET_SHUFFLE_HASH_PARTITIONED)) {
+        enable_exchange_pass_through = true;
+    }
+
     for (const auto& destination : destinations) {
         const auto& fragment_instance_id = destination.fragment_instance_id;
         if (fragment_instance_id.lo == -1 && pseudo_channel.has_value()) {
@@ -317,7 +368,8 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
         // compress transmitted data.
         _compress_type = CompressionTypePB::LZ4;
     }
-    RETURN_IF_ERROR(get_block_compression_codec(_compress_type, &_compress_codec));
+    _compressor = std::make_unique<AdaptiveCompressor>(_compress_type, config::enable_adaptive_exchange_compression);
+    RETURN_IF_ERROR(_compressor->init());
 
     std::string instances;
     for (const auto& channel : _channels) {
@@ -335,6 +387,12 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     if (_part_type == TPartitionType::HASH_PARTITIONED ||
         _part_type == TPartitionType::BUCKET_SHUFFLE_HASH_PARTITIONED) {
         _partitions_columns.resize(_partition_expr_ctxs.size());
+        if (config::exchange_skew_detection_sample_stride > 0) {
+            _skew_detector =
+                    std::make_unique<SkewDetector>(_channels.size(), config::exchange_skew_detection_sample_stride);
+            _hot_keys_counter = ADD_COUNTER(_unique_metrics, "HotKeys", TUnit::UNIT);
+            _hot_key_rows_counter = ADD_COUNTER(_unique_metrics, "HotKeyRows", TUnit::UNIT);
+        }
     }
 
     // Randomize the order we open/transmit to channels to avoid thundering herd problems.
@@ -348,6 +406,8 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     _serialize_chunk_timer = ADD_TIMER(_unique_metrics, "SerializeChunkTime");
     _shuffle_hash_timer = ADD_TIMER(_unique_metrics, "ShuffleHashTime");
     _compress_timer = ADD_TIMER(_unique_metrics, "CompressTime");
+    _compressed_chunks_counter = ADD_COUNTER(_unique_metrics, "CompressedChunks", TUnit::UNIT);
+    _compression_switches_counter = ADD_COUNTER(_unique_metrics, "CompressionSwitches", TUnit::UNIT);
 
     for (auto& _channel : _channels) {
         RETURN_IF_ERROR(_channel->init(state));
@@ -418,18 +478,33 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const vectorized::C
             // 1. create a new chunk PB to serialize
             ChunkPB* pchunk = _chunk_request->add_chunks();
             // 2. serialize input chunk to pchunk
-            RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_is_first_chunk, _channels.size()));
-            _current_request_bytes += pchunk->data().size();
+            // The chunk is compressed once and sent through all the links, so the network costs are added up.
+            auto network_ns_per_byte = [this]() {
+                double total = -1;
+                for (const auto& channel : _channels) {
+                    if (channel->use_pass_through()) {
+                        continue;
+                    }
+                    double ns_per_byte = channel->network_ns_per_byte();
+                    if (ns_per_byte >= 0) {
+                        total = std::max<double>(total, 0) + ns_per_byte;
+                    }
+                }
+                return total;
+            };
+            RETURN_IF_ERROR(serialize_chunk(send_chunk, pchunk, &_attachment, &_is_first_chunk, _compressor.get(),
+                                            network_ns_per_byte, _channels.size()));
+            _current_request_bytes += pchunk->data_size();
             // 3. if request bytes exceede the threshold, send current request
             if (_current_request_bytes > _request_bytes_threshold) {
-                butil::IOBuf attachment;
-                construct_brpc_attachment(_chunk_request, attachment);
+                // The attachment shares the data blocks among the channels.
                 for (auto idx : _channel_indices) {
                     if (!_channels[idx]->use_pass_through()) {
                         PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
-                        RETURN_IF_ERROR(_channels[idx]->send_chunk_request(copy, attachment));
+                        RETURN_IF_ERROR(_channels[idx]->send_chunk_request(copy, _attachment));
                     }
                 }
+                _attachment.clear();
                 _current_request_bytes = 0;
                 _chunk_request.reset();
             }
@@ -470,6 +545,10 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const vectorized::C
                 }
             }
 
+            if (_skew_detector != nullptr) {
+                _skew_detector->update(_hash_values.data(), num_rows);
+            }
+
             // Compute row indexes for each channel's each shuffle
             _channel_row_idx_start_points.assign(num_channels * _num_shuffles + 1, 0);
 
@@ -520,12 +599,11 @@ Status ExchangeSinkOperator::set_finishing(RuntimeState* state) {
     _is_finished = true;
 
     if (_chunk_request != nullptr) {
-        butil::IOBuf attachment;
-        construct_brpc_attachment(_chunk_request, attachment);
         for (const auto& channel : _channels) {
             PTransmitChunkParamsPtr copy = std::make_shared<PTransmitChunkParams>(*_chunk_request);
-            channel->send_chunk_request(copy, attachment);
+            channel->send_chunk_request(copy, _attachment);
         }
+        _attachment.clear();
         _current_request_bytes = 0;
         _chunk_request.reset();
     }
@@ -534,6 +612,17 @@ Status ExchangeSinkOperator::set_finishing(RuntimeState* state) {
         _channel->close(state, _fragment_ctx);
     }
 
+    if (_skew_detector != nullptr) {
+        auto hot_keys = _skew_detector->hot_keys();
+        COUNTER_SET(_hot_keys_counter, static_cast<int64_t>(hot_keys.size()));
+        COUNTER_SET(_hot_key_rows_counter, _skew_detector->estimated_hot_rows());
+        if (!hot_keys.empty()) {
+            VLOG_QUERY << "exchange sink to node " << _dest_node_id << " found " << hot_keys.size()
+                       << " hot keys among " << _channels.size() << " receivers, estimated hot rows "
+                       << _skew_detector->estimated_hot_rows();
+        }
+    }
+
     _buffer->set_finishing();
     return Status::OK();
 }
@@ -543,70 +632,59 @@ void ExchangeSinkOperator::close(RuntimeState* state) {
     Operator::close(state);
 }
 
-Status ExchangeSinkOperator::serialize_chunk(const vectorized::Chunk* src, ChunkPB* dst, bool* is_first_chunk,
-                                             int num_receivers) {
+Status ExchangeSinkOperator::serialize_chunk(const vectorized::Chunk* src, ChunkPB* dst, butil::IOBuf* attachment,
+                                             bool* is_first_chunk, AdaptiveCompressor* compressor,
+                                             const std::function<double()>& network_ns_per_byte, int num_receivers) {
     VLOG_ROW << "[ExchangeSinkOperator] serializing " << src->num_rows() << " rows";
+    const size_t uncompressed_size = serde::ProtobufChunkSerde::max_serialized_size(*src);
+    // The buffer is owned by the attachment once it's appended, and freed after the rpc is done.
+    auto* buff = static_cast<uint8_t*>(malloc(uncompressed_size));
+    if (UNLIKELY(buff == nullptr)) {
+        return Status::MemoryAllocFailed(strings::Substitute("alloc $0 bytes to serialize chunk", uncompressed_size));
+    }
+    DeferOp free_buff([&buff]() { free(buff); });
     {
         SCOPED_TIMER(_serialize_chunk_timer);
         // We only serialize chunk meta for first chunk
         if (*is_first_chunk) {
-            StatusOr<ChunkPB> res = serde::ProtobufChunkSerde::serialize(*src);
-            RETURN_IF_ERROR(res);
-            res->Swap(dst);
+            serde::ProtobufChunkSerde::serialize_meta(*src, dst);
             *is_first_chunk = false;
-        } else {
-            StatusOr<ChunkPB> res = serde::ProtobufChunkSerde::serialize_without_meta(*src);
-            RETURN_IF_ERROR(res);
-            res->Swap(dst);
         }
-    }
-    DCHECK(dst->has_uncompressed_size());
-    DCHECK_EQ(dst->uncompressed_size(), dst->data().size());
-    const size_t uncompressed_size = dst->uncompressed_size();
-
-    if (_compress_codec != nullptr && _compress_codec->exceed_max_input_size(uncompressed_size)) {
-        return Status::InternalError(strings::Substitute("The input size for compression should be less than $0",
-                                                         _compress_codec->max_input_size()));
+        uint8_t* end = serde::ProtobufChunkSerde::serialize_data(*src, buff);
+        if (UNLIKELY(end == nullptr)) {
+            return Status::InternalError("has unsupported column");
+        }
+        dst->set_serialized_size(end - buff);
+        dst->set_uncompressed_size(uncompressed_size);
     }
 
-    // try compress the ChunkPB data
-    if (_compress_codec != nullptr && uncompressed_size > 0) {
+    // try compress the chunk data
+    CompressionTypePB compress_type = CompressionTypePB::NO_COMPRESSION;
+    {
         SCOPED_TIMER(_compress_timer);
-
-        // Try compressing data to _compression_scratch, swap if compressed data is smaller
-        int max_compressed_size = _compress_codec->max_compressed_len(uncompressed_size);
-
-        if (_compression_scratch.size() < max_compressed_size) {
-            _compression_scratch.resize(max_compressed_size);
-        }
-
-        Slice compressed_slice{_compression_scratch.data(), _compression_scratch.size()};
-        _compress_codec->compress(dst->data(), &compressed_slice);
-        double compress_ratio = (static_cast<double>(uncompressed_size)) / compressed_slice.size;
-        if (LIKELY(compress_ratio > config::rpc_compress_ratio_threshold)) {
-            _compression_scratch.resize(compressed_slice.size);
-            dst->mutable_data()->swap(reinterpret_cast<std::string&>(_compression_scratch));
-            dst->set_compress_type(_compress_type);
-        }
-
-        VLOG_ROW << "uncompressed size: " << uncompressed_size << ", compressed size: " << compressed_slice.size;
+        const int64_t num_switches = compressor->num_switches();
+        RETURN_IF_ERROR(compressor->compress(Slice(buff, uncompressed_size), network_ns_per_byte,
+                                             &_compression_scratch, &compress_type));
+        COUNTER_UPDATE(_compression_switches_counter, compressor->num_switches() - num_switches);
+    }
+    dst->set_compress_type(compress_type);
+    if (compress_type != CompressionTypePB::NO_COMPRESSION) {
+        COUNTER_UPDATE(_compressed_chunks_counter, 1);
+        attachment->append(_compression_scratch.data(), _compression_scratch.size());
+        dst->set_data_size(_compression_scratch.size());
+    } else if (attachment->append_user_data(buff, uncompressed_size, free) == 0) {
+        buff = nullptr;
+        dst->set_data_size(uncompressed_size);
+    } else {
+        attachment->append(buff, uncompressed_size);
+        dst->set_data_size(uncompressed_size);
     }
-    size_t chunk_size = dst->data().size();
-    VLOG_ROW << "chunk data size " << chunk_size;
+    VLOG_ROW << "uncompressed size: " << uncompressed_size << ", chunk data size " << dst->data_size();
 
     COUNTER_UPDATE(_uncompressed_bytes_counter, uncompressed_size * num_receivers);
     return Status::OK();
 }
 
-void ExchangeSinkOperator::construct_brpc_attachment(PTransmitChunkParamsPtr chunk_request, butil::IOBuf& attachment) {
-    for (int i = 0; i < chunk_request->chunks().size(); ++i) {
-        auto chunk = chunk_request->mutable_chunks(i);
-        chunk->set_data_size(chunk->data().size());
-        attachment.append(chunk->data());
-        chunk->clear_data();
-    }
-}
-
 ExchangeSinkOperatorFactory::ExchangeSinkOperatorFactory(
         int32_t id, int32_t plan_node_id, std::shared_ptr<SinkBuffer> buffer, TPartitionType::type part_type,
         const std::vector<TPlanFragmentDestination>& destinations, bool is_pipeline_level_shuffle, int32_t num_shuffles,
@@ -9,6 +9,8 @@
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "exec/data_sink.h"
+#include "exec/pipeline/exchange/adaptive_compressor.h"
+#include "exec/pipeline/exchange/skew_detector.h"
 #include "exec/pipeline/exchange/sink_buffer.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/operator.h"
@@ -23,7 +25,6 @@ class IOBuf;
 
 namespace starrocks {
 
-class BlockCompressionCodec;
 class ExprContext;
 
 namespace pipeline {
@@ -59,11 +60,13 @@ public:
 
     Status push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) override;
 
-    // For the first chunk , serialize the chunk data and meta to ChunkPB both.
-    // For other chunk, only serialize the chunk data to ChunkPB.
-    Status serialize_chunk(const vectorized::Chunk* chunk, ChunkPB* dst, bool* is_first_chunk, int num_receivers = 1);
-
-    void construct_brpc_attachment(PTransmitChunkParamsPtr _chunk_request, butil::IOBuf& attachment);
+    // For the first chunk , serialize the chunk meta to ChunkPB.
+    // The chunk data is appended to |attachment| rather than ChunkPB::data, and ChunkPB::data_size is set.
+    // The uncompressed data is handed over to |attachment| without copying.
+    // The data is compressed by |compressor|, and |network_ns_per_byte| is the network cost passed to it.
+    Status serialize_chunk(const vectorized::Chunk* chunk, ChunkPB* dst, butil::IOBuf* attachment,
+                           bool* is_first_chunk, AdaptiveCompressor* compressor,
+                           const std::function<double()>& network_ns_per_byte, int num_receivers = 1);
 
 private:
     class Channel;
@@ -101,25 +104,30 @@ private:
 
     // Only used when broadcast
     PTransmitChunkParamsPtr _chunk_request;
+    butil::IOBuf _attachment;
     size_t _current_request_bytes = 0;
     size_t _request_bytes_threshold = config::max_transmit_batched_bytes;
 
     bool _is_first_chunk = true;
 
-    // String to write compressed chunk data in serialize().
-    // This is a string so we can swap() with the string in the ChunkPB we're serializing
-    // to (we don't compress directly into the ChunkPB in case the compressed data is
-    // longer than the uncompressed data).
+    // String to write compressed chunk data in serialize_chunk(), which is copied to the attachment
+    // if the compressed data is small enough.
     raw::RawString _compression_scratch;
 
+    // The compression type of the query, which each channel starts with.
     CompressionTypePB _compress_type = CompressionTypePB::NO_COMPRESSION;
-    const BlockCompressionCodec* _compress_codec = nullptr;
+    // Only used when broadcast, the other partition types compress by the compressor of each channel.
+    std::unique_ptr<AdaptiveCompressor> _compressor;
 
     RuntimeProfile::Counter* _serialize_chunk_timer = nullptr;
     RuntimeProfile::Counter* _shuffle_hash_timer = nullptr;
     RuntimeProfile::Counter* _compress_timer = nullptr;
     RuntimeProfile::Counter* _bytes_pass_through_counter = nullptr;
     RuntimeProfile::Counter* _uncompressed_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _compressed_chunks_counter = nullptr;
+    RuntimeProfile::Counter* _compression_switches_counter = nullptr;
+    RuntimeProfile::Counter* _hot_keys_counter = nullptr;
+    RuntimeProfile::Counter* _hot_key_rows_counter = nullptr;
 
     std::atomic<bool> _is_finished = false;
     std::atomic<bool> _is_cancelled = false;
@@ -140,6 +148,8 @@ private:
     // channel 0's row first, then channel 1's row indexes, then put channel 2's row indexes in
     // the last.
     std::vector<uint32_t> _row_indexes;
+    // Only used for shuffle, nullptr if the skew detection is disabled.
+    std::unique_ptr<SkewDetector> _skew_detector;
 
     FragmentContext* const _fragment_ctx;
 
@@ -3,6 +3,7 @@
 #include "exec/pipeline/exchange/local_exchange_source_operator.h"
 
 #include "column/chunk.h"
+#include "exec/pipeline/fragment_context.h"
 #include "runtime/runtime_state.h"
 
 namespace starrocks::pipeline {
@@ -16,6 +17,7 @@ Status LocalExchangeSourceOperator::add_chunk(vectorized::ChunkPtr chunk) {
     }
     _memory_manager->update_row_count(chunk->num_rows());
     _full_chunk_queue.emplace(std::move(chunk));
+    _notify_blocked_drivers();
 
     return Status::OK();
 }
@@ -32,6 +34,9 @@ Status LocalExchangeSourceOperator::add_chunk(vectorized::ChunkPtr chunk,
     _memory_manager->update_row_count(size);
     _partition_chunk_queue.emplace(std::move(chunk), std::move(indexes), from, size);
     _partition_rows_num += size;
+    if (_partition_rows_num >= _factory->runtime_state()->chunk_size()) {
+        _notify_blocked_drivers();
+    }
 
     return Status::OK();
 }
@@ -66,6 +71,7 @@ Status LocalExchangeSourceOperator::set_finished(RuntimeState* state) {
     // Subtract the number of rows of buffered chunks from row_count of _memory_manager and make it unblocked.
     _memory_manager->update_row_count(-(full_rows_num + _partition_rows_num));
     _partition_rows_num = 0;
+    _notify_blocked_drivers();
     return Status::OK();
 }
 
@@ -75,9 +81,17 @@ StatusOr<vectorized::ChunkPtr> LocalExchangeSourceOperator::pull_chunk(RuntimeSt
         chunk = _pull_shuffle_chunk(state);
     }
     _memory_manager->update_row_count(-(static_cast<int32_t>(chunk->num_rows())));
+    // The sinkers blocked by the full memory manager may be unblocked.
+    _notify_blocked_drivers();
     return std::move(chunk);
 }
 
+void LocalExchangeSourceOperator::_notify_blocked_drivers() {
+    if (auto* fragment_ctx = _factory->runtime_state()->fragment_ctx(); fragment_ctx != nullptr) {
+        fragment_ctx->notify_blocked_drivers();
+    }
+}
+
 vectorized::ChunkPtr LocalExchangeSourceOperator::_pull_passthrough_chunk(RuntimeState* state) {
     std::lock_guard<std::mutex> l(_chunk_lock);
 
@@ -43,8 +43,11 @@ public:
 
     Status set_finished(RuntimeState* state) override;
     Status set_finishing(RuntimeState* state) override {
-        std::lock_guard<std::mutex> l(_chunk_lock);
-        _is_finished = true;
+        {
+            std::lock_guard<std::mutex> l(_chunk_lock);
+            _is_finished = true;
+        }
+        _notify_blocked_drivers();
         return Status::OK();
     }
 
@@ -55,6 +58,9 @@ private:
 
     vectorized::ChunkPtr _pull_shuffle_chunk(RuntimeState* state);
 
+    // Wake up the drivers of the local exchange sinks and sources of the same fragment.
+    void _notify_blocked_drivers();
+
     bool _is_finished = false;
     std::queue<vectorized::ChunkPtr> _full_chunk_queue;
     std::queue<PartitionChunk> _partition_chunk_queue;
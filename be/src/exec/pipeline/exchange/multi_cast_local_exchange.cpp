@@ -2,6 +2,8 @@
 
 #include "exec/pipeline/exchange/multi_cast_local_exchange.h"
 
+#include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/query_context.h"
 #include "util/logging.h"
 
 namespace starrocks {
@@ -26,6 +28,8 @@ MultiCastLocalExchanger::MultiCastLocalExchanger(RuntimeState* runtime_state, si
     _runtime_profile = std::make_unique<RuntimeProfile>("MultiCastLocalExchanger");
     _peak_memory_usage_counter = _runtime_profile->AddHighWaterMarkCounter("PeakMemoryUsage", TUnit::BYTES);
     _peak_buffer_row_size_counter = _runtime_profile->AddHighWaterMarkCounter("PeakBufferRowSize", TUnit::UNIT);
+    _spilled_chunks_counter = ADD_COUNTER(_runtime_profile, "SpilledChunks", TUnit::UNIT);
+    _spilled_bytes_counter = ADD_COUNTER(_runtime_profile, "SpilledBytes", TUnit::BYTES);
 }
 
 MultiCastLocalExchanger::~MultiCastLocalExchanger() {
@@ -59,6 +63,9 @@ Status MultiCastLocalExchanger::push_chunk(const vectorized::ChunkPtr& chunk, in
     {
         std::unique_lock l(_mutex);
 
+        if (_chunk_prototype == nullptr) {
+            _chunk_prototype = chunk->clone_empty_with_tuple(0);
+        }
         int32_t closed_source_number = (_consumer_number - _opened_source_number);
 
         cell->used_count = closed_source_number;
@@ -72,8 +79,10 @@ Status MultiCastLocalExchanger::push_chunk(const vectorized::ChunkPtr& chunk, in
         _current_row_size = _current_accumulated_row_size - _head->accumulated_row_size;
         _peak_memory_usage_counter->set(_current_memory_usage);
         _peak_buffer_row_size_counter->set(_current_row_size);
+        _spill_lagging_chunks();
         sink_operator->update_counter(_current_memory_usage, _current_row_size);
     }
+    _notify_blocked_drivers();
 
     return Status::OK();
 }
@@ -102,14 +111,24 @@ StatusOr<vectorized::ChunkPtr> MultiCastLocalExchanger::pull_chunk(RuntimeState*
         return Status::OK();
     }
     cell = cell->next;
-    VLOG_FILE << "MultiCastLocalExchanger: return chunk to " << mcast_consumer_index
-              << ", row = " << cell->chunk->debug_row(0) << ", size = " << cell->chunk->num_rows();
+    vectorized::ChunkPtr chunk = cell->chunk;
+    const int64_t spilled_offset = cell->spilled_offset;
 
     _progress[mcast_consumer_index] = cell;
     cell->used_count += 1;
 
     _update_progress(cell);
-    return cell->chunk;
+    // The sinker may be unblocked if this is the fastest consumer.
+    _notify_blocked_drivers();
+    l.unlock();
+
+    // The spill file is only appended, so the spilled chunk could be read without the lock.
+    if (chunk == nullptr) {
+        ASSIGN_OR_RETURN(chunk, _spill_file->read_at(spilled_offset, *_chunk_prototype));
+    }
+    VLOG_FILE << "MultiCastLocalExchanger: return chunk to " << mcast_consumer_index
+              << ", row = " << chunk->debug_row(0) << ", size = " << chunk->num_rows();
+    return chunk;
 }
 
 void MultiCastLocalExchanger::open_source_operator(int32_t mcast_consumer_index) {
@@ -125,6 +144,7 @@ void MultiCastLocalExchanger::close_source_operator(int32_t mcast_consumer_index
     if (_opened_source_opcount[mcast_consumer_index] == 0) {
         _opened_source_number--;
         _closer_consumer(mcast_consumer_index);
+        _notify_blocked_drivers();
     }
 }
 
@@ -135,6 +155,7 @@ void MultiCastLocalExchanger::open_sink_operator() {
 void MultiCastLocalExchanger::close_sink_operator() {
     std::unique_lock l(_mutex);
     _opened_sink_number--;
+    _notify_blocked_drivers();
 }
 
 void MultiCastLocalExchanger::_closer_consumer(int32_t mcast_consumer_index) {
@@ -148,6 +169,12 @@ void MultiCastLocalExchanger::_closer_consumer(int32_t mcast_consumer_index) {
     _update_progress();
 }
 
+void MultiCastLocalExchanger::_notify_blocked_drivers() {
+    if (auto* fragment_ctx = _runtime_state->fragment_ctx(); fragment_ctx != nullptr) {
+        fragment_ctx->notify_blocked_drivers();
+    }
+}
+
 void MultiCastLocalExchanger::_update_progress(Cell* fast) {
     if (fast != nullptr) {
         _fast_accumulated_row_size = std::max(_fast_accumulated_row_size, fast->accumulated_row_size);
@@ -165,6 +192,9 @@ void MultiCastLocalExchanger::_update_progress(Cell* fast) {
         Cell* t = _head->next;
         if (t == nullptr) break;
         _current_memory_usage -= _head->memory_usage;
+        if (_spill_cursor == _head) {
+            _spill_cursor = nullptr;
+        }
         delete _head;
         _head = t;
     }
@@ -173,6 +203,46 @@ void MultiCastLocalExchanger::_update_progress(Cell* fast) {
     }
 }
 
+void MultiCastLocalExchanger::_spill_lagging_chunks() {
+    if (!_runtime_state->enable_spill() || _spill_failed) {
+        return;
+    }
+    Cell* cell = _spill_cursor == nullptr ? _head->next : _spill_cursor->next;
+    // The cells after the one last consumed by the fastest consumer will be consumed soon.
+    while (cell != nullptr && cell->accumulated_row_size < _fast_accumulated_row_size &&
+           vectorized::should_spill(_runtime_state, _current_memory_usage)) {
+        if (_spill_file == nullptr) {
+            auto res = vectorized::SpillFile::create("mcast_local_exchange");
+            if (!res.ok()) {
+                LOG(WARNING) << "fail to create spill file of multi cast local exchanger: " << res.status();
+                _spill_failed = true;
+                return;
+            }
+            _spill_file = std::move(res.value());
+        }
+        if (cell->chunk != nullptr) {
+            const int64_t offset = _spill_file->num_bytes();
+            if (Status st = _spill_file->append(*cell->chunk); !st.ok()) {
+                LOG(WARNING) << "fail to spill chunk of multi cast local exchanger: " << st;
+                _spill_failed = true;
+                return;
+            }
+            const int64_t spilled_bytes = _spill_file->num_bytes() - offset;
+            cell->spilled_offset = offset;
+            cell->chunk.reset();
+            _current_memory_usage -= cell->memory_usage;
+            cell->memory_usage = 0;
+            COUNTER_UPDATE(_spilled_chunks_counter, 1);
+            COUNTER_UPDATE(_spilled_bytes_counter, spilled_bytes);
+            if (auto* query_ctx = _runtime_state->query_ctx(); query_ctx != nullptr) {
+                query_ctx->incr_spill_bytes(spilled_bytes);
+            }
+        }
+        _spill_cursor = cell;
+        cell = cell->next;
+    }
+}
+
 // ===== source op =====
 Status MultiCastLocalExchangeSourceOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(SourceOperator::prepare(state));
@@ -2,6 +2,7 @@
 
 #include "column/chunk.h"
 #include "exec/pipeline/source_operator.h"
+#include "exec/vectorized/spill/spill_file.h"
 
 namespace starrocks {
 namespace pipeline {
@@ -26,6 +27,9 @@ namespace pipeline {
 // 1. can accept chunk or not. we don't want to block any consumer. we can accept chunk only when a any consumer needs chunk.
 // 2. can throw chunk or not. we can only throw any chunk when all consumers have consumed that chunk.
 // 3. can pull chiunk. we maintain the progress of consumers.
+// 4. the chunks kept only for the slow consumers, which the fastest consumer has consumed, are spilled to
+//    the local disk if the session enables spilling and the exchanger uses too much memory. The consumers
+//    read them back when they reach these chunks.
 
 class MultiCastLocalExchangeSinkOperator;
 // ===== exchanger =====
@@ -52,9 +56,16 @@ private:
         size_t accumulated_row_size = 0;
         // how many consumers have used this chunk
         int32_t used_count = 0;
+        // The offset of the chunk in _spill_file if it's spilled, then |chunk| is nullptr.
+        int64_t spilled_offset = -1;
     };
     void _update_progress(Cell* fast = nullptr);
+    // Spill the chunks consumed by the fastest consumer but not by the others, until the memory
+    // usage is low enough.
+    void _spill_lagging_chunks();
     void _closer_consumer(int32_t mcast_consumer_index);
+    // Wake up the blocked sinkers and consumers of the same fragment.
+    void _notify_blocked_drivers();
     RuntimeState* _runtime_state;
     mutable std::mutex _mutex;
     size_t _consumer_number;
@@ -72,6 +83,15 @@ private:
     std::unique_ptr<RuntimeProfile> _runtime_profile;
     RuntimeProfile::HighWaterMarkCounter* _peak_memory_usage_counter = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _peak_buffer_row_size_counter = nullptr;
+
+    vectorized::SpillFilePtr _spill_file;
+    // An empty chunk of the same layout as the pushed chunks, to restore the spilled chunks.
+    vectorized::ChunkPtr _chunk_prototype;
+    // The last cell checked by _spill_lagging_chunks(), the cells before it are spilled or empty.
+    Cell* _spill_cursor = nullptr;
+    bool _spill_failed = false;
+    RuntimeProfile::Counter* _spilled_chunks_counter = nullptr;
+    RuntimeProfile::Counter* _spilled_bytes_counter = nullptr;
 };
 
 // ===== source op =====
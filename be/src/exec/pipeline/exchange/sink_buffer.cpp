@@ -3,7 +3,10 @@
 #include "exec/pipeline/exchange/sink_buffer.h"
 
 #include <chrono>
+#include <iterator>
+#include <unordered_map>
 
+#include "exec/pipeline/query_context.h"
 #include "fmt/core.h"
 #include "util/time.h"
 #include "util/uid_util.h"
@@ -16,7 +19,9 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
           _mem_tracker(fragment_ctx->runtime_state()->instance_mem_tracker()),
           _brpc_timeout_ms(std::min(3600, fragment_ctx->runtime_state()->query_options().query_timeout) * 1000),
           _is_dest_merge(is_dest_merge),
+          _spill_enabled(fragment_ctx->runtime_state()->enable_spill()),
           _num_uncancelled_sinkers(num_sinkers) {
+    std::unordered_map<std::string, std::vector<int64_t>> host_instances;
     for (const auto& dest : destinations) {
         const auto& instance_id = dest.fragment_instance_id;
         // instance_id.lo == -1 indicates that the destination is pseudo for bucket shuffle join.
@@ -37,12 +42,29 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
             _num_finished_rpcs[instance_id.lo] = 0;
             _num_in_flight_rpcs[instance_id.lo] = 0;
             _network_times[instance_id.lo] = TimeTrace{};
+            _network_bytes[instance_id.lo] = 0;
+            _credits[instance_id.lo] = -1;
+            _in_flight_bytes[instance_id.lo] = 0;
+            _is_credit_blocked[instance_id.lo] = false;
+            _num_spilled_requests[instance_id.lo] = 0;
             _mutexes[instance_id.lo] = std::make_unique<Mutex>();
 
             PUniqueId finst_id;
             finst_id.set_hi(instance_id.hi);
             finst_id.set_lo(instance_id.lo);
             _instance_id2finst_id[instance_id.lo] = std::move(finst_id);
+
+            if (dest.__isset.brpc_server) {
+                auto host = fmt::format("{}:{}", dest.brpc_server.hostname, dest.brpc_server.port);
+                host_instances[host].push_back(instance_id.lo);
+            }
+        }
+    }
+    for (const auto& [_, instances] : host_instances) {
+        for (int64_t instance : instances) {
+            auto& peers = _peer_instances[instance];
+            std::copy_if(instances.begin(), instances.end(), std::back_inserter(peers),
+                         [instance](int64_t peer) { return peer != instance; });
         }
     }
 
@@ -73,7 +95,15 @@ void SinkBuffer::add_request(TransmitChunkInfo& request) {
     }
     {
         auto& instance_id = request.fragment_instance_id;
-        _try_to_send_rpc(instance_id, [&]() { _buffers[instance_id.lo].push(request); });
+        _try_to_send_rpc(instance_id, [&]() {
+            if (_should_spill(instance_id.lo, request)) {
+                _spill(instance_id.lo, request);
+            }
+            if (request.spilled_offset < 0) {
+                _unsent_bytes_in_memory += request.attachment.size();
+            }
+            _buffers[instance_id.lo].push(request);
+        });
     }
 }
 
@@ -86,7 +116,9 @@ bool SinkBuffer::is_full() const {
     for (auto& [_, buffer] : _buffers) {
         buffer_size += buffer.size();
     }
-    bool is_full = buffer_size > max_buffer_size;
+    // The spilled requests don't hold memory.
+    buffer_size -= std::min<size_t>(buffer_size, _total_spilled_requests);
+    bool is_full = buffer_size > max_buffer_size || _num_credit_blocked_instances > 0;
 
     if (is_full && _last_full_timestamp == -1) {
         _last_full_timestamp = MonotonicNanos();
@@ -131,6 +163,17 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
     auto* request_sent_counter = ADD_COUNTER(profile, "RequestSent", TUnit::UNIT);
     COUNTER_SET(bytes_sent_counter, _bytes_sent);
     COUNTER_SET(request_sent_counter, _request_sent);
+    if (_batched_request_sent > 0) {
+        auto* batched_request_sent_counter = ADD_COUNTER(profile, "BatchedRequestSent", TUnit::UNIT);
+        COUNTER_SET(batched_request_sent_counter, _batched_request_sent);
+    }
+
+    if (_request_spilled > 0) {
+        auto* bytes_spilled_counter = ADD_COUNTER(profile, "BytesSpilled", TUnit::BYTES);
+        auto* request_spilled_counter = ADD_COUNTER(profile, "RequestSpilled", TUnit::UNIT);
+        COUNTER_SET(bytes_spilled_counter, _bytes_spilled);
+        COUNTER_SET(request_spilled_counter, _request_spilled);
+    }
 
     if (_bytes_enqueued - _bytes_sent > 0) {
         auto* bytes_unsent_counter = ADD_COUNTER(profile, "BytesUnsent", TUnit::BYTES);
@@ -168,9 +211,28 @@ void SinkBuffer::cancel_one_sinker() {
 }
 
 void SinkBuffer::_update_network_time(const TUniqueId& instance_id, const int64_t send_timestamp,
-                                      const int64_t receive_timestamp) {
+                                      const int64_t receive_timestamp, const int64_t send_bytes) {
     int32_t concurrency = _num_in_flight_rpcs[instance_id.lo];
     _network_times[instance_id.lo].update(receive_timestamp - send_timestamp, concurrency);
+    _network_bytes[instance_id.lo] += send_bytes;
+}
+
+double SinkBuffer::network_ns_per_byte(const TUniqueId& instance_id) const {
+    auto it = _mutexes.find(instance_id.lo);
+    if (it == _mutexes.end()) {
+        return -1;
+    }
+    std::lock_guard<Mutex> l(*it->second);
+    const int64_t bytes = _network_bytes.at(instance_id.lo);
+    if (bytes <= 0) {
+        return -1;
+    }
+    const auto& time_trace = _network_times.at(instance_id.lo);
+    double average_concurrency =
+            static_cast<double>(time_trace.accumulated_concurrency) / std::max(1, time_trace.times);
+    // The send and receive timestamps come from different hosts, so the time may be negative due to clock skew.
+    double time = std::max<double>(0, time_trace.accumulated_time / std::max(1.0, average_concurrency));
+    return time / bytes;
 }
 
 void SinkBuffer::_process_send_window(const TUniqueId& instance_id, const int64_t sequence) {
@@ -189,10 +251,183 @@ void SinkBuffer::_process_send_window(const TUniqueId& instance_id, const int64_
     }
 }
 
+bool SinkBuffer::_is_too_much_brpc_process(int64_t instance_lo) {
+    if (_is_dest_merge) {
+        // discontinuous_acked_window_size means that we are not received all the ack
+        // with sequence from _max_continuous_acked_seqs[x] to _request_seqs[x]
+        // Limit the size of the window to avoid buffering too much out-of-order data at the receiving side
+        int64_t discontinuous_acked_window_size = _request_seqs[instance_lo] - _max_continuous_acked_seqs[instance_lo];
+        return discontinuous_acked_window_size >= config::pipeline_sink_brpc_dop;
+    }
+    return _num_in_flight_rpcs[instance_lo] >= config::pipeline_sink_brpc_dop;
+}
+
+bool SinkBuffer::_is_short_of_credit(int64_t instance_lo, const TransmitChunkInfo& request) {
+    if (!config::enable_exchange_credit_flow_control) {
+        return false;
+    }
+    const int64_t credit = _credits[instance_lo];
+    const auto request_bytes = static_cast<int64_t>(request.spilled_offset < 0 ? request.attachment.size()
+                                                                                : request.spilled_size);
+    // No credit will be granted without in-flight rpc, so the request is sent anyway,
+    // and the receiver delays its response until the buffer has free space.
+    return credit >= 0 && credit < request_bytes && _num_in_flight_rpcs[instance_lo] > 0;
+}
+
+void SinkBuffer::_update_credit(int64_t instance_lo, int64_t send_bytes, int64_t granted_bytes) {
+    auto& in_flight_bytes = _in_flight_bytes[instance_lo];
+    in_flight_bytes -= send_bytes;
+    // The grant doesn't count the requests sent after the acked one, which are still in flight.
+    _credits[instance_lo] = granted_bytes < 0 ? -1 : std::max<int64_t>(0, granted_bytes - in_flight_bytes);
+}
+
+void SinkBuffer::_update_credit_blocked(int64_t instance_lo) {
+    const auto& buffer = _buffers[instance_lo];
+    const int64_t num_in_memory_requests = buffer.size() - _num_spilled_requests[instance_lo];
+    bool blocked = !buffer.empty() && num_in_memory_requests >= config::pipeline_sink_buffer_size &&
+                   _is_short_of_credit(instance_lo, buffer.front());
+    bool& is_blocked = _is_credit_blocked[instance_lo];
+    if (blocked == is_blocked) {
+        return;
+    }
+    is_blocked = blocked;
+    if (blocked) {
+        ++_num_credit_blocked_instances;
+    } else {
+        --_num_credit_blocked_instances;
+    }
+}
+
+bool SinkBuffer::_should_spill(int64_t instance_lo, const TransmitChunkInfo& request) {
+    // The request is likely to be sent right away if no request is waiting ahead of it.
+    if (!_spill_enabled || request.attachment.empty() || _buffers[instance_lo].empty()) {
+        return false;
+    }
+    const int64_t num_in_memory_requests = _buffers[instance_lo].size() - _num_spilled_requests[instance_lo];
+    return num_in_memory_requests + 1 >= config::pipeline_sink_buffer_size ||
+           _unsent_bytes_in_memory + static_cast<int64_t>(request.attachment.size()) >
+                   config::pipeline_sink_spill_mem_threshold_bytes;
+}
+
+void SinkBuffer::_spill(int64_t instance_lo, TransmitChunkInfo& request) {
+    auto& file = _spill_files[instance_lo];
+    if (file == nullptr) {
+        auto res = vectorized::SpillFile::create("exchange_sink");
+        if (!res.ok()) {
+            LOG(WARNING) << "fail to create spill file of exchange sink: " << res.status();
+            return;
+        }
+        file = std::move(res.value());
+    }
+    std::string data;
+    request.attachment.copy_to(&data);
+    auto res = file->append_raw(data.data(), data.size());
+    if (!res.ok()) {
+        LOG(WARNING) << "fail to spill exchange request: " << res.status();
+        return;
+    }
+    request.spilled_offset = res.value();
+    request.spilled_size = data.size();
+    request.attachment.clear();
+    ++_num_spilled_requests[instance_lo];
+    ++_total_spilled_requests;
+    _bytes_spilled += data.size();
+    _request_spilled++;
+    if (auto* query_ctx = _fragment_ctx->runtime_state()->query_ctx(); query_ctx != nullptr) {
+        query_ctx->incr_spill_bytes(data.size());
+    }
+}
+
+Status SinkBuffer::_restore_spilled(int64_t instance_lo, TransmitChunkInfo& request) {
+    if (request.spilled_offset < 0) {
+        return Status::OK();
+    }
+    std::string data;
+    RETURN_IF_ERROR(_spill_files[instance_lo]->read_raw(request.spilled_offset, request.spilled_size, &data));
+    request.attachment.append(data);
+    return Status::OK();
+}
+
+ClosureContext SinkBuffer::_prepare_request(const TUniqueId& instance_id, TransmitChunkInfo& request) {
+    *request.params->mutable_finst_id() = _instance_id2finst_id[instance_id.lo];
+    request.params->set_sequence(++_request_seqs[instance_id.lo]);
+
+    if (!request.attachment.empty()) {
+        _bytes_sent += request.attachment.size();
+        _request_sent++;
+        if (auto* query_ctx = _fragment_ctx->runtime_state()->query_ctx(); query_ctx != nullptr) {
+            query_ctx->incr_network_sent_bytes(request.attachment.size());
+        }
+    }
+    ++_num_in_flight_rpcs[instance_id.lo];
+    const auto send_bytes = static_cast<int64_t>(request.attachment.size());
+    if (request.spilled_offset < 0) {
+        _unsent_bytes_in_memory -= send_bytes;
+    } else {
+        --_num_spilled_requests[instance_id.lo];
+        --_total_spilled_requests;
+    }
+    _in_flight_bytes[instance_id.lo] += send_bytes;
+    auto& credit = _credits[instance_id.lo];
+    if (credit >= 0) {
+        credit = std::max<int64_t>(0, credit - send_bytes);
+    }
+    auto span = Tracer::Instance().add_span("transmit_chunk", _fragment_ctx->span());
+    if (span->IsRecording()) {
+        span->SetAttribute("dest_instance_id", print_id(instance_id));
+        span->SetAttribute("sequence", request.params->sequence());
+        span->SetAttribute("bytes", send_bytes);
+        request.params->set_trace_parent(Tracer::to_trace_parent(span->GetContext()));
+    }
+    return {instance_id, request.params->sequence(), GetCurrentTimeNanos(), send_bytes, std::move(span)};
+}
+
+void SinkBuffer::_collect_batched_requests(const TUniqueId& instance_id,
+                                           std::vector<TransmitChunkInfo>* batched_requests,
+                                           std::vector<ClosureContext>* contexts) {
+    const int64_t batch_size = config::pipeline_sink_brpc_batch_size;
+    for (int64_t peer : _peer_instances[instance_id.lo]) {
+        if (static_cast<int64_t>(batched_requests->size()) + 1 >= batch_size) {
+            break;
+        }
+        // Skip the busy peer rather than waiting for it, which also avoids the deadlock when two instances
+        // try to batch each other.
+        std::unique_lock<Mutex> l(*_mutexes[peer], std::try_to_lock);
+        if (!l.owns_lock()) {
+            continue;
+        }
+        auto& buffer = _buffers[peer];
+        if (buffer.empty() || _is_too_much_brpc_process(peer) || _is_short_of_credit(peer, buffer.front())) {
+            continue;
+        }
+        // The first packet must be received first, and eos must be the last packet, which are left to
+        // the _try_to_send_rpc of the peer itself.
+        if (_num_finished_rpcs[peer] == 0 && _num_in_flight_rpcs[peer] > 0) {
+            continue;
+        }
+        // The spilled request isn't batched, so the disk isn't read while the other instance is locked.
+        // The peers may use different connections to the same backend, and the batch is sent over the
+        // connection of the instance which collects it.
+        if (buffer.front().params->eos() || buffer.front().spilled_offset >= 0) {
+            continue;
+        }
+
+        TransmitChunkInfo request = buffer.front();
+        buffer.pop();
+        TUniqueId peer_id;
+        peer_id.hi = instance_id.hi;
+        peer_id.lo = peer;
+        contexts->push_back(_prepare_request(peer_id, request));
+        batched_requests->push_back(std::move(request));
+        _update_credit_blocked(peer);
+    }
+}
+
 void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<void()> pre_works) {
     std::lock_guard<Mutex> l(*_mutexes[instance_id.lo]);
     pre_works();
 
+    DeferOp credit_defer([this, &instance_id]() { _update_credit_blocked(instance_id.lo); });
     DeferOp decrease_defer([this]() { --_num_sending_rpc; });
     ++_num_sending_rpc;
 
@@ -203,18 +438,7 @@ void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<vo
 
         auto& buffer = _buffers[instance_id.lo];
 
-        bool too_much_brpc_process = false;
-        if (_is_dest_merge) {
-            // discontinuous_acked_window_size means that we are not received all the ack
-            // with sequence from _max_continuous_acked_seqs[x] to _request_seqs[x]
-            // Limit the size of the window to avoid buffering too much out-of-order data at the receiving side
-            int64_t discontinuous_acked_window_size =
-                    _request_seqs[instance_id.lo] - _max_continuous_acked_seqs[instance_id.lo];
-            too_much_brpc_process = discontinuous_acked_window_size >= config::pipeline_sink_brpc_dop;
-        } else {
-            too_much_brpc_process = _num_in_flight_rpcs[instance_id.lo] >= config::pipeline_sink_brpc_dop;
-        }
-        if (buffer.empty() || too_much_brpc_process) {
+        if (buffer.empty() || _is_too_much_brpc_process(instance_id.lo)) {
             return;
         }
 
@@ -234,6 +458,10 @@ void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<vo
             need_wait = true;
             return;
         }
+        if (_is_short_of_credit(instance_id.lo, request)) {
+            need_wait = true;
+            return;
+        }
         if (request.params->eos()) {
             DeferOp eos_defer([this, &instance_id, &need_wait]() {
                 if (need_wait) {
@@ -264,57 +492,89 @@ void SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, std::function<vo
             }
         }
 
-        *request.params->mutable_finst_id() = _instance_id2finst_id[instance_id.lo];
-        request.params->set_sequence(++_request_seqs[instance_id.lo]);
+        if (Status st = _restore_spilled(instance_id.lo, request); !st.ok()) {
+            _is_finishing = true;
+            _fragment_ctx->cancel(st);
+            LOG(WARNING) << "fail to restore spilled exchange request: " << st;
+            return;
+        }
 
-        if (!request.attachment.empty()) {
-            _bytes_sent += request.attachment.size();
-            _request_sent++;
+        std::vector<ClosureContext> contexts{_prepare_request(instance_id, request)};
+        std::vector<TransmitChunkInfo> batched_requests;
+        if (config::pipeline_sink_brpc_batch_size > 1) {
+            _collect_batched_requests(instance_id, &batched_requests, &contexts);
         }
 
-        auto* closure = new DisposableClosure<PTransmitChunkResult, ClosureContext>(
-                {instance_id, request.params->sequence(), GetCurrentTimeNanos()});
+        auto* closure = new DisposableClosure<PTransmitChunkResult, std::vector<ClosureContext>>(std::move(contexts));
 
-        closure->addFailedHandler([this](const ClosureContext& ctx) noexcept {
+        closure->addFailedHandler([this](const std::vector<ClosureContext>& ctxs) noexcept {
             _is_finishing = true;
-            {
+            for (const auto& ctx : ctxs) {
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
+                ctx.span->SetStatus(opentelemetry::trace::StatusCode::kError, "rpc failed");
+                ctx.span->End();
             }
             --_total_in_flight_rpc;
-            std::string err_msg = fmt::format("transmit chunk rpc failed:{}", print_id(ctx.instance_id));
+            std::string err_msg = fmt::format("transmit chunk rpc failed:{}", print_id(ctxs[0].instance_id));
             _fragment_ctx->cancel(Status::InternalError(err_msg));
             LOG(WARNING) << err_msg;
         });
-        closure->addSuccessHandler([this](const ClosureContext& ctx, const PTransmitChunkResult& result) noexcept {
+        closure->addSuccessHandler([this](const std::vector<ClosureContext>& ctxs,
+                                          const PTransmitChunkResult& result) noexcept {
             Status status(result.status());
-            {
+            for (const auto& ctx : ctxs) {
                 std::lock_guard<Mutex> l(*_mutexes[ctx.instance_id.lo]);
                 ++_num_finished_rpcs[ctx.instance_id.lo];
                 --_num_in_flight_rpcs[ctx.instance_id.lo];
+                if (!status.ok()) {
+                    ctx.span->SetStatus(opentelemetry::trace::StatusCode::kError, status.to_string());
+                }
+                ctx.span->End();
             }
             if (!status.ok()) {
                 _is_finishing = true;
                 _fragment_ctx->cancel(status);
-                LOG(WARNING) << fmt::format("transmit chunk rpc failed:{}, msg:{}", print_id(ctx.instance_id),
+                LOG(WARNING) << fmt::format("transmit chunk rpc failed:{}, msg:{}", print_id(ctxs[0].instance_id),
                                             status.message());
             } else {
-                _try_to_send_rpc(ctx.instance_id, [&]() {
-                    _process_send_window(ctx.instance_id, ctx.sequence);
-                    _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receive_timestamp());
-                });
+                for (size_t i = 0; i < ctxs.size(); ++i) {
+                    const auto& ctx = ctxs[i];
+                    // The receiver of the old version grants no credit.
+                    const int64_t granted_bytes = i < result.credit_bytes_size() ? result.credit_bytes(i) : -1;
+                    _try_to_send_rpc(ctx.instance_id, [&]() {
+                        _update_credit(ctx.instance_id.lo, ctx.send_bytes, granted_bytes);
+                        _process_send_window(ctx.instance_id, ctx.sequence);
+                        _update_network_time(ctx.instance_id, ctx.send_timestamp, result.receive_timestamp(),
+                                             ctx.send_bytes);
+                    });
+                }
             }
+            // The sinkers blocked by the full buffer or waiting for the in-flight rpcs may be unblocked.
+            // It must be called before decreasing _total_in_flight_rpc, after which the fragment may be destructed.
+            _fragment_ctx->notify_blocked_drivers();
             --_total_in_flight_rpc;
         });
 
         ++_total_in_flight_rpc;
-        ++_num_in_flight_rpcs[instance_id.lo];
 
         closure->cntl.Reset();
         closure->cntl.set_timeout_ms(_brpc_timeout_ms);
         closure->cntl.request_attachment().append(request.attachment);
-        request.brpc_stub->transmit_chunk(&closure->cntl, request.params.get(), &closure->result, closure);
+        if (batched_requests.empty()) {
+            request.brpc_stub->transmit_chunk(&closure->cntl, request.params.get(), &closure->result, closure);
+        } else {
+            // The requests are serialized when the rpc is issued, so the batch needn't outlive this call.
+            PTransmitChunkBatchParams batch;
+            *batch.add_requests() = *request.params;
+            for (auto& batched_request : batched_requests) {
+                *batch.add_requests() = *batched_request.params;
+                closure->cntl.request_attachment().append(batched_request.attachment);
+            }
+            _batched_request_sent += batched_requests.size();
+            request.brpc_stub->transmit_chunk_batch(&closure->cntl, &batch, &closure->result, closure);
+        }
 
         return;
     }
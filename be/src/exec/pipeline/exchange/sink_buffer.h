@@ -11,7 +11,9 @@
 
 #include "bthread/mutex.h"
 #include "column/chunk.h"
+#include "common/tracer.h"
 #include "exec/pipeline/fragment_context.h"
+#include "exec/vectorized/spill/spill_file.h"
 #include "gen_cpp/BackendService.h"
 #include "runtime/current_thread.h"
 #include "runtime/runtime_state.h"
@@ -32,12 +34,18 @@ struct TransmitChunkInfo {
     doris::PBackendService_Stub* brpc_stub;
     PTransmitChunkParamsPtr params;
     butil::IOBuf attachment;
+    // The offset of the attachment in the spill file of the destination, or -1 if the attachment is in memory.
+    int64_t spilled_offset = -1;
+    size_t spilled_size = 0;
 };
 
 struct ClosureContext {
     TUniqueId instance_id;
     int64_t sequence;
     int64_t send_timestamp;
+    int64_t send_bytes;
+    // The span of the request, which ends when the rpc is done.
+    Span span;
 };
 
 // TimeTrace is introduced to estimate time more accurately.
@@ -76,6 +84,9 @@ public:
     // Add counters to the given profile
     void update_profile(RuntimeProfile* profile);
 
+    // Returns the measured network time to send one byte to the destination, or -1 if there is no sample yet.
+    double network_ns_per_byte(const TUniqueId& instance_id) const;
+
     // When all the ExchangeSinkOperator shared this SinkBuffer are cancelled,
     // the rest chunk request and EOS request needn't be sent anymore.
     void cancel_one_sinker();
@@ -84,13 +95,33 @@ private:
     using Mutex = bthread::Mutex;
 
     void _update_network_time(const TUniqueId& instance_id, const int64_t send_timestamp,
-                              const int64_t receive_timestamp);
+                              const int64_t receive_timestamp, const int64_t send_bytes);
     // Update the discontinuous acked window, here are the invariants:
     // all acks received with sequence from [0, _max_continuous_acked_seqs[x]]
     // not all the acks received with sequence from [_max_continuous_acked_seqs[x]+1, _request_seqs[x]]
     // _discontinuous_acked_seqs[x] stored the received discontinuous acks
     void _process_send_window(const TUniqueId& instance_id, const int64_t sequence);
 
+    bool _is_too_much_brpc_process(int64_t instance_lo);
+    // Whether the request should wait for the credit granted by the responses of the in-flight rpcs.
+    bool _is_short_of_credit(int64_t instance_lo, const TransmitChunkInfo& request);
+    void _update_credit(int64_t instance_lo, int64_t send_bytes, int64_t granted_bytes);
+    void _update_credit_blocked(int64_t instance_lo);
+
+    // Whether the request to be enqueued should be spilled, rather than waiting in memory.
+    bool _should_spill(int64_t instance_lo, const TransmitChunkInfo& request);
+    // Move the attachment of the request to the spill file of the destination. The request is kept
+    // in memory if it fails.
+    void _spill(int64_t instance_lo, TransmitChunkInfo& request);
+    // Read the spilled attachment of the request back before it's sent.
+    Status _restore_spilled(int64_t instance_lo, TransmitChunkInfo& request);
+    // Assign the sequence to the request to be sent, and count it as in-flight.
+    ClosureContext _prepare_request(const TUniqueId& instance_id, TransmitChunkInfo& request);
+    // Pop the pending requests of the other fragment instances on the same backend, which are ready to be
+    // sent along with the request of |instance_id| in one rpc.
+    void _collect_batched_requests(const TUniqueId& instance_id, std::vector<TransmitChunkInfo>* batched_requests,
+                                   std::vector<ClosureContext>* contexts);
+
     // Try to send rpc if buffer is not empty and channel is not busy
     // And we need to put this function and other extra works(pre_works) together as an atomic operation
     void _try_to_send_rpc(const TUniqueId& instance_id, std::function<void()> pre_works);
@@ -107,6 +138,7 @@ private:
     const MemTracker* _mem_tracker;
     const int32_t _brpc_timeout_ms;
     const bool _is_dest_merge;
+    const bool _spill_enabled;
 
     /// Taking into account of efficiency, all the following maps
     /// use int64_t as key, which is the field type of TUniqueId::lo
@@ -134,7 +166,25 @@ private:
     phmap::flat_hash_map<int64_t, int32_t> _num_finished_rpcs;
     phmap::flat_hash_map<int64_t, int32_t> _num_in_flight_rpcs;
     phmap::flat_hash_map<int64_t, TimeTrace> _network_times;
+    // The bytes of the attachments whose network time is sampled in _network_times.
+    phmap::flat_hash_map<int64_t, int64_t> _network_bytes;
     phmap::flat_hash_map<int64_t, std::unique_ptr<Mutex>> _mutexes;
+    // The other fragment instances on the same backend of each fragment instance.
+    phmap::flat_hash_map<int64_t, std::vector<int64_t>> _peer_instances;
+    // The bytes which could be sent to each fragment instance before its next grant, -1 means unlimited.
+    phmap::flat_hash_map<int64_t, int64_t> _credits;
+    phmap::flat_hash_map<int64_t, int64_t> _in_flight_bytes;
+    // Whether each fragment instance has too many pending requests waiting for the credit,
+    // and the sinkers should stop adding requests.
+    phmap::flat_hash_map<int64_t, bool> _is_credit_blocked;
+    std::atomic<int32_t> _num_credit_blocked_instances = 0;
+    // The spill file of each fragment instance, created at the first spill.
+    phmap::flat_hash_map<int64_t, vectorized::SpillFilePtr> _spill_files;
+    // The number of the spilled requests in the buffer of each fragment instance.
+    phmap::flat_hash_map<int64_t, int32_t> _num_spilled_requests;
+    std::atomic<int32_t> _total_spilled_requests = 0;
+    // The bytes of the attachments in the buffers, excluding the spilled ones.
+    std::atomic<int64_t> _unsent_bytes_in_memory = 0;
 
     // True means that SinkBuffer needn't input chunk and send chunk anymore,
     // but there may be still in-flight RPC running.
@@ -155,6 +205,10 @@ private:
     std::atomic<int64_t> _request_enqueued = 0;
     std::atomic<int64_t> _bytes_sent = 0;
     std::atomic<int64_t> _request_sent = 0;
+    // The requests sent along with the request of another fragment instance in one rpc.
+    std::atomic<int64_t> _batched_request_sent = 0;
+    std::atomic<int64_t> _bytes_spilled = 0;
+    std::atomic<int64_t> _request_spilled = 0;
 
     int64_t _pending_timestamp = -1;
     mutable int64_t _last_full_timestamp = -1;
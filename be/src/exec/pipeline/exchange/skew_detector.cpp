@@ -0,0 +1,77 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/exchange/skew_detector.h"
+
+#include <algorithm>
+
+namespace starrocks::pipeline {
+
+// The hot keys aren't reported until enough rows are sampled, since a few rows say nothing about the skew.
+static constexpr int64_t kMinSampledRows = 1024;
+static constexpr size_t kMinCapacity = 16;
+static constexpr size_t kMaxCapacity = 128;
+
+SkewDetector::SkewDetector(size_t num_receivers, size_t sample_stride)
+        : _num_receivers(num_receivers),
+          _sample_stride(std::max<size_t>(1, sample_stride)),
+          _capacity(std::clamp(2 * num_receivers, kMinCapacity, kMaxCapacity)) {
+    _counters.reserve(_capacity);
+}
+
+void SkewDetector::update(const uint32_t* hash_values, size_t num_rows) {
+    size_t i = _next_offset;
+    for (; i < num_rows; i += _sample_stride) {
+        const uint32_t key = hash_values[i];
+        _num_sampled_rows++;
+
+        auto it = std::find_if(_counters.begin(), _counters.end(),
+                               [key](const Counter& counter) { return counter.key == key; });
+        if (it != _counters.end()) {
+            it->count++;
+        } else if (_counters.size() < _capacity) {
+            _counters.push_back({key, 1, 0});
+        } else {
+            // Replace the least frequent key, which may have been counted as the new key.
+            auto min_it = std::min_element(_counters.begin(), _counters.end(),
+                                           [](const Counter& lhs, const Counter& rhs) { return lhs.count < rhs.count; });
+            min_it->key = key;
+            min_it->error = min_it->count;
+            min_it->count++;
+        }
+    }
+    _next_offset = i - num_rows;
+}
+
+std::vector<const SkewDetector::Counter*> SkewDetector::_hot_counters() const {
+    std::vector<const Counter*> hot_counters;
+    if (_num_receivers <= 1 || _num_sampled_rows < kMinSampledRows) {
+        return hot_counters;
+    }
+    for (const auto& counter : _counters) {
+        // Use the guaranteed count, so a key isn't reported by the overestimation.
+        if ((counter.count - counter.error) * static_cast<int64_t>(_num_receivers) > _num_sampled_rows) {
+            hot_counters.push_back(&counter);
+        }
+    }
+    std::sort(hot_counters.begin(), hot_counters.end(),
+              [](const Counter* lhs, const Counter* rhs) { return lhs->count > rhs->count; });
+    return hot_counters;
+}
+
+std::vector<uint32_t> SkewDetector::hot_keys() const {
+    std::vector<uint32_t> keys;
+    for (const auto* counter : _hot_counters()) {
+        keys.push_back(counter->key);
+    }
+    return keys;
+}
+
+int64_t SkewDetector::estimated_hot_rows() const {
+    int64_t rows = 0;
+    for (const auto* counter : _hot_counters()) {
+        rows += counter->count - counter->error;
+    }
+    return rows * static_cast<int64_t>(_sample_stride);
+}
+
+} // namespace starrocks::pipeline
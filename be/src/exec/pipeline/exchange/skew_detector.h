@@ -0,0 +1,51 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace starrocks::pipeline {
+
+// SkewDetector finds the heavy hitters among the shuffle hash values of the rows sent by an exchange sink.
+// It samples one of every sample_stride rows, and counts the sampled hash values by the space-saving algorithm,
+// which tracks every hash value whose frequency is more than 1/capacity of the sampled rows.
+//
+// A hash value is hot if it alone takes more than the fair share of one receiver, that is, more than
+// 1/num_receivers of the rows. All the rows of a hot hash value are sent to the same receiver, which becomes
+// the straggler of the query.
+class SkewDetector {
+public:
+    SkewDetector(size_t num_receivers, size_t sample_stride);
+
+    void update(const uint32_t* hash_values, size_t num_rows);
+
+    // The hot hash values, ordered by the estimated frequency descendingly.
+    std::vector<uint32_t> hot_keys() const;
+    // The estimated number of the rows of all the hot hash values.
+    int64_t estimated_hot_rows() const;
+
+    int64_t num_sampled_rows() const { return _num_sampled_rows; }
+
+private:
+    struct Counter {
+        uint32_t key;
+        int64_t count;
+        // The max overestimation of count.
+        int64_t error;
+    };
+
+    // Returns the hot counters, ordered by count descendingly.
+    std::vector<const Counter*> _hot_counters() const;
+
+    const size_t _num_receivers;
+    const size_t _sample_stride;
+    const size_t _capacity;
+    std::vector<Counter> _counters;
+    // The offset of the next sampled row in the next chunk.
+    size_t _next_offset = 0;
+    int64_t _num_sampled_rows = 0;
+};
+
+} // namespace starrocks::pipeline
@@ -2,11 +2,16 @@
 
 #include "exec/pipeline/fragment_context.h"
 
+#include "exec/pipeline/pipeline_driver_poller.h"
 #include "runtime/data_stream_mgr.h"
 #include "runtime/exec_env.h"
 
 namespace starrocks::pipeline {
 
+void FragmentContext::_notify_driver_poller(PipelineDriverPoller* poller) {
+    poller->notify(this);
+}
+
 FragmentContext* FragmentContextManager::get_or_register(const TUniqueId& fragment_id) {
     std::lock_guard<std::mutex> lock(_lock);
     auto it = _fragment_contexts.find(fragment_id);
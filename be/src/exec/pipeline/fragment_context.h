@@ -4,6 +4,7 @@
 
 #include <unordered_map>
 
+#include "common/tracer.h"
 #include "exec/exec_node.h"
 #include "exec/pipeline/driver_limiter.h"
 #include "exec/pipeline/morsel.h"
@@ -44,6 +45,9 @@ public:
     void set_fragment_instance_id(const TUniqueId& fragment_instance_id) {
         _fragment_instance_id = fragment_instance_id;
     }
+    // The span of the fragment instance, which ends when the last driver is finalized.
+    const Span& span() const { return _span; }
+    void set_span(Span span) { _span = std::move(span); }
     void set_fe_addr(const TNetworkAddress& fe_addr) { _fe_addr = fe_addr; }
     const TNetworkAddress& fe_addr() { return _fe_addr; }
     void set_report_profile() { _is_report_profile = true; }
@@ -90,6 +94,7 @@ public:
     void cancel(const Status& status) {
         _cancel_flag.store(true, std::memory_order_release);
         set_final_status(status);
+        notify_blocked_drivers();
     }
 
     void finish() { cancel(Status::OK()); }
@@ -124,12 +129,42 @@ public:
 
     void set_driver_token(DriverLimiter::TokenPtr driver_token) { _driver_token = std::move(driver_token); }
 
+    // Wake up the PipelineDriverPoller to check the blocked drivers of this fragment, which is called
+    // when the state some blocked drivers are waiting for is changed, e.g. chunks are received by the
+    // exchange receiver. The caller must guarantee that this fragment isn't destructed during the call.
+    // It is cheap to call it repeatedly, since only the first call is passed to the poller until the
+    // poller checks the drivers of this fragment.
+    void notify_blocked_drivers() {
+        auto* poller = _driver_poller.load(std::memory_order_acquire);
+        if (poller != nullptr && !_is_notified.load(std::memory_order_relaxed) && !_is_notified.exchange(true)) {
+            _notify_driver_poller(poller);
+        }
+    }
+    // Called by PipelineDriverPoller.
+    void set_driver_poller(PipelineDriverPoller* poller) { _driver_poller.store(poller, std::memory_order_release); }
+    void clear_notified() { _is_notified.store(false); }
+
+    // The NUMA node whose executor threads run the drivers of this fragment, or -1 if it isn't assigned yet.
+    // Used by the NUMA-aware WorkStealingDriverQueue.
+    int numa_node() const { return _numa_node.load(std::memory_order_relaxed); }
+    // Assign |node| if no node is assigned yet, and return the node actually assigned.
+    int assign_numa_node(int node) {
+        int expected = -1;
+        if (_numa_node.compare_exchange_strong(expected, node)) {
+            return node;
+        }
+        return expected;
+    }
+
 private:
+    void _notify_driver_poller(PipelineDriverPoller* poller);
+
     // Id of this query
     TUniqueId _query_id;
     // Id of this instance
     TUniqueId _fragment_instance_id;
     TNetworkAddress _fe_addr;
+    Span _span;
 
     bool _is_report_profile = false;
     // Level of profile
@@ -161,6 +196,12 @@ private:
     bool _enable_resource_group = false;
 
     DriverLimiter::TokenPtr _driver_token = nullptr;
+
+    // The poller which the blocked drivers of this fragment are added to.
+    std::atomic<PipelineDriverPoller*> _driver_poller = nullptr;
+    std::atomic<bool> _is_notified = false;
+
+    std::atomic<int> _numa_node = -1;
 };
 
 class FragmentContextManager {
@@ -4,6 +4,7 @@
 
 #include <unordered_map>
 
+#include "common/tracer.h"
 #include "exec/exchange_node.h"
 #include "exec/pipeline/exchange/exchange_sink_operator.h"
 #include "exec/pipeline/exchange/multi_cast_local_exchange.h"
@@ -16,6 +17,8 @@
 #include "exec/pipeline/result_sink_operator.h"
 #include "exec/pipeline/scan_operator.h"
 #include "exec/scan_node.h"
+#include "exec/vectorized/hdfs_scan_node.h"
+#include "exec/vectorized/olap_scan_node.h"
 #include "exec/workgroup/work_group.h"
 #include "gen_cpp/doris_internal_service.pb.h"
 #include "gutil/casts.h"
@@ -26,6 +29,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/multi_cast_data_stream_sink.h"
 #include "runtime/result_sink.h"
+#include "util/defer_op.h"
 #include "util/pretty_printer.h"
 #include "util/uid_util.h"
 
@@ -37,14 +41,15 @@ using WorkGroupPtr = workgroup::WorkGroupPtr;
 
 static void setup_profile_hierarchy(RuntimeState* runtime_state, const PipelinePtr& pipeline) {
     runtime_state->runtime_profile()->add_child(pipeline->runtime_profile(), true, nullptr);
-}
-
-static void setup_profile_hierarchy(const PipelinePtr& pipeline, const DriverPtr& driver) {
-    pipeline->runtime_profile()->add_child(driver->runtime_profile(), true, nullptr);
+    // The counters are the same for all the drivers of the pipeline, so they are set once here.
     auto* dop_counter = ADD_COUNTER(pipeline->runtime_profile(), "DegreeOfParallelism", TUnit::UNIT);
     COUNTER_SET(dop_counter, static_cast<int64_t>(pipeline->source_operator_factory()->degree_of_parallelism()));
     auto* total_dop_counter = ADD_COUNTER(pipeline->runtime_profile(), "TotalDegreeOfParallelism", TUnit::UNIT);
     COUNTER_SET(total_dop_counter, dop_counter->value());
+}
+
+static void setup_profile_hierarchy(const PipelinePtr& pipeline, const DriverPtr& driver) {
+    pipeline->runtime_profile()->add_child(driver->runtime_profile(), true, nullptr);
     auto& operators = driver->operators();
     for (int32_t i = operators.size() - 1; i >= 0; --i) {
         auto& curr_op = operators[i];
@@ -105,6 +110,14 @@ Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParam
     _fragment_ctx->set_query_id(query_id);
     _fragment_ctx->set_fragment_instance_id(fragment_instance_id);
     _fragment_ctx->set_fe_addr(coord);
+    _fragment_ctx->set_span(
+            Tracer::Instance().add_span("fragment_instance", Tracer::Instance().query_trace_context(query_id)));
+    if (_fragment_ctx->span()->IsRecording()) {
+        _fragment_ctx->span()->SetAttribute("fragment_instance_id", print_id(fragment_instance_id));
+        _fragment_ctx->span()->SetAttribute("backend_num", backend_num);
+    }
+    auto prepare_span = Tracer::Instance().add_span("prepare", _fragment_ctx->span());
+    DeferOp end_prepare_span([&prepare_span]() { prepare_span->End(); });
 
     if (query_options.__isset.is_report_success && query_options.is_report_success) {
         _fragment_ctx->set_report_profile();
@@ -165,6 +178,7 @@ Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParam
     runtime_state->init_mem_trackers(instance_mem_limit, _query_ctx->mem_tracker());
     runtime_state->set_be_number(backend_num);
     runtime_state->set_query_ctx(_query_ctx);
+    runtime_state->set_fragment_ctx(_fragment_ctx);
 
     // RuntimeFilterWorker::open_query is idempotent
     if (params.__isset.runtime_filter_params && params.runtime_filter_params.id_to_prober_params.size() != 0) {
@@ -223,7 +237,18 @@ Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParam
         ScanNode* scan_node = down_cast<ScanNode*>(i);
         const std::vector<TScanRangeParams>& scan_ranges =
                 FindWithDefault(params.per_node_scan_ranges, scan_node->id(), no_scan_ranges);
-        Morsels morsels = convert_scan_range_to_morsel(scan_ranges, scan_node->id());
+        Morsels morsels;
+        auto* olap_scan_node = dynamic_cast<vectorized::OlapScanNode*>(scan_node);
+        // It's unnecessary to split the tablets of the scan with a limit, which reads a few rows usually.
+        if (olap_scan_node != nullptr && olap_scan_node->limit() == -1) {
+            bool skip_aggregation = olap_scan_node->thrift_olap_scan_node().is_preaggregation;
+            ASSIGN_OR_RETURN(morsels, convert_olap_scan_range_to_morsels(scan_ranges, scan_node->id(), skip_aggregation,
+                                                                         degree_of_parallelism));
+        } else if (dynamic_cast<vectorized::HdfsScanNode*>(scan_node) != nullptr && scan_node->limit() == -1) {
+            morsels = convert_hdfs_scan_range_to_morsels(scan_ranges, scan_node->id(), degree_of_parallelism);
+        } else {
+            morsels = convert_scan_range_to_morsel(scan_ranges, scan_node->id());
+        }
         morsel_queues.emplace(scan_node->id(), std::make_unique<MorselQueue>(std::move(morsels)));
     }
 
@@ -248,6 +273,11 @@ Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParam
     Drivers drivers;
     const auto& pipelines = _fragment_ctx->pipelines();
     const size_t num_pipelines = pipelines.size();
+    size_t num_drivers = 0;
+    for (const auto& pipeline : pipelines) {
+        num_drivers += pipeline->source_operator_factory()->degree_of_parallelism();
+    }
+    drivers.reserve(num_drivers);
     size_t driver_id = 0;
     for (auto n = 0; n < num_pipelines; ++n) {
         const auto& pipeline = pipelines[n];
@@ -47,8 +47,7 @@ bool HashJoinProbeOperator::is_finished() const {
 }
 
 Status HashJoinProbeOperator::push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) {
-    _join_prober->push_chunk(state, std::move(const_cast<vectorized::ChunkPtr&>(chunk)));
-    return Status::OK();
+    return _join_prober->push_chunk(state, std::move(const_cast<vectorized::ChunkPtr&>(chunk)));
 }
 
 StatusOr<vectorized::ChunkPtr> HashJoinProbeOperator::pull_chunk(RuntimeState* state) {
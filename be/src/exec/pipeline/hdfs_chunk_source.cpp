@@ -11,6 +11,7 @@
 #include "exec/workgroup/work_group.h"
 #include "exprs/vectorized/runtime_filter.h"
 #include "gutil/map_util.h"
+#include "io/block_cache.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
 #include "storage/chunk_helper.h"
@@ -59,6 +60,8 @@ Status HdfsChunkSource::prepare(RuntimeState* state) {
     if (_lake_table == nullptr) {
         return Status::RuntimeError("Invalid table type. Only hive/iceberg/hudi table are supported");
     }
+    _use_block_cache = io::BlockCache::instance() != nullptr &&
+                       io::BlockCache::is_admitted(_lake_table->database(), _lake_table->name());
 
     RETURN_IF_ERROR(_init_conjunct_ctxs(state));
     _init_tuples_and_slots(state);
@@ -238,6 +241,7 @@ Status HdfsChunkSource::_init_scanner(RuntimeState* state) {
     scanner_params.scan_ranges = {&scan_range};
     scanner_params.env = _pool->add(env.release());
     scanner_params.path = native_file_path;
+    scanner_params.use_block_cache = _use_block_cache;
     scanner_params.tuple_desc = _tuple_desc;
     scanner_params.materialize_slots = _materialize_slots;
     scanner_params.materialize_index_in_chunk = _materialize_index_in_chunk;
@@ -273,7 +277,7 @@ Status HdfsChunkSource::_init_scanner(RuntimeState* state) {
 }
 
 void HdfsChunkSource::_init_chunk(ChunkPtr* chunk) {
-    *chunk = ChunkHelper::new_chunk(*_tuple_desc, _runtime_state->chunk_size());
+    *chunk = ChunkHelper::new_chunk_pooled(_tuple_desc->slots(), _runtime_state->chunk_size());
 }
 
 void HdfsChunkSource::close(RuntimeState* state) {
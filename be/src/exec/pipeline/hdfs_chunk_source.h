@@ -124,6 +124,8 @@ private:
 
     std::vector<std::string> _hive_column_names;
     const LakeTableDescriptor* _lake_table = nullptr;
+    // Whether the table is admitted into the block cache.
+    bool _use_block_cache = false;
 
     // ======================================
     // The following are profile metrics
@@ -0,0 +1,64 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+#include "column/chunk.h"
+#include "column/vectorized_fwd.h"
+#include "exec/pipeline/context_with_dependency.h"
+
+namespace starrocks::pipeline {
+
+// MergeJoinRightSinkOperator streams the sorted right chunks to MergeJoinLeftOperator through a bounded queue,
+// so the right input is never fully materialized.
+class MergeJoinContext final : public ContextWithDependency {
+public:
+    explicit MergeJoinContext(size_t max_buffered_chunks) : _max_buffered_chunks(max_buffered_chunks) {}
+
+    void close(RuntimeState* state) override {
+        std::lock_guard<std::mutex> l(_mutex);
+        _right_chunks.clear();
+    }
+
+    bool is_right_buffer_full() const {
+        std::lock_guard<std::mutex> l(_mutex);
+        return _right_chunks.size() >= _max_buffered_chunks;
+    }
+
+    void push_right_chunk(const vectorized::ChunkPtr& chunk) {
+        std::lock_guard<std::mutex> l(_mutex);
+        _right_chunks.emplace_back(chunk);
+    }
+
+    bool has_right_chunk() const {
+        std::lock_guard<std::mutex> l(_mutex);
+        return !_right_chunks.empty();
+    }
+
+    vectorized::ChunkPtr pop_right_chunk() {
+        std::lock_guard<std::mutex> l(_mutex);
+        if (_right_chunks.empty()) {
+            return nullptr;
+        }
+        auto chunk = std::move(_right_chunks.front());
+        _right_chunks.pop_front();
+        return chunk;
+    }
+
+    void set_right_finished() { _is_right_finished.store(true, std::memory_order_release); }
+
+    // All the right chunks have been pushed, once it returns true.
+    bool is_right_finished() const { return _is_right_finished.load(std::memory_order_acquire); }
+
+private:
+    const size_t _max_buffered_chunks;
+
+    mutable std::mutex _mutex;
+    std::deque<vectorized::ChunkPtr> _right_chunks;
+    std::atomic<bool> _is_right_finished = false;
+};
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,64 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/mergejoin/merge_join_left_operator.h"
+
+#include "column/chunk.h"
+#include "exec/exec_node.h"
+#include "exprs/expr.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+StatusOr<vectorized::ChunkPtr> MergeJoinLeftOperator::pull_chunk(RuntimeState* state) {
+    if (_joiner.need_right()) {
+        // Read the finished flag before popping, so no right chunk is missed when the right sink is finished
+        // in between.
+        bool is_right_finished = _merge_join_context->is_right_finished();
+        vectorized::ChunkPtr right_chunk = _merge_join_context->pop_right_chunk();
+        if (right_chunk != nullptr) {
+            RETURN_IF_ERROR(_joiner.push_right(state, right_chunk));
+        } else if (is_right_finished) {
+            _joiner.set_right_eos();
+        } else {
+            return nullptr;
+        }
+    }
+
+    vectorized::ChunkPtr chunk = nullptr;
+    RETURN_IF_ERROR(_joiner.pull(state, &chunk));
+    if (chunk != nullptr && !chunk->is_empty()) {
+        RETURN_IF_ERROR(ExecNode::eval_conjuncts(_other_join_conjunct_ctxs, chunk.get()));
+        RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, chunk.get()));
+    }
+    return chunk;
+}
+
+Status MergeJoinLeftOperator::push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) {
+    return _joiner.push_left(state, chunk);
+}
+
+Status MergeJoinLeftOperatorFactory::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(OperatorFactory::prepare(state));
+
+    RETURN_IF_ERROR(Expr::prepare(_left_expr_ctxs, state));
+    RETURN_IF_ERROR(Expr::prepare(_right_expr_ctxs, state));
+    RETURN_IF_ERROR(Expr::prepare(_other_join_conjunct_ctxs, state));
+    RETURN_IF_ERROR(Expr::prepare(_conjunct_ctxs, state));
+    RETURN_IF_ERROR(Expr::open(_left_expr_ctxs, state));
+    RETURN_IF_ERROR(Expr::open(_right_expr_ctxs, state));
+    RETURN_IF_ERROR(Expr::open(_other_join_conjunct_ctxs, state));
+    RETURN_IF_ERROR(Expr::open(_conjunct_ctxs, state));
+
+    return Status::OK();
+}
+
+void MergeJoinLeftOperatorFactory::close(RuntimeState* state) {
+    Expr::close(_conjunct_ctxs, state);
+    Expr::close(_other_join_conjunct_ctxs, state);
+    Expr::close(_right_expr_ctxs, state);
+    Expr::close(_left_expr_ctxs, state);
+
+    OperatorFactory::close(state);
+}
+
+} // namespace starrocks::pipeline
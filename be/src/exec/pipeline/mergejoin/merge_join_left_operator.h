@@ -0,0 +1,119 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include "column/vectorized_fwd.h"
+#include "exec/pipeline/mergejoin/merge_join_context.h"
+#include "exec/pipeline/operator.h"
+#include "exec/vectorized/merge_joiner.h"
+#include "runtime/descriptors.h"
+
+namespace starrocks {
+class ExprContext;
+
+namespace pipeline {
+
+// MergeJoinLeftOperator joins the sorted left chunks pushed to it with the sorted right chunks
+// streamed by MergeJoinRightSinkOperator. Unlike the hash join, it doesn't wait for the right side
+// to be finished, and is blocked only when the current left row needs more right rows.
+class MergeJoinLeftOperator final : public Operator {
+public:
+    MergeJoinLeftOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, TJoinOp::type join_op,
+                          const std::vector<ExprContext*>& left_expr_ctxs,
+                          const std::vector<ExprContext*>& right_expr_ctxs,
+                          const std::vector<ExprContext*>& other_join_conjunct_ctxs,
+                          const std::vector<ExprContext*>& conjunct_ctxs, const RowDescriptor& left_row_desc,
+                          const RowDescriptor& right_row_desc,
+                          const std::shared_ptr<MergeJoinContext>& merge_join_context)
+            : Operator(factory, id, "merge_join_left", plan_node_id),
+              _joiner(join_op, left_expr_ctxs, right_expr_ctxs, left_row_desc, right_row_desc),
+              _other_join_conjunct_ctxs(other_join_conjunct_ctxs),
+              _conjunct_ctxs(conjunct_ctxs),
+              _merge_join_context(merge_join_context) {
+        _merge_join_context->ref();
+    }
+
+    ~MergeJoinLeftOperator() override = default;
+
+    void close(RuntimeState* state) override {
+        _merge_join_context->unref(state);
+        Operator::close(state);
+    }
+
+    bool has_output() const override {
+        if (_joiner.need_left() || _joiner.is_finished()) {
+            return false;
+        }
+        return !_joiner.need_right() || _merge_join_context->has_right_chunk() ||
+               _merge_join_context->is_right_finished();
+    }
+
+    bool need_input() const override { return _joiner.need_left(); }
+
+    bool is_finished() const override { return _joiner.is_finished(); }
+
+    Status set_finishing(RuntimeState* state) override {
+        _joiner.set_left_eos();
+        return Status::OK();
+    }
+
+    Status set_finished(RuntimeState* state) override { return _merge_join_context->set_finished(); }
+
+    StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override;
+
+    Status push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) override;
+
+private:
+    vectorized::MergeJoiner _joiner;
+
+    const std::vector<ExprContext*>& _other_join_conjunct_ctxs;
+    const std::vector<ExprContext*>& _conjunct_ctxs;
+
+    const std::shared_ptr<MergeJoinContext>& _merge_join_context;
+};
+
+class MergeJoinLeftOperatorFactory final : public OperatorFactory {
+public:
+    MergeJoinLeftOperatorFactory(int32_t id, int32_t plan_node_id, TJoinOp::type join_op,
+                                 const RowDescriptor& left_row_desc, const RowDescriptor& right_row_desc,
+                                 std::vector<ExprContext*>&& left_expr_ctxs,
+                                 std::vector<ExprContext*>&& right_expr_ctxs,
+                                 std::vector<ExprContext*>&& other_join_conjunct_ctxs,
+                                 std::vector<ExprContext*>&& conjunct_ctxs,
+                                 std::shared_ptr<MergeJoinContext>&& merge_join_context)
+            : OperatorFactory(id, "merge_join_left", plan_node_id),
+              _join_op(join_op),
+              _left_row_desc(left_row_desc),
+              _right_row_desc(right_row_desc),
+              _left_expr_ctxs(std::move(left_expr_ctxs)),
+              _right_expr_ctxs(std::move(right_expr_ctxs)),
+              _other_join_conjunct_ctxs(std::move(other_join_conjunct_ctxs)),
+              _conjunct_ctxs(std::move(conjunct_ctxs)),
+              _merge_join_context(std::move(merge_join_context)) {}
+
+    ~MergeJoinLeftOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<MergeJoinLeftOperator>(this, _id, _plan_node_id, _join_op, _left_expr_ctxs,
+                                                       _right_expr_ctxs, _other_join_conjunct_ctxs, _conjunct_ctxs,
+                                                       _left_row_desc, _right_row_desc, _merge_join_context);
+    }
+
+    Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
+
+private:
+    const TJoinOp::type _join_op;
+    const RowDescriptor& _left_row_desc;
+    const RowDescriptor& _right_row_desc;
+
+    std::vector<ExprContext*> _left_expr_ctxs;
+    std::vector<ExprContext*> _right_expr_ctxs;
+    std::vector<ExprContext*> _other_join_conjunct_ctxs;
+    std::vector<ExprContext*> _conjunct_ctxs;
+
+    std::shared_ptr<MergeJoinContext> _merge_join_context;
+};
+
+} // namespace pipeline
+} // namespace starrocks
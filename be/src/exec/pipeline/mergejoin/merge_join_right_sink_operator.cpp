@@ -0,0 +1,20 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/mergejoin/merge_join_right_sink_operator.h"
+
+#include "column/chunk.h"
+
+namespace starrocks::pipeline {
+
+StatusOr<vectorized::ChunkPtr> MergeJoinRightSinkOperator::pull_chunk(RuntimeState* state) {
+    CHECK(false) << "Shouldn't pull chunk from result sink operator";
+}
+
+Status MergeJoinRightSinkOperator::push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) {
+    if (chunk != nullptr && chunk->num_rows() > 0) {
+        _merge_join_context->push_right_chunk(chunk);
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks::pipeline
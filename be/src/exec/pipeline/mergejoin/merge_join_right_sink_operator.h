@@ -0,0 +1,68 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <utility>
+
+#include "column/vectorized_fwd.h"
+#include "exec/pipeline/mergejoin/merge_join_context.h"
+#include "exec/pipeline/operator.h"
+
+namespace starrocks::pipeline {
+
+class MergeJoinRightSinkOperator final : public Operator {
+public:
+    MergeJoinRightSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id,
+                               const std::shared_ptr<MergeJoinContext>& merge_join_context)
+            : Operator(factory, id, "merge_join_right_sink", plan_node_id), _merge_join_context(merge_join_context) {
+        _merge_join_context->ref();
+    }
+
+    ~MergeJoinRightSinkOperator() override = default;
+
+    void close(RuntimeState* state) override {
+        _merge_join_context->unref(state);
+        Operator::close(state);
+    }
+
+    bool has_output() const override { return false; }
+
+    bool need_input() const override { return !is_finished() && !_merge_join_context->is_right_buffer_full(); }
+
+    bool is_finished() const override { return _is_finished || _merge_join_context->is_finished(); }
+
+    Status set_finishing(RuntimeState* state) override {
+        _is_finished = true;
+        // Used to notify merge_join_left_operator.
+        _merge_join_context->set_right_finished();
+        return Status::OK();
+    }
+
+    StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override;
+
+    Status push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) override;
+
+private:
+    bool _is_finished = false;
+
+    const std::shared_ptr<MergeJoinContext>& _merge_join_context;
+};
+
+class MergeJoinRightSinkOperatorFactory final : public OperatorFactory {
+public:
+    MergeJoinRightSinkOperatorFactory(int32_t id, int32_t plan_node_id,
+                                      std::shared_ptr<MergeJoinContext> merge_join_context)
+            : OperatorFactory(id, "merge_join_right_sink", plan_node_id),
+              _merge_join_context(std::move(merge_join_context)) {}
+
+    ~MergeJoinRightSinkOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
+        return std::make_shared<MergeJoinRightSinkOperator>(this, _id, _plan_node_id, _merge_join_context);
+    }
+
+private:
+    std::shared_ptr<MergeJoinContext> _merge_join_context;
+};
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,146 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/morsel.h"
+
+#include "common/config.h"
+#include "gutil/casts.h"
+#include "storage/rowset/beta_rowset.h"
+#include "storage/storage_engine.h"
+#include "storage/tablet.h"
+#include "storage/tablet_manager.h"
+#include "util/defer_op.h"
+
+namespace starrocks::pipeline {
+
+// Each driver is expected to get several morsels, so that the idle drivers could steal the morsels
+// left by the busy ones.
+static constexpr int64_t kSplitMorselsPerDriver = 4;
+
+static bool can_split_tablet(const Tablet& tablet, bool skip_aggregation) {
+    // Same as the condition of TabletReader to read the rows of all the segments without merging.
+    return skip_aggregation || tablet.keys_type() == DUP_KEYS || tablet.keys_type() == PRIMARY_KEYS;
+}
+
+static Status split_tablet_to_morsels(int32_t plan_node_id, const TScanRangeParams& scan_range,
+                                      const TabletSharedPtr& tablet, int64_t split_rows, Morsels* morsels) {
+    int64_t version = strtoul(scan_range.scan_range.internal_scan_range.version.c_str(), nullptr, 10);
+    auto rowsets = std::make_shared<std::vector<RowsetSharedPtr>>();
+    {
+        std::shared_lock l(tablet->get_header_lock());
+        RETURN_IF_ERROR(tablet->capture_consistent_rowsets(Version(0, version), rowsets.get()));
+    }
+    Rowset::acquire_readers(*rowsets);
+    DeferOp release_rowsets([&rowsets] { Rowset::release_readers(*rowsets); });
+
+    const size_t num_morsels_before = morsels->size();
+    auto rowid_range_option = std::make_shared<vectorized::RowidRangeOption>();
+    for (const auto& rowset : *rowsets) {
+        RETURN_IF_ERROR(rowset->load());
+        for (const auto& segment : down_cast<BetaRowset*>(rowset.get())->segments()) {
+            const rowid_t num_rows = segment->num_rows();
+            rowid_t begin = 0;
+            while (begin < num_rows) {
+                int64_t remain_rows = split_rows - rowid_range_option->num_rows();
+                rowid_t end = std::min<int64_t>(num_rows, begin + remain_rows);
+                rowid_range_option->add(rowset->rowset_id(), segment->id(), vectorized::SparseRange(begin, end));
+                begin = end;
+                if (rowid_range_option->num_rows() >= split_rows) {
+                    morsels->emplace_back(std::make_unique<SplitOlapScanMorsel>(plan_node_id, scan_range, rowsets,
+                                                                                std::move(rowid_range_option)));
+                    rowid_range_option = std::make_shared<vectorized::RowidRangeOption>();
+                }
+            }
+        }
+    }
+    if (rowid_range_option->num_segments() > 0) {
+        morsels->emplace_back(std::make_unique<SplitOlapScanMorsel>(plan_node_id, scan_range, rowsets,
+                                                                    std::move(rowid_range_option)));
+    }
+    if (morsels->size() == num_morsels_before) {
+        // All the segments are empty, just scan the tablet as a whole.
+        morsels->emplace_back(std::make_unique<ScanMorsel>(plan_node_id, scan_range));
+    }
+    return Status::OK();
+}
+
+StatusOr<Morsels> convert_olap_scan_range_to_morsels(const std::vector<TScanRangeParams>& scan_ranges,
+                                                     int32_t plan_node_id, bool skip_aggregation,
+                                                     size_t degree_of_parallelism) {
+    Morsels morsels;
+    if (!config::pipeline_enable_split_tablet_scan || degree_of_parallelism <= 1 ||
+        StorageEngine::instance() == nullptr) {
+        for (const auto& scan_range : scan_ranges) {
+            morsels.emplace_back(std::make_unique<ScanMorsel>(plan_node_id, scan_range));
+        }
+        return morsels;
+    }
+
+    std::vector<TabletSharedPtr> tablets(scan_ranges.size());
+    std::vector<int64_t> tablet_rows(scan_ranges.size(), 0);
+    int64_t total_rows = 0;
+    for (size_t i = 0; i < scan_ranges.size(); ++i) {
+        TTabletId tablet_id = scan_ranges[i].scan_range.internal_scan_range.tablet_id;
+        std::string err;
+        // The tablet not found is reported by the OlapScanOperator, which scans it as a whole.
+        tablets[i] = StorageEngine::instance()->tablet_manager()->get_tablet(tablet_id, true, &err);
+        if (tablets[i] != nullptr) {
+            tablet_rows[i] = tablets[i]->num_rows();
+            total_rows += tablet_rows[i];
+        }
+    }
+
+    const int64_t split_rows = std::max<int64_t>(config::pipeline_min_split_tablet_scan_rows,
+                                                 total_rows / (degree_of_parallelism * kSplitMorselsPerDriver));
+    for (size_t i = 0; i < scan_ranges.size(); ++i) {
+        // It isn't worth splitting a tablet into less than two morsels.
+        if (tablets[i] == nullptr || tablet_rows[i] < 2 * split_rows ||
+            !can_split_tablet(*tablets[i], skip_aggregation)) {
+            morsels.emplace_back(std::make_unique<ScanMorsel>(plan_node_id, scan_ranges[i]));
+            continue;
+        }
+        RETURN_IF_ERROR(split_tablet_to_morsels(plan_node_id, scan_ranges[i], tablets[i], split_rows, &morsels));
+    }
+    return morsels;
+}
+
+static bool can_split_hdfs_scan_range(const THdfsScanRange& scan_range) {
+    // The readers of the other formats don't select the data by the start offsets of the stripes or row groups.
+    return scan_range.__isset.file_format &&
+           (scan_range.file_format == THdfsFileFormat::ORC || scan_range.file_format == THdfsFileFormat::PARQUET);
+}
+
+Morsels convert_hdfs_scan_range_to_morsels(const std::vector<TScanRangeParams>& scan_ranges, int32_t plan_node_id,
+                                           size_t degree_of_parallelism) {
+    Morsels morsels;
+    if (!config::pipeline_enable_split_hdfs_scan_range || degree_of_parallelism <= 1) {
+        for (const auto& scan_range : scan_ranges) {
+            morsels.emplace_back(std::make_unique<ScanMorsel>(plan_node_id, scan_range));
+        }
+        return morsels;
+    }
+
+    int64_t total_bytes = 0;
+    for (const auto& scan_range : scan_ranges) {
+        total_bytes += scan_range.scan_range.hdfs_scan_range.length;
+    }
+    const int64_t split_size = std::max<int64_t>(config::pipeline_min_split_hdfs_scan_range_size,
+                                                 total_bytes / (degree_of_parallelism * kSplitMorselsPerDriver));
+    for (const auto& scan_range : scan_ranges) {
+        const THdfsScanRange& hdfs_scan_range = scan_range.scan_range.hdfs_scan_range;
+        // It isn't worth splitting a range into less than two morsels.
+        if (split_size <= 0 || hdfs_scan_range.length < 2 * split_size || !can_split_hdfs_scan_range(hdfs_scan_range)) {
+            morsels.emplace_back(std::make_unique<ScanMorsel>(plan_node_id, scan_range));
+            continue;
+        }
+        const int64_t end = hdfs_scan_range.offset + hdfs_scan_range.length;
+        for (int64_t offset = hdfs_scan_range.offset; offset < end; offset += split_size) {
+            TScanRangeParams split_scan_range = scan_range;
+            split_scan_range.scan_range.hdfs_scan_range.__set_offset(offset);
+            split_scan_range.scan_range.hdfs_scan_range.__set_length(std::min(split_size, end - offset));
+            morsels.emplace_back(std::make_unique<ScanMorsel>(plan_node_id, split_scan_range));
+        }
+    }
+    return morsels;
+}
+
+} // namespace starrocks::pipeline
@@ -2,12 +2,18 @@
 
 #pragma once
 
+#include <algorithm>
 #include <optional>
 
+#include "common/statusor.h"
 #include "gen_cpp/InternalService_types.h"
 #include "storage/olap_common.h"
+#include "storage/rowid_range_option.h"
 
 namespace starrocks {
+class Rowset;
+using RowsetSharedPtr = std::shared_ptr<Rowset>;
+
 namespace pipeline {
 class Morsel;
 using MorselPtr = std::unique_ptr<Morsel>;
@@ -26,11 +32,12 @@ private:
     int32_t _plan_node_id;
 };
 
-class ScanMorsel final : public Morsel {
+class ScanMorsel : public Morsel {
 public:
     ScanMorsel(int32_t plan_node_id, const TScanRangeParams& scan_range) : Morsel(plan_node_id) {
         _scan_range = std::make_unique<TScanRange>(scan_range.scan_range);
     }
+    ~ScanMorsel() override = default;
 
     TScanRange* get_scan_range() { return _scan_range.get(); }
 
@@ -42,6 +49,44 @@ private:
     std::unique_ptr<TScanRange> _scan_range;
 };
 
+// SplitOlapScanMorsel only scans a part of the rows of a tablet, which are selected by row ids of segments.
+// A big tablet is split into multiple SplitOlapScanMorsels, so it could be scanned by multiple drivers
+// in parallel.
+// All the SplitOlapScanMorsels of the same tablet share the rowsets captured when splitting, to ensure
+// that they read the same rowsets.
+class SplitOlapScanMorsel final : public ScanMorsel {
+public:
+    SplitOlapScanMorsel(int32_t plan_node_id, const TScanRangeParams& scan_range,
+                        std::shared_ptr<std::vector<RowsetSharedPtr>> rowsets,
+                        vectorized::RowidRangeOptionPtr rowid_range_option)
+            : ScanMorsel(plan_node_id, scan_range),
+              _rowsets(std::move(rowsets)),
+              _rowid_range_option(std::move(rowid_range_option)) {}
+
+    const std::vector<RowsetSharedPtr>& rowsets() const { return *_rowsets; }
+    const vectorized::RowidRangeOption* rowid_range_option() const { return _rowid_range_option.get(); }
+
+private:
+    std::shared_ptr<std::vector<RowsetSharedPtr>> _rowsets;
+    vectorized::RowidRangeOptionPtr _rowid_range_option;
+};
+
+// Convert the scan ranges of an OLAP scan node to morsels.
+// The big tablets are split into multiple SplitOlapScanMorsels by segments and row ids, so that a skewed
+// tablet doesn't make one driver scan much more rows than its peers. A tablet is split only if the rows
+// of different segments needn't be merged, that is, it's a DUP_KEYS or PRIMARY_KEYS tablet,
+// or |skip_aggregation| is true.
+StatusOr<Morsels> convert_olap_scan_range_to_morsels(const std::vector<TScanRangeParams>& scan_ranges,
+                                                     int32_t plan_node_id, bool skip_aggregation,
+                                                     size_t degree_of_parallelism);
+
+// Convert the scan ranges of an HDFS scan node to morsels.
+// The big ranges of the ORC and Parquet files are split into multiple ScanMorsels of smaller byte ranges, so that
+// a big file could be scanned by multiple drivers in parallel. The file readers only read the stripes and row
+// groups which start in the range, so every stripe or row group is read by exactly one morsel.
+Morsels convert_hdfs_scan_range_to_morsels(const std::vector<TScanRangeParams>& scan_ranges, int32_t plan_node_id,
+                                           size_t degree_of_parallelism);
+
 class MorselQueue {
 public:
     MorselQueue(Morsels&& morsels) : _morsels(std::move(morsels)), _num_morsels(_morsels.size()), _pop_index(0) {}
@@ -50,21 +95,31 @@ public:
 
     size_t num_morsels() const { return _num_morsels; }
 
+    // Take a morsel of this queue, or steal one from the sibling queues split from the same queue,
+    // if all the morsels of this queue have been taken.
     std::optional<MorselPtr> try_get() {
-        auto idx = _pop_index.load();
-        // prevent _num_morsels from superfluous addition
-        if (idx >= _num_morsels) {
-            return {};
+        auto morsel = _try_get_local();
+        if (morsel.has_value()) {
+            return morsel;
         }
-        idx = _pop_index.fetch_add(1);
-        if (idx < _num_morsels) {
-            return std::move(_morsels[idx]);
-        } else {
-            return {};
+        for (auto* sibling : _siblings) {
+            morsel = sibling->_try_get_local();
+            if (morsel.has_value()) {
+                _num_stolen_morsels++;
+                return morsel;
+            }
         }
+        return {};
     }
 
-    bool empty() const { return _pop_index >= _num_morsels; }
+    // Return true if there are no morsels left in this queue and the sibling queues.
+    bool empty() const {
+        return _local_empty() && std::all_of(_siblings.begin(), _siblings.end(),
+                                             [](const MorselQueue* sibling) { return sibling->_local_empty(); });
+    }
+
+    // The number of morsels stolen from the sibling queues.
+    size_t num_stolen_morsels() const { return _num_stolen_morsels; }
 
     // Split the morsel queue into `split_size` morsel queues.
     // For example:
@@ -74,6 +129,8 @@ public:
     //  [1, 4, 7]
     //  [2, 5]
     //  [3, 6]
+    // Each split queue takes the others as its siblings, so the idle drivers could steal the morsels
+    // left by the busy ones. All the split queues must be alive until none of them is used.
     std::vector<MorselQueuePtr> split_by_size(size_t split_size) {
         // split_size is in (0, split_size].
         DCHECK_GT(split_size, 0);
@@ -81,7 +138,7 @@ public:
 
         std::vector<Morsels> split_morsels_list(split_size);
         for (int i = 0; i < _num_morsels; ++i) {
-            auto maybe_morsel = try_get();
+            auto maybe_morsel = _try_get_local();
             DCHECK(maybe_morsel.has_value());
             split_morsels_list[i % split_size].emplace_back(std::move(maybe_morsel.value()));
         }
@@ -91,14 +148,39 @@ public:
         for (auto& split_morsels : split_morsels_list) {
             split_morsel_queues.emplace_back(std::make_unique<MorselQueue>(std::move(split_morsels)));
         }
+        // The i-th queue steals from the (i+1)-th queue first, to spread the thieves over the queues.
+        for (size_t i = 0; i < split_size; ++i) {
+            for (size_t j = 1; j < split_size; ++j) {
+                split_morsel_queues[i]->_siblings.emplace_back(split_morsel_queues[(i + j) % split_size].get());
+            }
+        }
 
         return split_morsel_queues;
     }
 
 private:
+    std::optional<MorselPtr> _try_get_local() {
+        auto idx = _pop_index.load();
+        // prevent _num_morsels from superfluous addition
+        if (idx >= _num_morsels) {
+            return {};
+        }
+        idx = _pop_index.fetch_add(1);
+        if (idx < _num_morsels) {
+            return std::move(_morsels[idx]);
+        } else {
+            return {};
+        }
+    }
+
+    bool _local_empty() const { return _pop_index >= _num_morsels; }
+
     Morsels _morsels;
     const size_t _num_morsels;
     std::atomic<size_t> _pop_index;
+
+    std::vector<MorselQueue*> _siblings;
+    std::atomic<size_t> _num_stolen_morsels = 0;
 };
 
 } // namespace pipeline
@@ -3,6 +3,7 @@
 #include "exec/pipeline/olap_chunk_source.h"
 
 #include "column/column_helper.h"
+#include "column/column_pool.h"
 #include "common/constexpr.h"
 #include "exec/pipeline/scan_operator.h"
 #include "exec/vectorized/olap_scan_node.h"
@@ -16,18 +17,23 @@
 #include "runtime/primitive_type.h"
 #include "storage/chunk_helper.h"
 #include "storage/column_predicate_rewriter.h"
+#include "storage/page_cache.h"
 #include "storage/predicate_parser.h"
 #include "storage/projection_iterator.h"
+#include "storage/rowset/beta_rowset.h"
+#include "storage/rowset/column_reader.h"
+#include "storage/rowset/segment.h"
 #include "storage/storage_engine.h"
 
 namespace starrocks::pipeline {
 using namespace vectorized;
 
 OlapChunkSource::OlapChunkSource(RuntimeProfile* runtime_profile, MorselPtr&& morsel, ScanOperator* op,
-                                 vectorized::OlapScanNode* scan_node)
+                                 vectorized::OlapScanNode* scan_node, std::atomic<int64_t>* remaining_limit)
         : ChunkSource(runtime_profile, std::move(morsel)),
           _scan_node(scan_node),
           _limit(scan_node->limit()),
+          _remaining_limit(remaining_limit),
           _runtime_in_filters(op->runtime_in_filters()),
           _runtime_bloom_filters(op->runtime_bloom_filters()) {
     _conjunct_ctxs = scan_node->conjunct_ctxs();
@@ -100,6 +106,8 @@ void OlapChunkSource::_init_counter(RuntimeState* state) {
     _bi_filter_timer = ADD_CHILD_TIMER(_runtime_profile, "BitmapIndexFilter", "SegmentInit");
     _bi_filtered_counter = ADD_CHILD_COUNTER(_runtime_profile, "BitmapIndexFilterRows", TUnit::UNIT, "SegmentInit");
     _bf_filtered_counter = ADD_CHILD_COUNTER(_runtime_profile, "BloomFilterFilterRows", TUnit::UNIT, "SegmentInit");
+    _ngram_index_filtered_counter =
+            ADD_CHILD_COUNTER(_runtime_profile, "NGramIndexFilterRows", TUnit::UNIT, "SegmentInit");
     _seg_zm_filtered_counter =
             ADD_CHILD_COUNTER(_runtime_profile, "SegmentZoneMapFilterRows", TUnit::UNIT, "SegmentInit");
     _zm_filtered_counter = ADD_CHILD_COUNTER(_runtime_profile, "ZoneMapIndexFilterRows", TUnit::UNIT, "SegmentInit");
@@ -121,6 +129,8 @@ void OlapChunkSource::_init_counter(RuntimeState* state) {
     _segments_read_count = ADD_CHILD_COUNTER(_runtime_profile, "SegmentsReadCount", TUnit::UNIT, "SegmentRead");
     _total_columns_data_page_count =
             ADD_CHILD_COUNTER(_runtime_profile, "TotalColumnsDataPageCount", TUnit::UNIT, "SegmentRead");
+    _readahead_pages_counter = ADD_CHILD_COUNTER(_runtime_profile, "ReadaheadPages", TUnit::UNIT, "SegmentRead");
+    _readahead_bytes_counter = ADD_CHILD_COUNTER(_runtime_profile, "ReadaheadBytes", TUnit::BYTES, "SegmentRead");
 
     // IOTime
     _io_timer = ADD_TIMER(_runtime_profile, "IOTime");
@@ -178,6 +188,37 @@ void OlapChunkSource::_decide_chunk_size() {
     }
 }
 
+Status OlapChunkSource::_limit_chunk_bytes(const std::vector<uint32_t>& reader_columns) {
+    const int64_t max_chunk_bytes = config::olap_scan_max_chunk_bytes;
+    if (max_chunk_bytes <= 0) {
+        return Status::OK();
+    }
+    int64_t num_rows = 0;
+    int64_t mem_footprint = 0;
+    for (const auto& rowset : _reader->rowsets()) {
+        auto* beta_rowset = dynamic_cast<BetaRowset*>(rowset.get());
+        if (beta_rowset == nullptr) {
+            continue;
+        }
+        num_rows += rowset->num_rows();
+        for (const auto& segment : beta_rowset->segments()) {
+            for (uint32_t cid : reader_columns) {
+                ASSIGN_OR_RETURN(auto* column_reader, segment->column(cid));
+                if (column_reader != nullptr) {
+                    mem_footprint += column_reader->total_mem_footprint();
+                }
+            }
+        }
+    }
+    if (num_rows == 0) {
+        return Status::OK();
+    }
+    const int64_t avg_row_bytes = std::max<int64_t>(1, mem_footprint / num_rows);
+    const int64_t max_chunk_size = std::max<int64_t>(1, max_chunk_bytes / avg_row_bytes);
+    _params.chunk_size = static_cast<int>(std::min<int64_t>(_params.chunk_size, max_chunk_size));
+    return Status::OK();
+}
+
 Status OlapChunkSource::_init_reader_params(const std::vector<OlapScanRange*>& key_ranges,
                                             const std::vector<uint32_t>& scanner_columns,
                                             std::vector<uint32_t>& reader_columns) {
@@ -189,7 +230,17 @@ Status OlapChunkSource::_init_reader_params(const std::vector<OlapScanRange*>& k
     _params.profile = _runtime_profile;
     _params.runtime_state = _runtime_state;
     _params.use_page_cache = !config::disable_storage_page_cache;
+    if (_params.use_page_cache && StoragePageCache::instance() != nullptr) {
+        _params.fill_page_cache = !StoragePageCache::instance()->is_large_scan(_tablet->tablet_footprint());
+    }
+    const TQueryOptions& query_options = _runtime_state->query_options();
+    if (query_options.__isset.segment_readahead_bytes) {
+        _params.readahead_bytes = query_options.segment_readahead_bytes;
+    } else {
+        _params.readahead_bytes = config::segment_readahead_bytes;
+    }
     _decide_chunk_size();
+    _params.runtime_range_pruner = &_runtime_range_pruner;
 
     PredicateParser parser(_tablet->tablet_schema());
     std::vector<PredicatePtr> preds;
@@ -295,7 +346,14 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     const TabletSchema& tablet_schema = _tablet->tablet_schema();
     starrocks::vectorized::Schema child_schema =
             ChunkHelper::convert_schema_to_format_v2(tablet_schema, reader_columns);
-    _reader = std::make_shared<TabletReader>(_tablet, Version(0, _version), std::move(child_schema));
+    if (auto* split_morsel = dynamic_cast<SplitOlapScanMorsel*>(_morsel.get()); split_morsel != nullptr) {
+        // Read the rowsets captured when splitting the tablet, which the row ids of the morsel refer to.
+        _reader = std::make_shared<TabletReader>(_tablet, Version(0, _version), std::move(child_schema),
+                                                 split_morsel->rowsets());
+        _params.rowid_range_option = split_morsel->rowid_range_option();
+    } else {
+        _reader = std::make_shared<TabletReader>(_tablet, Version(0, _version), std::move(child_schema));
+    }
     if (reader_columns.size() == scanner_columns.size()) {
         _prj_iter = _reader;
     } else {
@@ -313,6 +371,8 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
     RETURN_IF_ERROR(_prj_iter->init_output_schema(*_params.unused_output_column_ids));
 
     RETURN_IF_ERROR(_reader->prepare());
+    RETURN_IF_ERROR(_limit_chunk_bytes(reader_columns));
+    _runtime_profile->add_info_string("ChunkSize", std::to_string(_params.chunk_size));
     RETURN_IF_ERROR(_reader->open(_params));
     return Status::OK();
 }
@@ -429,8 +489,13 @@ Status OlapChunkSource::_read_chunk_from_storage(RuntimeState* state, vectorized
     if (state->is_cancelled()) {
         return Status::Cancelled("canceled state");
     }
+    // The other chunk sources may have read enough rows for the limit.
+    if (_limit != -1 && _remaining_limit->load(std::memory_order_relaxed) <= 0) {
+        return Status::EndOfFile("limit reach");
+    }
     SCOPED_TIMER(_scan_timer);
     do {
+        RETURN_IF_ERROR(_update_runtime_range_pruner());
         if (Status status = _prj_iter->get_next(chunk); !status.ok()) {
             return status;
         }
@@ -459,18 +524,65 @@ Status OlapChunkSource::_read_chunk_from_storage(RuntimeState* state, vectorized
     } while (chunk->num_rows() == 0);
     _update_realtime_counter(chunk);
     // Improve for select * from table limit x, x is small
-    if (_limit != -1 && _num_rows_read >= _limit) {
-        return Status::EndOfFile("limit reach");
+    if (_limit != -1) {
+        const auto num_rows = static_cast<int64_t>(chunk->num_rows());
+        if (_remaining_limit->fetch_sub(num_rows, std::memory_order_relaxed) <= num_rows) {
+            return Status::EndOfFile("limit reach");
+        }
+    }
+    return Status::OK();
+}
+
+Status OlapChunkSource::_update_runtime_range_pruner() {
+    std::vector<TCondition> conditions;
+    if (_conjuncts_manager.has_pending_runtime_filters()) {
+        _conjuncts_manager.get_late_runtime_filter_conditions(&conditions);
+    }
+    _get_topn_runtime_filter_condition(&conditions);
+    if (conditions.empty()) {
+        return Status::OK();
+    }
+    PredicateParser parser(_tablet->tablet_schema());
+    for (const auto& condition : conditions) {
+        PredicatePtr p(parser.parse_thrift_cond(condition));
+        RETURN_IF(!p, Status::RuntimeError("invalid filter"));
+        p->set_index_filter_only(true);
+        _runtime_range_pruner.add_predicate(p->column_id(), p.get());
+        _predicate_free_pool.emplace_back(std::move(p));
     }
     return Status::OK();
 }
 
+void OlapChunkSource::_get_topn_runtime_filter_condition(std::vector<TCondition>* conditions) {
+    const auto* topn_filter = _scan_node->topn_runtime_filter();
+    if (topn_filter == nullptr || topn_filter->version() == _topn_filter_version) {
+        return;
+    }
+    const SlotDescriptor* slot = nullptr;
+    for (const auto* s : *_slots) {
+        if (s->id() == topn_filter->slot_id()) {
+            slot = s;
+            break;
+        }
+    }
+    // The dict encoded column is ordered by the codes, which are not the order of the strings.
+    bool is_dict_column = _runtime_state->get_query_global_dict_map().count(topn_filter->slot_id()) > 0;
+    TCondition condition;
+    if (slot != nullptr && !is_dict_column && topn_filter->get_condition(slot, &condition, &_topn_filter_version)) {
+        conditions->emplace_back(std::move(condition));
+    } else {
+        _topn_filter_version = topn_filter->version();
+    }
+}
+
 void OlapChunkSource::close(RuntimeState* state) {
     _update_counter();
     _prj_iter->close();
     _reader.reset();
     _predicate_free_pool.clear();
     _dict_optimize_parser.close(state);
+    // Reduce the memory usage if the the average string size is greater than 512.
+    vectorized::release_large_columns<vectorized::BinaryColumn>(state->chunk_size() * 512);
 }
 
 int64_t OlapChunkSource::last_spent_cpu_time_ns() {
@@ -488,6 +600,9 @@ int64_t OlapChunkSource::last_scan_rows_num() {
 }
 
 void OlapChunkSource::_update_realtime_counter(vectorized::Chunk* chunk) {
+    if (auto* query_ctx = _runtime_state->query_ctx(); query_ctx != nullptr) {
+        query_ctx->incr_scan_usage(_reader->stats().raw_rows_read, _reader->stats().compressed_bytes_read);
+    }
     COUNTER_UPDATE(_read_compressed_counter, _reader->stats().compressed_bytes_read);
     _compressed_bytes_read += _reader->stats().compressed_bytes_read;
     _reader->mutable_stats()->compressed_bytes_read = 0;
@@ -501,6 +616,9 @@ void OlapChunkSource::_update_realtime_counter(vectorized::Chunk* chunk) {
 }
 
 void OlapChunkSource::_update_counter() {
+    if (auto* query_ctx = _runtime_state->query_ctx(); query_ctx != nullptr) {
+        query_ctx->incr_scan_usage(_reader->stats().raw_rows_read, _reader->stats().compressed_bytes_read);
+    }
     COUNTER_UPDATE(_create_seg_iter_timer, _reader->stats().create_segment_iter_ns);
     COUNTER_UPDATE(_rows_read_counter, _num_rows_read);
 
@@ -510,6 +628,8 @@ void OlapChunkSource::_update_counter() {
     COUNTER_UPDATE(_decompress_timer, _reader->stats().decompress_ns);
     COUNTER_UPDATE(_read_uncompressed_counter, _reader->stats().uncompressed_bytes_read);
     COUNTER_UPDATE(_bytes_read_counter, _reader->stats().bytes_read);
+    COUNTER_UPDATE(_readahead_pages_counter, _reader->stats().readahead_pages);
+    COUNTER_UPDATE(_readahead_bytes_counter, _reader->stats().readahead_bytes);
 
     COUNTER_UPDATE(_block_load_timer, _reader->stats().block_load_ns);
     COUNTER_UPDATE(_block_load_counter, _reader->stats().blocks_load);
@@ -537,6 +657,7 @@ void OlapChunkSource::_update_counter() {
     COUNTER_UPDATE(_seg_zm_filtered_counter, _reader->stats().segment_stats_filtered);
     COUNTER_UPDATE(_zm_filtered_counter, _reader->stats().rows_stats_filtered);
     COUNTER_UPDATE(_bf_filtered_counter, _reader->stats().rows_bf_filtered);
+    COUNTER_UPDATE(_ngram_index_filtered_counter, _reader->stats().rows_ngram_index_filtered);
     COUNTER_UPDATE(_sk_filtered_counter, _reader->stats().rows_key_range_filtered);
     COUNTER_UPDATE(_index_load_timer, _reader->stats().index_load_ns);
 
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <utility>
 
 #include "exec/olap_common.h"
@@ -14,6 +15,7 @@
 #include "gen_cpp/InternalService_types.h"
 #include "runtime/runtime_state.h"
 #include "storage/conjunctive_predicates.h"
+#include "storage/runtime_range_pruner.h"
 #include "storage/tablet.h"
 #include "storage/tablet_reader.h"
 
@@ -31,7 +33,7 @@ class ScanOperator;
 class OlapChunkSource final : public ChunkSource {
 public:
     OlapChunkSource(RuntimeProfile* runtime_profile, MorselPtr&& morsel, ScanOperator* op,
-                    vectorized::OlapScanNode* scan_node);
+                    vectorized::OlapScanNode* scan_node, std::atomic<int64_t>* remaining_limit);
 
     ~OlapChunkSource() override = default;
 
@@ -72,14 +74,24 @@ private:
     Status _init_global_dicts(vectorized::TabletReaderParams* params);
     Status _build_scan_range(RuntimeState* state);
     Status _read_chunk_from_storage([[maybe_unused]] RuntimeState* state, vectorized::Chunk* chunk);
+    // Add the min/max predicates of the runtime filters arrived after the reader is opened to
+    // |_runtime_range_pruner|, with which the segment iterators prune the pages not read yet.
+    Status _update_runtime_range_pruner();
+    // Get the condition of the boundary of the top-n sort above, if it's tightened since the last call.
+    void _get_topn_runtime_filter_condition(std::vector<TCondition>* conditions);
     void _update_counter();
     void _update_realtime_counter(vectorized::Chunk* chunk);
     void _decide_chunk_size();
+    // Reduce the chunk size if a chunk of the |reader_columns| exceeds config::olap_scan_max_chunk_bytes,
+    // by the average width of the columns in the rowsets to read. Must be called after _reader->prepare().
+    Status _limit_chunk_bytes(const std::vector<uint32_t>& reader_columns);
 
     vectorized::TabletReaderParams _params = {};
 
     vectorized::OlapScanNode* _scan_node;
     const int64_t _limit; // -1: no limit
+    // The rows still needed by |_limit|, shared with the chunk sources of the other parallel operators.
+    std::atomic<int64_t>* _remaining_limit;
     std::vector<ExprContext*> _conjunct_ctxs;
     const std::vector<ExprContext*>& _runtime_in_filters;
     const vectorized::RuntimeFilterProbeCollector* _runtime_bloom_filters;
@@ -112,6 +124,9 @@ private:
     // For release memory.
     using PredicatePtr = std::unique_ptr<vectorized::ColumnPredicate>;
     std::vector<PredicatePtr> _predicate_free_pool;
+    vectorized::RuntimeRangePruner _runtime_range_pruner;
+    // The version of the top-n runtime filter applied to |_runtime_range_pruner|.
+    size_t _topn_filter_version = 0;
 
     // slot descriptors for each one of |output_columns|.
     std::vector<SlotDescriptor*> _query_slots;
@@ -132,6 +147,8 @@ private:
     RuntimeProfile::Counter* _tablet_counter = nullptr;
     RuntimeProfile::Counter* _reader_init_timer = nullptr;
     RuntimeProfile::Counter* _io_timer = nullptr;
+    RuntimeProfile::Counter* _readahead_pages_counter = nullptr;
+    RuntimeProfile::Counter* _readahead_bytes_counter = nullptr;
     RuntimeProfile::Counter* _read_compressed_counter = nullptr;
     RuntimeProfile::Counter* _decompress_timer = nullptr;
     RuntimeProfile::Counter* _read_uncompressed_counter = nullptr;
@@ -143,6 +160,7 @@ private:
     RuntimeProfile::Counter* _seg_init_timer = nullptr;
     RuntimeProfile::Counter* _zm_filtered_counter = nullptr;
     RuntimeProfile::Counter* _bf_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _ngram_index_filtered_counter = nullptr;
     RuntimeProfile::Counter* _seg_zm_filtered_counter = nullptr;
     RuntimeProfile::Counter* _sk_filtered_counter = nullptr;
     RuntimeProfile::Counter* _block_seek_timer = nullptr;
@@ -18,7 +18,7 @@ namespace starrocks::pipeline {
 // ==================== OlapScanOperatorFactory ====================
 
 OlapScanOperatorFactory::OlapScanOperatorFactory(int32_t id, ScanNode* scan_node)
-        : ScanOperatorFactory(id, scan_node) {}
+        : ScanOperatorFactory(id, scan_node), _remaining_limit(scan_node->limit()) {}
 
 Status OlapScanOperatorFactory::do_prepare(RuntimeState* state) {
     const auto& conjunct_ctxs = _scan_node->conjunct_ctxs();
@@ -33,13 +33,14 @@ Status OlapScanOperatorFactory::do_prepare(RuntimeState* state) {
 void OlapScanOperatorFactory::do_close(RuntimeState*) {}
 
 OperatorPtr OlapScanOperatorFactory::do_create(int32_t dop, int32_t driver_sequence) {
-    return std::make_shared<OlapScanOperator>(this, _id, _scan_node);
+    return std::make_shared<OlapScanOperator>(this, _id, _scan_node, &_remaining_limit);
 }
 
 // ==================== OlapScanOperator ====================
 
-OlapScanOperator::OlapScanOperator(OperatorFactory* factory, int32_t id, ScanNode* scan_node)
-        : ScanOperator(factory, id, scan_node) {}
+OlapScanOperator::OlapScanOperator(OperatorFactory* factory, int32_t id, ScanNode* scan_node,
+                                   std::atomic<int64_t>* remaining_limit)
+        : ScanOperator(factory, id, scan_node), _remaining_limit(remaining_limit) {}
 
 Status OlapScanOperator::do_prepare(RuntimeState*) {
     RETURN_IF_ERROR(_capture_tablet_rowsets());
@@ -53,6 +54,10 @@ Status OlapScanOperator::_capture_tablet_rowsets() {
     _tablet_rowsets.resize(morsels.size());
     for (int i = 0; i < morsels.size(); ++i) {
         ScanMorsel* scan_morsel = (ScanMorsel*)morsels[i].get();
+        // The rowsets of a split morsel have been captured when splitting the tablet.
+        if (dynamic_cast<SplitOlapScanMorsel*>(scan_morsel) != nullptr) {
+            continue;
+        }
         auto* scan_range = scan_morsel->get_olap_scan_range();
 
         // Get version.
@@ -84,7 +89,11 @@ Status OlapScanOperator::_capture_tablet_rowsets() {
 ChunkSourcePtr OlapScanOperator::create_chunk_source(MorselPtr morsel, int32_t chunk_source_index) {
     vectorized::OlapScanNode* olap_scan_node = down_cast<vectorized::OlapScanNode*>(_scan_node);
     return std::make_shared<OlapChunkSource>(_chunk_source_profiles[chunk_source_index].get(), std::move(morsel), this,
-                                             olap_scan_node);
+                                             olap_scan_node, _remaining_limit);
+}
+
+bool OlapScanOperator::is_limit_reached() const {
+    return _scan_node->limit() != -1 && _remaining_limit->load(std::memory_order_relaxed) <= 0;
 }
 
 } // namespace starrocks::pipeline
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "exec/pipeline/pipeline_builder.h"
 #include "exec/pipeline/scan_operator.h"
 
@@ -24,17 +26,24 @@ public:
     Status do_prepare(RuntimeState* state) override;
     void do_close(RuntimeState* state) override;
     OperatorPtr do_create(int32_t dop, int32_t driver_sequence) override;
+
+private:
+    // The number of rows still needed by the limit of the scan node, shared by the chunk sources of all the
+    // parallel operators, so that all of them stop reading once enough rows are read. -1 means no limit.
+    std::atomic<int64_t> _remaining_limit;
 };
 
 class OlapScanOperator final : public ScanOperator {
 public:
-    OlapScanOperator(OperatorFactory* factory, int32_t id, ScanNode* scan_node);
+    OlapScanOperator(OperatorFactory* factory, int32_t id, ScanNode* scan_node,
+                     std::atomic<int64_t>* remaining_limit);
 
     ~OlapScanOperator() override = default;
 
     Status do_prepare(RuntimeState* state) override;
     void do_close(RuntimeState* state) override;
     ChunkSourcePtr create_chunk_source(MorselPtr morsel, int32_t chunk_source_index) override;
+    bool is_limit_reached() const override;
 
 private:
     Status _capture_tablet_rowsets();
@@ -44,6 +53,8 @@ private:
     // of the left table are compacted at building the right hash table. Therefore, reference
     // the row sets into _tablet_rowsets in the preparation phase to avoid the row sets being deleted.
     std::vector<std::vector<RowsetSharedPtr>> _tablet_rowsets;
+
+    std::atomic<int64_t>* _remaining_limit;
 };
 
 } // namespace starrocks::pipeline
@@ -10,8 +10,10 @@
 #include "exec/pipeline/pipeline_driver_executor.h"
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
+#include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "util/pretty_printer.h"
 
 namespace starrocks::pipeline {
 
@@ -23,6 +25,12 @@ PipelineDriver::~PipelineDriver() noexcept {
 
 Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     _runtime_state = runtime_state;
+    _span = Tracer::Instance().add_span("pipeline_driver", _fragment_ctx->span());
+    if (_span->IsRecording()) {
+        _span->SetAttribute("driver_id", _driver_id);
+        _span->SetAttribute("source", source_operator()->get_name());
+        _span->SetAttribute("sink", sink_operator()->get_name());
+    }
 
     // TotalTime is reserved name
     _total_timer = ADD_TIMER(_runtime_profile, "DriverTotalTime");
@@ -35,6 +43,11 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     _first_input_empty_timer = ADD_CHILD_TIMER(_runtime_profile, "FirstInputEmptyTime", "InputEmptyTime");
     _followup_input_empty_timer = ADD_CHILD_TIMER(_runtime_profile, "FollowupInputEmptyTime", "InputEmptyTime");
     _output_full_timer = ADD_CHILD_TIMER(_runtime_profile, "OutputFullTime", "PendingTime");
+    _global_rf_block_timer = ADD_CHILD_TIMER(_runtime_profile, "GlobalRuntimeFilterBlockTime", "PreconditionBlockTime");
+    _input_empty_counter = ADD_CHILD_COUNTER(_runtime_profile, "InputEmptyCount", TUnit::UNIT, "InputEmptyTime");
+    _output_full_counter = ADD_CHILD_COUNTER(_runtime_profile, "OutputFullCount", TUnit::UNIT, "OutputFullTime");
+    _schedule_counter = ADD_CHILD_COUNTER(_runtime_profile, "ScheduleCount", TUnit::UNIT, "ScheduleTime");
+    _yield_counter = ADD_CHILD_COUNTER(_runtime_profile, "YieldCount", TUnit::UNIT, "ScheduleTime");
 
     DCHECK(_state == DriverState::NOT_READY);
     // fill OperatorWithDependency instances into _dependencies from _operators.
@@ -139,6 +152,7 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 StatusOr<vectorized::ChunkPtr> maybe_chunk;
                 {
                     SCOPED_TIMER(curr_op->_pull_timer);
+                    tls_profiling_tag.plan_node_id = curr_op->get_plan_node_id();
                     maybe_chunk = curr_op->pull_chunk(runtime_state);
                 }
                 auto status = maybe_chunk.status();
@@ -159,6 +173,7 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                         total_rows_moved += row_num;
                         {
                             SCOPED_TIMER(next_op->_push_timer);
+                            tls_profiling_tag.plan_node_id = next_op->get_plan_node_id();
                             status = next_op->push_chunk(runtime_state, maybe_chunk.value());
                         }
 
@@ -193,12 +208,24 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 should_yield = true;
                 break;
             }
+        if (should_yield) {
+            COUNTER_UPDATE(_yield_counter, 1);
+            _yield_time_histogram.add(time_spent);
+        }
 
             if (_workgroup != nullptr && time_spent >= YIELD_PREEMPT_MAX_TIME_SPENT &&
                 workgroup::WorkGroupManager::instance()->should_yield_driver_worker(worker_id, _workgroup)) {
                 should_yield = true;
                 break;
             }
+        if (should_yield) {
+            COUNTER_UPDATE(_yield_counter, 1);
+            _yield_time_histogram.add(time_spent);
+        }
+        }
+        if (should_yield) {
+            COUNTER_UPDATE(_yield_counter, 1);
+            _yield_time_histogram.add(time_spent);
         }
         // close finished operators and update _first_unfinished index
         for (auto i = _first_unfinished; i < new_first_unfinished; ++i) {
@@ -302,15 +329,39 @@ void PipelineDriver::finalize(RuntimeState* runtime_state, DriverState state) {
 
     set_driver_state(state);
 
+    // The drivers depending on this driver, e.g. the probe side of hash join waiting for the build side,
+    // may be unblocked now.
+    _fragment_ctx->notify_blocked_drivers();
+
     COUNTER_UPDATE(_total_timer, _total_timer_sw->elapsed_time());
     COUNTER_UPDATE(_schedule_timer, _total_timer->value() - _active_timer->value() - _pending_timer->value());
+    COUNTER_SET(_schedule_counter, _driver_acct.get_schedule_times());
     _update_overhead_timer();
+    if (_span->IsRecording()) {
+        _span->SetAttribute("state", ds_to_string(state));
+        _span->SetAttribute("active_time_ns", _active_timer->value());
+        _span->SetAttribute("pending_time_ns", _pending_timer->value());
+        _span->SetAttribute("schedule_count", _driver_acct.get_schedule_times());
+    }
+    _span->End();
+    if (_blocked_time_histogram.count() > 0) {
+        _runtime_profile->add_info_string("BlockedTimeDistribution", _blocked_time_histogram.to_string());
+    }
+    if (_yield_time_histogram.count() > 0) {
+        _runtime_profile->add_info_string("YieldTimeDistribution", _yield_time_histogram.to_string());
+    }
 
     // last finished driver notify FE the fragment's completion again and
     // unregister the FragmentContext.
     if (_fragment_ctx->count_down_drivers()) {
         _fragment_ctx->finish();
         auto status = _fragment_ctx->final_status();
+        if (const auto& span = _fragment_ctx->span(); span != nullptr) {
+            if (!status.ok()) {
+                span->SetStatus(opentelemetry::trace::StatusCode::kError, status.to_string());
+            }
+            span->End();
+        }
         _fragment_ctx->runtime_state()->exec_env()->driver_executor()->report_exec_state(_fragment_ctx, status, true);
         _fragment_ctx->destroy_pass_through_chunk_buffer();
         auto fragment_id = _fragment_ctx->fragment_instance_id();
@@ -342,6 +393,29 @@ void PipelineDriver::_update_overhead_timer() {
     COUNTER_UPDATE(_overhead_timer, overhead_time);
 }
 
+int64_t DurationHistogram::quantile(double q) const {
+    if (_count == 0) {
+        return 0;
+    }
+    auto rank = static_cast<int64_t>(q * (_count - 1));
+    int64_t seen = 0;
+    for (size_t i = 0; i < _buckets.size(); ++i) {
+        seen += _buckets[i];
+        if (seen > rank) {
+            // The bucket i counts the durations in [2^i, 2^(i+1)).
+            return i + 1 < 63 ? std::min(int64_t(1) << (i + 1), _max) : _max;
+        }
+    }
+    return _max;
+}
+
+std::string DurationHistogram::to_string() const {
+    return strings::Substitute("count=$0, p50=$1, p99=$2, max=$3", _count,
+                               PrettyPrinter::print(quantile(0.5), TUnit::TIME_NS),
+                               PrettyPrinter::print(quantile(0.99), TUnit::TIME_NS),
+                               PrettyPrinter::print(_max, TUnit::TIME_NS));
+}
+
 std::string PipelineDriver::to_readable_string() const {
     std::stringstream ss;
     ss << "driver=" << this << ", status=" << ds_to_string(this->driver_state()) << ", operator-chain: [";
@@ -4,9 +4,11 @@
 
 #include <gutil/bits.h>
 
+#include <array>
 #include <atomic>
 
 #include "common/statusor.h"
+#include "common/tracer.h"
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/morsel.h"
 #include "exec/pipeline/operator.h"
@@ -69,6 +71,31 @@ static inline std::string ds_to_string(DriverState ds) {
     return "UNKNOWN_STATE";
 }
 
+// DurationHistogram counts durations in power-of-two buckets, which is cheap enough to be updated on
+// every state transition of a driver, and is summarized into the profile when the driver is finalized.
+class DurationHistogram {
+public:
+    void add(int64_t duration_ns) {
+        duration_ns = std::max<int64_t>(duration_ns, 1);
+        _buckets[Bits::Log2Floor64(duration_ns)]++;
+        _count++;
+        _max = std::max(_max, duration_ns);
+    }
+
+    int64_t count() const { return _count; }
+
+    // Returns the upper bound of the bucket which the q-quantile falls in.
+    int64_t quantile(double q) const;
+
+    // e.g. "count=10, p50=1.024ms, p99=16.384ms, max=12.345ms".
+    std::string to_string() const;
+
+private:
+    std::array<int64_t, 64> _buckets{};
+    int64_t _count = 0;
+    int64_t _max = 0;
+};
+
 // DriverAcct is used to keep statistics of drivers' runtime information, such as time spent
 // on core, number of chunks already processed, which are taken into consideration by DriverQueue
 // for schedule.
@@ -184,13 +211,25 @@ public:
                 _followup_input_empty_timer->update(elapsed_time);
             }
             _input_empty_timer->update(elapsed_time);
+            _blocked_time_histogram.add(elapsed_time);
             break;
         }
-        case DriverState::OUTPUT_FULL:
-            _output_full_timer->update(_output_full_timer_sw->elapsed_time());
+        case DriverState::OUTPUT_FULL: {
+            auto elapsed_time = _output_full_timer_sw->elapsed_time();
+            _output_full_timer->update(elapsed_time);
+            _blocked_time_histogram.add(elapsed_time);
             break;
+        }
         case DriverState::PRECONDITION_BLOCK: {
-            _precondition_block_timer->update(_precondition_block_timer_sw->elapsed_time());
+            auto elapsed_time = _precondition_block_timer_sw->elapsed_time();
+            // The time after dependencies and local runtime filters are ready is spent on waiting for
+            // global runtime filters.
+            if (_wait_global_rf_ready && !_global_rf_descriptors.empty()) {
+                _global_rf_block_timer->update(elapsed_time - _global_rf_wait_start_ns);
+                _global_rf_wait_start_ns = 0;
+            }
+            _precondition_block_timer->update(elapsed_time);
+            _blocked_time_histogram.add(elapsed_time);
             break;
         }
         default:
@@ -199,9 +238,11 @@ public:
 
         switch (state) {
         case DriverState::INPUT_EMPTY:
+            COUNTER_UPDATE(_input_empty_counter, 1);
             _input_empty_timer_sw->reset();
             break;
         case DriverState::OUTPUT_FULL:
+            COUNTER_UPDATE(_output_full_counter, 1);
             _output_full_timer_sw->reset();
             break;
         case DriverState::PRECONDITION_BLOCK:
@@ -281,6 +322,9 @@ public:
             if (_global_rf_descriptors.empty()) {
                 return false;
             }
+            if (_state == DriverState::PRECONDITION_BLOCK) {
+                _global_rf_wait_start_ns = _precondition_block_timer_sw->elapsed_time();
+            }
             // wait global rf to be ready for at most _global_rf_wait_time_out_ns after
             // both dependencies_block and local_rf_block return false.
             _global_rf_wait_timeout_ns += _precondition_block_timer_sw->elapsed_time();
@@ -380,6 +424,8 @@ private:
     bool _wait_global_rf_ready = false;
     bool _all_global_rf_ready_or_timeout = false;
     int64_t _global_rf_wait_timeout_ns = -1;
+    // The elapsed time of _precondition_block_timer_sw when the driver starts to wait for global runtime filters.
+    int64_t _global_rf_wait_start_ns = 0;
 
     size_t _first_unfinished;
     QueryContext* _query_ctx;
@@ -393,6 +439,8 @@ private:
     // _state must be set by set_driver_state() to record state timer.
     DriverState _state;
     std::shared_ptr<RuntimeProfile> _runtime_profile = nullptr;
+    // The span from prepare() to finalize(), a child of the span of the fragment instance.
+    Span _span;
 
     phmap::flat_hash_map<int32_t, OperatorStage> _operator_stages;
 
@@ -411,6 +459,15 @@ private:
     RuntimeProfile::Counter* _first_input_empty_timer = nullptr;
     RuntimeProfile::Counter* _followup_input_empty_timer = nullptr;
     RuntimeProfile::Counter* _output_full_timer = nullptr;
+    RuntimeProfile::Counter* _global_rf_block_timer = nullptr;
+    RuntimeProfile::Counter* _input_empty_counter = nullptr;
+    RuntimeProfile::Counter* _output_full_counter = nullptr;
+    RuntimeProfile::Counter* _yield_counter = nullptr;
+    RuntimeProfile::Counter* _schedule_counter = nullptr;
+
+    // The durations of each blocked period, and of each round of process() which ends up yielding the core.
+    DurationHistogram _blocked_time_histogram;
+    DurationHistogram _yield_time_histogram;
 
     MonotonicStopWatch* _total_timer_sw = nullptr;
     MonotonicStopWatch* _pending_timer_sw = nullptr;
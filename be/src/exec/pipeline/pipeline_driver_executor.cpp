@@ -2,18 +2,29 @@
 
 #include "exec/pipeline/pipeline_driver_executor.h"
 
+#include "common/config.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "util/cpu_info.h"
 #include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 
+static std::unique_ptr<DriverQueue> create_driver_queue(bool enable_resource_group, int max_threads) {
+    if (enable_resource_group) {
+        return std::make_unique<DriverQueueWithWorkGroup>();
+    }
+    if (config::pipeline_enable_work_stealing_driver_queue && max_threads > 1) {
+        int num_numa_nodes = config::pipeline_enable_numa_aware_scheduling ? CpuInfo::get_max_num_numa_nodes() : 1;
+        return std::make_unique<WorkStealingDriverQueue>(max_threads, num_numa_nodes);
+    }
+    return std::make_unique<QuerySharedDriverQueue>();
+}
+
 GlobalDriverExecutor::GlobalDriverExecutor(std::unique_ptr<ThreadPool> thread_pool, bool enable_resource_group)
         : _enable_resource_group(enable_resource_group),
-          _driver_queue(enable_resource_group
-                                ? std::unique_ptr<DriverQueue>(std::make_unique<DriverQueueWithWorkGroup>())
-                                : std::make_unique<QuerySharedDriverQueue>()),
+          _driver_queue(create_driver_queue(enable_resource_group, thread_pool->max_threads())),
           _thread_pool(std::move(thread_pool)),
           _blocked_driver_poller(new PipelineDriverPoller(_driver_queue.get())),
           _exec_state_reporter(new ExecStateReporter()) {}
@@ -47,6 +58,11 @@ void GlobalDriverExecutor::_finalize_driver(DriverRawPtr driver, RuntimeState* r
 
 void GlobalDriverExecutor::_worker_thread() {
     const int worker_id = _next_id++;
+    // Bind the executor thread to the NUMA node of its local queue, see WorkStealingDriverQueue.
+    if (auto* ws_queue = dynamic_cast<WorkStealingDriverQueue*>(_driver_queue.get());
+        ws_queue != nullptr && ws_queue->num_numa_nodes() > 1) {
+        CpuInfo::bind_current_thread_to_numa_node(ws_queue->numa_node_of_worker(worker_id));
+    }
     while (true) {
         if (_num_threads_setter.should_shrink()) {
             break;
@@ -67,6 +83,7 @@ void GlobalDriverExecutor::_worker_thread() {
         auto* runtime_state = runtime_state_ptr.get();
         {
             SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(runtime_state->instance_mem_tracker());
+            SCOPED_THREAD_LOCAL_PROFILING_TAG_SETTER(fragment_ctx->query_id(), fragment_ctx->fragment_instance_id());
 
             if (fragment_ctx->is_canceled()) {
                 driver->cancel_operators(runtime_state);
@@ -86,6 +103,7 @@ void GlobalDriverExecutor::_worker_thread() {
 
             auto status = driver->process(runtime_state, worker_id);
             this->_driver_queue->update_statistics(driver);
+            query_ctx->incr_cpu_ns(driver->driver_acct().get_last_time_spent());
 
             // check If large query, if true, cancel it
             bool is_big_query = false;
@@ -3,6 +3,11 @@
 #include "pipeline_driver_poller.h"
 
 #include <chrono>
+
+#include "common/config.h"
+#include "exec/pipeline/fragment_context.h"
+#include "util/time.h"
+
 namespace starrocks::pipeline {
 
 void PipelineDriverPoller::start() {
@@ -27,115 +32,149 @@ void PipelineDriverPoller::shutdown() {
 
 void PipelineDriverPoller::run_internal() {
     this->_is_polling_thread_initialized.store(true, std::memory_order_release);
-    typeof(this->_blocked_drivers) local_blocked_drivers;
-    int spin_count = 0;
+    // The blocked drivers are grouped by fragment, so that a notification only checks the drivers of its fragment.
+    std::unordered_map<FragmentContext*, DriverList> local_blocked_drivers;
+    DriverList new_blocked_drivers;
+    std::unordered_set<FragmentContext*> notified_fragments;
     std::vector<DriverRawPtr> ready_drivers;
+    int64_t last_full_check_ns = MonotonicNanos();
     while (!_is_shutdown.load(std::memory_order_acquire)) {
+        const int64_t fallback_interval_ns = config::pipeline_poller_fallback_check_interval_us * 1000;
         {
             std::unique_lock<std::mutex> lock(this->_mutex);
-            local_blocked_drivers.splice(local_blocked_drivers.end(), _blocked_drivers);
-            if (local_blocked_drivers.empty() && _blocked_drivers.empty()) {
-                std::cv_status cv_status = std::cv_status::no_timeout;
-                while (!_is_shutdown.load(std::memory_order_acquire) && this->_blocked_drivers.empty()) {
-                    cv_status = _cond.wait_for(lock, std::chrono::milliseconds(10));
-                }
-                if (cv_status == std::cv_status::timeout) {
+            while (!_is_shutdown.load(std::memory_order_acquire) && _blocked_drivers.empty() &&
+                   _notified_fragments.empty()) {
+                if (local_blocked_drivers.empty()) {
+                    _cond.wait(lock);
                     continue;
                 }
-                if (_is_shutdown.load(std::memory_order_acquire)) {
+                int64_t wait_ns = last_full_check_ns + fallback_interval_ns - MonotonicNanos();
+                if (wait_ns <= 0) {
                     break;
                 }
-                local_blocked_drivers.splice(local_blocked_drivers.end(), _blocked_drivers);
+                _cond.wait_for(lock, std::chrono::nanoseconds(wait_ns));
             }
+            if (_is_shutdown.load(std::memory_order_acquire)) {
+                break;
+            }
+            new_blocked_drivers.splice(new_blocked_drivers.end(), _blocked_drivers);
+            notified_fragments.swap(_notified_fragments);
         }
 
-        auto driver_it = local_blocked_drivers.begin();
-        while (driver_it != local_blocked_drivers.end()) {
-            auto* driver = *driver_it;
-
-            if (driver->query_ctx()->is_expired()) {
-                // there are not any drivers belonging to a query context can make progress for an expiration period
-                // indicates that some fragments are missing because of failed exec_plan_fragment invocation. in
-                // this situation, query is failed finally, so drivers are marked PENDING_FINISH/FINISH.
-                //
-                // If the fragment is expired when the source operator is already pending i/o task,
-                // The state of driver shouldn't be changed.
-                LOG(WARNING) << "[Driver] Timeout, query_id=" << print_id(driver->query_ctx()->query_id())
-                             << ", instance_id=" << print_id(driver->fragment_ctx()->fragment_instance_id());
-                driver->cancel_operators(driver->fragment_ctx()->runtime_state());
-                if (driver->is_still_pending_finish()) {
-                    driver->set_driver_state(DriverState::PENDING_FINISH);
-                    ++driver_it;
-                } else {
-                    driver->set_driver_state(DriverState::FINISH);
-                    remove_blocked_driver(local_blocked_drivers, driver_it);
-                    ready_drivers.emplace_back(driver);
-                }
-            } else if (driver->fragment_ctx()->is_canceled()) {
-                // If the fragment is cancelled when the source operator is already pending i/o task,
-                // The state of driver shouldn't be changed.
-                driver->cancel_operators(driver->fragment_ctx()->runtime_state());
-                if (driver->is_still_pending_finish()) {
-                    driver->set_driver_state(DriverState::PENDING_FINISH);
-                    ++driver_it;
-                } else {
-                    driver->set_driver_state(DriverState::CANCELED);
-                    remove_blocked_driver(local_blocked_drivers, driver_it);
-                    ready_drivers.emplace_back(driver);
-                }
-            } else if (driver->pending_finish()) {
-                if (driver->is_still_pending_finish()) {
-                    ++driver_it;
-                } else {
-                    // driver->pending_finish() return true means that when a driver's sink operator is finished,
-                    // but its source operator still has pending io task that executed in io threads and has
-                    // reference to object outside(such as desc_tbl) owned by FragmentContext. So a driver in
-                    // PENDING_FINISH state should wait for pending io task's completion, then turn into FINISH state,
-                    // otherwise, pending tasks shall reference to destructed objects in FragmentContext since
-                    // FragmentContext is unregistered prematurely.
-                    driver->set_driver_state(driver->fragment_ctx()->is_canceled() ? DriverState::CANCELED
-                                                                                   : DriverState::FINISH);
-                    remove_blocked_driver(local_blocked_drivers, driver_it);
-                    ready_drivers.emplace_back(driver);
+        // The newly blocked drivers are always checked once, because the events unblocking them
+        // may have been notified before they are added to the poller.
+        while (!new_blocked_drivers.empty()) {
+            auto* fragment_ctx = new_blocked_drivers.front()->fragment_ctx();
+            auto& drivers = local_blocked_drivers[fragment_ctx];
+            drivers.splice(drivers.end(), new_blocked_drivers, new_blocked_drivers.begin());
+            notified_fragments.insert(fragment_ctx);
+        }
+
+        const int64_t now = MonotonicNanos();
+        if (now - last_full_check_ns >= fallback_interval_ns) {
+            last_full_check_ns = now;
+            for (auto& [fragment_ctx, drivers] : local_blocked_drivers) {
+                fragment_ctx->clear_notified();
+                poll_blocked_drivers(drivers, ready_drivers);
+            }
+        } else {
+            for (auto* fragment_ctx : notified_fragments) {
+                // The fragment without blocked drivers may be destructed, so it mustn't be dereferenced.
+                auto it = local_blocked_drivers.find(fragment_ctx);
+                if (it != local_blocked_drivers.end()) {
+                    // Clear the flag before checking, so that the events during checking are notified again.
+                    fragment_ctx->clear_notified();
+                    poll_blocked_drivers(it->second, ready_drivers);
                 }
-            } else if (driver->is_finished()) {
-                remove_blocked_driver(local_blocked_drivers, driver_it);
-                ready_drivers.emplace_back(driver);
-            } else if (driver->is_not_blocked()) {
-                driver->set_driver_state(DriverState::READY);
-                remove_blocked_driver(local_blocked_drivers, driver_it);
-                ready_drivers.emplace_back(driver);
-            } else {
-                ++driver_it;
             }
         }
+        notified_fragments.clear();
 
-        if (ready_drivers.empty()) {
-            spin_count += 1;
-        } else {
-            spin_count = 0;
+        for (auto it = local_blocked_drivers.begin(); it != local_blocked_drivers.end();) {
+            if (it->second.empty()) {
+                it = local_blocked_drivers.erase(it);
+            } else {
+                ++it;
+            }
+        }
 
+        if (!ready_drivers.empty()) {
             _driver_queue->put_back(ready_drivers);
             ready_drivers.clear();
         }
+    }
+}
 
-        if (spin_count != 0 && spin_count % 64 == 0) {
-#ifdef __x86_64__
-            _mm_pause();
-#else
-            // TODO: Maybe there's a better intrinsic like _mm_pause on non-x86_64 architecture.
-            sched_yield();
-#endif
-        }
-        if (spin_count == 640) {
-            spin_count = 0;
-            sched_yield();
+void PipelineDriverPoller::poll_blocked_drivers(DriverList& local_blocked_drivers,
+                                                std::vector<DriverRawPtr>& ready_drivers) {
+    auto driver_it = local_blocked_drivers.begin();
+    while (driver_it != local_blocked_drivers.end()) {
+        auto* driver = *driver_it;
+
+        if (driver->query_ctx()->is_expired()) {
+            // there are not any drivers belonging to a query context can make progress for an expiration period
+            // indicates that some fragments are missing because of failed exec_plan_fragment invocation. in
+            // this situation, query is failed finally, so drivers are marked PENDING_FINISH/FINISH.
+            //
+            // If the fragment is expired when the source operator is already pending i/o task,
+            // The state of driver shouldn't be changed.
+            LOG(WARNING) << "[Driver] Timeout, query_id=" << print_id(driver->query_ctx()->query_id())
+                         << ", instance_id=" << print_id(driver->fragment_ctx()->fragment_instance_id());
+            driver->cancel_operators(driver->fragment_ctx()->runtime_state());
+            if (driver->is_still_pending_finish()) {
+                driver->set_driver_state(DriverState::PENDING_FINISH);
+                ++driver_it;
+            } else {
+                driver->set_driver_state(DriverState::FINISH);
+                remove_blocked_driver(local_blocked_drivers, driver_it);
+                ready_drivers.emplace_back(driver);
+            }
+        } else if (driver->fragment_ctx()->is_canceled()) {
+            // If the fragment is cancelled when the source operator is already pending i/o task,
+            // The state of driver shouldn't be changed.
+            driver->cancel_operators(driver->fragment_ctx()->runtime_state());
+            if (driver->is_still_pending_finish()) {
+                driver->set_driver_state(DriverState::PENDING_FINISH);
+                ++driver_it;
+            } else {
+                driver->set_driver_state(DriverState::CANCELED);
+                remove_blocked_driver(local_blocked_drivers, driver_it);
+                ready_drivers.emplace_back(driver);
+            }
+        } else if (driver->pending_finish()) {
+            if (driver->is_still_pending_finish()) {
+                ++driver_it;
+            } else {
+                // driver->pending_finish() return true means that when a driver's sink operator is finished,
+                // but its source operator still has pending io task that executed in io threads and has
+                // reference to object outside(such as desc_tbl) owned by FragmentContext. So a driver in
+                // PENDING_FINISH state should wait for pending io task's completion, then turn into FINISH state,
+                // otherwise, pending tasks shall reference to destructed objects in FragmentContext since
+                // FragmentContext is unregistered prematurely.
+                driver->set_driver_state(driver->fragment_ctx()->is_canceled() ? DriverState::CANCELED
+                                                                               : DriverState::FINISH);
+                remove_blocked_driver(local_blocked_drivers, driver_it);
+                ready_drivers.emplace_back(driver);
+            }
+        } else if (driver->is_finished()) {
+            remove_blocked_driver(local_blocked_drivers, driver_it);
+            ready_drivers.emplace_back(driver);
+        } else if (driver->is_not_blocked()) {
+            driver->set_driver_state(DriverState::READY);
+            remove_blocked_driver(local_blocked_drivers, driver_it);
+            ready_drivers.emplace_back(driver);
+        } else {
+            ++driver_it;
         }
     }
 }
 
 void PipelineDriverPoller::add_blocked_driver(const DriverRawPtr driver) {
+    auto* fragment_ctx = driver->fragment_ctx();
+    fragment_ctx->set_driver_poller(this);
     std::unique_lock<std::mutex> lock(this->_mutex);
+    // The newly added driver is checked anyway, so the later events of this fragment must be notified again.
+    fragment_ctx->clear_notified();
     this->_blocked_drivers.push_back(driver);
     driver->_pending_timer_sw->reset();
     this->_cond.notify_one();
@@ -147,4 +186,10 @@ void PipelineDriverPoller::remove_blocked_driver(DriverList& local_blocked_drive
     local_blocked_drivers.erase(driver_it++);
 }
 
+void PipelineDriverPoller::notify(FragmentContext* fragment_ctx) {
+    std::lock_guard<std::mutex> lock(this->_mutex);
+    _notified_fragments.insert(fragment_ctx);
+    this->_cond.notify_one();
+}
+
 } // namespace starrocks::pipeline
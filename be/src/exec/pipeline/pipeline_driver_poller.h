@@ -7,6 +7,8 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "pipeline_driver.h"
 #include "pipeline_driver_queue.h"
@@ -36,9 +38,15 @@ public:
     void add_blocked_driver(const DriverRawPtr driver);
     // remove blocked driver from poller
     void remove_blocked_driver(DriverList& local_blocked_drivers, DriverList::iterator& driver_it);
+    // Notify that some blocked drivers of the fragment may be unblocked, then the poller thread
+    // checks the blocked drivers of this fragment at once, instead of waiting for the next round of
+    // checking all the blocked drivers. It is called by FragmentContext::notify_blocked_drivers.
+    void notify(FragmentContext* fragment_ctx);
 
 private:
     void run_internal();
+    // Check the drivers and move the drivers which are not blocked anymore to ready_drivers.
+    void poll_blocked_drivers(DriverList& local_blocked_drivers, std::vector<DriverRawPtr>& ready_drivers);
     PipelineDriverPoller(const PipelineDriverPoller&) = delete;
     PipelineDriverPoller& operator=(const PipelineDriverPoller&) = delete;
 
@@ -46,6 +54,8 @@ private:
     std::mutex _mutex;
     std::condition_variable _cond;
     DriverList _blocked_drivers;
+    // The fragments notified since the last round of checking, guarded by _mutex.
+    std::unordered_set<FragmentContext*> _notified_fragments;
     DriverQueue* _driver_queue;
     scoped_refptr<Thread> _polling_thread;
     std::atomic<bool> _is_polling_thread_initialized;
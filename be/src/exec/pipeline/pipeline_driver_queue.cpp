@@ -2,6 +2,9 @@
 
 #include "exec/pipeline/pipeline_driver_queue.h"
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
 
@@ -180,6 +183,207 @@ int QuerySharedDriverQueueWithoutLock::_compute_driver_level(const DriverRawPtr
     return QUEUE_SIZE - 1;
 }
 
+// The work-stealing queue and the index of the local queue which the current executor thread owns.
+static thread_local const WorkStealingDriverQueue* tls_work_stealing_queue = nullptr;
+static thread_local size_t tls_local_queue_idx = 0;
+
+WorkStealingDriverQueue::WorkStealingDriverQueue(size_t num_local_queues, size_t num_numa_nodes) {
+    DCHECK_GT(num_local_queues, 0);
+    num_local_queues = std::max<size_t>(num_local_queues, 1);
+    _local_queues.reserve(num_local_queues);
+    for (size_t i = 0; i < num_local_queues; ++i) {
+        _local_queues.emplace_back(std::make_unique<LocalQueue>());
+    }
+
+    // Each NUMA node owns at least one local queue.
+    num_numa_nodes = std::clamp<size_t>(num_numa_nodes, 1, num_local_queues);
+    _numa_node_queues.resize(num_numa_nodes);
+    for (size_t i = 0; i < num_local_queues; ++i) {
+        _numa_node_queues[i % num_numa_nodes].emplace_back(i);
+    }
+    _steal_orders.resize(num_local_queues);
+    for (size_t i = 0; i < num_local_queues; ++i) {
+        for (size_t j = 1; j < num_local_queues; ++j) {
+            size_t idx = (i + j) % num_local_queues;
+            if (idx % num_numa_nodes == i % num_numa_nodes) {
+                _steal_orders[i].emplace_back(idx);
+            }
+        }
+        for (size_t j = 1; j < num_local_queues; ++j) {
+            size_t idx = (i + j) % num_local_queues;
+            if (idx % num_numa_nodes != i % num_numa_nodes) {
+                _steal_orders[i].emplace_back(idx);
+            }
+        }
+    }
+
+    double factor = 1;
+    for (int i = QUEUE_SIZE - 1; i >= 0; --i) {
+        // Higher priority levels have more execution time, so they have a larger factor.
+        _level_factors[i] = factor;
+        factor *= RATIO_OF_ADJACENT_QUEUE;
+        _level_accu_time[i] = 0;
+    }
+
+    int64_t time_slice = 0;
+    for (int i = 0; i < QUEUE_SIZE; ++i) {
+        time_slice += LEVEL_TIME_SLICE_BASE_NS * (i + 1);
+        _level_time_slices[i] = time_slice;
+    }
+}
+
+void WorkStealingDriverQueue::close() {
+    std::lock_guard<std::mutex> lock(_idle_mutex);
+    _is_closed = true;
+    _idle_cv.notify_all();
+}
+
+void WorkStealingDriverQueue::put_back(const DriverRawPtr driver) {
+    size_t next_idx = _next_queue_idx.fetch_add(1, std::memory_order_relaxed);
+    if (_numa_node_queues.size() == 1) {
+        _put_back(driver, next_idx % _local_queues.size(), true);
+        return;
+    }
+    const auto& node_queues = _numa_node_queues[_numa_node_of(driver)];
+    _put_back(driver, node_queues[next_idx % node_queues.size()], true);
+}
+
+void WorkStealingDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
+    for (auto* driver : drivers) {
+        put_back(driver);
+    }
+}
+
+void WorkStealingDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
+    // The driver stolen from another NUMA node goes back to its own node.
+    if (tls_work_stealing_queue != this ||
+        (_numa_node_queues.size() > 1 && tls_local_queue_idx % _numa_node_queues.size() != _numa_node_of(driver))) {
+        put_back(driver);
+        return;
+    }
+    // The current executor thread will take a driver from its local queue soon,
+    // so it's unnecessary to wake up others unless there are drivers waiting in the local queue.
+    bool notify = _local_queues[tls_local_queue_idx]->size.load() > 0;
+    _put_back(driver, tls_local_queue_idx, notify);
+}
+
+void WorkStealingDriverQueue::put_back_from_executor(const std::vector<DriverRawPtr>& drivers) {
+    for (auto* driver : drivers) {
+        put_back_from_executor(driver);
+    }
+}
+
+StatusOr<DriverRawPtr> WorkStealingDriverQueue::take(int worker_id) {
+    const size_t num_queues = _local_queues.size();
+    const size_t local_idx = static_cast<size_t>(worker_id) % num_queues;
+    tls_work_stealing_queue = this;
+    tls_local_queue_idx = local_idx;
+
+    while (true) {
+        if (_is_closed) {
+            return Status::Cancelled("Shutdown");
+        }
+
+        if (auto* driver = _take_from(local_idx); driver != nullptr) {
+            return driver;
+        }
+        for (size_t queue_idx : _steal_orders[local_idx]) {
+            if (auto* driver = _take_from(queue_idx); driver != nullptr) {
+                _num_steals.fetch_add(1, std::memory_order_relaxed);
+                if (queue_idx % _numa_node_queues.size() != local_idx % _numa_node_queues.size()) {
+                    _num_remote_steals.fetch_add(1, std::memory_order_relaxed);
+                }
+                return driver;
+            }
+        }
+
+        // _num_idle_workers is increased before checking _num_drivers, and _num_drivers is increased
+        // before checking _num_idle_workers in _put_back(), so either the worker sees the new driver,
+        // or _put_back() sees the idle worker and wakes it up.
+        std::unique_lock<std::mutex> lock(_idle_mutex);
+        _num_idle_workers++;
+        _idle_cv.wait(lock, [this] { return _is_closed || _num_drivers.load() > 0; });
+        _num_idle_workers--;
+    }
+}
+
+void WorkStealingDriverQueue::update_statistics(const DriverRawPtr driver) {
+    _level_accu_time[driver->get_driver_queue_level()].fetch_add(driver->driver_acct().get_last_time_spent());
+}
+
+void WorkStealingDriverQueue::_put_back(const DriverRawPtr driver, size_t queue_idx, bool notify) {
+    int level = _compute_driver_level(driver);
+    driver->set_driver_queue_level(level);
+
+    auto& local_queue = *_local_queues[queue_idx];
+    {
+        std::lock_guard<std::mutex> lock(local_queue.mutex);
+        local_queue.levels[level].emplace(driver);
+        local_queue.size++;
+        _num_drivers++;
+    }
+
+    if (notify && _num_idle_workers.load() > 0) {
+        std::lock_guard<std::mutex> lock(_idle_mutex);
+        _idle_cv.notify_one();
+    }
+}
+
+DriverRawPtr WorkStealingDriverQueue::_take_from(size_t queue_idx) {
+    auto& local_queue = *_local_queues[queue_idx];
+    if (local_queue.size.load() == 0) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(local_queue.mutex);
+    // Find the level with the smallest execution time.
+    int level = -1;
+    double target_accu_time = 0;
+    for (int i = 0; i < QUEUE_SIZE; ++i) {
+        if (!local_queue.levels[i].empty()) {
+            double local_target_time = _level_accu_time[i].load() / _level_factors[i];
+            if (level < 0 || local_target_time < target_accu_time) {
+                target_accu_time = local_target_time;
+                level = i;
+            }
+        }
+    }
+    if (level < 0) {
+        return nullptr;
+    }
+
+    auto* driver = local_queue.levels[level].front();
+    local_queue.levels[level].pop();
+    local_queue.size--;
+    _num_drivers--;
+    return driver;
+}
+
+size_t WorkStealingDriverQueue::_numa_node_of(const DriverRawPtr driver) {
+    auto* fragment_ctx = driver->fragment_ctx();
+    if (fragment_ctx == nullptr) {
+        return 0;
+    }
+    int node = fragment_ctx->numa_node();
+    if (node < 0) {
+        // Spread the fragment instances to the NUMA nodes in a round-robin manner.
+        node = _next_numa_node.fetch_add(1, std::memory_order_relaxed) % _numa_node_queues.size();
+        node = fragment_ctx->assign_numa_node(node);
+    }
+    return static_cast<size_t>(node) % _numa_node_queues.size();
+}
+
+int WorkStealingDriverQueue::_compute_driver_level(const DriverRawPtr driver) const {
+    int time_spent = driver->driver_acct().get_accumulated_time_spent();
+    for (int i = driver->get_driver_queue_level(); i < QUEUE_SIZE; ++i) {
+        if (time_spent < _level_time_slices[i]) {
+            return i;
+        }
+    }
+
+    return QUEUE_SIZE - 1;
+}
+
 void DriverQueueWithWorkGroup::close() {
     std::lock_guard<std::mutex> lock(_global_mutex);
     _is_closed = true;
@@ -219,21 +423,32 @@ StatusOr<DriverRawPtr> DriverQueueWithWorkGroup::take(int worker_id) {
         return Status::Cancelled("Shutdown");
     }
 
-    while (_ready_wgs.empty()) {
-        _cv.wait(lock);
+    workgroup::WorkGroup* wg = nullptr;
+    while (true) {
+        while (_ready_wgs.empty()) {
+            _cv.wait(lock);
+            if (_is_closed) {
+                return Status::Cancelled("Shutdown");
+            }
+        }
+
+        // Try to take driver from any owner workgroup first.
+        wg = _find_min_owner_wg(worker_id);
+        if (wg == nullptr) {
+            // All the owner workgroups don't have ready drivers, so select the other workgroup.
+            wg = _find_min_wg(true);
+        }
+        if (wg != nullptr) {
+            break;
+        }
+
+        // All the ready workgroups are throttled, wait until the cpu bandwidth is refilled or new drivers come.
+        _cv.wait_for(lock, std::chrono::microseconds(config::pipeline_cpu_hard_limit_period_us));
         if (_is_closed) {
             return Status::Cancelled("Shutdown");
         }
     }
 
-    // Try to take driver from any owner workgroup first.
-    auto wg = _find_min_owner_wg(worker_id);
-    if (wg == nullptr) {
-        // All the owner workgroups don't have ready drivers, so select the other workgroup.
-        wg = _find_min_wg();
-    }
-    DCHECK(wg != nullptr);
-
     // If wg only contains one ready driver, it will be not ready anymore after taking away
     // the only one driver.
     if (wg->driver_queue()->size() == 1) {
@@ -251,6 +466,7 @@ void DriverQueueWithWorkGroup::update_statistics(const DriverRawPtr driver) {
     auto* wg = driver->workgroup();
     wg->driver_queue()->update_statistics(driver);
     wg->increment_real_runtime_ns(runtime_ns);
+    wg->charge_cpu_bandwidth(runtime_ns);
 
     // for big query check cpu
     if (wg->big_query_cpu_core_second_limit()) {
@@ -328,7 +544,7 @@ workgroup::WorkGroup* DriverQueueWithWorkGroup::_find_min_owner_wg(int worker_id
     if (owner_wgs != nullptr) {
         for (const auto& wg : *owner_wgs) {
             if (_ready_wgs.find(wg.get()) != _ready_wgs.end() &&
-                (min_wg == nullptr || min_vruntime_ns > wg->vruntime_ns())) {
+                (min_wg == nullptr || min_vruntime_ns > wg->vruntime_ns()) && !wg->is_cpu_throttled()) {
                 min_wg = wg.get();
                 min_vruntime_ns = wg->vruntime_ns();
             }
@@ -338,11 +554,14 @@ workgroup::WorkGroup* DriverQueueWithWorkGroup::_find_min_owner_wg(int worker_id
     return min_wg;
 }
 
-workgroup::WorkGroup* DriverQueueWithWorkGroup::_find_min_wg() {
+workgroup::WorkGroup* DriverQueueWithWorkGroup::_find_min_wg(bool skip_throttled) {
     workgroup::WorkGroup* min_wg = nullptr;
     int64_t min_vruntime_ns = 0;
 
     for (auto wg : _ready_wgs) {
+        if (skip_throttled && wg->is_cpu_throttled()) {
+            continue;
+        }
         if (min_wg == nullptr || min_vruntime_ns > wg->vruntime_ns()) {
             min_wg = wg;
             min_vruntime_ns = wg->vruntime_ns();
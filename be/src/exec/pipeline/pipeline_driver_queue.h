@@ -163,6 +163,108 @@ private:
     size_t _size = 0;
 };
 
+// WorkStealingDriverQueue has a local run queue for each executor thread to get rid of the
+// global mutex of QuerySharedDriverQueue, which is contended by all the executor threads at
+// every time a driver yields.
+//
+// - A driver put back by an executor thread goes to the local queue of this thread,
+//   and the other drivers (new drivers or ready drivers from the poller) are put back to the
+//   local queues in a round-robin manner.
+// - An executor thread takes drivers from its own local queue first, and steals drivers from
+//   the local queues of the other threads when its own one is empty.
+// - Each local queue is a multilevel feedback queue the same as QuerySharedDriverQueue,
+//   and the accumulated execution time of each level is shared by all the local queues,
+//   so the priority of the levels is the same whichever local queue a driver is in.
+//
+// The executor threads only sleep on the shared condition variable when there are no drivers
+// in any local queue.
+//
+// If num_numa_nodes > 1, the local queues are grouped into NUMA nodes, the i-th local queue belongs
+// to the (i % num_numa_nodes)-th node, and the executor thread owning it is expected to be bound to that node.
+// Each fragment instance is assigned to a node when its first driver is put back, and then all its drivers are
+// put back to the local queues of that node, so that they always touch the memory allocated on the local node.
+// An executor thread steals from the local queues of the same node first, and only steals from the other nodes
+// when all the queues of its own node are empty.
+class WorkStealingDriverQueue : public FactoryMethod<DriverQueue, WorkStealingDriverQueue> {
+    friend class FactoryMethod<DriverQueue, WorkStealingDriverQueue>;
+
+public:
+    explicit WorkStealingDriverQueue(size_t num_local_queues, size_t num_numa_nodes = 1);
+    ~WorkStealingDriverQueue() override = default;
+    void close() override;
+
+    void put_back(const DriverRawPtr driver) override;
+    void put_back(const std::vector<DriverRawPtr>& drivers) override;
+    // Put the driver back to the local queue of the current executor thread.
+    void put_back_from_executor(const DriverRawPtr driver) override;
+    void put_back_from_executor(const std::vector<DriverRawPtr>& drivers) override;
+
+    // Return cancelled status, if the queue is closed.
+    // The local queue of worker |worker_id| is the (worker_id % num_local_queues)-th one.
+    StatusOr<DriverRawPtr> take(int worker_id) override;
+
+    void update_statistics(const DriverRawPtr driver) override;
+
+    size_t size() override { return _num_drivers.load(); }
+
+    size_t num_local_queues() const { return _local_queues.size(); }
+    // The number of drivers taken from the local queue of another worker.
+    int64_t num_steals() const { return _num_steals.load(std::memory_order_relaxed); }
+    // The number of drivers stolen from the local queue of another NUMA node.
+    int64_t num_remote_steals() const { return _num_remote_steals.load(std::memory_order_relaxed); }
+
+    size_t num_numa_nodes() const { return _numa_node_queues.size(); }
+    int numa_node_of_worker(int worker_id) const {
+        return static_cast<int>(static_cast<size_t>(worker_id) % _local_queues.size() % _numa_node_queues.size());
+    }
+
+    static constexpr size_t QUEUE_SIZE = QuerySharedDriverQueue::QUEUE_SIZE;
+    static constexpr double RATIO_OF_ADJACENT_QUEUE = QuerySharedDriverQueue::RATIO_OF_ADJACENT_QUEUE;
+
+private:
+    struct LocalQueue {
+        std::mutex mutex;
+        std::queue<DriverRawPtr> levels[QUEUE_SIZE];
+        // Read without the mutex to skip empty queues when stealing.
+        std::atomic<size_t> size = 0;
+    };
+
+    // Push |driver| to the |queue_idx|-th local queue, and wake up an idle worker if |notify| is true.
+    void _put_back(const DriverRawPtr driver, size_t queue_idx, bool notify);
+    // Return nullptr if the |queue_idx|-th local queue is empty.
+    DriverRawPtr _take_from(size_t queue_idx);
+    // Return the NUMA node of the fragment instance of |driver|, and assign one to it if not assigned yet.
+    size_t _numa_node_of(const DriverRawPtr driver);
+    // When the driver at the i-th level costs _level_time_slices[i],
+    // it will move to (i+1)-th level.
+    int _compute_driver_level(const DriverRawPtr driver) const;
+
+    std::vector<std::unique_ptr<LocalQueue>> _local_queues;
+    // The indexes of the local queues belonging to each NUMA node.
+    std::vector<std::vector<size_t>> _numa_node_queues;
+    // The order of the other local queues to steal from for each local queue, the same node first.
+    std::vector<std::vector<size_t>> _steal_orders;
+
+    // The accumulated execution time and the factor for normalization of each level,
+    // shared by all the local queues.
+    std::atomic<int64_t> _level_accu_time[QUEUE_SIZE];
+    double _level_factors[QUEUE_SIZE];
+    // The time slice of the i-th level is (i+1)*LEVEL_TIME_SLICE_BASE ns.
+    int64_t _level_time_slices[QUEUE_SIZE];
+
+    std::atomic<size_t> _num_drivers = 0;
+    std::atomic<size_t> _next_queue_idx = 0;
+    std::atomic<int64_t> _num_steals = 0;
+    std::atomic<int64_t> _num_remote_steals = 0;
+    std::atomic<size_t> _next_numa_node = 0;
+
+    // Only used to park the idle workers.
+    std::mutex _idle_mutex;
+    std::condition_variable _idle_cv;
+    std::atomic<int> _num_idle_workers = 0;
+    std::atomic<bool> _is_closed = false;
+};
+
 // DriverQueueWithWorkGroup contains two levels of queues.
 // The first level is the work group queue, and the second level is the driver queue in a work group.
 class DriverQueueWithWorkGroup : public FactoryMethod<DriverQueue, DriverQueueWithWorkGroup> {
@@ -182,7 +284,7 @@ public:
     void put_back_from_executor(const std::vector<DriverRawPtr>& drivers) override;
 
     // Return cancelled status, if the queue is closed.
-    // Firstly, select the work group with the minimum vruntime.
+    // Firstly, select the work group with the minimum vruntime, which isn't throttled by its cpu hard limit.
     // Secondly, select the proper driver from the driver queue of this work group.
     StatusOr<DriverRawPtr> take(int worker_id) override;
 
@@ -198,8 +300,10 @@ private:
     template <bool from_executor>
     void _put_back(const DriverRawPtr driver);
     // This method should be guarded by the outside _global_mutex.
+    // _find_min_owner_wg always skips the workgroups throttled by their cpu hard limit,
+    // while _find_min_wg skips them only if skip_throttled is true.
     workgroup::WorkGroup* _find_min_owner_wg(int worker_id);
-    workgroup::WorkGroup* _find_min_wg();
+    workgroup::WorkGroup* _find_min_wg(bool skip_throttled = false);
     // The ideal runtime of a work group is the weighted average of the schedule period.
     int64_t _ideal_runtime_ns(workgroup::WorkGroup* wg);
 
@@ -32,5 +32,6 @@ using Operators = std::vector<OperatorPtr>;
 class DriverExecutor;
 using DriverExecutorPtr = std::shared_ptr<DriverExecutor>;
 class GlobalDriverExecutor;
+class PipelineDriverPoller;
 class ExecStateReporter;
 } // namespace starrocks::pipeline
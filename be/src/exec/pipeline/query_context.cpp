@@ -72,6 +72,7 @@ void QueryContext::init_mem_tracker(int64_t bytes_limit, MemTracker* parent) {
         auto* mem_tracker_counter = ADD_COUNTER(_profile.get(), "MemoryLimit", TUnit::BYTES);
         mem_tracker_counter->set(bytes_limit);
         _mem_tracker = std::make_shared<MemTracker>(MemTracker::QUERY, bytes_limit, _profile->name(), parent);
+        _mem_arbitrator = std::make_unique<QueryMemArbitrator>(_mem_tracker.get());
     });
 }
 
@@ -83,9 +84,50 @@ void QueryContext::init_query(workgroup::WorkGroup* wg) {
         this->set_init_wg_cpu_cost(wg->total_cpu_cost());
         this->init_query_begin_time();
         wg->incr_num_queries();
+        _wg_name = wg->name();
+        _wg_usage_metrics = wg->usage_metrics();
+        _wg_inited.store(true, std::memory_order_release);
     });
 }
 
+// _wg_usage_metrics is only read after _wg_inited is published, since the query context can be used by
+// the other fragment instances before init_query() is invoked.
+#define INCR_WG_USAGE_METRIC(metric, value)                                    \
+    do {                                                                       \
+        if (_wg_inited.load(std::memory_order_acquire) && _wg_usage_metrics) { \
+            _wg_usage_metrics->metric.increment(value);                        \
+        }                                                                      \
+    } while (0)
+
+void QueryContext::incr_cpu_ns(int64_t cpu_ns) {
+    _cpu_ns += cpu_ns;
+    INCR_WG_USAGE_METRIC(cpu_ns, cpu_ns);
+}
+
+void QueryContext::incr_scan_usage(int64_t rows, int64_t bytes) {
+    _scan_rows += rows;
+    _scan_bytes += bytes;
+    INCR_WG_USAGE_METRIC(scan_rows, rows);
+    INCR_WG_USAGE_METRIC(scan_bytes, bytes);
+}
+
+void QueryContext::incr_spill_bytes(int64_t bytes) {
+    _spill_bytes += bytes;
+    INCR_WG_USAGE_METRIC(spill_bytes, bytes);
+}
+
+void QueryContext::incr_network_sent_bytes(int64_t bytes) {
+    _network_sent_bytes += bytes;
+    INCR_WG_USAGE_METRIC(network_sent_bytes, bytes);
+}
+
+void QueryContext::incr_network_received_bytes(int64_t bytes) {
+    _network_received_bytes += bytes;
+    INCR_WG_USAGE_METRIC(network_received_bytes, bytes);
+}
+
+#undef INCR_WG_USAGE_METRIC
+
 QueryContextManager::QueryContextManager(size_t log2_num_slots)
         : _num_slots(1 << log2_num_slots),
           _slot_mask(_num_slots - 1),
@@ -185,6 +227,20 @@ QueryContext* QueryContextManager::get_or_register(const TUniqueId& query_id) {
     }
 }
 
+std::vector<QueryContextPtr> QueryContextManager::list_all() {
+    std::vector<QueryContextPtr> contexts;
+    for (size_t i = 0; i < _num_slots; ++i) {
+        std::shared_lock<std::shared_mutex> read_lock(_mutexes[i]);
+        for (const auto& it : _context_maps[i]) {
+            contexts.push_back(it.second);
+        }
+        for (const auto& it : _second_chance_maps[i]) {
+            contexts.push_back(it.second);
+        }
+    }
+    return contexts;
+}
+
 QueryContextPtr QueryContextManager::get(const TUniqueId& query_id) {
     size_t i = _slot_idx(query_id);
     auto& mutex = _mutexes[i];
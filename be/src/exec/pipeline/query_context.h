@@ -6,16 +6,23 @@
 #include <chrono>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/pipeline_fwd.h"
+#include "exec/pipeline/query_mem_arbitrator.h"
 #include "gen_cpp/InternalService_types.h" // for TQueryOptions
 #include "gen_cpp/Types_types.h"           // for TUniqueId
+#include "runtime/mem_tracker.h"
 #include "runtime/runtime_state.h"
 #include "util/hash_util.hpp"
 #include "util/time.h"
 
 namespace starrocks {
+namespace workgroup {
+struct WorkGroupUsageMetrics;
+} // namespace workgroup
+
 namespace pipeline {
 
 using std::chrono::seconds;
@@ -75,6 +82,8 @@ public:
     size_t total_fragments() { return _total_fragments; }
     void init_mem_tracker(int64_t bytes_limit, MemTracker* parent);
     std::shared_ptr<MemTracker> mem_tracker() { return _mem_tracker; }
+    // Created along with the query MemTracker, used by the operators to reserve memory.
+    QueryMemArbitrator* mem_arbitrator() { return _mem_arbitrator.get(); }
 
     void init_query(workgroup::WorkGroup* wg);
 
@@ -94,6 +103,25 @@ public:
     int64_t query_begin_time() const { return _query_begin_time; }
     void init_query_begin_time() { _query_begin_time = MonotonicNanos(); }
 
+    // The realtime resource usage of the query in this BE, which is also accumulated to the usage metrics of
+    // its workgroup. They are updated by the drivers, scan operators, exchange and spilling on the fly, rather
+    // than reported in the profile after the fragment instances finish.
+    void incr_cpu_ns(int64_t cpu_ns);
+    void incr_scan_usage(int64_t rows, int64_t bytes);
+    void incr_spill_bytes(int64_t bytes);
+    void incr_network_sent_bytes(int64_t bytes);
+    void incr_network_received_bytes(int64_t bytes);
+    int64_t cpu_ns() const { return _cpu_ns; }
+    int64_t scan_rows() const { return _scan_rows; }
+    int64_t scan_bytes() const { return _scan_bytes; }
+    int64_t spill_bytes() const { return _spill_bytes; }
+    int64_t network_sent_bytes() const { return _network_sent_bytes; }
+    int64_t network_received_bytes() const { return _network_received_bytes; }
+    int64_t current_mem_bytes() const { return _mem_tracker == nullptr ? 0 : _mem_tracker->consumption(); }
+    int64_t peak_mem_bytes() const { return _mem_tracker == nullptr ? 0 : _mem_tracker->peak_consumption(); }
+    // The workgroup of the query, or empty if the query isn't bound to any workgroup.
+    std::string workgroup_name() const { return _wg_inited.load(std::memory_order_acquire) ? _wg_name : ""; }
+
 private:
     ExecEnv* _exec_env = nullptr;
     TUniqueId _query_id;
@@ -107,6 +135,7 @@ private:
     std::once_flag _init_mem_tracker_once;
     std::shared_ptr<RuntimeProfile> _profile;
     std::shared_ptr<MemTracker> _mem_tracker;
+    std::unique_ptr<QueryMemArbitrator> _mem_arbitrator;
     ObjectPool _object_pool;
     DescriptorTbl* _desc_tbl = nullptr;
 
@@ -116,6 +145,17 @@ private:
     std::atomic<int64_t> _cur_scan_rows_num = 0;
 
     int64_t _init_wg_cpu_cost = 0;
+
+    std::atomic<int64_t> _cpu_ns = 0;
+    std::atomic<int64_t> _scan_rows = 0;
+    std::atomic<int64_t> _scan_bytes = 0;
+    std::atomic<int64_t> _spill_bytes = 0;
+    std::atomic<int64_t> _network_sent_bytes = 0;
+    std::atomic<int64_t> _network_received_bytes = 0;
+    // Written once by init_query() and published by _wg_inited.
+    std::string _wg_name;
+    workgroup::WorkGroupUsageMetrics* _wg_usage_metrics = nullptr;
+    std::atomic<bool> _wg_inited = false;
 };
 
 class QueryContextManager {
@@ -126,6 +166,8 @@ public:
     QueryContext* get_or_register(const TUniqueId& query_id);
     QueryContextPtr get(const TUniqueId& query_id);
     void remove(const TUniqueId& query_id);
+    // Return all the query contexts, including the ones waiting for the second chance.
+    std::vector<QueryContextPtr> list_all();
     // used for graceful exit
     void clear();
 
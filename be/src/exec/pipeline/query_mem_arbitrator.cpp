@@ -0,0 +1,124 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/query_mem_arbitrator.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "exec/pipeline/query_context.h"
+#include "runtime/mem_tracker.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+// A consumer reserving less than this is not worth spilling.
+static constexpr int64_t kMinVictimReservedBytes = 16 * 1024 * 1024;
+
+std::unique_ptr<MemConsumer> MemConsumer::create(RuntimeState* state, std::string name, bool spillable) {
+    QueryContext* query_ctx = state->query_ctx();
+    if (!state->enable_spill() || query_ctx == nullptr || query_ctx->mem_arbitrator() == nullptr) {
+        return nullptr;
+    }
+    return std::make_unique<MemConsumer>(query_ctx->mem_arbitrator(), std::move(name), spillable);
+}
+
+MemConsumer::MemConsumer(QueryMemArbitrator* arbitrator, std::string name, bool spillable)
+        : _arbitrator(arbitrator), _name(std::move(name)), _spillable(spillable) {
+    _arbitrator->register_consumer(this);
+}
+
+MemConsumer::~MemConsumer() {
+    _arbitrator->unregister_consumer(this);
+}
+
+bool MemConsumer::try_reserve(int64_t bytes) {
+    return _arbitrator->try_reserve(this, bytes);
+}
+
+void MemConsumer::update_usage(int64_t bytes) {
+    _arbitrator->update_usage(this, bytes);
+}
+
+QueryMemArbitrator::QueryMemArbitrator(MemTracker* query_mem_tracker) : _query_mem_tracker(query_mem_tracker) {}
+
+void QueryMemArbitrator::register_consumer(MemConsumer* consumer) {
+    std::lock_guard<std::mutex> l(_mutex);
+    _consumers.emplace_back(consumer);
+}
+
+void QueryMemArbitrator::unregister_consumer(MemConsumer* consumer) {
+    std::lock_guard<std::mutex> l(_mutex);
+    auto it = std::find(_consumers.begin(), _consumers.end(), consumer);
+    if (it != _consumers.end()) {
+        _total_reserved_bytes -= consumer->_reserved_bytes;
+        consumer->_reserved_bytes = 0;
+        _consumers.erase(it);
+    }
+}
+
+int64_t QueryMemArbitrator::_limit() const {
+    if (_query_mem_tracker == nullptr || !_query_mem_tracker->has_limit()) {
+        return -1;
+    }
+    return _query_mem_tracker->limit() * config::spill_query_mem_limit_ratio;
+}
+
+bool QueryMemArbitrator::try_reserve(MemConsumer* consumer, int64_t bytes) {
+    const int64_t limit = _limit();
+    std::lock_guard<std::mutex> l(_mutex);
+    consumer->_reserved_bytes += bytes;
+    _total_reserved_bytes += bytes;
+    if (limit < 0) {
+        return true;
+    }
+    // The memory already allocated by the consumers is counted by the query MemTracker, and only the part
+    // reserved but not allocated yet needs to be added. Since the allocated part is unknown, take the maximum
+    // one of the consumption and the total reservation as a conservative estimation.
+    const int64_t usage = std::max(_query_mem_tracker->consumption() + bytes, _total_reserved_bytes);
+    if (usage <= limit) {
+        return true;
+    }
+    auto* victim = _request_spill_locked();
+    if (victim != nullptr) {
+        VLOG_QUERY << "[MemArbitrator] ask " << victim->name() << " to spill " << victim->_reserved_bytes
+                   << " bytes, since " << consumer->name() << " fails to reserve " << bytes
+                   << " bytes, usage=" << usage << ", limit=" << limit;
+    }
+    return false;
+}
+
+void QueryMemArbitrator::update_usage(MemConsumer* consumer, int64_t bytes) {
+    std::lock_guard<std::mutex> l(_mutex);
+    _total_reserved_bytes += bytes - consumer->_reserved_bytes;
+    consumer->_reserved_bytes = bytes;
+    consumer->_is_spill_requested = false;
+}
+
+int64_t QueryMemArbitrator::total_reserved_bytes() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _total_reserved_bytes;
+}
+
+MemConsumer* QueryMemArbitrator::_request_spill_locked() {
+    MemConsumer* victim = nullptr;
+    for (auto* consumer : _consumers) {
+        if (!consumer->_spillable || consumer->_reserved_bytes < kMinVictimReservedBytes) {
+            continue;
+        }
+        // The consumer already asked to spill will release its memory soon.
+        if (consumer->is_spill_requested()) {
+            return nullptr;
+        }
+        if (victim == nullptr || consumer->_reserved_bytes > victim->_reserved_bytes) {
+            victim = consumer;
+        }
+    }
+    if (victim != nullptr) {
+        victim->_is_spill_requested = true;
+        _num_spill_requests++;
+    }
+    return victim;
+}
+
+} // namespace starrocks::pipeline
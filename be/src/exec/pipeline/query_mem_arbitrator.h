@@ -0,0 +1,116 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace starrocks {
+class MemTracker;
+class RuntimeState;
+} // namespace starrocks
+
+namespace starrocks::pipeline {
+
+class QueryMemArbitrator;
+
+// MemConsumer is the handle of an operator to reserve memory from the QueryMemArbitrator of its query.
+// The memory-intensive operators, e.g. the aggregator, the build side of hash join and the sorter, reserve
+// memory before allocating it for each input chunk, and update the reservation by their actual memory usage
+// after processing the chunk or spilling.
+//
+// If a reservation fails, the arbitrator asks a spillable consumer, which may be another operator of the query,
+// to spill. Since the in-memory state of an operator can only be touched by its own driver, the victim isn't
+// spilled by the arbitrator directly, instead it sees is_spill_requested() and spills on its next input chunk.
+//
+// Usage Example:
+//     auto consumer = MemConsumer::create(state, "agg", true);
+//     ...
+//     if (consumer != nullptr) consumer->try_reserve(chunk->memory_usage());
+//     // process the chunk
+//     if (... || (consumer != nullptr && consumer->is_spill_requested())) {
+//         // spill
+//     }
+//     if (consumer != nullptr) consumer->update_usage(mem_usage());
+class MemConsumer {
+    friend class QueryMemArbitrator;
+
+public:
+    // Create a consumer registered to the arbitrator of the query of |state|.
+    // Return nullptr if the session doesn't enable spilling, or the query has no arbitrator,
+    // e.g. it isn't executed by the pipeline engine.
+    static std::unique_ptr<MemConsumer> create(RuntimeState* state, std::string name, bool spillable);
+
+    MemConsumer(QueryMemArbitrator* arbitrator, std::string name, bool spillable);
+    ~MemConsumer();
+
+    MemConsumer(const MemConsumer&) = delete;
+    MemConsumer& operator=(const MemConsumer&) = delete;
+
+    // Reserve |bytes| more memory before allocating it.
+    // Return false if the query is short of memory, in which case a spillable consumer, may be this one, has been
+    // asked to spill. The memory is reserved anyway, since the allocation cannot be rejected.
+    bool try_reserve(int64_t bytes);
+
+    // Reset the reserved memory to the actual memory usage |bytes|, which is called after the reserved memory is
+    // allocated, or the in-memory state is spilled. It also clears the spill request.
+    void update_usage(int64_t bytes);
+
+    // Whether the arbitrator asks this consumer to spill its in-memory state.
+    bool is_spill_requested() const { return _is_spill_requested.load(std::memory_order_relaxed); }
+
+    const std::string& name() const { return _name; }
+    bool spillable() const { return _spillable; }
+    int64_t reserved_bytes() const { return _reserved_bytes; }
+
+private:
+    QueryMemArbitrator* const _arbitrator;
+    const std::string _name;
+    const bool _spillable;
+    // Guarded by QueryMemArbitrator::_mutex.
+    int64_t _reserved_bytes = 0;
+    std::atomic<bool> _is_spill_requested = false;
+};
+
+using MemConsumerPtr = std::unique_ptr<MemConsumer>;
+
+// QueryMemArbitrator coordinates the memory of the operators of a query in a BE, which is owned by QueryContext.
+// A reservation is satisfied if the memory consumption of the query plus the reserved bytes doesn't exceed
+// spill_query_mem_limit_ratio of the query memory limit. Otherwise, the spillable consumer reserving the most memory
+// is chosen as the victim and asked to spill, so that the memory is released by the operator holding the most memory
+// instead of failing the operator allocating next.
+class QueryMemArbitrator {
+public:
+    // |query_mem_tracker| must outlive the arbitrator.
+    explicit QueryMemArbitrator(MemTracker* query_mem_tracker);
+    ~QueryMemArbitrator() = default;
+
+    QueryMemArbitrator(const QueryMemArbitrator&) = delete;
+    QueryMemArbitrator& operator=(const QueryMemArbitrator&) = delete;
+
+    void register_consumer(MemConsumer* consumer);
+    // Release all the memory reserved by |consumer|.
+    void unregister_consumer(MemConsumer* consumer);
+
+    bool try_reserve(MemConsumer* consumer, int64_t bytes);
+    void update_usage(MemConsumer* consumer, int64_t bytes);
+
+    int64_t total_reserved_bytes() const;
+    int64_t num_spill_requests() const { return _num_spill_requests; }
+
+private:
+    int64_t _limit() const;
+    // Choose the victim and ask it to spill, must be called with _mutex held.
+    MemConsumer* _request_spill_locked();
+
+    MemTracker* const _query_mem_tracker;
+    mutable std::mutex _mutex;
+    std::vector<MemConsumer*> _consumers;
+    int64_t _total_reserved_bytes = 0;
+    std::atomic<int64_t> _num_spill_requests = 0;
+};
+
+} // namespace starrocks::pipeline
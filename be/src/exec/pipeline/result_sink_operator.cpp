@@ -5,6 +5,7 @@
 #include "column/chunk.h"
 #include "exprs/expr.h"
 #include "runtime/buffer_control_block.h"
+#include "runtime/arrow_result_writer.h"
 #include "runtime/exec_env.h"
 #include "runtime/mysql_result_writer.h"
 #include "runtime/result_buffer_mgr.h"
@@ -22,6 +23,9 @@ Status ResultSinkOperator::prepare(RuntimeState* state) {
     case TResultSinkType::MYSQL_PROTOCAL:
         _writer = std::make_shared<MysqlResultWriter>(_sender.get(), _output_expr_ctxs, _profile.get());
         break;
+    case TResultSinkType::ARROW:
+        _writer = std::make_shared<ArrowResultWriter>(_sender.get(), _output_expr_ctxs, _profile.get());
+        break;
     default:
         return Status::InternalError("Unknown result sink type");
     }
@@ -70,8 +74,7 @@ bool ResultSinkOperator::need_input() const {
     if (!_fetch_data_result) {
         return true;
     }
-    auto* mysql_writer = down_cast<MysqlResultWriter*>(_writer.get());
-    auto status = mysql_writer->try_add_batch(_fetch_data_result);
+    auto status = _writer->try_add_batch(_fetch_data_result);
     if (status.ok()) {
         return status.value();
     } else {
@@ -85,12 +88,11 @@ Status ResultSinkOperator::push_chunk(RuntimeState* state, const vectorized::Chu
         return _last_error;
     }
     DCHECK(!_fetch_data_result);
-    auto* mysql_writer = down_cast<MysqlResultWriter*>(_writer.get());
-    auto status = mysql_writer->process_chunk(chunk.get());
+    auto status = _writer->process_chunk(chunk.get());
 
     if (status.ok()) {
         _fetch_data_result = std::move(status.value());
-        return mysql_writer->try_add_batch(_fetch_data_result).status();
+        return _writer->try_add_batch(_fetch_data_result).status();
     } else {
         return status.status();
     }
@@ -349,6 +349,9 @@ public:
                 desc->set_runtime_filter(nullptr);
                 continue;
             }
+            // fill the columns of all the partial hash tables at once, so the filter sees the range of all values.
+            std::vector<vectorized::ColumnPtr> columns;
+            bool eq_null = false;
             for (auto& opt_params : _partial_bloom_filter_build_params) {
                 auto& opt_param = opt_params[i];
                 DCHECK(opt_param.has_value());
@@ -356,13 +359,17 @@ public:
                 if (param.column == nullptr || param.column->empty()) {
                     continue;
                 }
-                auto status = vectorized::RuntimeFilterHelper::fill_runtime_bloom_filter(
-                        param.column, desc->build_expr_type(), desc->runtime_filter(),
-                        vectorized::kHashJoinKeyColumnOffset, param.eq_null);
-                if (!status.ok()) {
-                    desc->set_runtime_filter(nullptr);
-                    break;
-                }
+                columns.emplace_back(param.column);
+                eq_null = param.eq_null;
+            }
+            if (columns.empty()) {
+                continue;
+            }
+            auto status = vectorized::RuntimeFilterHelper::fill_runtime_bloom_filter(
+                    columns, desc->build_expr_type(), desc->runtime_filter(), vectorized::kHashJoinKeyColumnOffset,
+                    eq_null);
+            if (!status.ok()) {
+                desc->set_runtime_filter(nullptr);
             }
         }
         return Status::OK();
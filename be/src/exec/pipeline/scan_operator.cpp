@@ -3,6 +3,7 @@
 #include "exec/pipeline/scan_operator.h"
 
 #include "column/chunk.h"
+#include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/hdfs_scan_operator.h"
 #include "exec/pipeline/limit_operator.h"
 #include "exec/pipeline/pipeline_builder.h"
@@ -11,6 +12,8 @@
 #include "exec/workgroup/work_group.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
+#include "util/time.h"
+
 namespace starrocks::pipeline {
 
 // ========== ScanOperator ==========
@@ -40,6 +43,12 @@ Status ScanOperator::prepare(RuntimeState* state) {
         }
     }
 
+    _io_task_concurrency_counter = ADD_COUNTER(_unique_metrics, "IOTaskConcurrency", TUnit::UNIT);
+    _peak_io_task_concurrency_counter =
+            _unique_metrics->AddHighWaterMarkCounter("PeakIOTaskConcurrency", TUnit::UNIT);
+    COUNTER_SET(_io_task_concurrency_counter, static_cast<int64_t>(_max_io_tasks));
+    COUNTER_SET(_peak_io_task_concurrency_counter, static_cast<int64_t>(_max_io_tasks));
+
     RETURN_IF_ERROR(do_prepare(state));
 
     return Status::OK();
@@ -59,6 +68,10 @@ void ScanOperator::close(RuntimeState* state) {
     }
 
     _merge_chunk_source_profiles();
+    if (_morsel_queue != nullptr) {
+        auto* stolen_morsels_counter = ADD_COUNTER(_unique_metrics, "MorselsStolen", TUnit::UNIT);
+        COUNTER_SET(stolen_morsels_counter, static_cast<int64_t>(_morsel_queue->num_stolen_morsels()));
+    }
     do_close(state);
     Operator::close(state);
 }
@@ -74,7 +87,7 @@ bool ScanOperator::has_output() const {
         }
     }
 
-    if (_num_running_io_tasks >= MAX_IO_TASKS_PER_OP) {
+    if (_num_running_io_tasks >= _max_io_tasks || _is_buffer_full()) {
         return false;
     }
 
@@ -82,7 +95,7 @@ bool ScanOperator::has_output() const {
     // return true if more i/o tasks can be committed.
 
     // Can pick up more morsels.
-    if (!_morsel_queue->empty()) {
+    if (_has_more_morsels()) {
         return true;
     }
 
@@ -109,7 +122,7 @@ bool ScanOperator::is_finished() const {
     }
 
     // Any io task is running or needs to run.
-    if (_num_running_io_tasks > 0 || !_morsel_queue->empty()) {
+    if (_num_running_io_tasks > 0 || _has_more_morsels()) {
         return false;
     }
 
@@ -135,10 +148,13 @@ StatusOr<vectorized::ChunkPtr> ScanOperator::pull_chunk(RuntimeState* state) {
         _workgroup->incr_period_ask_chunk_num(1);
     }
 
+    _adjust_max_io_tasks();
+
     for (auto& chunk_source : _chunk_sources) {
         if (chunk_source != nullptr && chunk_source->has_output()) {
             auto&& chunk = chunk_source->get_next_chunk_from_buffer();
             eval_runtime_bloom_filters(chunk.value().get());
+            _num_pulled_chunks_since_adjust++;
 
             return std::move(chunk);
         }
@@ -147,21 +163,64 @@ StatusOr<vectorized::ChunkPtr> ScanOperator::pull_chunk(RuntimeState* state) {
     return nullptr;
 }
 
+size_t ScanOperator::_num_buffered_chunks() const {
+    size_t num_chunks = 0;
+    for (const auto& chunk_source : _chunk_sources) {
+        if (chunk_source != nullptr) {
+            num_chunks += chunk_source->get_buffer_size();
+        }
+    }
+    return num_chunks;
+}
+
+void ScanOperator::_adjust_max_io_tasks() {
+    int64_t now = MonotonicNanos();
+    if (_last_adjust_time_ns == 0) {
+        _last_adjust_time_ns = now;
+        return;
+    }
+    int64_t elapsed_ns = now - _last_adjust_time_ns;
+    if (elapsed_ns < ADJUST_IO_TASKS_INTERVAL_NS) {
+        return;
+    }
+
+    // The number of chunks pulled in an adjusting interval.
+    double pulled_chunks_per_interval =
+            static_cast<double>(_num_pulled_chunks_since_adjust) * ADJUST_IO_TASKS_INTERVAL_NS / elapsed_ns;
+    auto num_buffered_chunks = static_cast<double>(_num_buffered_chunks());
+    int max_io_tasks = _max_io_tasks;
+    if (num_buffered_chunks <= pulled_chunks_per_interval && _num_running_io_tasks >= _max_io_tasks) {
+        max_io_tasks = std::min(_max_io_tasks + 1, MAX_IO_TASKS_PER_OP);
+    } else if (num_buffered_chunks > pulled_chunks_per_interval * MAX_BUFFERED_INTERVALS) {
+        max_io_tasks = std::max(_max_io_tasks - 1, 1);
+    }
+    if (max_io_tasks != _max_io_tasks) {
+        _max_io_tasks = max_io_tasks;
+        COUNTER_SET(_io_task_concurrency_counter, static_cast<int64_t>(_max_io_tasks));
+        COUNTER_SET(_peak_io_task_concurrency_counter, static_cast<int64_t>(_max_io_tasks));
+    }
+
+    _last_adjust_time_ns = now;
+    _num_pulled_chunks_since_adjust = 0;
+}
+
 Status ScanOperator::_try_to_trigger_next_scan(RuntimeState* state) {
-    if (_num_running_io_tasks >= MAX_IO_TASKS_PER_OP) {
+    if (_num_running_io_tasks >= _max_io_tasks || _is_buffer_full()) {
         return Status::OK();
     }
 
     // Firstly, find the picked-up morsel, whose can commit an io task.
-    for (int i = 0; i < MAX_IO_TASKS_PER_OP; ++i) {
+    // The chunk sources beyond _max_io_tasks, left by the larger _max_io_tasks before, are also
+    // triggered, otherwise they will never finish.
+    for (int i = 0; i < MAX_IO_TASKS_PER_OP && _num_running_io_tasks < _max_io_tasks; ++i) {
         if (_chunk_sources[i] != nullptr && !_is_io_task_running[i] && _chunk_sources[i]->has_next_chunk()) {
             RETURN_IF_ERROR(_trigger_next_scan(state, i));
         }
     }
 
     // Secondly, find the unused position of _chunk_sources to pick up a new morsel.
-    if (!_morsel_queue->empty()) {
-        for (int i = 0; i < MAX_IO_TASKS_PER_OP; ++i) {
+    if (_has_more_morsels()) {
+        for (int i = 0; i < MAX_IO_TASKS_PER_OP && _num_running_io_tasks < _max_io_tasks; ++i) {
             if (_chunk_sources[i] == nullptr || (!_is_io_task_running[i] && !_chunk_sources[i]->has_output())) {
                 RETURN_IF_ERROR(_pickup_morsel(state, i));
             }
@@ -171,6 +230,15 @@ Status ScanOperator::_try_to_trigger_next_scan(RuntimeState* state) {
     return Status::OK();
 }
 
+void ScanOperator::_notify_blocked_drivers(RuntimeState* state) {
+    // It must be called before decreasing _num_running_io_tasks, after which the fragment may be destructed.
+    // Therefore, the driver waiting for the last io task in PENDING_FINISH state is checked by the fallback
+    // of the poller.
+    if (auto* fragment_ctx = state->fragment_ctx(); fragment_ctx != nullptr) {
+        fragment_ctx->notify_blocked_drivers();
+    }
+}
+
 Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_index) {
     _num_running_io_tasks++;
     _is_io_task_running[chunk_source_index] = true;
@@ -193,6 +261,7 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
                 _last_scan_rows_num += _chunk_sources[chunk_source_index]->last_scan_rows_num();
             }
 
+            _notify_blocked_drivers(state);
             _num_running_io_tasks--;
             _is_io_task_running[chunk_source_index] = false;
         });
@@ -210,6 +279,7 @@ Status ScanOperator::_trigger_next_scan(RuntimeState* state, int chunk_source_in
                 _chunk_sources[chunk_source_index]->buffer_next_batch_chunks_blocking(_buffer_size, _is_finished);
             }
 
+            _notify_blocked_drivers(state);
             _num_running_io_tasks--;
             _is_io_task_running[chunk_source_index] = false;
         };
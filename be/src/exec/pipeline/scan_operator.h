@@ -39,14 +39,28 @@ public:
     virtual Status do_prepare(RuntimeState* state) = 0;
     virtual void do_close(RuntimeState* state) = 0;
     virtual ChunkSourcePtr create_chunk_source(MorselPtr morsel, int32_t chunk_source_index) = 0;
+    // Whether the scan has read enough rows for the limit, then the remaining morsels are skipped.
+    virtual bool is_limit_reached() const { return false; }
 
 private:
+    bool _has_more_morsels() const { return !_morsel_queue->empty() && !is_limit_reached(); }
     // This method is only invoked when current morsel is reached eof
     // and all cached chunk of this morsel has benn read out
     Status _pickup_morsel(RuntimeState* state, int chunk_source_index);
     Status _trigger_next_scan(RuntimeState* state, int chunk_source_index);
     Status _try_to_trigger_next_scan(RuntimeState* state);
     void _merge_chunk_source_profiles();
+    // The number of chunks read by the io tasks but not pulled yet.
+    size_t _num_buffered_chunks() const;
+    bool _is_buffer_full() const { return _num_buffered_chunks() >= _buffer_size * _max_io_tasks; }
+    // Adjust _max_io_tasks by the level of buffered chunks and the rate of pulling chunks:
+    // - If the buffered chunks will be consumed up soon, while all the allowed io tasks are running,
+    //   which means that the io tasks cannot keep up with the downstream, then run one more io task.
+    // - If the buffered chunks cannot be consumed up in a long time, which means that the downstream
+    //   cannot keep up with the io tasks, then run one less io task to avoid buffering too many chunks.
+    void _adjust_max_io_tasks();
+    // Wake up the driver of this operator blocked by waiting for the io tasks.
+    void _notify_blocked_drivers(RuntimeState* state);
 
 protected:
     ScanNode* _scan_node = nullptr;
@@ -58,10 +72,22 @@ protected:
     std::vector<std::shared_ptr<RuntimeProfile>> _chunk_source_profiles;
 
 private:
-    static constexpr int MAX_IO_TASKS_PER_OP = 4;
+    static constexpr int MAX_IO_TASKS_PER_OP = 16;
+    static constexpr int INIT_IO_TASKS_PER_OP = 4;
+    // The interval to adjust _max_io_tasks.
+    static constexpr int64_t ADJUST_IO_TASKS_INTERVAL_NS = 50'000'000L;
+    // Run one less io task, if the buffered chunks need more than this number of intervals to be consumed up.
+    static constexpr int64_t MAX_BUFFERED_INTERVALS = 20;
 
     const size_t _buffer_size = config::pipeline_io_buffer_size;
 
+    // The maximum number of concurrent io tasks, which is in [1, MAX_IO_TASKS_PER_OP].
+    int _max_io_tasks = INIT_IO_TASKS_PER_OP;
+    int64_t _last_adjust_time_ns = 0;
+    int64_t _num_pulled_chunks_since_adjust = 0;
+    RuntimeProfile::Counter* _io_task_concurrency_counter = nullptr;
+    RuntimeProfile::HighWaterMarkCounter* _peak_io_task_concurrency_counter = nullptr;
+
     bool _is_finished = false;
 
     int32_t _io_task_retry_cnt = 0;
@@ -0,0 +1,175 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/sort/local_partition_topn_context.h"
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "exec/vectorized/chunk_sorter_heapsorter.h"
+#include "exec/vectorized/chunks_sorter_topn.h"
+#include "exprs/expr_context.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+LocalPartitionTopnContext::LocalPartitionTopnContext(RuntimeState* state,
+                                                     const std::vector<ExprContext*>& partition_exprs,
+                                                     SortExecExprs& sort_exec_exprs,
+                                                     const std::vector<bool>& is_asc_order,
+                                                     const std::vector<bool>& is_null_first,
+                                                     const std::string& sort_keys, int64_t partition_limit)
+        : _state(state),
+          _partition_exprs(partition_exprs),
+          _sort_exec_exprs(sort_exec_exprs),
+          _is_asc_order(is_asc_order),
+          _is_null_first(is_null_first),
+          _sort_keys(sort_keys),
+          _partition_limit(partition_limit) {}
+
+std::unique_ptr<ChunksSorter> LocalPartitionTopnContext::_create_chunks_sorter() const {
+    if (_partition_limit <= ChunksSorter::USE_HEAP_SORTER_LIMIT_SZ) {
+        return std::make_unique<HeapChunkSorter>(_state, &(_sort_exec_exprs.lhs_ordering_expr_ctxs()), &_is_asc_order,
+                                                 &_is_null_first, _sort_keys, 0, _partition_limit);
+    }
+    return std::make_unique<ChunksSorterTopn>(_state, &(_sort_exec_exprs.lhs_ordering_expr_ctxs()), &_is_asc_order,
+                                              &_is_null_first, _sort_keys, 0, _partition_limit,
+                                              ChunksSorterTopn::tunning_buffered_chunks(_partition_limit));
+}
+
+Status LocalPartitionTopnContext::push_chunk(const ChunkPtr& chunk, const ChunkPtr& materialized_chunk) {
+    const size_t num_rows = chunk->num_rows();
+    DCHECK_EQ(num_rows, materialized_chunk->num_rows());
+
+    Columns key_columns;
+    key_columns.reserve(_partition_exprs.size());
+    uint32_t max_one_row_size = 0;
+    for (ExprContext* expr_ctx : _partition_exprs) {
+        ASSIGN_OR_RETURN(ColumnPtr column, expr_ctx->evaluate(chunk.get()));
+        column = ColumnHelper::unpack_and_duplicate_const_column(num_rows, column);
+        max_one_row_size += column->max_one_element_serialize_size();
+        key_columns.emplace_back(std::move(column));
+    }
+
+    _key_buffer.resize(static_cast<size_t>(max_one_row_size) * num_rows);
+    _key_sizes.assign(num_rows, 0);
+    for (const auto& column : key_columns) {
+        column->serialize_batch(_key_buffer.data(), _key_sizes, num_rows, max_one_row_size);
+    }
+
+    // Find the partition of each row, the new partitions get sorters of their own.
+    _row_partitions.resize(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        Slice key(_key_buffer.data() + i * max_one_row_size, _key_sizes[i]);
+        auto iter = _partition_indexes.lazy_emplace(key, [&](const auto& ctor) {
+            uint8_t* data = _mem_pool.allocate(key.size);
+            memcpy(data, key.data, key.size);
+            ctor(Slice(data, key.size), _chunks_sorters.size());
+            _chunks_sorters.emplace_back(_create_chunks_sorter());
+        });
+        _row_partitions[i] = iter->second;
+    }
+
+    // Group the rows by the partitions appearing in this chunk with a counting sort, and feed the rows of each
+    // partition to its sorter. Only the partitions of this chunk are visited, there may be lots of partitions.
+    _local_partitions.resize(_chunks_sorters.size(), kInvalidLocalPartition);
+    _chunk_partitions.clear();
+    _partition_offsets.clear();
+    for (size_t i = 0; i < num_rows; ++i) {
+        uint32_t& local = _local_partitions[_row_partitions[i]];
+        if (local == kInvalidLocalPartition) {
+            local = _chunk_partitions.size();
+            _chunk_partitions.push_back(_row_partitions[i]);
+            _partition_offsets.push_back(0);
+        }
+        _partition_offsets[local]++;
+    }
+    // _partition_offsets[i] becomes the end of the rows of the i-th partition after placing the rows.
+    uint32_t offset = 0;
+    for (auto& partition_offset : _partition_offsets) {
+        uint32_t rows = partition_offset;
+        partition_offset = offset;
+        offset += rows;
+    }
+    _partition_rows.resize(num_rows);
+    for (uint32_t i = 0; i < num_rows; ++i) {
+        _partition_rows[_partition_offsets[_local_partitions[_row_partitions[i]]]++] = i;
+    }
+
+    uint32_t from = 0;
+    for (size_t local = 0; local < _chunk_partitions.size(); ++local) {
+        size_t partition = _chunk_partitions[local];
+        _local_partitions[partition] = kInvalidLocalPartition;
+        uint32_t size = _partition_offsets[local] - from;
+        ChunkPtr partition_chunk;
+        if (size == num_rows) {
+            partition_chunk = materialized_chunk;
+        } else {
+            partition_chunk = materialized_chunk->clone_empty_with_slot(size);
+            partition_chunk->append_selective(*materialized_chunk, _partition_rows.data(), from, size);
+        }
+        from = _partition_offsets[local];
+        RETURN_IF_ERROR(_chunks_sorters[partition]->update(_state, partition_chunk));
+    }
+    return Status::OK();
+}
+
+Status LocalPartitionTopnContext::done() {
+    for (auto& chunks_sorter : _chunks_sorters) {
+        RETURN_IF_ERROR(chunks_sorter->done(_state));
+    }
+    _partition_indexes.clear();
+    _mem_pool.free_all();
+    _is_sink_complete.store(true, std::memory_order_release);
+    return Status::OK();
+}
+
+StatusOr<ChunkPtr> LocalPartitionTopnContext::pull_chunk() {
+    ChunkPtr result;
+    while (_next_output_partition < _chunks_sorters.size()) {
+        auto& chunks_sorter = _chunks_sorters[_next_output_partition];
+        ChunkPtr chunk;
+        bool eos = false;
+        chunks_sorter->get_next(&chunk, &eos);
+        if (eos) {
+            // The sorter is not needed anymore, release its rows.
+            chunks_sorter.reset();
+            ++_next_output_partition;
+        }
+        if (chunk == nullptr || chunk->num_rows() == 0) {
+            continue;
+        }
+        if (result == nullptr) {
+            result = std::move(chunk);
+        } else {
+            result->append(*chunk);
+        }
+        if (result->num_rows() >= _state->chunk_size()) {
+            break;
+        }
+    }
+    return result;
+}
+
+LocalPartitionTopnContextFactory::LocalPartitionTopnContextFactory(
+        RuntimeState* state, int32_t degree_of_parallelism, const std::vector<ExprContext*>& partition_exprs,
+        SortExecExprs& sort_exec_exprs, const std::vector<bool>& is_asc_order, const std::vector<bool>& is_null_first,
+        const std::string& sort_keys, int64_t partition_limit)
+        : _state(state),
+          _contexts(degree_of_parallelism),
+          _partition_exprs(partition_exprs),
+          _sort_exec_exprs(sort_exec_exprs),
+          _is_asc_order(is_asc_order),
+          _is_null_first(is_null_first),
+          _sort_keys(sort_keys),
+          _partition_limit(partition_limit) {}
+
+LocalPartitionTopnContext* LocalPartitionTopnContextFactory::create(int32_t driver_sequence) {
+    DCHECK_LT(driver_sequence, _contexts.size());
+    if (_contexts[driver_sequence] == nullptr) {
+        _contexts[driver_sequence] = std::make_shared<LocalPartitionTopnContext>(
+                _state, _partition_exprs, _sort_exec_exprs, _is_asc_order, _is_null_first, _sort_keys,
+                _partition_limit);
+    }
+    return _contexts[driver_sequence].get();
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,117 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "column/column_hash.h"
+#include "column/vectorized_fwd.h"
+#include "exec/sort_exec_exprs.h"
+#include "exec/vectorized/chunks_sorter.h"
+#include "runtime/mem_pool.h"
+#include "util/phmap/phmap.h"
+
+namespace starrocks {
+class ExprContext;
+class RuntimeState;
+
+namespace pipeline {
+using namespace vectorized;
+
+class LocalPartitionTopnContext;
+using LocalPartitionTopnContextPtr = std::shared_ptr<LocalPartitionTopnContext>;
+
+/*
+ * LocalPartitionTopnContext keeps at most partition_limit rows of each partition of the input of one driver,
+ * for the predicates like ROW_NUMBER() OVER (PARTITION BY ... ORDER BY ...) <= N. The rows are split by the
+ * serialized partition keys in a hash table, and the rows of each partition are sorted by a top-n sorter of its own.
+ *
+ * The rows kept by each driver are a superset of the rows whose row number is not greater than partition_limit,
+ * so the window function and the predicate above still compute the exact result, on much fewer rows.
+ * RANK and DENSE_RANK are not supported, the rows tied with the last kept row would be lost.
+ */
+class LocalPartitionTopnContext {
+public:
+    LocalPartitionTopnContext(RuntimeState* state, const std::vector<ExprContext*>& partition_exprs,
+                              SortExecExprs& sort_exec_exprs, const std::vector<bool>& is_asc_order,
+                              const std::vector<bool>& is_null_first, const std::string& sort_keys,
+                              int64_t partition_limit);
+
+    // Splits |materialized_chunk| by the partition exprs evaluated on |chunk|, which has the same rows,
+    // and feeds each part to the sorter of its partition.
+    Status push_chunk(const ChunkPtr& chunk, const ChunkPtr& materialized_chunk);
+
+    // Called when there is no more input.
+    Status done();
+
+    bool is_sink_complete() const { return _is_sink_complete.load(std::memory_order_acquire); }
+
+    bool is_output_finished() const {
+        return is_sink_complete() && _next_output_partition >= _chunks_sorters.size();
+    }
+
+    // Outputs the rows of the partitions one after another, the rows of different partitions are gathered
+    // into one chunk up to chunk_size.
+    StatusOr<ChunkPtr> pull_chunk();
+
+    size_t num_partitions() const { return _chunks_sorters.size(); }
+
+private:
+    std::unique_ptr<ChunksSorter> _create_chunks_sorter() const;
+
+    RuntimeState* _state;
+    const std::vector<ExprContext*>& _partition_exprs;
+    SortExecExprs& _sort_exec_exprs;
+    const std::vector<bool>& _is_asc_order;
+    const std::vector<bool>& _is_null_first;
+    const std::string& _sort_keys;
+    const int64_t _partition_limit;
+
+    // serialized partition keys -> index of the sorter, the keys are allocated from _mem_pool.
+    phmap::flat_hash_map<Slice, size_t, SliceHash, SliceNormalEqual> _partition_indexes;
+    MemPool _mem_pool;
+    std::vector<std::unique_ptr<ChunksSorter>> _chunks_sorters;
+
+    // Used by push_chunk, kept to avoid the allocations of each chunk.
+    static constexpr uint32_t kInvalidLocalPartition = UINT32_MAX;
+    std::vector<uint8_t> _key_buffer;
+    Buffer<uint32_t> _key_sizes;
+    // the partition of each row.
+    std::vector<size_t> _row_partitions;
+    // the partitions appearing in the chunk, and partition -> index in _chunk_partitions.
+    std::vector<size_t> _chunk_partitions;
+    std::vector<uint32_t> _local_partitions;
+    // the rows grouped by the partitions in the order of _chunk_partitions.
+    std::vector<uint32_t> _partition_offsets;
+    std::vector<uint32_t> _partition_rows;
+
+    std::atomic<bool> _is_sink_complete = false;
+    size_t _next_output_partition = 0;
+};
+
+class LocalPartitionTopnContextFactory {
+public:
+    LocalPartitionTopnContextFactory(RuntimeState* state, int32_t degree_of_parallelism,
+                                     const std::vector<ExprContext*>& partition_exprs, SortExecExprs& sort_exec_exprs,
+                                     const std::vector<bool>& is_asc_order, const std::vector<bool>& is_null_first,
+                                     const std::string& sort_keys, int64_t partition_limit);
+
+    // The sink and source operators of the same driver share one context.
+    LocalPartitionTopnContext* create(int32_t driver_sequence);
+
+private:
+    RuntimeState* _state;
+    std::vector<LocalPartitionTopnContextPtr> _contexts;
+
+    std::vector<ExprContext*> _partition_exprs;
+    SortExecExprs& _sort_exec_exprs;
+    std::vector<bool> _is_asc_order;
+    std::vector<bool> _is_null_first;
+    const std::string _sort_keys;
+    const int64_t _partition_limit;
+};
+
+} // namespace pipeline
+} // namespace starrocks
@@ -0,0 +1,59 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/sort/local_partition_topn_sink.h"
+
+#include "column/chunk.h"
+#include "exec/vectorized/chunks_sorter.h"
+#include "exprs/expr.h"
+#include "runtime/current_thread.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::pipeline {
+
+Status LocalPartitionTopnSinkOperator::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(Operator::prepare(state));
+    _partition_num_counter = ADD_COUNTER(_unique_metrics, "PartitionNum", TUnit::UNIT);
+    return Status::OK();
+}
+
+StatusOr<vectorized::ChunkPtr> LocalPartitionTopnSinkOperator::pull_chunk(RuntimeState* state) {
+    CHECK(false) << "Shouldn't pull chunk from local partition topn sink operator";
+}
+
+Status LocalPartitionTopnSinkOperator::push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) {
+    auto materialize_chunk = vectorized::ChunksSorter::materialize_chunk_before_sort(
+            chunk.get(), _materialized_tuple_desc, _sort_exec_exprs, _order_by_types);
+    RETURN_IF_ERROR(materialize_chunk);
+    TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_partition_topn_ctx->push_chunk(chunk, materialize_chunk.value())));
+    return Status::OK();
+}
+
+Status LocalPartitionTopnSinkOperator::set_finishing(RuntimeState* state) {
+    TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_partition_topn_ctx->done()));
+    COUNTER_SET(_partition_num_counter, static_cast<int64_t>(_partition_topn_ctx->num_partitions()));
+    _is_finished = true;
+    return Status::OK();
+}
+
+Status LocalPartitionTopnSinkOperatorFactory::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(OperatorFactory::prepare(state));
+    RETURN_IF_ERROR(_sort_exec_exprs.prepare(state, _parent_node_row_desc, _parent_node_child_row_desc));
+    RETURN_IF_ERROR(_sort_exec_exprs.open(state));
+    RETURN_IF_ERROR(Expr::prepare(_partition_exprs, state));
+    RETURN_IF_ERROR(Expr::open(_partition_exprs, state));
+    return Status::OK();
+}
+
+OperatorPtr LocalPartitionTopnSinkOperatorFactory::create(int32_t degree_of_parallelism, int32_t driver_sequence) {
+    return std::make_shared<LocalPartitionTopnSinkOperator>(this, _id, _plan_node_id,
+                                                            _partition_topn_ctx_factory->create(driver_sequence),
+                                                            _sort_exec_exprs, _order_by_types, _materialized_tuple_desc);
+}
+
+void LocalPartitionTopnSinkOperatorFactory::close(RuntimeState* state) {
+    Expr::close(_partition_exprs, state);
+    _sort_exec_exprs.close(state);
+    OperatorFactory::close(state);
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,90 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include "column/vectorized_fwd.h"
+#include "exec/pipeline/operator.h"
+#include "exec/pipeline/sort/local_partition_topn_context.h"
+#include "exec/sort_exec_exprs.h"
+
+namespace starrocks::pipeline {
+
+/*
+ * LocalPartitionTopnSinkOperator keeps at most partition_limit rows of each partition of its input
+ * through the LocalPartitionTopnContext shared with the LocalPartitionTopnSourceOperator of the same driver.
+ */
+class LocalPartitionTopnSinkOperator final : public Operator {
+public:
+    LocalPartitionTopnSinkOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id,
+                                   LocalPartitionTopnContext* partition_topn_ctx, SortExecExprs& sort_exec_exprs,
+                                   const std::vector<OrderByType>& order_by_types,
+                                   TupleDescriptor* materialized_tuple_desc)
+            : Operator(factory, id, "local_partition_topn_sink", plan_node_id),
+              _partition_topn_ctx(partition_topn_ctx),
+              _sort_exec_exprs(sort_exec_exprs),
+              _order_by_types(order_by_types),
+              _materialized_tuple_desc(materialized_tuple_desc) {}
+
+    ~LocalPartitionTopnSinkOperator() override = default;
+
+    Status prepare(RuntimeState* state) override;
+
+    bool has_output() const override { return false; }
+
+    bool need_input() const override { return !is_finished(); }
+
+    bool is_finished() const override { return _is_finished; }
+
+    StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override;
+
+    Status push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) override;
+
+    Status set_finishing(RuntimeState* state) override;
+
+private:
+    bool _is_finished = false;
+
+    LocalPartitionTopnContext* _partition_topn_ctx;
+    SortExecExprs& _sort_exec_exprs;
+    const std::vector<OrderByType>& _order_by_types;
+    TupleDescriptor* _materialized_tuple_desc;
+
+    RuntimeProfile::Counter* _partition_num_counter = nullptr;
+};
+
+class LocalPartitionTopnSinkOperatorFactory final : public OperatorFactory {
+public:
+    LocalPartitionTopnSinkOperatorFactory(int32_t id, int32_t plan_node_id,
+                                          std::shared_ptr<LocalPartitionTopnContextFactory> partition_topn_ctx_factory,
+                                          SortExecExprs& sort_exec_exprs, const std::vector<OrderByType>& order_by_types,
+                                          TupleDescriptor* materialized_tuple_desc,
+                                          const RowDescriptor& parent_node_row_desc,
+                                          const RowDescriptor& parent_node_child_row_desc,
+                                          const std::vector<ExprContext*>& partition_exprs)
+            : OperatorFactory(id, "local_partition_topn_sink", plan_node_id),
+              _partition_topn_ctx_factory(std::move(partition_topn_ctx_factory)),
+              _sort_exec_exprs(sort_exec_exprs),
+              _order_by_types(order_by_types),
+              _materialized_tuple_desc(materialized_tuple_desc),
+              _parent_node_row_desc(parent_node_row_desc),
+              _parent_node_child_row_desc(parent_node_child_row_desc),
+              _partition_exprs(partition_exprs) {}
+
+    ~LocalPartitionTopnSinkOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
+
+    Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
+
+private:
+    std::shared_ptr<LocalPartitionTopnContextFactory> _partition_topn_ctx_factory;
+    SortExecExprs& _sort_exec_exprs;
+    const std::vector<OrderByType>& _order_by_types;
+    TupleDescriptor* _materialized_tuple_desc;
+    const RowDescriptor& _parent_node_row_desc;
+    const RowDescriptor& _parent_node_child_row_desc;
+    std::vector<ExprContext*> _partition_exprs;
+};
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,31 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/sort/local_partition_topn_source.h"
+
+#include "column/chunk.h"
+
+namespace starrocks::pipeline {
+
+bool LocalPartitionTopnSourceOperator::has_output() const {
+    return !_is_finished && _partition_topn_ctx->is_sink_complete() && !_partition_topn_ctx->is_output_finished();
+}
+
+bool LocalPartitionTopnSourceOperator::is_finished() const {
+    return _is_finished || _partition_topn_ctx->is_output_finished();
+}
+
+StatusOr<vectorized::ChunkPtr> LocalPartitionTopnSourceOperator::pull_chunk(RuntimeState* state) {
+    return _partition_topn_ctx->pull_chunk();
+}
+
+Status LocalPartitionTopnSourceOperator::set_finished(RuntimeState* state) {
+    _is_finished = true;
+    return Status::OK();
+}
+
+OperatorPtr LocalPartitionTopnSourceOperatorFactory::create(int32_t degree_of_parallelism, int32_t driver_sequence) {
+    return std::make_shared<LocalPartitionTopnSourceOperator>(this, _id, _plan_node_id,
+                                                              _partition_topn_ctx_factory->create(driver_sequence));
+}
+
+} // namespace starrocks::pipeline
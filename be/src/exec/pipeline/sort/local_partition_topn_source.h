@@ -0,0 +1,53 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include "column/vectorized_fwd.h"
+#include "exec/pipeline/sort/local_partition_topn_context.h"
+#include "exec/pipeline/source_operator.h"
+
+namespace starrocks::pipeline {
+
+/*
+ * LocalPartitionTopnSourceOperator outputs the rows kept by the LocalPartitionTopnSinkOperator of the same driver,
+ * partition by partition, after all the input is consumed.
+ */
+class LocalPartitionTopnSourceOperator final : public SourceOperator {
+public:
+    LocalPartitionTopnSourceOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id,
+                                     LocalPartitionTopnContext* partition_topn_ctx)
+            : SourceOperator(factory, id, "local_partition_topn_source", plan_node_id),
+              _partition_topn_ctx(partition_topn_ctx) {}
+
+    ~LocalPartitionTopnSourceOperator() override = default;
+
+    bool has_output() const override;
+
+    bool is_finished() const override;
+
+    StatusOr<vectorized::ChunkPtr> pull_chunk(RuntimeState* state) override;
+
+    Status set_finished(RuntimeState* state) override;
+
+private:
+    bool _is_finished = false;
+    LocalPartitionTopnContext* _partition_topn_ctx;
+};
+
+class LocalPartitionTopnSourceOperatorFactory final : public SourceOperatorFactory {
+public:
+    LocalPartitionTopnSourceOperatorFactory(
+            int32_t id, int32_t plan_node_id,
+            std::shared_ptr<LocalPartitionTopnContextFactory> partition_topn_ctx_factory)
+            : SourceOperatorFactory(id, "local_partition_topn_source", plan_node_id),
+              _partition_topn_ctx_factory(std::move(partition_topn_ctx_factory)) {}
+
+    ~LocalPartitionTopnSourceOperatorFactory() override = default;
+
+    OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override;
+
+private:
+    std::shared_ptr<LocalPartitionTopnContextFactory> _partition_topn_ctx_factory;
+};
+
+} // namespace starrocks::pipeline
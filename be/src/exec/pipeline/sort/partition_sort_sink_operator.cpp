@@ -41,6 +41,12 @@ Status PartitionSortSinkOperator::push_chunk(RuntimeState* state, const vectoriz
                                                                          _sort_exec_exprs, _order_by_types);
     RETURN_IF_ERROR(materialize_chunk);
     TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_chunks_sorter->update(state, materialize_chunk.value())));
+    if (_topn_filter != nullptr) {
+        Datum boundary;
+        if (_chunks_sorter->get_topn_boundary(&boundary)) {
+            _topn_filter->update(boundary);
+        }
+    }
     return Status::OK();
 }
 
@@ -77,9 +83,11 @@ OperatorPtr PartitionSortSinkOperatorFactory::create(int32_t dop, int32_t driver
                     _sort_keys, _offset, _limit, max_buffered_chunks);
         }
     } else {
-        chunks_sorter = std::make_unique<vectorized::ChunksSorterFullSort>(runtime_state(),
-                                                                           &(_sort_exec_exprs.lhs_ordering_expr_ctxs()),
-                                                                           &_is_asc_order, &_is_null_first, _sort_keys);
+        auto full_sorter = std::make_unique<vectorized::ChunksSorterFullSort>(
+                runtime_state(), &(_sort_exec_exprs.lhs_ordering_expr_ctxs()), &_is_asc_order, &_is_null_first,
+                _sort_keys);
+        full_sorter->set_spill_enabled(true);
+        chunks_sorter = std::move(full_sorter);
     }
     auto sort_context = _sort_context_factory->create(driver_sequence);
 
@@ -87,6 +95,7 @@ OperatorPtr PartitionSortSinkOperatorFactory::create(int32_t dop, int32_t driver
     auto ope = std::make_shared<PartitionSortSinkOperator>(
             this, _id, _plan_node_id, chunks_sorter, _sort_exec_exprs, _order_by_types, _materialized_tuple_desc,
             _parent_node_row_desc, _parent_node_child_row_desc, sort_context.get());
+    ope->set_topn_runtime_filter(_topn_filter.get());
     return ope;
 }
 
@@ -10,6 +10,7 @@
 #include "exec/vectorized/chunks_sorter.h"
 #include "exec/vectorized/chunks_sorter_full_sort.h"
 #include "exec/vectorized/chunks_sorter_topn.h"
+#include "exec/vectorized/topn_runtime_filter.h"
 
 namespace starrocks {
 class BufferControlBlock;
@@ -65,6 +66,8 @@ public:
 
     Status set_finishing(RuntimeState* state) override;
 
+    void set_topn_runtime_filter(TopnRuntimeFilter* topn_filter) { _topn_filter = topn_filter; }
+
 private:
     bool _is_finished = false;
 
@@ -82,6 +85,8 @@ private:
     const RowDescriptor& _parent_node_row_desc;
     const RowDescriptor& _parent_node_child_row_desc;
     SortContext* _sort_context;
+    // Owned by the factory, nullptr if the boundary is not published.
+    TopnRuntimeFilter* _topn_filter = nullptr;
 };
 
 class PartitionSortSinkOperatorFactory final : public OperatorFactory {
@@ -113,6 +118,11 @@ public:
     Status prepare(RuntimeState* state) override;
     void close(RuntimeState* state) override;
 
+    // Publishes the boundary of the top-n rows to the scan below.
+    void set_topn_runtime_filter(std::shared_ptr<TopnRuntimeFilter> topn_filter) {
+        _topn_filter = std::move(topn_filter);
+    }
+
 private:
     std::shared_ptr<SortContextFactory> _sort_context_factory;
     // _sort_exec_exprs contains the ordering expressions
@@ -131,6 +141,7 @@ private:
     const RowDescriptor& _parent_node_row_desc;
     const RowDescriptor& _parent_node_child_row_desc;
     std::vector<ExprContext*> _analytic_partition_exprs;
+    std::shared_ptr<TopnRuntimeFilter> _topn_filter;
 };
 
 } // namespace pipeline
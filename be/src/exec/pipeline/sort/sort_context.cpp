@@ -2,8 +2,57 @@
 
 #include "exec/pipeline/sort/sort_context.h"
 
+#include "gutil/casts.h"
+#include "gutil/strings/substitute.h"
+
 namespace starrocks {
 namespace pipeline {
+
+StatusOr<ChunkPtr> SortContext::_pull_merged_chunk() {
+    if (_merge_cascade == nullptr) {
+        std::vector<std::unique_ptr<SimpleChunkSortCursor>> cursors;
+        for (auto& chunks_sorter : _chunks_sorter_partions) {
+            // only full sort spills, which is used if there is no limit.
+            down_cast<ChunksSorterFullSort*>(chunks_sorter.get())->create_sorted_cursors(&cursors);
+        }
+        DCHECK(!cursors.empty());
+        _merge_cascade = std::make_unique<MergeCursorsCascade>();
+        RETURN_IF_ERROR(_merge_cascade->init(_comparer.sort_descs(), std::move(cursors)));
+        CHECK(_merge_cascade->is_data_ready());
+    }
+
+    if (_merged_chunk == nullptr) {
+        while (_merged_chunk == nullptr && !_merge_cascade->is_eos()) {
+            ChunkUniquePtr chunk = _merge_cascade->try_get_next();
+            if (chunk != nullptr && chunk->num_rows() > 0) {
+                _merged_chunk = std::move(chunk);
+                _merged_chunk_offset = 0;
+            }
+        }
+        for (auto& chunks_sorter : _chunks_sorter_partions) {
+            RETURN_IF_ERROR(down_cast<ChunksSorterFullSort*>(chunks_sorter.get())->spill_status());
+        }
+        if (_merged_chunk == nullptr) {
+            return Status::InternalError(strings::Substitute("sort merged $0 rows, but $1 rows are expected",
+                                                             _next_output_row, _require_rows));
+        }
+    }
+
+    size_t count = std::min<size_t>(_state->chunk_size(), _merged_chunk->num_rows() - _merged_chunk_offset);
+    ChunkPtr result;
+    if (_merged_chunk_offset == 0 && count == _merged_chunk->num_rows()) {
+        result = std::move(_merged_chunk);
+    } else {
+        result = _merged_chunk->clone_empty_with_slot(count);
+        result->append(*_merged_chunk, _merged_chunk_offset, count);
+        _merged_chunk_offset += count;
+        if (_merged_chunk_offset >= _merged_chunk->num_rows()) {
+            _merged_chunk.reset();
+        }
+    }
+    _next_output_row += count;
+    return result;
+}
 SortContextFactory::SortContextFactory(RuntimeState* state, bool is_merging, int64_t limit, int32_t num_right_sinkers,
                                        const std::vector<bool>& is_asc_order, const std::vector<bool>& is_null_first)
         : _state(state),
@@ -12,6 +12,7 @@
 #include "exec/vectorized/chunks_sorter.h"
 #include "exec/vectorized/chunks_sorter_full_sort.h"
 #include "exec/vectorized/chunks_sorter_topn.h"
+#include "exec/vectorized/sorting/merge.h"
 
 namespace starrocks {
 namespace vectorized {
@@ -52,7 +53,12 @@ public:
         if (is_partions_finish) {
             _require_rows = ((_limit < 0) ? _total_rows.load(std::memory_order_relaxed)
                                           : std::min(_limit, _total_rows.load(std::memory_order_relaxed)));
-            _heapify_chunks_sorter();
+            _use_merge_cascade =
+                    _limit < 0 && std::any_of(_chunks_sorter_partions.begin(), _chunks_sorter_partions.end(),
+                                              [](const auto& chunks_sorter) { return chunks_sorter->has_spilled(); });
+            if (!_use_merge_cascade) {
+                _heapify_chunks_sorter();
+            }
             _is_partions_finish = true;
         }
 
@@ -63,7 +69,10 @@ public:
 
     // Dispatch logic for full sort and topn,
     // provide different index parrterns through lambda expression.
-    ChunkPtr pull_chunk() {
+    StatusOr<ChunkPtr> pull_chunk() {
+        if (_use_merge_cascade) {
+            return _pull_merged_chunk();
+        }
         if (_limit < 0) {
             return pull_chunk([](DataSegment* min_heap_entry) -> uint32_t {
                 return (*min_heap_entry->_sorted_permutation)[min_heap_entry->_next_output_row++].index_in_chunk;
@@ -172,6 +181,8 @@ private:
             }
         }
 
+        SortDescs sort_descs() const { return SortDescs(_sort_order_flag, _null_first_flag); }
+
         bool operator()(const DataSegment* a, const DataSegment* b) {
             // We used different index pattern for topn and full sort.
             if (_is_topn) {
@@ -238,6 +249,16 @@ private:
         }
     }
 
+    // External sort: if any partition has spilled sorted runs to disk, the sorted runs of all the partitions
+    // are merged by MergeCursorsCascade and output in a streaming manner, instead of the heap of DataSegments.
+    StatusOr<ChunkPtr> _pull_merged_chunk();
+
+    mutable bool _use_merge_cascade = false;
+    std::unique_ptr<MergeCursorsCascade> _merge_cascade;
+    // The chunk produced by the merger may be larger than chunk_size, so it is output piece by piece.
+    ChunkPtr _merged_chunk;
+    size_t _merged_chunk_offset = 0;
+
     size_t _next_output_row = 0;
 };
 class SortContextFactory;
@@ -2,6 +2,9 @@
 
 #include "table_function_operator.h"
 
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+
 namespace starrocks::pipeline {
 
 void TableFunctionOperator::close(RuntimeState* state) {
@@ -85,76 +88,54 @@ Status TableFunctionOperator::prepare(RuntimeState* state) {
 StatusOr<vectorized::ChunkPtr> TableFunctionOperator::pull_chunk(RuntimeState* state) {
     DCHECK(_input_chunk != nullptr);
     size_t chunk_size = state->chunk_size();
-    size_t remain_chunk_size = chunk_size;
-    std::vector<vectorized::ColumnPtr> output_columns;
+    size_t num_input_rows = _input_chunk->num_rows();
 
     _process_table_function();
 
-    output_columns.reserve(_outer_slots.size());
-    for (int _outer_slot : _outer_slots) {
-        output_columns.emplace_back(_input_chunk->get_column_by_slot_id(_outer_slot)->clone_empty());
-    }
-    for (size_t i = 0; i < _fn_result_slots.size(); ++i) {
-        output_columns.emplace_back(_table_function_result.first[i]->clone_empty());
-    }
-
-    //If _remain_repeat_times > 0, first use the remaining data of the previous chunk to construct this data
-    while (_remain_repeat_times > 0 || _input_chunk_index < _input_chunk->num_rows()) {
-        bool has_remain_repeat_times = _remain_repeat_times > 0;
-
-        if (!has_remain_repeat_times) {
-            _remain_repeat_times = _table_function_result.second->get(_input_chunk_index + 1).get_int32() -
-                                   _table_function_result.second->get(_input_chunk_index).get_int32();
-        }
-        size_t repeat_times = std::min(_remain_repeat_times, remain_chunk_size);
-        if (repeat_times == 0) {
-            ++_input_chunk_index;
-            continue;
-        }
+    const auto& offsets = down_cast<vectorized::UInt32Column*>(_table_function_result.second.get())->get_data();
+    //If _remain_repeat_times > 0, the results of the current row are partially output by the previous chunk
+    uint32_t result_start = _remain_repeat_times > 0 ? offsets[_input_chunk_index + 1] - _remain_repeat_times
+                                                     : offsets[_input_chunk_index];
 
-        //Build outer data, repeat multiple times
-        for (size_t i = 0; i < _outer_slots.size(); ++i) {
-            vectorized::ColumnPtr& input_column_ptr = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
-            vectorized::Datum value = input_column_ptr->get(_input_chunk_index);
-            if (value.is_null()) {
-                DCHECK(output_columns[i]->is_nullable());
-                down_cast<vectorized::NullableColumn*>(output_columns[i].get())->append_nulls(repeat_times);
-            } else {
-                output_columns[i]->append_value_multiple_times(&value, repeat_times);
-            }
-        }
-        //Build table function result
-        for (size_t i = 0; i < _fn_result_slots.size(); ++i) {
-            uint32_t start_offset;
-            if (has_remain_repeat_times) {
-                start_offset =
-                        _table_function_result.second->get(_input_chunk_index + 1).get_int32() - _remain_repeat_times;
-            } else {
-                start_offset = _table_function_result.second->get(_input_chunk_index).get_int32();
-            }
-            output_columns[_outer_slots.size() + i]->append(*(_table_function_result.first[i]), start_offset,
-                                                            repeat_times);
+    // The results of the consecutive input rows are also consecutive, so only the indexes of the outer rows
+    // repeated by the output rows are collected here, and then the output columns are built in bulk.
+    _outer_row_indexes.clear();
+    while (_outer_row_indexes.size() < chunk_size && _input_chunk_index < num_input_rows) {
+        if (_remain_repeat_times == 0) {
+            _remain_repeat_times = offsets[_input_chunk_index + 1] - offsets[_input_chunk_index];
         }
-
-        remain_chunk_size -= repeat_times;
+        size_t repeat_times = std::min(_remain_repeat_times, chunk_size - _outer_row_indexes.size());
+        _outer_row_indexes.insert(_outer_row_indexes.end(), repeat_times, _input_chunk_index);
         _remain_repeat_times -= repeat_times;
         if (_remain_repeat_times == 0) {
             ++_input_chunk_index;
         }
+    }
+    auto num_output_rows = static_cast<uint32_t>(_outer_row_indexes.size());
 
-        if (remain_chunk_size == 0) {
-            // Chunk is full
-            break;
-        }
+    std::vector<vectorized::ColumnPtr> output_columns;
+    output_columns.reserve(_outer_slots.size() + _fn_result_slots.size());
+    for (SlotId outer_slot : _outer_slots) {
+        const vectorized::ColumnPtr& input_column = _input_chunk->get_column_by_slot_id(outer_slot);
+        vectorized::ColumnPtr output_column = input_column->clone_empty();
+        output_column->append_selective(*input_column, _outer_row_indexes.data(), 0, num_output_rows);
+        output_columns.emplace_back(std::move(output_column));
+    }
+    for (size_t i = 0; i < _fn_result_slots.size(); ++i) {
+        vectorized::ColumnPtr output_column = _table_function_result.first[i]->clone_empty();
+        output_column->append(*_table_function_result.first[i], result_start, num_output_rows);
+        output_columns.emplace_back(std::move(output_column));
     }
 
     // Current input chunk has been processed, clean the state to be ready for next input chunk
-    if (_remain_repeat_times == 0 && _input_chunk_index >= _input_chunk->num_rows()) {
+    if (_remain_repeat_times == 0 && _input_chunk_index >= num_input_rows) {
         _input_chunk = nullptr;
     }
 
     // Just return the chunk whether its full or not in order to keep the semantics of pipeline
-    return _build_chunk(output_columns);
+    vectorized::ChunkPtr chunk = _build_chunk(output_columns);
+    RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, chunk.get()));
+    return chunk;
 }
 
 Status TableFunctionOperator::push_chunk(RuntimeState* state, const vectorized::ChunkPtr& chunk) {
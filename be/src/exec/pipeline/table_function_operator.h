@@ -12,8 +12,9 @@
 namespace starrocks::pipeline {
 class TableFunctionOperator final : public Operator {
 public:
-    TableFunctionOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, const TPlanNode& tnode)
-            : Operator(factory, id, "table_function", plan_node_id), _tnode(tnode) {}
+    TableFunctionOperator(OperatorFactory* factory, int32_t id, int32_t plan_node_id, const TPlanNode& tnode,
+                          const std::vector<ExprContext*>& conjunct_ctxs)
+            : Operator(factory, id, "table_function", plan_node_id), _tnode(tnode), _conjunct_ctxs(conjunct_ctxs) {}
 
     ~TableFunctionOperator() override = default;
 
@@ -38,6 +39,8 @@ private:
     void _process_table_function();
 
     const TPlanNode& _tnode;
+    // The predicates on the output of the table function, evaluated before the chunk is returned.
+    const std::vector<ExprContext*>& _conjunct_ctxs;
     const vectorized::TableFunction* _table_function = nullptr;
 
     //Slots of output by table function
@@ -55,6 +58,8 @@ private:
     size_t _input_chunk_index = 0;
     //The current outer line needs to be repeated several times
     size_t _remain_repeat_times = 0;
+    //Indexes of the outer rows repeated by the output rows, reused by each pull_chunk
+    std::vector<uint32_t> _outer_row_indexes;
     //table function result
     std::pair<vectorized::Columns, vectorized::ColumnPtr> _table_function_result;
     //table function return result end ?
@@ -70,15 +75,19 @@ private:
 
 class TableFunctionOperatorFactory final : public OperatorFactory {
 public:
-    TableFunctionOperatorFactory(int32_t id, int32_t plan_node_id, const TPlanNode& tnode)
-            : OperatorFactory(id, "table_function", plan_node_id), _tnode(tnode) {}
+    TableFunctionOperatorFactory(int32_t id, int32_t plan_node_id, const TPlanNode& tnode,
+                                 std::vector<ExprContext*>&& conjunct_ctxs)
+            : OperatorFactory(id, "table_function", plan_node_id),
+              _tnode(tnode),
+              _conjunct_ctxs(std::move(conjunct_ctxs)) {}
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
-        return std::make_shared<TableFunctionOperator>(this, _id, _plan_node_id, _tnode);
+        return std::make_shared<TableFunctionOperator>(this, _id, _plan_node_id, _tnode, _conjunct_ctxs);
     }
 
 private:
     const TPlanNode& _tnode;
+    std::vector<ExprContext*> _conjunct_ctxs;
 };
 
 } // namespace starrocks::pipeline
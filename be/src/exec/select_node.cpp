@@ -24,6 +24,7 @@
 #include "exec/pipeline/limit_operator.h"
 #include "exec/pipeline/pipeline_builder.h"
 #include "exec/pipeline/select_operator.h"
+#include "exec/vectorized/olap_scan_node.h"
 #include "exprs/expr.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/raw_value.h"
@@ -97,6 +98,18 @@ Status SelectNode::close(RuntimeState* state) {
 pipeline::OpFactories SelectNode::decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
     using namespace pipeline;
 
+    // A select right above an olap scan is fused into the scan, which saves an operator for each chunk,
+    // unless the select has its own runtime filters to evaluate.
+    auto* olap_scan_node = dynamic_cast<vectorized::OlapScanNode*>(_children[0]);
+    if (olap_scan_node != nullptr && runtime_filter_collector().empty() && local_rf_waiting_set().empty() &&
+        olap_scan_node->absorb_conjuncts(&_conjunct_ctxs)) {
+        OpFactories operators = olap_scan_node->decompose_to_pipeline(context);
+        if (limit() != -1) {
+            operators.emplace_back(std::make_shared<LimitOperatorFactory>(context->next_operator_id(), id(), limit()));
+        }
+        return operators;
+    }
+
     OpFactories operators = _children[0]->decompose_to_pipeline(context);
 
     operators.emplace_back(
@@ -21,6 +21,7 @@
 
 #include "exec/tablet_sink.h"
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 
@@ -28,6 +29,7 @@
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
+#include "common/tracer.h"
 #include "exprs/expr.h"
 #include "gutil/strings/fastmem.h"
 #include "gutil/strings/substitute.h"
@@ -101,6 +103,16 @@ Status NodeChannel::init(RuntimeState* state) {
     _cur_request.set_sender_id(_parent->_sender_id);
     _cur_request.set_eos(false);
 
+    // The span of the channel is in the trace of the load, the spans of the tablets channel on the receiver
+    // are its children.
+    auto load_trace_context = Tracer::Instance().query_trace_context(UniqueId(_parent->_load_id).to_thrift());
+    _span = Tracer::Instance().add_span("node_channel", load_trace_context);
+    if (_span->IsRecording()) {
+        _span->SetAttribute("node_id", _node_id);
+        _span->SetAttribute("index_id", _index_id);
+        _cur_request.set_trace_parent(Tracer::to_trace_parent(_span->GetContext()));
+    }
+
     _rpc_timeout_ms = state->query_options().query_timeout * 1000;
 
     if (state->query_options().__isset.transmission_compression_type) {
@@ -114,6 +126,9 @@ Status NodeChannel::init(RuntimeState* state) {
             _err_st = Status::InternalError(fmt::format("load_dop should between [1-%ld]", config::max_load_dop));
             return _err_st;
         }
+    } else {
+        _max_parallel_request_size = std::clamp<int64_t>(config::olap_table_sink_default_parallel_request_size, 1,
+                                                         config::max_load_dop);
     }
 
     // init add_chunk request closure
@@ -122,6 +137,7 @@ Status NodeChannel::init(RuntimeState* state) {
         closure->ref();
         _add_batch_closures.emplace_back(closure);
     }
+    _add_batch_closure_packet_seqs.assign(_max_parallel_request_size, -1);
 
     // for get global_dict
     _runtime_state = state;
@@ -308,10 +324,6 @@ Status NodeChannel::add_chunk(vectorized::Chunk* input, const int64_t* tablet_id
     AddChunkReq add_chunk = std::move(_chunk_queue.front());
     _chunk_queue.pop_front();
 
-    RETURN_IF_ERROR(_wait_one_prev_request());
-
-    SCOPED_RAW_TIMER(&_actual_consume_ns);
-
     auto request = add_chunk.second;
     auto chunk = std::move(add_chunk.first);
 
@@ -322,20 +334,36 @@ Status NodeChannel::add_chunk(vectorized::Chunk* input, const int64_t* tablet_id
         for (auto pid : _parent->_partition_ids) {
             request.add_partition_ids(pid);
         }
-
-        // eos request must be the last request
-        _send_finished = true;
     }
 
     request.set_packet_seq(_next_packet_seq);
+    // Serialize and compress the chunk while the previous requests are still in flight.
     if (LIKELY(chunk->num_rows() > 0)) {
+        SCOPED_RAW_TIMER(&_actual_consume_ns);
         auto pchunk = request.mutable_chunk();
         RETURN_IF_ERROR(_serialize_chunk(chunk.get(), pchunk));
     }
 
+    RETURN_IF_ERROR(_wait_one_prev_request());
+
+    SCOPED_RAW_TIMER(&_actual_consume_ns);
+
+    if (UNLIKELY(eos)) {
+        // eos request must be the last request
+        _send_finished = true;
+    }
+
+    _add_batch_closure_packet_seqs[_current_request_index] = _next_packet_seq;
     _add_batch_closures[_current_request_index]->ref();
     _add_batch_closures[_current_request_index]->reset();
     _add_batch_closures[_current_request_index]->cntl.set_timeout_ms(_rpc_timeout_ms);
+    if (request.has_chunk() && config::olap_table_sink_send_chunk_in_attachment) {
+        SCOPED_TIMER(_parent->_append_attachment_timer);
+        auto pchunk = request.mutable_chunk();
+        pchunk->set_data_size(pchunk->data().size());
+        _add_batch_closures[_current_request_index]->cntl.request_attachment().append(pchunk->data());
+        pchunk->clear_data();
+    }
 
     _stub->tablet_writer_add_chunk(&_add_batch_closures[_current_request_index]->cntl, &request,
                                    &_add_batch_closures[_current_request_index]->result,
@@ -368,6 +396,10 @@ Status NodeChannel::_wait_request(ReusableClosure<PTabletWriterAddBatchResult>*
         _add_batch_counter.add_batch_wait_lock_time_us += closure->result.wait_lock_time_us();
         _add_batch_counter.add_batch_num++;
     }
+    _add_batch_counter.add_batch_deserialize_time_us += closure->result.deserialize_time_us();
+    if (closure->result.reused_chunk()) {
+        _add_batch_counter.add_batch_reused_chunk_num++;
+    }
 
     for (auto& tablet : closure->result.tablet_vec()) {
         TTabletCommitInfo commit_info;
@@ -440,9 +472,13 @@ Status NodeChannel::_wait_one_prev_request() {
         }
     }
 
-    // 3. waiting one request
-    // TODO(meegoo): optimize to wait first finish request
+    // 3. waiting the earliest sent request, which is the most likely one to finish first
     _current_request_index = 0;
+    for (size_t i = 1; i < _max_parallel_request_size; i++) {
+        if (_add_batch_closure_packet_seqs[i] < _add_batch_closure_packet_seqs[_current_request_index]) {
+            _current_request_index = i;
+        }
+    }
     RETURN_IF_ERROR(_wait_request(_add_batch_closures[_current_request_index]));
 
     return Status::OK();
@@ -460,6 +496,7 @@ Status NodeChannel::close_wait(RuntimeState* state) {
 
     // 2. wait eos request finish
     RETURN_IF_ERROR(_wait_all_prev_request());
+    _span->End();
 
     // 3. commit tablet infos
     state->tablet_commit_infos().insert(state->tablet_commit_infos().end(),
@@ -656,6 +693,8 @@ Status OlapTableSink::prepare(RuntimeState* state) {
     _wait_response_timer = ADD_TIMER(_profile, "WaitResponseTime");
     _compress_timer = ADD_TIMER(_profile, "CompressTime");
     _append_attachment_timer = ADD_TIMER(_profile, "AppendAttachmentTime");
+    _receiver_deserialize_chunk_timer = ADD_TIMER(_profile, "ReceiverDeserializeChunkTime");
+    _receiver_reused_chunk_counter = ADD_COUNTER(_profile, "ReceiverReusedChunkNum", TUnit::UNIT);
     _mark_tablet_timer = ADD_TIMER(_profile, "MarkTabletTime");
     _pack_chunk_timer = ADD_TIMER(_profile, "PackChunkTime");
 
@@ -915,6 +954,12 @@ Status OlapTableSink::close(RuntimeState* state, Status close_status) {
         COUNTER_SET(_convert_chunk_timer, _convert_batch_ns);
         COUNTER_SET(_validate_data_timer, _validate_data_ns);
         COUNTER_SET(_serialize_chunk_timer, serialize_batch_ns);
+        AddBatchCounter total_add_batch_counter;
+        for (auto const& pair : node_add_batch_counter_map) {
+            total_add_batch_counter += pair.second;
+        }
+        COUNTER_SET(_receiver_deserialize_chunk_timer, total_add_batch_counter.add_batch_deserialize_time_us * 1000);
+        COUNTER_SET(_receiver_reused_chunk_counter, total_add_batch_counter.add_batch_reused_chunk_num);
         // _number_input_rows don't contain num_rows_load_filtered and num_rows_load_unselected in scan node
         int64_t num_rows_load_total =
                 _number_input_rows + state->num_rows_load_filtered() + state->num_rows_load_unselected();
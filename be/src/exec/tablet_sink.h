@@ -31,6 +31,7 @@
 
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "common/tracer.h"
 #include "exec/data_sink.h"
 #include "exec/tablet_info.h"
 #include "exec/vectorized/tablet_info.h"
@@ -64,10 +65,16 @@ struct AddBatchCounter {
     int64_t add_batch_wait_lock_time_us = 0;
     // number of add_batch call
     int64_t add_batch_num = 0;
+    // time of deserializing the chunks in the receiver
+    int64_t add_batch_deserialize_time_us = 0;
+    // number of chunks deserialized into the column buffers reused by the receiver
+    int64_t add_batch_reused_chunk_num = 0;
     AddBatchCounter& operator+=(const AddBatchCounter& rhs) {
         add_batch_execution_time_us += rhs.add_batch_execution_time_us;
         add_batch_wait_lock_time_us += rhs.add_batch_wait_lock_time_us;
         add_batch_num += rhs.add_batch_num;
+        add_batch_deserialize_time_us += rhs.add_batch_deserialize_time_us;
+        add_batch_reused_chunk_num += rhs.add_batch_reused_chunk_num;
         return *this;
     }
     friend AddBatchCounter operator+(const AddBatchCounter& lhs, const AddBatchCounter& rhs) {
@@ -204,7 +211,10 @@ private:
 
     size_t _max_parallel_request_size = 1;
     std::vector<ReusableClosure<PTabletWriterAddBatchResult>*> _add_batch_closures;
+    // The packet_seq of the last request sent by each closure, -1 if none.
+    std::vector<int64_t> _add_batch_closure_packet_seqs;
     PTabletWriterAddChunkRequest _cur_request;
+    Span _span;
     std::unique_ptr<vectorized::Chunk> _cur_chunk;
     using AddChunkReq = std::pair<std::unique_ptr<vectorized::Chunk>, PTabletWriterAddChunkRequest>;
     std::deque<AddChunkReq> _chunk_queue;
@@ -374,6 +384,8 @@ private:
     RuntimeProfile::Counter* _wait_response_timer = nullptr;
     RuntimeProfile::Counter* _compress_timer = nullptr;
     RuntimeProfile::Counter* _append_attachment_timer = nullptr;
+    RuntimeProfile::Counter* _receiver_deserialize_chunk_timer = nullptr;
+    RuntimeProfile::Counter* _receiver_reused_chunk_counter = nullptr;
     RuntimeProfile::Counter* _mark_tablet_timer = nullptr;
     RuntimeProfile::Counter* _pack_chunk_timer = nullptr;
 
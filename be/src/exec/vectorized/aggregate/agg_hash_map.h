@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <type_traits>
 
@@ -54,6 +55,12 @@ using FixedSize8SliceAggHashMap = phmap::flat_hash_map<SliceKey8, AggDataPtr, Fi
 template <PhmapSeed seed>
 using FixedSize16SliceAggHashMap =
         phmap::flat_hash_map<SliceKey16, AggDataPtr, FixedSizeSliceKeyHash<SliceKey16, seed>>;
+template <PhmapSeed seed>
+using FixedSize24SliceAggHashMap =
+        phmap::flat_hash_map<SliceKey24, AggDataPtr, FixedSizeSliceKeyHash<SliceKey24, seed>>;
+template <PhmapSeed seed>
+using FixedSize32SliceAggHashMap =
+        phmap::flat_hash_map<SliceKey32, AggDataPtr, FixedSizeSliceKeyHash<SliceKey32, seed>>;
 
 // =====================
 // two level agg hash map
@@ -68,6 +75,39 @@ using SliceAggTwoLevelHashMap =
         phmap::parallel_flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual,
                                       phmap::priv::Allocator<phmap::priv::Pair<const Slice, AggDataPtr>>, PHMAPN>;
 
+template <typename HashMap>
+struct is_two_level_hash_map : std::false_type {};
+template <class K, class V, class Hash, class Eq, class Alloc, size_t N, class Mutex, bool balance>
+struct is_two_level_hash_map<phmap::parallel_flat_hash_map<K, V, Hash, Eq, Alloc, N, Mutex, balance>>
+        : std::true_type {};
+template <typename HashMap>
+inline constexpr bool is_two_level_hash_map_v = is_two_level_hash_map<HashMap>::value;
+
+// The statistics of the streaming pre-aggregation by the sub maps of a two-level hash map.
+// Once the hash map is full and reduces the input poorly overall, the new keys of the sub maps which still
+// reduce their input well, e.g. of the hot keys in a skewed input, are aggregated, while the new keys of the
+// others are streamed.
+struct AggHashMapPartitionStats {
+    static constexpr size_t MAX_PARTITIONS = 1 << PHMAPN;
+    // The statistics of a partition are halved when it has this many input rows, to follow the recent input.
+    static constexpr double DECAY_INPUT_ROWS = 65536;
+    // The number of the input rows of a partition to decide whether to aggregate its new keys.
+    static constexpr double MIN_INPUT_ROWS = 1024;
+
+    // the decayed number of the input rows, and of the input rows of the keys not in the hash map
+    std::array<double, MAX_PARTITIONS> input_rows{};
+    std::array<double, MAX_PARTITIONS> new_key_rows{};
+    // insert the new keys of the partition into the hash map instead of streaming them
+    std::array<uint8_t, MAX_PARTITIONS> aggregating{};
+    // the number of the input rows of the new keys inserted into the hash map instead of streamed
+    int64_t aggregated_new_key_rows = 0;
+
+    void update(size_t partition, bool is_new_key) {
+        input_rows[partition] += 1;
+        new_key_rows[partition] += is_new_key;
+    }
+};
+
 // This is just an empirical value based on benchmark, and you can tweak it if more proper value is found.
 static constexpr size_t AGG_HASH_MAP_DEFAULT_PREFETCH_DIST = 16;
 
@@ -89,6 +129,17 @@ static_assert(sizeof(AggDataPtr) == sizeof(size_t));
         hash_map.prefetch_hash(hash_values[__prefetch_index++]); \
     }
 
+// The one-level and two-level hash maps take the arguments of lazy_emplace_with_hash in different orders.
+template <typename HashMap, typename Key, typename Func>
+typename HashMap::iterator agg_hash_map_lazy_emplace_with_hash(HashMap& hash_map, const Key& key, size_t hashval,
+                                                               Func&& f) {
+    if constexpr (is_two_level_hash_map_v<HashMap>) {
+        return hash_map.lazy_emplace_with_hash(hashval, key, std::forward<Func>(f));
+    } else {
+        return hash_map.lazy_emplace_with_hash(key, hashval, std::forward<Func>(f));
+    }
+}
+
 // ==============================================================
 // TODO(kks): Remove redundant code for compute_agg_states method
 // handle one number hash key
@@ -116,7 +167,7 @@ struct AggHashMapWithOneNumberKey {
             AGG_HASH_MAP_PREFETCH_HASH_VALUE();
 
             FieldType key = column->get_data()[i];
-            auto iter = hash_map.lazy_emplace_with_hash(key, hash_values[i], [&](const auto& ctor) {
+            auto iter = agg_hash_map_lazy_emplace_with_hash(hash_map, key, hash_values[i], [&](const auto& ctor) {
                 AggDataPtr pv = allocate_func();
                 ctor(key, pv);
             });
@@ -160,11 +211,61 @@ struct AggHashMapWithOneNumberKey {
         DCHECK(!key_columns[0]->is_nullable());
         (*not_founds).assign(chunk_size, 0);
         auto column = down_cast<ColumnType*>(key_columns[0].get());
+        const auto& keys = column->get_data();
+
+        if (hash_map.bucket_count() < prefetch_threhold) {
+            for (size_t i = 0; i < chunk_size; i++) {
+                if (auto iter = hash_map.find(keys[i]); iter != hash_map.end()) {
+                    (*agg_states)[i] = iter->second;
+                } else {
+                    (*not_founds)[i] = 1;
+                }
+            }
+            return;
+        }
+
+        hash_values.resize(chunk_size);
+        for (size_t i = 0; i < chunk_size; i++) {
+            hash_values[i] = hash_map.hash_function()(keys[i]);
+        }
+        size_t prefetch_index = AGG_HASH_MAP_DEFAULT_PREFETCH_DIST;
+        for (size_t i = 0; i < chunk_size; i++) {
+            if (prefetch_index < chunk_size) {
+                hash_map.prefetch_hash(hash_values[prefetch_index++]);
+            }
+            if (auto iter = hash_map.find(keys[i], hash_values[i]); iter != hash_map.end()) {
+                (*agg_states)[i] = iter->second;
+            } else {
+                (*not_founds)[i] = 1;
+            }
+        }
+    }
+
+    // Like the one above, but the new keys of the partitions (sub maps) marked to aggregate in |stats| are
+    // inserted into the two-level hash map, and the statistics of the partitions are updated.
+    template <typename Func>
+    void compute_agg_states_by_partition(size_t chunk_size, const Columns& key_columns, MemPool* pool,
+                                         Func&& allocate_func, Buffer<AggDataPtr>* agg_states,
+                                         std::vector<uint8_t>* not_founds, AggHashMapPartitionStats* stats) {
+        static_assert(is_two_level_hash_map_v<HashMap>);
+        DCHECK(!key_columns[0]->is_nullable());
+        DCHECK_LE(hash_map.subcnt(), AggHashMapPartitionStats::MAX_PARTITIONS);
+        (*not_founds).assign(chunk_size, 0);
+        auto column = down_cast<ColumnType*>(key_columns[0].get());
 
         for (size_t i = 0; i < chunk_size; i++) {
             FieldType key = column->get_data()[i];
-            if (auto iter = hash_map.find(key); iter != hash_map.end()) {
+            size_t hashval = hash_map.hash(key);
+            size_t partition = hash_map.subidx(hashval);
+            auto iter = hash_map.find(key, hashval);
+            stats->update(partition, iter == hash_map.end());
+            if (iter != hash_map.end()) {
+                (*agg_states)[i] = iter->second;
+            } else if (stats->aggregating[partition]) {
+                iter = hash_map.lazy_emplace_with_hash(hashval, key,
+                                                       [&](const auto& ctor) { ctor(key, allocate_func()); });
                 (*agg_states)[i] = iter->second;
+                stats->aggregated_new_key_rows++;
             } else {
                 (*not_founds)[i] = 1;
             }
@@ -178,6 +279,7 @@ struct AggHashMapWithOneNumberKey {
 
     static constexpr bool has_single_null_key = false;
 
+    Buffer<size_t> hash_values;
     ResultVector results;
 };
 
@@ -327,7 +429,7 @@ struct AggHashMapWithOneStringKey {
         for (size_t i = 0; i < column_size; i++) {
             AGG_HASH_MAP_PREFETCH_HASH_VALUE();
             auto key = column->get_slice(i);
-            auto iter = hash_map.lazy_emplace_with_hash(key, hash_values[i], [&](const auto& ctor) {
+            auto iter = agg_hash_map_lazy_emplace_with_hash(hash_map, key, hash_values[i], [&](const auto& ctor) {
                 uint8_t* pos = pool->allocate(key.size);
                 strings::memcpy_inlined(pos, key.data, key.size);
                 Slice pk{pos, key.size};
@@ -378,9 +480,29 @@ struct AggHashMapWithOneStringKey {
         auto* column = ColumnHelper::as_raw_column<BinaryColumn>(key_columns[0]);
         not_founds->assign(chunk_size, 0);
 
+        if (hash_map.bucket_count() < prefetch_threhold) {
+            for (size_t i = 0; i < chunk_size; i++) {
+                auto key = column->get_slice(i);
+                if (auto iter = hash_map.find(key); iter != hash_map.end()) {
+                    (*agg_states)[i] = iter->second;
+                } else {
+                    (*not_founds)[i] = 1;
+                }
+            }
+            return;
+        }
+
+        hash_values.resize(chunk_size);
+        for (size_t i = 0; i < chunk_size; i++) {
+            hash_values[i] = hash_map.hash_function()(column->get_slice(i));
+        }
+        size_t prefetch_index = AGG_HASH_MAP_DEFAULT_PREFETCH_DIST;
         for (size_t i = 0; i < chunk_size; i++) {
+            if (prefetch_index < chunk_size) {
+                hash_map.prefetch_hash(hash_values[prefetch_index++]);
+            }
             auto key = column->get_slice(i);
-            if (auto iter = hash_map.find(key); iter != hash_map.end()) {
+            if (auto iter = hash_map.find(key, hash_values[i]); iter != hash_map.end()) {
                 (*agg_states)[i] = iter->second;
             } else {
                 (*not_founds)[i] = 1;
@@ -395,6 +517,7 @@ struct AggHashMapWithOneStringKey {
     }
 
     static constexpr bool has_single_null_key = false;
+    Buffer<size_t> hash_values;
     ResultVector results;
 };
 
@@ -556,16 +679,26 @@ struct AggHashMapWithSerializedKey {
             key_column->serialize_batch(buffer, slice_sizes, chunk_size, max_one_row_size);
         }
 
+        if (hash_map.bucket_count() < prefetch_threhold) {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                Slice key = {buffer + i * max_one_row_size, slice_sizes[i]};
+                auto iter = hash_map.lazy_emplace(
+                        key, [&](const auto& ctor) { ctor(_persist_key(key, pool), allocate_func()); });
+                (*agg_states)[i] = iter->second;
+            }
+            return;
+        }
+
+        _compute_hash_values(chunk_size);
+        size_t prefetch_index = AGG_HASH_MAP_DEFAULT_PREFETCH_DIST;
         for (size_t i = 0; i < chunk_size; ++i) {
+            if (prefetch_index < chunk_size) {
+                hash_map.prefetch_hash(hash_values[prefetch_index++]);
+            }
             Slice key = {buffer + i * max_one_row_size, slice_sizes[i]};
-            auto iter = hash_map.lazy_emplace(key, [&](const auto& ctor) {
-                // we must persist the slice before insert
-                uint8_t* pos = pool->allocate(key.size);
-                strings::memcpy_inlined(pos, key.data, key.size);
-                Slice pk{pos, key.size};
-                AggDataPtr pv = allocate_func();
-                ctor(pk, pv);
-            });
+            auto iter = agg_hash_map_lazy_emplace_with_hash(
+                    hash_map, key, hash_values[i],
+                    [&](const auto& ctor) { ctor(_persist_key(key, pool), allocate_func()); });
             (*agg_states)[i] = iter->second;
         }
     }
@@ -590,9 +723,26 @@ struct AggHashMapWithSerializedKey {
         }
 
         not_founds->assign(chunk_size, 0);
+        if (hash_map.bucket_count() < prefetch_threhold) {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                Slice key = {buffer + i * max_one_row_size, slice_sizes[i]};
+                if (auto iter = hash_map.find(key); iter != hash_map.end()) {
+                    (*agg_states)[i] = iter->second;
+                } else {
+                    (*not_founds)[i] = 1;
+                }
+            }
+            return;
+        }
+
+        _compute_hash_values(chunk_size);
+        size_t prefetch_index = AGG_HASH_MAP_DEFAULT_PREFETCH_DIST;
         for (size_t i = 0; i < chunk_size; ++i) {
+            if (prefetch_index < chunk_size) {
+                hash_map.prefetch_hash(hash_values[prefetch_index++]);
+            }
             Slice key = {buffer + i * max_one_row_size, slice_sizes[i]};
-            if (auto iter = hash_map.find(key); iter != hash_map.end()) {
+            if (auto iter = hash_map.find(key, hash_values[i]); iter != hash_map.end()) {
                 (*agg_states)[i] = iter->second;
             } else {
                 (*not_founds)[i] = 1;
@@ -600,6 +750,66 @@ struct AggHashMapWithSerializedKey {
         }
     }
 
+    // Like the one above, but the new keys of the partitions (sub maps) marked to aggregate in |stats| are
+    // inserted into the two-level hash map, and the statistics of the partitions are updated.
+    template <typename Func>
+    void compute_agg_states_by_partition(size_t chunk_size, const Columns& key_columns, MemPool* pool,
+                                         Func&& allocate_func, Buffer<AggDataPtr>* agg_states,
+                                         std::vector<uint8_t>* not_founds, AggHashMapPartitionStats* stats) {
+        static_assert(is_two_level_hash_map_v<HashMap>);
+        DCHECK_LE(hash_map.subcnt(), AggHashMapPartitionStats::MAX_PARTITIONS);
+        slice_sizes.assign(_chunk_size, 0);
+
+        uint32_t cur_max_one_row_size = get_max_serialize_size(key_columns);
+        if (UNLIKELY(cur_max_one_row_size > max_one_row_size)) {
+            max_one_row_size = cur_max_one_row_size;
+            mem_pool->clear();
+            // reserved extra SLICE_MEMEQUAL_OVERFLOW_PADDING bytes to prevent SIMD instructions
+            // from accessing out-of-bound memory.
+            buffer = mem_pool->allocate(max_one_row_size * _chunk_size + SLICE_MEMEQUAL_OVERFLOW_PADDING);
+        }
+
+        for (const auto& key_column : key_columns) {
+            key_column->serialize_batch(buffer, slice_sizes, chunk_size, max_one_row_size);
+        }
+
+        not_founds->assign(chunk_size, 0);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            Slice key = {buffer + i * max_one_row_size, slice_sizes[i]};
+            size_t hashval = hash_map.hash(key);
+            size_t partition = hash_map.subidx(hashval);
+            auto iter = hash_map.find(key, hashval);
+            stats->update(partition, iter == hash_map.end());
+            if (iter != hash_map.end()) {
+                (*agg_states)[i] = iter->second;
+            } else if (stats->aggregating[partition]) {
+                iter = hash_map.lazy_emplace_with_hash(
+                        hashval, key, [&](const auto& ctor) { ctor(_persist_key(key, pool), allocate_func()); });
+                (*agg_states)[i] = iter->second;
+                stats->aggregated_new_key_rows++;
+            } else {
+                (*not_founds)[i] = 1;
+            }
+        }
+    }
+
+    // Hash all the serialized keys of the chunk at once before probing, so that the buckets of the keys
+    // ahead can be prefetched.
+    void _compute_hash_values(size_t chunk_size) {
+        hash_values.resize(chunk_size);
+        auto hash_function = hash_map.hash_function();
+        for (size_t i = 0; i < chunk_size; ++i) {
+            hash_values[i] = hash_function(Slice{buffer + i * max_one_row_size, slice_sizes[i]});
+        }
+    }
+
+    // we must persist the slice before insert
+    static Slice _persist_key(const Slice& key, MemPool* pool) {
+        uint8_t* pos = pool->allocate(key.size);
+        strings::memcpy_inlined(pos, key.data, key.size);
+        return {pos, key.size};
+    }
+
     uint32_t get_max_serialize_size(const Columns& key_columns) {
         uint32_t max_size = 0;
         for (const auto& key_column : key_columns) {
@@ -632,6 +842,7 @@ struct AggHashMapWithSerializedKey {
     static constexpr bool has_single_null_key = false;
 
     Buffer<uint32_t> slice_sizes;
+    Buffer<size_t> hash_values;
     uint32_t max_one_row_size = 8;
 
     std::unique_ptr<MemPool> mem_pool;
@@ -703,19 +914,20 @@ struct AggHashMapWithSerializedKeyFixedSize {
     template <typename Func>
     void compute_agg_noprefetch(size_t chunk_size, const Columns& key_columns, Buffer<AggDataPtr>* agg_states,
                                 Func&& allocate_func) {
-        constexpr int key_size = sizeof(FixedSizeSliceKey);
+        // Serialize the keys in the same layout as compute_agg_prefetch, otherwise the unused tail bytes of
+        // the keys, which are only zeroed once if there are no null columns, would be stale after switching.
         uint8_t* buffer = reinterpret_cast<uint8_t*>(caches.data());
         for (const auto& key_column : key_columns) {
-            key_column->serialize_batch(buffer, slice_sizes, chunk_size, key_size);
+            key_column->serialize_batch(buffer, slice_sizes, chunk_size, max_fixed_size);
         }
-        FixedSizeSliceKey* key = reinterpret_cast<FixedSizeSliceKey*>(caches.data());
         if (has_null_column) {
             for (size_t i = 0; i < chunk_size; ++i) {
-                key[i].u.size = slice_sizes[i];
+                caches[i].key.u.size = slice_sizes[i];
             }
         }
         for (size_t i = 0; i < chunk_size; ++i) {
-            auto iter = hash_map.lazy_emplace(key[i], [&](const auto& ctor) { ctor(key[i], allocate_func()); });
+            FixedSizeSliceKey& key = caches[i].key;
+            auto iter = hash_map.lazy_emplace(key, [&](const auto& ctor) { ctor(key, allocate_func()); });
             (*agg_states)[i] = iter->second;
         }
     }
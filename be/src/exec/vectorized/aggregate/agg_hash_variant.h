@@ -45,9 +45,13 @@ namespace starrocks::vectorized {
     M(phase1_slice_fx4)               \
     M(phase1_slice_fx8)               \
     M(phase1_slice_fx16)              \
+    M(phase1_slice_fx24)              \
+    M(phase1_slice_fx32)              \
     M(phase2_slice_fx4)               \
     M(phase2_slice_fx8)               \
-    M(phase2_slice_fx16)
+    M(phase2_slice_fx16)              \
+    M(phase2_slice_fx24)              \
+    M(phase2_slice_fx32)
 
 #define APPLY_FOR_VARIANT_NULL(M) \
     M(phase1_null_uint8)          \
@@ -133,9 +137,13 @@ namespace starrocks::vectorized {
     M(phase1_slice_fx4)          \
     M(phase1_slice_fx8)          \
     M(phase1_slice_fx16)         \
+    M(phase1_slice_fx24)         \
+    M(phase1_slice_fx32)         \
     M(phase2_slice_fx4)          \
     M(phase2_slice_fx8)          \
-    M(phase2_slice_fx16)
+    M(phase2_slice_fx16)         \
+    M(phase2_slice_fx24)         \
+    M(phase2_slice_fx32)
 
 // Hash maps for phase1
 template <PhmapSeed seed>
@@ -209,6 +217,10 @@ template <PhmapSeed seed>
 using SerializedKeyFixedSize8AggHashMap = AggHashMapWithSerializedKeyFixedSize<FixedSize8SliceAggHashMap<seed>>;
 template <PhmapSeed seed>
 using SerializedKeyFixedSize16AggHashMap = AggHashMapWithSerializedKeyFixedSize<FixedSize16SliceAggHashMap<seed>>;
+template <PhmapSeed seed>
+using SerializedKeyFixedSize24AggHashMap = AggHashMapWithSerializedKeyFixedSize<FixedSize24SliceAggHashMap<seed>>;
+template <PhmapSeed seed>
+using SerializedKeyFixedSize32AggHashMap = AggHashMapWithSerializedKeyFixedSize<FixedSize32SliceAggHashMap<seed>>;
 
 // 1) For different group by columns type, size, cardinality, volume, we should choose different
 // hash functions and different hashmaps.
@@ -255,6 +267,8 @@ struct HashMapVariant {
         phase1_slice_fx4,
         phase1_slice_fx8,
         phase1_slice_fx16,
+        phase1_slice_fx24,
+        phase1_slice_fx32,
 
         phase2_uint8,
         phase2_int8,
@@ -287,6 +301,8 @@ struct HashMapVariant {
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+        phase2_slice_fx24,
+        phase2_slice_fx32,
     };
     Type type = Type::phase1_slice;
 
@@ -325,6 +341,8 @@ struct HashMapVariant {
     std::unique_ptr<SerializedKeyFixedSize4AggHashMap<PhmapSeed1>> phase1_slice_fx4;
     std::unique_ptr<SerializedKeyFixedSize8AggHashMap<PhmapSeed1>> phase1_slice_fx8;
     std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed1>> phase1_slice_fx16;
+    std::unique_ptr<SerializedKeyFixedSize24AggHashMap<PhmapSeed1>> phase1_slice_fx24;
+    std::unique_ptr<SerializedKeyFixedSize32AggHashMap<PhmapSeed1>> phase1_slice_fx32;
 
     std::unique_ptr<UInt8AggHashMapWithOneNumberKey<PhmapSeed2>> phase2_uint8;
     std::unique_ptr<Int8AggHashMapWithOneNumberKey<PhmapSeed2>> phase2_int8;
@@ -361,6 +379,8 @@ struct HashMapVariant {
     std::unique_ptr<SerializedKeyFixedSize4AggHashMap<PhmapSeed2>> phase2_slice_fx4;
     std::unique_ptr<SerializedKeyFixedSize8AggHashMap<PhmapSeed2>> phase2_slice_fx8;
     std::unique_ptr<SerializedKeyFixedSize16AggHashMap<PhmapSeed2>> phase2_slice_fx16;
+    std::unique_ptr<SerializedKeyFixedSize24AggHashMap<PhmapSeed2>> phase2_slice_fx24;
+    std::unique_ptr<SerializedKeyFixedSize32AggHashMap<PhmapSeed2>> phase2_slice_fx32;
 
     void init(RuntimeState* state, Type type_) {
         type = type_;
@@ -385,6 +405,17 @@ struct HashMapVariant {
         return 0;
     }
 
+    const char* name() const {
+        switch (type) {
+#define M(NAME)      \
+    case Type::NAME: \
+        return #NAME;
+            APPLY_FOR_VARIANT_ALL(M)
+#undef M
+        }
+        return "unknown";
+    }
+
     size_t size() const {
         switch (type) {
 #define M(NAME)      \
@@ -487,6 +518,12 @@ using SerializedKeyAggHashSetFixedSize8 = AggHashSetOfSerializedKeyFixedSize<Fix
 template <PhmapSeed seed>
 using SerializedKeyAggHashSetFixedSize16 = AggHashSetOfSerializedKeyFixedSize<FixedSize16SliceAggHashSet<seed>>;
 
+template <PhmapSeed seed>
+using SerializedKeyAggHashSetFixedSize24 = AggHashSetOfSerializedKeyFixedSize<FixedSize24SliceAggHashSet<seed>>;
+
+template <PhmapSeed seed>
+using SerializedKeyAggHashSetFixedSize32 = AggHashSetOfSerializedKeyFixedSize<FixedSize32SliceAggHashSet<seed>>;
+
 // 1) HashSetVariant is alike HashMapVariant, while a set only holds keys, no associated value.
 //
 // 2) Distributed aggregation is divided into two stages.
@@ -555,9 +592,13 @@ struct HashSetVariant {
         phase1_slice_fx4,
         phase1_slice_fx8,
         phase1_slice_fx16,
+        phase1_slice_fx24,
+        phase1_slice_fx32,
         phase2_slice_fx4,
         phase2_slice_fx8,
         phase2_slice_fx16,
+        phase2_slice_fx24,
+        phase2_slice_fx32,
     };
     Type type = Type::phase1_slice;
 
@@ -632,9 +673,13 @@ struct HashSetVariant {
     std::unique_ptr<SerializedKeyAggHashSetFixedSize4<PhmapSeed1>> phase1_slice_fx4;
     std::unique_ptr<SerializedKeyAggHashSetFixedSize8<PhmapSeed1>> phase1_slice_fx8;
     std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed1>> phase1_slice_fx16;
+    std::unique_ptr<SerializedKeyAggHashSetFixedSize24<PhmapSeed1>> phase1_slice_fx24;
+    std::unique_ptr<SerializedKeyAggHashSetFixedSize32<PhmapSeed1>> phase1_slice_fx32;
     std::unique_ptr<SerializedKeyAggHashSetFixedSize4<PhmapSeed2>> phase2_slice_fx4;
     std::unique_ptr<SerializedKeyAggHashSetFixedSize8<PhmapSeed2>> phase2_slice_fx8;
     std::unique_ptr<SerializedKeyAggHashSetFixedSize16<PhmapSeed2>> phase2_slice_fx16;
+    std::unique_ptr<SerializedKeyAggHashSetFixedSize24<PhmapSeed2>> phase2_slice_fx24;
+    std::unique_ptr<SerializedKeyAggHashSetFixedSize32<PhmapSeed2>> phase2_slice_fx32;
 
     void init(RuntimeState* state, Type type_) {
         type = type_;
@@ -659,6 +704,17 @@ struct HashSetVariant {
         return 0;
     }
 
+    const char* name() const {
+        switch (type) {
+#define M(NAME)      \
+    case Type::NAME: \
+        return #NAME;
+            APPLY_FOR_VARIANT_ALL(M)
+#undef M
+        }
+        return "unknown";
+    }
+
     size_t size() const {
         switch (type) {
 #define M(NAME)      \
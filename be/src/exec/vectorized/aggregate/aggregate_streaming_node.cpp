@@ -147,11 +147,11 @@ Status AggregateStreamingNode::get_next(RuntimeState* state, ChunkPtr* chunk, bo
                         SCOPED_TIMER(_aggregator->agg_compute_timer());
                         if (false) {
                         }
-#define HASH_MAP_METHOD(NAME)                                                             \
-    else if (_aggregator->hash_map_variant().type == HashMapVariant::Type::NAME) {        \
-        TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_selection<typename decltype( \
-                                    _aggregator->hash_map_variant().NAME)::element_type>( \
-                *_aggregator->hash_map_variant().NAME, input_chunk_size));                \
+#define HASH_MAP_METHOD(NAME)                                                                         \
+    else if (_aggregator->hash_map_variant().type == HashMapVariant::Type::NAME) {                    \
+        TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_partitioned_selection<typename decltype( \
+                                    _aggregator->hash_map_variant().NAME)::element_type>(             \
+                *_aggregator->hash_map_variant().NAME, input_chunk_size));                            \
     }
                         APPLY_FOR_VARIANT_ALL(HASH_MAP_METHOD)
 #undef HASH_MAP_METHOD
@@ -178,6 +178,9 @@ Status AggregateStreamingNode::get_next(RuntimeState* state, ChunkPtr* chunk, bo
                         }
                     }
 
+                    // the new keys of some partitions may be aggregated
+                    _mem_tracker->set(_aggregator->hash_map_variant().memory_usage() +
+                                      _aggregator->mem_pool()->total_reserved_bytes());
                     COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
                     if (*chunk != nullptr && (*chunk)->num_rows() > 0) {
                         break;
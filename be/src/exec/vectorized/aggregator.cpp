@@ -4,12 +4,16 @@
 
 #include <algorithm>
 
+#include "common/config.h"
 #include "common/status.h"
+#include "exec/pipeline/query_context.h"
 #include "exprs/anyval_util.h"
 #include "gen_cpp/PlanNodes_types.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "udf/java/utils.h"
+#include "util/bit_util.h"
 
 namespace starrocks {
 namespace vectorized {
@@ -233,7 +237,21 @@ Status Aggregator::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile
 
     _input_row_count = ADD_COUNTER(_runtime_profile, "InputRowCount", TUnit::UNIT);
     _hash_table_size = ADD_COUNTER(_runtime_profile, "HashTableSize", TUnit::UNIT);
+    _hash_table_capacity = ADD_COUNTER(_runtime_profile, "HashTableCapacity", TUnit::UNIT);
+    _hash_table_load_factor = ADD_COUNTER(_runtime_profile, "HashTableLoadFactor", TUnit::DOUBLE_VALUE);
+    _hash_table_resizes = ADD_COUNTER(_runtime_profile, "HashTableResizes", TUnit::UNIT);
+    _two_level_convert_timer = ADD_TIMER(_runtime_profile, "TwoLevelConvertTime");
+    _two_level_convert_size = ADD_COUNTER(_runtime_profile, "TwoLevelConvertSize", TUnit::UNIT);
     _pass_through_row_count = ADD_COUNTER(_runtime_profile, "PassThroughRowCount", TUnit::UNIT);
+    _streaming_aggregating_partitions = ADD_COUNTER(_runtime_profile, "StreamingAggregatingPartitions", TUnit::UNIT);
+    _streaming_aggregated_new_key_rows = ADD_COUNTER(_runtime_profile, "StreamingAggregatedNewKeyRows", TUnit::UNIT);
+    if (state->enable_spill()) {
+        _spill_timer = ADD_TIMER(_runtime_profile, "SpillTime");
+        _spill_restore_timer = ADD_TIMER(_runtime_profile, "SpillRestoreTime");
+        _spill_bytes = ADD_COUNTER(_runtime_profile, "SpillBytes", TUnit::BYTES);
+        _spill_rows = ADD_COUNTER(_runtime_profile, "SpillRows", TUnit::UNIT);
+        _spill_times = ADD_COUNTER(_runtime_profile, "SpillTimes", TUnit::UNIT);
+    }
 
     SCOPED_TIMER(_runtime_profile->total_time_counter());
 
@@ -249,11 +267,12 @@ Status Aggregator::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile
     RETURN_IF_ERROR(Expr::prepare(_conjunct_ctxs, state));
 
     _mem_pool = std::make_unique<MemPool>();
+    _fn_ctx_mem_pool = std::make_unique<MemPool>();
 
     // Initial for FunctionContext of every aggregate functions
     for (int i = 0; i < _agg_fn_ctxs.size(); ++i) {
         _agg_fn_ctxs[i] = FunctionContextImpl::create_context(
-                state, _mem_pool.get(), AnyValUtil::column_type_to_type_desc(_agg_fn_types[i].result_type),
+                state, _fn_ctx_mem_pool.get(), AnyValUtil::column_type_to_type_desc(_agg_fn_types[i].result_type),
                 _agg_fn_types[i].arg_typedescs, 0, false);
         state->obj_pool()->add(_agg_fn_ctxs[i]);
     }
@@ -274,6 +293,17 @@ void Aggregator::close(RuntimeState* state) {
 
     _is_closed = true;
 
+    if (_has_streaming_partitions && _runtime_profile != nullptr) {
+        // the recent reduction of the streaming pre-aggregation by each sub map of the two-level hash map
+        std::string reductions;
+        for (size_t p = 0; p < vectorized::AggHashMapPartitionStats::MAX_PARTITIONS; p++) {
+            double new_key_rows = std::max(_streaming_partitions.new_key_rows[p], 1.0);
+            reductions.append(p == 0 ? "" : ", ")
+                    .append(strings::Substitute("$0:$1", p, _streaming_partitions.input_rows[p] / new_key_rows));
+        }
+        _runtime_profile->add_info_string("StreamingPartitionReductions", reductions);
+    }
+
     auto agg_close = [this, state]() {
         // _mem_pool is nullptr means prepare phase failed
         if (_mem_pool != nullptr) {
@@ -302,6 +332,11 @@ void Aggregator::close(RuntimeState* state) {
                 ctx->impl()->close();
             }
         }
+        if (_fn_ctx_mem_pool != nullptr) {
+            _fn_ctx_mem_pool->free_all();
+        }
+        _spilled_partitions.reset();
+        _mem_consumer.reset();
 
         Expr::close(_group_by_expr_ctxs, state);
         for (const auto& i : _agg_expr_ctxs) {
@@ -345,13 +380,6 @@ bool Aggregator::should_expand_preagg_hash_tables(size_t prev_row_returned, size
         return true;
     }
 
-    // Find the appropriate reduction factor in our table for the current hash table sizes.
-    int cache_level = 0;
-    while (cache_level + 1 < STREAMING_HT_MIN_REDUCTION_SIZE &&
-           ht_mem >= STREAMING_HT_MIN_REDUCTION[cache_level + 1].min_ht_mem) {
-        cache_level++;
-    }
-
     // Compare the number of rows in the hash table with the number of input rows that
     // were aggregated into it. Exclude passed through rows from this calculation since
     // they were not in hash tables.
@@ -368,8 +396,38 @@ bool Aggregator::should_expand_preagg_hash_tables(size_t prev_row_returned, size
     // set, N is the number of input rows, excluding passed-through rows, and n is the
     // number of rows inserted or merged into the hash tables. This is a very rough
     // approximation but is good enough to be useful.
-    double min_reduction = STREAMING_HT_MIN_REDUCTION[cache_level].streaming_ht_min_reduction;
-    return current_reduction > min_reduction;
+    return current_reduction > _streaming_ht_min_reduction(ht_mem);
+}
+
+double Aggregator::_streaming_ht_min_reduction(int64_t ht_mem) {
+    // Find the appropriate reduction factor in our table for the current hash table sizes.
+    int cache_level = 0;
+    while (cache_level + 1 < STREAMING_HT_MIN_REDUCTION_SIZE &&
+           ht_mem >= STREAMING_HT_MIN_REDUCTION[cache_level + 1].min_ht_mem) {
+        cache_level++;
+    }
+    return STREAMING_HT_MIN_REDUCTION[cache_level].streaming_ht_min_reduction;
+}
+
+void Aggregator::_update_streaming_partitions() {
+    using Stats = vectorized::AggHashMapPartitionStats;
+    auto& stats = _streaming_partitions;
+    _has_streaming_partitions = true;
+    // The same reduction as to expand the whole hash table is required for a partition to aggregate its new keys,
+    // estimated by the ratio of its input rows to the ones of the new keys, which would be the new groups.
+    double min_reduction = _streaming_ht_min_reduction(_mem_pool->total_allocated_bytes());
+    int64_t num_aggregating = 0;
+    for (size_t p = 0; p < Stats::MAX_PARTITIONS; p++) {
+        if (stats.input_rows[p] >= Stats::MIN_INPUT_ROWS) {
+            stats.aggregating[p] = stats.input_rows[p] > stats.new_key_rows[p] * min_reduction;
+        }
+        if (stats.input_rows[p] >= Stats::DECAY_INPUT_ROWS) {
+            stats.input_rows[p] /= 2;
+            stats.new_key_rows[p] /= 2;
+        }
+        num_aggregating += stats.aggregating[p];
+    }
+    COUNTER_SET(_streaming_aggregating_partitions, num_aggregating);
 }
 
 void Aggregator::compute_single_agg_state(size_t chunk_size) {
@@ -533,27 +591,36 @@ void Aggregator::output_chunk_by_streaming_with_selection(vectorized::ChunkPtr*
 
 #define CONVERT_TO_TWO_LEVEL_MAP(DST, SRC)                                                                             \
     if (_hash_map_variant.type == vectorized::HashMapVariant::Type::SRC) {                                             \
+        SCOPED_TIMER(_two_level_convert_timer);                                                                        \
+        COUNTER_SET(_two_level_convert_size, static_cast<int64_t>(_hash_map_variant.SRC->hash_map.size()));            \
         _hash_map_variant.DST = std::make_unique<decltype(_hash_map_variant.DST)::element_type>(_state->chunk_size()); \
         _hash_map_variant.DST->hash_map.reserve(_hash_map_variant.SRC->hash_map.capacity());                           \
         _hash_map_variant.DST->hash_map.insert(_hash_map_variant.SRC->hash_map.begin(),                                \
                                                _hash_map_variant.SRC->hash_map.end());                                 \
         _hash_map_variant.type = vectorized::HashMapVariant::Type::DST;                                                \
         _hash_map_variant.SRC.reset();                                                                                 \
+        _runtime_profile->add_info_string("HashTableVariant", _hash_map_variant.name());                               \
+        _last_hash_table_capacity = _hash_map_variant.capacity();                                                      \
         return;                                                                                                        \
     }
 
 #define CONVERT_TO_TWO_LEVEL_SET(DST, SRC)                                                                             \
     if (_hash_set_variant.type == vectorized::HashSetVariant::Type::SRC) {                                             \
+        SCOPED_TIMER(_two_level_convert_timer);                                                                        \
+        COUNTER_SET(_two_level_convert_size, static_cast<int64_t>(_hash_set_variant.SRC->hash_set.size()));            \
         _hash_set_variant.DST = std::make_unique<decltype(_hash_set_variant.DST)::element_type>(_state->chunk_size()); \
         _hash_set_variant.DST->hash_set.reserve(_hash_set_variant.SRC->hash_set.capacity());                           \
         _hash_set_variant.DST->hash_set.insert(_hash_set_variant.SRC->hash_set.begin(),                                \
                                                _hash_set_variant.SRC->hash_set.end());                                 \
         _hash_set_variant.type = vectorized::HashSetVariant::Type::DST;                                                \
         _hash_set_variant.SRC.reset();                                                                                 \
+        _runtime_profile->add_info_string("HashTableVariant", _hash_set_variant.name());                               \
+        _last_hash_table_capacity = _hash_set_variant.capacity();                                                      \
         return;                                                                                                        \
     }
 
 void Aggregator::try_convert_to_two_level_map() {
+    _update_hash_table_stats(_hash_map_variant.capacity(), _hash_map_variant.size());
     if (_mem_tracker->consumption() > two_level_memory_threshold) {
         CONVERT_TO_TWO_LEVEL_MAP(phase1_slice_two_level, phase1_slice);
         CONVERT_TO_TWO_LEVEL_MAP(phase2_slice_two_level, phase2_slice);
@@ -561,12 +628,29 @@ void Aggregator::try_convert_to_two_level_map() {
 }
 
 void Aggregator::try_convert_to_two_level_set() {
+    _update_hash_table_stats(_hash_set_variant.capacity(), _hash_set_variant.size());
     if (_mem_tracker->consumption() > two_level_memory_threshold) {
         CONVERT_TO_TWO_LEVEL_SET(phase1_slice_two_level, phase1_slice);
         CONVERT_TO_TWO_LEVEL_SET(phase2_slice_two_level, phase2_slice);
     }
 }
 
+void Aggregator::_update_hash_table_stats(size_t capacity, size_t size) {
+    if (capacity > _last_hash_table_capacity) {
+        // The capacity of a phmap is always 2^n-1 and doubled by each resize, and the resizes in the same chunk
+        // are counted by the growth of the capacity since the last chunk.
+        int resizes = BitUtil::Log2Floor64(capacity + 1) - BitUtil::Log2Floor64(_last_hash_table_capacity + 1);
+        COUNTER_UPDATE(_hash_table_resizes, std::max(resizes, 1));
+    }
+    if (capacity != _last_hash_table_capacity) {
+        _last_hash_table_capacity = capacity;
+        COUNTER_SET(_hash_table_capacity, static_cast<int64_t>(capacity));
+    }
+    if (capacity > 0) {
+        _hash_table_load_factor->set(static_cast<double>(size) / capacity);
+    }
+}
+
 Status Aggregator::check_has_error() {
     for (const auto* ctx : _agg_fn_ctxs) {
         if (ctx->has_error()) {
@@ -578,6 +662,187 @@ Status Aggregator::check_has_error() {
 
 #undef CONVERT_TO_TWO_LEVEL
 
+bool Aggregator::should_spill() const {
+    // TODO: support spill of hash set for distinct aggregate
+    if (_group_by_expr_ctxs.empty() || _is_only_group_by_columns) {
+        return false;
+    }
+    if (_mem_consumer != nullptr && _mem_consumer->is_spill_requested()) {
+        return true;
+    }
+    return vectorized::should_spill(_state, _mem_tracker);
+}
+
+void Aggregator::reserve_mem(const vectorized::Chunk& chunk, bool spillable) {
+    if (!_is_mem_consumer_created) {
+        _is_mem_consumer_created = true;
+        spillable = spillable && !_group_by_expr_ctxs.empty() && !_is_only_group_by_columns;
+        _mem_consumer = pipeline::MemConsumer::create(_state, "agg", spillable);
+    }
+    if (_mem_consumer != nullptr) {
+        _mem_consumer->try_reserve(chunk.memory_usage());
+    }
+}
+
+void Aggregator::update_reserved_mem() {
+    if (_mem_consumer != nullptr) {
+        _mem_consumer->update_usage(_mem_tracker->consumption());
+    }
+}
+
+Status Aggregator::spill_hash_map() {
+    SCOPED_TIMER(_spill_timer);
+    if (_spilled_partitions == nullptr) {
+        _spilled_partitions = std::make_unique<vectorized::PartitionedSpillFiles>(
+                "agg", std::max(config::spill_partition_num, 1), _state->chunk_size());
+    }
+    int64_t old_bytes = _spilled_partitions->num_bytes();
+    int64_t old_rows = _spilled_partitions->num_rows();
+
+    if (false) {
+    }
+#define HASH_MAP_METHOD(NAME)                                                                                     \
+    else if (_hash_map_variant.type == vectorized::HashMapVariant::Type::NAME) {                                  \
+        RETURN_IF_ERROR(spill_hash_map<decltype(_hash_map_variant.NAME)::element_type>(*_hash_map_variant.NAME)); \
+    }
+    APPLY_FOR_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+
+    _reset_hash_map();
+    _mem_tracker->set(_hash_map_variant.memory_usage() + _mem_pool->total_reserved_bytes());
+
+    COUNTER_UPDATE(_spill_bytes, _spilled_partitions->num_bytes() - old_bytes);
+    if (_state->query_ctx() != nullptr) {
+        _state->query_ctx()->incr_spill_bytes(_spilled_partitions->num_bytes() - old_bytes);
+    }
+    COUNTER_UPDATE(_spill_rows, _spilled_partitions->num_rows() - old_rows);
+    COUNTER_UPDATE(_spill_times, 1);
+    return Status::OK();
+}
+
+Status Aggregator::finish_spill() {
+    DCHECK(has_spilled());
+    if (_hash_map_variant.size() > 0) {
+        RETURN_IF_ERROR(spill_hash_map());
+    }
+    SCOPED_TIMER(_spill_timer);
+    RETURN_IF_ERROR(_spilled_partitions->finish());
+    COUNTER_SET(_spill_bytes, _spilled_partitions->num_bytes());
+    _next_restore_partition = 0;
+    return Status::OK();
+}
+
+bool Aggregator::has_pending_spilled_partitions() const {
+    if (_spilled_partitions == nullptr) {
+        return false;
+    }
+    for (size_t i = _next_restore_partition; i < _spilled_partitions->num_partitions(); i++) {
+        if (_spilled_partitions->partition(i) != nullptr) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Status Aggregator::restore_next_spilled_partition() {
+    SCOPED_TIMER(_spill_restore_timer);
+    DCHECK(has_spilled());
+    while (_next_restore_partition < _spilled_partitions->num_partitions()) {
+        size_t partition_idx = _next_restore_partition++;
+        vectorized::SpillFile* file = _spilled_partitions->partition(partition_idx);
+        if (file == nullptr) {
+            continue;
+        }
+
+        // release the states of previous partition, which have been output
+        _reset_hash_map();
+        while (true) {
+            auto res = file->read(*_spill_prototype);
+            if (res.status().is_end_of_file()) {
+                break;
+            }
+            RETURN_IF_ERROR(res.status());
+            RETURN_IF_ERROR(_merge_spilled_chunk(std::move(res.value())));
+        }
+        _spilled_partitions->release_partition(partition_idx);
+        _mem_tracker->set(_hash_map_variant.memory_usage() + _mem_pool->total_reserved_bytes());
+
+        if (false) {
+        }
+#define HASH_MAP_METHOD(NAME)                                                  \
+    else if (_hash_map_variant.type == vectorized::HashMapVariant::Type::NAME) \
+            _it_hash = _hash_map_variant.NAME->hash_map.begin();
+        APPLY_FOR_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+
+        _is_ht_eos = _hash_map_variant.size() == 0;
+        if (!_is_ht_eos) {
+            break;
+        }
+    }
+    return Status::OK();
+}
+
+Status Aggregator::_spill_intermediate_chunk(const vectorized::Columns& group_by_columns,
+                                             const vectorized::Columns& agg_result_columns) {
+    vectorized::ChunkPtr chunk = std::make_shared<vectorized::Chunk>();
+    for (size_t i = 0; i < group_by_columns.size(); i++) {
+        chunk->append_column(group_by_columns[i], _intermediate_tuple_desc->slots()[i]->id());
+    }
+    for (size_t i = 0; i < agg_result_columns.size(); i++) {
+        size_t id = group_by_columns.size() + i;
+        chunk->append_column(agg_result_columns[i], _intermediate_tuple_desc->slots()[id]->id());
+    }
+    if (_spill_prototype == nullptr) {
+        _spill_prototype = chunk->clone_empty_with_slot();
+    }
+    return _spilled_partitions->append(chunk, group_by_columns);
+}
+
+Status Aggregator::_merge_spilled_chunk(const vectorized::ChunkPtr& chunk) {
+    const size_t chunk_size = chunk->num_rows();
+    const size_t num_group_by_columns = _group_by_columns.size();
+    for (size_t i = 0; i < num_group_by_columns; i++) {
+        _group_by_columns[i] = chunk->get_column_by_index(i);
+    }
+    if (_tmp_agg_states.size() < chunk_size) {
+        _tmp_agg_states.resize(chunk_size);
+    }
+
+    if (false) {
+    }
+#define HASH_MAP_METHOD(NAME)                                                               \
+    else if (_hash_map_variant.type == vectorized::HashMapVariant::Type::NAME) {            \
+        TRY_CATCH_BAD_ALLOC(build_hash_map<decltype(_hash_map_variant.NAME)::element_type>( \
+                *_hash_map_variant.NAME, chunk_size));                                      \
+    }
+    APPLY_FOR_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+
+    // the spilled states are always in serialized format, so merge them no matter of the phase
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        const vectorized::Column* column = chunk->get_column_by_index(num_group_by_columns + i).get();
+        _agg_functions[i]->merge_batch(_agg_fn_ctxs[i], chunk_size, _agg_states_offsets[i], column,
+                                       _tmp_agg_states.data());
+    }
+    TRY_CATCH_BAD_ALLOC(try_convert_to_two_level_map());
+    return check_has_error();
+}
+
+void Aggregator::_reset_hash_map() {
+    if (false) {
+    }
+#define HASH_MAP_METHOD(NAME)                                                  \
+    else if (_hash_map_variant.type == vectorized::HashMapVariant::Type::NAME) \
+            _release_agg_memory<decltype(_hash_map_variant.NAME)::element_type>(_hash_map_variant.NAME.get());
+    APPLY_FOR_VARIANT_ALL(HASH_MAP_METHOD)
+#undef HASH_MAP_METHOD
+
+    _mem_pool->free_all();
+    _hash_map_variant = vectorized::HashMapVariant();
+    _init_agg_hash_variant(_hash_map_variant);
+}
+
 // When need finalize, create column by result type
 // otherwise, create column by serde type
 vectorized::Columns Aggregator::_create_agg_result_columns() {
@@ -591,15 +856,44 @@ vectorized::Columns Aggregator::_create_agg_result_columns() {
             agg_result_columns[i]->reserve(_state->chunk_size());
         }
     } else {
-        for (size_t i = 0; i < _agg_fn_types.size(); ++i) {
-            agg_result_columns[i] = vectorized::ColumnHelper::create_column(_agg_fn_types[i].serde_type,
-                                                                            _agg_fn_types[i].has_nullable_child);
-            agg_result_columns[i]->reserve(_state->chunk_size());
-        }
+        agg_result_columns = _create_agg_serialize_columns();
     }
     return agg_result_columns;
 }
 
+vectorized::Columns Aggregator::_create_agg_serialize_columns() {
+    vectorized::Columns agg_result_columns(_agg_fn_types.size());
+    for (size_t i = 0; i < _agg_fn_types.size(); ++i) {
+        agg_result_columns[i] = vectorized::ColumnHelper::create_column(_agg_fn_types[i].serde_type,
+                                                                        _agg_fn_types[i].has_nullable_child);
+        agg_result_columns[i]->reserve(_state->chunk_size());
+    }
+    return agg_result_columns;
+}
+
+vectorized::ChunkPtr Aggregator::_build_result_chunk(const vectorized::Columns& group_by_columns,
+                                                    const vectorized::Columns& agg_result_columns) {
+    vectorized::ChunkPtr result_chunk = std::make_shared<vectorized::Chunk>();
+    // For different agg phase, we should use different TupleDescriptor
+    TupleDescriptor* tuple_desc = _needs_finalize ? _output_tuple_desc : _intermediate_tuple_desc;
+    for (size_t i = 0; i < group_by_columns.size(); i++) {
+        result_chunk->append_column(group_by_columns[i], tuple_desc->slots()[i]->id());
+    }
+    for (size_t i = 0; i < agg_result_columns.size(); i++) {
+        size_t id = group_by_columns.size() + i;
+        result_chunk->append_column(agg_result_columns[i], tuple_desc->slots()[id]->id());
+    }
+    return result_chunk;
+}
+
+ThreadPool* Aggregator::_get_parallel_output_pool(size_t num_groups) const {
+    // The functions of UDAF are not thread-safe, and the restored spilled partitions are small.
+    if (_has_udaf || has_spilled() || num_groups < config::pipeline_agg_parallel_output_min_rows) {
+        return nullptr;
+    }
+    return ExecEnv::GetInstance()->agg_output_thread_pool();
+}
+
 vectorized::Columns Aggregator::_create_group_by_columns() {
     vectorized::Columns group_by_columns(_group_by_types.size());
     for (size_t i = 0; i < _group_by_types.size(); ++i) {
@@ -845,6 +1139,12 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
             } else if (max_size < 16 || (!has_null_column && max_size == 16)) {
                 type = _aggr_phase == AggrPhase1 ? HashVariantType::Type::phase1_slice_fx16
                                                  : HashVariantType::Type::phase2_slice_fx16;
+            } else if (max_size < 24 || (!has_null_column && max_size == 24)) {
+                type = _aggr_phase == AggrPhase1 ? HashVariantType::Type::phase1_slice_fx24
+                                                 : HashVariantType::Type::phase2_slice_fx24;
+            } else if (max_size < 32 || (!has_null_column && max_size == 32)) {
+                type = _aggr_phase == AggrPhase1 ? HashVariantType::Type::phase1_slice_fx32
+                                                 : HashVariantType::Type::phase2_slice_fx32;
             }
             if (!has_null_column) {
                 fixed_byte_size = max_size;
@@ -854,6 +1154,8 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
     VLOG_ROW << "hash type is "
              << static_cast<typename std::underlying_type<typename HashVariantType::Type>::type>(type);
     hash_variant.init(_state, type);
+    _runtime_profile->add_info_string("HashTableVariant", hash_variant.name());
+    _last_hash_table_capacity = hash_variant.capacity();
 
 #define SET_FIXED_SLICE_HASH_MAP_FIELD(TYPE)                  \
     if (type == HashVariantType::Type::TYPE) {                \
@@ -863,9 +1165,13 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
     SET_FIXED_SLICE_HASH_MAP_FIELD(phase1_slice_fx4);
     SET_FIXED_SLICE_HASH_MAP_FIELD(phase1_slice_fx8);
     SET_FIXED_SLICE_HASH_MAP_FIELD(phase1_slice_fx16);
+    SET_FIXED_SLICE_HASH_MAP_FIELD(phase1_slice_fx24);
+    SET_FIXED_SLICE_HASH_MAP_FIELD(phase1_slice_fx32);
     SET_FIXED_SLICE_HASH_MAP_FIELD(phase2_slice_fx4);
     SET_FIXED_SLICE_HASH_MAP_FIELD(phase2_slice_fx8);
     SET_FIXED_SLICE_HASH_MAP_FIELD(phase2_slice_fx16);
+    SET_FIXED_SLICE_HASH_MAP_FIELD(phase2_slice_fx24);
+    SET_FIXED_SLICE_HASH_MAP_FIELD(phase2_slice_fx32);
 #undef SET_FIXED_SLICE_HASH_MAP_FIELD
 
 } // namespace starrocks
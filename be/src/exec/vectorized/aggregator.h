@@ -10,14 +10,19 @@
 #include "column/column_helper.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exec/pipeline/context_with_dependency.h"
+#include "exec/pipeline/query_mem_arbitrator.h"
 #include "exec/vectorized/aggregate/agg_hash_variant.h"
+#include "exec/vectorized/spill/spill_file.h"
 #include "exprs/agg/aggregate_factory.h"
 #include "exprs/expr.h"
 #include "gutil/strings/substitute.h"
+#include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -141,6 +146,30 @@ public:
 
     Status check_has_error();
 
+    // Spill to disk, only used by blocking aggregate with group by in pipeline engine.
+    //
+    // When the memory usage of the hash map exceeds the limit, all entries in the hash map are
+    // serialized into intermediate chunks, hash-partitioned by group by columns and written to
+    // spill files, then the hash map is cleared to continue consuming input.
+    // After all input is consumed, the spilled partitions are re-aggregated one by one,
+    // so only one partition needs to be held in memory at a time.
+    bool should_spill() const;
+    Status spill_hash_map();
+    bool has_spilled() const { return _spilled_partitions != nullptr; }
+    // Spill the rest of the hash map and get prepared for restoring, called when sink is finished.
+    Status finish_spill();
+    bool has_pending_spilled_partitions() const;
+    // Load and merge the next non-empty spilled partition into the hash map.
+    Status restore_next_spilled_partition();
+
+    // Reserve the memory for aggregating |chunk| from the arbitrator of the query before building the hash map,
+    // and update the reservation by the actual memory usage after that, see pipeline::MemConsumer.
+    // The hash map is spilled if the arbitrator chooses it as the victim and |spillable| is true.
+    void reserve_mem(const vectorized::Chunk& chunk, bool spillable);
+    void update_reserved_mem();
+    // Called when all input is consumed, since the hash map cannot be spilled anymore.
+    void release_reserved_mem() { _mem_consumer.reset(); }
+
 #ifdef NDEBUG
     static constexpr size_t two_level_memory_threshold = 33554432; // 32M, L3 Cache
     static constexpr size_t streaming_hash_table_size_threshold = 10000000;
@@ -150,6 +179,49 @@ public:
 #endif
 
 private:
+    // Build the output chunk of the aggregation from the group by columns and the aggregate result columns.
+    vectorized::ChunkPtr _build_result_chunk(const vectorized::Columns& group_by_columns,
+                                             const vectorized::Columns& agg_result_columns);
+    // The pool to convert a two-level hash map of |num_groups| groups to chunks in parallel, nullptr if not.
+    ThreadPool* _get_parallel_output_pool(size_t num_groups) const;
+
+    // Convert the sub map |submap| of a two-level hash map to |chunks|, which is thread-safe for different sub maps.
+    template <typename HashMapWithKey>
+    void _convert_submap_to_chunks(HashMapWithKey& hash_map_with_key, size_t submap, int32_t chunk_size,
+                                   std::vector<vectorized::ChunkPtr>* chunks) {
+        auto it = hash_map_with_key.hash_map.begin(submap);
+        auto end = hash_map_with_key.hash_map.end();
+        typename HashMapWithKey::ResultVector keys(chunk_size);
+        vectorized::Buffer<vectorized::AggDataPtr> agg_states(chunk_size);
+        while (it != end) {
+            vectorized::Columns group_by_columns = _create_group_by_columns();
+            vectorized::Columns agg_result_columns = _create_agg_result_columns();
+            int32_t read_index = 0;
+            while ((it != end) & (read_index < chunk_size)) {
+                keys[read_index] = it->first;
+                agg_states[read_index] = it->second;
+                ++read_index;
+                ++it;
+            }
+            hash_map_with_key.insert_keys_to_columns(keys, group_by_columns, read_index);
+            for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+                if (_needs_finalize) {
+                    _agg_functions[i]->batch_finalize(_agg_fn_ctxs[i], read_index, agg_states,
+                                                      _agg_states_offsets[i], agg_result_columns[i].get());
+                } else {
+                    _agg_functions[i]->batch_serialize(_agg_fn_ctxs[i], read_index, agg_states,
+                                                       _agg_states_offsets[i], agg_result_columns[i].get());
+                }
+            }
+            chunks->push_back(_build_result_chunk(group_by_columns, agg_result_columns));
+        }
+    }
+
+    // The minimum reduction of the streaming pre-aggregation to expand a hash table of |ht_mem| bytes.
+    static double _streaming_ht_min_reduction(int64_t ht_mem);
+    // Decide whether to aggregate or to stream the new keys of each sub map by their recent reduction.
+    void _update_streaming_partitions();
+
     bool _is_closed = false;
     RuntimeState* _state = nullptr;
 
@@ -160,6 +232,8 @@ private:
 
     ObjectPool* _pool;
     std::unique_ptr<MemPool> _mem_pool;
+    // Used by FunctionContext of aggregate functions, which must outlive _mem_pool being freed when spilling.
+    std::unique_ptr<MemPool> _fn_ctx_mem_pool;
     // The open phase still relies on the TFunction object for some initialization operations
     std::vector<TFunction> _fns;
 
@@ -247,12 +321,44 @@ private:
     RuntimeProfile::Counter* _input_row_count{};
     RuntimeProfile::Counter* _rows_returned_counter;
     RuntimeProfile::Counter* _hash_table_size{};
+    RuntimeProfile::Counter* _hash_table_capacity{};
+    RuntimeProfile::Counter* _hash_table_load_factor{};
+    RuntimeProfile::Counter* _hash_table_resizes{};
+    RuntimeProfile::Counter* _two_level_convert_timer{};
+    RuntimeProfile::Counter* _two_level_convert_size{};
+    size_t _last_hash_table_capacity = 0;
     RuntimeProfile::Counter* _iter_timer{};
     RuntimeProfile::Counter* _agg_append_timer{};
     RuntimeProfile::Counter* _group_by_append_timer{};
     RuntimeProfile::Counter* _pass_through_row_count{};
     RuntimeProfile::Counter* _expr_compute_timer{};
     RuntimeProfile::Counter* _expr_release_timer{};
+    RuntimeProfile::Counter* _streaming_aggregating_partitions{};
+    RuntimeProfile::Counter* _streaming_aggregated_new_key_rows{};
+
+    // The state to output a two-level hash map in parallel, see convert_hash_map_to_chunk_in_parallel().
+    ThreadPool* _parallel_output_pool = nullptr;
+    size_t _next_output_submap = 0;
+    std::queue<vectorized::ChunkPtr> _parallel_output_chunks;
+
+    // The statistics of the streaming pre-aggregation by the sub maps of a two-level hash map.
+    vectorized::AggHashMapPartitionStats _streaming_partitions;
+    bool _has_streaming_partitions = false;
+
+    // The partitioned spill files of hash map, nullptr means never spilled.
+    std::unique_ptr<vectorized::PartitionedSpillFiles> _spilled_partitions;
+    // The layout of spilled chunks, used to restore chunks from spill files.
+    vectorized::ChunkPtr _spill_prototype;
+    size_t _next_restore_partition = 0;
+
+    RuntimeProfile::Counter* _spill_timer{};
+    RuntimeProfile::Counter* _spill_restore_timer{};
+    RuntimeProfile::Counter* _spill_bytes{};
+    RuntimeProfile::Counter* _spill_rows{};
+    RuntimeProfile::Counter* _spill_times{};
+
+    pipeline::MemConsumerPtr _mem_consumer;
+    bool _is_mem_consumer_created = false;
 
 public:
     template <typename HashMapWithKey>
@@ -293,6 +399,32 @@ public:
                 &_tmp_agg_states, &_streaming_selection);
     }
 
+    // Used by the streaming pre-aggregation instead of build_hash_map_with_selection() when the hash map is full
+    // and reduces the input poorly overall. The new keys of the sub maps of a two-level hash map which still reduce
+    // their input well are inserted instead of being streamed, see vectorized::AggHashMapPartitionStats.
+    template <typename HashMapWithKey>
+    void build_hash_map_with_partitioned_selection(HashMapWithKey& hash_map_with_key, size_t chunk_size) {
+        if constexpr (vectorized::is_two_level_hash_map_v<decltype(hash_map_with_key.hash_map)>) {
+            if (config::enable_streaming_preaggregation_by_partition) {
+                _update_streaming_partitions();
+                auto allocate_func = [this]() {
+                    vectorized::AggDataPtr agg_state =
+                            _mem_pool->allocate_aligned(_agg_states_total_size, _max_agg_state_align_size);
+                    for (int i = 0; i < _agg_functions.size(); i++) {
+                        _agg_functions[i]->create(_agg_fn_ctxs[i], agg_state + _agg_states_offsets[i]);
+                    }
+                    return agg_state;
+                };
+                hash_map_with_key.compute_agg_states_by_partition(chunk_size, _group_by_columns, _mem_pool.get(),
+                                                                  allocate_func, &_tmp_agg_states,
+                                                                  &_streaming_selection, &_streaming_partitions);
+                COUNTER_SET(_streaming_aggregated_new_key_rows, _streaming_partitions.aggregated_new_key_rows);
+                return;
+            }
+        }
+        build_hash_map_with_selection(hash_map_with_key, chunk_size);
+    }
+
     template <typename HashSetWithKey>
     void build_hash_set(HashSetWithKey& hash_set, size_t chunk_size) {
         hash_set.build_set(chunk_size, _group_by_columns, _mem_pool.get());
@@ -373,27 +505,53 @@ public:
 
         _it_hash = it;
 
-        vectorized::ChunkPtr _result_chunk = std::make_shared<vectorized::Chunk>();
-        // For different agg phase, we should use different TupleDescriptor
-        if (_needs_finalize) {
-            for (size_t i = 0; i < group_by_columns.size(); i++) {
-                _result_chunk->append_column(group_by_columns[i], _output_tuple_desc->slots()[i]->id());
-            }
-            for (size_t i = 0; i < agg_result_columns.size(); i++) {
-                size_t id = group_by_columns.size() + i;
-                _result_chunk->append_column(agg_result_columns[i], _output_tuple_desc->slots()[id]->id());
-            }
-        } else {
-            for (size_t i = 0; i < group_by_columns.size(); i++) {
-                _result_chunk->append_column(group_by_columns[i], _intermediate_tuple_desc->slots()[i]->id());
+        _num_rows_returned += read_index;
+        *chunk = _build_result_chunk(group_by_columns, agg_result_columns);
+    }
+
+    // Like convert_hash_map_to_chunk(), but the sub maps of a two-level hash map of at least
+    // config::pipeline_agg_parallel_output_min_rows groups are converted to chunks in parallel in
+    // ExecEnv::agg_output_thread_pool(), a batch of sub maps at a time.
+    template <typename HashMapWithKey>
+    Status convert_hash_map_to_chunk_in_parallel(HashMapWithKey& hash_map_with_key, int32_t chunk_size,
+                                                 vectorized::ChunkPtr* chunk) {
+        if constexpr (vectorized::is_two_level_hash_map_v<decltype(hash_map_with_key.hash_map)> &&
+                      !HashMapWithKey::has_single_null_key) {
+            auto& hash_map = hash_map_with_key.hash_map;
+            if (_parallel_output_pool == nullptr && _next_output_submap == 0 && _parallel_output_chunks.empty()) {
+                _parallel_output_pool = _get_parallel_output_pool(hash_map.size());
             }
-            for (size_t i = 0; i < agg_result_columns.size(); i++) {
-                size_t id = group_by_columns.size() + i;
-                _result_chunk->append_column(agg_result_columns[i], _intermediate_tuple_desc->slots()[id]->id());
+            if (_parallel_output_pool != nullptr) {
+                SCOPED_TIMER(_get_results_timer);
+                if (_parallel_output_chunks.empty() && _next_output_submap < hash_map.subcnt()) {
+                    size_t num_submaps = std::min<size_t>(hash_map.subcnt() - _next_output_submap,
+                                                          config::pipeline_agg_output_thread_pool_thread_num + 1);
+                    std::vector<std::vector<vectorized::ChunkPtr>> submap_chunks(num_submaps);
+                    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+                    RETURN_IF_ERROR(parallel_run(_parallel_output_pool, num_submaps, [&](size_t i) {
+                        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+                        _convert_submap_to_chunks(hash_map_with_key, _next_output_submap + i, chunk_size,
+                                                  &submap_chunks[i]);
+                        return Status::OK();
+                    }));
+                    _next_output_submap += num_submaps;
+                    for (auto& chunks : submap_chunks) {
+                        for (auto& submap_chunk : chunks) {
+                            _parallel_output_chunks.push(std::move(submap_chunk));
+                        }
+                    }
+                }
+                if (!_parallel_output_chunks.empty()) {
+                    *chunk = std::move(_parallel_output_chunks.front());
+                    _parallel_output_chunks.pop();
+                    _num_rows_returned += (*chunk)->num_rows();
+                }
+                _is_ht_eos = _parallel_output_chunks.empty() && _next_output_submap >= hash_map.subcnt();
+                return Status::OK();
             }
         }
-        _num_rows_returned += read_index;
-        *chunk = std::move(_result_chunk);
+        convert_hash_map_to_chunk(hash_map_with_key, chunk_size, chunk);
+        return Status::OK();
     }
 
     template <typename HashSetWithKey>
@@ -456,14 +614,64 @@ public:
         *chunk = std::move(result_chunk);
     }
 
+    template <typename HashMapWithKey>
+    Status spill_hash_map(HashMapWithKey& hash_map_with_key) {
+        using Iterator = typename HashMapWithKey::Iterator;
+        const int32_t chunk_size = _state->chunk_size();
+        Iterator it = hash_map_with_key.hash_map.begin();
+        Iterator end = hash_map_with_key.hash_map.end();
+
+        while (it != end) {
+            vectorized::Columns group_by_columns = _create_group_by_columns();
+            vectorized::Columns agg_result_columns = _create_agg_serialize_columns();
+
+            int32_t read_index = 0;
+            hash_map_with_key.results.resize(chunk_size);
+            while ((it != end) & (read_index < chunk_size)) {
+                hash_map_with_key.results[read_index] = it->first;
+                _tmp_agg_states[read_index] = it->second;
+                ++read_index;
+                ++it;
+            }
+            hash_map_with_key.insert_keys_to_columns(hash_map_with_key.results, group_by_columns, read_index);
+            for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+                _agg_functions[i]->batch_serialize(_agg_fn_ctxs[i], read_index, _tmp_agg_states,
+                                                   _agg_states_offsets[i], agg_result_columns[i].get());
+            }
+            RETURN_IF_ERROR(_spill_intermediate_chunk(group_by_columns, agg_result_columns));
+        }
+
+        if constexpr (HashMapWithKey::has_single_null_key) {
+            if (hash_map_with_key.null_key_data != nullptr) {
+                vectorized::Columns group_by_columns = _create_group_by_columns();
+                vectorized::Columns agg_result_columns = _create_agg_serialize_columns();
+                DCHECK(group_by_columns.size() == 1);
+                DCHECK(group_by_columns[0]->is_nullable());
+                group_by_columns[0]->append_default();
+                _serialize_to_chunk(hash_map_with_key.null_key_data, agg_result_columns);
+                RETURN_IF_ERROR(_spill_intermediate_chunk(group_by_columns, agg_result_columns));
+            }
+        }
+        return Status::OK();
+    }
+
 private:
     bool _reached_limit() { return _limit != -1 && _num_rows_returned >= _limit; }
 
+    Status _spill_intermediate_chunk(const vectorized::Columns& group_by_columns,
+                                     const vectorized::Columns& agg_result_columns);
+    // Merge the spilled intermediate chunk into the hash map.
+    Status _merge_spilled_chunk(const vectorized::ChunkPtr& chunk);
+    // Destroy all agg states and replace the hash map with an empty one.
+    void _reset_hash_map();
+
     // initial const columns for i'th FunctionContext.
     Status _evaluate_const_columns(int i);
 
     // Create new aggregate function result column by type
     vectorized::Columns _create_agg_result_columns();
+    // Create columns for serialized(intermediate) aggregate states by serde type
+    vectorized::Columns _create_agg_serialize_columns();
     vectorized::Columns _create_group_by_columns();
 
     void _serialize_to_chunk(vectorized::ConstAggDataPtr __restrict state,
@@ -478,6 +686,9 @@ private:
     template <typename HashVariantType>
     void _init_agg_hash_variant(HashVariantType& hash_variant);
 
+    // Update the capacity, load factor and resizes of the hash table in the profile, called once per input chunk.
+    void _update_hash_table_stats(size_t capacity, size_t size);
+
     template <typename HashMapWithKey>
     void _release_agg_memory(HashMapWithKey* hash_map_with_key) {
         if (hash_map_with_key != nullptr) {
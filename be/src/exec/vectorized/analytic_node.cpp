@@ -226,10 +226,7 @@ Status AnalyticNode::_get_next_for_sliding_frame(RuntimeState* state, ChunkPtr*
 
         while (_analytor->current_row_position() < _analytor->partition_end() &&
                _analytor->window_result_position() < chunk_size) {
-            _analytor->reset_window_state();
-            FrameRange range = _analytor->get_sliding_frame_range();
-            _analytor->update_window_batch(_analytor->partition_start(), _analytor->partition_end(), range.start,
-                                           range.end);
+            _analytor->update_window_batch_for_sliding_frame();
             _analytor->update_window_result_position(1);
             int64_t result_start = _analytor->get_total_position(_analytor->current_row_position()) -
                                    _analytor->input_chunk_first_row_positions()[_analytor->output_chunk_index()];
@@ -346,6 +343,9 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory> > AnalyticNode::decompose
     using namespace pipeline;
     OpFactories operators_with_sink = _children[0]->decompose_to_pipeline(context);
 
+    // With the partition clause, the child is a sort node which shuffles the rows by the partition exprs locally
+    // and sorts each shuffle partition independently, so each driver gets whole partitions and the analytic runs
+    // at the dop of the child.
     // analytic's dop must be 1 if with no partition clause
     if (_tnode.analytic_node.partition_exprs.empty()) {
         operators_with_sink =
@@ -15,6 +15,7 @@
 #include "exprs/expr_context.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/runtime_state.h"
+#include "simd/simd.h"
 #include "udf/java/utils.h"
 #include "udf/udf.h"
 #include "util/runtime_profile.h"
@@ -25,6 +26,21 @@ Status window_init_jvm_context(int64_t fid, const std::string& url, const std::s
                                const std::string& symbol, starrocks_udf::FunctionContext* context);
 } // namespace vectorized
 
+namespace {
+
+int64_t count_non_null_rows(const vectorized::Column* column, int64_t start, int64_t end) {
+    if (start >= end) {
+        return 0;
+    }
+    if (!column->has_null()) {
+        return end - start;
+    }
+    const auto* nulls = down_cast<const vectorized::NullableColumn*>(column)->immutable_null_column_data().data();
+    return SIMD::count_zero(nulls + start, end - start);
+}
+
+} // namespace
+
 Analytor::Analytor(const TPlanNode& tnode, const RowDescriptor& child_row_desc,
                    const TupleDescriptor* result_tuple_desc)
         : _tnode(tnode), _child_row_desc(child_row_desc), _result_tuple_desc(result_tuple_desc) {
@@ -192,6 +208,15 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
         }
     }
 
+    // The state of a sliding frame is extended to the next frame if all the functions support it, and the rows
+    // leaving the frame are retracted if the frame has a start bound.
+    _use_incremental_window = !_has_lead_lag_function;
+    for (const auto* agg_function : _agg_functions) {
+        _use_incremental_window &= agg_function->support_incremental_window_update() &&
+                                   (!_is_range_with_start || agg_function->support_retract());
+    }
+    _window_non_null_rows.assign(agg_size, 0);
+
     // compute agg state total size and offsets
     for (int i = 0; i < agg_size; ++i) {
         _agg_states_offsets[i] = _agg_states_total_size;
@@ -368,11 +393,56 @@ void Analytor::update_window_batch(int64_t peer_group_start, int64_t peer_group_
     }
 }
 
+void Analytor::update_window_batch_for_sliding_frame() {
+    FrameRange range = get_sliding_frame_range();
+    if (!_use_incremental_window) {
+        reset_window_state();
+        update_window_batch(_partition_start, _partition_end, range.start, range.end);
+        return;
+    }
+
+    int64_t frame_start = std::max<int64_t>(range.start, _partition_start);
+    int64_t frame_end = std::max<int64_t>(std::min<int64_t>(range.end, _partition_end), frame_start);
+    // The frames only move forward in a partition, start over otherwise.
+    if (_window_frame_start < 0 || frame_start < _window_frame_start || frame_end < _window_frame_end ||
+        frame_start > _window_frame_end) {
+        reset_window_state();
+        _window_frame_start = frame_start;
+        _window_frame_end = frame_start;
+        std::fill(_window_non_null_rows.begin(), _window_non_null_rows.end(), 0);
+    }
+
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        const vectorized::Column* agg_column = _agg_intput_columns[i][0].get();
+        AggDataPtr state = _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i];
+        if (frame_start > _window_frame_start) {
+            _agg_functions[i]->retract_batch_single_state(_agg_fn_ctxs[i], state, &agg_column, _window_frame_start,
+                                                          frame_start);
+        }
+        if (frame_end > _window_frame_end) {
+            _agg_functions[i]->update_batch_single_state(_agg_fn_ctxs[i], state, &agg_column, _partition_start,
+                                                         _partition_end, _window_frame_end, frame_end);
+        }
+        // The nullable function is null if all the rows of the frame are null, which is lost by the retraction.
+        if (_is_range_with_start && _agg_fn_types[i].has_nullable_child) {
+            _window_non_null_rows[i] += count_non_null_rows(agg_column, _window_frame_end, frame_end) -
+                                        count_non_null_rows(agg_column, _window_frame_start, frame_start);
+            if (_window_non_null_rows[i] == 0) {
+                _agg_functions[i]->reset(_agg_fn_ctxs[i], _agg_intput_columns[i], state);
+            }
+        }
+    }
+    _window_frame_start = frame_start;
+    _window_frame_end = frame_end;
+}
+
 void Analytor::reset_window_state() {
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         _agg_functions[i]->reset(_agg_fn_ctxs[i], _agg_intput_columns[i],
                                  _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i]);
     }
+    _window_frame_start = -1;
+    _window_frame_end = -1;
 }
 
 void Analytor::get_window_function_result(int32_t start, int32_t end) {
@@ -555,6 +625,10 @@ void Analytor::remove_unused_buffer_values(RuntimeState* state) {
     _current_row_position -= remove_count;
     _peer_group_start -= remove_count;
     _peer_group_end -= remove_count;
+    if (_window_frame_start >= 0) {
+        _window_frame_start -= remove_count;
+        _window_frame_end -= remove_count;
+    }
 
     _removed_chunk_index += BUFFER_CHUNK_NUMBER;
 
@@ -98,6 +98,9 @@ public:
     FrameRange get_sliding_frame_range();
 
     void update_window_batch(int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start, int64_t frame_end);
+    // Computes the state of the sliding frame of the current row, from the state of the previous frame when
+    // the functions support it, otherwise from scratch.
+    void update_window_batch_for_sliding_frame();
     void reset_window_state();
     void get_window_function_result(int32_t start, int32_t end);
 
@@ -172,6 +175,15 @@ private:
     int64_t _rows_start_offset = 0;
     int64_t _rows_end_offset = 0;
 
+    // Whether the sliding frame is computed incrementally, by retracting the rows leaving the frame and adding
+    // the rows entering it.
+    bool _use_incremental_window = false;
+    // The frame [start, end) in the window state, start is -1 if the state holds no frame.
+    int64_t _window_frame_start = -1;
+    int64_t _window_frame_end = -1;
+    // The number of non-null rows in the frame of each window function.
+    std::vector<int64_t> _window_non_null_rows;
+
     // The offset of the n-th window function in a row of window functions.
     std::vector<size_t> _agg_states_offsets;
     // The total size of the row for the window function state.
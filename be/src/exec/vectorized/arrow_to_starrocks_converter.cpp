@@ -4,6 +4,9 @@
 
 #include <arrow/array.h>
 
+#include <array>
+#include <cstring>
+
 #include "arrow/array/array_binary.h"
 #include "arrow/array/array_nested.h"
 #include "arrow/scalar.h"
@@ -20,6 +23,7 @@
 #include "runtime/primitive_type.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "simd/simd.h"
 #include "util/pred_guard.h"
 
 namespace starrocks::vectorized {
@@ -57,26 +61,61 @@ IS_ASSIGNABLE(ArrowTypeId::UINT64, TYPE_LARGEINT)
 IS_ASSIGNABLE(ArrowTypeId::HALF_FLOAT, TYPE_FLOAT, TYPE_DOUBLE)
 IS_ASSIGNABLE(ArrowTypeId::FLOAT, TYPE_DOUBLE)
 
+// kBitsToBytes[b] has the i-th byte set to 1 if the i-th bit of |b| is set, which is the order of
+// the bits in the validity bitmap of arrow.
+static constexpr std::array<uint64_t, 256> kBitsToBytes = [] {
+    std::array<uint64_t, 256> table{};
+    for (int b = 0; b < 256; ++b) {
+        for (int i = 0; i < 8; ++i) {
+            if ((b >> i) & 1) {
+                table[b] |= 1ULL << (8 * i);
+            }
+        }
+    }
+    return table;
+}();
+
+// Expand the validity bitmap of the array's range [array_start_idx, array_start_idx + num_elements) into
+// one byte per element, which is 1 for the valid ones, or for the null ones if |is_null| is true.
+// Eight elements are expanded at once, instead of calling arrow::Array::IsNull() for each element.
+static void unpack_validity(const arrow::Array* array, size_t array_start_idx, size_t num_elements, bool is_null,
+                            uint8_t* dst) {
+    const uint8_t* bitmap = array->null_bitmap_data();
+    if (bitmap == nullptr) {
+        // Either no element or all the elements are null, e.g. NullArray, in line with arrow::Array::IsNull().
+        const bool all_null = array->null_count() == array->length();
+        memset(dst, all_null == is_null ? 1 : 0, num_elements);
+        return;
+    }
+    const uint8_t flip = is_null ? 1 : 0;
+    const uint64_t flip8 = is_null ? 0x0101010101010101ULL : 0;
+    size_t bit = array->offset() + array_start_idx;
+    size_t i = 0;
+    for (; i < num_elements && (bit & 7) != 0; ++i, ++bit) {
+        dst[i] = ((bitmap[bit >> 3] >> (bit & 7)) & 1) ^ flip;
+    }
+    for (; i + 8 <= num_elements; i += 8, bit += 8) {
+        uint64_t bytes = kBitsToBytes[bitmap[bit >> 3]] ^ flip8;
+        memcpy(dst + i, &bytes, sizeof(bytes));
+    }
+    for (; i < num_elements; ++i, ++bit) {
+        dst[i] = ((bitmap[bit >> 3] >> (bit & 7)) & 1) ^ flip;
+    }
+}
+
 size_t fill_null_column(const arrow::Array* array, size_t array_start_idx, size_t num_elements, NullColumn* null_column,
                         size_t column_start_idx) {
     null_column->resize(null_column->size() + num_elements);
     auto* null_data = (&null_column->get_data().front()) + column_start_idx;
-    size_t null_count = 0;
-    for (size_t i = 0; i < num_elements; ++i) {
-        auto is_null = array->IsNull(array_start_idx + i);
-        null_data[i] = is_null;
-        null_count += is_null;
-    }
-    return null_count;
+    unpack_validity(array, array_start_idx, num_elements, true, null_data);
+    return SIMD::count_nonzero(null_data, num_elements);
 }
 
 void fill_filter(const arrow::Array* array, size_t array_start_idx, size_t num_elements, Column::Filter* filter,
                  size_t column_start_idx) {
     DCHECK_EQ(filter->size(), column_start_idx + num_elements);
     auto* filter_data = (&filter->front()) + column_start_idx;
-    for (size_t i = 0; i < num_elements; ++i) {
-        filter_data[i] = array->IsValid(array_start_idx + i);
-    }
+    unpack_validity(array, array_start_idx, num_elements, false, filter_data);
 }
 // A general arrow converter for fixed length type
 //
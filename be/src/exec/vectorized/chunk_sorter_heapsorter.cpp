@@ -103,6 +103,16 @@ uint64_t HeapChunkSorter::get_partition_rows() const {
     return _merged_segment.chunk->num_rows();
 }
 
+bool HeapChunkSorter::get_topn_boundary(Datum* value) {
+    if (_sort_heap == nullptr || _sort_heap->size() < _number_of_rows_to_sort()) {
+        return false;
+    }
+    // The top of the heap is the last row of the top n.
+    const auto& top_cursor = _sort_heap->top();
+    *value = top_cursor.data_segment()->order_by_columns[0]->get(top_cursor.row_id());
+    return !value->is_null();
+}
+
 Status HeapChunkSorter::done(RuntimeState* state) {
     ScopedTimer<MonotonicStopWatch> timer(_build_timer);
     if (_sort_heap) {
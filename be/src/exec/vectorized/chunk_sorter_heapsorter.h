@@ -231,6 +231,7 @@ public:
     DataSegment* get_result_data_segment() override;
     uint64_t get_partition_rows() const override;
     Permutation* get_permutation() const override { return nullptr; }
+    bool get_topn_boundary(Datum* value) override;
 
     void setup_runtime(RuntimeProfile* profile) override;
 
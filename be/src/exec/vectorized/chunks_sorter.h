@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "column/datum.h"
 #include "column/vectorized_fwd.h"
 #include "exec/sort_exec_exprs.h"
 #include "exec/vectorized/sorting/sort_permute.h"
@@ -127,6 +128,13 @@ public:
 
     virtual int64_t mem_usage() const = 0;
 
+    // Whether part of the sorted data has been spilled to disk.
+    virtual bool has_spilled() const { return false; }
+
+    // For top-n sorters, get the value of the first order-by column of the current N-th row, the rows after
+    // which could never be output. Returns false if fewer than N rows are kept yet or the value is null.
+    virtual bool get_topn_boundary(Datum* value) { return false; }
+
     // For test only
     void set_compare_strategy(CompareStrategy cmp) { _compare_strategy = cmp; }
 
@@ -5,6 +5,7 @@
 #include "column/type_traits.h"
 #include "exec/vectorized/sorting/sort_permute.h"
 #include "exec/vectorized/sorting/sorting.h"
+#include "exec/pipeline/query_context.h"
 #include "exprs/expr.h"
 #include "gutil/casts.h"
 #include "runtime/primitive_type_infra.h"
@@ -27,6 +28,13 @@ Status ChunksSorterFullSort::update(RuntimeState* state, const ChunkPtr& chunk)
     if (UNLIKELY(_big_chunk == nullptr)) {
         _big_chunk = chunk->clone_empty();
     }
+    if (!_is_mem_consumer_created) {
+        _is_mem_consumer_created = true;
+        _mem_consumer = pipeline::MemConsumer::create(state, "sort", _spill_enabled);
+    }
+    if (_mem_consumer != nullptr) {
+        _mem_consumer->try_reserve(chunk->memory_usage());
+    }
 
     size_t target_rows = _big_chunk->num_rows() + chunk->num_rows();
     if (target_rows > Column::MAX_CAPACITY_LIMIT) {
@@ -42,10 +50,19 @@ Status ChunksSorterFullSort::update(RuntimeState* state, const ChunkPtr& chunk)
     }
 
     DCHECK(!_big_chunk->has_const_column());
+
+    if (_spill_enabled && (should_spill(state, mem_usage()) ||
+                           (_mem_consumer != nullptr && _mem_consumer->is_spill_requested()))) {
+        RETURN_IF_ERROR(_spill_sorted_run(state));
+    }
+    if (_mem_consumer != nullptr) {
+        _mem_consumer->update_usage(mem_usage());
+    }
     return Status::OK();
 }
 
 Status ChunksSorterFullSort::done(RuntimeState* state) {
+    _mem_consumer.reset();
     if (_big_chunk != nullptr && _big_chunk->num_rows() > 0) {
         RETURN_IF_ERROR(_sort_chunks(state));
     }
@@ -73,7 +90,7 @@ DataSegment* ChunksSorterFullSort::get_result_data_segment() {
 }
 
 uint64_t ChunksSorterFullSort::get_partition_rows() const {
-    return _sorted_permutation.size();
+    return _sorted_permutation.size() + _spilled_rows;
 }
 
 // Is used to index sorted datas.
@@ -117,6 +134,92 @@ int64_t ChunksSorterFullSort::mem_usage() const {
     return usage;
 }
 
+void ChunksSorterFullSort::setup_runtime(RuntimeProfile* profile) {
+    ChunksSorter::setup_runtime(profile);
+    if (_spill_enabled && _state->enable_spill()) {
+        _spill_timer = ADD_TIMER(profile, "SpillTime");
+        _spill_bytes = ADD_COUNTER(profile, "SpillBytes", TUnit::BYTES);
+        _spill_runs = ADD_COUNTER(profile, "SpillRuns", TUnit::UNIT);
+    }
+}
+
+void ChunksSorterFullSort::create_sorted_cursors(std::vector<std::unique_ptr<SimpleChunkSortCursor>>* cursors) {
+    for (auto& spilled_run : _spilled_runs) {
+        SpillFile* file = spilled_run.get();
+        auto provider = [this, file](Chunk** output, bool* eos) -> bool {
+            // data of spilled runs is always ready
+            if (output == nullptr || eos == nullptr) {
+                return true;
+            }
+            auto chunk = file->read(*_spill_prototype);
+            if (!chunk.ok()) {
+                if (!chunk.status().is_end_of_file()) {
+                    _spill_status = chunk.status();
+                }
+                *eos = true;
+                return false;
+            }
+            *output = chunk.value().release();
+            return true;
+        };
+        cursors->push_back(std::make_unique<SimpleChunkSortCursor>(std::move(provider), _sort_exprs));
+    }
+
+    if (_next_output_row < _sorted_permutation.size()) {
+        auto provider = [this](Chunk** output, bool* eos) -> bool {
+            if (output == nullptr || eos == nullptr) {
+                return true;
+            }
+            ChunkUniquePtr chunk = _next_sorted_chunk();
+            if (chunk == nullptr) {
+                *eos = true;
+                return false;
+            }
+            *output = chunk.release();
+            return true;
+        };
+        cursors->push_back(std::make_unique<SimpleChunkSortCursor>(std::move(provider), _sort_exprs));
+    }
+}
+
+Status ChunksSorterFullSort::_spill_sorted_run(RuntimeState* state) {
+    SCOPED_TIMER(_spill_timer);
+    RETURN_IF_ERROR(_sort_chunks(state));
+
+    ASSIGN_OR_RETURN(auto file, SpillFile::create("sort"));
+    while (ChunkUniquePtr chunk = _next_sorted_chunk()) {
+        RETURN_IF_ERROR(file->append(*chunk));
+    }
+    RETURN_IF_ERROR(file->flip_to_read());
+    if (_spill_prototype == nullptr) {
+        _spill_prototype = _sorted_segment->chunk->clone_empty();
+    }
+    _spilled_rows += file->num_rows();
+    COUNTER_UPDATE(_spill_bytes, file->num_bytes());
+    if (state->query_ctx() != nullptr) {
+        state->query_ctx()->incr_spill_bytes(file->num_bytes());
+    }
+    COUNTER_UPDATE(_spill_runs, 1);
+    _spilled_runs.emplace_back(std::move(file));
+
+    // release the memory of the spilled run, the following chunks are buffered into a new _big_chunk.
+    _sorted_segment.reset();
+    Permutation().swap(_sorted_permutation);
+    _next_output_row = 0;
+    return Status::OK();
+}
+
+ChunkUniquePtr ChunksSorterFullSort::_next_sorted_chunk() {
+    if (_next_output_row >= _sorted_permutation.size()) {
+        return nullptr;
+    }
+    size_t count = std::min(size_t(_state->chunk_size()), _sorted_permutation.size() - _next_output_row);
+    ChunkUniquePtr chunk = _sorted_segment->chunk->clone_empty(count);
+    _append_rows_to_chunk(chunk.get(), _sorted_segment->chunk.get(), _sorted_permutation, _next_output_row, count);
+    _next_output_row += count;
+    return chunk;
+}
+
 Status ChunksSorterFullSort::_sort_chunks(RuntimeState* state) {
     // Step1: construct permutation
     RETURN_IF_ERROR(_build_sorting_data(state));
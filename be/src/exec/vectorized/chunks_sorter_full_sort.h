@@ -2,8 +2,11 @@
 
 #pragma once
 
+#include "exec/pipeline/query_mem_arbitrator.h"
 #include "exec/vectorized/chunks_sorter.h"
+#include "exec/vectorized/spill/spill_file.h"
 #include "gtest/gtest_prod.h"
+#include "runtime/chunk_cursor.h"
 
 namespace starrocks {
 class ExprContext;
@@ -36,9 +39,26 @@ public:
 
     int64_t mem_usage() const override;
 
+    // External sort: once the memory budget is exceeded, the buffered rows are sorted and spilled to disk
+    // as a sorted run, and all the sorted runs are merged when output. Only used by the pipeline engine.
+    void set_spill_enabled(bool spill_enabled) { _spill_enabled = spill_enabled; }
+    bool has_spilled() const override { return !_spilled_runs.empty(); }
+
+    // Create a cursor for every sorted run, including the spilled runs and the run in memory, which should be
+    // merged to get the sorted data, instead of get_next() or pull_chunk().
+    // Errors encountered when reading the spilled runs are reported by spill_status().
+    void create_sorted_cursors(std::vector<std::unique_ptr<SimpleChunkSortCursor>>* cursors);
+    const Status& spill_status() const { return _spill_status; }
+
+    void setup_runtime(RuntimeProfile* profile) override;
+
     friend class SortHelper;
 
 private:
+    Status _spill_sorted_run(RuntimeState* state);
+    // Return nullptr if all the sorted rows in memory have been output.
+    ChunkUniquePtr _next_sorted_chunk();
+
     Status _sort_chunks(RuntimeState* state);
     Status _build_sorting_data(RuntimeState* state);
     Status _sort_by_column_inc(RuntimeState* state);
@@ -49,6 +69,20 @@ private:
     std::unique_ptr<DataSegment> _sorted_segment;
     mutable Permutation _sorted_permutation;
     std::vector<uint32_t> _selective_values; // for appending selective values to sorted rows
+
+    bool _spill_enabled = false;
+    std::vector<SpillFilePtr> _spilled_runs;
+    // Used to read chunks back from the spilled runs.
+    ChunkPtr _spill_prototype;
+    uint64_t _spilled_rows = 0;
+    Status _spill_status;
+    // Reserves the memory of the buffered rows from the arbitrator of the query, released after all input is sorted.
+    pipeline::MemConsumerPtr _mem_consumer;
+    bool _is_mem_consumer_created = false;
+
+    RuntimeProfile::Counter* _spill_timer = nullptr;
+    RuntimeProfile::Counter* _spill_bytes = nullptr;
+    RuntimeProfile::Counter* _spill_runs = nullptr;
 };
 
 } // namespace vectorized
@@ -104,6 +104,15 @@ uint64_t ChunksSorterTopn::get_partition_rows() const {
     return _merged_segment.chunk->num_rows();
 }
 
+bool ChunksSorterTopn::get_topn_boundary(Datum* value) {
+    size_t rows_to_sort = _get_number_of_rows_to_sort();
+    if (!_init_merged_segment || _merged_segment.chunk == nullptr || _merged_segment.chunk->num_rows() < rows_to_sort) {
+        return false;
+    }
+    *value = _merged_segment.order_by_columns[0]->get(rows_to_sort - 1);
+    return !value->is_null();
+}
+
 Permutation* ChunksSorterTopn::get_permutation() const {
     return nullptr;
 }
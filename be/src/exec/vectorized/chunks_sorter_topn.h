@@ -62,6 +62,8 @@ public:
     uint64_t get_partition_rows() const override;
     Permutation* get_permutation() const override;
 
+    bool get_topn_boundary(Datum* value) override;
+
     // pull_chunk for pipeline.
     bool pull_chunk(ChunkPtr* chunk) override;
 
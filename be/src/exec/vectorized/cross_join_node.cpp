@@ -2,6 +2,8 @@
 
 #include "exec/vectorized/cross_join_node.h"
 
+#include <tuple>
+
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "exec/pipeline/crossjoin/cross_join_context.h"
@@ -23,6 +25,7 @@ Status CrossJoinNode::init(const TPlanNode& tnode, RuntimeState* state) {
     if (tnode.__isset.need_create_tuple_columns) {
         _need_create_tuple_columns = tnode.need_create_tuple_columns;
     }
+    _range_predicate = CrossJoinRangePredicate::create(_conjunct_ctxs, child(0)->row_desc(), child(1)->row_desc());
     return Status::OK();
 }
 
@@ -69,6 +72,8 @@ Status CrossJoinNode::_get_next_probe_chunk(RuntimeState* state) {
 
     _build_chunks_index = 0;
     _probe_chunk_index = 0;
+    _build_range_begin = 0;
+    _build_range_end = 0;
 
     return Status::OK();
 }
@@ -314,12 +319,28 @@ Status CrossJoinNode::get_next_internal(RuntimeState* state, ChunkPtr* chunk, bo
             row_count = runtime_state()->chunk_size() - (*chunk)->num_rows();
         }
 
-        // means we have scan all chunks of right tables.
-        // we should scan all remain rows of right table.
-        // once _probe_chunk_index == _probe_chunk->num_rows() is true,
-        // this condition will always true for this _probe_chunk,
-        // Until _probe_chunk be done.
-        if (_probe_chunk_index == _probe_chunk->num_rows()) {
+        if (_range_predicate != nullptr) {
+            // _build_chunk is sorted, only the build rows in range are joined with the probe row.
+            if (_build_range_begin < _build_range_end) {
+                row_count = std::min(row_count, _build_range_end - _build_range_begin);
+                _copy_joined_rows_with_index_base_probe(*chunk, row_count, _probe_chunk_index - 1,
+                                                        _build_range_begin);
+                _build_range_begin += row_count;
+            } else if (_probe_chunk_index < _probe_chunk->num_rows()) {
+                std::tie(_build_range_begin, _build_range_end) =
+                        _range_predicate->build_range(*_probe_chunk, _probe_chunk_index, *_build_chunk);
+                ++_probe_chunk_index;
+                continue;
+            } else {
+                // _probe_chunk is done with _build_chunk.
+                _probe_chunk = nullptr;
+            }
+        } else if (_probe_chunk_index == _probe_chunk->num_rows()) {
+            // means we have scan all chunks of right tables.
+            // we should scan all remain rows of right table.
+            // once _probe_chunk_index == _probe_chunk->num_rows() is true,
+            // this condition will always true for this _probe_chunk,
+            // Until _probe_chunk be done.
             // step 2:
             // if left chunk is bigger than right, we shuld scan left based on right.
             if (_probe_chunk_index > _number_of_build_rows - _build_chunks_size) {
@@ -501,6 +522,9 @@ Status CrossJoinNode::_build(RuntimeState* state) {
 
     // Should not call num_rows on nullptr.
     if (_build_chunk != nullptr) {
+        if (_range_predicate != nullptr) {
+            RETURN_IF_ERROR(_range_predicate->sort_build_chunk(state->cancelled_ref(), &_build_chunk));
+        }
         _number_of_build_rows = _build_chunk->num_rows();
         _build_chunks_size = (_number_of_build_rows / runtime_state()->chunk_size()) * runtime_state()->chunk_size();
     }
@@ -553,7 +577,8 @@ pipeline::OpFactories CrossJoinNode::decompose_to_pipeline(pipeline::PipelineBui
     auto&& rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(2, std::move(this->runtime_filter_collector()));
     // communication with CrossJoinLeft through shared_datas.
     auto* right_source = down_cast<SourceOperatorFactory*>(right_ops[0].get());
-    auto cross_join_context = std::make_shared<CrossJoinContext>(right_source->degree_of_parallelism());
+    auto cross_join_context =
+            std::make_shared<CrossJoinContext>(right_source->degree_of_parallelism(), _range_predicate);
 
     // cross_join_right as sink operator
     auto right_factory =
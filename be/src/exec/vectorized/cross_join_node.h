@@ -4,6 +4,7 @@
 
 #include "column/chunk.h"
 #include "exec/exec_node.h"
+#include "exec/vectorized/cross_join_range_predicate.h"
 
 namespace starrocks {
 namespace vectorized {
@@ -78,6 +79,13 @@ private:
     // And is used when _probe_chunk_index == _probe_chunk->num_rows().
     size_t _probe_rows_index = 0;
 
+    // Not null if a conjunct compares a probe slot with a build slot by <, <=, > or >=.
+    // Then _build_chunk is sorted by the build slot, and each probe row is only joined with
+    // the build rows in [_build_range_begin, _build_range_end), which are found by binary search.
+    std::shared_ptr<const CrossJoinRangePredicate> _range_predicate;
+    size_t _build_range_begin = 0;
+    size_t _build_range_end = 0;
+
     bool _eos = false;
     bool _need_create_tuple_columns = true;
 
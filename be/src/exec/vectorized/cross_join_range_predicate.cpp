@@ -0,0 +1,198 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/vectorized/cross_join_range_predicate.h"
+
+#include <algorithm>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "column/type_traits.h"
+#include "exec/vectorized/sorting/sorting.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "exprs/vectorized/column_ref.h"
+
+namespace starrocks::vectorized {
+
+static bool is_range_join_type(PrimitiveType type) {
+    switch (type) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_LARGEINT:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+    case TYPE_DECIMALV2:
+    case TYPE_DECIMAL32:
+    case TYPE_DECIMAL64:
+    case TYPE_DECIMAL128:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool is_range_op(TExprOpcode::type op) {
+    return op == TExprOpcode::LT || op == TExprOpcode::LE || op == TExprOpcode::GT || op == TExprOpcode::GE;
+}
+
+// `a op b` is the same as `b reverse_op(op) a`.
+static TExprOpcode::type reverse_op(TExprOpcode::type op) {
+    switch (op) {
+    case TExprOpcode::LT:
+        return TExprOpcode::GT;
+    case TExprOpcode::LE:
+        return TExprOpcode::GE;
+    case TExprOpcode::GT:
+        return TExprOpcode::LT;
+    case TExprOpcode::GE:
+        return TExprOpcode::LE;
+    default:
+        return op;
+    }
+}
+
+static bool contains_slot(const RowDescriptor& row_desc, SlotId slot_id) {
+    for (const auto* tuple_desc : row_desc.tuple_descriptors()) {
+        for (const auto* slot : tuple_desc->slots()) {
+            if (slot->id() == slot_id) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+std::unique_ptr<CrossJoinRangePredicate> CrossJoinRangePredicate::create(const std::vector<ExprContext*>& conjunct_ctxs,
+                                                                         const RowDescriptor& probe_row_desc,
+                                                                         const RowDescriptor& build_row_desc) {
+    for (ExprContext* ctx : conjunct_ctxs) {
+        Expr* root = ctx->root();
+        if (root->node_type() != TExprNodeType::BINARY_PRED || !is_range_op(root->op())) {
+            continue;
+        }
+        Expr* left = root->get_child(0);
+        Expr* right = root->get_child(1);
+        if (!left->is_slotref() || !right->is_slotref()) {
+            continue;
+        }
+        PrimitiveType type = left->type().type;
+        if (type != right->type().type || !is_range_join_type(type)) {
+            continue;
+        }
+
+        SlotId left_slot_id = down_cast<ColumnRef*>(left)->slot_id();
+        SlotId right_slot_id = down_cast<ColumnRef*>(right)->slot_id();
+        if (contains_slot(probe_row_desc, left_slot_id) && contains_slot(build_row_desc, right_slot_id)) {
+            return std::make_unique<CrossJoinRangePredicate>(left_slot_id, right_slot_id, type, root->op());
+        }
+        if (contains_slot(probe_row_desc, right_slot_id) && contains_slot(build_row_desc, left_slot_id)) {
+            return std::make_unique<CrossJoinRangePredicate>(right_slot_id, left_slot_id, type,
+                                                             reverse_op(root->op()));
+        }
+    }
+    return nullptr;
+}
+
+Status CrossJoinRangePredicate::sort_build_chunk(const bool& cancel, ChunkPtr* build_chunk) const {
+    const ColumnPtr& column = (*build_chunk)->get_column_by_slot_id(_build_slot_id);
+    // All the build rows have the same value, which are already in order.
+    if (column->is_constant()) {
+        return Status::OK();
+    }
+
+    const size_t num_rows = column->size();
+    SmallPermutation perm = create_small_permutation(num_rows);
+    Tie tie(num_rows, 1);
+    std::pair<int, int> range{0, num_rows};
+    RETURN_IF_ERROR(sort_and_tie_column(cancel, column, true, true, perm, tie, range, false));
+
+    std::vector<uint32_t> selective;
+    permutate_to_selective(perm, &selective);
+    ChunkPtr sorted_chunk = (*build_chunk)->clone_empty_with_tuple(num_rows);
+    sorted_chunk->append_selective(**build_chunk, selective.data(), 0, num_rows);
+    *build_chunk = std::move(sorted_chunk);
+    return Status::OK();
+}
+
+template <PrimitiveType PT>
+static std::pair<size_t, size_t> search_range(const Column* probe_column, size_t probe_row,
+                                              const Column* build_column, size_t begin, size_t end,
+                                              TExprOpcode::type op) {
+    const auto& probe_data = down_cast<const RunTimeColumnType<PT>*>(probe_column)->get_data();
+    const auto& build_data = down_cast<const RunTimeColumnType<PT>*>(build_column)->get_data();
+    const auto& value = probe_data[probe_row];
+    auto first = build_data.begin() + begin;
+    auto last = build_data.begin() + end;
+
+    switch (op) {
+    case TExprOpcode::LT:
+        // value < build
+        return {std::upper_bound(first, last, value) - build_data.begin(), end};
+    case TExprOpcode::LE:
+        // value <= build
+        return {std::lower_bound(first, last, value) - build_data.begin(), end};
+    case TExprOpcode::GT:
+        // value > build
+        return {begin, std::lower_bound(first, last, value) - build_data.begin()};
+    case TExprOpcode::GE:
+        // value >= build
+        return {begin, std::upper_bound(first, last, value) - build_data.begin()};
+    default:
+        return {begin, end};
+    }
+}
+
+std::pair<size_t, size_t> CrossJoinRangePredicate::build_range(const Chunk& probe_chunk, size_t probe_row,
+                                                               const Chunk& build_chunk) const {
+    const Column* build_column = build_chunk.get_column_by_slot_id(_build_slot_id).get();
+    const size_t num_build_rows = build_column->size();
+    // The build chunk isn't sorted, and every build row should be checked by the conjunct.
+    if (build_column->is_constant()) {
+        return {0, num_build_rows};
+    }
+
+    const Column* probe_column = probe_chunk.get_column_by_slot_id(_probe_slot_id).get();
+    if (probe_column->is_constant()) {
+        probe_column = down_cast<const ConstColumn*>(probe_column)->data_column().get();
+        probe_row = 0;
+    }
+    // Comparing with null is never true.
+    if (probe_column->is_null(probe_row)) {
+        return {0, 0};
+    }
+    probe_column = ColumnHelper::get_data_column(probe_column);
+
+    // The null build rows are in the front, and never match.
+    size_t begin = 0;
+    if (build_column->is_nullable()) {
+        const auto& null_data = down_cast<const NullableColumn*>(build_column)->immutable_null_column_data();
+        begin = std::partition_point(null_data.begin(), null_data.end(), [](uint8_t is_null) { return is_null; }) -
+                null_data.begin();
+    }
+    build_column = ColumnHelper::get_data_column(build_column);
+
+    switch (_type) {
+#define M(PT)      \
+    case PT:       \
+        return search_range<PT>(probe_column, probe_row, build_column, begin, num_build_rows, _op);
+        M(TYPE_TINYINT)
+        M(TYPE_SMALLINT)
+        M(TYPE_INT)
+        M(TYPE_BIGINT)
+        M(TYPE_LARGEINT)
+        M(TYPE_DATE)
+        M(TYPE_DATETIME)
+        M(TYPE_DECIMALV2)
+        M(TYPE_DECIMAL32)
+        M(TYPE_DECIMAL64)
+        M(TYPE_DECIMAL128)
+#undef M
+    default:
+        return {0, num_build_rows};
+    }
+}
+
+} // namespace starrocks::vectorized
@@ -0,0 +1,51 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+#include "gen_cpp/Opcodes_types.h"
+#include "runtime/descriptors.h"
+#include "runtime/primitive_type.h"
+
+namespace starrocks {
+class ExprContext;
+
+namespace vectorized {
+
+// A conjunct of cross join in the form of `probe_slot op build_slot`, where op is one of <, <=, >, >=.
+// After the build rows are sorted by build_slot, the build rows matching a probe row are contiguous,
+// so they can be located by binary search instead of crossing the probe row with all the build rows.
+class CrossJoinRangePredicate {
+public:
+    CrossJoinRangePredicate(SlotId probe_slot_id, SlotId build_slot_id, PrimitiveType type, TExprOpcode::type op)
+            : _probe_slot_id(probe_slot_id), _build_slot_id(build_slot_id), _type(type), _op(op) {}
+
+    // Returns nullptr if none of the conjuncts is a range predicate between a probe slot and a build slot.
+    static std::unique_ptr<CrossJoinRangePredicate> create(const std::vector<ExprContext*>& conjunct_ctxs,
+                                                           const RowDescriptor& probe_row_desc,
+                                                           const RowDescriptor& build_row_desc);
+
+    // Sort the rows of build_chunk by the build slot in ascending order with nulls first.
+    Status sort_build_chunk(const bool& cancel, ChunkPtr* build_chunk) const;
+
+    // Returns the range [begin, end) of rows in the sorted build_chunk which match the probe_row-th row of probe_chunk.
+    std::pair<size_t, size_t> build_range(const Chunk& probe_chunk, size_t probe_row, const Chunk& build_chunk) const;
+
+    SlotId probe_slot_id() const { return _probe_slot_id; }
+    SlotId build_slot_id() const { return _build_slot_id; }
+    TExprOpcode::type op() const { return _op; }
+
+private:
+    const SlotId _probe_slot_id;
+    const SlotId _build_slot_id;
+    const PrimitiveType _type;
+    // The op with probe slot on the left side.
+    const TExprOpcode::type _op;
+};
+
+} // namespace vectorized
+} // namespace starrocks
@@ -171,7 +171,6 @@ Status CSVScanner::_parse_csv(Chunk* chunk) {
     DCHECK_EQ(0, chunk->num_rows());
     Status status;
     CSVReader::Record record;
-    CSVReader::Fields fields;
 
     int num_columns = chunk->num_columns();
     _column_raw_ptrs.resize(num_columns);
@@ -179,63 +178,102 @@ Status CSVScanner::_parse_csv(Chunk* chunk) {
         _column_raw_ptrs[i] = chunk->get_column_by_index(i).get();
     }
 
-    csv::Converter::Options options{.invalid_field_as_null = !_strict_mode};
-
-    for (size_t num_rows = chunk->num_rows(); num_rows < capacity; /**/) {
-        status = _curr_reader->next_record(&record);
-        if (status.is_end_of_file()) {
-            break;
-        } else if (!status.ok()) {
-            return status;
-        } else if (record.empty()) {
+    // The records are split into fields in batches, and the fields of a batch are converted column by column.
+    // A batch only holds the records in the buffer of the reader, and it's converted before the reader
+    // fills the buffer, which moves the bytes of the records.
+    _records.clear();
+    _fields.clear();
+    for (size_t num_rows = 0; num_rows < capacity; /**/) {
+        if (!_curr_reader->next_buffered_record(&record)) {
+            _convert_fields(chunk);
+            status = _curr_reader->next_record(&record);
+            if (status.is_end_of_file()) {
+                break;
+            } else if (!status.ok()) {
+                return status;
+            }
+        }
+        if (record.empty()) {
             // always skip blank lines.
             continue;
         }
 
-        fields.clear();
-        _curr_reader->split_record(record, &fields);
+        const size_t num_fields = _fields.size();
+        _curr_reader->split_record(record, &_fields);
 
-        if (fields.size() != _num_fields_in_csv) {
+        if (_fields.size() - num_fields != _num_fields_in_csv) {
             if (_counter->num_rows_filtered++ < 50) {
                 std::stringstream error_msg;
                 error_msg << "Value count does not match column count. "
-                          << "Expect " << _num_fields_in_csv << ", but got " << fields.size();
+                          << "Expect " << _num_fields_in_csv << ", but got " << _fields.size() - num_fields;
                 _report_error(record.to_string(), error_msg.str());
             }
+            _fields.resize(num_fields);
             continue;
         }
         if (!validate_utf8(record.data, record.size)) {
             if (_counter->num_rows_filtered++ < 50) {
                 _report_error(record.to_string(), "Invalid UTF-8 row");
             }
+            _fields.resize(num_fields);
             continue;
         }
+        _records.emplace_back(record);
+        num_rows++;
+    }
+    _convert_fields(chunk);
+    return chunk->num_rows() > 0 ? Status::OK() : Status::EndOfFile("");
+}
 
-        SCOPED_RAW_TIMER(&_counter->fill_ns);
-        bool has_error = false;
-        for (int j = 0, k = 0; j < _num_fields_in_csv; j++) {
-            auto slot = _src_slot_descriptors[j];
-            if (slot == nullptr) {
+void CSVScanner::_convert_fields(Chunk* chunk) {
+    const size_t num_rows = _records.size();
+    if (num_rows == 0) {
+        return;
+    }
+    SCOPED_RAW_TIMER(&_counter->fill_ns);
+
+    const size_t num_rows_before = chunk->num_rows();
+    // The rows with an invalid field are removed after all the columns are converted.
+    _selection.assign(num_rows_before + num_rows, 1);
+    bool has_error = false;
+    csv::Converter::Options options{.invalid_field_as_null = !_strict_mode};
+    for (int j = 0, k = 0; j < _num_fields_in_csv; j++) {
+        auto slot = _src_slot_descriptors[j];
+        if (slot == nullptr) {
+            continue;
+        }
+        options.type_desc = &(slot->type());
+        const csv::Converter* converter = _converters[k].get();
+        Column* column = _column_raw_ptrs[k];
+        for (size_t i = 0; i < num_rows; i++) {
+            const Slice& field = _fields[i * _num_fields_in_csv + j];
+            if (_selection[num_rows_before + i] == 0) {
+                // The row has been filtered, just keep the columns aligned.
+                column->append_nulls(1);
                 continue;
             }
-            const Slice& field = fields[j];
-            options.type_desc = &(slot->type());
-            if (!_converters[k]->read_string(_column_raw_ptrs[k], field, options)) {
-                chunk->set_num_rows(num_rows);
+            const size_t column_size = column->size();
+            if (!converter->read_string(column, field, options)) {
+                if (column->size() == column_size) {
+                    column->append_nulls(1);
+                }
+                _selection[num_rows_before + i] = 0;
+                has_error = true;
                 if (_counter->num_rows_filtered++ < 50) {
                     std::stringstream error_msg;
                     error_msg << "Value '" << field.to_string() << "' is out of range. "
                               << "The type of '" << slot->col_name() << "' is " << slot->type().debug_string();
-                    _report_error(record.to_string(), error_msg.str());
+                    _report_error(_records[i].to_string(), error_msg.str());
                 }
-                has_error = true;
-                break;
             }
-            k++;
         }
-        num_rows += !has_error;
+        k++;
     }
-    return chunk->num_rows() > 0 ? Status::OK() : Status::EndOfFile("");
+    if (has_error) {
+        chunk->filter(_selection);
+    }
+    _records.clear();
+    _fields.clear();
 }
 
 ChunkPtr CSVScanner::_create_chunk(const std::vector<SlotDescriptor*>& slots) {
@@ -50,6 +50,8 @@ private:
     ChunkPtr _create_chunk(const std::vector<SlotDescriptor*>& slots);
 
     Status _parse_csv(Chunk* chunk);
+    // Convert the fields of _records into the columns of |chunk|, and clear _records and _fields.
+    void _convert_fields(Chunk* chunk);
     StatusOr<ChunkPtr> _materialize(ChunkPtr& src_chunk);
     void _report_error(const std::string& line, const std::string& err_msg);
 
@@ -58,6 +60,10 @@ private:
 
     const TBrokerScanRange& _scan_range;
     std::vector<Column*> _column_raw_ptrs;
+    // The records being parsed, which are still in the buffer of _curr_reader, and their fields.
+    std::vector<CSVReader::Record> _records;
+    CSVReader::Fields _fields;
+    Column::Filter _selection;
     string _record_delimiter;
     string _field_delimiter;
     int _num_fields_in_csv = 0;
@@ -4,6 +4,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "column/vectorized_fwd.h"
@@ -227,18 +228,24 @@ Status EsHttpScanNode::_normalize_conjuncts() {
 }
 
 Status EsHttpScanNode::_start_scan_thread(RuntimeState* state) {
-    _num_running_scanners = _scan_ranges.size();
-    _scanners_status.resize(_scan_ranges.size());
+    // Each shard is scanned by multiple sliced scrolls in parallel, unless the limit is pushed down,
+    // which is fetched by a single search request.
+    const int num_slices = _is_limit_pushed_down() ? 1 : std::max(1, config::es_scroll_slices_per_shard);
+    const size_t num_scanners = _scan_ranges.size() * num_slices;
+    _num_running_scanners = num_scanners;
+    _scanners_status.resize(num_scanners);
 
     // create scanner
-    std::vector<std::unique_ptr<EsHttpScanner>> scanners(_scan_ranges.size());
+    std::vector<std::unique_ptr<EsHttpScanner>> scanners(num_scanners);
     for (int i = 0; i < _scan_ranges.size(); i++) {
-        RETURN_IF_ERROR(_create_scanner(i, &scanners[i]));
+        for (int slice_id = 0; slice_id < num_slices; slice_id++) {
+            RETURN_IF_ERROR(_create_scanner(i, slice_id, num_slices, &scanners[i * num_slices + slice_id]));
+        }
     }
 
     // start scan
     // TODO: use thread pool instead of new thread
-    for (int i = 0; i < _scan_ranges.size(); i++) {
+    for (int i = 0; i < num_scanners; i++) {
         _scanner_threads.emplace_back(&EsHttpScanNode::_scanner_scan, this, std::move(scanners[i]),
                                       std::ref(_scanners_status[i]));
         Thread::set_thread_name(_scanner_threads.back(), "es_http_scan");
@@ -261,7 +268,12 @@ static std::string get_host_port(const std::vector<TNetworkAddress>& es_hosts) {
     return fmt::format("{}:{}", host.hostname, host.port);
 }
 
-Status EsHttpScanNode::_create_scanner(int scanner_idx, std::unique_ptr<EsHttpScanner>* res) {
+bool EsHttpScanNode::_is_limit_pushed_down() {
+    return limit() != -1 && limit() <= runtime_state()->chunk_size();
+}
+
+Status EsHttpScanNode::_create_scanner(int scanner_idx, int slice_id, int num_slices,
+                                       std::unique_ptr<EsHttpScanner>* res) {
     std::vector<ExprContext*> scanner_expr_ctxs;
     auto status = Expr::clone_if_not_exists(_conjunct_ctxs, runtime_state(), &scanner_expr_ctxs);
     RETURN_IF_ERROR(status);
@@ -277,9 +289,13 @@ Status EsHttpScanNode::_create_scanner(int scanner_idx, std::unique_ptr<EsHttpSc
     properties[ESScanReader::KEY_BATCH_SIZE] = std::to_string(runtime_state()->chunk_size());
     properties[ESScanReader::KEY_HOST_PORT] = get_host_port(es_scan_range.es_hosts);
     // push down limit to Elasticsearch
-    if (limit() != -1 && limit() <= runtime_state()->chunk_size()) {
+    if (_is_limit_pushed_down()) {
         properties[ESScanReader::KEY_TERMINATE_AFTER] = std::to_string(limit());
     }
+    if (num_slices > 1) {
+        properties[ESScanReader::KEY_SLICE_ID] = std::to_string(slice_id);
+        properties[ESScanReader::KEY_SLICE_MAX] = std::to_string(num_slices);
+    }
 
     bool doc_value_mode = false;
     properties[ESScanReader::KEY_QUERY] =
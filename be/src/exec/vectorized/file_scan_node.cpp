@@ -2,10 +2,12 @@
 
 #include "exec/vectorized/file_scan_node.h"
 
+#include <algorithm>
 #include <chrono>
 #include <sstream>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "env/env.h"
 #include "env/env_broker.h"
 #include "exec/vectorized/csv_scanner.h"
@@ -78,9 +80,17 @@ Status FileScanNode::_start_scanners() {
     {
         std::unique_lock<std::mutex> l(_chunk_queue_lock);
 
-        _num_running_scanners = 1;
-        _scanner_threads.emplace_back(&FileScanNode::_scanner_worker, this, 0, _scan_ranges.size());
-        Thread::set_thread_name(_scanner_threads.back(), "file_scanner");
+        // Different files are read, decompressed and parsed concurrently by different scanners.
+        int num_ranges = _scan_ranges.size();
+        int num_scanners = std::max(1, std::min(config::file_scan_node_max_scanner_num, num_ranges));
+        _num_running_scanners = num_scanners;
+        int start_idx = 0;
+        for (int i = 0; i < num_scanners; ++i) {
+            int length = num_ranges / num_scanners + (i < num_ranges % num_scanners ? 1 : 0);
+            _scanner_threads.emplace_back(&FileScanNode::_scanner_worker, this, start_idx, length);
+            Thread::set_thread_name(_scanner_threads.back(), "file_scanner");
+            start_idx += length;
+        }
     }
     return Status::OK();
 }
@@ -134,6 +134,7 @@ private:
     RuntimeProfile::Counter* _build_rows_counter = nullptr;
     RuntimeProfile::Counter* _probe_rows_counter = nullptr;
     RuntimeProfile::Counter* _build_buckets_counter = nullptr;
+    JoinHashTableStatsCounters _ht_stats_counters;
     RuntimeProfile::Counter* _push_down_expr_num = nullptr;
     RuntimeProfile::Counter* _avg_input_probe_chunk_size = nullptr;
     RuntimeProfile::Counter* _avg_output_chunk_size = nullptr;
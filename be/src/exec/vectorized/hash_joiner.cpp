@@ -9,12 +9,15 @@
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
+#include "exec/pipeline/query_context.h"
 #include "exprs/expr.h"
 #include "exprs/vectorized/column_ref.h"
 #include "exprs/vectorized/in_const_predicate.hpp"
 #include "exprs/vectorized/runtime_filter_bank.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_filter_worker.h"
 #include "simd/simd.h"
 #include "util/debug_util.h"
@@ -73,7 +76,13 @@ Status HashJoiner::prepare_builder(RuntimeState* state, RuntimeProfile* runtime_
     _build_runtime_filter_timer = ADD_TIMER(runtime_profile, "RuntimeFilterBuildTime");
     _build_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "BuildConjunctEvaluateTime");
     _build_buckets_counter = ADD_COUNTER(runtime_profile, "BuildBuckets", TUnit::UNIT);
+    _ht_stats_counters.init(runtime_profile);
     _runtime_filter_num = ADD_COUNTER(runtime_profile, "RuntimeFilterNum", TUnit::UNIT);
+    if (state->enable_spill()) {
+        _spill_build_timer = ADD_TIMER(runtime_profile, "SpillBuildTime");
+        _spill_build_rows = ADD_COUNTER(runtime_profile, "SpillBuildRows", TUnit::UNIT);
+        _spill_build_bytes = ADD_COUNTER(runtime_profile, "SpillBuildBytes", TUnit::BYTES);
+    }
 
     HashTableParam param;
     _init_hash_table_param(&param);
@@ -102,6 +111,12 @@ Status HashJoiner::prepare_prober(RuntimeState* state, RuntimeProfile* runtime_p
     _probe_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "ProbeConjunctEvaluateTime");
     _other_join_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "OtherJoinConjunctEvaluateTime");
     _where_conjunct_evaluate_timer = ADD_TIMER(runtime_profile, "WhereConjunctEvaluateTime");
+    if (state->enable_spill()) {
+        _spill_probe_timer = ADD_TIMER(runtime_profile, "SpillProbeTime");
+        _spill_probe_rows = ADD_COUNTER(runtime_profile, "SpillProbeRows", TUnit::UNIT);
+        _spill_probe_bytes = ADD_COUNTER(runtime_profile, "SpillProbeBytes", TUnit::BYTES);
+        _spill_restore_timer = ADD_TIMER(runtime_profile, "SpillRestoreTime");
+    }
 
     return Status::OK();
 }
@@ -118,6 +133,11 @@ void HashJoiner::_init_hash_table_param(HashTableParam* param) {
     param->output_build_column_timer = _output_build_column_timer;
     param->output_probe_column_timer = _output_probe_column_timer;
     param->output_tuple_column_timer = _output_tuple_column_timer;
+    // The hash table of a broadcast join is built by a single builder and shared by all the probers
+    // of the fragment instance, so build it in parallel instead of with the builder driver alone.
+    if (_hash_join_node.distribution_mode == TJoinDistributionMode::BROADCAST) {
+        param->build_pool = ExecEnv::GetInstance()->join_build_thread_pool();
+    }
 
     param->output_slots = _output_slots;
     std::set<SlotId> predicate_slots;
@@ -149,9 +169,19 @@ Status HashJoiner::append_chunk_to_ht(RuntimeState* state, const ChunkPtr& chunk
     if (!chunk || chunk->is_empty()) {
         return Status::OK();
     }
+    if (_is_spilled) {
+        return _spill_build_chunk(chunk);
+    }
     if (UNLIKELY(_ht.get_row_count() + chunk->num_rows() >= UINT32_MAX)) {
         return Status::NotSupported(strings::Substitute("row count of right table in hash join > $0", UINT32_MAX));
     }
+    if (!_is_mem_consumer_created) {
+        _is_mem_consumer_created = true;
+        _mem_consumer = pipeline::MemConsumer::create(state, "join_build", _can_spill());
+    }
+    if (_mem_consumer != nullptr) {
+        _mem_consumer->try_reserve(chunk->memory_usage());
+    }
     {
         SCOPED_TIMER(_build_conjunct_evaluate_timer);
         _prepare_key_columns(_key_columns, chunk, _build_expr_ctxs);
@@ -161,18 +191,233 @@ Status HashJoiner::append_chunk_to_ht(RuntimeState* state, const ChunkPtr& chunk
         SCOPED_TIMER(_copy_right_table_chunk_timer);
         TRY_CATCH_BAD_ALLOC(_ht.append_chunk(state, chunk, _key_columns));
     }
+    if (_can_spill() && (should_spill(state, _ht.mem_usage()) ||
+                         (_mem_consumer != nullptr && _mem_consumer->is_spill_requested()))) {
+        RETURN_IF_ERROR(_spill_hash_table(state));
+        // The rest build rows are spilled directly, so there is no memory to reserve anymore.
+        _mem_consumer.reset();
+    }
+    if (_mem_consumer != nullptr) {
+        _mem_consumer->update_usage(_ht.mem_usage());
+    }
     return Status::OK();
 }
 
 Status HashJoiner::build_ht(RuntimeState* state) {
     if (_phase == HashJoinPhase::BUILD) {
+        _mem_consumer.reset();
+        if (_is_spilled) {
+            SCOPED_TIMER(_spill_build_timer);
+            RETURN_IF_ERROR(_build_spill_files->finish());
+            _probe_spill_files = std::make_unique<PartitionedSpillFiles>(
+                    "join_probe", _build_spill_files->num_partitions(), state->chunk_size());
+            return Status::OK();
+        }
         RETURN_IF_ERROR(_build(state));
         COUNTER_SET(_build_buckets_counter, static_cast<int64_t>(_ht.get_bucket_size()));
+        _ht.update_stats_counters(_ht_stats_counters);
+    }
+
+    return Status::OK();
+}
+
+Status HashJoiner::_spill_hash_table(RuntimeState* state) {
+    DCHECK(!_is_spilled);
+    _is_spilled = true;
+    _build_spill_files = std::make_unique<PartitionedSpillFiles>("join_build", std::max(config::spill_partition_num, 1),
+                                                                 state->chunk_size());
+    if (!_build_runtime_filters.empty()) {
+        // reserve the first row like JoinHashTable, so that runtime filters could be built in the same way.
+        for (auto* expr_ctx : _build_expr_ctxs) {
+            ColumnPtr column = ColumnHelper::create_column(expr_ctx->root()->type(), true);
+            column->append_default();
+            _spilled_build_key_columns.emplace_back(std::move(column));
+        }
+    }
+
+    // move all the rows in hash table to the spill files, except the first row reserved by JoinHashTable.
+    const ChunkPtr& build_chunk = _ht.get_build_chunk();
+    const size_t num_rows = build_chunk->num_rows();
+    const size_t chunk_size = state->chunk_size();
+    for (size_t offset = kHashJoinKeyColumnOffset; offset < num_rows; offset += chunk_size) {
+        ChunkPtr chunk = build_chunk->clone_empty_with_slot();
+        chunk->append(*build_chunk, offset, std::min(chunk_size, num_rows - offset));
+        RETURN_IF_ERROR(_spill_build_chunk(chunk));
+    }
+
+    HashTableParam param;
+    _init_hash_table_param(&param);
+    _ht.create(param);
+    return Status::OK();
+}
+
+Status HashJoiner::_spill_build_chunk(const ChunkPtr& chunk) {
+    SCOPED_TIMER(_spill_build_timer);
+    ChunkPtr spill_chunk = _normalize_spill_chunk(*chunk, _build_row_descriptor);
+    {
+        SCOPED_TIMER(_build_conjunct_evaluate_timer);
+        _prepare_key_columns(_key_columns, spill_chunk, _build_expr_ctxs);
+    }
+    for (size_t i = 0; i < _spilled_build_key_columns.size(); i++) {
+        _spilled_build_key_columns[i]->append(*_key_columns[i]);
+    }
+    if (_build_spill_prototype == nullptr) {
+        _build_spill_prototype = spill_chunk->clone_empty_with_slot();
+    }
+
+    int64_t old_bytes = _build_spill_files->num_bytes();
+    RETURN_IF_ERROR(_build_spill_files->append(spill_chunk, _key_columns));
+    _spilled_build_rows += spill_chunk->num_rows();
+    COUNTER_UPDATE(_spill_build_rows, spill_chunk->num_rows());
+    COUNTER_UPDATE(_spill_build_bytes, _build_spill_files->num_bytes() - old_bytes);
+    if (_runtime_state->query_ctx() != nullptr) {
+        _runtime_state->query_ctx()->incr_spill_bytes(_build_spill_files->num_bytes() - old_bytes);
+    }
+    return Status::OK();
+}
+
+Status HashJoiner::_spill_probe_chunk(const ChunkPtr& chunk) {
+    SCOPED_TIMER(_spill_probe_timer);
+    ChunkPtr spill_chunk = _normalize_spill_chunk(*chunk, _probe_row_descriptor);
+    {
+        SCOPED_TIMER(_probe_conjunct_evaluate_timer);
+        _prepare_key_columns(_key_columns, spill_chunk, _probe_expr_ctxs);
+    }
+    if (_probe_spill_prototype == nullptr) {
+        _probe_spill_prototype = spill_chunk->clone_empty_with_slot();
     }
 
+    int64_t old_bytes = _probe_spill_files->num_bytes();
+    RETURN_IF_ERROR(_probe_spill_files->append(spill_chunk, _key_columns));
+    COUNTER_UPDATE(_spill_probe_rows, spill_chunk->num_rows());
+    COUNTER_UPDATE(_spill_probe_bytes, _probe_spill_files->num_bytes() - old_bytes);
+    if (_runtime_state->query_ctx() != nullptr) {
+        _runtime_state->query_ctx()->incr_spill_bytes(_probe_spill_files->num_bytes() - old_bytes);
+    }
     return Status::OK();
 }
 
+ChunkPtr HashJoiner::_normalize_spill_chunk(const Chunk& chunk, const RowDescriptor& row_desc) {
+    const size_t num_rows = chunk.num_rows();
+    auto result = std::make_shared<Chunk>();
+    for (const auto& tuple_desc : row_desc.tuple_descriptors()) {
+        for (const auto& slot : tuple_desc->slots()) {
+            ColumnPtr column =
+                    ColumnHelper::unpack_and_duplicate_const_column(num_rows, chunk.get_column_by_slot_id(slot->id()));
+            DCHECK(slot->is_nullable() || !column->is_nullable());
+            if (slot->is_nullable() && !column->is_nullable()) {
+                column = NullableColumn::create(column, NullColumn::create(num_rows, 0));
+            }
+            result->append_column(std::move(column), slot->id());
+        }
+    }
+    return result;
+}
+
+Status HashJoiner::_build_spilled_partition(RuntimeState* state, size_t partition) {
+    SCOPED_TIMER(_spill_restore_timer);
+    HashTableParam param;
+    _init_hash_table_param(&param);
+    _ht.create(param);
+
+    SpillFile* build_file = _build_spill_files->partition(partition);
+    if (build_file != nullptr) {
+        Columns key_columns;
+        while (true) {
+            auto res = build_file->read(*_build_spill_prototype);
+            if (res.status().is_end_of_file()) {
+                break;
+            }
+            RETURN_IF_ERROR(res.status());
+            ChunkPtr chunk = std::move(res.value());
+            if (UNLIKELY(_ht.get_row_count() + chunk->num_rows() >= UINT32_MAX)) {
+                return Status::NotSupported(strings::Substitute(
+                        "row count of right table in a spilled partition of hash join > $0", UINT32_MAX));
+            }
+            _prepare_key_columns(key_columns, chunk, _build_expr_ctxs);
+            TRY_CATCH_BAD_ALLOC(_ht.append_chunk(state, chunk, key_columns));
+        }
+        _build_spill_files->release_partition(partition);
+    }
+    return _build(state);
+}
+
+void HashJoiner::_close_spilled_partition() {
+    _build_spill_files->release_partition(_spilled_partition);
+    _probe_spill_files->release_partition(_spilled_partition);
+    _spilled_partition_built = false;
+    _spilled_partition++;
+}
+
+StatusOr<ChunkPtr> HashJoiner::_pull_spilled_output_chunk(RuntimeState* state) {
+    auto chunk = std::make_shared<Chunk>();
+    if (_phase != HashJoinPhase::POST_PROBE) {
+        return chunk;
+    }
+    if (!_probe_spill_finished) {
+        SCOPED_TIMER(_spill_probe_timer);
+        RETURN_IF_ERROR(_probe_spill_files->finish());
+        _probe_spill_finished = true;
+    }
+
+    while (_spilled_partition < _build_spill_files->num_partitions()) {
+        if (!_spilled_partition_built) {
+            bool build_empty = _build_spill_files->partition(_spilled_partition) == nullptr;
+            bool probe_empty = _probe_spill_files->partition(_spilled_partition) == nullptr;
+            if ((build_empty && _is_empty_output_with_empty_build()) || (probe_empty && !_need_post_probe())) {
+                _close_spilled_partition();
+                continue;
+            }
+            RETURN_IF_ERROR(_build_spilled_partition(state, _spilled_partition));
+            _spilled_partition_built = true;
+        }
+
+        if (_probe_input_chunk == nullptr) {
+            SpillFile* probe_file = _probe_spill_files->partition(_spilled_partition);
+            if (probe_file != nullptr) {
+                SCOPED_TIMER(_spill_restore_timer);
+                auto res = probe_file->read(*_probe_spill_prototype);
+                if (res.ok()) {
+                    _probe_input_chunk = std::move(res.value());
+                    _ht_has_remain = true;
+                    _prepare_probe_key_columns();
+                } else if (res.status().is_end_of_file()) {
+                    _probe_spill_files->release_partition(_spilled_partition);
+                } else {
+                    return res.status();
+                }
+            }
+        }
+
+        if (_probe_input_chunk != nullptr) {
+            TRY_CATCH_BAD_ALLOC(
+                    RETURN_IF_ERROR(_ht.probe(state, _key_columns, &_probe_input_chunk, &chunk, &_ht_has_remain)));
+            if (!_ht_has_remain) {
+                _probe_input_chunk = nullptr;
+            }
+            RETURN_IF_ERROR(_filter_probe_output_chunk(chunk));
+            return chunk;
+        }
+
+        // all the probe rows of this partition have been processed.
+        if (_probe_spill_files->partition(_spilled_partition) != nullptr) {
+            continue;
+        }
+        if (_need_post_probe()) {
+            TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_ht.probe_remain(state, &chunk, &_ht_has_remain)));
+            if (!_ht_has_remain) {
+                _close_spilled_partition();
+            }
+            _filter_post_probe_output_chunk(chunk);
+            return chunk;
+        }
+        _close_spilled_partition();
+    }
+
+    enter_eos_phase();
+    return chunk;
+}
+
 bool HashJoiner::need_input() const {
     // when _buffered_chunk accumulates several chunks to form into a large enough chunk, it is moved into
     // _probe_chunk for probe operations.
@@ -197,13 +442,18 @@ bool HashJoiner::has_output() const {
     return false;
 }
 
-void HashJoiner::push_chunk(RuntimeState* state, ChunkPtr&& chunk) {
+Status HashJoiner::push_chunk(RuntimeState* state, ChunkPtr&& chunk) {
     DCHECK(chunk && !chunk->is_empty());
     DCHECK(!_probe_input_chunk);
 
+    if (_is_spilled) {
+        return _spill_probe_chunk(chunk);
+    }
+
     _probe_input_chunk = std::move(chunk);
     _ht_has_remain = true;
     _prepare_probe_key_columns();
+    return Status::OK();
 }
 
 StatusOr<ChunkPtr> HashJoiner::pull_chunk(RuntimeState* state) {
@@ -214,6 +464,10 @@ StatusOr<ChunkPtr> HashJoiner::pull_chunk(RuntimeState* state) {
 StatusOr<ChunkPtr> HashJoiner::_pull_probe_output_chunk(RuntimeState* state) {
     DCHECK(_phase != HashJoinPhase::BUILD);
 
+    if (_is_spilled) {
+        return _pull_spilled_output_chunk(state);
+    }
+
     auto chunk = std::make_shared<Chunk>();
 
     if (_phase == HashJoinPhase::PROBE || _probe_input_chunk != nullptr) {
@@ -250,6 +504,7 @@ StatusOr<ChunkPtr> HashJoiner::_pull_probe_output_chunk(RuntimeState* state) {
 }
 
 void HashJoiner::close(RuntimeState* state) {
+    _mem_consumer.reset();
     _ht.close();
 }
 
@@ -266,7 +521,7 @@ Status HashJoiner::create_runtime_filters(RuntimeState* state) {
     if (_is_push_down) {
         if (_probe_node_type == TPlanNodeType::EXCHANGE_NODE && _build_node_type == TPlanNodeType::EXCHANGE_NODE) {
             _is_push_down = false;
-        } else if (_ht.get_row_count() > runtime_join_filter_pushdown_limit) {
+        } else if (_build_row_count() > runtime_join_filter_pushdown_limit) {
             _is_push_down = false;
         }
 
@@ -10,6 +10,8 @@
 #include "exec/pipeline/runtime_filter_types.h"
 #include "exec/vectorized/hash_join_node.h"
 #include "exec/vectorized/join_hash_map.h"
+#include "exec/pipeline/query_mem_arbitrator.h"
+#include "exec/vectorized/spill/spill_file.h"
 #include "exprs/vectorized/in_const_predicate.hpp"
 #include "util/phmap/phmap.h"
 
@@ -37,6 +39,11 @@ using HashJoinerPtr = std::shared_ptr<HashJoiner>;
 //   processed.
 // 4.DONE: all input streams have been processed.
 //
+// If spill is enabled by the session and the hash table grows too large, HashJoiner falls back to grace hash join:
+// all the build rows are spilled to disk, which are split into partitions by the hash of join keys, and the probe
+// rows are split into the same partitions in PROBE phase. Then the partitions are joined one by one in POST_PROBE
+// phase, so only the hash table of one partition is held in memory at a time.
+//
 enum HashJoinPhase {
     BUILD = 0,
     PROBE = 1,
@@ -137,7 +144,7 @@ public:
     Status append_chunk_to_ht(RuntimeState* state, const ChunkPtr& chunk);
     Status build_ht(RuntimeState* state);
     // probe phase
-    void push_chunk(RuntimeState* state, ChunkPtr&& chunk);
+    Status push_chunk(RuntimeState* state, ChunkPtr&& chunk);
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state);
 
     pipeline::RuntimeInFilters& get_runtime_in_filters() { return _runtime_in_filters; }
@@ -145,7 +152,7 @@ public:
     pipeline::OptRuntimeBloomFilterBuildParams& get_runtime_bloom_filter_build_params() {
         return _runtime_bloom_filter_build_params;
     }
-    size_t get_ht_row_count() { return _ht.get_row_count(); }
+    size_t get_ht_row_count() { return _build_row_count(); }
 
     Status create_runtime_filters(RuntimeState* state);
 
@@ -181,22 +188,50 @@ private:
         }
     }
 
+    // The row count of the whole build side, including the spilled rows.
+    size_t _build_row_count() const { return _is_spilled ? _spilled_build_rows : _ht.get_row_count(); }
+    // The key columns of the whole build side, the first row is reserved as the key columns of JoinHashTable.
+    const Columns& _build_key_columns() { return _is_spilled ? _spilled_build_key_columns : _ht.get_key_columns(); }
+
+    // Grace hash join is only supported for the hash table not shared by other probers, and for the join types
+    // whose result of every key partition is independent of other partitions.
+    bool _can_spill() const {
+        return _read_only_join_probers.empty() && _join_type != TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN;
+    }
+    Status _spill_hash_table(RuntimeState* state);
+    Status _spill_build_chunk(const ChunkPtr& chunk);
+    Status _spill_probe_chunk(const ChunkPtr& chunk);
+    Status _build_spilled_partition(RuntimeState* state, size_t partition);
+    void _close_spilled_partition();
+    StatusOr<ChunkPtr> _pull_spilled_output_chunk(RuntimeState* state);
+    // The chunks spilled to the same partitions must have the same layout, so the columns of |chunk| are
+    // rearranged in the order of slots of |row_desc|, const columns are unpacked, and the columns of nullable
+    // slots are converted to nullable columns.
+    static ChunkPtr _normalize_spill_chunk(const Chunk& chunk, const RowDescriptor& row_desc);
+
     void _prepare_probe_key_columns() {
         SCOPED_TIMER(_probe_conjunct_evaluate_timer);
         _prepare_key_columns(_key_columns, _probe_input_chunk, _probe_expr_ctxs);
     }
 
+    bool _is_empty_output_with_empty_build() const {
+        return _join_type == TJoinOp::INNER_JOIN || _join_type == TJoinOp::LEFT_SEMI_JOIN ||
+               _join_type == TJoinOp::RIGHT_SEMI_JOIN || _join_type == TJoinOp::RIGHT_ANTI_JOIN ||
+               _join_type == TJoinOp::RIGHT_OUTER_JOIN;
+    }
+
     bool _need_post_probe() const {
         return _join_type == TJoinOp::RIGHT_OUTER_JOIN || _join_type == TJoinOp::RIGHT_ANTI_JOIN ||
                _join_type == TJoinOp::FULL_OUTER_JOIN;
     }
 
     void _short_circuit_break() {
+        // the hash table is empty after spilled, the partitions are joined in POST_PROBE phase.
+        if (_is_spilled) {
+            return;
+        }
         // special cases of short-circuit break.
-        if (_ht.get_row_count() == 0 &&
-            (_join_type == TJoinOp::INNER_JOIN || _join_type == TJoinOp::LEFT_SEMI_JOIN ||
-             _join_type == TJoinOp::RIGHT_SEMI_JOIN || _join_type == TJoinOp::RIGHT_ANTI_JOIN ||
-             _join_type == TJoinOp::RIGHT_OUTER_JOIN)) {
+        if (_ht.get_row_count() == 0 && _is_empty_output_with_empty_build()) {
             _phase = HashJoinPhase::EOS;
             set_builder_finished();
         }
@@ -259,7 +294,7 @@ private:
     Status _create_runtime_in_filters(RuntimeState* state) {
         SCOPED_TIMER(_build_runtime_filter_timer);
 
-        if (_ht.get_row_count() > 1024) {
+        if (_build_row_count() > 1024) {
             return Status::OK();
         }
 
@@ -305,13 +340,13 @@ private:
                 _runtime_bloom_filter_build_params.emplace_back();
                 continue;
             }
-            if (!rf_desc->has_remote_targets() && _ht.get_row_count() > limit) {
+            if (!rf_desc->has_remote_targets() && _build_row_count() > limit) {
                 _runtime_bloom_filter_build_params.emplace_back();
                 continue;
             }
 
             int expr_order = rf_desc->build_expr_order();
-            ColumnPtr column = _ht.get_key_columns()[expr_order];
+            ColumnPtr column = _build_key_columns()[expr_order];
             bool eq_null = _is_null_safes[expr_order];
             _runtime_bloom_filter_build_params.emplace_back(pipeline::RuntimeBloomFilterBuildParam(eq_null, column));
         }
@@ -374,13 +409,35 @@ private:
     const std::vector<HashJoinerPtr>& _read_only_join_probers;
     std::atomic<size_t> _num_unfinished_probers = 0;
 
+    // Grace hash join.
+    bool _is_spilled = false;
+    size_t _spilled_build_rows = 0;
+    // Only kept when there are runtime bloom filters to build.
+    Columns _spilled_build_key_columns;
+    std::unique_ptr<PartitionedSpillFiles> _build_spill_files;
+    std::unique_ptr<PartitionedSpillFiles> _probe_spill_files;
+    // Prototypes used to read chunks back from the spill files.
+    ChunkPtr _build_spill_prototype;
+    ChunkPtr _probe_spill_prototype;
+    bool _probe_spill_finished = false;
+    // The partition being joined, and whether its hash table has been built.
+    size_t _spilled_partition = 0;
+    bool _spilled_partition_built = false;
+    // Reserves the memory of the hash table from the arbitrator of the query, released after the hash table is built.
+    pipeline::MemConsumerPtr _mem_consumer;
+    bool _is_mem_consumer_created = false;
+
     // Profile for hash join builder.
     RuntimeProfile::Counter* _build_ht_timer = nullptr;
     RuntimeProfile::Counter* _copy_right_table_chunk_timer = nullptr;
     RuntimeProfile::Counter* _build_runtime_filter_timer = nullptr;
     RuntimeProfile::Counter* _output_build_column_timer = nullptr;
     RuntimeProfile::Counter* _build_buckets_counter = nullptr;
+    JoinHashTableStatsCounters _ht_stats_counters;
     RuntimeProfile::Counter* _runtime_filter_num = nullptr;
+    RuntimeProfile::Counter* _spill_build_timer = nullptr;
+    RuntimeProfile::Counter* _spill_build_rows = nullptr;
+    RuntimeProfile::Counter* _spill_build_bytes = nullptr;
 
     // Profile for hash join prober.
     RuntimeProfile::Counter* _search_ht_timer = nullptr;
@@ -390,6 +447,10 @@ private:
     RuntimeProfile::Counter* _probe_conjunct_evaluate_timer = nullptr;
     RuntimeProfile::Counter* _other_join_conjunct_evaluate_timer = nullptr;
     RuntimeProfile::Counter* _where_conjunct_evaluate_timer = nullptr;
+    RuntimeProfile::Counter* _spill_probe_timer = nullptr;
+    RuntimeProfile::Counter* _spill_probe_rows = nullptr;
+    RuntimeProfile::Counter* _spill_probe_bytes = nullptr;
+    RuntimeProfile::Counter* _spill_restore_timer = nullptr;
 };
 
 } // namespace vectorized
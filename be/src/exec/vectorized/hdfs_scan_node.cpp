@@ -17,6 +17,7 @@
 #include "fmt/core.h"
 #include "glog/logging.h"
 #include "gutil/map_util.h"
+#include "io/block_cache.h"
 #include "runtime/current_thread.h"
 #include "runtime/hdfs/hdfs_fs_cache.h"
 #include "runtime/runtime_state.h"
@@ -73,6 +74,8 @@ Status HdfsScanNode::_init_table() {
     if (_lake_table == nullptr) {
         return Status::RuntimeError("Invalid table type. Only hive/iceberg/hudi table are supported");
     }
+    _use_block_cache = io::BlockCache::instance() != nullptr &&
+                       io::BlockCache::is_admitted(_lake_table->database(), _lake_table->name());
     return Status::OK();
 }
 
@@ -237,6 +240,7 @@ Status HdfsScanNode::_create_and_init_scanner(RuntimeState* state, const HdfsFil
     scanner_params.scan_ranges = hdfs_file_desc.splits;
     scanner_params.env = hdfs_file_desc.env;
     scanner_params.path = hdfs_file_desc.path;
+    scanner_params.use_block_cache = _use_block_cache;
     scanner_params.tuple_desc = _tuple_desc;
     scanner_params.materialize_slots = _materialize_slots;
     scanner_params.materialize_index_in_chunk = _materialize_index_in_chunk;
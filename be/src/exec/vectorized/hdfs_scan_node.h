@@ -132,6 +132,8 @@ private:
     std::vector<THdfsScanRange> _scan_ranges;
     std::vector<HdfsFileDesc*> _hdfs_files;
     const LakeTableDescriptor* _lake_table = nullptr;
+    // Whether the table is admitted into the block cache.
+    bool _use_block_cache = false;
     std::vector<std::string> _hive_column_names;
 
     std::mutex _mtx;
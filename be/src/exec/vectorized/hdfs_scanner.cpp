@@ -3,6 +3,7 @@
 #include "exec/vectorized/hdfs_scanner.h"
 
 #include "exec/vectorized/hdfs_scan_node.h"
+#include "io/cache_input_stream.h"
 
 namespace starrocks::vectorized {
 
@@ -80,6 +81,7 @@ Status HdfsScanner::_build_file_read_param() {
     param.scan_ranges = _scanner_params.scan_ranges;
     param.min_max_conjunct_ctxs = _min_max_conjunct_ctxs;
     param.min_max_tuple_desc = _scanner_params.min_max_tuple_desc;
+    param.runtime_filter_collector = _scanner_params.runtime_filter_collector;
     param.timezone = _runtime_state->timezone();
     param.stats = &_stats;
 
@@ -110,6 +112,14 @@ Status HdfsScanner::open(RuntimeState* runtime_state) {
     }
     CHECK(_file == nullptr) << "File has already been opened";
     ASSIGN_OR_RETURN(_file, _scanner_params.env->new_random_access_file(_scanner_params.path));
+    if (_scanner_params.use_block_cache) {
+        const auto* scan_range = _scanner_params.scan_ranges[0];
+        auto file_id = io::BlockCache::file_id(_scanner_params.path, scan_range->modification_time,
+                                               scan_range->file_length);
+        auto stream = std::make_shared<io::CacheInputStream>(_file->stream(), io::BlockCache::instance(), file_id);
+        std::string filename = _file->filename();
+        _file = std::make_unique<RandomAccessFile>(std::move(stream), std::move(filename));
+    }
     _build_file_read_param();
     auto status = do_open(runtime_state);
     if (status.ok()) {
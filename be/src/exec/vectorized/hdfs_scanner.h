@@ -37,6 +37,10 @@ struct HdfsScanStats {
     int64_t level_decode_ns = 0;
     int64_t value_decode_ns = 0;
     int64_t page_read_ns = 0;
+    // the rows skipped by the page indexes
+    int64_t page_skip_rows = 0;
+    // the rows of the lazy read columns skipped by late materialization
+    int64_t late_materialize_skip_rows = 0;
     // reader init
     int64_t footer_read_ns = 0;
     int64_t column_reader_init_ns = 0;
@@ -87,6 +91,8 @@ struct HdfsScannerParams {
     Env* env = nullptr;
     // The file to scan
     std::string path;
+    // Whether to read the file through the local block cache, see io::BlockCache.
+    bool use_block_cache = false;
 
     const TupleDescriptor* tuple_desc;
 
@@ -146,6 +152,9 @@ struct HdfsFileReaderParam {
     // min max conjunct
     std::vector<ExprContext*> min_max_conjunct_ctxs;
 
+    // runtime filters to skip row groups by min/max, which may arrive during the scan
+    const RuntimeFilterProbeCollector* runtime_filter_collector = nullptr;
+
     std::string timezone;
 
     vectorized::HdfsScanStats* stats = nullptr;
@@ -6,6 +6,7 @@
 
 #include "env/env.h"
 #include "exec/vectorized/hdfs_scan_node.h"
+#include "formats/file_meta_cache.h"
 #include "gen_cpp/orc_proto.pb.h"
 #include "storage/chunk_helper.h"
 #include "util/runtime_profile.h"
@@ -107,6 +108,7 @@ public:
                               const std::map<uint32_t, orc::BloomFilterIndex>& bloomFilters) override;
     bool filterMinMax(size_t rowGroupIdx, const std::unordered_map<uint64_t, orc::proto::RowIndex>& rowIndexes,
                       const std::map<uint32_t, orc::BloomFilterIndex>& bloomFilter);
+    bool filterRuntimeFilters(size_t rowGroupIdx, const std::unordered_map<uint64_t, orc::proto::RowIndex>& rowIndexes);
     bool filterOnPickStringDictionary(const std::unordered_map<uint64_t, orc::StringDictionary*>& sdicts) override;
 
     bool is_slot_evaluated(SlotId id) { return _dict_filter_eval_cache.find(id) != _dict_filter_eval_cache.end(); }
@@ -248,6 +250,45 @@ bool OrcRowReaderFilter::filterOnPickRowGroup(size_t rowGroupIdx,
             return true;
         }
     }
+    if (_scanner_params.runtime_filter_collector != nullptr) {
+        if (filterRuntimeFilters(rowGroupIdx, rowIndexes)) {
+            VLOG_FILE << "OrcRowReaderFilter: skip row group " << rowGroupIdx << ", stripe " << _current_stripe_index
+                      << " by runtime filter";
+            return true;
+        }
+    }
+    return false;
+}
+
+// The runtime filters pushed into the search argument are those arrived before the reader is opened,
+// and the ones arrived later are checked here against the statistics of each row group.
+bool OrcRowReaderFilter::filterRuntimeFilters(size_t rowGroupIdx,
+                                              const std::unordered_map<uint64_t, orc::proto::RowIndex>& rowIndexes) {
+    for (const auto& it : _scanner_params.runtime_filter_collector->descriptors()) {
+        const RuntimeFilterProbeDescriptor* desc = it.second;
+        const JoinRuntimeFilter* filter = desc->runtime_filter();
+        SlotId slot_id;
+        if (filter == nullptr || filter->has_null() || !desc->is_probe_slot_ref(&slot_id)) continue;
+
+        for (SlotDescriptor* slot : _scanner_params.materialize_slots) {
+            if (slot->id() != slot_id) continue;
+            int32_t column_index = _reader->get_column_id_by_name(slot->col_name());
+            if (column_index < 0) break;
+            auto row_idx_iter = rowIndexes.find(column_index);
+            if (row_idx_iter == rowIndexes.end()) break;
+
+            const orc::proto::ColumnStatistics& stats = row_idx_iter->second.entry(rowGroupIdx).statistics();
+            ColumnPtr min_col = ColumnHelper::create_column(slot->type(), slot->is_nullable());
+            ColumnPtr max_col = ColumnHelper::create_column(slot->type(), slot->is_nullable());
+            int64_t tz_offset_in_seconds = _reader->tzoffset_in_seconds() - _writer_tzoffset_in_seconds;
+            Status st = _reader->decode_min_max_value(slot, stats, min_col, max_col, tz_offset_in_seconds);
+            if (st.ok() && RuntimeFilterHelper::filter_zonemap_with_min_max(slot->type().type, filter, min_col.get(),
+                                                                             max_col.get())) {
+                return true;
+            }
+            break;
+        }
+    }
     return false;
 }
 
@@ -377,10 +418,27 @@ Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
     auto input_stream =
             std::make_unique<ORCHdfsFileStream>(_file.get(), _scanner_params.scan_ranges[0]->file_length, &_stats);
     SCOPED_RAW_TIMER(&_stats.reader_init_ns);
+    FileMetaCache* cache = FileMetaCache::instance();
+    FileMetaCache::FileId file_id;
+    std::shared_ptr<const std::string> file_tail;
+    if (cache != nullptr) {
+        const auto* scan_range = _scanner_params.scan_ranges[0];
+        file_id = io::BlockCache::file_id(_file->filename(), scan_range->modification_time, scan_range->file_length);
+        file_tail = cache->lookup<std::string>(FileMetaCache::MetaType::ORC_FILE_TAIL, file_id);
+    }
     std::unique_ptr<orc::Reader> reader;
     try {
         orc::ReaderOptions options;
+        if (file_tail != nullptr) {
+            // The postscript and the footer are parsed from the cached tail rather than read from the file.
+            options.setSerializedFileTail(*file_tail);
+        }
         reader = orc::createReader(std::move(input_stream), options);
+        if (cache != nullptr && file_tail == nullptr) {
+            auto tail = std::make_shared<std::string>(reader->getSerializedFileTail());
+            const size_t charge = tail->size();
+            cache->insert(FileMetaCache::MetaType::ORC_FILE_TAIL, file_id, std::move(tail), charge);
+        }
     } catch (std::exception& e) {
         auto s = strings::Substitute("HdfsOrcScanner::do_open failed. reason = $0", e.what());
         LOG(WARNING) << s;
@@ -14,6 +14,8 @@ public:
     RuntimeProfile::Counter* level_decode_timer = nullptr;
     RuntimeProfile::Counter* value_decode_timer = nullptr;
     RuntimeProfile::Counter* page_read_timer = nullptr;
+    RuntimeProfile::Counter* page_skip_counter = nullptr;
+    RuntimeProfile::Counter* late_materialize_skip_counter = nullptr;
 
     // reader init
     RuntimeProfile::Counter* footer_read_timer = nullptr;
@@ -35,6 +37,9 @@ void HdfsParquetProfile::init(RuntimeProfile* root) {
     value_decode_timer = ADD_CHILD_TIMER(root, "ValueDecodeTime", kParquetProfileSectionPrefix);
 
     page_read_timer = ADD_CHILD_TIMER(root, "PageReadTime", kParquetProfileSectionPrefix);
+    page_skip_counter = ADD_CHILD_COUNTER(root, "PageSkipRows", TUnit::UNIT, kParquetProfileSectionPrefix);
+    late_materialize_skip_counter =
+            ADD_CHILD_COUNTER(root, "LateMaterializeSkipRows", TUnit::UNIT, kParquetProfileSectionPrefix);
     footer_read_timer = ADD_CHILD_TIMER(root, "ReaderInitFooterRead", kParquetProfileSectionPrefix);
     column_reader_init_timer = ADD_CHILD_TIMER(root, "ReaderInitColumnReaderInit", kParquetProfileSectionPrefix);
 
@@ -59,6 +64,8 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
         COUNTER_UPDATE(parquet_profile->value_decode_timer, _stats.value_decode_ns);
         COUNTER_UPDATE(parquet_profile->level_decode_timer, _stats.level_decode_ns);
         COUNTER_UPDATE(parquet_profile->page_read_timer, _stats.page_read_ns);
+        COUNTER_UPDATE(parquet_profile->page_skip_counter, _stats.page_skip_rows);
+        COUNTER_UPDATE(parquet_profile->late_materialize_skip_counter, _stats.late_materialize_skip_rows);
         COUNTER_UPDATE(parquet_profile->footer_read_timer, _stats.footer_read_ns);
         COUNTER_UPDATE(parquet_profile->column_reader_init_timer, _stats.column_reader_init_ns);
         COUNTER_UPDATE(parquet_profile->group_chunk_read_timer, _stats.group_chunk_read_ns);
@@ -69,8 +76,9 @@ void HdfsParquetScanner::do_update_counter(HdfsScanProfile* profile) {
 
 Status HdfsParquetScanner::do_open(RuntimeState* runtime_state) {
     // create file reader
-    _reader = std::make_shared<parquet::FileReader>(runtime_state->chunk_size(), _file.get(),
-                                                    _scanner_params.scan_ranges[0]->file_length);
+    const auto* scan_range = _scanner_params.scan_ranges[0];
+    _reader = std::make_shared<parquet::FileReader>(runtime_state->chunk_size(), _file.get(), scan_range->file_length,
+                                                    scan_range->modification_time);
     SCOPED_RAW_TIMER(&_stats.reader_init_ns);
     RETURN_IF_ERROR(_reader->init(_file_read_param));
     return Status::OK();
@@ -6,16 +6,91 @@
 #include <gen_cpp/PlanNodes_types.h>
 #include <runtime/descriptors.h>
 
+#include "common/config.h"
 #include "exec/vectorized/hash_join_node.h"
 #include "serde/column_array_serde.h"
 #include "simd/simd.h"
+#include "util/threadpool.h"
 
 namespace starrocks::vectorized {
 
+void JoinHashMapHelper::link_partitioned_rows(JoinHashTableItems* table_items) {
+    if (table_items->build_buckets.empty()) {
+        return;
+    }
+    const Buffer<uint32_t>& buckets = table_items->build_buckets;
+    // the bucket size is a power of 2 larger than JOIN_HASH_MAP_PARTITION_BUCKETS
+    const uint32_t shift = __builtin_ctz(JOIN_HASH_MAP_PARTITION_BUCKETS);
+    const uint32_t num_partitions = table_items->bucket_size >> shift;
+    const uint32_t num_rows = buckets.size() - 1;
+
+    // the rows are partitioned by |num_tasks| tasks of consecutive ranges, and linked by the same tasks of
+    // consecutive partitions, which write disjoint rows and buckets
+    size_t num_tasks = 1;
+    if (table_items->build_pool != nullptr) {
+        int64_t min_rows = std::max<int64_t>(1, config::pipeline_hash_join_parallel_build_min_rows);
+        size_t max_tasks = config::pipeline_hash_join_build_thread_pool_thread_num + 1;
+        num_tasks = std::min<size_t>({static_cast<size_t>(num_rows / min_rows), num_partitions, max_tasks});
+        num_tasks = std::max<size_t>(num_tasks, 1);
+    }
+    auto row_begin = [&](size_t task) { return static_cast<uint32_t>(1 + num_rows * task / num_tasks); };
+    auto partition_begin = [&](size_t task) { return static_cast<uint32_t>(num_partitions * task / num_tasks); };
+    auto run = [&](const std::function<void(size_t)>& func) {
+        Status st = parallel_run(table_items->build_pool, num_tasks, [&func](size_t task) {
+            func(task);
+            return Status::OK();
+        });
+        DCHECK(st.ok());
+    };
+
+    // radix partition the rows by the high bits of their buckets, keeping the order of the rows in each partition:
+    // the rows of partition p from task t are placed at offsets[t * num_partitions + p]
+    Buffer<uint32_t> offsets(num_tasks * num_partitions, 0);
+    run([&](size_t task) {
+        uint32_t* counts = offsets.data() + task * num_partitions;
+        for (uint32_t i = row_begin(task); i < row_begin(task + 1); i++) {
+            if (buckets[i] != NULL_BUCKET) {
+                counts[buckets[i] >> shift]++;
+            }
+        }
+    });
+    Buffer<uint32_t> partition_offsets(num_partitions + 1, 0);
+    uint32_t total = 0;
+    for (uint32_t p = 0; p < num_partitions; p++) {
+        partition_offsets[p] = total;
+        for (size_t task = 0; task < num_tasks; task++) {
+            uint32_t count = offsets[task * num_partitions + p];
+            offsets[task * num_partitions + p] = total;
+            total += count;
+        }
+    }
+    partition_offsets[num_partitions] = total;
+    Buffer<uint32_t> rows(total);
+    run([&](size_t task) {
+        uint32_t* task_offsets = offsets.data() + task * num_partitions;
+        for (uint32_t i = row_begin(task); i < row_begin(task + 1); i++) {
+            if (buckets[i] != NULL_BUCKET) {
+                rows[task_offsets[buckets[i] >> shift]++] = i;
+            }
+        }
+    });
+
+    // the buckets linked by each partition are JOIN_HASH_MAP_PARTITION_BUCKETS consecutive ones
+    uint32_t* first = table_items->first.data();
+    uint32_t* next = table_items->next.data();
+    run([&](size_t task) {
+        for (uint32_t k = partition_offsets[partition_begin(task)]; k < partition_offsets[partition_begin(task + 1)];
+             k++) {
+            uint32_t index = rows[k];
+            next[index] = first[buckets[index]];
+            first[buckets[index]] = index;
+        }
+    });
+    Buffer<uint32_t>().swap(table_items->build_buckets);
+}
+
 void SerializedJoinBuildFunc::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
-    table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    JoinHashMapHelper::prepare_buckets(table_items);
     table_items->build_slice.resize(table_items->row_count + 1);
     table_items->build_pool = std::make_unique<MemPool>();
 }
@@ -80,8 +155,7 @@ void SerializedJoinBuildFunc::_build_columns(JoinHashTableItems* table_items, Ha
     }
 
     for (size_t i = 0; i < count; i++) {
-        table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-        table_items->first[probe_state->buckets[i]] = start + i;
+        JoinHashMapHelper::link_row(table_items, start + i, probe_state->buckets[i]);
     }
 }
 
@@ -108,8 +182,7 @@ void SerializedJoinBuildFunc::_build_nullable_columns(JoinHashTableItems* table_
 
     for (size_t i = 0; i < count; i++) {
         if (probe_state->is_nulls[i] == 0) {
-            table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-            table_items->first[probe_state->buckets[i]] = start + i;
+            JoinHashMapHelper::link_row(table_items, start + i, probe_state->buckets[i]);
         }
     }
 }
@@ -160,10 +233,7 @@ void SerializedJoinProbeFunc::_probe_column(const JoinHashTableItems& table_item
                 JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
         ptr += probe_state->probe_slice[i].size;
     }
-
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_first(table_items, probe_state, nullptr, row_count);
 }
 
 void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& table_items,
@@ -191,11 +261,9 @@ void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& t
         if (probe_state->is_nulls[i] == 0) {
             probe_state->buckets[i] =
                     JoinHashMapHelper::calc_bucket_num<Slice>(probe_state->probe_slice[i], table_items.bucket_size);
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
         }
     }
+    JoinHashMapHelper::lookup_first(table_items, probe_state, probe_state->is_nulls.data(), row_count);
 }
 
 JoinHashTable JoinHashTable::clone_readable_table() {
@@ -247,6 +315,7 @@ void JoinHashTable::create(const HashTableParam& param) {
     _table_items->build_chunk = std::make_shared<Chunk>();
     _table_items->with_other_conjunct = param.with_other_conjunct;
     _table_items->join_type = param.join_type;
+    _table_items->build_pool = param.build_pool;
     _table_items->row_desc = param.row_desc;
     if (_table_items->join_type == TJoinOp::RIGHT_SEMI_JOIN || _table_items->join_type == TJoinOp::RIGHT_ANTI_JOIN ||
         _table_items->join_type == TJoinOp::RIGHT_OUTER_JOIN) {
@@ -388,6 +457,72 @@ Status JoinHashTable::build(RuntimeState* state) {
     return Status::OK();
 }
 
+void JoinHashTableStatsCounters::init(RuntimeProfile* runtime_profile) {
+    profile = runtime_profile;
+    load_factor = ADD_COUNTER(runtime_profile, "HashTableLoadFactor", TUnit::DOUBLE_VALUE);
+    used_buckets = ADD_COUNTER(runtime_profile, "HashTableUsedBuckets", TUnit::UNIT);
+    avg_chain_length = ADD_COUNTER(runtime_profile, "HashTableAvgChainLength", TUnit::DOUBLE_VALUE);
+    avg_probe_length = ADD_COUNTER(runtime_profile, "HashTableAvgProbeLength", TUnit::DOUBLE_VALUE);
+    max_probe_length = ADD_COUNTER(runtime_profile, "HashTableMaxProbeLength", TUnit::UNIT);
+}
+
+const char* JoinHashTable::hash_map_type_name(JoinHashMapType type) {
+    switch (type) {
+    case JoinHashMapType::empty:
+        return "empty";
+#define M(NAME)                 \
+    case JoinHashMapType::NAME: \
+        return #NAME;
+        APPLY_FOR_JOIN_VARIANTS(M)
+#undef M
+    }
+    return "unknown";
+}
+
+JoinHashTableStats JoinHashTable::compute_stats() const {
+    JoinHashTableStats stats;
+    if (_hash_map_type == JoinHashMapType::empty) {
+        return stats;
+    }
+    const auto& first = _table_items->first;
+    const auto& next = _table_items->next;
+    const uint32_t bucket_size = _table_items->bucket_size;
+    stats.bucket_count = bucket_size;
+    stats.row_count = _table_items->row_count;
+    for (uint32_t i = 0; i < bucket_size; i++) {
+        stats.used_bucket_count += first[i] != 0;
+    }
+
+    // Walking a chain is a cache miss per row, so only the chains of the buckets evenly spread are walked.
+    const uint32_t step = std::max(bucket_size / kStatsSampleBuckets, 1u);
+    uint64_t sampled_rows = 0;
+    uint64_t sampled_square_rows = 0;
+    for (uint32_t i = 0; i < bucket_size; i += step) {
+        uint32_t length = 0;
+        for (uint32_t index = first[i]; index != 0; index = next[index]) {
+            length++;
+        }
+        sampled_rows += length;
+        sampled_square_rows += static_cast<uint64_t>(length) * length;
+        stats.max_probe_length = std::max(stats.max_probe_length, length);
+    }
+    // A bucket of n rows is probed by the keys of its n rows, so it's weighted by n.
+    if (sampled_rows > 0) {
+        stats.avg_probe_length = static_cast<double>(sampled_square_rows) / sampled_rows;
+    }
+    return stats;
+}
+
+void JoinHashTable::update_stats_counters(const JoinHashTableStatsCounters& counters) const {
+    JoinHashTableStats stats = compute_stats();
+    counters.profile->add_info_string("HashMapType", hash_map_type_name(_hash_map_type));
+    counters.load_factor->set(stats.load_factor());
+    COUNTER_SET(counters.used_buckets, static_cast<int64_t>(stats.used_bucket_count));
+    counters.avg_chain_length->set(stats.avg_chain_length());
+    counters.avg_probe_length->set(stats.avg_probe_length);
+    COUNTER_SET(counters.max_probe_length, static_cast<int64_t>(stats.max_probe_length));
+}
+
 Status JoinHashTable::probe(RuntimeState* state, const Columns& key_columns, ChunkPtr* probe_chunk, ChunkPtr* chunk,
                             bool* eos) {
     switch (_hash_map_type) {
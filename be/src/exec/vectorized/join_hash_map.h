@@ -16,6 +16,10 @@
 #if defined(__aarch64__)
 #include "arm_acle.h"
 #endif
+namespace starrocks {
+class ThreadPool;
+}
+
 namespace starrocks::vectorized {
 
 #define APPLY_FOR_JOIN_VARIANTS(M) \
@@ -64,6 +68,40 @@ enum class JoinHashMapType {
 
 enum class JoinMatchFlag { NORMAL, ALL_NOT_MATCH, ALL_MATCH_ONE, MOST_MATCH_ONE };
 
+// The number of buckets of each radix partition of a large hash table, 256KB of "JoinHashTableItems.first" to
+// be in the L2 cache. The hash tables with more buckets are built partition by partition, and probed with prefetch.
+static constexpr uint32_t JOIN_HASH_MAP_PARTITION_BUCKETS = 1 << 16;
+// This is just an empirical value based on benchmark, and you can tweak it if more proper value is found.
+static constexpr uint32_t JOIN_HASH_MAP_PREFETCH_DIST = 16;
+
+// The quality of a built hash table. The probe lengths are the build rows in the bucket of a probe key, which
+// are all examined to find the matched rows, and are estimated by walking the chains of some sampled buckets.
+struct JoinHashTableStats {
+    uint32_t bucket_count = 0;
+    uint32_t used_bucket_count = 0;
+    uint32_t row_count = 0;
+    // The average probe length of the probe keys distributed as the build keys.
+    double avg_probe_length = 0;
+    uint32_t max_probe_length = 0;
+
+    double load_factor() const { return bucket_count == 0 ? 0 : static_cast<double>(row_count) / bucket_count; }
+    double avg_chain_length() const {
+        return used_bucket_count == 0 ? 0 : static_cast<double>(row_count) / used_bucket_count;
+    }
+};
+
+// The counters of JoinHashTableStats in the profile of a hash join.
+struct JoinHashTableStatsCounters {
+    RuntimeProfile* profile = nullptr;
+    RuntimeProfile::Counter* load_factor = nullptr;
+    RuntimeProfile::Counter* used_buckets = nullptr;
+    RuntimeProfile::Counter* avg_chain_length = nullptr;
+    RuntimeProfile::Counter* avg_probe_length = nullptr;
+    RuntimeProfile::Counter* max_probe_length = nullptr;
+
+    void init(RuntimeProfile* runtime_profile);
+};
+
 struct JoinKeyDesc {
     const TypeDescriptor* type = nullptr;
     bool is_null_safe_equal;
@@ -93,6 +131,15 @@ struct JoinHashTableItems {
     // about the bucket-chained hash table of this kind.
     Buffer<uint32_t> first;
     Buffer<uint32_t> next;
+    // For a hash table of more than JOIN_HASH_MAP_PARTITION_BUCKETS buckets, the build rows are radix partitioned by
+    // the high bits of their buckets, and linked into the buckets partition by partition, so that the buckets
+    // written are in cache. It holds the bucket of each build row before they are linked, and is released after.
+    Buffer<uint32_t> build_buckets;
+    // Prefetch the buckets and the build keys ahead when probing a hash table of more than
+    // JOIN_HASH_MAP_PARTITION_BUCKETS buckets, for which almost every probe step is a cache miss.
+    bool enable_prefetch = false;
+    // Partition and link the build rows in parallel in it if not nullptr, see HashTableParam.build_pool.
+    ThreadPool* build_pool = nullptr;
     Buffer<Slice> build_slice;
     ColumnPtr build_key_column;
     uint32_t bucket_size = 0;
@@ -200,6 +247,9 @@ struct HashTableParam {
     std::set<SlotId> output_slots;
     std::set<SlotId> predicate_slots;
     std::vector<JoinKeyDesc> join_keys;
+    // The threads to build a large hash table in parallel with, e.g. the one of a broadcast join shared by
+    // all the probe drivers of a fragment, which would be built by a single driver otherwise.
+    ThreadPool* build_pool = nullptr;
 
     RuntimeProfile::Counter* search_ht_timer = nullptr;
     RuntimeProfile::Counter* output_build_column_timer = nullptr;
@@ -245,6 +295,8 @@ class JoinHashMapHelper {
 public:
     // maxinum bucket size
     const static uint32_t MAX_BUCKET_SIZE = 1 << 31;
+    // the bucket of the build rows not linked into the hash table, e.g. of null keys
+    const static uint32_t NULL_BUCKET = UINT32_MAX;
 
     static uint32_t calc_bucket_size(uint32_t size) {
         size_t expect_bucket_size = static_cast<size_t>(size) + (size - 1) / 7;
@@ -270,6 +322,56 @@ public:
         }
     }
 
+    // Prepare the buckets of the hash table for the build rows.
+    static void prepare_buckets(JoinHashTableItems* table_items) {
+        table_items->bucket_size = calc_bucket_size(table_items->row_count + 1);
+        table_items->first.resize(table_items->bucket_size, 0);
+        table_items->next.resize(table_items->row_count + 1, 0);
+        table_items->enable_prefetch = table_items->bucket_size > JOIN_HASH_MAP_PARTITION_BUCKETS;
+        if (table_items->enable_prefetch) {
+            table_items->build_buckets.resize(table_items->row_count + 1, NULL_BUCKET);
+        }
+    }
+
+    // Link the build row |index| into |bucket|, or record it to be linked by link_partitioned_rows().
+    static void link_row(JoinHashTableItems* table_items, uint32_t index, uint32_t bucket) {
+        if (table_items->build_buckets.empty()) {
+            table_items->next[index] = table_items->first[bucket];
+            table_items->first[bucket] = index;
+        } else {
+            table_items->build_buckets[index] = bucket;
+        }
+    }
+
+    // Link the build rows recorded by link_row() into their buckets partition by partition, in parallel in
+    // "JoinHashTableItems.build_pool" if set. The rows of each bucket are linked in the same order as link_row() does.
+    static void link_partitioned_rows(JoinHashTableItems* table_items);
+
+    // Look up the first build rows of the buckets of the probe rows, the ones in |is_nulls| excluded.
+    static void lookup_first(const JoinHashTableItems& table_items, HashTableProbeState* probe_state,
+                             const uint8_t* is_nulls, uint32_t row_count) {
+        const uint32_t* first = table_items.first.data();
+        const uint32_t* buckets = probe_state->buckets.data();
+        uint32_t* next = probe_state->next.data();
+        if (table_items.enable_prefetch) {
+            for (uint32_t i = 0; i < row_count; i++) {
+                uint32_t ahead = i + JOIN_HASH_MAP_PREFETCH_DIST;
+                if (ahead < row_count && (is_nulls == nullptr || is_nulls[ahead] == 0)) {
+                    __builtin_prefetch(first + buckets[ahead]);
+                }
+                next[i] = (is_nulls == nullptr || is_nulls[i] == 0) ? first[buckets[i]] : 0;
+            }
+        } else if (is_nulls == nullptr) {
+            for (uint32_t i = 0; i < row_count; i++) {
+                next[i] = first[buckets[i]];
+            }
+        } else {
+            for (uint32_t i = 0; i < row_count; i++) {
+                next[i] = is_nulls[i] == 0 ? first[buckets[i]] : 0;
+            }
+        }
+    }
+
     static Slice get_hash_key(const Columns& key_columns, size_t row_idx, uint8_t* buffer) {
         size_t byte_size = 0;
         for (const auto& key_column : key_columns) {
@@ -587,6 +689,15 @@ public:
     size_t get_probe_column_count() const { return _table_items->probe_column_count; }
     size_t get_build_column_count() const { return _table_items->build_column_count; }
     size_t get_bucket_size() const { return _table_items->bucket_size; }
+    JoinHashMapType get_hash_map_type() const { return _hash_map_type; }
+    static const char* hash_map_type_name(JoinHashMapType type);
+
+    // Computed after building, by a sequential scan of the buckets and walking the chains of at most
+    // kStatsSampleBuckets buckets, which is negligible compared to building.
+    JoinHashTableStats compute_stats() const;
+    // Set the counters and the HashMapType of the profile by compute_stats().
+    void update_stats_counters(const JoinHashTableStatsCounters& counters) const;
+    static constexpr uint32_t kStatsSampleBuckets = 1024;
 
     void remove_duplicate_index(Column::Filter* filter);
 
@@ -5,9 +5,7 @@
 namespace starrocks::vectorized {
 template <PrimitiveType PT>
 void JoinBuildFunc<PT>::prepare(RuntimeState* runtime, JoinHashTableItems* table_items) {
-    table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    JoinHashMapHelper::prepare_buckets(table_items);
 }
 
 template <PrimitiveType PT>
@@ -42,15 +40,13 @@ void JoinBuildFunc<PT>::construct_hash_table(RuntimeState* state, JoinHashTableI
         for (size_t i = 1; i < table_items->row_count + 1; i++) {
             if (null_array[i] == 0) {
                 uint32_t bucket_num = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size);
-                table_items->next[i] = table_items->first[bucket_num];
-                table_items->first[bucket_num] = i;
+                JoinHashMapHelper::link_row(table_items, i, bucket_num);
             }
         }
     } else {
         for (size_t i = 1; i < table_items->row_count + 1; i++) {
             uint32_t bucket_num = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size);
-            table_items->next[i] = table_items->first[bucket_num];
-            table_items->first[bucket_num] = i;
+            JoinHashMapHelper::link_row(table_items, i, bucket_num);
         }
     }
 }
@@ -102,9 +98,7 @@ void DirectMappingJoinBuildFunc<PT>::construct_hash_table(RuntimeState* state, J
 
 template <PrimitiveType PT>
 void FixedSizeJoinBuildFunc<PT>::prepare(RuntimeState* state, JoinHashTableItems* table_items) {
-    table_items->bucket_size = JoinHashMapHelper::calc_bucket_size(table_items->row_count + 1);
-    table_items->first.resize(table_items->bucket_size, 0);
-    table_items->next.resize(table_items->row_count + 1, 0);
+    JoinHashMapHelper::prepare_buckets(table_items);
     table_items->build_key_column = ColumnType::create(table_items->row_count + 1);
 }
 
@@ -159,8 +153,7 @@ void FixedSizeJoinBuildFunc<PT>::_build_columns(JoinHashTableItems* table_items,
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
 
     for (uint32_t i = 0; i < count; i++) {
-        table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-        table_items->first[probe_state->buckets[i]] = start + i;
+        JoinHashMapHelper::link_row(table_items, start + i, probe_state->buckets[i]);
     }
 }
 
@@ -185,8 +178,7 @@ void FixedSizeJoinBuildFunc<PT>::_build_nullable_columns(JoinHashTableItems* tab
 
     for (size_t i = 0; i < count; i++) {
         if (probe_state->is_nulls[i] == 0) {
-            table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-            table_items->first[probe_state->buckets[i]] = start + i;
+            JoinHashMapHelper::link_row(table_items, start + i, probe_state->buckets[i]);
         }
     }
 }
@@ -248,26 +240,16 @@ void JoinProbeFunc<PT>::lookup_init(const JoinHashTableItems& table_items, HashT
 
         if (nullable_column->has_null()) {
             auto& null_array = nullable_column->null_column()->get_data();
-            for (size_t i = 0; i < probe_row_count; i++) {
-                if (null_array[i] == 0) {
-                    probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-                } else {
-                    probe_state->next[i] = 0;
-                }
-            }
+            JoinHashMapHelper::lookup_first(table_items, probe_state, null_array.data(), probe_row_count);
             probe_state->null_array = &nullable_column->null_column()->get_data();
         } else {
-            for (size_t i = 0; i < probe_row_count; i++) {
-                probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-            }
+            JoinHashMapHelper::lookup_first(table_items, probe_state, nullptr, probe_row_count);
             probe_state->null_array = nullptr;
         }
         return;
     }
 
-    for (size_t i = 0; i < probe_row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_first(table_items, probe_state, nullptr, probe_row_count);
     probe_state->null_array = nullptr;
 }
 
@@ -325,10 +307,7 @@ void FixedSizeJoinProbeFunc<PT>::_probe_column(const JoinHashTableItems& table_i
                                                            row_count);
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
-
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_first(table_items, probe_state, nullptr, row_count);
 }
 
 template <PrimitiveType PT>
@@ -350,14 +329,7 @@ void FixedSizeJoinProbeFunc<PT>::_probe_nullable_column(const JoinHashTableItems
                                                            row_count);
     const auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, row_count);
-
-    for (uint32_t i = 0; i < row_count; i++) {
-        if (probe_state->is_nulls[i] == 0) {
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
-        }
-    }
+    JoinHashMapHelper::lookup_first(table_items, probe_state, probe_state->is_nulls.data(), row_count);
 }
 
 template <PrimitiveType PT, class BuildFunc, class ProbeFunc>
@@ -387,6 +359,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::probe_prepare(RuntimeState* state) {
 template <PrimitiveType PT, class BuildFunc, class ProbeFunc>
 void JoinHashMap<PT, BuildFunc, ProbeFunc>::build(RuntimeState* state) {
     BuildFunc().construct_hash_table(state, _table_items, _probe_state);
+    JoinHashMapHelper::link_partitioned_rows(_table_items);
 }
 
 template <PrimitiveType PT, class BuildFunc, class ProbeFunc>
@@ -890,6 +863,12 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_search_ht_impl(RuntimeState* state,
         }                                                                              \
     }
 
+// Prefetch the build key JOIN_HASH_MAP_PREFETCH_DIST probe rows ahead.
+#define PREFETCH_BUILD_DATA()                                                                 \
+    if (_table_items->enable_prefetch && i + JOIN_HASH_MAP_PREFETCH_DIST < probe_row_count) { \
+        __builtin_prefetch(&build_data[_probe_state->next[i + JOIN_HASH_MAP_PREFETCH_DIST]]); \
+    }
+
 #define PROBE_OVER()                   \
     _probe_state->has_remain = false;  \
     _probe_state->cur_probe_index = 0; \
@@ -917,6 +896,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht(RuntimeState* state,
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         if constexpr (first_probe) {
             _probe_state->probe_match_filter[i] = 0;
         }
@@ -977,6 +957,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_outer_join(R
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -1029,6 +1010,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_semi_join(Ru
     size_t match_count = 0;
     size_t probe_row_count = _probe_state->probe_row_count;
     for (size_t i = 0; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         size_t index = _probe_state->next[i];
         if (index == 0) {
             continue;
@@ -1060,6 +1042,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
         _table_items->row_count != 0) {
         // process left anti join from not in
         for (size_t i = 0; i < probe_row_count; i++) {
+            PREFETCH_BUILD_DATA()
             size_t index = _probe_state->next[i];
             if ((*_probe_state->null_array)[i] == 1) {
                 continue;
@@ -1086,6 +1069,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
         }
     } else {
         for (size_t i = 0; i < probe_row_count; i++) {
+            PREFETCH_BUILD_DATA()
             size_t index = _probe_state->next[i];
             if (index == 0) {
                 _probe_state->probe_index[match_count] = i;
@@ -1130,6 +1114,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_outer_join(
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1168,6 +1153,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_semi_join(R
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1198,6 +1184,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_anti_join(R
                                                                                const Buffer<CppType>& probe_data) {
     size_t probe_row_count = _probe_state->probe_row_count;
     for (size_t i = 0; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         size_t index = _probe_state->next[i];
         if (index == 0) {
             continue;
@@ -1235,6 +1222,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_full_outer_join(R
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -1293,6 +1281,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_outer_join_w
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -1352,6 +1341,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_semi_join_wi
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1397,6 +1387,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join_wi
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -1444,6 +1435,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_outer_join_
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1475,6 +1467,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_semi_join_w
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1506,6 +1499,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_anti_join_w
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1550,6 +1544,7 @@ void JoinHashMap<PT, BuildFunc, ProbeFunc>::_probe_from_ht_for_full_outer_join_w
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        PREFETCH_BUILD_DATA()
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
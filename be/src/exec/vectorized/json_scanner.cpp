@@ -314,6 +314,7 @@ Status JsonReader::open() {
     if (_scanner->_json_paths.empty() && _scanner->_root_paths.empty()) {
         _build_slot_descs();
     }
+    _build_slot_index_dict();
 
     _closed = false;
     return Status::OK();
@@ -458,37 +459,25 @@ Status JsonReader::_read_rows(Chunk* chunk, int32_t rows_to_read, int32_t* rows_
 }
 
 Status JsonReader::_construct_row_in_object_order(simdjson::ondemand::object* row, Chunk* chunk) {
-    // make a copy for _slot_desc_dict.
-    auto slot_desc_dict(_slot_desc_dict);
+    std::fill(_slot_filled.begin(), _slot_filled.end(), 0);
     try {
-        std::ostringstream oss;
-
         for (auto field : *row) {
-            // TODO:This is ugly, but there's no good way to convert json field key to std::string.
-            // convert field key to std::string.
-            simdjson::ondemand::raw_json_string raw_key = field.key();
-            oss << raw_key;
-            auto key = oss.str();
-            oss.str("");
-
-            // look up key in the slot dict.
-            auto itr = slot_desc_dict.find(key);
-            if (itr == slot_desc_dict.end()) {
+            std::string_view key = field.unescaped_key();
+
+            // look up key in the slot dict, the duplicated key in json would be skipped.
+            auto itr = _slot_index_dict.find(key);
+            if (itr == _slot_index_dict.end() || _slot_filled[itr->second]) {
                 continue;
             }
 
-            auto slot_desc = itr->second;
-
+            auto slot_desc = _slot_descs[itr->second];
             auto column = chunk->get_column_by_slot_id(slot_desc->id());
-            const auto& col_name = slot_desc->col_name();
 
             simdjson::ondemand::value val = field.value();
 
             // construct column with value.
-            RETURN_IF_ERROR(_construct_column(val, column.get(), slot_desc->type(), col_name));
-
-            // delete the written column.
-            slot_desc_dict.erase(key);
+            RETURN_IF_ERROR(_construct_column(val, column.get(), slot_desc->type(), slot_desc->col_name()));
+            _slot_filled[itr->second] = 1;
         }
     } catch (simdjson::simdjson_error& e) {
         auto err_msg = strings::Substitute("construct row in object order failed, error: $0",
@@ -496,24 +485,13 @@ Status JsonReader::_construct_row_in_object_order(simdjson::ondemand::object* ro
         return Status::DataQualityError(err_msg);
     }
 
-    // append null to the column without data.
-    for (auto& pair : slot_desc_dict) {
-        auto col_name = pair.first;
-        auto slot_desc = pair.second;
-
-        auto column = chunk->get_column_by_slot_id(slot_desc->id());
-
-        if (col_name == "__op") {
-            // special treatment for __op column, fill default value '0' rather than null
-            if (column->is_binary()) {
-                column->append_strings(std::vector{Slice{"0"}});
-            } else {
-                column->append_datum(Datum((uint8_t)0));
-            }
-        } else {
-            // Column name not found, fill column with null.
-            column->append_nulls(1);
+    // append default value to the column without data.
+    for (size_t i = 0; i < _slot_descs.size(); i++) {
+        if (_slot_descs[i] == nullptr || _slot_filled[i]) {
+            continue;
         }
+        auto column = chunk->get_column_by_slot_id(_slot_descs[i]->id());
+        _append_default_value(column.get(), _slot_descs[i]->col_name());
     }
     return Status::OK();
 }
@@ -532,17 +510,7 @@ Status JsonReader::_construct_row_in_slot_order(simdjson::ondemand::object* row,
             simdjson::ondemand::value val = row->find_field_unordered(col_name);
             RETURN_IF_ERROR(_construct_column(val, column.get(), slot_desc->type(), slot_desc->col_name()));
         } catch (simdjson::simdjson_error& e) {
-            if (col_name == "__op") {
-                // special treatment for __op column, fill default value '0' rather than null
-                if (column->is_binary()) {
-                    column->append_strings(std::vector{Slice{"0"}});
-                } else {
-                    column->append_datum(Datum((uint8_t)0));
-                }
-            } else {
-                // Column name not found, fill column with null.
-                column->append_nulls(1);
-            }
+            _append_default_value(column.get(), col_name);
             continue;
         }
     }
@@ -559,64 +527,93 @@ Status JsonReader::_construct_row(simdjson::ondemand::object* row, Chunk* chunk)
         } else {
             return _construct_row_in_slot_order(row, chunk);
         }
+    } else if (_simple_json_paths) {
+        // With json paths like "$.key", look up the key of each field in a single pass of the object,
+        // rather than seeking every json path in the object.
+        return _construct_row_in_object_order(row, chunk);
     } else {
-        // With json path.
+        return _construct_row_with_json_paths(row, chunk);
+    }
+}
 
-        size_t slot_size = _slot_descs.size();
-        size_t jsonpath_size = _scanner->_json_paths.size();
-        for (size_t i = 0; i < slot_size; i++) {
-            if (_slot_descs[i] == nullptr) {
-                continue;
-            }
-            const char* column_name = _slot_descs[i]->col_name().c_str();
-
-            // The columns in JsonReader's chunk are all in NullableColumn type;
-            auto column = down_cast<NullableColumn*>(chunk->get_column_by_slot_id(_slot_descs[i]->id()).get());
-            if (i >= jsonpath_size) {
-                if (strcmp(column_name, "__op") == 0) {
-                    // special treatment for __op column, fill default value '0' rather than null
-                    if (column->is_binary()) {
-                        column->append_strings(std::vector{Slice{"0"}});
-                    } else {
-                        column->append_datum(Datum((uint8_t)0));
-                    }
-                } else {
-                    column->append_nulls(1);
-                }
-                continue;
-            }
+Status JsonReader::_construct_row_with_json_paths(simdjson::ondemand::object* row, Chunk* chunk) {
+    size_t slot_size = _slot_descs.size();
+    size_t jsonpath_size = _scanner->_json_paths.size();
+    for (size_t i = 0; i < slot_size; i++) {
+        if (_slot_descs[i] == nullptr) {
+            continue;
+        }
+        const auto& column_name = _slot_descs[i]->col_name();
 
-            simdjson::ondemand::value val;
-            // NOTE
-            // Why not process this syntax in extract_from_object?
-            // simdjson's api is limited, which coult not convert ondemand::object to ondemand::value.
-            // As a workaround, extract procedure is duplicated, for both ondemand::object and ondemand::value
-            // TODO(mofei) make it more elegant
-            if (_scanner->_json_paths[i].size() == 1 && _scanner->_json_paths[i][0].key == "$") {
-                // add_nullable_column may invoke a for-range iterating to the row.
-                // If the for-range iterating is invoked after field access, or a second for-range iterating is invoked,
-                // it would get an error "Objects and arrays can only be iterated when they are first encountered",
-                // Hence, resetting the row object is necessary here.
-                row->reset();
-                RETURN_IF_ERROR(add_nullable_column(column, _slot_descs[i]->type(), _slot_descs[i]->col_name(), row,
-                                                    !_strict_mode));
-            } else if (!JsonFunctions::extract_from_object(*row, _scanner->_json_paths[i], &val).ok()) {
-                if (strcmp(column_name, "__op") == 0) {
-                    // special treatment for __op column, fill default value '0' rather than null
-                    if (column->is_binary()) {
-                        column->append_strings(std::vector{Slice{"0"}});
-                    } else {
-                        column->append_datum(Datum((uint8_t)0));
-                    }
-                } else {
-                    column->append_nulls(1);
-                }
-            } else {
-                RETURN_IF_ERROR(_construct_column(val, column, _slot_descs[i]->type(), _slot_descs[i]->col_name()));
+        // The columns in JsonReader's chunk are all in NullableColumn type;
+        auto column = down_cast<NullableColumn*>(chunk->get_column_by_slot_id(_slot_descs[i]->id()).get());
+        if (i >= jsonpath_size) {
+            _append_default_value(column, column_name);
+            continue;
+        }
+
+        simdjson::ondemand::value val;
+        // NOTE
+        // Why not process this syntax in extract_from_object?
+        // simdjson's api is limited, which coult not convert ondemand::object to ondemand::value.
+        // As a workaround, extract procedure is duplicated, for both ondemand::object and ondemand::value
+        // TODO(mofei) make it more elegant
+        if (_scanner->_json_paths[i].size() == 1 && _scanner->_json_paths[i][0].key == "$") {
+            // add_nullable_column may invoke a for-range iterating to the row.
+            // If the for-range iterating is invoked after field access, or a second for-range iterating is invoked,
+            // it would get an error "Objects and arrays can only be iterated when they are first encountered",
+            // Hence, resetting the row object is necessary here.
+            row->reset();
+            RETURN_IF_ERROR(add_nullable_column(column, _slot_descs[i]->type(), _slot_descs[i]->col_name(), row,
+                                                !_strict_mode));
+        } else if (!JsonFunctions::extract_from_object(*row, _scanner->_json_paths[i], &val).ok()) {
+            _append_default_value(column, column_name);
+        } else {
+            RETURN_IF_ERROR(_construct_column(val, column, _slot_descs[i]->type(), _slot_descs[i]->col_name()));
+        }
+    }
+    return Status::OK();
+}
+
+void JsonReader::_append_default_value(Column* column, const std::string& col_name) {
+    if (col_name == "__op") {
+        // special treatment for __op column, fill default value '0' rather than null
+        if (column->is_binary()) {
+            column->append_strings(std::vector{Slice{"0"}});
+        } else {
+            column->append_datum(Datum((uint8_t)0));
+        }
+    } else {
+        // Column name not found, fill column with null.
+        column->append_nulls(1);
+    }
+}
+
+void JsonReader::_build_slot_index_dict() {
+    const auto& json_paths = _scanner->_json_paths;
+    _simple_json_paths = !json_paths.empty();
+    for (const auto& path : json_paths) {
+        if (path.size() != 2 || !path[1].is_valid || path[1].idx != -1 || path[1].key.empty()) {
+            _simple_json_paths = false;
+            break;
+        }
+    }
+
+    _slot_index_dict.clear();
+    for (size_t i = 0; i < _slot_descs.size(); i++) {
+        if (_slot_descs[i] == nullptr) {
+            continue;
+        }
+        if (json_paths.empty()) {
+            _slot_index_dict.emplace(_slot_descs[i]->col_name(), i);
+        } else if (_simple_json_paths && i < json_paths.size()) {
+            // Several slots with the same json path could not be filled in a single pass.
+            if (!_slot_index_dict.emplace(json_paths[i][1].key, i).second) {
+                _simple_json_paths = false;
             }
         }
-        return Status::OK();
     }
+    _slot_filled.assign(_slot_descs.size(), 0);
 }
 
 void JsonReader::_build_slot_descs() {
@@ -89,12 +89,19 @@ private:
 
     Status _construct_row_in_object_order(simdjson::ondemand::object* row, Chunk* chunk);
     Status _construct_row_in_slot_order(simdjson::ondemand::object* row, Chunk* chunk);
+    Status _construct_row_with_json_paths(simdjson::ondemand::object* row, Chunk* chunk);
+
+    // fill the default value of the slot which is not found in the json object.
+    void _append_default_value(Column* column, const std::string& col_name);
 
     Status _construct_column(simdjson::ondemand::value& value, Column* column, const TypeDescriptor& type_desc,
                              const std::string& col_name);
 
     // _build_slot_descs builds _slot_descs as the order of first json object and builds _slot_desc_dict;
     void _build_slot_descs();
+    // _build_slot_index_dict maps the json key of each slot to its index in _slot_descs, the key is the column
+    // name without json paths, or the key of the json path if all the json paths are in the form of "$.key".
+    void _build_slot_index_dict();
 
 private:
     RuntimeState* _state = nullptr;
@@ -106,6 +113,12 @@ private:
     bool _closed;
     std::vector<SlotDescriptor*> _slot_descs;
     std::unordered_map<std::string, SlotDescriptor*> _slot_desc_dict;
+    // the keys point to the column names or the json paths, which outlive the reader.
+    std::unordered_map<std::string_view, size_t> _slot_index_dict;
+    // whether the slots are filled by the current row, indexed as _slot_descs.
+    std::vector<uint8_t> _slot_filled;
+    // all the json paths are in the form of "$.key", the row can be constructed in a single pass of the object.
+    bool _simple_json_paths = false;
 
     // For performance reason, the simdjson parser should be reused over several files.
     //https://github.com/simdjson/simdjson/blob/master/doc/performance.md
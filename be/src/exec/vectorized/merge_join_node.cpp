@@ -0,0 +1,253 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/vectorized/merge_join_node.h"
+
+#include "exec/pipeline/limit_operator.h"
+#include "exec/pipeline/mergejoin/merge_join_context.h"
+#include "exec/pipeline/mergejoin/merge_join_left_operator.h"
+#include "exec/pipeline/mergejoin/merge_join_right_sink_operator.h"
+#include "exec/pipeline/operator.h"
+#include "exec/pipeline/pipeline_builder.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::vectorized {
+
+// The max number of right chunks buffered for MergeJoinLeftOperator.
+static constexpr size_t kMaxBufferedRightChunks = 4;
+
+MergeJoinNode::MergeJoinNode(ObjectPool* pool, const TPlanNode& tnode, const DescriptorTbl& descs)
+        : ExecNode(pool, tnode, descs), _join_op(tnode.merge_join_node.join_op) {}
+
+bool MergeJoinNode::is_supported(const TPlanNode& tnode) {
+    const TMergeJoinNode& merge_join_node = tnode.merge_join_node;
+    if (!merge_join_node.__isset.join_op || !MergeJoiner::is_supported_join_op(merge_join_node.join_op)) {
+        return false;
+    }
+    // Null aware anti join.
+    if (merge_join_node.join_op == TJoinOp::LEFT_ANTI_JOIN && merge_join_node.is_rewritten_from_not_in) {
+        return false;
+    }
+    // The other join conjuncts decide whether a left row is matched for the non-inner join,
+    // which can't be evaluated on the output chunks.
+    if (merge_join_node.join_op != TJoinOp::INNER_JOIN && !merge_join_node.other_join_conjuncts.empty()) {
+        return false;
+    }
+    // The runtime filters are built from the whole right input, which isn't materialized by merge join.
+    if (!merge_join_node.build_runtime_filters.empty()) {
+        return false;
+    }
+    if (merge_join_node.eq_join_conjuncts.empty()) {
+        return false;
+    }
+    for (const auto& eq_join_conjunct : merge_join_node.eq_join_conjuncts) {
+        if (eq_join_conjunct.__isset.opcode && eq_join_conjunct.opcode == TExprOpcode::EQ_FOR_NULL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TPlanNode MergeJoinNode::to_hash_join_tnode(const TPlanNode& tnode) {
+    const TMergeJoinNode& merge_join_node = tnode.merge_join_node;
+    TPlanNode hash_join_tnode = tnode;
+    hash_join_tnode.__set_node_type(TPlanNodeType::HASH_JOIN_NODE);
+    hash_join_tnode.__isset.merge_join_node = false;
+
+    THashJoinNode hash_join_node;
+    hash_join_node.__set_join_op(merge_join_node.join_op);
+    hash_join_node.__set_eq_join_conjuncts(merge_join_node.eq_join_conjuncts);
+    if (merge_join_node.__isset.other_join_conjuncts) {
+        hash_join_node.__set_other_join_conjuncts(merge_join_node.other_join_conjuncts);
+    }
+    if (merge_join_node.__isset.is_push_down) {
+        hash_join_node.__set_is_push_down(merge_join_node.is_push_down);
+    }
+    if (merge_join_node.__isset.add_probe_filters) {
+        hash_join_node.__set_add_probe_filters(merge_join_node.add_probe_filters);
+    }
+    if (merge_join_node.__isset.is_rewritten_from_not_in) {
+        hash_join_node.__set_is_rewritten_from_not_in(merge_join_node.is_rewritten_from_not_in);
+    }
+    if (merge_join_node.__isset.sql_join_predicates) {
+        hash_join_node.__set_sql_join_predicates(merge_join_node.sql_join_predicates);
+    }
+    if (merge_join_node.__isset.sql_predicates) {
+        hash_join_node.__set_sql_predicates(merge_join_node.sql_predicates);
+    }
+    if (merge_join_node.__isset.build_runtime_filters) {
+        hash_join_node.__set_build_runtime_filters(merge_join_node.build_runtime_filters);
+    }
+    if (merge_join_node.__isset.build_runtime_filters_from_planner) {
+        hash_join_node.__set_build_runtime_filters_from_planner(merge_join_node.build_runtime_filters_from_planner);
+    }
+    if (merge_join_node.__isset.distribution_mode) {
+        hash_join_node.__set_distribution_mode(merge_join_node.distribution_mode);
+    }
+    if (merge_join_node.__isset.partition_exprs) {
+        hash_join_node.__set_partition_exprs(merge_join_node.partition_exprs);
+    }
+    if (merge_join_node.__isset.output_columns) {
+        hash_join_node.__set_output_columns(merge_join_node.output_columns);
+    }
+    hash_join_tnode.__set_hash_join_node(std::move(hash_join_node));
+    return hash_join_tnode;
+}
+
+Status MergeJoinNode::init(const TPlanNode& tnode, RuntimeState* state) {
+    RETURN_IF_ERROR(ExecNode::init(tnode, state));
+
+    if (tnode.merge_join_node.__isset.sql_join_predicates) {
+        _runtime_profile->add_info_string("JoinPredicates", tnode.merge_join_node.sql_join_predicates);
+    }
+    if (tnode.merge_join_node.__isset.sql_predicates) {
+        _runtime_profile->add_info_string("Predicates", tnode.merge_join_node.sql_predicates);
+    }
+
+    for (const auto& eq_join_conjunct : tnode.merge_join_node.eq_join_conjuncts) {
+        ExprContext* ctx = nullptr;
+        RETURN_IF_ERROR(Expr::create_expr_tree(_pool, eq_join_conjunct.left, &ctx));
+        _left_expr_ctxs.push_back(ctx);
+        RETURN_IF_ERROR(Expr::create_expr_tree(_pool, eq_join_conjunct.right, &ctx));
+        _right_expr_ctxs.push_back(ctx);
+    }
+    RETURN_IF_ERROR(
+            Expr::create_expr_trees(_pool, tnode.merge_join_node.other_join_conjuncts, &_other_join_conjunct_ctxs));
+    return Status::OK();
+}
+
+Status MergeJoinNode::prepare(RuntimeState* state) {
+    RETURN_IF_ERROR(ExecNode::prepare(state));
+
+    _join_timer = ADD_TIMER(runtime_profile(), "JoinTime");
+    _left_rows_counter = ADD_COUNTER(runtime_profile(), "LeftRows", TUnit::UNIT);
+    _right_rows_counter = ADD_COUNTER(runtime_profile(), "RightRows", TUnit::UNIT);
+
+    RETURN_IF_ERROR(Expr::prepare(_left_expr_ctxs, state));
+    RETURN_IF_ERROR(Expr::prepare(_right_expr_ctxs, state));
+    RETURN_IF_ERROR(Expr::prepare(_other_join_conjunct_ctxs, state));
+
+    _joiner = std::make_unique<MergeJoiner>(_join_op, _left_expr_ctxs, _right_expr_ctxs, child(0)->row_desc(),
+                                            child(1)->row_desc());
+    return Status::OK();
+}
+
+Status MergeJoinNode::open(RuntimeState* state) {
+    SCOPED_TIMER(_runtime_profile->total_time_counter());
+    RETURN_IF_ERROR(ExecNode::open(state));
+    RETURN_IF_ERROR(Expr::open(_left_expr_ctxs, state));
+    RETURN_IF_ERROR(Expr::open(_right_expr_ctxs, state));
+    RETURN_IF_ERROR(Expr::open(_other_join_conjunct_ctxs, state));
+
+    RETURN_IF_ERROR(child(1)->open(state));
+    RETURN_IF_ERROR(child(0)->open(state));
+    return Status::OK();
+}
+
+Status MergeJoinNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
+    SCOPED_TIMER(_runtime_profile->total_time_counter());
+
+    while (!_joiner->is_finished() && !reached_limit()) {
+        RETURN_IF_CANCELLED(state);
+
+        if (_joiner->need_left()) {
+            ChunkPtr left_chunk = nullptr;
+            bool left_eos = false;
+            RETURN_IF_ERROR(child(0)->get_next(state, &left_chunk, &left_eos));
+            if (left_eos) {
+                _joiner->set_left_eos();
+            } else {
+                COUNTER_UPDATE(_left_rows_counter, left_chunk->num_rows());
+                RETURN_IF_ERROR(_joiner->push_left(state, left_chunk));
+            }
+            continue;
+        }
+
+        if (_joiner->need_right()) {
+            ChunkPtr right_chunk = nullptr;
+            bool right_eos = false;
+            RETURN_IF_ERROR(child(1)->get_next(state, &right_chunk, &right_eos));
+            if (right_eos) {
+                _joiner->set_right_eos();
+            } else {
+                COUNTER_UPDATE(_right_rows_counter, right_chunk->num_rows());
+                RETURN_IF_ERROR(_joiner->push_right(state, right_chunk));
+            }
+            continue;
+        }
+
+        {
+            SCOPED_TIMER(_join_timer);
+            RETURN_IF_ERROR(_joiner->pull(state, chunk));
+            if (*chunk == nullptr || (*chunk)->is_empty()) {
+                continue;
+            }
+            RETURN_IF_ERROR(ExecNode::eval_conjuncts(_other_join_conjunct_ctxs, chunk->get()));
+            RETURN_IF_ERROR(ExecNode::eval_conjuncts(_conjunct_ctxs, chunk->get()));
+        }
+        if ((*chunk)->is_empty()) {
+            continue;
+        }
+
+        _num_rows_returned += (*chunk)->num_rows();
+        if (reached_limit()) {
+            (*chunk)->set_num_rows((*chunk)->num_rows() - (_num_rows_returned - _limit));
+            _num_rows_returned = _limit;
+        }
+        COUNTER_SET(_rows_returned_counter, _num_rows_returned);
+        *eos = false;
+        return Status::OK();
+    }
+
+    *chunk = nullptr;
+    *eos = true;
+    return Status::OK();
+}
+
+Status MergeJoinNode::close(RuntimeState* state) {
+    if (is_closed()) {
+        return Status::OK();
+    }
+
+    Expr::close(_other_join_conjunct_ctxs, state);
+    Expr::close(_right_expr_ctxs, state);
+    Expr::close(_left_expr_ctxs, state);
+    return ExecNode::close(state);
+}
+
+pipeline::OpFactories MergeJoinNode::decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
+    using namespace pipeline;
+
+    // step 0: construct pipeline end with merge join right operator.
+    OpFactories right_ops = _children[1]->decompose_to_pipeline(context);
+    // The sorted input is produced by one driver, so the order is kept across chunks.
+    DCHECK_EQ(1, down_cast<SourceOperatorFactory*>(right_ops[0].get())->degree_of_parallelism());
+
+    auto&& rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(2, std::move(this->runtime_filter_collector()));
+    auto merge_join_context = std::make_shared<MergeJoinContext>(kMaxBufferedRightChunks);
+
+    auto right_factory =
+            std::make_shared<MergeJoinRightSinkOperatorFactory>(context->next_operator_id(), id(), merge_join_context);
+    this->init_runtime_filter_for_operator(right_factory.get(), context, rc_rf_probe_collector);
+    right_ops.emplace_back(std::move(right_factory));
+    context->add_pipeline(right_ops);
+
+    // step 1: construct pipeline end with merge join left operator.
+    OpFactories left_ops = _children[0]->decompose_to_pipeline(context);
+    DCHECK_EQ(1, down_cast<SourceOperatorFactory*>(left_ops[0].get())->degree_of_parallelism());
+
+    auto left_factory = std::make_shared<MergeJoinLeftOperatorFactory>(
+            context->next_operator_id(), id(), _join_op, child(0)->row_desc(), child(1)->row_desc(),
+            std::move(_left_expr_ctxs), std::move(_right_expr_ctxs), std::move(_other_join_conjunct_ctxs),
+            std::move(_conjunct_ctxs), std::move(merge_join_context));
+    this->init_runtime_filter_for_operator(left_factory.get(), context, rc_rf_probe_collector);
+    left_ops.emplace_back(std::move(left_factory));
+    if (limit() != -1) {
+        left_ops.emplace_back(std::make_shared<LimitOperatorFactory>(context->next_operator_id(), id(), limit()));
+    }
+
+    return left_ops;
+}
+
+} // namespace starrocks::vectorized
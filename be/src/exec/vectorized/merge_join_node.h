@@ -0,0 +1,55 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+
+#include "column/chunk.h"
+#include "exec/exec_node.h"
+#include "exec/vectorized/merge_joiner.h"
+
+namespace starrocks {
+namespace vectorized {
+
+// MergeJoinNode joins two children which are both sorted by the join keys, without building a hash table.
+// The planner guarantees the order by placing a merging sort or a merging exchange under each child.
+class MergeJoinNode final : public ExecNode {
+public:
+    MergeJoinNode(ObjectPool* pool, const TPlanNode& tnode, const DescriptorTbl& descs);
+
+    ~MergeJoinNode() override {
+        if (runtime_state() != nullptr) {
+            close(runtime_state());
+        }
+    }
+
+    // Returns false if the merge join plan node can't be executed by MergeJoinNode,
+    // which should be converted to a hash join plan node by to_hash_join_tnode.
+    static bool is_supported(const TPlanNode& tnode);
+    static TPlanNode to_hash_join_tnode(const TPlanNode& tnode);
+
+    Status init(const TPlanNode& tnode, RuntimeState* state) override;
+    Status prepare(RuntimeState* state) override;
+    Status open(RuntimeState* state) override;
+    Status get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) override;
+    Status close(RuntimeState* state) override;
+
+    std::vector<std::shared_ptr<pipeline::OperatorFactory>> decompose_to_pipeline(
+            pipeline::PipelineBuilderContext* context) override;
+
+private:
+    const TJoinOp::type _join_op;
+
+    std::vector<ExprContext*> _left_expr_ctxs;
+    std::vector<ExprContext*> _right_expr_ctxs;
+    std::vector<ExprContext*> _other_join_conjunct_ctxs;
+
+    std::unique_ptr<MergeJoiner> _joiner;
+
+    RuntimeProfile::Counter* _join_timer = nullptr;
+    RuntimeProfile::Counter* _left_rows_counter = nullptr;
+    RuntimeProfile::Counter* _right_rows_counter = nullptr;
+};
+
+} // namespace vectorized
+} // namespace starrocks
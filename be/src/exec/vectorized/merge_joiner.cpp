@@ -0,0 +1,246 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/vectorized/merge_joiner.h"
+
+#include <algorithm>
+
+#include "column/column_helper.h"
+#include "exprs/expr_context.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::vectorized {
+
+MergeJoiner::MergeJoiner(TJoinOp::type join_op, const std::vector<ExprContext*>& left_expr_ctxs,
+                         const std::vector<ExprContext*>& right_expr_ctxs, const RowDescriptor& left_row_desc,
+                         const RowDescriptor& right_row_desc)
+        : _join_op(join_op), _left_expr_ctxs(left_expr_ctxs), _right_expr_ctxs(right_expr_ctxs) {
+    DCHECK(is_supported_join_op(join_op));
+    DCHECK_EQ(left_expr_ctxs.size(), right_expr_ctxs.size());
+    for (const auto* tuple_desc : left_row_desc.tuple_descriptors()) {
+        for (auto* slot : tuple_desc->slots()) {
+            _left_slots.emplace_back(slot);
+        }
+    }
+    if (_join_op == TJoinOp::INNER_JOIN || _join_op == TJoinOp::LEFT_OUTER_JOIN) {
+        for (const auto* tuple_desc : right_row_desc.tuple_descriptors()) {
+            for (auto* slot : tuple_desc->slots()) {
+                _right_slots.emplace_back(slot);
+            }
+        }
+    }
+}
+
+Status MergeJoiner::_evaluate_keys(const std::vector<ExprContext*>& expr_ctxs, Chunk* chunk, Columns* keys) {
+    keys->clear();
+    for (auto* ctx : expr_ctxs) {
+        ASSIGN_OR_RETURN(ColumnPtr key, ctx->evaluate(chunk));
+        keys->emplace_back(ColumnHelper::unpack_and_duplicate_const_column(chunk->num_rows(), key));
+    }
+    return Status::OK();
+}
+
+Status MergeJoiner::push_left(RuntimeState* state, const ChunkPtr& chunk) {
+    if (chunk == nullptr || chunk->is_empty()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_evaluate_keys(_left_expr_ctxs, chunk.get(), &_left_keys));
+    _left_chunk = chunk;
+    _left_row = 0;
+    _run_offset = 0;
+    return Status::OK();
+}
+
+Status MergeJoiner::push_right(RuntimeState* state, const ChunkPtr& chunk) {
+    if (chunk == nullptr || chunk->is_empty()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_evaluate_keys(_right_expr_ctxs, chunk.get(), &_right_keys));
+    _right_chunk = chunk;
+    _right_row = 0;
+    _need_right = false;
+    return Status::OK();
+}
+
+bool MergeJoiner::_has_null(const Columns& keys, size_t row) {
+    return std::any_of(keys.begin(), keys.end(), [row](const ColumnPtr& key) { return key->is_null(row); });
+}
+
+int MergeJoiner::_compare(const Columns& lhs, size_t lhs_row, const Columns& rhs, size_t rhs_row) {
+    // The null keys never reach here, so only the data columns are compared.
+    for (size_t i = 0; i < lhs.size(); i++) {
+        const Column* lhs_data = ColumnHelper::get_data_column(lhs[i].get());
+        const Column* rhs_data = ColumnHelper::get_data_column(rhs[i].get());
+        int cmp = lhs_data->compare_at(lhs_row, rhs_row, *rhs_data, 1);
+        if (cmp != 0) {
+            return cmp;
+        }
+    }
+    return 0;
+}
+
+void MergeJoiner::_start_run() {
+    _run_chunk = _right_chunk->clone_empty_with_slot();
+    _run_keys.clear();
+    for (const auto& key : _right_keys) {
+        ColumnPtr run_key = key->clone_empty();
+        run_key->append(*key, _right_row, 1);
+        _run_keys.emplace_back(std::move(run_key));
+    }
+    _has_run = true;
+    _run_complete = false;
+    _run_offset = 0;
+}
+
+bool MergeJoiner::_extend_run() {
+    while (!_is_right_exhausted()) {
+        const size_t num_rows = _right_chunk->num_rows();
+        size_t end = _right_row;
+        // Null keys are sorted first, so they never appear after a run.
+        while (end < num_rows && _compare(_right_keys, end, _run_keys, 0) == 0) {
+            ++end;
+        }
+        _run_chunk->append(*_right_chunk, _right_row, end - _right_row);
+        _right_row = end;
+        if (end < num_rows) {
+            _run_complete = true;
+            return true;
+        }
+    }
+    if (_right_eos) {
+        _run_complete = true;
+        return true;
+    }
+    return false;
+}
+
+ChunkPtr MergeJoiner::_create_output_chunk(size_t capacity) const {
+    auto chunk = std::make_shared<Chunk>();
+    for (auto* slot : _left_slots) {
+        bool nullable = slot->is_nullable() || _left_chunk->get_column_by_slot_id(slot->id())->is_nullable();
+        chunk->append_column(ColumnHelper::create_column(slot->type(), nullable), slot->id());
+    }
+    for (auto* slot : _right_slots) {
+        bool nullable = slot->is_nullable() || _join_op == TJoinOp::LEFT_OUTER_JOIN ||
+                        (_right_chunk != nullptr && _right_chunk->get_column_by_slot_id(slot->id())->is_nullable()) ||
+                        (_run_chunk != nullptr && _run_chunk->get_column_by_slot_id(slot->id())->is_nullable());
+        chunk->append_column(ColumnHelper::create_column(slot->type(), nullable), slot->id());
+    }
+    chunk->reserve(capacity);
+    return chunk;
+}
+
+void MergeJoiner::_append_left_row(Chunk* output, size_t count) {
+    for (auto* slot : _left_slots) {
+        const ColumnPtr& src = _left_chunk->get_column_by_slot_id(slot->id());
+        output->get_column_by_slot_id(slot->id())->append_value_multiple_times(*src, _left_row, count);
+    }
+}
+
+void MergeJoiner::_append_matched_rows(Chunk* output, size_t count) {
+    _append_left_row(output, count);
+    for (auto* slot : _right_slots) {
+        const ColumnPtr& src = _run_chunk->get_column_by_slot_id(slot->id());
+        output->get_column_by_slot_id(slot->id())->append(*src, _run_offset, count);
+    }
+}
+
+void MergeJoiner::_append_unmatched_row(Chunk* output) {
+    if (_join_op == TJoinOp::LEFT_OUTER_JOIN) {
+        _append_left_row(output, 1);
+        for (auto* slot : _right_slots) {
+            output->get_column_by_slot_id(slot->id())->append_nulls(1);
+        }
+    } else if (_join_op == TJoinOp::LEFT_ANTI_JOIN) {
+        _append_left_row(output, 1);
+    }
+}
+
+void MergeJoiner::_next_left_row() {
+    ++_left_row;
+    _run_offset = 0;
+}
+
+Status MergeJoiner::pull(RuntimeState* state, ChunkPtr* chunk) {
+    const size_t capacity = state->chunk_size();
+    if (_left_chunk == nullptr) {
+        *chunk = nullptr;
+        return Status::OK();
+    }
+    *chunk = _create_output_chunk(capacity);
+    Chunk* output = chunk->get();
+
+    while (output->num_rows() < capacity) {
+        if (_left_row >= _left_chunk->num_rows()) {
+            _left_chunk = nullptr;
+            _left_keys.clear();
+            break;
+        }
+        // Null never equals to anything.
+        if (_has_null(_left_keys, _left_row)) {
+            _append_unmatched_row(output);
+            _next_left_row();
+            continue;
+        }
+
+        if (_has_run && !_run_complete) {
+            if (!_extend_run()) {
+                _need_right = true;
+                break;
+            }
+            continue;
+        }
+
+        if (_has_run) {
+            int cmp = _compare(_left_keys, _left_row, _run_keys, 0);
+            if (cmp == 0) {
+                if (_join_op == TJoinOp::INNER_JOIN || _join_op == TJoinOp::LEFT_OUTER_JOIN) {
+                    size_t count = std::min(_run_chunk->num_rows() - _run_offset, capacity - output->num_rows());
+                    _append_matched_rows(output, count);
+                    _run_offset += count;
+                    if (_run_offset == _run_chunk->num_rows()) {
+                        _next_left_row();
+                    }
+                } else {
+                    if (_join_op == TJoinOp::LEFT_SEMI_JOIN) {
+                        _append_left_row(output, 1);
+                    }
+                    _next_left_row();
+                }
+                continue;
+            }
+            // The left keys are ascending, so the run never matches the following left rows.
+            DCHECK_GT(cmp, 0);
+            _has_run = false;
+            _run_chunk = nullptr;
+            _run_keys.clear();
+            continue;
+        }
+
+        if (_is_right_exhausted()) {
+            if (!_right_eos) {
+                _need_right = true;
+                break;
+            }
+            _append_unmatched_row(output);
+            _next_left_row();
+            continue;
+        }
+        if (_has_null(_right_keys, _right_row)) {
+            ++_right_row;
+            continue;
+        }
+
+        int cmp = _compare(_left_keys, _left_row, _right_keys, _right_row);
+        if (cmp < 0) {
+            _append_unmatched_row(output);
+            _next_left_row();
+        } else if (cmp > 0) {
+            ++_right_row;
+        } else {
+            _start_run();
+        }
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks::vectorized
@@ -0,0 +1,110 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+#include "gen_cpp/PlanNodes_types.h"
+#include "runtime/descriptors.h"
+
+namespace starrocks {
+class ExprContext;
+class RuntimeState;
+
+namespace vectorized {
+
+// MergeJoiner joins two inputs which are both sorted by the join keys in ascending order with nulls first,
+// by advancing a cursor on each input. Only the right rows sharing the join key of the current left row are
+// buffered, so the memory is bounded by the largest group of equal right keys rather than the whole right input.
+//
+// Supports INNER_JOIN, LEFT_OUTER_JOIN, LEFT_SEMI_JOIN and LEFT_ANTI_JOIN. The other join conjuncts and the
+// conjuncts of the join node are evaluated by the caller on the output chunks, which is only valid for INNER_JOIN.
+//
+// The caller drives MergeJoiner like this:
+//   while (!is_finished()) {
+//       if (need_left()) push_left(next left chunk) or set_left_eos();
+//       else if (need_right()) push_right(next right chunk) or set_right_eos();
+//       else pull(&chunk);
+//   }
+class MergeJoiner {
+public:
+    MergeJoiner(TJoinOp::type join_op, const std::vector<ExprContext*>& left_expr_ctxs,
+                const std::vector<ExprContext*>& right_expr_ctxs, const RowDescriptor& left_row_desc,
+                const RowDescriptor& right_row_desc);
+
+    static bool is_supported_join_op(TJoinOp::type join_op) {
+        return join_op == TJoinOp::INNER_JOIN || join_op == TJoinOp::LEFT_OUTER_JOIN ||
+               join_op == TJoinOp::LEFT_SEMI_JOIN || join_op == TJoinOp::LEFT_ANTI_JOIN;
+    }
+
+    // All the rows of the pushed left chunk have been joined.
+    bool need_left() const { return !_left_eos && _left_chunk == nullptr; }
+    // The current left row can't be joined until the next right chunk is pushed.
+    bool need_right() const { return _need_right; }
+    bool is_finished() const { return _left_eos && _left_chunk == nullptr; }
+
+    Status push_left(RuntimeState* state, const ChunkPtr& chunk);
+    Status push_right(RuntimeState* state, const ChunkPtr& chunk);
+    void set_left_eos() { _left_eos = true; }
+    void set_right_eos() {
+        _right_eos = true;
+        _need_right = false;
+    }
+
+    // Join the left rows until the output chunk is full, or more input is needed.
+    // |chunk| may be empty.
+    Status pull(RuntimeState* state, ChunkPtr* chunk);
+
+private:
+    Status _evaluate_keys(const std::vector<ExprContext*>& expr_ctxs, Chunk* chunk, Columns* keys);
+
+    static bool _has_null(const Columns& keys, size_t row);
+    static int _compare(const Columns& lhs, size_t lhs_row, const Columns& rhs, size_t rhs_row);
+
+    bool _is_right_exhausted() const { return _right_chunk == nullptr || _right_row >= _right_chunk->num_rows(); }
+
+    void _start_run();
+    // Append the right rows with the key of the run. Returns false if the next right chunk is needed.
+    bool _extend_run();
+
+    ChunkPtr _create_output_chunk(size_t capacity) const;
+    // Output the current left row joined with run rows in [_run_offset, _run_offset + count).
+    void _append_matched_rows(Chunk* output, size_t count);
+    // Output the current left row with null right columns.
+    void _append_unmatched_row(Chunk* output);
+    void _append_left_row(Chunk* output, size_t count);
+    void _next_left_row();
+
+    const TJoinOp::type _join_op;
+    const std::vector<ExprContext*>& _left_expr_ctxs;
+    const std::vector<ExprContext*>& _right_expr_ctxs;
+    std::vector<SlotDescriptor*> _left_slots;
+    // Empty for semi and anti join.
+    std::vector<SlotDescriptor*> _right_slots;
+
+    ChunkPtr _left_chunk;
+    Columns _left_keys;
+    size_t _left_row = 0;
+    bool _left_eos = false;
+
+    ChunkPtr _right_chunk;
+    Columns _right_keys;
+    size_t _right_row = 0;
+    bool _right_eos = false;
+    bool _need_right = false;
+
+    // The right rows sharing the same key, which is complete once a greater right key or the end of
+    // the right input is seen.
+    ChunkPtr _run_chunk;
+    Columns _run_keys;
+    bool _has_run = false;
+    bool _run_complete = false;
+    // The run rows before _run_offset have been joined with the current left row.
+    size_t _run_offset = 0;
+};
+
+} // namespace vectorized
+} // namespace starrocks
@@ -217,7 +217,7 @@ Status MysqlScanNode::append_text_to_column(const char* data, const int& len, co
     case TYPE_VARCHAR:
     case TYPE_CHAR: {
         Slice value(data, len);
-        dynamic_cast<BinaryColumn*>(data_column)->append(value);
+        down_cast<BinaryColumn*>(data_column)->append(value);
         break;
     }
     case TYPE_BOOLEAN: {
@@ -398,10 +398,21 @@ Status MysqlScanNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos)
     }
 
     *chunk = std::make_shared<Chunk>();
-    std::vector<SlotDescriptor*> slot_descs = _tuple_desc->slots();
-    // init column information
+    const std::vector<SlotDescriptor*>& slot_descs = _tuple_desc->slots();
+    // The fields of a mysql row are the materialized slots in order, their columns are resolved once per chunk
+    // instead of once per field.
+    std::vector<SlotDescriptor*> materialized_slots;
+    std::vector<Column*> materialized_columns;
+    materialized_slots.reserve(_slot_num);
+    materialized_columns.reserve(_slot_num);
     for (auto& slot_desc : slot_descs) {
         ColumnPtr column = ColumnHelper::create_column(slot_desc->type(), slot_desc->is_nullable());
+        column->reserve(runtime_state()->chunk_size());
+        // because the fe planner filter the non_materialize column
+        if (slot_desc->is_materialized()) {
+            materialized_slots.push_back(slot_desc);
+            materialized_columns.push_back(column.get());
+        }
         (*chunk)->append_column(std::move(column), slot_desc->id());
     }
 
@@ -442,19 +453,10 @@ Status MysqlScanNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos)
 
         ++row_num;
 
-        int materialized_col_idx = -1;
-        for (size_t col_idx = 0; col_idx < _slot_num; ++col_idx) {
-            SlotDescriptor* slot_desc = slot_descs[col_idx];
-            ColumnPtr column = (*chunk)->get_column_by_slot_id(slot_desc->id());
-
-            // because the fe planner filter the non_materialize column
-            if (!slot_desc->is_materialized()) {
-                continue;
-            }
-
-            ++materialized_col_idx;
-
-            if (data[materialized_col_idx] == nullptr) {
+        for (size_t i = 0; i < materialized_slots.size(); ++i) {
+            SlotDescriptor* slot_desc = materialized_slots[i];
+            Column* column = materialized_columns[i];
+            if (data[i] == nullptr) {
                 if (slot_desc->is_nullable()) {
                     column->append_nulls(1);
                 } else {
@@ -463,8 +465,7 @@ Status MysqlScanNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos)
                     return Status::InternalError(ss.str());
                 }
             } else {
-                RETURN_IF_ERROR(append_text_to_column(data[materialized_col_idx], length[materialized_col_idx],
-                                                      slot_desc, column.get()));
+                RETURN_IF_ERROR(append_text_to_column(data[i], length[i], slot_desc, column));
             }
         }
 
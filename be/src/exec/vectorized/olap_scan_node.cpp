@@ -387,6 +387,8 @@ void OlapScanNode::_init_counter(RuntimeState* state) {
     _bi_filter_timer = ADD_CHILD_TIMER(_scan_profile, "BitmapIndexFilter", "SegmentInit");
     _bi_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "BitmapIndexFilterRows", TUnit::UNIT, "SegmentInit");
     _bf_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "BloomFilterFilterRows", TUnit::UNIT, "SegmentInit");
+    _ngram_index_filtered_counter =
+            ADD_CHILD_COUNTER(_scan_profile, "NGramIndexFilterRows", TUnit::UNIT, "SegmentInit");
     _seg_zm_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "SegmentZoneMapFilterRows", TUnit::UNIT, "SegmentInit");
     _zm_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "ZoneMapIndexFilterRows", TUnit::UNIT, "SegmentInit");
     _sk_filtered_counter = ADD_CHILD_COUNTER(_scan_profile, "ShortKeyFilterRows", TUnit::UNIT, "SegmentInit");
@@ -641,6 +643,17 @@ void OlapScanNode::_close_pending_scanners() {
     }
 }
 
+bool OlapScanNode::absorb_conjuncts(std::vector<ExprContext*>* conjunct_ctxs) {
+    // The conjuncts above a scan with limit must be evaluated after the limit. And the conjuncts above a
+    // scan with global dicts may refer to the encoded columns, while the scan only rewrites its own ones.
+    if (limit() != -1 || !_olap_scan_node.dict_string_id_to_int_ids.empty()) {
+        return false;
+    }
+    _conjunct_ctxs.insert(_conjunct_ctxs.end(), conjunct_ctxs->begin(), conjunct_ctxs->end());
+    conjunct_ctxs->clear();
+    return true;
+}
+
 pipeline::OpFactories OlapScanNode::decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
     auto factory = std::make_shared<pipeline::OlapScanOperatorFactory>(context->next_operator_id(), this);
     return pipeline::decompose_scan_node_to_pipeline(factory, this, context);
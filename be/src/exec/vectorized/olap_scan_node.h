@@ -12,6 +12,7 @@
 #include "exec/scan_node.h"
 #include "exec/vectorized/olap_scan_prepare.h"
 #include "exec/vectorized/tablet_scanner.h"
+#include "exec/vectorized/topn_runtime_filter.h"
 
 namespace starrocks {
 class DescriptorTbl;
@@ -64,6 +65,18 @@ public:
 
     const TOlapScanNode& thrift_olap_scan_node() const { return _olap_scan_node; }
 
+    // Take over the conjuncts of the select node right above the scan, which are not prepared yet, so they
+    // are evaluated by the scan instead of a separate operator, and the ones on the storage columns are
+    // pushed down to the storage. Returns false and leaves |conjunct_ctxs| untouched if it's not possible.
+    // Only used by the pipeline engine.
+    bool absorb_conjuncts(std::vector<ExprContext*>* conjunct_ctxs);
+
+    // Set by the top-n sort above the scan in the same fragment, only used by the pipeline engine.
+    void set_topn_runtime_filter(std::shared_ptr<TopnRuntimeFilter> topn_filter) {
+        _topn_filter = std::move(topn_filter);
+    }
+    const TopnRuntimeFilter* topn_runtime_filter() const { return _topn_filter.get(); }
+
 private:
     friend class TabletScanner;
 
@@ -121,6 +134,7 @@ private:
     size_t _scanner_concurrency();
 
     TOlapScanNode _olap_scan_node;
+    std::shared_ptr<TopnRuntimeFilter> _topn_filter;
     std::vector<std::unique_ptr<TInternalScanRange>> _scan_ranges;
     RuntimeState* _runtime_state = nullptr;
     TupleDescriptor* _tuple_desc = nullptr;
@@ -177,6 +191,7 @@ private:
     RuntimeProfile::Counter* _seg_zm_filtered_counter = nullptr;
     RuntimeProfile::Counter* _zm_filtered_counter = nullptr;
     RuntimeProfile::Counter* _bf_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _ngram_index_filtered_counter = nullptr;
     RuntimeProfile::Counter* _sk_filtered_counter = nullptr;
     RuntimeProfile::Counter* _block_seek_timer = nullptr;
     RuntimeProfile::Counter* _block_seek_counter = nullptr;
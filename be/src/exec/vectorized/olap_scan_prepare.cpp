@@ -380,9 +380,11 @@ void OlapScanConjunctsManager::normalize_join_runtime_filter(const SlotDescripto
         SlotId slot_id;
 
         // runtime filter existed and does not have null.
-        if (rf == nullptr || rf->has_null()) continue;
+        if (rf == nullptr) continue;
         // probe expr is slot ref and slot id matches.
         if (!desc->is_probe_slot_ref(&slot_id) || slot_id != slot.id()) continue;
+        visited_runtime_filters.insert(it.first);
+        if (rf->has_null()) continue;
 
         const RuntimeBloomFilter<SlotType>* filter = down_cast<const RuntimeBloomFilter<SlotType>*>(rf);
         // For some cases such as in bucket shuffle, some hash join node may not have any input chunk from right table.
@@ -401,6 +403,17 @@ void OlapScanConjunctsManager::normalize_join_runtime_filter(const SlotDescripto
         SQLFilterOp max_op = to_olap_filter_type(TExprOpcode::LE, false);
         ValueType max_value = filter->max_value();
         range->add_range(max_op, static_cast<RangeValueType>(max_value));
+
+        // the exact values of dense integers are pushed down as an in predicate.
+        if constexpr (RuntimeBloomFilter<SlotType>::can_use_bitset) {
+            if (filter->has_bitset() && filter->bitset().count() <= config::max_pushdown_conditions_per_column) {
+                std::set<RangeValueType> values;
+                filter->bitset().for_each([&values](int64_t value) {
+                    values.insert(static_cast<RangeValueType>(static_cast<ValueType>(value)));
+                });
+                range->add_fixed_values(FILTER_IN, values);
+            }
+        }
     }
 }
 
@@ -532,6 +545,67 @@ struct ColumnRangeBuilder {
     }
 };
 
+struct RuntimeFilterConditionBuilder {
+    template <PrimitiveType ptype>
+    std::nullptr_t operator()(const JoinRuntimeFilter* rf, const SlotDescriptor* slot,
+                              std::vector<TCondition>* conditions) {
+        // The string columns are skipped, whose predicates need to be rewritten for the global dictionary.
+        if constexpr (ptype == TYPE_TIME || ptype == TYPE_NULL || ptype == TYPE_JSON || pt_is_float<ptype> ||
+                      pt_is_binary<ptype>) {
+            return nullptr;
+        } else {
+            // Treat tinyint and boolean as int
+            constexpr PrimitiveType limit_type = ptype == TYPE_TINYINT || ptype == TYPE_BOOLEAN ? TYPE_INT : ptype;
+            using value_type = typename RunTimeTypeLimits<limit_type>::value_type;
+
+            const auto* filter = down_cast<const RuntimeBloomFilter<ptype>*>(rf);
+            if (!filter->has_min_max()) {
+                return nullptr;
+            }
+            const TypeDescriptor& type = slot->type();
+            auto add_condition = [&](const char* op, value_type value) {
+                TCondition condition;
+                condition.__set_is_index_filter_only(true);
+                condition.__set_column_name(slot->col_name());
+                condition.__set_condition_op(op);
+                condition.condition_values.push_back(cast_to_string(value, ptype, type.precision, type.scale));
+                conditions->emplace_back(std::move(condition));
+            };
+            add_condition(">=", static_cast<value_type>(filter->min_value()));
+            add_condition("<=", static_cast<value_type>(filter->max_value()));
+            return nullptr;
+        }
+    }
+};
+
+bool OlapScanConjunctsManager::has_pending_runtime_filters() const {
+    return runtime_filters != nullptr && visited_runtime_filters.size() < runtime_filters->size();
+}
+
+void OlapScanConjunctsManager::get_late_runtime_filter_conditions(std::vector<TCondition>* conditions) {
+    if (runtime_filters == nullptr) {
+        return;
+    }
+    for (const auto& [filter_id, desc] : runtime_filters->descriptors()) {
+        const JoinRuntimeFilter* rf = desc->runtime_filter();
+        if (rf == nullptr || visited_runtime_filters.count(filter_id) > 0) {
+            continue;
+        }
+        visited_runtime_filters.insert(filter_id);
+        SlotId slot_id;
+        if (rf->has_null() || !desc->is_probe_slot_ref(&slot_id)) {
+            continue;
+        }
+        for (const SlotDescriptor* slot : tuple_desc->decoded_slots()) {
+            if (slot->id() == slot_id) {
+                type_dispatch_predicate<std::nullptr_t>(slot->type().type, false, RuntimeFilterConditionBuilder(),
+                                                        rf, slot, conditions);
+                break;
+            }
+        }
+    }
+}
+
 Status OlapScanConjunctsManager::normalize_conjuncts() {
     // Note: _normalized_conjuncts size must be equal to _conjunct_ctxs size,
     // but HashJoinNode will push down predicate to OlapScanNode's _conjunct_ctxs,
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <set>
+
 #include "common/status.h"
 #include "exec/olap_common.h"
 #include "exprs/expr.h"
@@ -34,6 +36,7 @@ private:
     std::vector<TCondition> olap_filters;                             // from _column_value_ranges
     std::vector<TCondition> is_null_vector;                           // from conjunct_ctxs
     std::map<int, std::vector<ExprContext*>> slot_index_to_expr_ctxs; // from conjunct_ctxs
+    std::set<int32_t> visited_runtime_filters;                        // ids of the arrived runtime filters
 
 public:
     static Status eval_const_conjuncts(const std::vector<ExprContext*>& conjunct_ctxs, Status* status);
@@ -42,6 +45,14 @@ public:
 
     Status get_key_ranges(std::vector<std::unique_ptr<OlapScanRange>>* key_ranges);
 
+    // Whether some join runtime filters have not arrived when the conjuncts were parsed or the last call of
+    // `get_late_runtime_filter_conditions`.
+    bool has_pending_runtime_filters() const;
+
+    // Get the conditions of the min/max values of the join runtime filters arrived after the conjuncts were
+    // parsed. The conditions are index filter only, i.e. they are only used to prune the rows by the indexes.
+    void get_late_runtime_filter_conditions(std::vector<TCondition>* conditions);
+
     void get_not_push_down_conjuncts(std::vector<ExprContext*>* predicates);
 
     Status parse_conjuncts(bool scan_keys_unlimited, int32_t max_scan_key_num,
@@ -2,6 +2,7 @@
 
 #include "exec/vectorized/project_node.h"
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <set>
@@ -12,6 +13,7 @@
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/global_types.h"
 #include "common/status.h"
 #include "exec/pipeline/limit_operator.h"
@@ -20,6 +22,7 @@
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
 #include "exprs/vectorized/column_ref.h"
+#include "exprs/vectorized/common_sub_expr.h"
 #include "glog/logging.h"
 #include "gutil/casts.h"
 #include "runtime/current_thread.h"
@@ -50,19 +53,44 @@ Status ProjectNode::init(const TPlanNode& tnode, RuntimeState* state) {
         slot_null_mapping[slot->id()] = slot->is_nullable();
     }
 
+    std::vector<TExpr> exprs;
+    exprs.reserve(column_size);
     for (auto const& [key, val] : tnode.project_node.slot_map) {
         _slot_ids.emplace_back(key);
-        ExprContext* context;
-        RETURN_IF_ERROR(Expr::create_expr_tree(_pool, val, &context));
-        _expr_ctxs.emplace_back(context);
+        exprs.emplace_back(val);
         _type_is_nullable.emplace_back(slot_null_mapping[key]);
     }
+    std::vector<std::pair<SlotId, TExpr>> common_exprs(tnode.project_node.common_slot_map.begin(),
+                                                       tnode.project_node.common_slot_map.end());
+
+    if (config::enable_project_common_sub_expr_elimination) {
+        // The extracted expressions are put in the slots after all the slots of the query.
+        SlotId max_slot_id = 0;
+        std::vector<TupleDescriptor*> tuple_descs;
+        state->desc_tbl().get_tuple_descs(&tuple_descs);
+        for (const auto* tuple_desc : tuple_descs) {
+            for (const auto* slot : tuple_desc->slots()) {
+                max_slot_id = std::max(max_slot_id, slot->id());
+            }
+        }
+        for (SlotId slot_id : _slot_ids) {
+            max_slot_id = std::max(max_slot_id, slot_id);
+        }
+        for (const auto& [slot_id, expr] : common_exprs) {
+            max_slot_id = std::max(max_slot_id, slot_id);
+        }
+        extract_common_sub_exprs(&exprs, &common_exprs, max_slot_id + 1, _tuple_ids[0]);
+    }
 
-    size_t common_sub_column_size = tnode.project_node.common_slot_map.size();
-    _common_sub_expr_ctxs.reserve(common_sub_column_size);
-    _common_sub_slot_ids.reserve(common_sub_column_size);
+    for (const auto& expr : exprs) {
+        ExprContext* context;
+        RETURN_IF_ERROR(Expr::create_expr_tree(_pool, expr, &context));
+        _expr_ctxs.emplace_back(context);
+    }
 
-    for (auto const& [key, val] : tnode.project_node.common_slot_map) {
+    _common_sub_expr_ctxs.reserve(common_exprs.size());
+    _common_sub_slot_ids.reserve(common_exprs.size());
+    for (auto const& [key, val] : common_exprs) {
         ExprContext* context;
         RETURN_IF_ERROR(Expr::create_expr_tree(_pool, val, &context));
         _common_sub_slot_ids.emplace_back(key);
@@ -190,6 +218,21 @@ Status ProjectNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
     return Status::OK();
 }
 
+SlotId ProjectNode::get_child_slot(SlotId slot_id) const {
+    for (size_t i = 0; i < _slot_ids.size(); ++i) {
+        if (_slot_ids[i] != slot_id) {
+            continue;
+        }
+        auto* column_ref = dynamic_cast<ColumnRef*>(_expr_ctxs[i]->root());
+        if (column_ref == nullptr || std::find(_common_sub_slot_ids.begin(), _common_sub_slot_ids.end(),
+                                               column_ref->slot_id()) != _common_sub_slot_ids.end()) {
+            return -1;
+        }
+        return column_ref->slot_id();
+    }
+    return -1;
+}
+
 Status ProjectNode::reset(RuntimeState* state) {
     RETURN_IF_ERROR(ExecNode::reset(state));
     return Status::OK();
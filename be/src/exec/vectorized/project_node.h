@@ -18,6 +18,9 @@ public:
     Status open(RuntimeState* state) override;
     Status prepare(RuntimeState* state) override;
     Status get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) override;
+
+    // Returns the slot of the child which the output slot |slot_id| refers to, or -1 if it's computed.
+    SlotId get_child_slot(SlotId slot_id) const;
     Status reset(RuntimeState* state) override;
     Status close(RuntimeState* state) override;
 
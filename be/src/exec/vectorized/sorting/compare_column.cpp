@@ -228,7 +228,11 @@ public:
     Status do_visit(const vectorized::BinaryColumnBase<T>& column) {
         auto& data = column.get_data();
         for (size_t i = 1; i < column.size(); i++) {
-            (*_tie)[i] &= SorterComparator<Slice>::compare(data[i - 1], data[i]) == 0;
+            // Only compare the rows still tied with the previous ones, the sorted keys are usually long runs
+            // broken by the previous columns.
+            if ((*_tie)[i]) {
+                (*_tie)[i] = data[i - 1] == data[i];
+            }
         }
         return Status::OK();
     }
@@ -236,13 +240,21 @@ public:
     template <typename T>
     Status do_visit(const vectorized::FixedLengthColumnBase<T>& column) {
         auto& data = column.get_data();
-        for (size_t i = 1; i < column.size(); i++) {
-            (*_tie)[i] &= SorterComparator<T>::compare(data[i - 1], data[i]) == 0;
+        if constexpr (std::is_floating_point_v<T>) {
+            for (size_t i = 1; i < column.size(); i++) {
+                (*_tie)[i] &= SorterComparator<T>::compare(data[i - 1], data[i]) == 0;
+            }
+        } else {
+            // Branchless so that the compiler could vectorize it.
+            for (size_t i = 1; i < column.size(); i++) {
+                (*_tie)[i] &= static_cast<uint8_t>(data[i - 1] == data[i]);
+            }
         }
         return Status::OK();
     }
 
-    Status do_visit(const vectorized::ConstColumn& column) { return Status::NotSupported("not support"); }
+    // All the rows are a single run of the same value.
+    Status do_visit(const vectorized::ConstColumn& column) { return Status::OK(); }
     Status do_visit(const vectorized::ArrayColumn& column) { return Status::NotSupported("not support"); }
     template <typename T>
     Status do_visit(const vectorized::ObjectColumn<T>& column) {
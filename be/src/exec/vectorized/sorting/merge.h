@@ -24,6 +24,9 @@ struct SortedRun {
     SortedRun(ChunkPtr ichunk, size_t start, size_t end)
             : chunk(ichunk), orderby(ichunk->columns()), range(start, end) {}
     SortedRun(const SortedRun& rhs) : chunk(rhs.chunk), orderby(rhs.orderby), range(rhs.range) {}
+    // The slice [start, end) of |rhs|
+    SortedRun(const SortedRun& rhs, size_t start, size_t end)
+            : chunk(rhs.chunk), orderby(rhs.orderby), range(start, end) {}
     SortedRun& operator=(const SortedRun& rhs) {
         if (&rhs == this) return *this;
         chunk = rhs.chunk;
@@ -58,9 +61,10 @@ struct SortedRun {
         DCHECK_LT(lhs_row, range.second);
         DCHECK_LT(rhs_row, rhs.range.second);
         for (int i = 0; i < orderby.size(); i++) {
-            int x = get_column(i)->compare_at(lhs_row, rhs_row, *rhs.get_column(i), desc.get_column_desc(i).null_first);
+            SortDesc column_desc = desc.get_column_desc(i);
+            int x = get_column(i)->compare_at(lhs_row, rhs_row, *rhs.get_column(i), column_desc.null_first);
             if (x != 0) {
-                return x;
+                return x * column_desc.sort_order;
             }
         }
         return 0;
@@ -136,6 +140,64 @@ private:
     std::unique_ptr<SimpleChunkSortCursor> _root_cursor;
 };
 
+// Merge the sorted streams of multiple suppliers by a loser tree, in a non-blocking way.
+// Instead of outputting one row per tree operation, the winner stream outputs all its buffered rows which are
+// not greater than the head row of the runner-up stream at once. The range is found by the exponential search,
+// so it costs O(log(k) + log(n)) comparisons per range rather than O(log(k)) per row, and the rows are copied
+// column by column.
+class LoserTreeMerger {
+public:
+    LoserTreeMerger(const SortDescs& sort_desc, const std::vector<ExprContext*>* sort_exprs, size_t chunk_size);
+
+    Status init(const ChunkProbeSuppliers& chunk_probe_suppliers, const ChunkHasSuppliers& chunk_has_suppliers);
+
+    // Whether get_next() can make progress without waiting for data.
+    bool is_data_ready();
+    bool is_eos() const { return _eos; }
+
+    // Return the merged rows up to chunk_size, or nullptr if there is no row until more data arrives.
+    StatusOr<ChunkUniquePtr> get_next();
+
+private:
+    struct Source {
+        ChunkProbeSupplier probe_supplier;
+        ChunkHasSupplier has_supplier;
+        ChunkPtr chunk;
+        Columns orderby;
+        size_t pos = 0;
+        bool finished = false;
+
+        bool has_rows() const { return chunk != nullptr && pos < chunk->num_rows(); }
+    };
+
+    // Load the next non-empty chunk of |source| if it's arrived.
+    // Return false if the source has no buffered rows and it's not finished.
+    StatusOr<bool> _fetch(Source* source);
+    // Whether the head row of source |lhs| is before the one of source |rhs|.
+    bool _less(int lhs, int rhs) const;
+    int _compare_row(const Source& lhs, size_t lhs_row, const Source& rhs, size_t rhs_row) const;
+    // Return the end of the rows of source |winner| which are not greater than the head row of |runner_up|.
+    size_t _upper_bound(const Source& winner, const Source& runner_up) const;
+
+    int _build(int node);
+    void _replay(int source);
+    // The smallest source except the winner, which must have lost to the winner on its path.
+    int _runner_up() const;
+
+    const SortDescs _sort_desc;
+    const std::vector<ExprContext*>* _sort_exprs;
+    const size_t _chunk_size;
+
+    std::vector<Source> _sources;
+    // _losers[0] is the winner, _losers[i] is the loser of the internal node i, and the leaf of source i is
+    // the node i + num_sources.
+    std::vector<int> _losers;
+    bool _is_tree_built = false;
+    // The winner whose rows are all consumed, the tree is replayed after its next chunk arrives.
+    int _pending_source = -1;
+    bool _eos = false;
+};
+
 class SimpleChunkSortCursor;
 
 // ColumnWise Merge algorithms
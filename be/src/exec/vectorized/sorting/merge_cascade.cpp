@@ -17,13 +17,6 @@ struct CursorAlgo {
         return left.compare_row(desc, right, lhs_tail, rhs_tail);
     }
 
-    static void trim_permutation(SortedRun left, SortedRun right, Permutation& perm) {
-        size_t start = left.range.first + right.range.first;
-        size_t end = left.range.second + right.range.second;
-        std::copy(perm.begin() + start, perm.begin() + end, perm.begin());
-        perm.resize(end - start);
-    }
-
     // Find upper_bound in left column based on right row
     static size_t upper_bound(SortDesc desc, const Column& column, std::pair<size_t, size_t> range,
                               const Column& rhs_column, size_t rhs_row) {
@@ -72,7 +65,8 @@ struct CursorAlgo {
             size_t lower = lower_bound(desc, lhs_col, search_range, rhs_col, cut.second);
             size_t upper = upper_bound(desc, lhs_col, search_range, rhs_col, cut.second);
             res = upper;
-            if (upper - lower <= 1) {
+            // no row equals to the cut row in this column, the following columns needn't to be compared
+            if (upper == lower) {
                 break;
             }
             search_range = {lower, upper};
@@ -119,7 +113,8 @@ bool MergeTwoCursor::is_data_ready() {
 }
 
 bool MergeTwoCursor::is_eos() {
-    return _left_cursor->is_eos() && _right_cursor->is_eos();
+    // the rows fetched from cursors but not merged yet are kept in runs
+    return _left_run.empty() && _right_run.empty() && _left_cursor->is_eos() && _right_cursor->is_eos();
 }
 
 StatusOr<ChunkUniquePtr> MergeTwoCursor::next() {
@@ -152,15 +147,14 @@ StatusOr<ChunkUniquePtr> MergeTwoCursor::merge_sorted_cursor_two_way() {
         int tail_cmp = CursorAlgo::compare_tail(sort_desc, _left_run, _right_run);
         if (tail_cmp <= 0) {
             // Cutoff right by left tail
-            size_t right_cut =
-                    CursorAlgo::cutoff_run(sort_desc, _right_run, std::make_pair(_left_run, _left_run.num_rows() - 1));
-            SortedRun right_1(_right_run.chunk, 0, right_cut);
-            SortedRun right_2(_right_run.chunk, right_cut, _right_run.num_rows());
+            size_t right_cut = CursorAlgo::cutoff_run(sort_desc, _right_run,
+                                                      std::make_pair(_left_run, _left_run.range.second - 1));
+            SortedRun right_1(_right_run, _right_run.range.first, right_cut);
+            SortedRun right_2(_right_run, right_cut, _right_run.range.second);
 
             // Merge partial chunk
             Permutation perm;
             RETURN_IF_ERROR(merge_sorted_chunks_two_way(sort_desc, _left_run, right_1, &perm));
-            CursorAlgo::trim_permutation(_left_run, right_1, perm);
             DCHECK_EQ(_left_run.num_rows() + right_1.num_rows(), perm.size());
             ChunkUniquePtr merged = _left_run.chunk->clone_empty(perm.size());
             append_by_permutation(merged.get(), {_left_run.chunk, right_1.chunk}, perm);
@@ -170,15 +164,14 @@ StatusOr<ChunkUniquePtr> MergeTwoCursor::merge_sorted_cursor_two_way() {
             result = std::move(merged);
         } else {
             // Cutoff left by right tail
-            size_t left_cut =
-                    CursorAlgo::cutoff_run(sort_desc, _left_run, std::make_pair(_right_run, _right_run.num_rows() - 1));
-            SortedRun left_1(_left_run.chunk, 0, left_cut);
-            SortedRun left_2(_left_run.chunk, left_cut, _left_run.num_rows());
+            size_t left_cut = CursorAlgo::cutoff_run(sort_desc, _left_run,
+                                                     std::make_pair(_right_run, _right_run.range.second - 1));
+            SortedRun left_1(_left_run, _left_run.range.first, left_cut);
+            SortedRun left_2(_left_run, left_cut, _left_run.range.second);
 
             // Merge partial chunk
             Permutation perm;
             RETURN_IF_ERROR(merge_sorted_chunks_two_way(sort_desc, _right_run, left_1, &perm));
-            CursorAlgo::trim_permutation(left_1, _right_run, perm);
             DCHECK_EQ(_right_run.num_rows() + left_1.num_rows(), perm.size());
             std::unique_ptr<Chunk> merged = _left_run.chunk->clone_empty(perm.size());
             append_by_permutation(merged.get(), {_right_run.chunk, left_1.chunk}, perm);
@@ -187,12 +180,6 @@ StatusOr<ChunkUniquePtr> MergeTwoCursor::merge_sorted_cursor_two_way() {
             _right_run.reset();
             result = std::move(merged);
         }
-
-#ifndef NDEBUG
-        for (int i = 0; i < result->num_rows(); i++) {
-            fmt::print("merge row: {}\n", result->debug_row(i));
-        }
-#endif
     }
 
     return result;
@@ -29,15 +29,18 @@ struct EqualRange {
 // MergeTwoColumn incremental merge two columns
 class MergeTwoColumn final : public ColumnVisitorAdapter<MergeTwoColumn> {
 public:
+    // |output_offset| is the sum of the first row of the left range and the right range, which is
+    // the index of the first output row in |perm|.
     MergeTwoColumn(SortDesc desc, const Column* left_col, const Column* right_col, std::vector<EqualRange>* equal_range,
-                   Permutation* perm)
+                   Permutation* perm, size_t output_offset)
             : ColumnVisitorAdapter(this),
               _sort_order(desc.sort_order),
               _null_first(desc.null_first),
               _left_col(left_col),
               _right_col(right_col),
               _equal_ranges(equal_range),
-              _perm(perm) {}
+              _perm(perm),
+              _output_offset(output_offset) {}
 
     template <class Cmp, class LeftEqual, class RightEqual>
     Status do_merge(Cmp cmp, LeftEqual equal_left, RightEqual equal_right) {
@@ -50,7 +53,7 @@ public:
             size_t rhs = equal_range.right_range.first;
             size_t lhs_end = equal_range.left_range.second;
             size_t rhs_end = equal_range.right_range.second;
-            size_t output_index = lhs + rhs;
+            size_t output_index = lhs + rhs - _output_offset;
 
             // Merge rows in the equal-range
             auto left_range = fetch_equal(lhs, lhs_end, equal_left);
@@ -174,6 +177,7 @@ private:
     const Column* _right_col;
     std::vector<EqualRange>* _equal_ranges;
     Permutation* _perm;
+    const size_t _output_offset;
 };
 
 // MergeTwoChunk merge two chunk in column-wise
@@ -232,14 +236,15 @@ public:
             } else {
                 std::vector<EqualRange> equal_ranges;
                 equal_ranges.emplace_back(left_run.range, right_run.range);
-                size_t count = left_run.range.second + right_run.range.second;
+                size_t count = left_run.num_rows() + right_run.num_rows();
                 output->resize(count);
                 equal_ranges.reserve(std::max((size_t)1, count / 4));
 
                 for (int col = 0; col < sort_desc.num_columns(); col++) {
                     const Column* left_col = left_run.get_column(col);
                     const Column* right_col = right_run.get_column(col);
-                    MergeTwoColumn merge2(sort_desc.get_column_desc(col), left_col, right_col, &equal_ranges, output);
+                    MergeTwoColumn merge2(sort_desc.get_column_desc(col), left_col, right_col, &equal_ranges, output,
+                                          left_run.range.first + right_run.range.first);
                     Status st = left_col->accept(&merge2);
                     CHECK(st.ok());
                     if (equal_ranges.size() == 0) {
@@ -0,0 +1,211 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include <algorithm>
+
+#include "column/chunk.h"
+#include "exec/vectorized/sorting/merge.h"
+#include "exprs/expr_context.h"
+
+namespace starrocks::vectorized {
+
+LoserTreeMerger::LoserTreeMerger(const SortDescs& sort_desc, const std::vector<ExprContext*>* sort_exprs,
+                                 size_t chunk_size)
+        : _sort_desc(sort_desc), _sort_exprs(sort_exprs), _chunk_size(chunk_size) {}
+
+Status LoserTreeMerger::init(const ChunkProbeSuppliers& chunk_probe_suppliers,
+                             const ChunkHasSuppliers& chunk_has_suppliers) {
+    DCHECK_EQ(chunk_probe_suppliers.size(), chunk_has_suppliers.size());
+    DCHECK(!chunk_probe_suppliers.empty());
+    _sources.resize(chunk_probe_suppliers.size());
+    for (size_t i = 0; i < _sources.size(); i++) {
+        _sources[i].probe_supplier = chunk_probe_suppliers[i];
+        _sources[i].has_supplier = chunk_has_suppliers[i];
+    }
+    return Status::OK();
+}
+
+bool LoserTreeMerger::is_data_ready() {
+    if (_eos) {
+        return true;
+    }
+    if (!_is_tree_built) {
+        // The tree can't be built until every source has its first row or is finished.
+        return std::all_of(_sources.begin(), _sources.end(), [](Source& source) {
+            return source.finished || source.has_rows() || source.has_supplier();
+        });
+    }
+    if (_pending_source >= 0) {
+        Source& source = _sources[_pending_source];
+        return source.finished || source.has_rows() || source.has_supplier();
+    }
+    return true;
+}
+
+StatusOr<bool> LoserTreeMerger::_fetch(Source* source) {
+    while (!source->has_rows() && !source->finished) {
+        if (!source->has_supplier()) {
+            return false;
+        }
+        Chunk* chunk = nullptr;
+        source->orderby.clear();
+        if (!source->probe_supplier(&chunk) || chunk == nullptr) {
+            source->chunk.reset();
+            source->finished = true;
+            break;
+        }
+        source->chunk.reset(chunk);
+        source->pos = 0;
+        for (ExprContext* expr_ctx : *_sort_exprs) {
+            ASSIGN_OR_RETURN(ColumnPtr column, expr_ctx->evaluate(chunk));
+            source->orderby.push_back(std::move(column));
+        }
+    }
+    return true;
+}
+
+int LoserTreeMerger::_compare_row(const Source& lhs, size_t lhs_row, const Source& rhs, size_t rhs_row) const {
+    for (int i = 0; i < _sort_desc.num_columns(); i++) {
+        SortDesc desc = _sort_desc.get_column_desc(i);
+        int x = lhs.orderby[i]->compare_at(lhs_row, rhs_row, *rhs.orderby[i], desc.null_first);
+        if (x != 0) {
+            return x * desc.sort_order;
+        }
+    }
+    return 0;
+}
+
+bool LoserTreeMerger::_less(int lhs, int rhs) const {
+    const Source& lhs_source = _sources[lhs];
+    const Source& rhs_source = _sources[rhs];
+    // The finished sources are after all the others.
+    if (lhs_source.finished || rhs_source.finished) {
+        return !lhs_source.finished && (rhs_source.finished || lhs < rhs);
+    }
+    int x = _compare_row(lhs_source, lhs_source.pos, rhs_source, rhs_source.pos);
+    return x < 0 || (x == 0 && lhs < rhs);
+}
+
+size_t LoserTreeMerger::_upper_bound(const Source& winner, const Source& runner_up) const {
+    const size_t num_rows = winner.chunk->num_rows();
+    auto not_greater = [&](size_t row) { return _compare_row(winner, row, runner_up, runner_up.pos) <= 0; };
+
+    // The head row of the winner is known to be not greater. Gallop from it, since the interleaved streams
+    // output short ranges, for which a binary search over the whole chunk is wasteful.
+    size_t low = winner.pos + 1;
+    size_t high = low;
+    size_t step = 1;
+    while (high < num_rows && not_greater(high)) {
+        low = high + 1;
+        high = low + step;
+        step *= 2;
+    }
+    high = std::min(high, num_rows);
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (not_greater(mid)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+int LoserTreeMerger::_build(int node) {
+    const int num_sources = _sources.size();
+    if (node >= num_sources) {
+        return node - num_sources;
+    }
+    int left = _build(2 * node);
+    int right = _build(2 * node + 1);
+    if (_less(left, right)) {
+        _losers[node] = right;
+        return left;
+    } else {
+        _losers[node] = left;
+        return right;
+    }
+}
+
+void LoserTreeMerger::_replay(int source) {
+    const int num_sources = _sources.size();
+    int winner = source;
+    for (int node = (source + num_sources) / 2; node >= 1; node /= 2) {
+        if (_less(_losers[node], winner)) {
+            std::swap(_losers[node], winner);
+        }
+    }
+    _losers[0] = winner;
+}
+
+int LoserTreeMerger::_runner_up() const {
+    const int num_sources = _sources.size();
+    int runner_up = -1;
+    for (int node = (_losers[0] + num_sources) / 2; node >= 1; node /= 2) {
+        if (runner_up < 0 || _less(_losers[node], runner_up)) {
+            runner_up = _losers[node];
+        }
+    }
+    return runner_up;
+}
+
+StatusOr<ChunkUniquePtr> LoserTreeMerger::get_next() {
+    if (_eos) {
+        return ChunkUniquePtr();
+    }
+    if (!_is_tree_built) {
+        for (auto& source : _sources) {
+            ASSIGN_OR_RETURN(bool ready, _fetch(&source));
+            if (!ready) {
+                return ChunkUniquePtr();
+            }
+        }
+        _losers.assign(_sources.size(), -1);
+        _losers[0] = _build(1);
+        _is_tree_built = true;
+    }
+    if (_pending_source >= 0) {
+        ASSIGN_OR_RETURN(bool ready, _fetch(&_sources[_pending_source]));
+        if (!ready) {
+            return ChunkUniquePtr();
+        }
+        _replay(_pending_source);
+        _pending_source = -1;
+    }
+
+    ChunkUniquePtr result;
+    size_t num_result_rows = 0;
+    while (num_result_rows < _chunk_size) {
+        const int winner = _losers[0];
+        Source& source = _sources[winner];
+        if (source.finished) {
+            // The winner is finished only if all the sources are finished.
+            _eos = true;
+            break;
+        }
+
+        const int runner_up = _runner_up();
+        size_t end = source.chunk->num_rows();
+        if (runner_up >= 0 && !_sources[runner_up].finished) {
+            end = _upper_bound(source, _sources[runner_up]);
+        }
+        DCHECK_GT(end, source.pos);
+        size_t count = std::min(end - source.pos, _chunk_size - num_result_rows);
+        if (result == nullptr) {
+            result = source.chunk->clone_empty_with_slot(_chunk_size);
+        }
+        result->append(*source.chunk, source.pos, count);
+        source.pos += count;
+        num_result_rows += count;
+
+        ASSIGN_OR_RETURN(bool ready, _fetch(&source));
+        if (!ready) {
+            _pending_source = winner;
+            break;
+        }
+        _replay(winner);
+    }
+    return result;
+}
+
+} // namespace starrocks::vectorized
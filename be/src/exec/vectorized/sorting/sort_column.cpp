@@ -355,6 +355,11 @@ Status sort_and_tie_columns(const bool& cancel, const Columns& columns, const st
         return Status::OK();
     }
     size_t num_rows = columns[0]->size();
+    size_t key_bits = 0;
+    if (num_rows >= kRadixSortMinRows && radix_sort_supported(columns, &key_bits)) {
+        return radix_sort_columns(cancel, columns, sort_orders, null_firsts, key_bits, permutation);
+    }
+
     Tie tie(num_rows, 1);
     std::pair<int, int> range{0, num_rows};
     SmallPermutation small_perm = create_small_permutation(num_rows);
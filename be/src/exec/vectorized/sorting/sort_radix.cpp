@@ -0,0 +1,299 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "column/array_column.h"
+#include "column/binary_column.h"
+#include "column/column.h"
+#include "column/column_visitor_adapter.h"
+#include "column/const_column.h"
+#include "column/fixed_length_column_base.h"
+#include "column/json_column.h"
+#include "column/nullable_column.h"
+#include "column/object_column.h"
+#include "exec/vectorized/sorting/sort_permute.h"
+#include "exec/vectorized/sorting/sorting.h"
+#include "runtime/date_value.h"
+#include "runtime/timestamp_value.h"
+
+namespace starrocks::vectorized {
+
+// The values are normalized into unsigned integers whose order is the order of the values.
+template <typename T, typename = void>
+struct RadixKeyTraits {
+    static constexpr bool supported = false;
+};
+
+template <typename T>
+struct RadixKeyTraits<T, std::enable_if_t<std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t)>> {
+    static constexpr bool supported = true;
+    using Unsigned = std::make_unsigned_t<T>;
+    static Unsigned encode(T value) {
+        if constexpr (std::is_signed_v<T>) {
+            // flip the sign bit, so the negative values are before the positive values.
+            return static_cast<Unsigned>(value) ^ (Unsigned(1) << (sizeof(T) * 8 - 1));
+        } else {
+            return value;
+        }
+    }
+};
+
+template <>
+struct RadixKeyTraits<DateValue> {
+    static constexpr bool supported = true;
+    using Unsigned = uint32_t;
+    static Unsigned encode(DateValue value) { return RadixKeyTraits<JulianDate>::encode(value.julian()); }
+};
+
+template <>
+struct RadixKeyTraits<TimestampValue> {
+    static constexpr bool supported = true;
+    using Unsigned = uint64_t;
+    static Unsigned encode(TimestampValue value) { return RadixKeyTraits<Timestamp>::encode(value.timestamp()); }
+};
+
+// The normalized key of a row is an unsigned integer of N words, words[0] is the most significant.
+template <size_t N>
+struct RadixSortItem {
+    uint64_t words[N];
+    uint32_t index_in_chunk;
+
+    // Shifts the whole key left by |bits| and puts |value| into the lowest bits, 0 < bits <= 64.
+    void shift_in(uint64_t value, int bits) {
+        if (bits == 64) {
+            for (size_t i = 0; i + 1 < N; ++i) {
+                words[i] = words[i + 1];
+            }
+            words[N - 1] = value;
+        } else {
+            for (size_t i = 0; i + 1 < N; ++i) {
+                words[i] = (words[i] << bits) | (words[i + 1] >> (64 - bits));
+            }
+            words[N - 1] = (words[N - 1] << bits) | value;
+        }
+    }
+};
+
+// Gets the bit width of the normalized keys of a column, the column is not supported if the width is not set.
+class RadixKeyWidth final : public ColumnVisitorAdapter<RadixKeyWidth> {
+public:
+    RadixKeyWidth() : ColumnVisitorAdapter(this) {}
+
+    Status do_visit(const vectorized::NullableColumn& column) {
+        // One bit for the null flag.
+        _bits += 1;
+        return column.data_column_ref().accept(this);
+    }
+
+    Status do_visit(const vectorized::ConstColumn& column) {
+        // All the rows are equal.
+        return Status::OK();
+    }
+
+    Status do_visit(const vectorized::ArrayColumn& column) { return _not_supported(); }
+
+    template <typename T>
+    Status do_visit(const vectorized::BinaryColumnBase<T>& column) {
+        return _not_supported();
+    }
+
+    template <typename T>
+    Status do_visit(const vectorized::FixedLengthColumnBase<T>& column) {
+        if constexpr (RadixKeyTraits<T>::supported) {
+            _bits += sizeof(typename RadixKeyTraits<T>::Unsigned) * 8;
+            return Status::OK();
+        } else if constexpr (std::is_same_v<T, int128_t>) {
+            _bits += 128;
+            return Status::OK();
+        } else {
+            return _not_supported();
+        }
+    }
+
+    template <typename T>
+    Status do_visit(const vectorized::ObjectColumn<T>& column) {
+        return _not_supported();
+    }
+
+    Status do_visit(const vectorized::JsonColumn& column) { return _not_supported(); }
+
+    size_t bits() const { return _bits; }
+
+private:
+    static Status _not_supported() { return Status::NotSupported("radix sort"); }
+
+    size_t _bits = 0;
+};
+
+// Appends the normalized values of a column to the keys of the rows.
+// A nullable value is encoded as a null flag followed by the value, whose bits are all zero for null.
+template <size_t N>
+class RadixKeyEncoder final : public ColumnVisitorAdapter<RadixKeyEncoder<N>> {
+public:
+    RadixKeyEncoder(bool is_asc_order, bool is_null_first, std::vector<RadixSortItem<N>>& items)
+            : ColumnVisitorAdapter<RadixKeyEncoder<N>>(this),
+              _is_asc_order(is_asc_order),
+              _is_null_first(is_null_first),
+              _items(items) {}
+
+    Status do_visit(const vectorized::NullableColumn& column) {
+        const auto& null_data = column.immutable_null_column_data();
+        const uint64_t null_flag = _is_null_first ? 0 : 1;
+        for (size_t i = 0; i < _items.size(); ++i) {
+            _items[i].shift_in(null_data[i] ? null_flag : 1 - null_flag, 1);
+        }
+        _null_data = null_data.data();
+        auto st = column.data_column_ref().accept(this);
+        _null_data = nullptr;
+        return st;
+    }
+
+    Status do_visit(const vectorized::ConstColumn& column) { return Status::OK(); }
+
+    template <typename T>
+    Status do_visit(const vectorized::FixedLengthColumnBase<T>& column) {
+        const T* data = column.get_data().data();
+        if constexpr (RadixKeyTraits<T>::supported) {
+            using Unsigned = typename RadixKeyTraits<T>::Unsigned;
+            constexpr int bits = sizeof(Unsigned) * 8;
+            for (size_t i = 0; i < _items.size(); ++i) {
+                Unsigned value = RadixKeyTraits<T>::encode(data[i]);
+                value = _is_asc_order ? value : ~value;
+                _items[i].shift_in(_is_null(i) ? 0 : value, bits);
+            }
+            return Status::OK();
+        } else if constexpr (std::is_same_v<T, int128_t>) {
+            for (size_t i = 0; i < _items.size(); ++i) {
+                auto high = static_cast<uint64_t>(data[i] >> 64) ^ (uint64_t(1) << 63);
+                auto low = static_cast<uint64_t>(data[i]);
+                if (!_is_asc_order) {
+                    high = ~high;
+                    low = ~low;
+                }
+                _items[i].shift_in(_is_null(i) ? 0 : high, 64);
+                _items[i].shift_in(_is_null(i) ? 0 : low, 64);
+            }
+            return Status::OK();
+        } else {
+            return _not_supported();
+        }
+    }
+
+    Status do_visit(const vectorized::ArrayColumn& column) { return _not_supported(); }
+
+    template <typename T>
+    Status do_visit(const vectorized::BinaryColumnBase<T>& column) {
+        return _not_supported();
+    }
+
+    template <typename T>
+    Status do_visit(const vectorized::ObjectColumn<T>& column) {
+        return _not_supported();
+    }
+
+    Status do_visit(const vectorized::JsonColumn& column) { return _not_supported(); }
+
+private:
+    // Never reached, the columns are checked by RadixKeyWidth.
+    static Status _not_supported() { return Status::NotSupported("radix sort"); }
+
+    bool _is_null(size_t row) const { return _null_data != nullptr && _null_data[row]; }
+
+    const bool _is_asc_order;
+    const bool _is_null_first;
+    std::vector<RadixSortItem<N>>& _items;
+    const uint8_t* _null_data = nullptr;
+};
+
+// LSD radix sort on the bytes of the keys. The keys are moved with the row indexes, so each pass reads
+// the items sequentially and appends each of them to one of 256 sequential output ranges.
+template <size_t N>
+static Status radix_sort_items(const bool& cancel, std::vector<RadixSortItem<N>>& items, size_t bits) {
+    const size_t num_rows = items.size();
+    const size_t num_passes = (bits + 7) / 8;
+    std::vector<RadixSortItem<N>> buffer(num_rows);
+    RadixSortItem<N>* src = items.data();
+    RadixSortItem<N>* dst = buffer.data();
+
+    for (size_t pass = 0; pass < num_passes; ++pass) {
+        if (UNLIKELY(cancel)) {
+            return Status::Cancelled("Sort cancelled");
+        }
+        const size_t word = N - 1 - pass / 8;
+        const size_t shift = (pass % 8) * 8;
+        auto digit = [&](const RadixSortItem<N>& item) { return (item.words[word] >> shift) & 0xFF; };
+
+        uint32_t offsets[256] = {0};
+        for (size_t i = 0; i < num_rows; ++i) {
+            offsets[digit(src[i])]++;
+        }
+        // All the keys have the same byte, e.g. the high bytes of small integers.
+        if (offsets[digit(src[0])] == num_rows) {
+            continue;
+        }
+        uint32_t sum = 0;
+        for (uint32_t& offset : offsets) {
+            uint32_t count = offset;
+            offset = sum;
+            sum += count;
+        }
+        for (size_t i = 0; i < num_rows; ++i) {
+            dst[offsets[digit(src[i])]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != items.data()) {
+        items.swap(buffer);
+    }
+    return Status::OK();
+}
+
+template <size_t N>
+static Status radix_sort_columns_impl(const bool& cancel, const Columns& columns, const std::vector<int>& sort_orders,
+                                      const std::vector<int>& null_firsts, size_t bits, Permutation* permutation) {
+    const size_t num_rows = columns[0]->size();
+    std::vector<RadixSortItem<N>> items(num_rows);
+    for (uint32_t i = 0; i < num_rows; ++i) {
+        items[i].index_in_chunk = i;
+        std::fill(std::begin(items[i].words), std::end(items[i].words), 0);
+    }
+    for (size_t col_index = 0; col_index < columns.size(); ++col_index) {
+        bool is_asc_order = (sort_orders[col_index] == 1);
+        bool is_null_first = is_asc_order ? (null_firsts[col_index] == -1) : (null_firsts[col_index] == 1);
+        RadixKeyEncoder<N> encoder(is_asc_order, is_null_first, items);
+        RETURN_IF_ERROR(columns[col_index]->accept(&encoder));
+    }
+
+    RETURN_IF_ERROR(radix_sort_items(cancel, items, bits));
+
+    permutation->resize(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        (*permutation)[i] = {0, items[i].index_in_chunk};
+    }
+    return Status::OK();
+}
+
+bool radix_sort_supported(const Columns& columns, size_t* bits) {
+    RadixKeyWidth width;
+    for (const auto& column : columns) {
+        if (!column->accept(&width).ok()) {
+            return false;
+        }
+    }
+    *bits = width.bits();
+    return width.bits() > 0 && width.bits() <= kRadixSortMaxKeyBits;
+}
+
+Status radix_sort_columns(const bool& cancel, const Columns& columns, const std::vector<int>& sort_orders,
+                          const std::vector<int>& null_firsts, size_t bits, Permutation* permutation) {
+    DCHECK_GT(bits, 0);
+    DCHECK_LE(bits, kRadixSortMaxKeyBits);
+    if (bits <= 64) {
+        return radix_sort_columns_impl<1>(cancel, columns, sort_orders, null_firsts, bits, permutation);
+    } else if (bits <= 128) {
+        return radix_sort_columns_impl<2>(cancel, columns, sort_orders, null_firsts, bits, permutation);
+    } else {
+        return radix_sort_columns_impl<3>(cancel, columns, sort_orders, null_firsts, bits, permutation);
+    }
+}
+
+} // namespace starrocks::vectorized
@@ -23,6 +23,19 @@ Status sort_and_tie_column(const bool& cancel, const ColumnPtr column, bool is_a
 Status sort_and_tie_columns(const bool& cancel, const Columns& columns, const std::vector<int>& sort_orders,
                             const std::vector<int>& null_firsts, Permutation* permutation);
 
+// Radix sort is used for sorting at least kRadixSortMinRows rows by integer-like columns, whose values could be
+// normalized into the unsigned keys of at most kRadixSortMaxKeyBits, including the null flags.
+static constexpr size_t kRadixSortMinRows = 4096;
+static constexpr size_t kRadixSortMaxKeyBits = 192;
+
+// Check whether the columns could be sorted by radix sort, and get the bit width of the normalized keys.
+bool radix_sort_supported(const Columns& columns, size_t* bits);
+
+// Sort multiple columns by LSD radix sort on the normalized keys, output the order in permutation array.
+// The columns must be supported by radix_sort_supported.
+Status radix_sort_columns(const bool& cancel, const Columns& columns, const std::vector<int>& sort_orders,
+                          const std::vector<int>& null_firsts, size_t bits, Permutation* permutation);
+
 // Sort multiple columns, and stable
 Status stable_sort_and_tie_columns(const bool& cancel, const Columns& columns, const std::vector<int>& sort_orders,
                                    const std::vector<int>& null_firsts, SmallPermutation* permutation);
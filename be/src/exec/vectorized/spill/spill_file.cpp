@@ -0,0 +1,349 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/vectorized/spill/spill_file.h"
+
+#include <unistd.h>
+
+#include <atomic>
+
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "common/logging.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/mem_tracker.h"
+#include "runtime/runtime_state.h"
+#include "serde/column_array_serde.h"
+#include "storage/data_dir.h"
+#include "storage/olap_define.h"
+#include "storage/storage_engine.h"
+#include "util/raw_container.h"
+
+namespace starrocks::vectorized {
+
+// An operator consumes less memory than this is not worth spilling, even if the query is under memory pressure.
+static constexpr int64_t kMinSpillableBytes = 16 * 1024 * 1024;
+
+static constexpr size_t kBlockHeaderSize = sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uint64_t);
+
+static std::string pick_spill_dir() {
+    static std::atomic<uint32_t> s_next_dir{0};
+    if (StorageEngine::instance() != nullptr) {
+        auto stores = StorageEngine::instance()->get_stores();
+        if (!stores.empty()) {
+            return stores[s_next_dir.fetch_add(1) % stores.size()]->path() + TMP_PREFIX;
+        }
+    }
+    return config::storage_root_path + TMP_PREFIX;
+}
+
+static Status write_fully(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t w_size = ::write(fd, data, size);
+        if (w_size < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            PLOG(WARNING) << "fail to write spill file";
+            return Status::IOError("fail to write spill file");
+        }
+        data += w_size;
+        size -= w_size;
+    }
+    return Status::OK();
+}
+
+// Return the number of bytes read, which is less than |size| only if reaching the end of file.
+static StatusOr<size_t> read_fully(int fd, char* data, size_t size) {
+    size_t total = 0;
+    while (total < size) {
+        ssize_t r_size = ::read(fd, data + total, size - total);
+        if (r_size < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            PLOG(WARNING) << "fail to read spill file";
+            return Status::IOError("fail to read spill file");
+        }
+        if (r_size == 0) {
+            break;
+        }
+        total += r_size;
+    }
+    return total;
+}
+
+static Status pread_fully(int fd, char* data, size_t size, int64_t offset) {
+    while (size > 0) {
+        ssize_t r_size = ::pread(fd, data, size, offset);
+        if (r_size < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            PLOG(WARNING) << "fail to read spill file";
+            return Status::IOError("fail to read spill file");
+        }
+        if (r_size == 0) {
+            return Status::Corruption("unexpected end of spill file");
+        }
+        data += r_size;
+        size -= r_size;
+        offset += r_size;
+    }
+    return Status::OK();
+}
+
+StatusOr<std::unique_ptr<SpillFile>> SpillFile::create(const std::string& name) {
+    return create(pick_spill_dir(), name);
+}
+
+StatusOr<std::unique_ptr<SpillFile>> SpillFile::create(const std::string& dir, const std::string& name) {
+    // storage/tmp/spill_agg.abcdef
+    std::string tmp_file_path = dir + "/spill_" + name + ".XXXXXX";
+    int fd = mkstemp(tmp_file_path.data());
+    if (fd < 0) {
+        PLOG(WARNING) << "fail to create spill file. path=" << tmp_file_path;
+        return Status::IOError("fail to create spill file");
+    }
+    unlink(tmp_file_path.data());
+    return std::unique_ptr<SpillFile>(new SpillFile(fd));
+}
+
+SpillFile::~SpillFile() {
+    if (_fd >= 0) {
+        ::close(_fd);
+    }
+}
+
+Status SpillFile::append(const Chunk& chunk) {
+    const size_t num_rows = chunk.num_rows();
+    if (num_rows == 0) {
+        return Status::OK();
+    }
+    const uint32_t num_columns = chunk.num_columns();
+
+    Columns columns;
+    columns.reserve(num_columns);
+    size_t payload_size = num_columns;
+    for (const auto& column : chunk.columns()) {
+        auto col = ColumnHelper::unpack_and_duplicate_const_column(num_rows, column);
+        int64_t size = serde::ColumnArraySerde::max_serialized_size(*col);
+        if (size == 0) {
+            return Status::NotSupported("spill file does not support column " + col->get_name());
+        }
+        payload_size += size;
+        columns.emplace_back(std::move(col));
+    }
+
+    raw::stl_string_resize_uninitialized(&_buffer, kBlockHeaderSize + payload_size);
+    auto* buff = reinterpret_cast<uint8_t*>(_buffer.data());
+    uint64_t rows = num_rows;
+    memcpy(buff, &rows, sizeof(rows));
+    buff += sizeof(rows);
+    memcpy(buff, &num_columns, sizeof(num_columns));
+    buff += sizeof(num_columns);
+    uint8_t* payload_size_pos = buff;
+    buff += sizeof(uint64_t);
+    uint8_t* payload_begin = buff;
+    for (const auto& col : columns) {
+        *buff++ = col->is_nullable();
+    }
+    for (const auto& col : columns) {
+        buff = serde::ColumnArraySerde::serialize(*col, buff);
+        if (buff == nullptr) {
+            return Status::InternalError("fail to serialize column of spilled chunk");
+        }
+    }
+    uint64_t real_payload_size = buff - payload_begin;
+    memcpy(payload_size_pos, &real_payload_size, sizeof(real_payload_size));
+
+    const size_t block_size = kBlockHeaderSize + real_payload_size;
+    RETURN_IF_ERROR(write_fully(_fd, _buffer.data(), block_size));
+    _num_chunks++;
+    _num_rows += num_rows;
+    _num_bytes += block_size;
+    return Status::OK();
+}
+
+Status SpillFile::flip_to_read() {
+    off_t offset = lseek(_fd, 0, SEEK_SET);
+    if (offset != 0) {
+        PLOG(WARNING) << "fail to seek spill file to offset 0. offset=" << offset;
+        return Status::IOError("fail to seek spill file to offset 0");
+    }
+    return Status::OK();
+}
+
+StatusOr<ChunkUniquePtr> SpillFile::read(const Chunk& prototype) {
+    char header[kBlockHeaderSize];
+    ASSIGN_OR_RETURN(auto r_size, read_fully(_fd, header, kBlockHeaderSize));
+    if (r_size == 0) {
+        return Status::EndOfFile("end of spill file");
+    } else if (r_size != kBlockHeaderSize) {
+        return Status::Corruption("fail to read block header of spill file");
+    }
+    uint64_t payload_size = 0;
+    memcpy(&payload_size, header + sizeof(uint64_t) + sizeof(uint32_t), sizeof(payload_size));
+
+    raw::stl_string_resize_uninitialized(&_buffer, payload_size);
+    ASSIGN_OR_RETURN(r_size, read_fully(_fd, _buffer.data(), payload_size));
+    if (r_size != payload_size) {
+        return Status::Corruption("fail to read block payload of spill file");
+    }
+    return _decode_block(header, _buffer, prototype);
+}
+
+StatusOr<ChunkUniquePtr> SpillFile::read_at(int64_t offset, const Chunk& prototype) const {
+    char header[kBlockHeaderSize];
+    RETURN_IF_ERROR(pread_fully(_fd, header, kBlockHeaderSize, offset));
+    uint64_t payload_size = 0;
+    memcpy(&payload_size, header + sizeof(uint64_t) + sizeof(uint32_t), sizeof(payload_size));
+
+    std::string payload;
+    raw::stl_string_resize_uninitialized(&payload, payload_size);
+    RETURN_IF_ERROR(pread_fully(_fd, payload.data(), payload_size, offset + kBlockHeaderSize));
+    return _decode_block(header, payload, prototype);
+}
+
+StatusOr<ChunkUniquePtr> SpillFile::_decode_block(const char* header, const std::string& payload,
+                                                  const Chunk& prototype) {
+    uint64_t num_rows = 0;
+    uint32_t num_columns = 0;
+    memcpy(&num_rows, header, sizeof(num_rows));
+    memcpy(&num_columns, header + sizeof(num_rows), sizeof(num_columns));
+    if (num_columns != prototype.num_columns()) {
+        return Status::InternalError(strings::Substitute("spilled chunk has $0 columns, but prototype has $1",
+                                                         num_columns, prototype.num_columns()));
+    }
+
+    const auto* buff = reinterpret_cast<const uint8_t*>(payload.data());
+    const uint8_t* nullable_flags = buff;
+    buff += num_columns;
+    Columns columns(num_columns);
+    for (uint32_t i = 0; i < num_columns; i++) {
+        const Column* data_column = ColumnHelper::get_data_column(prototype.get_column_by_index(i).get());
+        if (nullable_flags[i]) {
+            columns[i] = NullableColumn::create(data_column->clone_empty(), NullColumn::create());
+        } else {
+            columns[i] = data_column->clone_empty();
+        }
+        buff = serde::ColumnArraySerde::deserialize(buff, columns[i].get());
+        if (buff == nullptr) {
+            return Status::Corruption("fail to deserialize column of spilled chunk");
+        }
+        DCHECK_EQ(num_rows, columns[i]->size());
+    }
+    return std::make_unique<Chunk>(std::move(columns), prototype.get_slot_id_to_index_map(),
+                                   prototype.get_tuple_id_to_index_map());
+}
+
+StatusOr<int64_t> SpillFile::append_raw(const void* data, size_t size) {
+    const int64_t offset = _num_bytes;
+    RETURN_IF_ERROR(write_fully(_fd, static_cast<const char*>(data), size));
+    _num_bytes += size;
+    return offset;
+}
+
+Status SpillFile::read_raw(int64_t offset, size_t size, std::string* data) const {
+    DCHECK_LE(offset + static_cast<int64_t>(size), _num_bytes);
+    raw::stl_string_resize_uninitialized(data, size);
+    return pread_fully(_fd, data->data(), size, offset);
+}
+
+void PartitionedSpillFiles::compute_partitions(const Columns& partition_columns, size_t num_rows,
+                                               size_t num_partitions, std::vector<uint32_t>* partitions) {
+    // Use crc32 rather than fnv, which is used by the shuffle exchange, otherwise all the rows
+    // received by one instance may fall into the same partition.
+    partitions->assign(num_rows, 0);
+    for (const auto& column : partition_columns) {
+        column->crc32_hash(partitions->data(), 0, num_rows);
+    }
+    for (size_t i = 0; i < num_rows; i++) {
+        // mix the bits since the lower bits of crc32 are not uniform enough
+        (*partitions)[i] = ((*partitions)[i] * 0x9E3779B1u >> 16) % num_partitions;
+    }
+}
+
+Status PartitionedSpillFiles::append(const ChunkPtr& chunk, const Columns& partition_columns) {
+    const size_t num_rows = chunk->num_rows();
+    if (num_rows == 0) {
+        return Status::OK();
+    }
+    const size_t num_partitions = _files.size();
+    compute_partitions(partition_columns, num_rows, num_partitions, &_partitions);
+
+    _partition_indexes.resize(num_partitions);
+    for (auto& indexes : _partition_indexes) {
+        indexes.clear();
+    }
+    for (uint32_t i = 0; i < num_rows; i++) {
+        _partition_indexes[_partitions[i]].push_back(i);
+    }
+
+    for (size_t i = 0; i < num_partitions; i++) {
+        const auto& indexes = _partition_indexes[i];
+        if (indexes.empty()) {
+            continue;
+        }
+        if (_buffers[i] == nullptr) {
+            _buffers[i] = chunk->clone_empty_with_slot(_chunk_size);
+        }
+        _buffers[i]->append_selective(*chunk, indexes.data(), 0, indexes.size());
+        if (_buffers[i]->num_rows() >= _chunk_size) {
+            RETURN_IF_ERROR(_flush_partition(i));
+        }
+    }
+    _num_rows += num_rows;
+    return Status::OK();
+}
+
+Status PartitionedSpillFiles::_flush_partition(size_t i) {
+    if (_buffers[i] == nullptr || _buffers[i]->num_rows() == 0) {
+        return Status::OK();
+    }
+    if (_files[i] == nullptr) {
+        ASSIGN_OR_RETURN(_files[i], SpillFile::create(_name));
+    }
+    int64_t old_bytes = _files[i]->num_bytes();
+    RETURN_IF_ERROR(_files[i]->append(*_buffers[i]));
+    _num_bytes += _files[i]->num_bytes() - old_bytes;
+    _buffers[i]->reset();
+    return Status::OK();
+}
+
+Status PartitionedSpillFiles::finish() {
+    for (size_t i = 0; i < _files.size(); i++) {
+        RETURN_IF_ERROR(_flush_partition(i));
+        _buffers[i].reset();
+        if (_files[i] != nullptr) {
+            RETURN_IF_ERROR(_files[i]->flip_to_read());
+        }
+    }
+    return Status::OK();
+}
+
+bool should_spill(RuntimeState* state, const MemTracker* operator_mem_tracker) {
+    if (operator_mem_tracker == nullptr) {
+        return false;
+    }
+    return should_spill(state, operator_mem_tracker->consumption());
+}
+
+bool should_spill(RuntimeState* state, int64_t operator_mem_usage) {
+    if (!state->enable_spill()) {
+        return false;
+    }
+    if (operator_mem_usage > config::spill_operator_mem_limit_bytes) {
+        return true;
+    }
+    if (operator_mem_usage < kMinSpillableBytes) {
+        return false;
+    }
+    MemTracker* query_mem_tracker = state->query_mem_tracker_ptr().get();
+    if (query_mem_tracker != nullptr && query_mem_tracker->has_limit()) {
+        return query_mem_tracker->consumption() > query_mem_tracker->limit() * config::spill_query_mem_limit_ratio;
+    }
+    return false;
+}
+
+} // namespace starrocks::vectorized
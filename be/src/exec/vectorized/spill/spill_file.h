@@ -0,0 +1,148 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/vectorized_fwd.h"
+#include "common/statusor.h"
+
+namespace starrocks {
+class MemTracker;
+class RuntimeState;
+} // namespace starrocks
+
+namespace starrocks::vectorized {
+
+// SpillFile is an anonymous temporary file used by the operators of the pipeline engine
+// to spill chunks to the local disk when they run out of memory.
+//
+// The file is unlinked right after it is created, so the disk space is reclaimed
+// automatically when the SpillFile is destroyed, even if the BE crashes in the middle.
+//
+// Every chunk written is stored as a block:
+//     | num_rows(8) | num_columns(4) | payload_size(8) | nullable flags(num_columns) | column payloads |
+// Column payloads are encoded by ColumnArraySerde.
+//
+// Usage Example:
+//     ASSIGN_OR_RETURN(auto file, SpillFile::create("agg"));
+//     RETURN_IF_ERROR(file->append(*chunk1));
+//     RETURN_IF_ERROR(file->append(*chunk2));
+//     RETURN_IF_ERROR(file->flip_to_read());
+//     while (true) {
+//         auto res = file->read(*prototype);
+//         if (res.status().is_end_of_file()) break;
+//         ...
+//     }
+//
+class SpillFile {
+public:
+    // Create a spill file in the tmp dir of one of the data dirs of this BE.
+    // |name| is used as the prefix of the file name, which is helpful for debugging.
+    static StatusOr<std::unique_ptr<SpillFile>> create(const std::string& name);
+
+    // Create a spill file in |dir|, |dir| must exist.
+    static StatusOr<std::unique_ptr<SpillFile>> create(const std::string& dir, const std::string& name);
+
+    ~SpillFile();
+
+    SpillFile(const SpillFile&) = delete;
+    SpillFile& operator=(const SpillFile&) = delete;
+
+    // Append |chunk| to the end of the file. Const columns are unpacked before written.
+    Status append(const Chunk& chunk);
+
+    // Switch the file to read mode and rewind to the first chunk.
+    Status flip_to_read();
+
+    // Read the next chunk. The columns of the returned chunk are created from the data columns of
+    // |prototype| and the slot mapping is copied from |prototype|, which must have the same layout
+    // as the chunks written.
+    // Return Status::EndOfFile if all chunks have been read.
+    StatusOr<ChunkUniquePtr> read(const Chunk& prototype);
+
+    // Read the chunk written by append() at |offset|, which is num_bytes() before the append.
+    // It doesn't move the position of read() or append(), so it could be called while appending.
+    StatusOr<ChunkUniquePtr> read_at(int64_t offset, const Chunk& prototype) const;
+
+    // Append |size| bytes as is and return their offset in the file.
+    // A file is used to store either chunks or raw bytes, but not both.
+    StatusOr<int64_t> append_raw(const void* data, size_t size);
+
+    // Read |size| bytes at |offset| written by append_raw(). It could be called before all the bytes are appended.
+    Status read_raw(int64_t offset, size_t size, std::string* data) const;
+
+    size_t num_chunks() const { return _num_chunks; }
+    int64_t num_rows() const { return _num_rows; }
+    int64_t num_bytes() const { return _num_bytes; }
+    bool empty() const { return _num_chunks == 0; }
+
+private:
+    explicit SpillFile(int fd) : _fd(fd) {}
+
+    static StatusOr<ChunkUniquePtr> _decode_block(const char* header, const std::string& payload,
+                                                  const Chunk& prototype);
+
+    int _fd = -1;
+    size_t _num_chunks = 0;
+    int64_t _num_rows = 0;
+    int64_t _num_bytes = 0;
+    // Reused between blocks to avoid allocating memory for each chunk.
+    std::string _buffer;
+};
+
+using SpillFilePtr = std::unique_ptr<SpillFile>;
+
+// PartitionedSpillFiles splits chunks into |num_partitions| spill files by the hash of |partition_columns|,
+// so that rows with the same keys always go to the same partition and each partition could be processed
+// independently later.
+// Rows are buffered in memory per partition and flushed in batches of |chunk_size| rows.
+class PartitionedSpillFiles {
+public:
+    PartitionedSpillFiles(std::string name, size_t num_partitions, size_t chunk_size)
+            : _name(std::move(name)), _chunk_size(chunk_size), _files(num_partitions), _buffers(num_partitions) {}
+
+    // partition_columns are the columns of |chunk| used to compute the partition.
+    Status append(const ChunkPtr& chunk, const Columns& partition_columns);
+
+    // Flush all the buffered rows to disk and flip all files to read mode.
+    Status finish();
+
+    size_t num_partitions() const { return _files.size(); }
+    // Return nullptr if no rows fall into partition |i|.
+    SpillFile* partition(size_t i) const { return _files[i].get(); }
+    // Release the resource of partition |i| after it has been consumed.
+    void release_partition(size_t i) { _files[i].reset(); }
+
+    int64_t num_bytes() const { return _num_bytes; }
+    int64_t num_rows() const { return _num_rows; }
+
+    // compute the partition of every row by the same hash function used by append()
+    static void compute_partitions(const Columns& partition_columns, size_t num_rows, size_t num_partitions,
+                                   std::vector<uint32_t>* partitions);
+
+private:
+    Status _flush_partition(size_t i);
+
+    const std::string _name;
+    const size_t _chunk_size;
+    std::vector<SpillFilePtr> _files;
+    std::vector<ChunkPtr> _buffers;
+    int64_t _num_bytes = 0;
+    int64_t _num_rows = 0;
+
+    std::vector<uint32_t> _partitions;
+    std::vector<std::vector<uint32_t>> _partition_indexes;
+};
+
+// Whether an operator which has consumed the memory tracked by |operator_mem_tracker| should spill
+// its in-memory state to disk. Always return false if spill is not enabled by the session.
+bool should_spill(RuntimeState* state, const MemTracker* operator_mem_tracker);
+
+// Same as above, for the operators whose memory usage is not tracked by a dedicated MemTracker.
+bool should_spill(RuntimeState* state, int64_t operator_mem_usage);
+
+} // namespace starrocks::vectorized
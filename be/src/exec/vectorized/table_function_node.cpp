@@ -222,6 +222,7 @@ Status TableFunctionNode::build_chunk(ChunkPtr* chunk, const std::vector<ColumnP
     for (int result_idx = 0; result_idx < _fn_result_slots.size(); ++result_idx) {
         (*chunk)->append_column(output_columns[_outer_slots.size() + result_idx], _fn_result_slots[result_idx]);
     }
+    RETURN_IF_ERROR(ExecNode::eval_conjuncts(_conjunct_ctxs, (*chunk).get()));
 
     _num_rows_returned += (*chunk)->num_rows();
 
@@ -271,7 +272,8 @@ std::vector<std::shared_ptr<pipeline::OperatorFactory>> TableFunctionNode::decom
     using namespace pipeline;
     OpFactories operators = _children[0]->decompose_to_pipeline(context);
 
-    operators.emplace_back(std::make_shared<TableFunctionOperatorFactory>(context->next_operator_id(), id(), _tnode));
+    operators.emplace_back(std::make_shared<TableFunctionOperatorFactory>(context->next_operator_id(), id(), _tnode,
+                                                                         std::move(_conjunct_ctxs)));
     // Create a shared RefCountedRuntimeFilterCollector
     auto&& rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(1, std::move(this->runtime_filter_collector()));
     // Initialize OperatorFactory's fields involving runtime filters.
@@ -188,9 +188,18 @@ void OlapTablePartitionParam::find_tablets(Chunk* chunk, std::vector<OlapTablePa
         ChunkRow row;
         row.columns = &partition_columns;
         row.index = 0;
+        // The rows of a load are usually clustered by the partition columns, e.g. loaded day by day, so the
+        // partition of the previous row is checked before searching the map.
+        OlapTablePartition* last_partition = nullptr;
         for (size_t i = 0; i < num_rows; ++i) {
             if ((*selection)[i]) {
                 row.index = i;
+                if (last_partition != nullptr && _part_contains(last_partition, &row) &&
+                    PartionKeyComparator()(&row, &last_partition->end_key)) {
+                    (*partitions)[i] = last_partition;
+                    (*indexes)[i] = (*indexes)[i] % last_partition->num_buckets;
+                    continue;
+                }
                 auto it = _partitions_map.upper_bound(&row);
                 if (UNLIKELY(it == _partitions_map.end())) {
                     (*partitions)[i] = nullptr;
@@ -199,6 +208,7 @@ void OlapTablePartitionParam::find_tablets(Chunk* chunk, std::vector<OlapTablePa
                         *invalid_row_index = i;
                     }
                 } else if (LIKELY(_part_contains(it->second, &row))) {
+                    last_partition = it->second;
                     (*partitions)[i] = it->second;
                     (*indexes)[i] = (*indexes)[i] % it->second->num_buckets;
                 } else {
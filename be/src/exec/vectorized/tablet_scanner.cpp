@@ -13,6 +13,7 @@
 #include "exec/vectorized/olap_scan_node.h"
 #include "storage/chunk_helper.h"
 #include "storage/column_predicate_rewriter.h"
+#include "storage/page_cache.h"
 #include "storage/predicate_parser.h"
 #include "storage/projection_iterator.h"
 #include "storage/storage_engine.h"
@@ -126,6 +127,15 @@ Status TabletScanner::_init_reader_params(const std::vector<OlapScanRange*>* key
     // to avoid the unnecessary SerDe and improve query performance
     _params.need_agg_finalize = _need_agg_finalize;
     _params.use_page_cache = !config::disable_storage_page_cache;
+    if (_params.use_page_cache && StoragePageCache::instance() != nullptr) {
+        _params.fill_page_cache = !StoragePageCache::instance()->is_large_scan(_tablet->tablet_footprint());
+    }
+    const TQueryOptions& query_options = _runtime_state->query_options();
+    if (query_options.__isset.segment_readahead_bytes) {
+        _params.readahead_bytes = query_options.segment_readahead_bytes;
+    } else {
+        _params.readahead_bytes = config::segment_readahead_bytes;
+    }
     // Improve for select * from table limit x, x is small
     if (_parent->_limit != -1 && _parent->_limit < runtime_state()->chunk_size()) {
         _params.chunk_size = _parent->_limit;
@@ -328,6 +338,7 @@ void TabletScanner::update_counter() {
     COUNTER_UPDATE(_parent->_seg_zm_filtered_counter, _reader->stats().segment_stats_filtered);
     COUNTER_UPDATE(_parent->_zm_filtered_counter, _reader->stats().rows_stats_filtered);
     COUNTER_UPDATE(_parent->_bf_filtered_counter, _reader->stats().rows_bf_filtered);
+    COUNTER_UPDATE(_parent->_ngram_index_filtered_counter, _reader->stats().rows_ngram_index_filtered);
     COUNTER_UPDATE(_parent->_sk_filtered_counter, _reader->stats().rows_key_range_filtered);
     COUNTER_UPDATE(_parent->_index_load_timer, _reader->stats().index_load_ns);
 
@@ -9,12 +9,19 @@
 #include "exec/pipeline/limit_operator.h"
 #include "exec/pipeline/pipeline_builder.h"
 #include "exec/pipeline/sort/local_merge_sort_source_operator.h"
+#include "exec/pipeline/sort/local_partition_topn_context.h"
+#include "exec/pipeline/sort/local_partition_topn_sink.h"
+#include "exec/pipeline/sort/local_partition_topn_source.h"
 #include "exec/pipeline/sort/partition_sort_sink_operator.h"
 #include "exec/pipeline/sort/sort_context.h"
 #include "exec/vectorized/chunk_sorter_heapsorter.h"
 #include "exec/vectorized/chunks_sorter.h"
 #include "exec/vectorized/chunks_sorter_full_sort.h"
 #include "exec/vectorized/chunks_sorter_topn.h"
+#include "exec/vectorized/olap_scan_node.h"
+#include "exec/vectorized/project_node.h"
+#include "exec/vectorized/topn_runtime_filter.h"
+#include "exprs/vectorized/column_ref.h"
 #include "gutil/casts.h"
 #include "runtime/current_thread.h"
 
@@ -43,6 +50,10 @@ Status TopNNode::init(const TPlanNode& tnode, RuntimeState* state) {
         RETURN_IF_ERROR(
                 Expr::create_expr_trees(_pool, tnode.sort_node.analytic_partition_exprs, &_analytic_partition_exprs));
     }
+    if (tnode.sort_node.__isset.partition_exprs && tnode.sort_node.__isset.partition_limit) {
+        RETURN_IF_ERROR(Expr::create_expr_trees(_pool, tnode.sort_node.partition_exprs, &_partition_exprs));
+        _partition_limit = tnode.sort_node.partition_limit;
+    }
     _is_asc_order = tnode.sort_node.sort_info.is_asc_order;
     _is_null_first = tnode.sort_node.sort_info.nulls_first;
     bool has_outer_join_child = tnode.sort_node.__isset.has_outer_join_child && tnode.sort_node.has_outer_join_child;
@@ -62,7 +73,9 @@ Status TopNNode::init(const TPlanNode& tnode, RuntimeState* state) {
     DCHECK(_materialized_tuple_desc != nullptr);
 
     _runtime_profile->add_info_string("SortKeys", _sort_keys);
-    _runtime_profile->add_info_string("SortType", tnode.sort_node.use_top_n ? "TopN" : "All");
+    _runtime_profile->add_info_string("SortType", _is_partition_topn()      ? "PartitionTopN"
+                                                  : tnode.sort_node.use_top_n ? "TopN"
+                                                                              : "All");
     return Status::OK();
 }
 
@@ -180,9 +193,77 @@ Status TopNNode::_consume_chunks(RuntimeState* state, ExecNode* child) {
     return Status::OK();
 }
 
+std::shared_ptr<TopnRuntimeFilter> TopNNode::_create_topn_runtime_filter() {
+    // The boundary is the N-th row, and the nulls first are before any boundary.
+    if (_limit <= 0 || _is_null_first[0]) {
+        return nullptr;
+    }
+    auto* column_ref = dynamic_cast<ColumnRef*>(_sort_exec_exprs.lhs_ordering_expr_ctxs()[0]->root());
+    if (column_ref == nullptr) {
+        return nullptr;
+    }
+
+    // Find the scan through the projections which pass the slot through. The nodes with limit are skipped,
+    // whose output depends on all the rows of the input.
+    SlotId slot_id = column_ref->slot_id();
+    ExecNode* node = _children[0];
+    while (node->limit() == -1) {
+        if (auto* scan_node = dynamic_cast<OlapScanNode*>(node); scan_node != nullptr) {
+            auto topn_filter = std::make_shared<TopnRuntimeFilter>(slot_id, column_ref->type(), _is_asc_order[0]);
+            scan_node->set_topn_runtime_filter(topn_filter);
+            return topn_filter;
+        }
+        auto* project_node = dynamic_cast<ProjectNode*>(node);
+        if (project_node == nullptr) {
+            break;
+        }
+        slot_id = project_node->get_child_slot(slot_id);
+        if (slot_id < 0) {
+            break;
+        }
+        node = node->child(0);
+    }
+    return nullptr;
+}
+
+pipeline::OpFactories TopNNode::_decompose_to_pipeline_partition_topn(pipeline::PipelineBuilderContext* context) {
+    using namespace pipeline;
+
+    // Each driver keeps the top rows of the partitions of its own input, no local shuffle is needed.
+    OpFactories operators_sink = _children[0]->decompose_to_pipeline(context);
+    auto degree_of_parallelism = down_cast<SourceOperatorFactory*>(operators_sink[0].get())->degree_of_parallelism();
+    auto partition_topn_ctx_factory = std::make_shared<LocalPartitionTopnContextFactory>(
+            runtime_state(), degree_of_parallelism, _partition_exprs, _sort_exec_exprs, _is_asc_order, _is_null_first,
+            _sort_keys, _partition_limit);
+
+    auto&& rc_rf_probe_collector = std::make_shared<RcRfProbeCollector>(2, std::move(this->runtime_filter_collector()));
+    auto sink_operator = std::make_shared<LocalPartitionTopnSinkOperatorFactory>(
+            context->next_operator_id(), id(), partition_topn_ctx_factory, _sort_exec_exprs, _order_by_types,
+            _materialized_tuple_desc, child(0)->row_desc(), _row_descriptor, _partition_exprs);
+    this->init_runtime_filter_for_operator(sink_operator.get(), context, rc_rf_probe_collector);
+    operators_sink.emplace_back(std::move(sink_operator));
+    context->add_pipeline(operators_sink);
+
+    OpFactories operators_source;
+    auto source_operator = std::make_shared<LocalPartitionTopnSourceOperatorFactory>(context->next_operator_id(), id(),
+                                                                                     partition_topn_ctx_factory);
+    this->init_runtime_filter_for_operator(source_operator.get(), context, rc_rf_probe_collector);
+    source_operator->set_degree_of_parallelism(degree_of_parallelism);
+    operators_source.emplace_back(std::move(source_operator));
+    if (limit() != -1) {
+        operators_source.emplace_back(
+                std::make_shared<LimitOperatorFactory>(context->next_operator_id(), id(), limit()));
+    }
+    return operators_source;
+}
+
 pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderContext* context) {
     using namespace pipeline;
 
+    if (_is_partition_topn()) {
+        return _decompose_to_pipeline_partition_topn(context);
+    }
+
     OpFactories operators_sink_with_sort = _children[0]->decompose_to_pipeline(context);
     bool is_merging = _analytic_partition_exprs.empty();
 
@@ -205,6 +286,9 @@ pipeline::OpFactories TopNNode::decompose_to_pipeline(pipeline::PipelineBuilderC
             _row_descriptor, _analytic_partition_exprs);
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(partition_sort_sink_operator.get(), context, rc_rf_probe_collector);
+    if (is_merging) {
+        partition_sort_sink_operator->set_topn_runtime_filter(_create_topn_runtime_filter());
+    }
 
     OpFactories operators_source_with_sort;
     auto local_merge_sort_source_operator = std::make_shared<LocalMergeSortSourceOperatorFactory>(
@@ -8,6 +8,7 @@
 namespace starrocks::vectorized {
 
 class ChunksSorter;
+class TopnRuntimeFilter;
 
 // Node for in-memory TopN (ORDER BY ... LIMIT).
 //
@@ -32,6 +33,13 @@ public:
 private:
     Status _consume_chunks(RuntimeState* state, ExecNode* child);
 
+    bool _is_partition_topn() const { return !_partition_exprs.empty() && _partition_limit > 0; }
+    pipeline::OpFactories _decompose_to_pipeline_partition_topn(pipeline::PipelineBuilderContext* context);
+
+    // Creates the filter publishing the boundary of the top-n rows to the olap scan below in the same fragment,
+    // and hands it to the scan. Returns nullptr if the boundary could not be used by the scan.
+    std::shared_ptr<TopnRuntimeFilter> _create_topn_runtime_filter();
+
     // Only used for profile
     std::string _sort_keys;
     int64_t _offset;
@@ -45,6 +53,12 @@ private:
     // also added to TopNNode to hint that local shuffle operator is prepended to TopNNode in
     // order to eliminate merging operation in pipeline execution engine.
     std::vector<ExprContext*> _analytic_partition_exprs;
+    // if TopNNode is planned below the exchange of AnalyticNode for the predicates like
+    // ROW_NUMBER() OVER (PARTITION BY ...) <= N, at most _partition_limit rows of each partition by
+    // _partition_exprs are kept in pipeline execution engine. The non-pipeline engine ignores them and
+    // outputs all the rows, which is still correct since the predicate is evaluated above the AnalyticNode.
+    std::vector<ExprContext*> _partition_exprs;
+    int64_t _partition_limit = -1;
 
     // Cached descriptor for the materialized tuple. Assigned in Prepare().
     TupleDescriptor* _materialized_tuple_desc;
@@ -0,0 +1,83 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/vectorized/topn_runtime_filter.h"
+
+#include "column/column_helper.h"
+#include "column/type_traits.h"
+#include "exec/olap_common.h"
+#include "runtime/descriptors.h"
+#include "runtime/primitive_type_infra.h"
+
+namespace starrocks::vectorized {
+
+namespace {
+
+struct TopnConditionBuilder {
+    template <PrimitiveType ptype>
+    bool operator()(const Datum& boundary, const TypeDescriptor& type, std::string* value) {
+        // The string columns are skipped like the late join runtime filters, whose predicates need to be rewritten
+        // for the global dictionary.
+        if constexpr (ptype == TYPE_TIME || ptype == TYPE_NULL || ptype == TYPE_JSON || pt_is_float<ptype> ||
+                      pt_is_binary<ptype>) {
+            return false;
+        } else {
+            // Treat tinyint and boolean as int
+            constexpr PrimitiveType limit_type = ptype == TYPE_TINYINT || ptype == TYPE_BOOLEAN ? TYPE_INT : ptype;
+            using value_type = typename RunTimeTypeLimits<limit_type>::value_type;
+            *value = cast_to_string(static_cast<value_type>(boundary.get<RunTimeCppType<ptype>>()), ptype,
+                                    type.precision, type.scale);
+            return true;
+        }
+    }
+};
+
+} // namespace
+
+TopnRuntimeFilter::TopnRuntimeFilter(SlotId slot_id, const TypeDescriptor& type, bool is_asc)
+        : _slot_id(slot_id),
+          _type(type),
+          _is_asc(is_asc),
+          _boundary(ColumnHelper::create_column(type, false)),
+          _candidate(ColumnHelper::create_column(type, false)) {}
+
+void TopnRuntimeFilter::update(const Datum& boundary) {
+    DCHECK(!boundary.is_null());
+    std::lock_guard l(_lock);
+    if (!_boundary->empty()) {
+        _candidate->resize(0);
+        _candidate->append_datum(boundary);
+        int cmp = _candidate->compare_at(0, 0, *_boundary, 1);
+        if (_is_asc ? cmp >= 0 : cmp <= 0) {
+            return;
+        }
+        _boundary.swap(_candidate);
+    } else {
+        _boundary->append_datum(boundary);
+    }
+    _version.fetch_add(1, std::memory_order_release);
+}
+
+bool TopnRuntimeFilter::get_condition(const SlotDescriptor* slot, TCondition* condition, size_t* version) const {
+    if (slot->type().type != _type.type) {
+        return false;
+    }
+    std::string value;
+    {
+        std::lock_guard l(_lock);
+        if (_boundary->empty()) {
+            return false;
+        }
+        *version = _version.load(std::memory_order_acquire);
+        if (!type_dispatch_predicate<bool>(_type.type, false, TopnConditionBuilder(), _boundary->get(0), _type,
+                                           &value)) {
+            return false;
+        }
+    }
+    condition->__set_is_index_filter_only(true);
+    condition->__set_column_name(slot->col_name());
+    condition->__set_condition_op(_is_asc ? "<=" : ">=");
+    condition->condition_values.push_back(std::move(value));
+    return true;
+}
+
+} // namespace starrocks::vectorized
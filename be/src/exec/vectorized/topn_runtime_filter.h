@@ -0,0 +1,57 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "column/datum.h"
+#include "column/vectorized_fwd.h"
+#include "common/global_types.h"
+#include "gen_cpp/InternalService_types.h"
+#include "runtime/types.h"
+
+namespace starrocks {
+class SlotDescriptor;
+} // namespace starrocks
+
+namespace starrocks::vectorized {
+
+// The boundary of a top-n sort, published by the sorters to the olap scan below the sort in the same fragment.
+// The rows after the boundary in the order could never be output, so the scan prunes the pages whose zone maps
+// are entirely after it. The boundary tightens as the sorters see more rows.
+//
+// Only the first order-by column is used, and the condition includes the boundary itself, so the ties on the
+// first column which are resolved by the other columns are kept.
+class TopnRuntimeFilter {
+public:
+    // |slot_id| is the slot of the scan which the first order-by expression refers to.
+    TopnRuntimeFilter(SlotId slot_id, const TypeDescriptor& type, bool is_asc);
+
+    SlotId slot_id() const { return _slot_id; }
+
+    // Increased by every tighter boundary.
+    size_t version() const { return _version.load(std::memory_order_acquire); }
+
+    // Called by the sorters with the first order-by value of their N-th row, which must not be null.
+    // Each sorter sees part of the rows, whose N-th row is still a valid boundary of all the rows,
+    // and the tightest one is kept.
+    void update(const Datum& boundary);
+
+    // Gets the index filter only condition of the current boundary on the column of |slot|, and the version of it.
+    // Returns false if there is no boundary yet or the type of the column is not supported.
+    bool get_condition(const SlotDescriptor* slot, TCondition* condition, size_t* version) const;
+
+private:
+    const SlotId _slot_id;
+    const TypeDescriptor _type;
+    const bool _is_asc;
+
+    mutable std::mutex _lock;
+    // one row, empty before the first update.
+    ColumnPtr _boundary;
+    ColumnPtr _candidate;
+    std::atomic<size_t> _version{0};
+};
+
+} // namespace starrocks::vectorized
@@ -3,7 +3,10 @@
 #include "exec/workgroup/scan_executor.h"
 
 #include "exec/workgroup/scan_task_queue.h"
+#include "exec/workgroup/work_group.h"
+#include "gutil/walltime.h"
 #include "runtime/exec_env.h"
+#include "util/time.h"
 
 namespace starrocks::workgroup {
 
@@ -43,7 +46,14 @@ void ScanExecutor::worker_thread() {
             return;
         }
 
-        maybe_task.value().work_function(worker_id);
+        auto& task = maybe_task.value();
+        if (task.workgroup != nullptr && task.workgroup->has_cpu_hard_limit()) {
+            int64_t start_cpu_time_us = GetThreadCpuTimeMicros();
+            task.work_function(worker_id);
+            task.workgroup->charge_cpu_bandwidth((GetThreadCpuTimeMicros() - start_cpu_time_us) * NANOS_PER_MICRO);
+        } else {
+            task.work_function(worker_id);
+        }
     }
 }
 
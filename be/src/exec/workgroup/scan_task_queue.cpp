@@ -2,6 +2,7 @@
 
 #include "exec/workgroup/scan_task_queue.h"
 
+#include "common/config.h"
 #include "exec/workgroup/work_group.h"
 
 namespace starrocks::workgroup {
@@ -52,16 +53,28 @@ StatusOr<ScanTask> ScanTaskQueueWithWorkGroup::take(int worker_id) {
     if (_is_closed) {
         return Status::Cancelled("Shutdown");
     }
-    while (_ready_wgs.empty()) {
-        _cv.wait(lock);
+    WorkGroupPtr wg = nullptr;
+    while (true) {
+        while (_ready_wgs.empty()) {
+            _cv.wait(lock);
+            if (_is_closed) {
+                return Status::Cancelled("Shutdown");
+            }
+        }
+
+        _maybe_adjust_weight();
+
+        wg = _select_next_wg(worker_id);
+        if (wg != nullptr) {
+            break;
+        }
+
+        // All the ready workgroups are throttled, wait until the cpu bandwidth is refilled or new tasks come.
+        _cv.wait_for(lock, std::chrono::microseconds(config::pipeline_cpu_hard_limit_period_us));
         if (_is_closed) {
             return Status::Cancelled("Shutdown");
         }
     }
-
-    _maybe_adjust_weight();
-
-    WorkGroupPtr wg = _select_next_wg(worker_id);
     if (wg->scan_task_queue()->size() == 1) {
         _ready_wgs.erase(wg);
     }
@@ -166,6 +179,10 @@ WorkGroupPtr ScanTaskQueueWithWorkGroup::_select_next_wg(int worker_id) {
     WorkGroupPtr max_other_wg = nullptr;
     double total = 0;
     for (auto wg : _ready_wgs) {
+        // The workgroup used up its cpu bandwidth doesn't participate in this round of selection.
+        if (wg->is_cpu_throttled()) {
+            continue;
+        }
         wg->update_cur_select_factor(wg->get_select_factor());
         total += wg->get_select_factor();
 
@@ -185,7 +202,10 @@ WorkGroupPtr ScanTaskQueueWithWorkGroup::_select_next_wg(int worker_id) {
     }
 
     // All the owner workgroups don't have ready tasks, so select the other workgroup.
-    max_other_wg->update_cur_select_factor(0 - total);
+    // Return nullptr, if all the ready workgroups are throttled.
+    if (max_other_wg != nullptr) {
+        max_other_wg->update_cur_select_factor(0 - total);
+    }
     return max_other_wg;
 }
 
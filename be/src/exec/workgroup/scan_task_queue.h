@@ -81,6 +81,7 @@ private:
 
     // _maybe_adjust_weight and _select_next_wg are guarded by the ourside _global_mutex.
     void _maybe_adjust_weight();
+    // Return nullptr, if all the ready workgroups are throttled by their cpu hard limit.
     WorkGroupPtr _select_next_wg(int worker_id);
 
     static constexpr int MAX_SCHEDULE_NUM_PERIOD = 512;
@@ -2,9 +2,11 @@
 
 #include "exec/workgroup/work_group.h"
 
+#include "common/config.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "glog/logging.h"
 #include "runtime/exec_env.h"
+#include "util/starrocks_metrics.h"
 #include "util/time.h"
 
 namespace starrocks {
@@ -26,6 +28,9 @@ WorkGroup::WorkGroup(const TWorkGroup& twg) : _name(twg.name), _id(twg.id) {
     } else {
         _cpu_limit = -1;
     }
+    if (twg.__isset.cpu_hard_limit) {
+        _cpu_hard_limit = twg.cpu_hard_limit;
+    }
     if (twg.__isset.mem_limit) {
         _memory_limit = twg.mem_limit;
     } else {
@@ -72,6 +77,9 @@ TWorkGroup WorkGroup::to_thrift_verbose() const {
     std::string state = is_marked_del() ? "dead" : "alive";
     twg.__set_state(state);
     twg.__set_cpu_core_limit(_cpu_limit);
+    twg.__set_cpu_hard_limit(_cpu_hard_limit);
+    twg.__set_cpu_throttled_time_ns(cpu_throttled_time_ns());
+    twg.__set_num_cpu_throttled_periods(num_cpu_throttled_periods());
     twg.__set_mem_limit(_memory_limit);
     twg.__set_concurrency_limit(_concurrency);
     twg.__set_num_drivers(_acc_num_drivers);
@@ -97,6 +105,64 @@ double WorkGroup::get_cpu_actual_use_ratio() const {
     return _cpu_actual_use_ratio;
 }
 
+void WorkGroup::charge_cpu_bandwidth(int64_t cpu_time_ns) {
+    if (!has_cpu_hard_limit()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_cpu_bandwidth_mutex);
+    _cpu_period_used_ns += cpu_time_ns;
+}
+
+bool WorkGroup::is_cpu_throttled() {
+    if (!has_cpu_hard_limit()) {
+        return false;
+    }
+    const int64_t now = MonotonicNanos();
+    std::lock_guard<std::mutex> lock(_cpu_bandwidth_mutex);
+    _refill_cpu_bandwidth_locked(now);
+
+    const int64_t quota_ns = config::pipeline_cpu_hard_limit_period_us * NANOS_PER_MICRO * _cpu_hard_limit;
+    if (_cpu_period_used_ns < quota_ns) {
+        return false;
+    }
+    if (_cpu_throttled_since_ns == 0) {
+        _cpu_throttled_since_ns = now;
+        _num_cpu_throttled_periods++;
+    }
+    return true;
+}
+
+void WorkGroup::_refill_cpu_bandwidth_locked(int64_t now_ns) {
+    if (now_ns < _cpu_period_end_ns) {
+        return;
+    }
+    const int64_t period_ns = std::max<int64_t>(1, config::pipeline_cpu_hard_limit_period_us * NANOS_PER_MICRO);
+    const int64_t quota_ns = period_ns * _cpu_hard_limit;
+    if (_cpu_throttled_since_ns != 0) {
+        _cpu_throttled_time_ns += _cpu_period_end_ns - _cpu_throttled_since_ns;
+        _cpu_throttled_since_ns = 0;
+    }
+    // A driver or scan task may run much longer than a period, so the time overused is paid back by
+    // the quota of the following periods, including the periods passed without any check.
+    const int64_t num_periods = (now_ns - _cpu_period_end_ns) / period_ns + 1;
+    _cpu_period_used_ns = std::max<int64_t>(0, _cpu_period_used_ns - num_periods * quota_ns);
+    _cpu_period_end_ns = _cpu_period_end_ns == 0 ? now_ns + period_ns : _cpu_period_end_ns + num_periods * period_ns;
+}
+
+int64_t WorkGroup::cpu_throttled_time_ns() const {
+    std::lock_guard<std::mutex> lock(_cpu_bandwidth_mutex);
+    if (_cpu_throttled_since_ns == 0) {
+        return _cpu_throttled_time_ns;
+    }
+    const int64_t throttled_until_ns = std::min(MonotonicNanos(), _cpu_period_end_ns);
+    return _cpu_throttled_time_ns + std::max<int64_t>(0, throttled_until_ns - _cpu_throttled_since_ns);
+}
+
+int64_t WorkGroup::num_cpu_throttled_periods() const {
+    std::lock_guard<std::mutex> lock(_cpu_bandwidth_mutex);
+    return _num_cpu_throttled_periods;
+}
+
 WorkGroupManager::WorkGroupManager()
         : _driver_worker_owner_manager(std::make_unique<WorkerOwnerManager>(
                   config::pipeline_exec_thread_pool_thread_num > 0 ? config::pipeline_exec_thread_pool_thread_num
@@ -264,6 +330,7 @@ void WorkGroupManager::create_workgroup_unlocked(const WorkGroupPtr& wg) {
         return;
     }
     wg->init();
+    wg->set_usage_metrics(get_or_register_usage_metrics_unlocked(wg));
     _workgroups[unique_id] = wg;
     _sum_cpu_limit += wg->cpu_limit();
     reassign_worker_to_wgs();
@@ -282,6 +349,24 @@ void WorkGroupManager::create_workgroup_unlocked(const WorkGroupPtr& wg) {
     _workgroup_versions[wg->id()] = wg->version();
 }
 
+WorkGroupUsageMetrics* WorkGroupManager::get_or_register_usage_metrics_unlocked(const WorkGroupPtr& wg) {
+    auto it = _usage_metrics.find(wg->id());
+    if (it != _usage_metrics.end()) {
+        return it->second.get();
+    }
+    auto usage_metrics = std::make_unique<WorkGroupUsageMetrics>();
+    auto* registry = StarRocksMetrics::instance()->metrics();
+    MetricLabels labels;
+    labels.add("workgroup", wg->name());
+    registry->register_metric("workgroup_cpu_ns", labels, &usage_metrics->cpu_ns);
+    registry->register_metric("workgroup_scan_rows", labels, &usage_metrics->scan_rows);
+    registry->register_metric("workgroup_scan_bytes", labels, &usage_metrics->scan_bytes);
+    registry->register_metric("workgroup_spill_bytes", labels, &usage_metrics->spill_bytes);
+    registry->register_metric("workgroup_network_sent_bytes", labels, &usage_metrics->network_sent_bytes);
+    registry->register_metric("workgroup_network_received_bytes", labels, &usage_metrics->network_received_bytes);
+    return _usage_metrics.emplace(wg->id(), std::move(usage_metrics)).first->second.get();
+}
+
 void WorkGroupManager::alter_workgroup_unlocked(const WorkGroupPtr& wg) {
     create_workgroup_unlocked(wg);
 }
@@ -13,6 +13,7 @@
 #include "runtime/mem_tracker.h"
 #include "storage/olap_define.h"
 #include "util/blocking_queue.hpp"
+#include "util/metrics.h"
 #include "util/priority_thread_pool.hpp"
 
 namespace starrocks {
@@ -34,6 +35,18 @@ using WorkGroupPtr = std::shared_ptr<WorkGroup>;
 using WorkGroupPtrSet = std::unordered_set<WorkGroupPtr>;
 using WorkGroupType = TWorkGroupType::type;
 
+// The resource usage accumulated by the queries of a workgroup, exported with the label workgroup=<name>.
+// It's shared by all the versions of a workgroup and is never freed, so the queries can hold it without
+// holding the workgroup.
+struct WorkGroupUsageMetrics {
+    METRIC_DEFINE_INT_COUNTER(cpu_ns, MetricUnit::NANOSECONDS);
+    METRIC_DEFINE_INT_COUNTER(scan_rows, MetricUnit::ROWS);
+    METRIC_DEFINE_INT_COUNTER(scan_bytes, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_COUNTER(spill_bytes, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_COUNTER(network_sent_bytes, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_COUNTER(network_received_bytes, MetricUnit::BYTES);
+};
+
 // WorkGroup is the unit of resource isolation, it has {CPU, Memory, Concurrency} quotas which limit the
 // resource usage of the queries belonging to the WorkGroup. Each user has be bound to a WorkGroup, when
 // the user issues a query, then the corresponding WorkGroup is chosen to manage the query.
@@ -49,6 +62,8 @@ public:
     void init();
 
     MemTracker* mem_tracker() { return _mem_tracker.get(); }
+    WorkGroupUsageMetrics* usage_metrics() const { return _usage_metrics; }
+    void set_usage_metrics(WorkGroupUsageMetrics* usage_metrics) { _usage_metrics = usage_metrics; }
     double get_mem_limit() const { return _memory_limit; }
     pipeline::DriverQueue* driver_queue() { return _driver_queue.get(); }
     ScanTaskQueue* scan_task_queue() { return _scan_task_queue.get(); }
@@ -72,6 +87,19 @@ public:
     void increment_real_runtime_ns(int64_t real_runtime_ns) { _vruntime_ns += real_runtime_ns / _cpu_limit; }
     void set_vruntime_ns(int64_t vruntime_ns) { _vruntime_ns = vruntime_ns; }
 
+    // The hard cap of cpu usage in number of cores, which is disabled if it is non-positive.
+    // Different from _cpu_limit, which is a soft weight to share cpu with the other workgroups,
+    // the workgroup cannot exceed the hard cap even if the other workgroups are idle.
+    double cpu_hard_limit() const { return _cpu_hard_limit; }
+    bool has_cpu_hard_limit() const { return _cpu_hard_limit > 0; }
+    // Charge the cpu time consumed by the drivers and scan tasks of this workgroup to the cpu bandwidth.
+    void charge_cpu_bandwidth(int64_t cpu_time_ns);
+    // Return true, if the workgroup has used up the cpu bandwidth of the current period,
+    // and then the driver queue and scan task queue shouldn't pick it until the next period.
+    bool is_cpu_throttled();
+    int64_t cpu_throttled_time_ns() const;
+    int64_t num_cpu_throttled_periods() const;
+
     double get_cpu_expected_use_ratio() const;
     double get_cpu_actual_use_ratio() const;
     void set_cpu_actual_use_ratio(double ratio) { _cpu_actual_use_ratio = ratio; }
@@ -154,6 +182,7 @@ private:
     int64_t _version;
 
     size_t _cpu_limit;
+    double _cpu_hard_limit = 0;
     double _memory_limit;
     size_t _concurrency;
     WorkGroupType _type;
@@ -164,6 +193,7 @@ private:
     int64_t _big_query_cpu_core_second_limit = 0;
 
     std::shared_ptr<starrocks::MemTracker> _mem_tracker = nullptr;
+    WorkGroupUsageMetrics* _usage_metrics = nullptr;
 
     pipeline::DriverQueuePtr _driver_queue = nullptr;
     int64_t _vruntime_ns = 0;
@@ -190,6 +220,18 @@ private:
     double _cpu_actual_use_ratio = 0;
 
     std::atomic<int64_t> _num_queries = 0;
+
+    // The cpu bandwidth used by the hard cap, which is shared by DriverQueueWithWorkGroup and
+    // ScanTaskQueueWithWorkGroup, so it is guarded by its own mutex.
+    void _refill_cpu_bandwidth_locked(int64_t now_ns);
+    mutable std::mutex _cpu_bandwidth_mutex;
+    int64_t _cpu_period_end_ns = 0;
+    // The cpu time consumed beyond the quota of a period is carried over to the next periods.
+    int64_t _cpu_period_used_ns = 0;
+    // The time when the workgroup begins to be throttled in the current period, or 0 if it isn't throttled.
+    int64_t _cpu_throttled_since_ns = 0;
+    int64_t _cpu_throttled_time_ns = 0;
+    int64_t _num_cpu_throttled_periods = 0;
 };
 
 class WorkerOwnerManager {
@@ -262,10 +304,16 @@ private:
     // WorkGroupManager::_mutex is held when invoking this method.
     void reassign_worker_to_wgs();
 
+    // Return the usage metrics of the workgroup, which are registered at the first version of it.
+    // WorkGroupManager::_mutex is held when invoking this method.
+    WorkGroupUsageMetrics* get_or_register_usage_metrics_unlocked(const WorkGroupPtr& wg);
+
     std::shared_mutex _mutex;
     std::unordered_map<int128_t, WorkGroupPtr> _workgroups;
     std::unordered_map<int64_t, int64_t> _workgroup_versions;
     std::list<int128_t> _workgroup_expired_versions;
+    // workgroup id -> usage metrics.
+    std::unordered_map<int64_t, std::unique_ptr<WorkGroupUsageMetrics>> _usage_metrics;
 
     std::atomic<size_t> _sum_cpu_limit = 0;
     std::atomic<int64_t> _sum_cpu_runtime_ns = 0;
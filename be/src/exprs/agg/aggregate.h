@@ -104,6 +104,22 @@ public:
                                            int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                            int64_t frame_end) const {}
 
+    // For window functions with sliding frames
+    // Whether the rows of a frame could be added to the state in several batches, i.e. updating with
+    // [a, b) and then [b, c) is the same as updating with [a, c), so the state of a frame could be extended
+    // to the next frame instead of being computed from scratch.
+    virtual bool support_incremental_window_update() const { return false; }
+
+    // For window functions with sliding frames
+    // Whether the rows could be removed from the state by retract_batch_single_state, with the same result
+    // as computing the state of the remaining rows from scratch.
+    virtual bool support_retract() const { return false; }
+
+    // For window functions with sliding frames
+    // Remove the rows [frame_start, frame_end), which were added by update_batch_single_state, from the state.
+    virtual void retract_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                            int64_t frame_start, int64_t frame_end) const {}
+
     // For window functions
     // A peer group is all of the rows that are peers within the specified ordering.
     // Rows are peers if they compare equal to each other using the specified ordering expression.
@@ -143,11 +159,18 @@ public:
     size_t alignof_size() const final { return alignof(State); }
 };
 
+// The states of the rows of a chunk are scattered in the memory of the groups, so the batch updates
+// prefetch the state of the row some rows ahead.
+static constexpr size_t AGG_STATE_PREFETCH_DIST = 16;
+
 template <typename State, typename Derived>
 class AggregateFunctionBatchHelper : public AggregateFunctionStateHelper<State> {
     void update_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
                       AggDataPtr* states) const override {
         for (size_t i = 0; i < chunk_size; ++i) {
+            if (i + AGG_STATE_PREFETCH_DIST < chunk_size) {
+                __builtin_prefetch(states[i + AGG_STATE_PREFETCH_DIST] + state_offset, 1);
+            }
             static_cast<const Derived*>(this)->update(ctx, columns, states[i] + state_offset, i);
         }
     }
@@ -172,6 +195,9 @@ class AggregateFunctionBatchHelper : public AggregateFunctionStateHelper<State>
     void merge_batch(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column* column,
                      AggDataPtr* states) const override {
         for (size_t i = 0; i < chunk_size; ++i) {
+            if (i + AGG_STATE_PREFETCH_DIST < chunk_size) {
+                __builtin_prefetch(states[i + AGG_STATE_PREFETCH_DIST] + state_offset, 1);
+            }
             static_cast<const Derived*>(this)->merge(ctx, column, states[i] + state_offset, i);
         }
     }
@@ -85,6 +85,27 @@ public:
         }
     }
 
+    bool support_incremental_window_update() const override { return true; }
+
+    // The sums of floats are not retracted, the result would drift from the average of the remaining rows, and
+    // neither are the sums of bigint, which are accumulated as double too.
+    static constexpr bool kRetractable = pt_is_decimal<PT> || pt_is_boolean<PT> || PT == TYPE_TINYINT ||
+                                         PT == TYPE_SMALLINT || PT == TYPE_INT;
+
+    bool support_retract() const override { return kRetractable; }
+
+    void retract_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                    int64_t frame_start, int64_t frame_end) const override {
+        if constexpr (kRetractable) {
+            const auto* column = down_cast<const InputColumnType*>(columns[0]);
+            const auto* data = column->get_data().data();
+            for (size_t i = frame_start; i < frame_end; ++i) {
+                this->data(state).sum -= data[i];
+            }
+            this->data(state).count -= (frame_end - frame_start);
+        }
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(column->is_binary());
         Slice slice = column->get(row_num).get_slice();
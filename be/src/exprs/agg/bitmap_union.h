@@ -24,6 +24,18 @@ public:
         this->data(state) |= *(col->get_object(row_num));
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        const BitmapColumn* col = down_cast<const BitmapColumn*>(columns[0]);
+        this->data(state).fast_union(chunk_size, col->get_data().data());
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column* column,
+                                  AggDataPtr __restrict state) const override {
+        const BitmapColumn* col = down_cast<const BitmapColumn*>(column);
+        this->data(state).fast_union(chunk_size, col->get_data().data());
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         BitmapColumn* col = down_cast<BitmapColumn*>(to);
         BitmapValue& bitmap = const_cast<BitmapValue&>(this->data(state));
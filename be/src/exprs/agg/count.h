@@ -36,6 +36,15 @@ public:
         this->data(state).count += (frame_end - frame_start);
     }
 
+    bool support_incremental_window_update() const override { return true; }
+
+    bool support_retract() const override { return true; }
+
+    void retract_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                    int64_t frame_start, int64_t frame_end) const override {
+        this->data(state).count -= (frame_end - frame_start);
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(column->is_numeric());
         const auto* input_column = down_cast<const Int64Column*>(column);
@@ -127,6 +136,23 @@ public:
         }
     }
 
+    bool support_incremental_window_update() const override { return true; }
+
+    bool support_retract() const override { return true; }
+
+    void retract_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                    int64_t frame_start, int64_t frame_end) const override {
+        if (columns[0]->has_null()) {
+            const auto* nullable_column = down_cast<const NullableColumn*>(columns[0]);
+            const uint8_t* null_data = nullable_column->immutable_null_column_data().data();
+            for (size_t i = frame_start; i < frame_end; ++i) {
+                this->data(state).count -= !null_data[i];
+            }
+        } else {
+            this->data(state).count -= (frame_end - frame_start);
+        }
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(column->is_numeric());
         const auto* input_column = down_cast<const Int64Column*>(column);
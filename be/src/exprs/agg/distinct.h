@@ -219,7 +219,12 @@ struct DistinctAggregateStateV2<PT, SumPT, FixedLengthPTGuard<PT>> {
     size_t deserialize_and_merge(const uint8_t* src, size_t len) {
         size_t size = 0;
         memcpy(&size, src, sizeof(size));
-        set.rehash(set.size() + size);
+        // The partial sets of the same group overlap a lot in the final phase, reserving the sum of the sizes for
+        // each merge would double the memory of the set. Only the first merge reserves the exact size, and the
+        // later merges grow the set on demand.
+        if (set.empty()) {
+            set.reserve(size);
+        }
 
         size_t old_size = set.size();
         src += sizeof(size);
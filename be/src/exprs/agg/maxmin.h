@@ -195,6 +195,10 @@ public:
         }
     }
 
+    // Not for the binary one, whose state refers to the bytes of the column, which are moved when the rows
+    // before the partition are removed.
+    bool support_incremental_window_update() const override { return true; }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         DCHECK(!column->is_nullable() && !column->is_binary());
         const auto* input_column = down_cast<const InputColumnType*>(column);
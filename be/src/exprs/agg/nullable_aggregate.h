@@ -224,7 +224,12 @@ public:
                       AggDataPtr* states) const override {
         // Scalar function compute will return non-nullable column
         // for nullable column when the real whole chunk data all not-null.
-        if (columns[0]->is_nullable()) {
+        if (!columns[0]->is_nullable()) {
+            _update_batch_not_null(ctx, chunk_size, state_offset, columns, states);
+        } else if (!columns[0]->has_null()) {
+            const Column* data_column = &down_cast<const NullableColumn*>(columns[0])->data_column_ref();
+            _update_batch_not_null(ctx, chunk_size, state_offset, &data_column, states);
+        } else {
             const auto* column = down_cast<const NullableColumn*>(columns[0]);
             const Column* data_column = &column->data_column_ref();
             const uint8_t* f_data = column->null_column()->raw_data();
@@ -279,12 +284,6 @@ public:
                     this->nested_function->process_null(ctx, this->data(states[i] + state_offset).mutable_nest_state());
                 }
             }
-        } else {
-            for (size_t i = 0; i < chunk_size; ++i) {
-                this->data(states[i] + state_offset).is_null = false;
-                this->nested_function->update(ctx, columns, this->data(states[i] + state_offset).mutable_nest_state(),
-                                              i);
-            }
         }
     }
 
@@ -499,6 +498,59 @@ public:
                                                              peer_group_start, peer_group_end, frame_start, frame_end);
         }
     }
+
+    bool support_incremental_window_update() const override {
+        return IgnoreNull && this->nested_function->support_incremental_window_update();
+    }
+
+    // The state is not set back to null when all the non-null rows are retracted, the caller has to reset it.
+    bool support_retract() const override { return IgnoreNull && this->nested_function->support_retract(); }
+
+    void retract_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                    int64_t frame_start, int64_t frame_end) const override {
+        if (frame_start >= frame_end) {
+            return;
+        }
+
+        if (columns[0]->is_nullable()) {
+            const auto* column = down_cast<const NullableColumn*>(columns[0]);
+            const Column* data_column = &column->data_column_ref();
+            if (!column->has_null()) {
+                this->nested_function->retract_batch_single_state(ctx, this->data(state).mutable_nest_state(),
+                                                                  &data_column, frame_start, frame_end);
+                return;
+            }
+
+            const uint8_t* f_data = column->null_column()->raw_data();
+            for (size_t i = frame_start; i < frame_end; ++i) {
+                if (f_data[i] == 0) {
+                    this->nested_function->retract_batch_single_state(ctx, this->data(state).mutable_nest_state(),
+                                                                      &data_column, i, i + 1);
+                }
+            }
+        } else {
+            this->nested_function->retract_batch_single_state(ctx, this->data(state).mutable_nest_state(), columns,
+                                                              frame_start, frame_end);
+        }
+    }
+
+private:
+    // Updates the nested states of all the rows by one call of the nested function, which could be
+    // devirtualized and specialized by the nested function, e.g. sum and count over the fixed length
+    // columns, or the distinct functions which prefetch the hash tables.
+    void _update_batch_not_null(FunctionContext* ctx, size_t chunk_size, size_t state_offset, const Column** columns,
+                                AggDataPtr* states) const {
+        if (chunk_size == 0) {
+            return;
+        }
+        for (size_t i = 0; i < chunk_size; ++i) {
+            this->data(states[i] + state_offset).is_null = false;
+        }
+        // All the states have the same layout, so the nested states are at the same offset of them.
+        AggDataPtr first_state = states[0] + state_offset;
+        size_t nested_state_offset = this->data(first_state).mutable_nest_state() - first_state;
+        this->nested_function->update_batch(ctx, chunk_size, state_offset + nested_state_offset, columns, states);
+    }
 };
 
 template <typename State>
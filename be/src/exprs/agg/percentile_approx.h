@@ -44,6 +44,18 @@ public:
         data(state).is_null = false;
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        if (chunk_size == 0 || columns[0]->is_nullable()) {
+            AggregateFunctionBatchHelper::update_batch_single_state(ctx, chunk_size, columns, state);
+            return;
+        }
+        const auto& values = down_cast<const DoubleColumn*>(columns[0])->get_data();
+        data(state).percentile->add_batch(values.data(), chunk_size);
+        data(state).targetQuantile = columns[1]->get(0).get_double();
+        data(state).is_null = false;
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         Slice src;
         if (column->is_nullable()) {
@@ -79,12 +91,12 @@ public:
             if (data(state).is_null) {
                 column->append_default();
             } else {
-                down_cast<BinaryColumn*>(column->data_column().get())->append(Slice(result, size));
+                down_cast<BinaryColumn*>(column->data_column().get())->append(Slice(result, size + sizeof(double)));
                 column->null_column_data().push_back(0);
             }
         } else {
             BinaryColumn* column = down_cast<BinaryColumn*>(to);
-            column->append(Slice(result, size));
+            column->append(Slice(result, size + sizeof(double)));
         }
     }
 
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "column/type_traits.h"
 #include "exprs/agg/aggregate.h"
 #include "gutil/casts.h"
@@ -54,8 +56,12 @@ public:
                                    AggDataPtr __restrict state) const override {
         const auto* column = down_cast<const InputColumnType*>(columns[0]);
         const auto* data = column->get_data().data();
-        for (size_t i = 0; i < chunk_size; ++i) {
-            this->data(state).sum += data[i];
+        if constexpr (kNarrowSum) {
+            this->data(state).sum += _narrow_sum(data, 0, chunk_size);
+        } else {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                this->data(state).sum += data[i];
+            }
         }
     }
 
@@ -64,8 +70,28 @@ public:
                                    int64_t frame_end) const override {
         const auto* column = down_cast<const InputColumnType*>(columns[0]);
         const auto* data = column->get_data().data();
-        for (size_t i = frame_start; i < frame_end; ++i) {
-            this->data(state).sum += data[i];
+        if constexpr (kNarrowSum) {
+            this->data(state).sum += _narrow_sum(data, frame_start, frame_end);
+        } else {
+            for (size_t i = frame_start; i < frame_end; ++i) {
+                this->data(state).sum += data[i];
+            }
+        }
+    }
+
+    bool support_incremental_window_update() const override { return true; }
+
+    // The sum of floats is not retracted, the result would drift from the sum of the remaining rows.
+    bool support_retract() const override { return pt_is_sum_bigint<PT> || pt_is_largeint<PT> || pt_is_decimal<PT>; }
+
+    void retract_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
+                                    int64_t frame_start, int64_t frame_end) const override {
+        if constexpr (pt_is_sum_bigint<PT> || pt_is_largeint<PT> || pt_is_decimal<PT>) {
+            const auto* column = down_cast<const InputColumnType*>(columns[0]);
+            const auto* data = column->get_data().data();
+            for (size_t i = frame_start; i < frame_end; ++i) {
+                this->data(state).sum -= data[i];
+            }
         }
     }
 
@@ -118,6 +144,34 @@ public:
     }
 
     std::string get_name() const override { return "sum"; }
+
+private:
+    // The decimal32/decimal64 values summed into a decimal128 result are accumulated in 64-bit lanes, which
+    // the compiler vectorizes, and widened once per batch instead of doing an int128 add per row.
+    static constexpr bool kNarrowSum =
+            std::is_same_v<ResultType, int128_t> && (std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>);
+
+    static ResultType _narrow_sum(const T* data, size_t begin, size_t end) {
+        if constexpr (std::is_same_v<T, int32_t>) {
+            // Can't overflow unless there are more than 2^32 rows.
+            int64_t sum = 0;
+            for (size_t i = begin; i < end; ++i) {
+                sum += data[i];
+            }
+            return sum;
+        } else {
+            // Each value is split into its unsigned low 32 bits and its signed high 32 bits, neither of
+            // the two 64-bit sums overflows unless there are more than 2^31 rows.
+            uint64_t sum_low = 0;
+            int64_t sum_high = 0;
+            for (size_t i = begin; i < end; ++i) {
+                sum_low += static_cast<uint32_t>(data[i]);
+                sum_high += data[i] >> 32;
+            }
+            return static_cast<int128_t>(sum_high) * (static_cast<int128_t>(1) << 32) +
+                   static_cast<int128_t>(sum_low);
+        }
+    }
 };
 
 template <PrimitiveType PT, typename = DecimalPTGuard<PT>>
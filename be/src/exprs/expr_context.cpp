@@ -27,9 +27,11 @@
 #include <sstream>
 #include <stdexcept>
 
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exprs/expr.h"
 #include "exprs/vectorized/column_ref.h"
+#include "exprs/vectorized/fused_expr.h"
 #include "runtime/mem_pool.h"
 #include "runtime/runtime_state.h"
 #include "udf/udf_internal.h"
@@ -68,7 +70,11 @@ Status ExprContext::open(RuntimeState* state) {
     // original's fragment state and only need to have thread-local state initialized.
     FunctionContext::FunctionStateScope scope =
             _is_clone ? FunctionContext::THREAD_LOCAL : FunctionContext::FRAGMENT_LOCAL;
-    return _root->open(state, this, scope);
+    RETURN_IF_ERROR(_root->open(state, this, scope));
+    if (!_is_clone && config::enable_fused_expr_evaluation) {
+        _fused_expr = vectorized::FusedExpr::compile(_root);
+    }
+    return Status::OK();
 }
 
 Status ExprContext::open(std::vector<ExprContext*> evals, RuntimeState* state) {
@@ -111,6 +117,7 @@ Status ExprContext::clone(RuntimeState* state, ExprContext** new_ctx) {
     DCHECK(*new_ctx == nullptr);
 
     *new_ctx = state->obj_pool()->add(new ExprContext(_root));
+    (*new_ctx)->_fused_expr = _fused_expr;
     (*new_ctx)->_pool = std::make_unique<MemPool>();
     for (auto& _fn_context : _fn_contexts) {
         (*new_ctx)->_fn_contexts.push_back(_fn_context->impl()->clone((*new_ctx)->_pool.get()));
@@ -177,6 +184,12 @@ std::string ExprContext::get_error_msg() const {
 }
 
 StatusOr<ColumnPtr> ExprContext::evaluate(vectorized::Chunk* chunk) {
+    if (_fused_expr != nullptr && chunk != nullptr && chunk->num_rows() > 0) {
+        ColumnPtr ptr = _fused_expr->evaluate(chunk);
+        if (ptr != nullptr) {
+            return ptr;
+        }
+    }
     return evaluate(_root, chunk);
 }
 
@@ -39,6 +39,7 @@ namespace starrocks {
 namespace vectorized {
 class OlapScanNode;
 class Chunk;
+class FusedExpr;
 } // namespace vectorized
 
 class Expr;
@@ -143,6 +144,9 @@ private:
     /// The expr tree this context is for.
     Expr* _root;
 
+    /// The fused evaluation of _root if it's supported, shared by the clones.
+    std::shared_ptr<const vectorized::FusedExpr> _fused_expr;
+
     /// True if this context came from a Clone() call. Used to manage FunctionStateScope.
     bool _is_clone;
 
@@ -20,6 +20,7 @@ std::pair<Columns, ColumnPtr> JsonEach::process(TableFunctionState* state, bool*
     result.emplace_back(key_column_ptr);
     result.emplace_back(value_column_ptr);
     auto offset_column = UInt32Column::create();
+    offset_column->reserve(json_column->size() + 1);
     int offset = 0;
 
     offset_column->append(offset);
@@ -43,9 +44,8 @@ std::pair<Columns, ColumnPtr> JsonEach::process(TableFunctionState* state, bool*
                 offset++;
                 arr_idx++;
             }
-        } else {
-            continue;
         }
+        // Each input row has an offset, even if it's not an object or array and generates no result.
         offset_column->append(offset);
     }
 
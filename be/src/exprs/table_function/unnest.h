@@ -25,29 +25,29 @@ public:
         if (arg0->has_null()) {
             NullableColumn* nullable_array_column = down_cast<NullableColumn*>(arg0);
 
-            auto offset_column = col_array->offsets_column();
-            ColumnPtr compacted_offset_column = offset_column->clone_empty();
-            compacted_offset_column->append_datum(Datum(0));
+            // The elements of the null arrays are skipped, the remaining ones are gathered by one append_selective
+            // rather than appended array by array.
+            const auto& offsets = col_array->offsets().get_data();
+            auto compacted_offset_column = UInt32Column::create();
+            auto& compacted_offsets = compacted_offset_column->get_data();
+            compacted_offsets.resize(nullable_array_column->size() + 1);
+            compacted_offsets[0] = 0;
 
-            ColumnPtr compacted_array_elements = col_array->elements_column()->clone_empty();
-            int compact_offset = 0;
-
-            for (int row_idx = 0; row_idx < nullable_array_column->size(); ++row_idx) {
-                if (nullable_array_column->is_null(row_idx)) {
-                    compact_offset +=
-                            offset_column->get(row_idx + 1).get_int32() - offset_column->get(row_idx).get_int32();
-                    int32 offset = offset_column->get(row_idx + 1).get_int32();
-                    compacted_offset_column->append_datum(offset - compact_offset);
-                } else {
-                    int32 offset = offset_column->get(row_idx + 1).get_int32();
-                    compacted_offset_column->append_datum(offset - compact_offset);
-
-                    compacted_array_elements->append(
-                            *(col_array->elements_column()), offset_column->get(row_idx).get_int32(),
-                            offset_column->get(row_idx + 1).get_int32() - offset_column->get(row_idx).get_int32());
+            std::vector<uint32_t> element_indexes;
+            element_indexes.reserve(offsets.back());
+            for (size_t row_idx = 0; row_idx < nullable_array_column->size(); ++row_idx) {
+                if (!nullable_array_column->is_null(row_idx)) {
+                    for (uint32_t i = offsets[row_idx]; i < offsets[row_idx + 1]; ++i) {
+                        element_indexes.emplace_back(i);
+                    }
                 }
+                compacted_offsets[row_idx + 1] = element_indexes.size();
             }
 
+            ColumnPtr compacted_array_elements = col_array->elements_column()->clone_empty();
+            compacted_array_elements->append_selective(*col_array->elements_column(), element_indexes.data(), 0,
+                                                       element_indexes.size());
+
             result.emplace_back(compacted_array_elements);
             return std::make_pair(result, compacted_offset_column);
         } else {
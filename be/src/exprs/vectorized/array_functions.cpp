@@ -490,6 +490,35 @@ private:
             return (*null_map)[idx] != 0;
         };
 
+        if constexpr (ConstTarget && std::is_arithmetic_v<ValueType>) {
+            // Compare all the elements with the constant target in one branch-free pass, then look for the
+            // first match of each array.
+            const size_t num_elements = offsets_ptr[num_array];
+            raw::RawVector<uint8_t> matches(num_elements);
+            uint8_t* matches_ptr = matches.data();
+            for (size_t k = 0; k < num_elements; k++) {
+                matches_ptr[k] = (elements_ptr[k] == first_target);
+            }
+            if constexpr (NullableElement) {
+                const uint8_t* nulls_ptr = null_map_elements->data();
+                for (size_t k = 0; k < num_elements; k++) {
+                    matches_ptr[k] &= !nulls_ptr[k];
+                }
+            }
+            for (size_t i = 0; i < num_array; i++) {
+                size_t offset = offsets_ptr[i];
+                size_t array_size = offsets_ptr[i + 1] - offset;
+                const auto* match = static_cast<const uint8_t*>(
+                        array_size > 0 ? memchr(matches_ptr + offset, 1, array_size) : nullptr);
+                if constexpr (PositionEnabled) {
+                    result_ptr[i] = match == nullptr ? 0 : match - (matches_ptr + offset) + 1;
+                } else {
+                    result_ptr[i] = match != nullptr;
+                }
+            }
+            return result;
+        }
+
         for (size_t i = 0; i < num_array; i++) {
             size_t offset = offsets_ptr[i];
             size_t array_size = offsets_ptr[i + 1] - offsets_ptr[i];
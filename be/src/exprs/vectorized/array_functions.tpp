@@ -8,6 +8,37 @@
 #include "util/orlp/pdqsort.h"
 
 namespace starrocks::vectorized {
+
+// ArrayElementsView reads the elements of each array straight from the offsets and the element column of an
+// ArrayColumn, instead of materializing a DatumArray for every row.
+template <PrimitiveType PT>
+class ArrayElementsView {
+public:
+    using CppType = RunTimeCppType<PT>;
+
+    explicit ArrayElementsView(const ArrayColumn& column) : _offsets(column.offsets().get_data().data()) {
+        const Column* elements = &column.elements();
+        if (elements->is_nullable()) {
+            const auto* nullable = down_cast<const NullableColumn*>(elements);
+            _nulls = nullable->has_null() ? nullable->null_column()->get_data().data() : nullptr;
+            elements = nullable->data_column().get();
+        }
+        _data = down_cast<const RunTimeColumnType<PT>*>(elements)->get_data().data();
+    }
+
+    // The elements of the array at |row| are in [begin(row), end(row)).
+    size_t begin(size_t row) const { return _offsets[row]; }
+    size_t end(size_t row) const { return _offsets[row + 1]; }
+
+    bool is_null(size_t idx) const { return _nulls != nullptr && _nulls[idx]; }
+    const CppType& value(size_t idx) const { return _data[idx]; }
+
+private:
+    const uint32_t* _offsets;
+    const uint8_t* _nulls = nullptr;
+    const CppType* _data;
+};
+
 template <PrimitiveType PT>
 class ArrayDistinct {
 public:
@@ -46,10 +77,11 @@ private:
             dest_null_data = src_nullable_column->immutable_null_column_data();
             dest_nullable_column.set_has_null(src_nullable_column->has_null());
 
+            ArrayElementsView<PT> items(*src_data_column);
             if (src_nullable_column->has_null()) {
                 for (size_t i = 0; i < chunk_size; i++) {
                     if (!src_nullable_column->is_null(i)) {
-                        _array_distinct_item<HashSet>(*src_data_column, i, &hash_set, &dest_data_column);
+                        _array_distinct_item<HashSet>(items, i, &hash_set, &dest_data_column);
                         hash_set.clear();
                     } else {
                         dest_data_column.append_default();
@@ -57,7 +89,7 @@ private:
                 }
             } else {
                 for (size_t i = 0; i < chunk_size; i++) {
-                    _array_distinct_item<HashSet>(*src_data_column, i, &hash_set, &dest_data_column);
+                    _array_distinct_item<HashSet>(items, i, &hash_set, &dest_data_column);
                     hash_set.clear();
                 }
             }
@@ -65,8 +97,9 @@ private:
             const auto* src_data_column = down_cast<const ArrayColumn*>(src_column.get());
             auto* dest_data_column = down_cast<ArrayColumn*>(dest_column.get());
 
+            ArrayElementsView<PT> items(*src_data_column);
             for (size_t i = 0; i < chunk_size; i++) {
-                _array_distinct_item<HashSet>(*src_data_column, i, &hash_set, dest_data_column);
+                _array_distinct_item<HashSet>(items, i, &hash_set, dest_data_column);
                 hash_set.clear();
             }
         }
@@ -74,18 +107,14 @@ private:
     }
 
     template <typename HashSet>
-    static void _array_distinct_item(const ArrayColumn& column, size_t index, HashSet* hash_set,
+    static void _array_distinct_item(const ArrayElementsView<PT>& items, size_t index, HashSet* hash_set,
                                      ArrayColumn* dest_column) {
         bool has_null = false;
-        // TODO: may be has performance problem, optimize later
-        Datum v = column.get(index);
-        const auto& items = v.get<DatumArray>();
-
-        for (const auto& item : items) {
-            if (item.is_null()) {
+        for (size_t i = items.begin(index); i < items.end(index); ++i) {
+            if (items.is_null(i)) {
                 has_null = true;
             } else {
-                hash_set->emplace(item.get<CppType>());
+                hash_set->emplace(items.value(i));
             }
         }
 
@@ -150,15 +179,16 @@ private:
             dest_null_data = src_nullable_column->immutable_null_column_data();
             dest_nullable_column.set_has_null(src_nullable_column->has_null());
 
+            ArrayElementsView<PT> items(*src_data_column);
             if (src_nullable_column->has_null()) {
                 for (size_t i = 0; i < chunk_size; i++) {
                     if (!src_nullable_column->is_null(i)) {
-                        _array_difference_item(*src_data_column, i, &dest_data_column);
+                        _array_difference_item(items, i, &dest_data_column);
                     }
                 }
             } else {
                 for (size_t i = 0; i < chunk_size; i++) {
-                    _array_difference_item(*src_data_column, i, &dest_data_column);
+                    _array_difference_item(items, i, &dest_data_column);
                 }
             }
         } else {
@@ -166,45 +196,35 @@ private:
             dest_column = ArrayColumn::create(dest_column_data, UInt32Column::create(src_data_column->offsets()));
 
             auto* dest_data_column = down_cast<ArrayColumn*>(dest_column.get());
+            ArrayElementsView<PT> items(*src_data_column);
             for (size_t i = 0; i < chunk_size; i++) {
-                _array_difference_item(*src_data_column, i, dest_data_column);
+                _array_difference_item(items, i, dest_data_column);
             }
         }
+        down_cast<NullableColumn*>(dest_column_data.get())->update_has_null();
         return dest_column;
     }
 
-    static void _array_difference_item(const ArrayColumn& column, size_t index, ArrayColumn* dest_column) {
-        Datum v = column.get(index);
-        const auto& items = v.get<DatumArray>();
-
-        auto& dest_data_column = dest_column->elements_column();
-        for (size_t i = 0; i < items.size(); ++i) {
-            if (i == 0) {
-                if (items[i].is_null()) {
-                    dest_data_column->append_nulls(1);
-                } else {
-                    if constexpr (pt_is_integer<PT> || pt_is_boolean<PT>) {
-                        dest_data_column->append_datum((int64_t)0);
-                    } else if constexpr (pt_is_float<PT>) {
-                        dest_data_column->append_datum((double)0);
-                    } else {
-                        dest_data_column->append_datum((DecimalV2Value)0);
-                    }
-                }
+    // The differences are written into the data and the null column of the elements directly.
+    static void _array_difference_item(const ArrayElementsView<PT>& items, size_t index, ArrayColumn* dest_column) {
+        using ResultColumnType =
+                std::conditional_t<pt_is_float<PT>, DoubleColumn,
+                                   std::conditional_t<pt_is_decimalv2<PT>, DecimalColumn, Int64Column>>;
+        using ResultCppType = typename ResultColumnType::ValueType;
+
+        auto* dest_elements = down_cast<NullableColumn*>(dest_column->elements_column().get());
+        auto& dest_data = down_cast<ResultColumnType*>(dest_elements->data_column().get())->get_data();
+        auto& dest_nulls = dest_elements->null_column_data();
+
+        const size_t begin = items.begin(index);
+        const size_t end = items.end(index);
+        for (size_t i = begin; i < end; ++i) {
+            bool is_null = items.is_null(i) || (i > begin && items.is_null(i - 1));
+            dest_nulls.push_back(is_null);
+            if (is_null || i == begin) {
+                dest_data.push_back(ResultCppType(0));
             } else {
-                if (items[i - 1].is_null() || items[i].is_null()) {
-                    dest_data_column->append_nulls(1);
-                } else {
-                    if constexpr (pt_is_integer<PT> || pt_is_boolean<PT>) {
-                        dest_data_column->append_datum(
-                                (int64_t)(items[i].get<CppType>() - items[i - 1].get<CppType>()));
-                    } else if constexpr (pt_is_float<PT>) {
-                        dest_data_column->append_datum((double)(items[i].get<CppType>() - items[i - 1].get<CppType>()));
-                    } else {
-                        dest_data_column->append_datum(
-                                (DecimalV2Value)(items[i].get<CppType>() - items[i - 1].get<CppType>()));
-                    }
-                }
+                dest_data.push_back((ResultCppType)(items.value(i) - items.value(i - 1)));
             }
         }
     }
@@ -242,6 +262,7 @@ private:
         }
 
         Int64Column* offset_column = nullptr;
+        ColumnPtr offset_holder;
         if (columns[1]->is_nullable()) {
             is_nullable = true;
             has_null = (columns[1]->has_null() || has_null);
@@ -254,11 +275,12 @@ private:
                 null_result = NullColumn::create(*src_nullable_column->null_column());
             }
         } else {
-            offset_column = down_cast<Int64Column*>(
-                    ColumnHelper::unpack_and_duplicate_const_column(chunk_size, columns[1]).get());
+            offset_holder = ColumnHelper::unpack_and_duplicate_const_column(chunk_size, columns[1]);
+            offset_column = down_cast<Int64Column*>(offset_holder.get());
         }
 
         Int64Column* length_column = nullptr;
+        ColumnPtr length_holder;
         // length_column is provided.
         if (columns.size() > 2) {
             if (columns[2]->is_nullable()) {
@@ -273,8 +295,8 @@ private:
                     null_result = NullColumn::create(*src_nullable_column->null_column());
                 }
             } else {
-                length_column = down_cast<Int64Column*>(
-                        ColumnHelper::unpack_and_duplicate_const_column(chunk_size, columns[2]).get());
+                length_holder = ColumnHelper::unpack_and_duplicate_const_column(chunk_size, columns[2]);
+                length_column = down_cast<Int64Column*>(length_holder.get());
             }
         }
 
@@ -290,14 +312,15 @@ private:
             dest_data_column = down_cast<ArrayColumn*>(dest_column.get());
         }
 
+        const auto& offsets = offset_column->get_data();
         if (columns.size() > 2) {
+            const auto& lengths = length_column->get_data();
             for (size_t i = 0; i < chunk_size; i++) {
-                _array_slice_item<true>(array_column, i, dest_data_column, offset_column->get(i).get_int64(),
-                                        length_column->get(i).get_int64());
+                _array_slice_item<true>(array_column, i, dest_data_column, offsets[i], lengths[i]);
             }
         } else {
             for (size_t i = 0; i < chunk_size; i++) {
-                _array_slice_item<false>(array_column, i, dest_data_column, offset_column->get(i).get_int64(), 0);
+                _array_slice_item<false>(array_column, i, dest_data_column, offsets[i], 0);
             }
         }
 
@@ -321,34 +344,30 @@ private:
             return;
         }
 
-        Datum v = column->get(index);
-        const auto& items = v.get<DatumArray>();
+        const auto& src_offsets = column->offsets().get_data();
+        const int64_t array_begin = src_offsets[index];
+        const int64_t array_size = src_offsets[index + 1] - array_begin;
 
         if (offset > 0) {
             // because offset start with 1.
             --offset;
         } else {
-            offset += items.size();
+            offset += array_size;
         }
 
-        auto& dest_data_column = dest_column->elements_column();
         int64_t end;
         if constexpr (with_length) {
-            end = std::max((int64_t)0, std::min((int64_t)items.size(), (offset + length)));
+            end = std::max((int64_t)0, std::min(array_size, (offset + length)));
         } else {
-            end = items.size();
+            end = array_size;
         }
         offset = (offset > 0 ? offset : 0);
-        for (size_t i = offset; i < end; ++i) {
-            if (items[i].is_null()) {
-                dest_data_column->append_nulls(1);
-            } else {
-                dest_data_column->append_datum(items[i]);
-            }
-        }
 
         // Protect when length < 0.
         auto offset_delta = ((end < offset) ? 0 : end - offset);
+        if (offset_delta > 0) {
+            dest_column->elements_column()->append(column->elements(), array_begin + offset, offset_delta);
+        }
         dest_offsets.emplace_back(dest_offsets.back() + offset_delta);
     }
 };
@@ -426,20 +445,14 @@ private:
 
     static void _array_concat_item(const std::vector<ArrayColumn*>& columns, size_t index, ArrayColumn* dest_column) {
         size_t num_rows = 0;
-        for (size_t i = 0; i < columns.size(); ++i) {
-            Datum v = columns[i]->get(index);
-            const auto& items = v.get<DatumArray>();
-
-            auto& dest_data_column = dest_column->elements_column();
-            for (size_t i = 0; i < items.size(); ++i) {
-                if (items[i].is_null()) {
-                    dest_data_column->append_nulls(1);
-                } else {
-                    dest_data_column->append_datum(items[i]);
-                }
+        auto& dest_data_column = dest_column->elements_column();
+        for (const ArrayColumn* column : columns) {
+            const auto& offsets = column->offsets().get_data();
+            size_t array_size = offsets[index + 1] - offsets[index];
+            if (array_size > 0) {
+                dest_data_column->append(column->elements(), offsets[index], array_size);
             }
-
-            num_rows += items.size();
+            num_rows += array_size;
         }
 
         auto& dest_offsets = dest_column->offsets_column()->get_data();
@@ -492,8 +505,10 @@ private:
         }
 
         HashSet hash_set;
+        ArrayElementsView<PT> left(*src_columns[0]);
+        ArrayElementsView<PT> right(*src_columns[1]);
         for (size_t i = 0; i < chunk_size; i++) {
-            _array_overlap_item<HashSet>(src_columns, i, &hash_set,
+            _array_overlap_item<HashSet>(left, right, i, &hash_set,
                                          static_cast<BooleanColumn*>(result_column.get())->get_data().data());
             hash_set.clear();
         }
@@ -506,42 +521,31 @@ private:
     }
 
     template <typename HashSet>
-    static void _array_overlap_item(const std::vector<ArrayColumn*>& columns, size_t index, HashSet* hash_set,
-                                    uint8_t* data) {
+    static void _array_overlap_item(const ArrayElementsView<PT>& left, const ArrayElementsView<PT>& right,
+                                    size_t index, HashSet* hash_set, uint8_t* data) {
         bool has_null = false;
 
-        {
-            Datum v = columns[0]->get(index);
-            const auto& items = v.get<DatumArray>();
-            for (const auto& item : items) {
-                if (item.is_null()) {
-                    has_null = true;
-                } else {
-                    hash_set->emplace(item.get<CppType>());
-                }
+        for (size_t i = left.begin(index); i < left.end(index); ++i) {
+            if (left.is_null(i)) {
+                has_null = true;
+            } else {
+                hash_set->emplace(left.value(i));
             }
         }
 
-        {
-            Datum v = columns[1]->get(index);
-            const auto& items = v.get<DatumArray>();
-            for (const auto& item : items) {
-                if (item.is_null()) {
-                    if (has_null) {
-                        data[index] = 1;
-                        return;
-                    }
-                } else {
-                    auto iter = hash_set->find(item.get<CppType>());
-                    if (iter != hash_set->end()) {
-                        data[index] = 1;
-                        return;
-                    }
+        for (size_t i = right.begin(index); i < right.end(index); ++i) {
+            if (right.is_null(i)) {
+                if (has_null) {
+                    data[index] = 1;
+                    return;
                 }
+            } else if (hash_set->find(right.value(i)) != hash_set->end()) {
+                data[index] = 1;
+                return;
             }
-
-            data[index] = 0;
         }
+
+        data[index] = 0;
     }
 };
 
@@ -642,9 +646,15 @@ private:
             dest_data_column = down_cast<ArrayColumn*>(dest_column.get());
         }
 
+        std::vector<ArrayElementsView<PT>> src_items;
+        src_items.reserve(src_columns.size());
+        for (const ArrayColumn* column : src_columns) {
+            src_items.emplace_back(*column);
+        }
+
         HashSet hash_set;
         for (size_t i = 0; i < chunk_size; i++) {
-            _array_intersect_item<HashSet>(src_columns, i, &hash_set, dest_data_column);
+            _array_intersect_item<HashSet>(src_items, i, &hash_set, dest_data_column);
             hash_set.clear();
         }
 
@@ -652,31 +662,29 @@ private:
     }
 
     template <typename HashSet>
-    static void _array_intersect_item(const std::vector<ArrayColumn*>& columns, size_t index, HashSet* hash_set,
-                                      ArrayColumn* dest_column) {
+    static void _array_intersect_item(const std::vector<ArrayElementsView<PT>>& columns, size_t index,
+                                      HashSet* hash_set, ArrayColumn* dest_column) {
         bool has_null = false;
 
         {
-            Datum v = columns[0]->get(index);
-            const auto& items = v.get<DatumArray>();
-            for (const auto& item : items) {
-                if (item.is_null()) {
+            const auto& items = columns[0];
+            for (size_t j = items.begin(index); j < items.end(index); ++j) {
+                if (items.is_null(j)) {
                     has_null = true;
                 } else {
-                    hash_set->emplace(CppTypeWithOverlapTimes(item.get<CppType>(), 0));
+                    hash_set->emplace(CppTypeWithOverlapTimes(items.value(j), 0));
                 }
             }
         }
 
         for (int i = 1; i < columns.size(); ++i) {
-            Datum v = columns[i]->get(index);
-            const auto& items = v.get<DatumArray>();
+            const auto& items = columns[i];
             bool local_has_null = false;
-            for (const auto& item : items) {
-                if (item.is_null()) {
+            for (size_t j = items.begin(index); j < items.end(index); ++j) {
+                if (items.is_null(j)) {
                     local_has_null = true;
                 } else {
-                    auto iter = hash_set->find(item.get<CppType>());
+                    auto iter = hash_set->find(items.value(j));
                     if (iter != hash_set->end()) {
                         if (iter->overlap_times < i) {
                             ++iter->overlap_times;
@@ -968,25 +976,24 @@ private:
                                    ColumnHelper::count_nulls(src_column);
         res.resize(chunk_size, byte_size);
 
+        ArrayElementsView<TYPE_VARCHAR> items(
+                *down_cast<const ArrayColumn*>(ColumnHelper::get_data_column(src_column.get())));
         for (size_t i = 0; i < chunk_size; i++) {
             if (src_column->is_null(i) || sep_column->is_null(i) || null_replace_column->is_null(i)) {
                 res.set_null(i);
                 continue;
             }
-            auto datum = src_column->get(i);
-            const auto& datum_array = datum.get_array();
             bool append = false;
             Slice sep_slice = sep_column->get(i).get_slice();
             Slice null_slice = null_replace_column->get(i).get_slice();
-            for (size_t j = 0; j < datum_array.size(); j++) {
+            for (size_t j = items.begin(i); j < items.end(i); j++) {
                 if (append) {
                     res.append_partial(sep_slice);
                 }
-                if (datum_array[j].is_null()) {
+                if (items.is_null(j)) {
                     res.append_partial(null_slice);
                 } else {
-                    Slice value_slice = datum_array[j].get_slice();
-                    res.append_partial(value_slice);
+                    res.append_partial(items.value(j));
                 }
                 append = true;
             }
@@ -1004,25 +1011,24 @@ private:
                            ColumnHelper::get_data_column(sep_column.get())->byte_size(0) * src_column->size();
         res.resize(chunk_size, byte_size);
 
+        ArrayElementsView<TYPE_VARCHAR> items(
+                *down_cast<const ArrayColumn*>(ColumnHelper::get_data_column(src_column.get())));
         for (size_t i = 0; i < chunk_size; i++) {
             if (src_column->is_null(i) || sep_column->is_null(i)) {
                 res.set_null(i);
                 continue;
             }
 
-            auto datum = src_column->get(i);
-            const auto& datum_array = datum.get_array();
             bool append = false;
             Slice sep_slice = sep_column->get(i).get_slice();
-            for (size_t j = 0; j < datum_array.size(); j++) {
-                if (datum_array[j].is_null()) {
+            for (size_t j = items.begin(i); j < items.end(i); j++) {
+                if (items.is_null(j)) {
                     continue;
                 }
                 if (append) {
                     res.append_partial(sep_slice);
                 }
-                Slice value_slice = datum_array[j].get_slice();
-                res.append_partial(value_slice);
+                res.append_partial(items.value(j));
                 append = true;
             }
             res.append_complete(i);
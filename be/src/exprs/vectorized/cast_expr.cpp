@@ -351,27 +351,59 @@ ColumnPtr cast_int_from_string_fn(ColumnPtr& column) {
 
 template <PrimitiveType FromType, PrimitiveType ToType>
 ColumnPtr cast_float_from_string_fn(ColumnPtr& column) {
-    ColumnViewer<TYPE_VARCHAR> viewer(column);
-    ColumnBuilder<ToType> builder(viewer.size());
-
     StringParser::ParseResult result;
+    auto parse = [&result](const Slice& slice, RunTimeCppType<ToType>* value) {
+        *value = StringParser::string_to_float<RunTimeCppType<ToType>>(slice.data, slice.size, &result);
+        return result != StringParser::PARSE_SUCCESS || std::isnan(*value) || std::isinf(*value);
+    };
 
-    for (int row = 0; row < viewer.size(); ++row) {
-        if (viewer.is_null(row)) {
-            builder.append_null();
-            continue;
+    int sz = column.get()->size();
+
+    if (column->only_null()) {
+        return ColumnHelper::create_const_null_column(sz);
+    }
+
+    if (column->is_constant()) {
+        auto* input = ColumnHelper::get_binary_column(column.get());
+        RunTimeCppType<ToType> r;
+        if (parse(input->get_slice(0), &r)) {
+            return ColumnHelper::create_const_null_column(sz);
         }
+        return ColumnHelper::create_const_column<ToType>(r, sz);
+    }
 
-        auto value = viewer.value(row);
-        RunTimeCppType<ToType> r =
-                StringParser::string_to_float<RunTimeCppType<ToType>>(value.data, value.size, &result);
+    // Parse into the data and the null column directly, rather than appending the rows one by one.
+    auto res_data_column = RunTimeColumnType<ToType>::create();
+    res_data_column->resize(sz);
+    auto& res_data = res_data_column->get_data();
 
-        bool is_null = (result != StringParser::PARSE_SUCCESS || std::isnan(r) || std::isinf(r));
+    if (column->is_nullable()) {
+        NullableColumn* input_column = down_cast<NullableColumn*>(column.get());
+        NullColumnPtr null_column = ColumnHelper::as_column<NullColumn>(input_column->null_column()->clone());
+        BinaryColumn* data_column = down_cast<BinaryColumn*>(input_column->data_column().get());
+        auto& null_data = down_cast<NullColumn*>(null_column.get())->get_data();
 
-        builder.append(r, is_null);
-    }
+        for (int i = 0; i < sz; ++i) {
+            if (!null_data[i]) {
+                null_data[i] = parse(data_column->get_slice(i), &res_data[i]);
+            }
+        }
+        return NullableColumn::create(std::move(res_data_column), std::move(null_column));
+    } else {
+        NullColumnPtr null_column = NullColumn::create(sz);
+        auto& null_data = null_column->get_data();
+        BinaryColumn* data_column = down_cast<BinaryColumn*>(column.get());
 
-    return builder.build(column->is_constant());
+        bool has_null = false;
+        for (int i = 0; i < sz; ++i) {
+            null_data[i] = parse(data_column->get_slice(i), &res_data[i]);
+            has_null |= null_data[i];
+        }
+        if (!has_null) {
+            return res_data_column;
+        }
+        return NullableColumn::create(std::move(res_data_column), std::move(null_column));
+    }
 }
 
 // tinyint
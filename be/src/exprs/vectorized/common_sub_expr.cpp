@@ -0,0 +1,254 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exprs/vectorized/common_sub_expr.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace starrocks::vectorized {
+
+namespace {
+
+// A sub expression, as the nodes [begin, end) of an expression in pre-order.
+struct SubExprRange {
+    // the index of the expression, the output expressions first, then the common ones.
+    size_t expr;
+    size_t begin;
+    size_t end;
+
+    size_t size() const { return end - begin; }
+};
+
+// Fills the end of the subtree of each node in |ends|, returns the end of the subtree rooted at |begin|.
+size_t build_subtree_ends(const std::vector<TExprNode>& nodes, size_t begin, std::vector<size_t>* ends) {
+    size_t pos = begin + 1;
+    for (int i = 0; i < nodes[begin].num_children; ++i) {
+        pos = build_subtree_ends(nodes, pos, ends);
+    }
+    (*ends)[begin] = pos;
+    return pos;
+}
+
+// The expressions with these nodes are left as they are: the dict mapping expressions are rewritten as a whole
+// by the global dict optimization, and the place holders refer to the input of their ancestors.
+bool is_rewritable(const TExpr& expr) {
+    for (const auto& node : expr.nodes) {
+        switch (node.node_type) {
+        case TExprNodeType::DICT_EXPR:
+        case TExprNodeType::PLACEHOLDER_EXPR:
+        case TExprNodeType::AGG_EXPR:
+        case TExprNodeType::TABLE_FUNCTION_EXPR:
+            return false;
+        default:
+            break;
+        }
+    }
+    return true;
+}
+
+// Whether the sub expression is worth being evaluated once: it computes something from the input columns,
+// and computes it deterministically.
+bool is_candidate(const std::vector<TExprNode>& nodes, size_t begin, size_t end) {
+    if (nodes[begin].num_children == 0) {
+        return false;
+    }
+    bool has_slot_ref = false;
+    for (size_t i = begin; i < end; ++i) {
+        const auto& node = nodes[i];
+        if (node.__isset.fn && is_nondeterministic_function(node.fn.name.function_name)) {
+            return false;
+        }
+        has_slot_ref |= node.node_type == TExprNodeType::SLOT_REF;
+    }
+    return has_slot_ref;
+}
+
+size_t hash_sub_expr(const std::vector<TExprNode>& nodes, size_t begin, size_t end) {
+    size_t hash = end - begin;
+    for (size_t i = begin; i < end; ++i) {
+        const auto& node = nodes[i];
+        hash = hash * 31 + node.node_type;
+        hash = hash * 31 + node.num_children;
+        if (node.__isset.fn) {
+            hash = hash * 31 + std::hash<std::string>()(node.fn.name.function_name);
+        }
+        if (node.__isset.slot_ref) {
+            hash = hash * 31 + node.slot_ref.slot_id;
+        }
+    }
+    return hash;
+}
+
+TExprNode make_slot_ref(const TExprNode& root, SlotId slot_id, TupleId tuple_id) {
+    TSlotRef slot_ref;
+    slot_ref.__set_slot_id(slot_id);
+    slot_ref.__set_tuple_id(tuple_id);
+
+    TExprNode node;
+    node.__set_node_type(TExprNodeType::SLOT_REF);
+    node.__set_type(root.type);
+    node.__set_num_children(0);
+    node.__set_output_scale(root.output_scale);
+    node.__set_slot_ref(slot_ref);
+    node.__set_is_nullable(root.__isset.is_nullable ? root.is_nullable : true);
+    return node;
+}
+
+// Reorders the common expressions so that each one is after the common expressions it references,
+// keeping the order of the independent ones.
+void sort_common_exprs(std::vector<std::pair<SlotId, TExpr>>* common_exprs) {
+    std::unordered_set<SlotId> common_slots;
+    for (const auto& [slot_id, expr] : *common_exprs) {
+        common_slots.insert(slot_id);
+    }
+
+    std::vector<std::pair<SlotId, TExpr>> sorted;
+    sorted.reserve(common_exprs->size());
+    std::vector<bool> emitted(common_exprs->size(), false);
+    std::unordered_set<SlotId> evaluated;
+    while (sorted.size() < common_exprs->size()) {
+        bool progress = false;
+        for (size_t i = 0; i < common_exprs->size(); ++i) {
+            if (emitted[i]) {
+                continue;
+            }
+            const auto& nodes = (*common_exprs)[i].second.nodes;
+            bool ready = std::all_of(nodes.begin(), nodes.end(), [&](const TExprNode& node) {
+                return !node.__isset.slot_ref || common_slots.count(node.slot_ref.slot_id) == 0 ||
+                       evaluated.count(node.slot_ref.slot_id) > 0;
+            });
+            if (ready) {
+                emitted[i] = true;
+                evaluated.insert((*common_exprs)[i].first);
+                sorted.emplace_back(std::move((*common_exprs)[i]));
+                progress = true;
+            }
+        }
+        if (!progress) {
+            // Should not happen, keep the rest as they are.
+            for (size_t i = 0; i < common_exprs->size(); ++i) {
+                if (!emitted[i]) {
+                    sorted.emplace_back(std::move((*common_exprs)[i]));
+                }
+            }
+            break;
+        }
+    }
+    common_exprs->swap(sorted);
+}
+
+} // namespace
+
+bool is_nondeterministic_function(const std::string& name) {
+    static const std::unordered_set<std::string> kNondeterministicFunctions = {"rand", "random", "uuid",
+                                                                              "uuid_numeric", "sleep"};
+    return kNondeterministicFunctions.count(name) > 0;
+}
+
+size_t extract_common_sub_exprs(std::vector<TExpr>* exprs, std::vector<std::pair<SlotId, TExpr>>* common_exprs,
+                                SlotId next_slot_id, TupleId tuple_id) {
+    const size_t num_exprs = exprs->size();
+    auto expr_at = [&](size_t i) -> TExpr& {
+        return i < num_exprs ? (*exprs)[i] : (*common_exprs)[i - num_exprs].second;
+    };
+
+    size_t num_extracted = 0;
+    bool rewritten = false;
+    while (true) {
+        // Group the candidate sub expressions of all the expressions by equality.
+        std::unordered_map<size_t, std::vector<std::vector<SubExprRange>>> groups_by_hash;
+        const size_t total = exprs->size() + common_exprs->size();
+        for (size_t e = 0; e < total; ++e) {
+            const TExpr& expr = expr_at(e);
+            if (expr.nodes.empty() || !is_rewritable(expr)) {
+                continue;
+            }
+            const auto& nodes = expr.nodes;
+            std::vector<size_t> ends(nodes.size());
+            build_subtree_ends(nodes, 0, &ends);
+            // The root of an output expression is never replaced, otherwise the output slot would be taken as
+            // a reference to another slot, and share the column with it.
+            for (size_t i = e < num_exprs ? 1 : 0; i < nodes.size(); ++i) {
+                if (!is_candidate(nodes, i, ends[i])) {
+                    continue;
+                }
+                SubExprRange range{e, i, ends[i]};
+                auto& groups = groups_by_hash[hash_sub_expr(nodes, i, ends[i])];
+                auto it = std::find_if(groups.begin(), groups.end(), [&](const std::vector<SubExprRange>& group) {
+                    const auto& other = expr_at(group[0].expr).nodes;
+                    return group[0].size() == range.size() &&
+                           std::equal(nodes.begin() + range.begin, nodes.begin() + range.end,
+                                      other.begin() + group[0].begin);
+                });
+                if (it == groups.end()) {
+                    groups.push_back({range});
+                } else {
+                    it->push_back(range);
+                }
+            }
+        }
+
+        // Extract the largest repeated one, the smaller ones in it are extracted in the next rounds.
+        const std::vector<SubExprRange>* best = nullptr;
+        for (const auto& [hash, groups] : groups_by_hash) {
+            for (const auto& group : groups) {
+                if (group.size() < 2) {
+                    continue;
+                }
+                if (best == nullptr || group[0].size() > (*best)[0].size() ||
+                    (group[0].size() == (*best)[0].size() &&
+                     std::make_pair(group[0].expr, group[0].begin) <
+                             std::make_pair((*best)[0].expr, (*best)[0].begin))) {
+                    best = &group;
+                }
+            }
+        }
+        if (best == nullptr) {
+            break;
+        }
+
+        // Reuse the slot of the common expression which is the sub expression itself.
+        const SubExprRange& first = (*best)[0];
+        const SubExprRange* target = nullptr;
+        for (const auto& range : *best) {
+            if (range.expr >= num_exprs && range.begin == 0) {
+                target = &range;
+                break;
+            }
+        }
+        const TExprNode root = expr_at(first.expr).nodes[first.begin];
+        SlotId slot_id;
+        if (target != nullptr) {
+            slot_id = (*common_exprs)[target->expr - num_exprs].first;
+        } else {
+            slot_id = next_slot_id++;
+            const auto& nodes = expr_at(first.expr).nodes;
+            TExpr common_expr;
+            common_expr.nodes.assign(nodes.begin() + first.begin, nodes.begin() + first.end);
+            // Evaluated after all the common expressions, it's moved ahead of its parents by the final sort.
+            common_exprs->emplace_back(slot_id, std::move(common_expr));
+            ++num_extracted;
+        }
+
+        // Replace from the last one, to keep the positions of the others in the same expression.
+        const TExprNode slot_ref = make_slot_ref(root, slot_id, tuple_id);
+        for (auto it = best->rbegin(); it != best->rend(); ++it) {
+            if (&*it == target) {
+                continue;
+            }
+            auto& nodes = expr_at(it->expr).nodes;
+            nodes.erase(nodes.begin() + it->begin + 1, nodes.begin() + it->end);
+            nodes[it->begin] = slot_ref;
+        }
+        rewritten = true;
+    }
+
+    if (rewritten) {
+        sort_common_exprs(common_exprs);
+    }
+    return num_extracted;
+}
+
+} // namespace starrocks::vectorized
@@ -0,0 +1,29 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/global_types.h"
+#include "gen_cpp/Exprs_types.h"
+
+namespace starrocks::vectorized {
+
+// Whether the function returns different values for the same input, which must be evaluated for each row.
+bool is_nondeterministic_function(const std::string& name);
+
+// Extracts the sub expressions repeated in the expressions of a projection, so that each of them is evaluated
+// once per chunk into a column, which is referenced by its parent expressions through a slot ref.
+//
+// |exprs| are the expressions of the output slots, whose repeated sub expressions are replaced by slot refs.
+// |common_exprs| are the common sub expressions evaluated in order before |exprs|. The extracted ones are
+// appended to it, then all of them are reordered so that each one is evaluated after the ones it references.
+// The extracted expressions are assigned the slot ids from |next_slot_id| on, which must not be used by
+// the input chunk, and the slot refs are in |tuple_id|.
+// Returns the number of extracted expressions.
+size_t extract_common_sub_exprs(std::vector<TExpr>* exprs, std::vector<std::pair<SlotId, TExpr>>* common_exprs,
+                                SlotId next_slot_id, TupleId tuple_id);
+
+} // namespace starrocks::vectorized
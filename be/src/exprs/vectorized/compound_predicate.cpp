@@ -5,7 +5,9 @@
 #include "common/object_pool.h"
 #include "exprs/predicate.h"
 #include "exprs/vectorized/binary_function.h"
+#include "exprs/vectorized/like_predicate.h"
 #include "exprs/vectorized/unary_function.h"
+#include "gutil/casts.h"
 
 namespace starrocks::vectorized {
 
@@ -63,7 +65,29 @@ DEFINE_BINARY_FUNCTION_WITH_IMPL(OrImpl, l_value, r_value) {
 class VectorizedOrCompoundPredicate final : public Predicate {
 public:
     DEFINE_COMPOUND_CONSTRUCT(VectorizedOrCompoundPredicate);
+
+    Status prepare(RuntimeState* state, ExprContext* context) override {
+        RETURN_IF_ERROR(Expr::prepare(state, context));
+        // The LIKE and REGEXP predicates OR-ed on the same column are matched together, by the topmost OR.
+        _multi_pattern_matcher = MultiPatternMatcher::create(this);
+        if (_multi_pattern_matcher != nullptr) {
+            for (Expr* child : _children) {
+                if (child->node_type() == TExprNodeType::COMPOUND_PRED && child->op() == TExprOpcode::COMPOUND_OR) {
+                    down_cast<VectorizedOrCompoundPredicate*>(child)->_multi_pattern_matcher.reset();
+                }
+            }
+        }
+        return Status::OK();
+    }
+
     ColumnPtr evaluate(ExprContext* context, vectorized::Chunk* ptr) override {
+        if (_multi_pattern_matcher != nullptr && ptr != nullptr) {
+            ColumnPtr result = _multi_pattern_matcher->evaluate(context, ptr);
+            if (result != nullptr) {
+                return result;
+            }
+        }
+
         auto l = _children[0]->evaluate(context, ptr);
 
         int l_trues = ColumnHelper::count_true_with_notnull(l);
@@ -76,6 +100,9 @@ public:
 
         return VectorizedLogicPredicateBinaryFunction<OrNullImpl, OrImpl>::template evaluate<TYPE_BOOLEAN>(l, r);
     }
+
+private:
+    std::shared_ptr<const MultiPatternMatcher> _multi_pattern_matcher;
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(CompoundPredNot, l) {
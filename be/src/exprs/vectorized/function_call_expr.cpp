@@ -2,19 +2,32 @@
 
 #include "exprs/vectorized/function_call_expr.h"
 
+#include "column/binary_column.h"
+#include "column/column_hash.h"
 #include "column/column_helper.h"
 #include "column/const_column.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exprs/anyval_util.h"
 #include "exprs/expr_context.h"
 #include "exprs/vectorized/builtin_functions.h"
+#include "exprs/vectorized/common_sub_expr.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
 #include "runtime/user_function_cache.h"
+#include "util/phmap/phmap.h"
 
 namespace starrocks::vectorized {
 
+// The chunks smaller than it are evaluated row by row.
+static constexpr size_t kDictEvaluationMinRows = 256;
+// The leading rows to decide whether the argument is low-cardinality, before building the whole dictionary.
+static constexpr size_t kDictEvaluationSampleRows = 128;
+// The argument is low-cardinality if it has at most one distinct value per so many rows.
+static constexpr size_t kDictEvaluationRowsPerValue = 4;
+
 VectorizedFunctionCallExpr::VectorizedFunctionCallExpr(const TExprNode& node) : Expr(node), _fn_desc(nullptr) {}
 
 Status VectorizedFunctionCallExpr::prepare(starrocks::RuntimeState* state, starrocks::ExprContext* context) {
@@ -51,6 +64,20 @@ Status VectorizedFunctionCallExpr::prepare(starrocks::RuntimeState* state, starr
                                  _fn.fid == 10302 /* rand */ || _fn.fid == 10303 /* random */ ||
                                  _fn.fid == 100015 /* uuid */ || _fn.fid == 100016 /* uniq_id */;
 
+    // The deterministic function of a single string column, e.g. upper(city) or substr(url, 1, 10).
+    if (!_is_returning_random_value && !is_nondeterministic_function(_fn.name.function_name)) {
+        int num_variables = 0;
+        for (int i = 0; i < _children.size(); ++i) {
+            if (!_children[i]->is_constant()) {
+                ++num_variables;
+                _dict_arg_index = i;
+            }
+        }
+        if (num_variables != 1 || !_children[_dict_arg_index]->type().is_string_type()) {
+            _dict_arg_index = -1;
+        }
+    }
+
     return Status::OK();
 }
 
@@ -143,6 +170,13 @@ ColumnPtr VectorizedFunctionCallExpr::evaluate(starrocks::ExprContext* context,
 #endif
 
     ColumnPtr result;
+    if (_dict_arg_index >= 0 && ptr != nullptr && config::enable_function_dict_evaluation) {
+        result = _evaluate_on_dict(fn_ctx, args);
+        if (result != nullptr) {
+            return result;
+        }
+    }
+
     if (_fn_desc->exception_safe) {
         result = _fn_desc->scalar_function(fn_ctx, args);
     } else {
@@ -157,4 +191,92 @@ ColumnPtr VectorizedFunctionCallExpr::evaluate(starrocks::ExprContext* context,
     return result;
 }
 
+ColumnPtr VectorizedFunctionCallExpr::_evaluate_on_dict(FunctionContext* fn_ctx, const Columns& args) {
+    const ColumnPtr& arg = args[_dict_arg_index];
+    const size_t num_rows = arg->size();
+    if (num_rows < kDictEvaluationMinRows || arg->is_constant()) {
+        return nullptr;
+    }
+    for (int i = 0; i < args.size(); ++i) {
+        if (i != _dict_arg_index && !args[i]->is_constant()) {
+            return nullptr;
+        }
+    }
+
+    const BinaryColumn* values = nullptr;
+    const uint8_t* nulls = nullptr;
+    if (arg->is_nullable()) {
+        auto* nullable_column = down_cast<NullableColumn*>(arg.get());
+        values = down_cast<const BinaryColumn*>(nullable_column->data_column().get());
+        nulls = nullable_column->null_column()->get_data().data();
+    } else {
+        values = down_cast<const BinaryColumn*>(arg.get());
+    }
+
+    // Encode the values into the codes of the dictionary, giving up once it's too large.
+    // The null is an entry of the dictionary too, so that the function sees the same nulls as the rows.
+    phmap::flat_hash_map<Slice, uint32_t, SliceHash> dict;
+    auto dict_values = BinaryColumn::create();
+    auto dict_nulls = NullColumn::create();
+    int64_t null_code = -1;
+    Buffer<uint32_t> codes(num_rows);
+    const size_t max_dict_size = num_rows / kDictEvaluationRowsPerValue;
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (nulls != nullptr && nulls[i]) {
+            if (null_code < 0) {
+                null_code = dict_values->size();
+                dict_values->append_default();
+                dict_nulls->append(1);
+            }
+            codes[i] = null_code;
+            continue;
+        }
+        Slice value = values->get_slice(i);
+        auto [it, inserted] = dict.emplace(value, dict_values->size());
+        if (inserted) {
+            dict_values->append(value);
+            dict_nulls->append(0);
+            bool in_sample = i < kDictEvaluationSampleRows;
+            if (dict_values->size() > max_dict_size ||
+                (in_sample && dict_values->size() > kDictEvaluationSampleRows / kDictEvaluationRowsPerValue)) {
+                return nullptr;
+            }
+        }
+        codes[i] = it->second;
+    }
+    ColumnPtr dict_column = dict_values;
+    if (nulls != nullptr) {
+        dict_column = NullableColumn::create(dict_values, dict_nulls);
+        down_cast<NullableColumn*>(dict_column.get())->update_has_null();
+    }
+
+    // Evaluate the dictionary, with the constant arguments resized to it.
+    const size_t dict_size = dict_column->size();
+    Columns dict_args;
+    dict_args.reserve(args.size());
+    for (int i = 0; i < args.size(); ++i) {
+        if (i == _dict_arg_index) {
+            dict_args.emplace_back(dict_column);
+        } else {
+            const auto* const_column = down_cast<const ConstColumn*>(args[i].get());
+            dict_args.emplace_back(ConstColumn::create(const_column->data_column(), dict_size));
+        }
+    }
+    ColumnPtr dict_result;
+    if (_fn_desc->exception_safe) {
+        dict_result = _fn_desc->scalar_function(fn_ctx, dict_args);
+    } else {
+        SCOPED_SET_CATCHED(false);
+        dict_result = _fn_desc->scalar_function(fn_ctx, dict_args);
+    }
+    if (dict_result->is_constant()) {
+        dict_result = ColumnHelper::unpack_and_duplicate_const_column(dict_size, dict_result);
+    }
+
+    // Map the results back to the rows by the codes.
+    ColumnPtr result = dict_result->clone_empty();
+    result->append_selective(*dict_result, codes);
+    return result;
+}
+
 } // namespace starrocks::vectorized
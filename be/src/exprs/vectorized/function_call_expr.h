@@ -29,9 +29,18 @@ protected:
     ColumnPtr evaluate(ExprContext* context, vectorized::Chunk* ptr) override;
 
 private:
+    // Evaluates the function once per distinct value of the string argument, if the argument has a low
+    // cardinality in the chunk, and maps the results back to the rows.
+    // Returns nullptr if the argument is not low-cardinality, the caller should evaluate all the rows then.
+    ColumnPtr _evaluate_on_dict(FunctionContext* fn_ctx, const Columns& args);
+
     const FunctionDescriptor* _fn_desc;
 
     bool _is_returning_random_value = false;
+
+    // The index of the only non-constant argument, which is a string, or -1 if the function is not
+    // evaluated on the dictionary of the argument.
+    int _dict_arg_index = -1;
 };
 
 } // namespace vectorized
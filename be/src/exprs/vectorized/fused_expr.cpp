@@ -0,0 +1,440 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exprs/vectorized/fused_expr.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "exprs/expr.h"
+#include "exprs/vectorized/column_ref.h"
+#include "gutil/casts.h"
+
+namespace starrocks::vectorized {
+
+struct FusedExpr::Register {
+    // the values and the null flags of the current tile, nulls is nullptr if there is no null.
+    const void* data = nullptr;
+    const uint8_t* nulls = nullptr;
+
+    // the buffers of the computed values and null flags of a tile.
+    std::vector<int64_t> buffer;
+    std::vector<uint8_t> null_buffer;
+
+    // the column of a slot, of the whole chunk.
+    const uint8_t* column_data = nullptr;
+    const uint8_t* column_nulls = nullptr;
+    bool may_have_null = false;
+};
+
+namespace {
+
+size_t width_of(int type) {
+    // BOOLEAN, INT, BIGINT, DOUBLE
+    static constexpr size_t kWidths[] = {sizeof(uint8_t), sizeof(int32_t), sizeof(int64_t), sizeof(double)};
+    return kWidths[type];
+}
+
+template <typename F>
+void dispatch_numeric(int type, F&& f) {
+    switch (type) {
+    case 1:
+        f(int32_t{});
+        break;
+    case 2:
+        f(int64_t{});
+        break;
+    case 3:
+        f(double{});
+        break;
+    default:
+        DCHECK(false) << "unsupported type " << type;
+    }
+}
+
+template <typename In, typename Out, typename Op>
+void apply_binary(const void* lhs, const void* rhs, void* out, size_t num_rows, Op op) {
+    const In* l = static_cast<const In*>(lhs);
+    const In* r = static_cast<const In*>(rhs);
+    Out* o = static_cast<Out*>(out);
+    for (size_t i = 0; i < num_rows; ++i) {
+        o[i] = op(l[i], r[i]);
+    }
+}
+
+} // namespace
+
+std::unique_ptr<FusedExpr> FusedExpr::compile(Expr* root) {
+    std::unique_ptr<FusedExpr> fused(new FusedExpr());
+    if (fused->_compile(root) < 0) {
+        return nullptr;
+    }
+    // A single operator is evaluated as fast by the tree.
+    size_t num_operators = std::count_if(fused->_instructions.begin(), fused->_instructions.end(),
+                                         [](const Instruction& ins) { return ins.op > OpCode::CAST; });
+    if (num_operators < 2) {
+        return nullptr;
+    }
+    return fused;
+}
+
+int FusedExpr::_compile(Expr* expr) {
+    auto to_value_type = [](PrimitiveType type, ValueType* value_type) {
+        switch (type) {
+        case TYPE_BOOLEAN:
+            *value_type = ValueType::BOOLEAN;
+            return true;
+        case TYPE_INT:
+            *value_type = ValueType::INT;
+            return true;
+        case TYPE_BIGINT:
+            *value_type = ValueType::BIGINT;
+            return true;
+        case TYPE_DOUBLE:
+            *value_type = ValueType::DOUBLE;
+            return true;
+        default:
+            return false;
+        }
+    };
+    auto append = [this](const Instruction& ins) {
+        _instructions.push_back(ins);
+        return static_cast<int>(_instructions.size() - 1);
+    };
+
+    ValueType type;
+    if (!to_value_type(expr->type().type, &type)) {
+        return -1;
+    }
+    Instruction ins;
+    ins.type = type;
+    ins.input_type = type;
+
+    switch (expr->node_type()) {
+    case TExprNodeType::SLOT_REF: {
+        if (!expr->is_slotref()) {
+            return -1;
+        }
+        ins.op = OpCode::SLOT;
+        ins.slot_id = down_cast<ColumnRef*>(expr)->slot_id();
+        return append(ins);
+    }
+    case TExprNodeType::BOOL_LITERAL:
+    case TExprNodeType::INT_LITERAL:
+    case TExprNodeType::FLOAT_LITERAL: {
+        ColumnPtr value = expr->evaluate(nullptr, nullptr);
+        if (value == nullptr || !value->is_constant() || value->only_null()) {
+            return -1;
+        }
+        ins.op = OpCode::CONST;
+        switch (type) {
+        case ValueType::BOOLEAN:
+            ins.int_value = ColumnHelper::get_const_value<TYPE_BOOLEAN>(value);
+            break;
+        case ValueType::INT:
+            ins.int_value = ColumnHelper::get_const_value<TYPE_INT>(value);
+            break;
+        case ValueType::BIGINT:
+            ins.int_value = ColumnHelper::get_const_value<TYPE_BIGINT>(value);
+            break;
+        case ValueType::DOUBLE:
+            ins.double_value = ColumnHelper::get_const_value<TYPE_DOUBLE>(value);
+            break;
+        }
+        return append(ins);
+    }
+    case TExprNodeType::CAST_EXPR: {
+        ValueType input_type;
+        if (expr->get_num_children() != 1 || !to_value_type(expr->get_child(0)->type().type, &input_type)) {
+            return -1;
+        }
+        // Only the widening casts, which never overflow.
+        bool widening = (input_type == ValueType::INT && (type == ValueType::BIGINT || type == ValueType::DOUBLE)) ||
+                        (input_type == ValueType::BIGINT && type == ValueType::DOUBLE);
+        if (input_type != type && !widening) {
+            return -1;
+        }
+        int child = _compile(expr->get_child(0));
+        if (child < 0 || input_type == type) {
+            return child;
+        }
+        ins.op = OpCode::CAST;
+        ins.input_type = input_type;
+        ins.lhs = child;
+        return append(ins);
+    }
+    case TExprNodeType::ARITHMETIC_EXPR: {
+        switch (expr->op()) {
+        case TExprOpcode::ADD:
+            ins.op = OpCode::ADD;
+            break;
+        case TExprOpcode::SUBTRACT:
+            ins.op = OpCode::SUB;
+            break;
+        case TExprOpcode::MULTIPLY:
+            ins.op = OpCode::MUL;
+            break;
+        default:
+            return -1;
+        }
+        if (type == ValueType::BOOLEAN || expr->get_num_children() != 2 ||
+            expr->get_child(0)->type().type != expr->type().type ||
+            expr->get_child(1)->type().type != expr->type().type) {
+            return -1;
+        }
+        break;
+    }
+    case TExprNodeType::BINARY_PRED: {
+        switch (expr->op()) {
+        case TExprOpcode::EQ:
+            ins.op = OpCode::EQ;
+            break;
+        case TExprOpcode::NE:
+            ins.op = OpCode::NE;
+            break;
+        case TExprOpcode::LT:
+            ins.op = OpCode::LT;
+            break;
+        case TExprOpcode::LE:
+            ins.op = OpCode::LE;
+            break;
+        case TExprOpcode::GT:
+            ins.op = OpCode::GT;
+            break;
+        case TExprOpcode::GE:
+            ins.op = OpCode::GE;
+            break;
+        default:
+            return -1;
+        }
+        if (type != ValueType::BOOLEAN || expr->get_num_children() != 2 ||
+            expr->get_child(0)->type().type != expr->get_child(1)->type().type ||
+            !to_value_type(expr->get_child(0)->type().type, &ins.input_type) ||
+            ins.input_type == ValueType::BOOLEAN) {
+            return -1;
+        }
+        break;
+    }
+    case TExprNodeType::COMPOUND_PRED: {
+        switch (expr->op()) {
+        case TExprOpcode::COMPOUND_AND:
+            ins.op = OpCode::AND;
+            break;
+        case TExprOpcode::COMPOUND_OR:
+            ins.op = OpCode::OR;
+            break;
+        default:
+            return -1;
+        }
+        if (type != ValueType::BOOLEAN || expr->get_num_children() != 2 ||
+            expr->get_child(0)->type().type != TYPE_BOOLEAN || expr->get_child(1)->type().type != TYPE_BOOLEAN) {
+            return -1;
+        }
+        break;
+    }
+    default:
+        return -1;
+    }
+
+    ins.lhs = _compile(expr->get_child(0));
+    if (ins.lhs < 0) {
+        return -1;
+    }
+    ins.rhs = _compile(expr->get_child(1));
+    if (ins.rhs < 0) {
+        return -1;
+    }
+    return append(ins);
+}
+
+ColumnPtr FusedExpr::evaluate(Chunk* chunk) const {
+    const size_t num_rows = chunk->num_rows();
+    std::vector<Register> registers(_instructions.size());
+    for (size_t i = 0; i < _instructions.size(); ++i) {
+        const Instruction& ins = _instructions[i];
+        Register& reg = registers[i];
+        switch (ins.op) {
+        case OpCode::SLOT: {
+            const ColumnPtr& column = chunk->get_column_by_slot_id(ins.slot_id);
+            if (column->is_constant() || column->size() != num_rows) {
+                return nullptr;
+            }
+            const Column* data_column = column.get();
+            if (column->is_nullable()) {
+                const auto* nullable_column = down_cast<const NullableColumn*>(column.get());
+                data_column = nullable_column->data_column().get();
+                reg.column_nulls = nullable_column->null_column()->get_data().data();
+                reg.may_have_null = true;
+            }
+            reg.column_data = data_column->raw_data();
+            break;
+        }
+        case OpCode::CONST: {
+            reg.buffer.resize(kTileSize);
+            if (ins.type == ValueType::DOUBLE) {
+                std::fill_n(reinterpret_cast<double*>(reg.buffer.data()), kTileSize, ins.double_value);
+            } else if (ins.type == ValueType::BIGINT) {
+                std::fill_n(reg.buffer.data(), kTileSize, ins.int_value);
+            } else if (ins.type == ValueType::INT) {
+                std::fill_n(reinterpret_cast<int32_t*>(reg.buffer.data()), kTileSize, ins.int_value);
+            } else {
+                std::fill_n(reinterpret_cast<uint8_t*>(reg.buffer.data()), kTileSize, ins.int_value);
+            }
+            reg.data = reg.buffer.data();
+            break;
+        }
+        default:
+            reg.buffer.resize(kTileSize);
+            reg.may_have_null = registers[ins.lhs].may_have_null || (ins.rhs >= 0 && registers[ins.rhs].may_have_null);
+            break;
+        }
+    }
+
+    const Instruction& root = _instructions.back();
+    const Register& result = registers.back();
+    const size_t width = width_of(static_cast<int>(root.type));
+    ColumnPtr data_column;
+    switch (root.type) {
+    case ValueType::BOOLEAN:
+        data_column = BooleanColumn::create(num_rows);
+        break;
+    case ValueType::INT:
+        data_column = Int32Column::create(num_rows);
+        break;
+    case ValueType::BIGINT:
+        data_column = Int64Column::create(num_rows);
+        break;
+    case ValueType::DOUBLE:
+        data_column = DoubleColumn::create(num_rows);
+        break;
+    }
+    NullColumnPtr null_column = result.may_have_null ? NullColumn::create(num_rows, 0) : nullptr;
+
+    uint8_t* out_data = data_column->mutable_raw_data();
+    for (size_t start = 0; start < num_rows; start += kTileSize) {
+        const size_t tile_rows = std::min(kTileSize, num_rows - start);
+        for (size_t i = 0; i < _instructions.size(); ++i) {
+            const Instruction& ins = _instructions[i];
+            Register& reg = registers[i];
+            if (ins.op == OpCode::SLOT) {
+                reg.data = reg.column_data + start * width_of(static_cast<int>(ins.type));
+                reg.nulls = reg.column_nulls != nullptr ? reg.column_nulls + start : nullptr;
+            } else if (ins.op != OpCode::CONST) {
+                _run(ins, registers, tile_rows);
+                reg.data = reg.buffer.data();
+            }
+        }
+        memcpy(out_data + start * width, result.data, tile_rows * width);
+        if (null_column != nullptr && result.nulls != nullptr) {
+            memcpy(null_column->get_data().data() + start, result.nulls, tile_rows);
+        }
+    }
+
+    if (null_column == nullptr) {
+        return data_column;
+    }
+    auto nullable_column = NullableColumn::create(std::move(data_column), std::move(null_column));
+    nullable_column->update_has_null();
+    return nullable_column;
+}
+
+void FusedExpr::_run(const Instruction& ins, std::vector<Register>& registers, size_t num_rows) const {
+    Register& out = registers[&ins - _instructions.data()];
+    const Register& lhs = registers[ins.lhs];
+    void* out_data = out.buffer.data();
+
+    if (ins.op == OpCode::CAST) {
+        out.nulls = lhs.nulls;
+        dispatch_numeric(static_cast<int>(ins.type), [&](auto out_tag) {
+            using Out = decltype(out_tag);
+            dispatch_numeric(static_cast<int>(ins.input_type), [&](auto in_tag) {
+                using In = decltype(in_tag);
+                const In* in = static_cast<const In*>(lhs.data);
+                Out* o = static_cast<Out*>(out_data);
+                for (size_t i = 0; i < num_rows; ++i) {
+                    o[i] = static_cast<Out>(in[i]);
+                }
+            });
+        });
+        return;
+    }
+
+    const Register& rhs = registers[ins.rhs];
+    if (ins.op == OpCode::AND || ins.op == OpCode::OR) {
+        const auto* l = static_cast<const uint8_t*>(lhs.data);
+        const auto* r = static_cast<const uint8_t*>(rhs.data);
+        auto* o = static_cast<uint8_t*>(out_data);
+        const bool is_and = ins.op == OpCode::AND;
+        for (size_t i = 0; i < num_rows; ++i) {
+            o[i] = is_and ? (l[i] & r[i]) : (l[i] | r[i]);
+        }
+        if (lhs.nulls == nullptr && rhs.nulls == nullptr) {
+            out.nulls = nullptr;
+            return;
+        }
+        // The same null semantics as the compound predicates: FALSE AND NULL is FALSE, TRUE OR NULL is TRUE.
+        out.null_buffer.resize(kTileSize);
+        for (size_t i = 0; i < num_rows; ++i) {
+            const uint8_t l_null = lhs.nulls != nullptr ? lhs.nulls[i] : 0;
+            const uint8_t r_null = rhs.nulls != nullptr ? rhs.nulls[i] : 0;
+            if (is_and) {
+                out.null_buffer[i] = (l_null & r_null) | (r_null & (l_null ^ l[i])) | (l_null & (r_null ^ r[i]));
+            } else {
+                out.null_buffer[i] = (l_null & r_null) | (r_null & (r_null ^ l[i])) | (l_null & (l_null ^ r[i]));
+            }
+        }
+        out.nulls = out.null_buffer.data();
+        return;
+    }
+
+    // The arithmetic and comparison operators are null if any operand is null.
+    if (lhs.nulls == nullptr || rhs.nulls == nullptr) {
+        out.nulls = lhs.nulls != nullptr ? lhs.nulls : rhs.nulls;
+    } else {
+        out.null_buffer.resize(kTileSize);
+        for (size_t i = 0; i < num_rows; ++i) {
+            out.null_buffer[i] = lhs.nulls[i] | rhs.nulls[i];
+        }
+        out.nulls = out.null_buffer.data();
+    }
+
+    dispatch_numeric(static_cast<int>(ins.input_type), [&](auto tag) {
+        using T = decltype(tag);
+        switch (ins.op) {
+        case OpCode::ADD:
+            apply_binary<T, T>(lhs.data, rhs.data, out_data, num_rows, [](T a, T b) { return a + b; });
+            break;
+        case OpCode::SUB:
+            apply_binary<T, T>(lhs.data, rhs.data, out_data, num_rows, [](T a, T b) { return a - b; });
+            break;
+        case OpCode::MUL:
+            apply_binary<T, T>(lhs.data, rhs.data, out_data, num_rows, [](T a, T b) { return a * b; });
+            break;
+        case OpCode::EQ:
+            apply_binary<T, uint8_t>(lhs.data, rhs.data, out_data, num_rows, [](T a, T b) { return a == b; });
+            break;
+        case OpCode::NE:
+            apply_binary<T, uint8_t>(lhs.data, rhs.data, out_data, num_rows, [](T a, T b) { return a != b; });
+            break;
+        case OpCode::LT:
+            apply_binary<T, uint8_t>(lhs.data, rhs.data, out_data, num_rows, [](T a, T b) { return a < b; });
+            break;
+        case OpCode::LE:
+            apply_binary<T, uint8_t>(lhs.data, rhs.data, out_data, num_rows, [](T a, T b) { return a <= b; });
+            break;
+        case OpCode::GT:
+            apply_binary<T, uint8_t>(lhs.data, rhs.data, out_data, num_rows, [](T a, T b) { return a > b; });
+            break;
+        case OpCode::GE:
+            apply_binary<T, uint8_t>(lhs.data, rhs.data, out_data, num_rows, [](T a, T b) { return a >= b; });
+            break;
+        default:
+            DCHECK(false) << "unexpected op " << static_cast<int>(ins.op);
+        }
+    });
+}
+
+} // namespace starrocks::vectorized
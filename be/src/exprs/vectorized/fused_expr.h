@@ -0,0 +1,70 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/global_types.h"
+
+namespace starrocks {
+class Expr;
+} // namespace starrocks
+
+namespace starrocks::vectorized {
+
+// FusedExpr evaluates a tree of arithmetic, comparison and logic operators over the numeric and boolean columns
+// and constants as one loop over tiles of rows. The intermediate results of a tile are kept in small buffers,
+// which stay in the cpu cache, rather than materializing a column of the whole chunk for every node.
+//
+// The supported nodes are:
+//   - slot refs and literals of BOOLEAN, INT, BIGINT and DOUBLE;
+//   - widening casts from INT and BIGINT to BIGINT and DOUBLE;
+//   - +, -, * of INT, BIGINT and DOUBLE;
+//   - =, !=, <, <=, >, >= of INT, BIGINT and DOUBLE;
+//   - AND and OR.
+// The results are the same as evaluating the tree, including the nulls.
+class FusedExpr {
+public:
+    // Returns nullptr if some node of the tree is not supported, or the tree is too small to benefit.
+    static std::unique_ptr<FusedExpr> compile(Expr* root);
+
+    // Returns nullptr if the chunk could not be evaluated by the fused loop, e.g. an input column is constant,
+    // and the caller should evaluate the tree instead.
+    ColumnPtr evaluate(Chunk* chunk) const;
+
+    size_t num_instructions() const { return _instructions.size(); }
+
+private:
+    enum class ValueType : uint8_t { BOOLEAN, INT, BIGINT, DOUBLE };
+    enum class OpCode : uint8_t { SLOT, CONST, CAST, ADD, SUB, MUL, EQ, NE, LT, LE, GT, GE, AND, OR };
+
+    // Each instruction computes a value of a tile into the register of the same index.
+    struct Instruction {
+        OpCode op;
+        ValueType type;
+        // the type of the operands of CAST and the comparisons.
+        ValueType input_type;
+        int lhs = -1;
+        int rhs = -1;
+        SlotId slot_id = -1;
+        int64_t int_value = 0;
+        double double_value = 0;
+    };
+
+    struct Register;
+
+    static constexpr size_t kTileSize = 512;
+
+    FusedExpr() = default;
+
+    // Appends the instructions of the tree, returns the register of the root or -1 if unsupported.
+    int _compile(Expr* expr);
+
+    void _run(const Instruction& instruction, std::vector<Register>& registers, size_t num_rows) const;
+
+    std::vector<Instruction> _instructions;
+};
+
+} // namespace starrocks::vectorized
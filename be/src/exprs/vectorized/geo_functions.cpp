@@ -346,6 +346,9 @@ ColumnPtr GeoFunctions::st_contains(FunctionContext* context, const Columns& col
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_BOOLEAN> result(size);
+    // The points, which are the most common shapes to be tested, are decoded into the same GeoPoint
+    // instead of a new one per row.
+    GeoPoint point;
     for (int row = 0; row < size; ++row) {
         if (lhs_viewer.is_null(row) || rhs_viewer.is_null(row)) {
             result.append_null();
@@ -362,6 +365,8 @@ ColumnPtr GeoFunctions::st_contains(FunctionContext* context, const Columns& col
         for (i = 0; i < 2; ++i) {
             if (state != nullptr && state->shapes[i] != nullptr) {
                 shapes[i] = state->shapes[i];
+            } else if (i == 1 && point.decode_from(strs[i]->data, strs[i]->size)) {
+                shapes[i] = &point;
             } else {
                 shapes[i] = local_state.shapes[i] = GeoShape::from_encoded(strs[i]->data, strs[i]->size);
                 if (shapes[i] == nullptr) {
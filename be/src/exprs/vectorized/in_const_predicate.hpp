@@ -9,6 +9,7 @@
 #include "common/object_pool.h"
 #include "exprs/predicate.h"
 #include "gutil/strings/substitute.h"
+#include "util/dense_int_set.h"
 
 namespace starrocks {
 
@@ -33,6 +34,18 @@ struct PHashSet<Type, std::enable_if_t<isSlicePT<Type>>> {
 template <PrimitiveType Type>
 using PHashSetType = typename PHashSet<Type>::PType;
 
+// How the predicate looks up the values.
+enum class LookupMode {
+    // probes the hash set.
+    HASH_SET,
+    // the values are the small non-negative codes of a dictionary, indexes an array of their size.
+    ARRAY,
+    // the integers are in a small range, see DenseIntSet.
+    DENSE,
+    // compares with each of a few integers, which is branch free and vectorized across the comparisons.
+    SMALL,
+};
+
 } // namespace in_const_pred_detail
 
 /**
@@ -48,6 +61,7 @@ template <PrimitiveType Type>
 class VectorizedInConstPredicate final : public Predicate {
 public:
     using ValueType = typename RunTimeTypeTraits<Type>::CppType;
+    using LookupMode = in_const_pred_detail::LookupMode;
 
     VectorizedInConstPredicate(const TExprNode& node)
             : Predicate(node), _is_not_in(node.in_predicate.is_not_in), _is_prepare(false), _null_in_set(false) {}
@@ -85,6 +99,7 @@ public:
             const auto& hash_set = that->hash_set();
             _hash_set.insert(hash_set.begin(), hash_set.end());
             _null_in_set = _null_in_set || that->null_in_set();
+            _init_integer_lookup();
             return Status::OK();
         } else {
             return Status::NotSupported(strings::Substitute("$0 cannot be merged with VectorizedInConstPredicate",
@@ -159,10 +174,11 @@ public:
                 _hash_set.emplace(viewer.value(0));
             }
         }
+        _init_integer_lookup();
         return Status::OK();
     }
 
-    template <bool use_array>
+    template <LookupMode mode>
     ColumnPtr eval_on_chunk_both_column_and_set_not_has_null(const ColumnPtr& lhs) {
         DCHECK(!_null_in_set);
         auto size = lhs->size();
@@ -177,8 +193,12 @@ public:
         uint8_t* data3 = result->get_data().data();
 
         if (!lhs->is_constant()) {
-            for (int row = 0; row < size; ++row) {
-                data3[row] = check_value_existence<use_array>(data[row]);
+            if (_use_prefetch()) {
+                _contains_slices(data, size, data3);
+            } else {
+                for (int row = 0; row < size; ++row) {
+                    data3[row] = check_value_existence<mode>(data[row]);
+                }
             }
             if (_is_not_in) {
                 for (int i = 0; i < size; i++) {
@@ -187,7 +207,7 @@ public:
             }
         } else {
             if (size > 0) {
-                uint8_t ret = check_value_existence<use_array>(data[0]);
+                uint8_t ret = check_value_existence<mode>(data[0]);
                 if (_is_not_in) {
                     ret = 1 - ret;
                 }
@@ -203,13 +223,23 @@ public:
 
     // null_in_set: true means null is a value of _hash_set.
     // equal_null: true means that 'null' in column and 'null' in set is equal.
-    template <bool null_in_set, bool equal_null, bool use_array>
+    template <bool null_in_set, bool equal_null, LookupMode mode>
     ColumnPtr eval_on_chunk(const ColumnPtr& lhs) {
         ColumnViewer<Type> viewer(lhs);
         size_t size = viewer.size();
         ColumnBuilder<TYPE_BOOLEAN> builder(size);
         uint8_t* output = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(builder.data_column())->get_data().data();
 
+        // The existence of the values of all the rows, including the null ones.
+        std::vector<uint8_t> found;
+        if constexpr (isSlicePT<Type>) {
+            if (_use_prefetch() && !lhs->is_constant()) {
+                const auto* data_column = down_cast<const BinaryColumn*>(ColumnHelper::get_data_column(lhs.get()));
+                found.resize(size);
+                _contains_slices(data_column->get_data().data(), size, found.data());
+            }
+        }
+
         for (int row = 0; row < size; ++row) {
             if (viewer.is_null(row)) {
                 if constexpr (equal_null) {
@@ -220,7 +250,7 @@ public:
                 continue;
             }
             // find value
-            if (check_value_existence<use_array>(viewer.value(row))) {
+            if (found.empty() ? check_value_existence<mode>(viewer.value(row)) : found[row]) {
                 builder.append(1);
                 continue;
             }
@@ -249,35 +279,17 @@ public:
         if (!_eq_null && ColumnHelper::count_nulls(lhs) == lhs->size()) {
             return ColumnHelper::create_const_null_column(lhs->size());
         }
-        bool use_array = is_use_array();
-
-        if (_null_in_set) {
-            if (_eq_null) {
-                if (!use_array) {
-                    return this->template eval_on_chunk<true, true, false>(lhs);
-                } else {
-                    return this->template eval_on_chunk<true, true, true>(lhs);
-                }
-            } else {
-                if (!use_array) {
-                    return this->template eval_on_chunk<true, false, false>(lhs);
-                } else {
-                    return this->template eval_on_chunk<true, false, true>(lhs);
-                }
-            }
-        } else if (lhs->is_nullable()) {
-            if (!use_array) {
-                return this->template eval_on_chunk<false, false, false>(lhs);
-            } else {
-                return this->template eval_on_chunk<false, false, true>(lhs);
-            }
-        } else {
-            if (!use_array) {
-                return eval_on_chunk_both_column_and_set_not_has_null<false>(lhs);
-            } else {
-                return eval_on_chunk_both_column_and_set_not_has_null<true>(lhs);
-            }
+        switch (_lookup_mode()) {
+        case LookupMode::HASH_SET:
+            return _evaluate<LookupMode::HASH_SET>(lhs);
+        case LookupMode::ARRAY:
+            return _evaluate<LookupMode::ARRAY>(lhs);
+        case LookupMode::DENSE:
+            return _evaluate<LookupMode::DENSE>(lhs);
+        case LookupMode::SMALL:
+            return _evaluate<LookupMode::SMALL>(lhs);
         }
+        __builtin_unreachable();
     }
 
     void insert(const ValueType* value) {
@@ -298,10 +310,18 @@ public:
         }
     }
 
-    template <bool use_array>
+    template <LookupMode mode>
     uint8_t check_value_existence(const ValueType& value) const {
-        if constexpr (use_array && can_use_array()) {
+        if constexpr (mode == LookupMode::ARRAY && can_use_array()) {
             return _get_array_index(value);
+        } else if constexpr (mode == LookupMode::DENSE && can_use_array()) {
+            return _dense_set.contains(value);
+        } else if constexpr (mode == LookupMode::SMALL && can_use_array()) {
+            uint8_t ret = 0;
+            for (size_t i = 0; i < kSmallSetSize; i++) {
+                ret |= (value == _small_set[i]);
+            }
+            return ret;
         } else {
             return static_cast<uint8_t>(_hash_set.contains(value));
         }
@@ -326,6 +346,93 @@ public:
     bool is_use_array() const { return _array_size != 0; }
 
 private:
+    // At most this number of integers are compared one by one.
+    static constexpr size_t kSmallSetSize = 8;
+    // The buckets of a hash set of this size or larger are unlikely to be in the cpu cache.
+    static constexpr size_t kPrefetchBucketCount = 8192;
+    static constexpr size_t kPrefetchDistance = 16;
+
+    // A placeholder type for the sets of the integers, if the values are not integers.
+    using IntegerType = std::conditional_t<can_use_array(), ValueType, int32_t>;
+
+    template <LookupMode mode>
+    ColumnPtr _evaluate(const ColumnPtr& lhs) {
+        if (_null_in_set) {
+            if (_eq_null) {
+                return this->template eval_on_chunk<true, true, mode>(lhs);
+            } else {
+                return this->template eval_on_chunk<true, false, mode>(lhs);
+            }
+        } else if (lhs->is_nullable()) {
+            return this->template eval_on_chunk<false, false, mode>(lhs);
+        } else {
+            return eval_on_chunk_both_column_and_set_not_has_null<mode>(lhs);
+        }
+    }
+
+    LookupMode _lookup_mode() const {
+        if (is_use_array()) {
+            return LookupMode::ARRAY;
+        }
+        if (!_dense_set.empty()) {
+            return LookupMode::DENSE;
+        }
+        if (_small_set_size > 0) {
+            return LookupMode::SMALL;
+        }
+        return LookupMode::HASH_SET;
+    }
+
+    // Looks up a constant IN list of integers without hashing: compares with each of the values of a small list,
+    // or indexes the range of a dense one.
+    void _init_integer_lookup() {
+        if constexpr (can_use_array()) {
+            if (is_use_array()) {
+                return;
+            }
+            std::vector<IntegerType> values(_hash_set.begin(), _hash_set.end());
+            _small_set_size = 0;
+            _dense_set.init({});
+            if (values.empty()) {
+                return;
+            }
+            if (values.size() <= kSmallSetSize) {
+                // Pad with the first value, which doesn't change the result.
+                _small_set.fill(values[0]);
+                std::copy(values.begin(), values.end(), _small_set.begin());
+                _small_set_size = values.size();
+            } else {
+                _dense_set.init(std::move(values));
+            }
+        }
+    }
+
+    bool _use_prefetch() const {
+        if constexpr (isSlicePT<Type>) {
+            return _hash_set.bucket_count() >= kPrefetchBucketCount;
+        } else {
+            return false;
+        }
+    }
+
+    // Looks up the slices with the hashes computed in one pass ahead of the probes, so that the buckets of the
+    // later rows are prefetched while the earlier ones are compared.
+    void _contains_slices(const ValueType* values, size_t size, uint8_t* found) const {
+        if constexpr (isSlicePT<Type>) {
+            std::vector<size_t> hashes(size);
+            for (size_t i = 0; i < size; i++) {
+                hashes[i] = SliceHash()(values[i]);
+            }
+            for (size_t i = 0; i < size; i++) {
+                if (i + kPrefetchDistance < size) {
+                    _hash_set.prefetch_hash(hashes[i + kPrefetchDistance]);
+                }
+                SliceWithHash key(reinterpret_cast<const uint8_t*>(values[i].data), values[i].size, hashes[i]);
+                found[i] = _hash_set.find(key, hashes[i]) != _hash_set.end();
+            }
+        }
+    }
+
     // Note(yan): It's very tempting to use real bitmap, but the real scenario is, the array size is usually small like dict codes.
     // To usse real bitmap involves bit shift, and/or ops, which eats much cpu cycles.
     // Since the bitmap size is quite small, we can use trade memory usage for performance
@@ -350,6 +457,11 @@ private:
     int _array_size = 0;
     std::vector<uint8_t> _array_buffer;
 
+    // Only for the constant IN lists of integers, built in open().
+    DenseIntSet<IntegerType> _dense_set;
+    std::array<IntegerType, kSmallSetSize> _small_set{};
+    size_t _small_set_size = 0;
+
     in_const_pred_detail::PHashSetType<Type> _hash_set;
     // Ensure the string memory don't early free
     std::vector<ColumnPtr> _string_values;
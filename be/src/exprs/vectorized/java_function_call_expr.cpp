@@ -84,7 +84,7 @@ struct UDFFunctionCallHelper {
 
         env->PushLocalFrame(size * (num_cols + 1));
         // get result
-        auto result_cols = get_boxed_result(res, size);
+        auto result_cols = get_boxed_result(ctx, res, size);
         // call clear
         env->PopLocalFrame(nullptr);
         for (auto ref : args) {
@@ -95,24 +95,17 @@ struct UDFFunctionCallHelper {
         return result_cols;
     }
 
-#define GET_BOX_RESULT(NAME, cxx_type)                                           \
-    case NAME: {                                                                 \
-        auto null_col = NullColumn::create(num_rows);                            \
-        auto data_col = RunTimeColumnType<NAME>::create(num_rows);               \
-        auto& null_data = null_col->get_data();                                  \
-        auto& container = data_col->get_data();                                  \
-        for (int i = 0; i < num_rows; ++i) {                                     \
-            auto data = env->GetObjectArrayElement((jobjectArray)result, i);     \
-            if (data != nullptr) {                                               \
-                container[i] = helper.val##cxx_type(data);                       \
-            } else {                                                             \
-                null_data[i] = true;                                             \
-            }                                                                    \
-        }                                                                        \
-        return NullableColumn::create(std::move(data_col), std::move(null_col)); \
+#define GET_BOX_RESULT(NAME, cxx_type)                                                                       \
+    case NAME: {                                                                                             \
+        auto null_col = NullColumn::create(num_rows);                                                        \
+        auto data_col = RunTimeColumnType<NAME>::create(num_rows);                                           \
+        DirectByteBuffer null_buff(null_col->get_data().data(), num_rows);                                   \
+        DirectByteBuffer data_buff(data_col->get_data().data(), num_rows * sizeof(cxx_type));                \
+        helper.get_result_from_boxed_array(ctx, NAME, result, num_rows, &null_buff, &data_buff);             \
+        return NullableColumn::create(std::move(data_col), std::move(null_col));                             \
     }
 
-    ColumnPtr get_boxed_result(jobject result, size_t num_rows) {
+    ColumnPtr get_boxed_result(FunctionContext* ctx, jobject result, size_t num_rows) {
         if (result == nullptr) {
             return ColumnHelper::create_const_null_column(num_rows);
         }
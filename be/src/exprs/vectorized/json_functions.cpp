@@ -207,6 +207,13 @@ ColumnPtr JsonFunctions::_iterate_rows(FunctionContext* context, const Columns&
 
     simdjson::ondemand::parser parser;
 
+    // The constant path is parsed once in json_path_prepare.
+    auto* prepared_paths = reinterpret_cast<std::vector<SimpleJsonPath>*>(
+            context->get_function_state(FunctionContext::FRAGMENT_LOCAL));
+    std::vector<SimpleJsonPath> row_paths;
+    // Reused by the rows, to save the allocation of the padded copy for each document.
+    std::string json_string;
+
     auto size = columns[0]->size();
     ColumnBuilder<primitive_type> result(size);
     for (int row = 0; row < size; ++row) {
@@ -220,17 +227,22 @@ ColumnPtr JsonFunctions::_iterate_rows(FunctionContext* context, const Columns&
             result.append_null();
             continue;
         }
-        std::string json_string(json_value.data, json_value.size);
 
-        auto path_value = path_viewer.value(row);
-        std::string path_string(path_value.data, path_value.size);
-        // Must remove or replace the escape sequence.
-        path_string.erase(std::remove(path_string.begin(), path_string.end(), '\\'), path_string.end());
-        if (path_string.empty()) {
-            result.append_null();
-            continue;
+        if (prepared_paths == nullptr) {
+            auto path_value = path_viewer.value(row);
+            std::string path_string(path_value.data, path_value.size);
+            // Must remove or replace the escape sequence.
+            path_string.erase(std::remove(path_string.begin(), path_string.end(), '\\'), path_string.end());
+            if (path_string.empty()) {
+                result.append_null();
+                continue;
+            }
+            row_paths.clear();
+            parse_json_paths(path_string, &row_paths);
         }
+        const std::vector<SimpleJsonPath>& jsonpath = prepared_paths != nullptr ? *prepared_paths : row_paths;
 
+        json_string.assign(json_value.data, json_value.size);
         // Reserve for simdjson padding.
         json_string.reserve(json_string.size() + simdjson::SIMDJSON_PADDING);
 
@@ -240,9 +252,6 @@ ColumnPtr JsonFunctions::_iterate_rows(FunctionContext* context, const Columns&
             continue;
         }
 
-        std::vector<SimpleJsonPath> jsonpath;
-        parse_json_paths(path_string, &jsonpath);
-
         simdjson::ondemand::json_type tp;
 
         auto err = doc.type().get(tp);
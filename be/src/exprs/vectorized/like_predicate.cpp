@@ -2,10 +2,13 @@
 
 #include "exprs/vectorized/like_predicate.h"
 
+#include <algorithm>
 #include <memory>
 
+#include "exprs/expr.h"
 #include "exprs/vectorized/binary_function.h"
 #include "glog/logging.h"
+#include "gutil/casts.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/Volnitsky.h"
 
@@ -462,10 +465,15 @@ ColumnPtr LikePredicate::regex_match_partial(FunctionContext* context, const sta
 
 template <bool fullMatch>
 std::string LikePredicate::convert_like_pattern(FunctionContext* context, const Slice& pattern) {
+    auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
+    return convert_like_pattern<fullMatch>(state->escape_char, pattern);
+}
+
+template <bool fullMatch>
+std::string LikePredicate::convert_like_pattern(char escape_char, const Slice& pattern) {
     std::string re_pattern;
     re_pattern.clear();
 
-    auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
     bool is_escaped = false;
 
     if constexpr (fullMatch) {
@@ -478,7 +486,7 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
         } else if (!is_escaped && pattern.data[i] == '_') {
             re_pattern.append(".");
             // check for escape char before checking for regex special chars, they might overlap
-        } else if (!is_escaped && pattern.data[i] == state->escape_char) {
+        } else if (!is_escaped && pattern.data[i] == escape_char) {
             is_escaped = true;
         } else if (pattern.data[i] == '.' || pattern.data[i] == '[' || pattern.data[i] == ']' ||
                    pattern.data[i] == '{' || pattern.data[i] == '}' || pattern.data[i] == '(' ||
@@ -519,4 +527,246 @@ void LikePredicate::remove_escape_character(std::string* search_string) {
     }
 }
 
+std::unique_ptr<MultiPatternMatcher> MultiPatternMatcher::create(Expr* root) {
+    std::vector<Expr*> predicates;
+    if (!_collect_predicates(root, &predicates) || predicates.size() < 2) {
+        return nullptr;
+    }
+
+    // All the predicates must match the same column.
+    Expr* input = predicates[0]->get_child(0);
+    if (!input->is_slotref()) {
+        return nullptr;
+    }
+    std::vector<SlotId> input_slots;
+    input->get_slot_ids(&input_slots);
+    for (Expr* predicate : predicates) {
+        std::vector<SlotId> slots;
+        if (!predicate->get_child(0)->is_slotref() || predicate->get_child(0)->get_slot_ids(&slots) != 1 ||
+            slots != input_slots) {
+            return nullptr;
+        }
+    }
+
+    std::unique_ptr<MultiPatternMatcher> matcher(new MultiPatternMatcher());
+    matcher->_input = input;
+    matcher->_num_patterns = predicates.size();
+
+    // The substrings, and the regular expressions of all the patterns.
+    std::vector<std::string> substrings;
+    std::vector<std::string> regexes;
+    for (Expr* predicate : predicates) {
+        ColumnPtr column = predicate->get_child(1)->evaluate(nullptr, nullptr);
+        if (column == nullptr || column->only_null()) {
+            return nullptr;
+        }
+        Slice pattern = ColumnHelper::get_const_value<TYPE_VARCHAR>(column);
+        std::string pattern_str = pattern.to_string();
+        bool is_like = predicate->fn().name.function_name == "like";
+
+        std::string search_string;
+        if (is_like) {
+            if (RE2::FullMatch(pattern_str, LIKE_SUBSTRING_RE, &search_string)) {
+                LikePredicate::remove_escape_character(&search_string);
+                substrings.emplace_back(std::move(search_string));
+            }
+            // The full match of LIKE, \z is used rather than $, which matches before a trailing newline too.
+            regexes.emplace_back("^" + LikePredicate::convert_like_pattern<false>('\\', pattern) + "\\z");
+        } else {
+            if (RE2::FullMatch(pattern_str, SUBSTRING_RE, &search_string)) {
+                substrings.emplace_back(std::move(search_string));
+            }
+            regexes.emplace_back(std::move(pattern_str));
+        }
+    }
+
+    if (substrings.size() == predicates.size()) {
+        matcher->_substrings_only = true;
+        for (const auto& substring : substrings) {
+            matcher->_match_all |= substring.empty();
+        }
+        if (matcher->_match_all) {
+            return matcher;
+        }
+        // Every occurrence of the substrings is reported, to find the ones inside a row.
+        std::vector<std::string> patterns;
+        for (const auto& substring : substrings) {
+            std::string pattern;
+            for (char c : substring) {
+                static constexpr char kHexDigits[] = "0123456789abcdef";
+                auto byte = static_cast<uint8_t>(c);
+                pattern.append("\\x");
+                pattern.push_back(kHexDigits[byte >> 4]);
+                pattern.push_back(kHexDigits[byte & 0xf]);
+            }
+            patterns.emplace_back(std::move(pattern));
+            matcher->_substring_sizes.push_back(substring.size());
+        }
+        if (matcher->_compile(patterns, 0)) {
+            return matcher;
+        }
+        return nullptr;
+    }
+
+    if (matcher->_compile(regexes, HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH)) {
+        return matcher;
+    }
+    return nullptr;
+}
+
+MultiPatternMatcher::~MultiPatternMatcher() {
+    if (_scratch != nullptr) {
+        hs_free_scratch(_scratch);
+    }
+    if (_database != nullptr) {
+        hs_free_database(_database);
+    }
+}
+
+bool MultiPatternMatcher::_collect_predicates(Expr* expr, std::vector<Expr*>* predicates) {
+    if (expr->node_type() == TExprNodeType::COMPOUND_PRED && expr->op() == TExprOpcode::COMPOUND_OR) {
+        return _collect_predicates(expr->get_child(0), predicates) &&
+               _collect_predicates(expr->get_child(1), predicates);
+    }
+    if (expr->node_type() != TExprNodeType::FUNCTION_CALL || expr->get_num_children() != 2) {
+        return false;
+    }
+    const std::string& name = expr->fn().name.function_name;
+    if (name != "like" && name != "regexp") {
+        return false;
+    }
+    if (!expr->get_child(0)->type().is_string_type() ||
+        expr->get_child(1)->node_type() != TExprNodeType::STRING_LITERAL) {
+        return false;
+    }
+    predicates->push_back(expr);
+    return true;
+}
+
+bool MultiPatternMatcher::_compile(const std::vector<std::string>& patterns, unsigned int flags) {
+    std::vector<const char*> expressions;
+    std::vector<unsigned int> expression_flags(patterns.size(), flags);
+    std::vector<unsigned int> ids;
+    for (size_t i = 0; i < patterns.size(); ++i) {
+        expressions.push_back(patterns[i].c_str());
+        ids.push_back(i);
+    }
+
+    hs_compile_error_t* compile_err = nullptr;
+    if (hs_compile_multi(expressions.data(), expression_flags.data(), ids.data(), patterns.size(), HS_MODE_BLOCK,
+                         nullptr, &_database, &compile_err) != HS_SUCCESS) {
+        // Some constructs are not supported by hyperscan, the predicates are evaluated one by one then.
+        VLOG(2) << "Failed to compile the patterns with hyperscan: " << compile_err->message;
+        hs_free_compile_error(compile_err);
+        _database = nullptr;
+        return false;
+    }
+    if (hs_alloc_scratch(_database, &_scratch) != HS_SUCCESS) {
+        LOG(WARNING) << "Unable to allocate hyperscan scratch space";
+        return false;
+    }
+    return true;
+}
+
+ColumnPtr MultiPatternMatcher::evaluate(ExprContext* context, Chunk* chunk) const {
+    ColumnPtr column = _input->evaluate(context, chunk);
+    if (column->is_constant()) {
+        return nullptr;
+    }
+
+    const BinaryColumn* data_column = nullptr;
+    NullColumnPtr null_column = nullptr;
+    if (column->is_nullable()) {
+        auto* nullable_column = down_cast<NullableColumn*>(column.get());
+        data_column = down_cast<const BinaryColumn*>(nullable_column->data_column().get());
+        null_column = nullable_column->null_column();
+    } else {
+        data_column = down_cast<const BinaryColumn*>(column.get());
+    }
+
+    const size_t num_rows = data_column->size();
+    auto result = BooleanColumn::create(num_rows, _match_all ? 1 : 0);
+    if (!_match_all && num_rows > 0) {
+        hs_scratch_t* scratch = nullptr;
+        hs_error_t status;
+        if ((status = hs_clone_scratch(_scratch, &scratch)) != HS_SUCCESS) {
+            CHECK(false) << "ERROR: Unable to clone scratch space."
+                         << " status: " << status;
+        }
+        if (_substrings_only) {
+            _match_substrings(*data_column, scratch, result->get_data().data());
+        } else {
+            _match_rows(*data_column, scratch, result->get_data().data());
+        }
+        if ((status = hs_free_scratch(scratch)) != HS_SUCCESS) {
+            CHECK(false) << "ERROR: free scratch space failure"
+                         << " status: " << status;
+        }
+    }
+
+    if (column->has_null()) {
+        return NullableColumn::create(std::move(result), std::move(null_column));
+    }
+    return result;
+}
+
+void MultiPatternMatcher::_match_substrings(const BinaryColumn& column, hs_scratch_t* scratch,
+                                            uint8_t* matched) const {
+    const auto& bytes = column.get_bytes();
+    if (bytes.empty()) {
+        return;
+    }
+
+    struct ScanState {
+        const uint32_t* offsets;
+        size_t num_rows;
+        const size_t* substring_sizes;
+        uint8_t* matched;
+        // The row of the last match, the matches are reported in the order of their ends.
+        size_t row;
+    };
+    ScanState scan_state{column.get_offset().data(), column.size(), _substring_sizes.data(), matched, 0};
+
+    auto status = hs_scan(
+            _database, reinterpret_cast<const char*>(bytes.data()), bytes.size(), 0, scratch,
+            [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags, void* ctx) -> int {
+                auto* state = static_cast<ScanState*>(ctx);
+                // The row of the last byte of the occurrence.
+                const uint32_t last = to - 1;
+                if (state->offsets[state->row] > last) {
+                    state->row = std::upper_bound(state->offsets, state->offsets + state->num_rows + 1, last) -
+                                 state->offsets - 1;
+                }
+                while (state->offsets[state->row + 1] <= last) {
+                    ++state->row;
+                }
+                // The occurrence across the rows is not a match.
+                if (to - state->substring_sizes[id] >= state->offsets[state->row]) {
+                    state->matched[state->row] = 1;
+                }
+                return 0;
+            },
+            &scan_state);
+    DCHECK(status == HS_SUCCESS) << " status: " << status;
+}
+
+void MultiPatternMatcher::_match_rows(const BinaryColumn& column, hs_scratch_t* scratch, uint8_t* matched) const {
+    for (size_t row = 0; row < column.size(); ++row) {
+        Slice value = column.get_slice(row);
+        bool v = false;
+        auto status = hs_scan(
+                // Use &_DUMMY_STRING_FOR_EMPTY_PATTERN instead of nullptr to avoid crash.
+                _database, value.size ? value.data : &LikePredicate::_DUMMY_STRING_FOR_EMPTY_PATTERN, value.size, 0,
+                scratch,
+                [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
+                   void* ctx) -> int {
+                    *((bool*)ctx) = true;
+                    return 1;
+                },
+                &v);
+        DCHECK(status == HS_SUCCESS || status == HS_SCAN_TERMINATED) << " status: " << status;
+        matched[row] = v;
+    }
+}
+
 } // namespace starrocks::vectorized
@@ -15,6 +15,10 @@
 #include "exprs/vectorized/function_helper.h"
 
 namespace starrocks {
+
+class Expr;
+class ExprContext;
+
 namespace vectorized {
 
 class LikePredicate {
@@ -139,9 +143,14 @@ private:
     template <bool fullMatch>
     static std::string convert_like_pattern(starrocks_udf::FunctionContext* context, const Slice& pattern);
 
+    template <bool fullMatch>
+    static std::string convert_like_pattern(char escape_char, const Slice& pattern);
+
     static void remove_escape_character(std::string* search_string);
 
 private:
+    friend class MultiPatternMatcher;
+
     static ColumnPtr _predicate_const_regex(FunctionContext* context, ColumnBuilder<TYPE_BOOLEAN>* result,
                                             const ColumnViewer<TYPE_VARCHAR>& value_viewer,
                                             const ColumnPtr& value_column);
@@ -207,5 +216,52 @@ private:
         }
     };
 };
+
+// MultiPatternMatcher evaluates the constant LIKE and REGEXP patterns OR-ed on the same column, e.g.
+// `col LIKE '%x%' OR col LIKE '%y%' OR col REGEXP 'a+b'`, with one hyperscan database of all the patterns,
+// instead of evaluating the predicates one by one.
+//
+// If all the patterns are substrings, i.e. `LIKE '%xxx%'` or a REGEXP without any special character, the whole
+// bytes of the column are scanned in one pass, and each occurrence is mapped to its row by the offsets.
+// Otherwise each row is scanned once against all the patterns, until the first match.
+class MultiPatternMatcher {
+public:
+    // Returns nullptr if |root| is not an OR of at least two such predicates, or the patterns could not be
+    // compiled by hyperscan.
+    static std::unique_ptr<MultiPatternMatcher> create(Expr* root);
+
+    ~MultiPatternMatcher();
+
+    // Returns nullptr if the column could not be matched, e.g. it's a constant column, and the caller should
+    // evaluate the predicates instead.
+    ColumnPtr evaluate(ExprContext* context, Chunk* chunk) const;
+
+    size_t num_patterns() const { return _num_patterns; }
+
+private:
+    MultiPatternMatcher() = default;
+
+    // Collects the LIKE and REGEXP predicates OR-ed in |expr|, returns false if there is any other predicate.
+    static bool _collect_predicates(Expr* expr, std::vector<Expr*>* predicates);
+
+    bool _compile(const std::vector<std::string>& patterns, unsigned int flags);
+
+    void _match_substrings(const BinaryColumn& column, hs_scratch_t* scratch, uint8_t* matched) const;
+
+    void _match_rows(const BinaryColumn& column, hs_scratch_t* scratch, uint8_t* matched) const;
+
+    // The string column matched against the patterns.
+    Expr* _input = nullptr;
+    size_t _num_patterns = 0;
+    // Whether all the patterns are substrings, the sizes of the substrings are indexed by the pattern id.
+    bool _substrings_only = false;
+    std::vector<size_t> _substring_sizes;
+    // Some pattern is an empty substring, which matches every string.
+    bool _match_all = false;
+
+    hs_database_t* _database = nullptr;
+    // The prototype of the scratch, cloned by each evaluation.
+    hs_scratch_t* _scratch = nullptr;
+};
 } // namespace vectorized
 } // namespace starrocks
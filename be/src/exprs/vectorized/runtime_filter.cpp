@@ -107,14 +107,121 @@ bool SimdBlockFilter::check_equal(const SimdBlockFilter& bf) const {
            memcmp(_directory, bf._directory, alloc_size) == 0;
 }
 
+void BitsetFilter::init(int64_t min, int64_t max) {
+    DCHECK_LE(min, max);
+    _min = min;
+    _num_bits = static_cast<uint64_t>(max) - static_cast<uint64_t>(min) + 1;
+    _words.assign((_num_bits + 63) / 64, 0);
+}
+
+bool BitsetFilter::test_range(int64_t min, int64_t max) const {
+    min = std::max(min, this->min());
+    max = std::min(max, this->max());
+    if (empty() || min > max) {
+        return false;
+    }
+    uint64_t begin = static_cast<uint64_t>(min) - static_cast<uint64_t>(_min);
+    uint64_t end = static_cast<uint64_t>(max) - static_cast<uint64_t>(_min) + 1;
+    for (uint64_t i = begin; i < end;) {
+        uint64_t word = _words[i >> 6] >> (i & 63);
+        uint64_t num_bits = std::min<uint64_t>(64 - (i & 63), end - i);
+        if (num_bits < 64) {
+            word &= (1ULL << num_bits) - 1;
+        }
+        if (word != 0) {
+            return true;
+        }
+        i += num_bits;
+    }
+    return false;
+}
+
+size_t BitsetFilter::count() const {
+    size_t count = 0;
+    for (uint64_t word : _words) {
+        count += __builtin_popcountll(word);
+    }
+    return count;
+}
+
+void BitsetFilter::merge(const BitsetFilter& bf) {
+    if (_min == bf._min && _num_bits == bf._num_bits) {
+        for (size_t i = 0; i < _words.size(); i++) {
+            _words[i] |= bf._words[i];
+        }
+        return;
+    }
+    BitsetFilter out;
+    out.init(std::min(min(), bf.min()), std::max(max(), bf.max()));
+    for_each([&](int64_t value) { out.insert(value); });
+    bf.for_each([&](int64_t value) { out.insert(value); });
+    *this = std::move(out);
+}
+
+size_t BitsetFilter::max_serialized_size() const {
+    return sizeof(_min) + sizeof(_num_bits) + _words.size() * sizeof(uint64_t);
+}
+
+size_t BitsetFilter::serialize(uint8_t* data) const {
+    size_t offset = 0;
+    memcpy(data + offset, &_min, sizeof(_min));
+    offset += sizeof(_min);
+    memcpy(data + offset, &_num_bits, sizeof(_num_bits));
+    offset += sizeof(_num_bits);
+    memcpy(data + offset, _words.data(), _words.size() * sizeof(uint64_t));
+    offset += _words.size() * sizeof(uint64_t);
+    return offset;
+}
+
+size_t BitsetFilter::deserialize(const uint8_t* data) {
+    size_t offset = 0;
+    memcpy(&_min, data + offset, sizeof(_min));
+    offset += sizeof(_min);
+    memcpy(&_num_bits, data + offset, sizeof(_num_bits));
+    offset += sizeof(_num_bits);
+    _words.resize((_num_bits + 63) / 64);
+    memcpy(_words.data(), data + offset, _words.size() * sizeof(uint64_t));
+    offset += _words.size() * sizeof(uint64_t);
+    return offset;
+}
+
+bool BitsetFilter::check_equal(const BitsetFilter& bf) const {
+    return _min == bf._min && _num_bits == bf._num_bits && _words == bf._words;
+}
+
+// Each filter is serialized as | use_bitset | bitset filter or simd-block-filter |.
+static size_t max_serialized_size_of(const SimdBlockFilter& bf, const BitsetFilter& bitset) {
+    return sizeof(bool) + (bitset.empty() ? bf.max_serialized_size() : bitset.max_serialized_size());
+}
+
+static size_t serialize_filter(const SimdBlockFilter& bf, const BitsetFilter& bitset, uint8_t* data) {
+    bool use_bitset = !bitset.empty();
+    memcpy(data, &use_bitset, sizeof(use_bitset));
+    return sizeof(use_bitset) + (use_bitset ? bitset.serialize(data + sizeof(use_bitset))
+                                            : bf.serialize(data + sizeof(use_bitset)));
+}
+
+static size_t deserialize_filter(SimdBlockFilter* bf, BitsetFilter* bitset, const uint8_t* data) {
+    bool use_bitset = false;
+    memcpy(&use_bitset, data, sizeof(use_bitset));
+    return sizeof(use_bitset) + (use_bitset ? bitset->deserialize(data + sizeof(use_bitset))
+                                            : bf->deserialize(data + sizeof(use_bitset)));
+}
+
+static bool check_equal_filter(const SimdBlockFilter& bf0, const BitsetFilter& bitset0, const SimdBlockFilter& bf1,
+                               const BitsetFilter& bitset1) {
+    if (bitset0.empty() != bitset1.empty()) return false;
+    return bitset0.empty() ? bf0.check_equal(bf1) : bitset0.check_equal(bitset1);
+}
+
 size_t JoinRuntimeFilter::max_serialized_size() const {
     // todo(yan): noted that it's not serialize compatible with 32-bit and 64-bit.
     size_t size = sizeof(_has_null) + sizeof(_size) + sizeof(_hash_partition_number) + sizeof(_join_mode);
     if (_hash_partition_number == 0) {
-        size += _bf.max_serialized_size();
+        size += max_serialized_size_of(_bf, _bitset);
     } else {
-        for (const auto& bf : _hash_partition_bf) {
-            size += bf.max_serialized_size();
+        for (size_t i = 0; i < _hash_partition_number; i++) {
+            size += max_serialized_size_of(_hash_partition_bf[i], _hash_partition_bitset[i]);
         }
     }
     return size;
@@ -132,11 +239,10 @@ size_t JoinRuntimeFilter::serialize(uint8_t* data) const {
 #undef JRF_COPY_FIELD
 
     if (_hash_partition_number == 0) {
-        offset += _bf.serialize(data + offset);
-
+        offset += serialize_filter(_bf, _bitset, data + offset);
     } else {
-        for (const auto& bf : _hash_partition_bf) {
-            offset += bf.serialize(data + offset);
+        for (size_t i = 0; i < _hash_partition_number; i++) {
+            offset += serialize_filter(_hash_partition_bf[i], _hash_partition_bitset[i], data + offset);
         }
     }
     return offset;
@@ -154,12 +260,14 @@ size_t JoinRuntimeFilter::deserialize(const uint8_t* data) {
 #undef JRF_COPY_FIELD
 
     if (_hash_partition_number == 0) {
-        offset += _bf.deserialize(data + offset);
+        offset += deserialize_filter(&_bf, &_bitset, data + offset);
     } else {
         for (size_t i = 0; i < _hash_partition_number; i++) {
             SimdBlockFilter bf;
-            offset += bf.deserialize(data + offset);
+            BitsetFilter bitset;
+            offset += deserialize_filter(&bf, &bitset, data + offset);
             _hash_partition_bf.emplace_back(std::move(bf));
+            _hash_partition_bitset.emplace_back(std::move(bitset));
         }
     }
 
@@ -171,10 +279,11 @@ bool JoinRuntimeFilter::check_equal(const JoinRuntimeFilter& rf) const {
                   _hash_partition_number == rf._hash_partition_number && _join_mode == rf._join_mode);
     if (!first) return false;
     if (_hash_partition_number == 0) {
-        if (!_bf.check_equal(rf._bf)) return false;
+        if (!check_equal_filter(_bf, _bitset, rf._bf, rf._bitset)) return false;
     } else {
         for (size_t i = 0; i < _hash_partition_number; i++) {
-            if (!_hash_partition_bf[i].check_equal(rf._hash_partition_bf[i])) {
+            if (!check_equal_filter(_hash_partition_bf[i], _hash_partition_bitset[i], rf._hash_partition_bf[i],
+                                    rf._hash_partition_bitset[i])) {
                 return false;
             }
         }
@@ -31,6 +31,12 @@ public:
 
     void init(size_t nums);
 
+    // Releases the directory, e.g. when the values are kept in a BitsetFilter instead.
+    void reset() noexcept {
+        free(_directory);
+        _directory = nullptr;
+    }
+
     void insert_hash(const uint64_t hash) noexcept {
         const uint32_t bucket_idx = hash & _directory_mask;
 #ifdef __AVX2__
@@ -101,6 +107,9 @@ public:
     bool check_equal(const SimdBlockFilter& bf) const;
     uint32_t directory_mask() const { return _directory_mask; }
 
+    // Sets all the bits, so that any hash passes the filter.
+    void fill() noexcept { memset(_directory, 0xff, get_alloc_size()); }
+
 private:
     // The number of bits to set in a tiny Bloom filter block
 
@@ -130,9 +139,9 @@ private:
 
     // Common:
     // log_num_buckets_ is the log (base 2) of the number of buckets in the directory:
-    int _log_num_buckets;
+    int _log_num_buckets = 0;
     // directory_mask_ is (1 << log_num_buckets_) - 1
-    uint32_t _directory_mask;
+    uint32_t _directory_mask = 0;
     Bucket* _directory = nullptr;
 };
 
@@ -190,6 +199,65 @@ private:
     size_t _capacity = 0;
 };
 
+// An exact filter of the integers in [min, min + num_bits), used instead of SimdBlockFilter if the build values
+// are dense integers, e.g. surrogate keys. It is no larger than the bloom filter then, faster to test, and has no
+// false positive.
+class BitsetFilter {
+public:
+    // Whether the values in [min, max] are dense enough for a bitset no larger than the bloom filter of
+    // |num_values| values, which takes at least one byte per value.
+    static bool is_dense(int64_t min, int64_t max, size_t num_values) {
+        return min <= max &&
+               static_cast<uint64_t>(max) - static_cast<uint64_t>(min) < std::max<uint64_t>(num_values, 1) * 8;
+    }
+
+    void init(int64_t min, int64_t max);
+
+    bool empty() const { return _words.empty(); }
+
+    int64_t min() const { return _min; }
+    int64_t max() const { return static_cast<int64_t>(static_cast<uint64_t>(_min) + _num_bits - 1); }
+
+    void insert(int64_t value) {
+        uint64_t offset = static_cast<uint64_t>(value) - static_cast<uint64_t>(_min);
+        DCHECK_LT(offset, _num_bits);
+        _words[offset >> 6] |= 1ULL << (offset & 63);
+    }
+
+    bool test(int64_t value) const {
+        uint64_t offset = static_cast<uint64_t>(value) - static_cast<uint64_t>(_min);
+        return offset < _num_bits && ((_words[offset >> 6] >> (offset & 63)) & 1);
+    }
+
+    // whether any value in [min, max] is in the filter
+    bool test_range(int64_t min, int64_t max) const;
+
+    // the number of the values in the filter
+    size_t count() const;
+
+    template <typename Func>
+    void for_each(Func&& func) const {
+        for (size_t i = 0; i < _words.size(); i++) {
+            for (uint64_t word = _words[i]; word != 0; word &= word - 1) {
+                func(static_cast<int64_t>(static_cast<uint64_t>(_min) + i * 64 + __builtin_ctzll(word)));
+            }
+        }
+    }
+
+    // The range of |bf| may be different, and the range of this filter is extended to cover both.
+    void merge(const BitsetFilter& bf);
+
+    size_t max_serialized_size() const;
+    size_t serialize(uint8_t* data) const;
+    size_t deserialize(const uint8_t* data);
+    bool check_equal(const BitsetFilter& bf) const;
+
+private:
+    int64_t _min = 0;
+    uint64_t _num_bits = 0;
+    std::vector<uint64_t> _words;
+};
+
 // The runtime filter generated by join right small table
 class JoinRuntimeFilter {
 public:
@@ -224,20 +292,28 @@ public:
     virtual void concat(JoinRuntimeFilter* rf) {
         _has_null |= rf->_has_null;
         _hash_partition_bf.emplace_back(std::move(rf->_bf));
+        _hash_partition_bitset.emplace_back(std::move(rf->_bitset));
         _hash_partition_number = _hash_partition_bf.size();
         _join_mode = rf->_join_mode;
         _size += rf->_size;
     }
     virtual bool check_equal(const JoinRuntimeFilter& rf) const;
     virtual JoinRuntimeFilter* create_empty(ObjectPool* pool) = 0;
+    // Creates a filter which keeps only the min/max of this filter, i.e. all the values in [min, max] pass it.
+    // It's used instead of this filter if this one is too large to be worth shipping.
+    virtual JoinRuntimeFilter* create_min_max_only(ObjectPool* pool) const = 0;
 
 protected:
     bool _has_null = false;
     size_t _size = 0;
     int8_t _join_mode = 0;
     SimdBlockFilter _bf;
+    // Used instead of _bf if not empty, see BitsetFilter.
+    BitsetFilter _bitset;
     size_t _hash_partition_number = 0;
     std::vector<SimdBlockFilter> _hash_partition_bf;
+    // Used instead of the bloom filter of the same partition if not empty.
+    std::vector<BitsetFilter> _hash_partition_bitset;
 };
 
 // The join runtime filter implement by bloom filter
@@ -247,11 +323,24 @@ public:
     using CppType = RunTimeCppType<Type>;
     using ColumnType = RunTimeColumnType<Type>;
 
+    // The dense integer values can be kept in a BitsetFilter.
+    static constexpr bool can_use_bitset = std::is_integral_v<CppType> && sizeof(CppType) <= sizeof(int64_t);
+
     RuntimeBloomFilter() = default;
     ~RuntimeBloomFilter() override = default;
 
     RuntimeBloomFilter* create_empty(ObjectPool* pool) override { return pool->add(new RuntimeBloomFilter()); };
 
+    RuntimeBloomFilter* create_min_max_only(ObjectPool* pool) const override {
+        auto* rf = pool->add(new RuntimeBloomFilter());
+        rf->init(0);
+        rf->_bf.fill();
+        rf->_has_null = _has_null;
+        rf->_join_mode = _join_mode;
+        rf->merge_min_max(this);
+        return rf;
+    }
+
     void init_min_max() {
         _has_min_max = false;
 
@@ -285,6 +374,38 @@ public:
         init_min_max();
     }
 
+    // Keeps the values in a BitsetFilter instead of the bloom filter if the values to insert, which are all in
+    // [min, max], are dense. It must be called before any value is inserted.
+    void init_bitset_if_dense(CppType min, CppType max) {
+        static_assert(can_use_bitset);
+        DCHECK(!_has_min_max);
+        if (BitsetFilter::is_dense(min, max, _size)) {
+            _bf.reset();
+            _bitset.init(min, max);
+        }
+    }
+
+    bool has_bitset() const { return !_bitset.empty(); }
+
+    const BitsetFilter& bitset() const { return _bitset; }
+
+    // Whether any value in [min, max] may be in the filter. It's used to skip the data by zone maps,
+    // e.g. the row groups of parquet files.
+    bool test_range(CppType min, CppType max) const {
+        if (!_has_min_max) {
+            return true;
+        }
+        if (max < _min || _max < min) {
+            return false;
+        }
+        if constexpr (can_use_bitset) {
+            if (!_bitset.empty()) {
+                return _bitset.test_range(min, max);
+            }
+        }
+        return true;
+    }
+
     size_t compute_hash(CppType value) const {
         if constexpr (IsSlice<CppType>) {
             return SliceHash()(value);
@@ -299,8 +420,16 @@ public:
             return;
         }
 
-        size_t hash = compute_hash(*value);
-        _bf.insert_hash(hash);
+        if constexpr (can_use_bitset) {
+            if (!_bitset.empty()) {
+                _bitset.insert(*value);
+            } else {
+                _bf.insert_hash(compute_hash(*value));
+            }
+        } else {
+            size_t hash = compute_hash(*value);
+            _bf.insert_hash(hash);
+        }
 
         _min = std::min(*value, _min);
         _max = std::max(*value, _max);
@@ -319,6 +448,11 @@ public:
                 return false;
             }
         }
+        if constexpr (can_use_bitset) {
+            if (!_bitset.empty()) {
+                return _bitset.test(value);
+            }
+        }
         size_t hash = compute_hash(value);
         return _bf.test_hash(hash);
     }
@@ -331,6 +465,11 @@ public:
         }
         // module has been done outside, so actually here is bucket idx.
         const uint32_t bucket_idx = shuffle_hash;
+        if constexpr (can_use_bitset) {
+            if (!_hash_partition_bitset[bucket_idx].empty()) {
+                return _hash_partition_bitset[bucket_idx].test(value);
+            }
+        }
         size_t hash = compute_hash(value);
         return _hash_partition_bf[bucket_idx].test_hash(hash);
     }
@@ -449,8 +588,16 @@ public:
     }
 
     void merge(const JoinRuntimeFilter* rf) override {
+        const auto* other = down_cast<const RuntimeBloomFilter*>(rf);
+        if constexpr (can_use_bitset) {
+            if (!_bitset.empty() || !other->_bitset.empty()) {
+                _merge_bitset(other);
+                merge_min_max(other);
+                return;
+            }
+        }
         JoinRuntimeFilter::merge(rf);
-        merge_min_max(down_cast<const RuntimeBloomFilter*>(rf));
+        merge_min_max(other);
     }
 
     void concat(JoinRuntimeFilter* rf) override {
@@ -485,6 +632,9 @@ public:
         PrimitiveType ptype = Type;
         std::stringstream ss;
         ss << "RuntimeBF(type = " << ptype << ", bfsize = " << _size << ", has_null = " << _has_null;
+        if (!_bitset.empty()) {
+            ss << ", bitset = [" << _bitset.min() << ", " << _bitset.max() << "]";
+        }
         if constexpr (std::is_integral_v<CppType> || std::is_floating_point_v<CppType>) {
             if constexpr (!std::is_same_v<CppType, __int128>) {
                 ss << ", _min = " << _min << ", _max = " << _max;
@@ -611,6 +761,34 @@ public:
     }
 
 private:
+    // Both of the filters keep the values in bitsets if the union is still dense, otherwise in the bloom filter.
+    void _merge_bitset(const RuntimeBloomFilter* other) {
+        _has_null |= other->_has_null;
+        if (!_bitset.empty() && !other->_bitset.empty()) {
+            _bitset.merge(other->_bitset);
+            if (BitsetFilter::is_dense(_bitset.min(), _bitset.max(), _size)) {
+                return;
+            }
+            _convert_bitset_to_bloom_filter();
+            return;
+        }
+        if (!_bitset.empty()) {
+            _convert_bitset_to_bloom_filter();
+        }
+        if (!other->_bitset.empty()) {
+            other->_bitset.for_each(
+                    [this](int64_t value) { _bf.insert_hash(compute_hash(static_cast<CppType>(value))); });
+        } else {
+            _bf.merge(other->_bf);
+        }
+    }
+
+    void _convert_bitset_to_bloom_filter() {
+        _bf.init(_size);
+        _bitset.for_each([this](int64_t value) { _bf.insert_hash(compute_hash(static_cast<CppType>(value))); });
+        _bitset = BitsetFilter();
+    }
+
     CppType _min;
     CppType _max;
     std::string _slice_min;
@@ -18,7 +18,8 @@ namespace starrocks::vectorized {
 
 // 0x1. initial global runtime filter impl
 // 0x2. change simd-block-filter hash function.
-static const uint8_t RF_VERSION = 0x2;
+// 0x3. add bitset filter of dense integers.
+static const uint8_t RF_VERSION = 0x3;
 
 struct FilterBuilder {
     template <PrimitiveType ptype>
@@ -84,10 +85,27 @@ JoinRuntimeFilter* RuntimeFilterHelper::create_runtime_bloom_filter(ObjectPool*
 
 struct FilterIniter {
     template <PrimitiveType ptype>
-    auto operator()(const ColumnPtr& column, size_t column_offset, JoinRuntimeFilter* expr, bool eq_null) {
-        using ColumnType = typename RunTimeTypeTraits<ptype>::ColumnType;
+    auto operator()(const std::vector<ColumnPtr>& columns, size_t column_offset, JoinRuntimeFilter* expr,
+                    bool eq_null) {
         auto* filter = (RuntimeBloomFilter<ptype>*)(expr);
 
+        if constexpr (RuntimeBloomFilter<ptype>::can_use_bitset) {
+            if (!filter->has_min_max() && !filter->has_bitset()) {
+                _init_bitset_if_dense<ptype>(columns, column_offset, filter);
+            }
+        }
+        for (const auto& column : columns) {
+            _insert<ptype>(column, column_offset, filter, eq_null);
+        }
+        return nullptr;
+    }
+
+private:
+    template <PrimitiveType ptype>
+    static void _insert(const ColumnPtr& column, size_t column_offset, RuntimeBloomFilter<ptype>* filter,
+                        bool eq_null) {
+        using ColumnType = typename RunTimeTypeTraits<ptype>::ColumnType;
+
         if (column->is_nullable()) {
             auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(column);
             auto& data_array = ColumnHelper::as_raw_column<ColumnType>(nullable_column->data_column())->get_data();
@@ -107,16 +125,82 @@ struct FilterIniter {
                 filter->insert(&data_ptr[j]);
             }
         }
-        return nullptr;
+    }
+
+    // Scans the min and max of all the values ahead, so the dense values can be kept in a bitset.
+    template <PrimitiveType ptype>
+    static void _init_bitset_if_dense(const std::vector<ColumnPtr>& columns, size_t column_offset,
+                                      RuntimeBloomFilter<ptype>* filter) {
+        using ColumnType = typename RunTimeTypeTraits<ptype>::ColumnType;
+        using CppType = RunTimeCppType<ptype>;
+
+        bool has_value = false;
+        CppType min_value{};
+        CppType max_value{};
+        for (const auto& column : columns) {
+            const NullableColumn* nullable_column = nullptr;
+            const ColumnType* data_column = nullptr;
+            if (column->is_nullable()) {
+                nullable_column = ColumnHelper::as_raw_column<NullableColumn>(column);
+                data_column = ColumnHelper::as_raw_column<ColumnType>(nullable_column->data_column());
+            } else {
+                data_column = ColumnHelper::as_raw_column<ColumnType>(column);
+            }
+            const auto& data = data_column->get_data();
+            for (size_t j = column_offset; j < data.size(); j++) {
+                if (nullable_column != nullptr && nullable_column->is_null(j)) {
+                    continue;
+                }
+                if (!has_value) {
+                    min_value = max_value = data[j];
+                    has_value = true;
+                } else {
+                    min_value = std::min(min_value, data[j]);
+                    max_value = std::max(max_value, data[j]);
+                }
+            }
+        }
+        if (has_value) {
+            filter->init_bitset_if_dense(min_value, max_value);
+        }
     }
 };
 
 Status RuntimeFilterHelper::fill_runtime_bloom_filter(const ColumnPtr& column, PrimitiveType type,
                                                       JoinRuntimeFilter* filter, size_t column_offset, bool eq_null) {
-    type_dispatch_filter(type, nullptr, FilterIniter(), column, column_offset, filter, eq_null);
+    return fill_runtime_bloom_filter(std::vector<ColumnPtr>{column}, type, filter, column_offset, eq_null);
+}
+
+Status RuntimeFilterHelper::fill_runtime_bloom_filter(const std::vector<ColumnPtr>& columns, PrimitiveType type,
+                                                      JoinRuntimeFilter* filter, size_t column_offset, bool eq_null) {
+    type_dispatch_filter(type, nullptr, FilterIniter(), columns, column_offset, filter, eq_null);
     return Status::OK();
 }
 
+struct FilterZoneMapWithMinMax {
+    template <PrimitiveType ptype>
+    bool operator()(const JoinRuntimeFilter* expr, const Column* min_column, const Column* max_column) {
+        using ColumnType = typename RunTimeTypeTraits<ptype>::ColumnType;
+        // the type of probe slot may be different from the type of build expr.
+        const auto* filter = dynamic_cast<const RuntimeBloomFilter<ptype>*>(expr);
+        if (filter == nullptr || min_column->size() != 1 || max_column->size() != 1 || min_column->is_null(0) ||
+            max_column->is_null(0)) {
+            return false;
+        }
+        const auto* min_data = down_cast<const ColumnType*>(ColumnHelper::get_data_column(min_column));
+        const auto* max_data = down_cast<const ColumnType*>(ColumnHelper::get_data_column(max_column));
+        return !filter->test_range(min_data->get_data()[0], max_data->get_data()[0]);
+    }
+};
+
+bool RuntimeFilterHelper::filter_zonemap_with_min_max(PrimitiveType type, const JoinRuntimeFilter* filter,
+                                                      const Column* min_column, const Column* max_column) {
+    if (filter == nullptr || filter->has_null()) {
+        return false;
+    }
+    return type_dispatch_filter(type, false, FilterZoneMapWithMinMax(), filter, min_column, max_column);
+}
+
 Status RuntimeFilterBuildDescriptor::init(ObjectPool* pool, const TRuntimeFilterDescription& desc) {
     _filter_id = desc.filter_id;
     _build_expr_order = desc.expr_order;
@@ -43,6 +43,14 @@ public:
     static JoinRuntimeFilter* create_runtime_bloom_filter(ObjectPool* pool, PrimitiveType type);
     static Status fill_runtime_bloom_filter(const ColumnPtr& column, PrimitiveType type, JoinRuntimeFilter* filter,
                                             size_t column_offset, bool eq_null);
+    // Fills all the |columns| into |filter| at once, which lets the dense integers be kept in a bitset.
+    static Status fill_runtime_bloom_filter(const std::vector<ColumnPtr>& columns, PrimitiveType type,
+                                            JoinRuntimeFilter* filter, size_t column_offset, bool eq_null);
+
+    // Returns true if the data whose values are all in [min_column[0], max_column[0]], e.g. a row group of
+    // parquet files, can be skipped by |filter|. The columns are of |type|.
+    static bool filter_zonemap_with_min_max(PrimitiveType type, const JoinRuntimeFilter* filter,
+                                            const Column* min_column, const Column* max_column);
 };
 
 // how to generate & publish this runtime filter
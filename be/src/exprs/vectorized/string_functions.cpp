@@ -1554,8 +1554,35 @@ DEFINE_UNARY_FN_WITH_IMPL(utf8LengthImpl, str) {
     return utf8_len(str.data, str.data + str.size);
 }
 
+struct Utf8LengthFunction {
+    template <PrimitiveType Type, PrimitiveType ResultType>
+    static inline ColumnPtr evaluate(const ColumnPtr& column) {
+        BinaryColumn* src = down_cast<BinaryColumn*>(column.get());
+        const auto& src_bytes = src->get_bytes();
+        const auto& src_offsets = src->get_offset();
+        const auto num_rows = src->size();
+
+        auto result = RunTimeColumnType<TYPE_INT>::create();
+        auto& lengths = result->get_data();
+        lengths.resize(num_rows);
+
+        // the utf8 length of an ASCII string is its byte size, which is the difference of the adjacent offsets.
+        if (validate_ascii_fast((const char*)src_bytes.data(), src_bytes.size())) {
+            for (size_t i = 0; i < num_rows; ++i) {
+                lengths[i] = src_offsets[i + 1] - src_offsets[i];
+            }
+        } else {
+            const char* data = (const char*)src_bytes.data();
+            for (size_t i = 0; i < num_rows; ++i) {
+                lengths[i] = utf8_len(data + src_offsets[i], data + src_offsets[i + 1]);
+            }
+        }
+        return result;
+    }
+};
+
 ColumnPtr StringFunctions::utf8_length(FunctionContext* context, const starrocks::vectorized::Columns& columns) {
-    return VectorizedStrictUnaryFunction<utf8LengthImpl>::evaluate<TYPE_VARCHAR, TYPE_INT>(columns[0]);
+    return VectorizedUnaryFunction<Utf8LengthFunction>::evaluate<TYPE_VARCHAR, TYPE_INT>(columns[0]);
 }
 
 template <char CA, char CZ>
@@ -1572,6 +1599,19 @@ static inline void vectorized_toggle_case(const Bytes* src, Bytes* dst) {
     char* begin = (char*)(src->data());
     char* end = (char*)(begin + size);
     char* src_ptr = begin;
+#if defined(__AVX2__)
+    static constexpr int AVX2_BYTES = sizeof(__m256i);
+    const char* avx2_end = begin + (size & ~(AVX2_BYTES - 1));
+    const auto a_minus1_avx2 = _mm256_set1_epi8(CA - 1);
+    const auto z_plus1_avx2 = _mm256_set1_epi8(CZ + 1);
+    const auto flips_avx2 = _mm256_set1_epi8(32);
+
+    for (; src_ptr < avx2_end; src_ptr += AVX2_BYTES, dst_ptr += AVX2_BYTES) {
+        auto bytes = _mm256_loadu_si256((const __m256i*)src_ptr);
+        auto masks = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, a_minus1_avx2), _mm256_cmpgt_epi8(z_plus1_avx2, bytes));
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_xor_si256(bytes, _mm256_and_si256(masks, flips_avx2)));
+    }
+#endif
 #if defined(__SSE2__)
     static constexpr int SSE2_BYTES = sizeof(__m128i);
     const char* sse2_end = begin + (size & ~(SSE2_BYTES - 1));
@@ -1579,7 +1619,7 @@ static inline void vectorized_toggle_case(const Bytes* src, Bytes* dst) {
     const auto z_plus1 = _mm_set1_epi8(CZ + 1);
     const auto flips = _mm_set1_epi8(32);
 
-    for (; src_ptr > sse2_end; src_ptr += SSE2_BYTES, dst_ptr += SSE2_BYTES) {
+    for (; src_ptr < sse2_end; src_ptr += SSE2_BYTES, dst_ptr += SSE2_BYTES) {
         auto bytes = _mm_loadu_si128((const __m128i*)src_ptr);
         // the i-th byte of masks is set to 0xff if the corresponding byte is
         // between a..z when computing upper function (A..Z when computing lower function),
@@ -1825,7 +1865,8 @@ struct AdaptiveLTrimFunction {
         const auto num_rows = src->size();
         raw::make_room(&dst_offsets, num_rows + 1);
         dst_offsets[0] = 0;
-        dst_bytes.reserve(dst_bytes.size());
+        // the trimmed strings never exceed the source ones, so the bytes are allocated once.
+        dst_bytes.reserve(src->get_bytes().size());
 
         size_t i = 0;
         const auto sample_num = std::min(num_rows, 100ul);
@@ -1836,7 +1877,7 @@ struct AdaptiveLTrimFunction {
         }
         // when the average number of leading spaces in the sample is greater than simd_threshold,
         // SIMD optimization is enabled.
-        if (spaces_num < simd_threshold * spaces_num) {
+        if (spaces_num < simd_threshold * sample_num) {
             for (; i < num_rows; ++i) {
                 trim_per_slice<TRIM_LEFT, TRIM_SIMD_NONE, false>(src, i, &dst_bytes, &dst_offsets, nullptr, nullptr);
             }
@@ -1862,7 +1903,8 @@ struct AdaptiveRTrimFunction {
         const auto num_rows = src->size();
         raw::make_room(&dst_offsets, num_rows + 1);
         dst_offsets[0] = 0;
-        dst_bytes.reserve(dst_bytes.size());
+        // the trimmed strings never exceed the source ones, so the bytes are allocated once.
+        dst_bytes.reserve(src->get_bytes().size());
 
         size_t i = 0;
         const auto sample_num = std::min(num_rows, 100ul);
@@ -1899,7 +1941,8 @@ struct AdaptiveTrimFunction {
         const auto num_rows = src->size();
         raw::make_room(&dst_offsets, num_rows + 1);
         dst_offsets[0] = 0;
-        dst_bytes.reserve(dst_bytes.size());
+        // the trimmed strings never exceed the source ones, so the bytes are allocated once.
+        dst_bytes.reserve(src->get_bytes().size());
 
         size_t i = 0;
         const auto sample_num = std::min(num_rows, 100ul);
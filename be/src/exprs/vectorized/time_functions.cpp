@@ -10,6 +10,7 @@
 #include "runtime/date_value.h"
 #include "runtime/runtime_state.h"
 #include "udf/udf_internal.h"
+#include "util/timezone_utils.h"
 
 namespace starrocks::vectorized {
 // index as day of week(1: Sunday, 2: Monday....), value as distance of this day and first day(Monday) of this week.
@@ -213,34 +214,19 @@ ColumnPtr TimeFunctions::convert_tz_const(FunctionContext* context, const Column
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_DATETIME> result(size);
+    // The offsets of both time zones are looked up only when the timestamps cross a transition, and the rows
+    // between are converted by adding the offsets to the seconds.
+    TimezoneOffsetCache from_cache(from);
+    TimezoneOffsetCache to_cache(to);
     for (int row = 0; row < size; ++row) {
         if (time_viewer.is_null(row)) {
             result.append_null();
             continue;
         }
 
-        auto datetime_value = time_viewer.value(row);
-
-        int year, month, day, hour, minute, second, usec;
-        datetime_value.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
-        DateTimeValue ts_value(TIME_DATETIME, year, month, day, hour, minute, second, usec);
-
-        int64_t timestamp;
-        // TODO find a better approach to replace datetime_value.unix_timestamp
-        if (!ts_value.unix_timestamp(&timestamp, from)) {
-            result.append_null();
-            continue;
-        }
-        DateTimeValue ts_value2;
-        // TODO find a better approach to replace datetime_value.from_unixtime
-        if (!ts_value2.from_unixtime(timestamp, to)) {
-            result.append_null();
-            continue;
-        }
-
+        int64_t timestamp = from_cache.local_to_utc(time_viewer.value(row).to_unix_second());
         TimestampValue ts;
-        ts.from_timestamp(ts_value2.year(), ts_value2.month(), ts_value2.day(), ts_value2.hour(), ts_value2.minute(),
-                          ts_value2.second(), 0);
+        ts.from_unix_second(to_cache.utc_to_local(timestamp));
         result.append(ts);
     }
 
@@ -861,6 +847,7 @@ ColumnPtr TimeFunctions::from_unix_to_datetime(FunctionContext* context, const C
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_VARCHAR> result(size);
+    TimezoneOffsetCache cache(context->impl()->state()->timezone_obj());
     for (int row = 0; row < size; ++row) {
         if (data_column.is_null(row)) {
             result.append_null();
@@ -873,14 +860,11 @@ ColumnPtr TimeFunctions::from_unix_to_datetime(FunctionContext* context, const C
             continue;
         }
 
-        DateTimeValue dtv;
-        if (!dtv.from_unixtime(date, context->impl()->state()->timezone_obj())) {
-            result.append_null();
-            continue;
-        }
+        TimestampValue ts;
+        ts.from_unix_second(cache.utc_to_local(date));
         char buf[64];
-        dtv.to_string(buf);
-        result.append(Slice(buf));
+        int len = ts.to_string(buf, sizeof(buf));
+        result.append(Slice(buf, len));
     }
 
     return result.build(ColumnHelper::is_all_const(columns));
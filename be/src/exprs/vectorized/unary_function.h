@@ -158,6 +158,13 @@ public:
             return v1;
         }
 
+        if (v1->is_nullable() && !v1->has_null()) {
+            // no null rows, evaluate the data column only like UnionNullableColumnBinaryFunction does,
+            // without scanning and copying the null column.
+            const auto& data_column = ColumnHelper::as_raw_column<NullableColumn>(v1)->data_column();
+            return FN::template evaluate<Type, ResultType, Args...>(data_column, std::forward<Args>(args)...);
+        }
+
         if (v1->is_nullable()) {
             auto col = ColumnHelper::as_raw_column<NullableColumn>(v1);
 
@@ -2,6 +2,10 @@
 
 #include "formats/csv/csv_reader.h"
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 namespace starrocks::vectorized {
 
 Status CSVReader::next_record(Record* record) {
@@ -10,7 +14,7 @@ Status CSVReader::next_record(Record* record) {
     }
     char* d;
     size_t pos = 0;
-    while ((d = _buff.find(_row_delimiter, pos)) == nullptr) {
+    while ((d = _find_row_delimiter(pos)) == nullptr) {
         pos = _buff.available();
         _buff.compact();
         if (_buff.free_space() == 0) {
@@ -18,12 +22,33 @@ Status CSVReader::next_record(Record* record) {
         }
         RETURN_IF_ERROR(_fill_buffer());
     }
-    size_t l = d - _buff.position();
+    _consume_record(d, record);
+    return Status::OK();
+}
+
+bool CSVReader::next_buffered_record(Record* record) {
+    if (_limit > 0 && _parsed_bytes > _limit) {
+        return false;
+    }
+    char* d = _find_row_delimiter(0);
+    if (d == nullptr) {
+        return false;
+    }
+    _consume_record(d, record);
+    return true;
+}
+
+char* CSVReader::_find_row_delimiter(size_t pos) {
+    // memchr is much faster than memmem for the common single byte delimiters.
+    return _row_delimiter_length == 1 ? _buff.find(_row_delimiter[0], pos) : _buff.find(_row_delimiter, pos);
+}
+
+void CSVReader::_consume_record(char* delimiter, Record* record) {
+    size_t l = delimiter - _buff.position();
     *record = Record(_buff.position(), l);
     _buff.skip(l + _row_delimiter_length);
     //               ^^ skip record delimiter.
     _parsed_bytes += l + _row_delimiter_length;
-    return Status::OK();
 }
 
 Status CSVReader::_expand_buffer() {
@@ -47,8 +72,24 @@ void CSVReader::split_record(const Record& record, Fields* fields) const {
     const size_t size = record.size;
 
     if (_column_separator_length == 1) {
-        for (size_t i = 0; i < size; ++i, ++ptr) {
-            if (*ptr == _column_separator[0]) {
+        const char separator = _column_separator[0];
+        size_t i = 0;
+#ifdef __AVX2__
+        // Compare 32 bytes at a time, and visit the separators by the bits of the mask.
+        const __m256i separators = _mm256_set1_epi8(separator);
+        for (; i + 32 <= size; i += 32) {
+            __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(record.data + i));
+            auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, separators)));
+            while (mask != 0) {
+                const char* separator_ptr = record.data + i + __builtin_ctz(mask);
+                fields->emplace_back(value, separator_ptr - value);
+                value = separator_ptr + 1;
+                mask &= mask - 1;
+            }
+        }
+#endif
+        for (ptr = record.data + i; i < size; ++i, ++ptr) {
+            if (*ptr == separator) {
                 fields->emplace_back(value, ptr - value);
                 value = ptr + 1;
             }
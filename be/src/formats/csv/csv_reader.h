@@ -84,6 +84,11 @@ public:
 
     Status next_record(Record* record);
 
+    // Returns the next record if it's entirely in the buffer already. Unlike next_record(), this never moves
+    // the buffer, so the records returned before are still valid. Returns false if the buffer needs to be
+    // filled or the limit is reached, and next_record() should be called then.
+    bool next_buffered_record(Record* record);
+
     void set_limit(size_t limit) { _limit = limit; }
 
     void split_record(const Record& record, Fields* fields) const;
@@ -100,6 +105,9 @@ protected:
 
 private:
     Status _expand_buffer();
+    // Finds the next record delimiter, searching from |pos| of the available bytes.
+    char* _find_row_delimiter(size_t pos);
+    void _consume_record(char* delimiter, Record* record);
 
     size_t _parsed_bytes = 0;
     size_t _limit = 0;
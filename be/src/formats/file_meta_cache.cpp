@@ -0,0 +1,83 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "formats/file_meta_cache.h"
+
+#include <cstring>
+
+#include "gutil/int128.h"
+#include "runtime/mem_tracker.h"
+
+namespace starrocks {
+
+FileMetaCache* FileMetaCache::_s_instance = nullptr;
+
+namespace {
+
+struct CacheValue {
+    std::shared_ptr<const void> meta;
+    MemTracker* mem_tracker;
+    int64_t charge;
+};
+
+struct CacheKeyBuffer {
+    CacheKeyBuffer(FileMetaCache::MetaType type, const FileMetaCache::FileId& file_id) {
+        uint64_t high = Uint128High64(file_id);
+        uint64_t low = Uint128Low64(file_id);
+        memcpy(data, &high, sizeof(high));
+        memcpy(data + sizeof(high), &low, sizeof(low));
+        data[2 * sizeof(uint64_t)] = static_cast<char>(type);
+    }
+
+    CacheKey encode() const { return {data, sizeof(data)}; }
+
+    char data[2 * sizeof(uint64_t) + 1];
+};
+
+void delete_cache_value(const CacheKey& /*key*/, void* value) {
+    auto* cache_value = reinterpret_cast<CacheValue*>(value);
+    if (cache_value->mem_tracker != nullptr) {
+        cache_value->mem_tracker->release(cache_value->charge);
+    }
+    delete cache_value;
+}
+
+} // namespace
+
+void FileMetaCache::create_global_cache(MemTracker* mem_tracker, size_t capacity) {
+    if (_s_instance == nullptr) {
+        _s_instance = new FileMetaCache(mem_tracker, capacity);
+    }
+}
+
+void FileMetaCache::release_global_cache() {
+    if (_s_instance != nullptr) {
+        delete _s_instance;
+        _s_instance = nullptr;
+    }
+}
+
+FileMetaCache::FileMetaCache(MemTracker* mem_tracker, size_t capacity)
+        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity)) {}
+
+std::shared_ptr<const void> FileMetaCache::_lookup(MetaType type, const FileId& file_id) {
+    CacheKeyBuffer key(type, file_id);
+    Cache::Handle* handle = _cache->lookup(key.encode());
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    auto meta = reinterpret_cast<CacheValue*>(_cache->value(handle))->meta;
+    _cache->release(handle);
+    return meta;
+}
+
+void FileMetaCache::insert(MetaType type, const FileId& file_id, std::shared_ptr<const void> meta, size_t charge) {
+    CacheKeyBuffer key(type, file_id);
+    auto* value = new CacheValue{std::move(meta), _mem_tracker, static_cast<int64_t>(charge)};
+    if (_mem_tracker != nullptr) {
+        _mem_tracker->consume(charge);
+    }
+    Cache::Handle* handle = _cache->insert(key.encode(), value, charge, delete_cache_value);
+    _cache->release(handle);
+}
+
+} // namespace starrocks
@@ -0,0 +1,57 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+
+#include "io/block_cache.h"
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+class MemTracker;
+
+// A global LRU cache of the metadata of the remote data files, e.g. the parsed footers of the parquet files
+// and the serialized tails of the orc files, bounded by the memory they take. The file is identified by its
+// path, modification time and size, so the metadata of an overwritten file is never hit.
+//
+// The scans of many small files read and parse the footer of every file once per query, which costs one
+// remote read, while the data they read may be cached by io::BlockCache or not read at all.
+class FileMetaCache {
+public:
+    using FileId = io::BlockCache::FileId;
+
+    enum class MetaType : uint8_t { PARQUET_FOOTER, ORC_FILE_TAIL };
+
+    // Create the global instance with the |capacity| in bytes, of which the memory is consumed by
+    // |mem_tracker|.
+    static void create_global_cache(MemTracker* mem_tracker, size_t capacity);
+
+    static void release_global_cache();
+
+    // Return the global instance, or nullptr if it's not created.
+    static FileMetaCache* instance() { return _s_instance; }
+
+    FileMetaCache(MemTracker* mem_tracker, size_t capacity);
+
+    // Return nullptr if the metadata of |type| of |file_id| is not cached.
+    template <typename T>
+    std::shared_ptr<const T> lookup(MetaType type, const FileId& file_id) {
+        return std::static_pointer_cast<const T>(_lookup(type, file_id));
+    }
+
+    // Cache the |meta| of |type| of |file_id|, which takes |charge| bytes, replacing the old one if any.
+    void insert(MetaType type, const FileId& file_id, std::shared_ptr<const void> meta, size_t charge);
+
+    size_t memory_usage() const { return _cache->get_memory_usage(); }
+
+private:
+    std::shared_ptr<const void> _lookup(MetaType type, const FileId& file_id);
+
+    static FileMetaCache* _s_instance;
+
+    MemTracker* _mem_tracker;
+    std::unique_ptr<Cache> _cache;
+};
+
+} // namespace starrocks
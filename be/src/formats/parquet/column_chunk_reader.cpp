@@ -84,6 +84,32 @@ Status ColumnChunkReader::next_page() {
     return Status::OK();
 }
 
+Status ColumnChunkReader::skip_page() {
+    if (_page_parse_state != PAGE_HEADER_PARSED) {
+        return Status::InternalError("Error state");
+    }
+    _page_reader->skip_page_data();
+    _page_parse_state = PAGE_DATA_PARSED;
+    return Status::OK();
+}
+
+uint32_t ColumnChunkReader::page_header_num_values() const {
+    const auto& header = *_page_reader->current_header();
+    if (header.type != tparquet::PageType::DATA_PAGE) {
+        return 0;
+    }
+    return header.data_page_header.num_values;
+}
+
+bool ColumnChunkReader::current_page_has_no_nulls() const {
+    const auto& header = *_page_reader->current_header();
+    if (header.type != tparquet::PageType::DATA_PAGE || !header.data_page_header.__isset.statistics) {
+        return false;
+    }
+    const auto& statistics = header.data_page_header.statistics;
+    return statistics.__isset.null_count && statistics.null_count == 0;
+}
+
 Status ColumnChunkReader::_parse_page_header() {
     DCHECK(_page_parse_state == INITIALIZED || _page_parse_state == PAGE_DATA_PARSED);
     RETURN_IF_ERROR(_page_reader->next_header());
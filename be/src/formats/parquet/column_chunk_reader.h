@@ -40,8 +40,22 @@ public:
 
     Status next_page();
 
+    // next_page() is split into next_page_header() and parse_page_data(), so the caller can decide by the page
+    // header whether to skip the page with skip_page(), which doesn't read or decompress the page data.
+    // Returns EndOfFile if there are no more pages.
+    Status next_page_header() { return _parse_page_header(); }
+    Status parse_page_data() { return _parse_page_data(); }
+    Status skip_page();
+
+    // The number of values of the page whose header is parsed, or 0 if it's not a data page.
+    uint32_t page_header_num_values() const;
+
     uint32_t num_values() const { return _num_values; }
 
+    // Whether the statistics of the current data page says it has no nulls, so its definition levels
+    // don't need to be decoded.
+    bool current_page_has_no_nulls() const;
+
     // Try to decode n definition levels into 'levels'
     // return number of decoded levels.
     // If the returned value is less than input n, this means current page don't have
@@ -3,6 +3,7 @@
 #include "formats/parquet/column_reader.h"
 
 #include "column/array_column.h"
+#include "column/column_helper.h"
 #include "formats/parquet/stored_column_reader.h"
 
 namespace starrocks {
@@ -59,6 +60,7 @@ public:
         opts.stats = _opts.stats;
 
         RETURN_IF_ERROR(ColumnConverterFactory::create_converter(*field, col_type, _opts.timezone, &converter));
+        _col_type = col_type;
 
         return StoredColumnReader::create(file, field, chunk_metadata, opts, chunk_size, &_reader);
     }
@@ -87,6 +89,15 @@ public:
         _reader->get_levels(def_levels, rep_levels, num_levels);
     }
 
+    Status skip_rows(size_t num_rows) override {
+        if (_skip_scratch == nullptr) {
+            // The values of a partially skipped page are read into the column of the stored type.
+            _skip_scratch = converter->need_convert ? converter->create_src_column()
+                                                    : vectorized::ColumnHelper::create_column(_col_type, true);
+        }
+        return _reader->skip_rows(num_rows, _skip_scratch.get());
+    }
+
     Status get_dict_values(vectorized::Column* column) override { return _reader->get_dict_values(column); }
 
     Status get_dict_values(const std::vector<int32_t>& dict_codes, vectorized::Column* column) override {
@@ -99,8 +110,10 @@ public:
 
 private:
     ColumnReaderOptions _opts;
+    TypeDescriptor _col_type;
 
     std::unique_ptr<StoredColumnReader> _reader;
+    vectorized::ColumnPtr _skip_scratch;
 };
 
 class ListColumnReader : public ColumnReader {
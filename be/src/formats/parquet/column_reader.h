@@ -28,6 +28,9 @@ public:
 
     virtual void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) = 0;
 
+    // Skip the next num_rows rows, without reading the pages whose rows are all skipped.
+    virtual Status skip_rows(size_t num_rows) { return Status::NotSupported("skip_rows is not supported"); }
+
     virtual Status get_dict_values(vectorized::Column* column) {
         return Status::NotSupported("get_dict_values is not supported");
     }
@@ -8,6 +8,7 @@
 #include "column/column_helper.h"
 #include "common/status.h"
 #include "formats/parquet/encoding.h"
+#include "simd/gather.h"
 #include "util/coding.h"
 #include "util/rle_encoding.h"
 #include "util/slice.h"
@@ -97,29 +98,29 @@ public:
     }
 
     Status next_batch(size_t count, ColumnContentType content_type, vectorized::Column* dst) override {
-        _indexes.reserve(count);
+        if (_indexes.size() < count) {
+            raw::stl_vector_resize_uninitialized(&_indexes, count);
+        }
         _index_batch_decoder.GetBatch(&_indexes[0], count);
 
+        vectorized::FixedLengthColumn<T>* data_column = nullptr;
         if (dst->is_nullable()) {
             auto* nullable_column = reinterpret_cast<vectorized::NullableColumn*>(dst);
-            auto* data_column =
-                    reinterpret_cast<vectorized::FixedLengthColumn<T>*>(nullable_column->data_column().get());
-            size_t cur_size = data_column->size();
-            data_column->resize_uninitialized(cur_size + count);
-
-            for (int i = 0; i < count; i++) {
-                data_column->get_data()[cur_size + i] = _dict[_indexes[i]];
-            }
-
+            data_column = reinterpret_cast<vectorized::FixedLengthColumn<T>*>(nullable_column->data_column().get());
             nullable_column->null_column()->append_default(count);
         } else {
             // current can't reach here
-            auto* data_column = reinterpret_cast<vectorized::FixedLengthColumn<T>*>(dst);
-            size_t cur_size = data_column->size();
-            data_column->resize_uninitialized(cur_size + count);
+            data_column = reinterpret_cast<vectorized::FixedLengthColumn<T>*>(dst);
+        }
+        size_t cur_size = data_column->size();
+        data_column->resize_uninitialized(cur_size + count);
+        T* data = data_column->get_data().data() + cur_size;
 
+        if constexpr (sizeof(T) == 4 || sizeof(T) == 8) {
+            vectorized::SIMDGather::gather(data, _dict.data(), _indexes.data(), count);
+        } else {
             for (int i = 0; i < count; i++) {
-                data_column->get_data()[cur_size + i] = _dict[_indexes[i]];
+                data[i] = _dict[_indexes[i]];
             }
         }
 
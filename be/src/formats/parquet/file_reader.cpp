@@ -3,10 +3,13 @@
 #include "formats/parquet/file_reader.h"
 
 #include "column/column_helper.h"
+#include "common/config.h"
 #include "env/env.h"
 #include "exec/exec_node.h"
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
+#include "exprs/vectorized/runtime_filter_bank.h"
+#include "formats/file_meta_cache.h"
 #include "formats/parquet/encoding_plain.h"
 #include "formats/parquet/metadata.h"
 #include "gen_cpp/parquet_types.h"
@@ -21,8 +24,8 @@ namespace starrocks::parquet {
 
 static constexpr uint32_t kFooterSize = 8;
 
-FileReader::FileReader(int chunk_size, RandomAccessFile* file, uint64_t file_size)
-        : _chunk_size(chunk_size), _file(file), _file_size(file_size) {}
+FileReader::FileReader(int chunk_size, RandomAccessFile* file, uint64_t file_size, int64_t file_mtime)
+        : _chunk_size(chunk_size), _file(file), _file_size(file_size), _file_mtime(file_mtime) {}
 
 FileReader::~FileReader() = default;
 
@@ -59,6 +62,16 @@ Status FileReader::get_next(vectorized::ChunkPtr* chunk) {
 }
 
 Status FileReader::_parse_footer() {
+    FileMetaCache* cache = FileMetaCache::instance();
+    FileMetaCache::FileId file_id;
+    if (cache != nullptr) {
+        file_id = io::BlockCache::file_id(_file->filename(), _file_mtime, _file_size);
+        _file_metadata = cache->lookup<FileMetaData>(FileMetaCache::MetaType::PARQUET_FOOTER, file_id);
+        if (_file_metadata != nullptr) {
+            return Status::OK();
+        }
+    }
+
     // try with buffer on stack
     constexpr uint64_t footer_buf_size = 16 * 1024;
     uint8_t local_buf[footer_buf_size];
@@ -96,13 +109,19 @@ Status FileReader::_parse_footer() {
         }
     }
 
+    const size_t charge = footer_size;
     tparquet::FileMetaData t_metadata;
     // deserialize footer
     RETURN_IF_ERROR(deserialize_thrift_msg(footer_buf + to_read - 8 - footer_size, &footer_size, TProtocolType::COMPACT,
                                            &t_metadata));
-    _file_metadata.reset(new FileMetaData());
-    RETURN_IF_ERROR(_file_metadata->init(t_metadata));
+    auto file_metadata = std::make_shared<FileMetaData>();
+    RETURN_IF_ERROR(file_metadata->init(t_metadata));
+    _file_metadata = std::move(file_metadata);
 
+    if (cache != nullptr) {
+        // The charge is the size of the serialized footer, which underestimates the parsed metadata.
+        cache->insert(FileMetaCache::MetaType::PARQUET_FOOTER, file_id, _file_metadata, charge);
+    }
     return Status::OK();
 }
 
@@ -216,10 +235,194 @@ Status FileReader::_filter_group(const tparquet::RowGroup& row_group, bool* is_f
         }
     }
 
+    *is_filter = _filter_group_by_runtime_filters(row_group);
+    return Status::OK();
+}
+
+Status FileReader::_filter_pages(const tparquet::RowGroup& row_group, std::vector<RowRange>* row_ranges,
+                                 bool* is_filter) {
     *is_filter = false;
+    if (!config::parquet_page_index_enable || _param.min_max_conjunct_ctxs.empty() || _read_cols.empty()) {
+        return Status::OK();
+    }
+    // Only the column readers of the columns which are not repeated can skip rows.
+    for (const auto& column : _read_cols) {
+        if (_file_metadata->schema().get_stored_column_by_idx(column.col_idx_in_parquet)->max_rep_level() > 0) {
+            return Status::OK();
+        }
+    }
+
+    std::vector<RowRange> skipped_ranges;
+    for (auto* ctx : _param.min_max_conjunct_ctxs) {
+        RETURN_IF_ERROR(_filter_pages_by_conjunct(row_group, ctx, &skipped_ranges));
+    }
+    if (skipped_ranges.empty()) {
+        return Status::OK();
+    }
+
+    // The rows are read unless they are skipped by any conjunct.
+    std::sort(skipped_ranges.begin(), skipped_ranges.end(),
+              [](const RowRange& lhs, const RowRange& rhs) { return lhs.start < rhs.start; });
+    uint64_t next_row = 0;
+    for (const auto& range : skipped_ranges) {
+        if (range.start > next_row) {
+            row_ranges->push_back({next_row, range.start});
+        }
+        next_row = std::max(next_row, range.end);
+    }
+    const auto num_rows = static_cast<uint64_t>(row_group.num_rows);
+    if (next_row < num_rows) {
+        row_ranges->push_back({next_row, num_rows});
+    }
+    *is_filter = row_ranges->empty();
     return Status::OK();
 }
 
+Status FileReader::_filter_pages_by_conjunct(const tparquet::RowGroup& row_group, ExprContext* ctx,
+                                             std::vector<RowRange>* skipped_ranges) {
+    std::vector<SlotId> slot_ids;
+    ctx->root()->get_slot_ids(&slot_ids);
+    if (slot_ids.size() != 1) {
+        return Status::OK();
+    }
+    SlotDescriptor* slot = nullptr;
+    for (auto* min_max_slot : _param.min_max_tuple_desc->slots()) {
+        if (min_max_slot->id() == slot_ids[0]) {
+            slot = min_max_slot;
+        }
+    }
+    if (slot == nullptr) {
+        return Status::OK();
+    }
+    const ParquetField* field = _file_metadata->schema().resolve_by_name(slot->col_name());
+    if (field == nullptr || !field->children.empty()) {
+        return Status::OK();
+    }
+    const auto& column_chunk = row_group.columns[field->physical_column_index];
+    if (!column_chunk.__isset.column_index_offset || !column_chunk.__isset.offset_index_offset) {
+        return Status::OK();
+    }
+
+    tparquet::ColumnIndex column_index;
+    tparquet::OffsetIndex offset_index;
+    RETURN_IF_ERROR(_read_page_index(column_chunk, &column_index, &offset_index));
+    const auto& page_locations = offset_index.page_locations;
+    const size_t num_pages = page_locations.size();
+    if (column_index.null_pages.size() != num_pages || column_index.min_values.size() != num_pages ||
+        column_index.max_values.size() != num_pages) {
+        return Status::OK();
+    }
+
+    const tparquet::ColumnOrder* column_order = nullptr;
+    if (_file_metadata->t_metadata().__isset.column_orders) {
+        const auto& column_orders = _file_metadata->t_metadata().column_orders;
+        int column_idx = field->physical_column_index;
+        column_order = column_idx < column_orders.size() ? &column_orders[column_idx] : nullptr;
+    }
+
+    // One row of the min/max chunks for each page. The pages of nulls are never skipped, since their min/max
+    // values are undefined.
+    auto min_chunk = vectorized::ChunkHelper::new_chunk(std::vector<SlotDescriptor*>{slot}, num_pages);
+    auto max_chunk = vectorized::ChunkHelper::new_chunk(std::vector<SlotDescriptor*>{slot}, num_pages);
+    for (size_t i = 0; i < num_pages; i++) {
+        if (column_index.null_pages[i]) {
+            if (!min_chunk->columns()[0]->append_nulls(1) || !max_chunk->columns()[0]->append_nulls(1)) {
+                return Status::OK();
+            }
+            continue;
+        }
+        tparquet::ColumnMetaData page_meta;
+        page_meta.__set_type(column_chunk.meta_data.type);
+        page_meta.statistics.__set_min_value(column_index.min_values[i]);
+        page_meta.statistics.__set_max_value(column_index.max_values[i]);
+        page_meta.__isset.statistics = true;
+        if (!_decode_min_max_column(*field, _param.timezone, slot->type(), page_meta, column_order,
+                                    &min_chunk->columns()[0], &max_chunk->columns()[0])
+                     .ok()) {
+            return Status::OK();
+        }
+    }
+
+    ASSIGN_OR_RETURN(auto min_column, ctx->evaluate(min_chunk.get()));
+    ASSIGN_OR_RETURN(auto max_column, ctx->evaluate(max_chunk.get()));
+    for (size_t i = 0; i < num_pages; i++) {
+        if (column_index.null_pages[i] || min_column->is_null(i) || max_column->is_null(i)) {
+            continue;
+        }
+        if (min_column->get(i).get_int8() == 0 && max_column->get(i).get_int8() == 0) {
+            uint64_t end = i + 1 < num_pages ? page_locations[i + 1].first_row_index : row_group.num_rows;
+            skipped_ranges->push_back({static_cast<uint64_t>(page_locations[i].first_row_index), end});
+        }
+    }
+    return Status::OK();
+}
+
+Status FileReader::_read_page_index(const tparquet::ColumnChunk& column_chunk, tparquet::ColumnIndex* column_index,
+                                   tparquet::OffsetIndex* offset_index) {
+    std::vector<uint8_t> buf(std::max(column_chunk.column_index_length, column_chunk.offset_index_length));
+
+    uint32_t length = column_chunk.column_index_length;
+    RETURN_IF_ERROR(_file->read_at_fully(column_chunk.column_index_offset, buf.data(), length));
+    RETURN_IF_ERROR(deserialize_thrift_msg(buf.data(), &length, TProtocolType::COMPACT, column_index));
+
+    length = column_chunk.offset_index_length;
+    RETURN_IF_ERROR(_file->read_at_fully(column_chunk.offset_index_offset, buf.data(), length));
+    return deserialize_thrift_msg(buf.data(), &length, TProtocolType::COMPACT, offset_index);
+}
+
+bool FileReader::_filter_group_by_runtime_filters(const tparquet::RowGroup& row_group) const {
+    if (_param.runtime_filter_collector == nullptr) {
+        return false;
+    }
+    for (const auto& it : _param.runtime_filter_collector->descriptors()) {
+        const vectorized::RuntimeFilterProbeDescriptor* desc = it.second;
+        const vectorized::JoinRuntimeFilter* filter = desc->runtime_filter();
+        SlotId slot_id;
+        if (filter == nullptr || filter->has_null() || !desc->is_probe_slot_ref(&slot_id)) {
+            continue;
+        }
+
+        for (const auto& column : _param.materialized_columns) {
+            if (column.slot_id != slot_id) {
+                continue;
+            }
+            const auto* column_meta = _get_column_meta(row_group, column.col_name);
+            if (column_meta == nullptr || !column_meta->__isset.statistics) {
+                break;
+            }
+            const ParquetField* field = _file_metadata->schema().resolve_by_name(column.col_name);
+            const tparquet::ColumnOrder* column_order = nullptr;
+            if (_file_metadata->t_metadata().__isset.column_orders) {
+                const auto& column_orders = _file_metadata->t_metadata().column_orders;
+                int column_idx = field->physical_column_index;
+                column_order = column_idx < column_orders.size() ? &column_orders[column_idx] : nullptr;
+            }
+
+            auto min_column = vectorized::ColumnHelper::create_column(column.col_type, true);
+            auto max_column = vectorized::ColumnHelper::create_column(column.col_type, true);
+            Status status = _decode_min_max_column(*field, _param.timezone, column.col_type, *column_meta,
+                                                   column_order, &min_column, &max_column);
+            if (status.ok() && vectorized::RuntimeFilterHelper::filter_zonemap_with_min_max(
+                                       column.col_type.type, filter, min_column.get(), max_column.get())) {
+                return true;
+            }
+            break;
+        }
+    }
+    return false;
+}
+
+void FileReader::_skip_groups_by_runtime_filters() {
+    const auto& row_groups = _file_metadata->t_metadata().row_groups;
+    while (_cur_row_group_idx < _row_group_size &&
+           _filter_group_by_runtime_filters(row_groups[_row_group_numbers[_cur_row_group_idx]])) {
+        VLOG_FILE << "row group " << _row_group_numbers[_cur_row_group_idx]
+                  << " of file has been filtered by runtime filter";
+        _row_group_readers[_cur_row_group_idx].reset();
+        _cur_row_group_idx++;
+    }
+}
+
 Status FileReader::_read_min_max_chunk(const tparquet::RowGroup& row_group, vectorized::ChunkPtr* min_chunk,
                                        vectorized::ChunkPtr* max_chunk, bool* exist) const {
     for (size_t i = 0; i < _param.min_max_tuple_desc->slots().size(); i++) {
@@ -415,8 +618,17 @@ Status FileReader::_create_and_init_group_reader(int row_group_number) {
     param.timezone = _param.timezone;
     param.stats = _param.stats;
 
+    bool is_filter = false;
+    RETURN_IF_ERROR(_filter_pages(_file_metadata->t_metadata().row_groups[row_group_number], &param.row_ranges,
+                                  &is_filter));
+    if (is_filter) {
+        LOG(INFO) << "row group " << row_group_number << " of file has been filtered by page index";
+        return Status::OK();
+    }
+
     RETURN_IF_ERROR(row_group_reader->init(param));
     _row_group_readers.emplace_back(row_group_reader);
+    _row_group_numbers.emplace_back(row_group_number);
     return Status::OK();
 }
 
@@ -476,7 +688,11 @@ Status FileReader::_get_next_internal(vectorized::ChunkPtr* chunk) {
                 _scan_row_count += (*chunk)->num_rows();
             }
             if (status.is_end_of_file()) {
+                // Release the prefetched column chunks of the finished row group.
+                _row_group_readers[_cur_row_group_idx].reset();
                 _cur_row_group_idx++;
+                // the runtime filters may arrive after the row groups are selected.
+                _skip_groups_by_runtime_filters();
                 return Status::OK();
             }
         }
@@ -28,7 +28,9 @@ class FileMetaData;
 
 class FileReader {
 public:
-    FileReader(int chunk_size, RandomAccessFile* file, uint64_t file_size);
+    // |file_mtime| is the modification time of the file, which identifies the version of the file in
+    // FileMetaCache together with the name and the size.
+    FileReader(int chunk_size, RandomAccessFile* file, uint64_t file_size, int64_t file_mtime = 0);
     ~FileReader();
 
     Status init(const starrocks::vectorized::HdfsFileReaderParam& param);
@@ -65,6 +67,24 @@ private:
     // filter row group by min/max conjuncts
     Status _filter_group(const tparquet::RowGroup& group, bool* is_filter);
 
+    // Compute the rows of the row group to read by the page indexes of the columns of the min/max conjuncts.
+    // row_ranges is empty if all the rows are read, and is_filter is set if no row is read.
+    Status _filter_pages(const tparquet::RowGroup& row_group, std::vector<RowRange>* row_ranges, bool* is_filter);
+
+    // Append the ranges of the rows of the pages which can't satisfy the min/max conjunct to skipped_ranges.
+    Status _filter_pages_by_conjunct(const tparquet::RowGroup& row_group, ExprContext* ctx,
+                                     std::vector<RowRange>* skipped_ranges);
+
+    // read the column index and the offset index of a column chunk
+    Status _read_page_index(const tparquet::ColumnChunk& column_chunk, tparquet::ColumnIndex* column_index,
+                            tparquet::OffsetIndex* offset_index);
+
+    // filter row group by the min/max of the runtime filters arrived
+    bool _filter_group_by_runtime_filters(const tparquet::RowGroup& row_group) const;
+
+    // skip the row groups to read which are filtered by the runtime filters arrived after init
+    void _skip_groups_by_runtime_filters();
+
     // get row group to read
     // if scan range conatain the first byte in the row group, will be read
     // TODO: later modify the larger block should be read
@@ -115,10 +135,13 @@ private:
 
     RandomAccessFile* _file;
     uint64_t _file_size;
+    int64_t _file_mtime;
 
     starrocks::vectorized::HdfsFileReaderParam _param;
-    std::shared_ptr<FileMetaData> _file_metadata;
+    std::shared_ptr<const FileMetaData> _file_metadata;
     vector<std::shared_ptr<GroupReader>> _row_group_readers;
+    // row group number in file of _row_group_readers
+    std::vector<int> _row_group_numbers;
     size_t _cur_row_group_idx = 0;
     size_t _row_group_size = 0;
     vectorized::Schema _schema;
@@ -4,8 +4,12 @@
 #include "formats/parquet/group_reader.h"
 
 #include "column/column_helper.h"
+#include "common/config.h"
+#include "env/env.h"
 #include "exec/exec_node.h"
 #include "exprs/expr.h"
+#include "io/shared_buffered_input_stream.h"
+#include "runtime/exec_env.h"
 #include "runtime/types.h"
 #include "simd/simd.h"
 #include "storage/chunk_helper.h"
@@ -15,15 +19,19 @@ namespace starrocks::parquet {
 constexpr static const PrimitiveType kDictCodePrimitiveType = TYPE_INT;
 constexpr static const FieldType kDictCodeFieldType = OLAP_FIELD_TYPE_INT;
 
-GroupReader::GroupReader(int chunk_size, RandomAccessFile* file, FileMetaData* file_metadata, int row_group_number)
+GroupReader::GroupReader(int chunk_size, RandomAccessFile* file, const FileMetaData* file_metadata,
+                         int row_group_number)
         : _chunk_size(chunk_size), _file(file), _file_metadata(file_metadata), _row_group_number(row_group_number) {
     _row_group_metadata =
             std::make_shared<tparquet::RowGroup>(_file_metadata->t_metadata().row_groups[row_group_number]);
 }
 
+GroupReader::~GroupReader() = default;
+
 Status GroupReader::init(const GroupReaderParam& param) {
     _param = param;
     // the calling order matters, do not change unless you know why.
+    RETURN_IF_ERROR(_prefetch_column_chunks());
     RETURN_IF_ERROR(_init_column_readers());
     _pre_process_columns_and_conjunct_ctxs();
     RETURN_IF_ERROR(_rewrite_dict_column_predicates());
@@ -46,26 +54,30 @@ Status GroupReader::get_next(vectorized::ChunkPtr* chunk, size_t* row_count) {
     {
         SCOPED_RAW_TIMER(&_param.stats->group_chunk_read_ns);
         // read data into _read_chunk
-        status = _read(&count);
+        status = _read_row_ranges(&count);
         _param.stats->raw_rows_read += count;
         if (!status.ok() && !status.is_end_of_file()) {
             return status;
         }
     }
 
-    // dict filter
-    if (has_dict_filter) {
-        SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
-        SCOPED_RAW_TIMER(&_param.stats->group_dict_filter_ns);
-        _dict_filter();
-        _read_chunk->check_or_die();
-    }
+    if (!_lazy_read_columns.empty()) {
+        RETURN_IF_ERROR(_filter_and_read_lazy_columns(count));
+    } else {
+        // dict filter
+        if (has_dict_filter) {
+            SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
+            SCOPED_RAW_TIMER(&_param.stats->group_dict_filter_ns);
+            _dict_filter();
+            _read_chunk->check_or_die();
+        }
 
-    // other filter that not dict
-    if (has_more_filter) {
-        SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
-        RETURN_IF_ERROR(ExecNode::eval_conjuncts(_left_conjunct_ctxs, _read_chunk.get()));
-        _read_chunk->check_or_die();
+        // other filter that not dict
+        if (has_more_filter) {
+            SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
+            RETURN_IF_ERROR(ExecNode::eval_conjuncts(_left_conjunct_ctxs, _read_chunk.get()));
+            _read_chunk->check_or_die();
+        }
     }
 
     *row_count = _read_chunk->num_rows();
@@ -77,6 +89,46 @@ Status GroupReader::get_next(vectorized::ChunkPtr* chunk, size_t* row_count) {
     return status;
 }
 
+static void collect_column_chunk_ranges(const ParquetField& field, const tparquet::RowGroup& row_group,
+                                        std::vector<io::SharedBufferedInputStream::IORange>* ranges) {
+    if (!field.children.empty()) {
+        for (const auto& child : field.children) {
+            collect_column_chunk_ranges(child, row_group, ranges);
+        }
+        return;
+    }
+    const auto& metadata = row_group.columns[field.physical_column_index].meta_data;
+    int64_t offset = metadata.data_page_offset;
+    if (metadata.__isset.dictionary_page_offset) {
+        offset = metadata.dictionary_page_offset;
+    }
+    ranges->push_back({offset, metadata.total_compressed_size});
+}
+
+Status GroupReader::_prefetch_column_chunks() {
+    if (config::parquet_coalesce_read_max_size <= 0) {
+        return Status::OK();
+    }
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    for (const auto& column : _param.read_cols) {
+        const auto* field = _file_metadata->schema().get_stored_column_by_idx(column.col_idx_in_parquet);
+        collect_column_chunk_ranges(*field, *_row_group_metadata, &ranges);
+    }
+
+    auto stream = std::make_shared<io::SharedBufferedInputStream>(
+            _file->stream(), config::parquet_coalesce_read_max_gap, config::parquet_coalesce_read_max_size);
+    stream->set_io_ranges(ranges);
+    if (stream->coalesced_ranges().empty()) {
+        return Status::OK();
+    }
+    {
+        SCOPED_RAW_TIMER(&_param.stats->io_ns);
+        RETURN_IF_ERROR(stream->prefetch(ExecEnv::GetInstance()->parquet_read_thread_pool()));
+    }
+    _prefetched_file = std::make_unique<RandomAccessFile>(std::move(stream), _file->filename());
+    return Status::OK();
+}
+
 Status GroupReader::_init_column_readers() {
     for (const auto& column : _param.read_cols) {
         RETURN_IF_ERROR(_create_column_reader(column));
@@ -93,7 +145,8 @@ Status GroupReader::_create_column_reader(const GroupReaderParam::Column& column
     opts.timezone = _param.timezone;
     {
         SCOPED_RAW_TIMER(&_param.stats->column_reader_init_ns);
-        RETURN_IF_ERROR(ColumnReader::create(_file, schema_node, *_row_group_metadata, column.col_type_in_chunk, opts,
+        RandomAccessFile* file = _prefetched_file != nullptr ? _prefetched_file.get() : _file;
+        RETURN_IF_ERROR(ColumnReader::create(file, schema_node, *_row_group_metadata, column.col_type_in_chunk, opts,
                                              _chunk_size, &column_reader));
     }
     _column_readers[column.slot_id] = std::move(column_reader);
@@ -111,15 +164,29 @@ void GroupReader::_pre_process_columns_and_conjunct_ctxs() {
         if (_can_using_dict_filter(slots[chunk_index], conjunct_ctxs_by_slot, column_metadata)) {
             _dict_filter_columns.emplace_back(column);
             _dict_filter_conjunct_ctxs[slot_id] = conjunct_ctxs_by_slot.at(slot_id);
-        } else {
+        } else if (conjunct_ctxs_by_slot.find(slot_id) != conjunct_ctxs_by_slot.end()) {
             _direct_read_columns.emplace_back(column);
-            if (conjunct_ctxs_by_slot.find(slot_id) != conjunct_ctxs_by_slot.end()) {
-                for (ExprContext* ctx : conjunct_ctxs_by_slot.at(slot_id)) {
-                    _left_conjunct_ctxs.emplace_back(ctx);
-                }
+            for (ExprContext* ctx : conjunct_ctxs_by_slot.at(slot_id)) {
+                _left_conjunct_ctxs.emplace_back(ctx);
             }
+        } else if (config::parquet_late_materialization_enable && _can_lazy_read(column)) {
+            _lazy_read_columns.emplace_back(column);
+        } else {
+            _direct_read_columns.emplace_back(column);
         }
     }
+
+    // Nothing filters the rows before the lazy columns are read.
+    if (_dict_filter_columns.empty() && _left_conjunct_ctxs.empty()) {
+        _direct_read_columns.insert(_direct_read_columns.end(), _lazy_read_columns.begin(), _lazy_read_columns.end());
+        _lazy_read_columns.clear();
+    }
+}
+
+bool GroupReader::_can_lazy_read(const GroupReaderParam::Column& column) {
+    // Only the columns of the scalar column readers can skip rows.
+    const auto* field = _file_metadata->schema().get_stored_column_by_idx(column.col_idx_in_parquet);
+    return field->children.empty() && field->max_rep_level() == 0;
 }
 
 bool GroupReader::_can_using_dict_filter(const SlotDescriptor* slot, const SlotIdExprContextsMap& conjunct_ctxs_by_slot,
@@ -274,6 +341,56 @@ void GroupReader::_init_read_chunk() {
         dict_code_column->reserve(chunk_size);
         _read_chunk->update_column(dict_code_column, slot_id);
     }
+
+    if (!_lazy_read_columns.empty()) {
+        _active_chunk = std::make_shared<vectorized::Chunk>();
+        for (const auto& column : _dict_filter_columns) {
+            _active_chunk->append_column(_read_chunk->get_column_by_slot_id(column.slot_id), column.slot_id);
+        }
+        for (const auto& column : _direct_read_columns) {
+            _active_chunk->append_column(_read_chunk->get_column_by_slot_id(column.slot_id), column.slot_id);
+        }
+    }
+}
+
+Status GroupReader::_read_row_ranges(size_t* row_count) {
+    const auto& row_ranges = _param.row_ranges;
+    if (row_ranges.empty()) {
+        return _read(row_count);
+    }
+    while (_cur_row_range < row_ranges.size() && _next_row >= row_ranges[_cur_row_range].end) {
+        _cur_row_range++;
+    }
+    if (_cur_row_range == row_ranges.size()) {
+        *row_count = 0;
+        return Status::EndOfFile("");
+    }
+
+    const RowRange& range = row_ranges[_cur_row_range];
+    if (_next_row < range.start) {
+        RETURN_IF_ERROR(_skip_rows(range.start - _next_row));
+        _next_row = range.start;
+    }
+    size_t count = std::min<uint64_t>(*row_count, range.end - _next_row);
+    Status status = _read(&count);
+    if (!status.ok() && !status.is_end_of_file()) {
+        return status;
+    }
+    _next_row += count;
+    *row_count = count;
+    if (_next_row >= range.end && _cur_row_range + 1 == row_ranges.size()) {
+        return Status::EndOfFile("");
+    }
+    return status;
+}
+
+Status GroupReader::_skip_rows(size_t num_rows) {
+    // All the columns skip the same rows, so the rows read next are still aligned.
+    for (auto& [slot_id, column_reader] : _column_readers) {
+        RETURN_IF_ERROR(column_reader->skip_rows(num_rows));
+    }
+    _param.stats->page_skip_rows += num_rows;
+    return Status::OK();
 }
 
 Status GroupReader::_read(size_t* row_count) {
@@ -308,6 +425,97 @@ Status GroupReader::_read(size_t* row_count) {
     return Status::OK();
 }
 
+Status GroupReader::_filter_and_read_lazy_columns(size_t row_count) {
+    if (row_count == 0) {
+        return Status::OK();
+    }
+
+    vectorized::Filter filter(row_count, 1);
+    size_t hit_count = row_count;
+    {
+        SCOPED_RAW_TIMER(&_param.stats->expr_filter_ns);
+        if (!_dict_filter_preds.empty()) {
+            SCOPED_RAW_TIMER(&_param.stats->group_dict_filter_ns);
+            for (const auto& [slot_id, pred] : _dict_filter_preds) {
+                pred->evaluate_and(_active_chunk->get_column_by_slot_id(slot_id).get(), filter.data());
+            }
+            hit_count = SIMD::count_nonzero(filter);
+        }
+        if (hit_count > 0 && !_left_conjunct_ctxs.empty()) {
+            ASSIGN_OR_RETURN(hit_count,
+                             ExecNode::eval_conjuncts_into_filter(_left_conjunct_ctxs, _active_chunk.get(), &filter));
+        }
+    }
+
+    {
+        SCOPED_RAW_TIMER(&_param.stats->group_chunk_read_ns);
+        for (const auto& column : _lazy_read_columns) {
+            SlotId slot_id = column.slot_id;
+            RETURN_IF_ERROR(_read_lazy_column(_column_readers[slot_id].get(), filter, hit_count,
+                                              _read_chunk->get_column_by_slot_id(slot_id).get()));
+        }
+    }
+    _param.stats->late_materialize_skip_rows += row_count - hit_count;
+
+    if (hit_count == 0) {
+        _active_chunk->set_num_rows(0);
+    } else if (hit_count != row_count) {
+        _active_chunk->filter(filter);
+    }
+    _read_chunk->check_or_die();
+    return Status::OK();
+}
+
+Status GroupReader::_read_lazy_column(ColumnReader* column_reader, const vectorized::Filter& filter,
+                                      size_t hit_count, vectorized::Column* column) {
+    // Every run of the selected or the filtered rows costs a call into the decoders, so a fragmented filter is
+    // cheaper to apply after all the rows are read.
+    static constexpr size_t kMinAverageRunLength = 16;
+
+    const size_t row_count = filter.size();
+    Status status;
+    if (hit_count == 0) {
+        status = column_reader->skip_rows(row_count);
+        return status.is_end_of_file() ? Status::OK() : status;
+    }
+
+    size_t num_runs = 1;
+    for (size_t i = 1; i < row_count; i++) {
+        num_runs += (filter[i] != 0) != (filter[i - 1] != 0);
+    }
+    if (hit_count == row_count || num_runs * kMinAverageRunLength > row_count) {
+        size_t count = row_count;
+        status = column_reader->next_batch(&count, ColumnContentType::VALUE, column);
+        if (!status.ok() && !status.is_end_of_file()) {
+            return status;
+        }
+        if (hit_count != row_count) {
+            column->filter(filter);
+        }
+        return Status::OK();
+    }
+
+    size_t start = 0;
+    while (start < row_count) {
+        const bool selected = filter[start] != 0;
+        size_t end = start + 1;
+        while (end < row_count && (filter[end] != 0) == selected) {
+            end++;
+        }
+        size_t count = end - start;
+        if (selected) {
+            status = column_reader->next_batch(&count, ColumnContentType::VALUE, column);
+        } else {
+            status = column_reader->skip_rows(count);
+        }
+        if (!status.ok() && !status.is_end_of_file()) {
+            return status;
+        }
+        start = end;
+    }
+    return Status::OK();
+}
+
 void GroupReader::_dict_filter() {
     DCHECK(!_dict_filter_preds.empty());
 
@@ -23,6 +23,12 @@ struct HdfsScanStats;
 
 namespace starrocks::parquet {
 
+// The rows [start, end) of a row group.
+struct RowRange {
+    uint64_t start;
+    uint64_t end;
+};
+
 struct GroupReaderParam {
     struct Column {
         // column index in parquet file
@@ -49,13 +55,17 @@ struct GroupReaderParam {
 
     std::string timezone;
 
+    // The rows to read, which are ordered and not empty, or empty to read all the rows. The other rows are
+    // filtered by the page indexes.
+    std::vector<RowRange> row_ranges;
+
     vectorized::HdfsScanStats* stats = nullptr;
 };
 
 class GroupReader {
 public:
-    GroupReader(int chunk_size, RandomAccessFile* file, FileMetaData* file_metadata, int row_group_number);
-    ~GroupReader() = default;
+    GroupReader(int chunk_size, RandomAccessFile* file, const FileMetaData* file_metadata, int row_group_number);
+    ~GroupReader();
 
     Status init(const GroupReaderParam& _param);
     Status get_next(vectorized::ChunkPtr* chunk, size_t* row_count);
@@ -63,10 +73,14 @@ public:
 private:
     using SlotIdExprContextsMap = std::unordered_map<int, std::vector<ExprContext*>>;
 
+    // Read the column chunks of the row group with the coalesced and concurrent reads.
+    Status _prefetch_column_chunks();
     Status _init_column_readers();
     Status _create_column_reader(const GroupReaderParam::Column& column);
     // Extract dict filter columns and conjuncts
     void _pre_process_columns_and_conjunct_ctxs();
+    // Whether the column can be read after the conjuncts are evaluated, only for the rows selected by them.
+    bool _can_lazy_read(const GroupReaderParam::Column& column);
     bool _can_using_dict_filter(const SlotDescriptor* slot, const SlotIdExprContextsMap& slot_conjunct_ctxs,
                                 const tparquet::ColumnMetaData& column_metadata);
     // Returns true if all of the data pages in the column chunk are dict encoded
@@ -74,16 +88,25 @@ private:
     Status _rewrite_dict_column_predicates();
     void _init_read_chunk();
 
+    // Read the next rows of param.row_ranges, skipping the rows between the ranges.
+    Status _read_row_ranges(size_t* row_count);
+    Status _skip_rows(size_t num_rows);
     Status _read(size_t* row_count);
+    // Evaluate the conjuncts on the active columns, then read the lazy columns of the selected rows.
+    Status _filter_and_read_lazy_columns(size_t row_count);
+    Status _read_lazy_column(ColumnReader* column_reader, const vectorized::Filter& filter, size_t hit_count,
+                             vectorized::Column* column);
     void _dict_filter();
     Status _dict_decode(vectorized::ChunkPtr* chunk);
 
     int _chunk_size;
 
     RandomAccessFile* _file;
+    // The file serving the prefetched column chunks from memory, nullptr if nothing is prefetched.
+    std::unique_ptr<RandomAccessFile> _prefetched_file;
 
     // parquet file meta
-    FileMetaData* _file_metadata;
+    const FileMetaData* _file_metadata;
 
     // row group number in parquet file
     int _row_group_number;
@@ -104,11 +127,20 @@ private:
     std::vector<GroupReaderParam::Column> _dict_filter_columns;
     // direct read conlumns
     std::vector<GroupReaderParam::Column> _direct_read_columns;
+    // The columns without conjuncts, which are read after the conjuncts are evaluated on the other columns.
+    // Empty if late materialization isn't used.
+    std::vector<GroupReaderParam::Column> _lazy_read_columns;
 
     // dict value is empty after conjunct eval, file group can be skipped
     bool _is_group_filtered = false;
 
+    // The index of the range in _param.row_ranges to read, and the next row to read of the row group.
+    size_t _cur_row_range = 0;
+    uint64_t _next_row = 0;
+
     vectorized::ChunkPtr _read_chunk;
+    // The columns of _read_chunk which aren't lazy read, valid only if _lazy_read_columns isn't empty.
+    vectorized::ChunkPtr _active_chunk;
     vectorized::Buffer<uint8_t> _selection;
 
     // param for read row group
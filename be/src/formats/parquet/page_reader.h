@@ -34,6 +34,9 @@ public:
     // after one next_header can not exceede the page's compressed_page_size.
     Status read_bytes(const uint8_t** buffer, size_t size);
 
+    // Skip the data of the current page without reading it. Must call this function after next_header called.
+    void skip_page_data() { seek_to_offset(_next_header_pos); }
+
     // seek to read position, this position must be a start of a page header.
     void seek_to_offset(uint64_t offset) {
         _stream.seek_to(offset);
@@ -97,6 +97,8 @@ public:
 
     void set_needs_levels(bool needs_levels) override { _needs_levels = needs_levels; }
 
+    Status skip_rows(size_t num_rows, vectorized::Column* scratch) override;
+
     void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) override {
         // _needs_levels must be true
         DCHECK(_needs_levels);
@@ -154,6 +156,8 @@ public:
 
     Status read_records(size_t* num_rows, ColumnContentType content_type, vectorized::Column* dst) override;
 
+    Status skip_rows(size_t num_rows, vectorized::Column* scratch) override;
+
     void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) override {
         *def_levels = nullptr;
         *rep_levels = nullptr;
@@ -383,8 +387,13 @@ Status OptionalStoredColumnReader::_read_records_only(size_t* num_records, Colum
         }
 
         size_t records_to_read = std::min(*num_records - records_read, _num_values_left_in_cur_page);
-        size_t repeated_count = _reader->def_level_decoder().next_repeated_count();
-        if (repeated_count > 0) {
+        // All the values of a page without nulls are defined, its levels are never decoded.
+        const bool no_nulls = _reader->current_page_has_no_nulls();
+        size_t repeated_count = no_nulls ? 0 : _reader->def_level_decoder().next_repeated_count();
+        if (no_nulls) {
+            SCOPED_RAW_TIMER(&_opts.stats->value_decode_ns);
+            RETURN_IF_ERROR(_reader->decode_values(records_to_read, content_type, dst));
+        } else if (repeated_count > 0) {
             records_to_read = std::min(records_to_read, repeated_count);
             level_t def_level = 0;
             {
@@ -497,6 +506,57 @@ Status RequiredStoredColumnReader::_next_page() {
     return Status::OK();
 }
 
+Status RequiredStoredColumnReader::skip_rows(size_t num_rows, vectorized::Column* scratch) {
+    while (num_rows > 0) {
+        if (_num_values_left_in_cur_page == 0) {
+            RETURN_IF_ERROR(_skip_pages(&num_rows, &_num_values_left_in_cur_page));
+            if (num_rows == 0) {
+                break;
+            }
+        }
+        size_t rows_to_skip = std::min(num_rows, _num_values_left_in_cur_page);
+        RETURN_IF_ERROR(read_records(&rows_to_skip, ColumnContentType::VALUE, scratch));
+        scratch->reset_column();
+        num_rows -= rows_to_skip;
+    }
+    return Status::OK();
+}
+
+Status OptionalStoredColumnReader::skip_rows(size_t num_rows, vectorized::Column* scratch) {
+    if (_eof) {
+        return Status::EndOfFile("");
+    }
+    while (num_rows > 0) {
+        if (_num_values_left_in_cur_page == 0) {
+            RETURN_IF_ERROR(_skip_pages(&num_rows, &_num_values_left_in_cur_page));
+            if (num_rows == 0) {
+                break;
+            }
+        }
+        size_t rows_to_skip = std::min(num_rows, _num_values_left_in_cur_page);
+        RETURN_IF_ERROR(read_records(&rows_to_skip, ColumnContentType::VALUE, scratch));
+        scratch->reset_column();
+        num_rows -= rows_to_skip;
+    }
+    return Status::OK();
+}
+
+Status StoredColumnReader::_skip_pages(size_t* num_rows, size_t* num_values_left_in_cur_page) {
+    DCHECK_EQ(0, *num_values_left_in_cur_page);
+    while (*num_values_left_in_cur_page == 0 && *num_rows > 0) {
+        RETURN_IF_ERROR(_reader->next_page_header());
+        size_t num_values = _reader->page_header_num_values();
+        if (num_values > 0 && num_values <= *num_rows) {
+            RETURN_IF_ERROR(_reader->skip_page());
+            *num_rows -= num_values;
+            continue;
+        }
+        RETURN_IF_ERROR(_reader->parse_page_data());
+        *num_values_left_in_cur_page = _reader->num_values();
+    }
+    return Status::OK();
+}
+
 Status StoredColumnReader::create(RandomAccessFile* file, const ParquetField* field,
                                   const tparquet::ColumnChunk* chunk_metadata, const StoredColumnReaderOptions& opts,
                                   int chunk_size, std::unique_ptr<StoredColumnReader>* out) {
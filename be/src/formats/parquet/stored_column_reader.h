@@ -50,6 +50,13 @@ public:
     // this function will fill (1, 2, 3, 4, 5, 6) into 'dst'.
     virtual Status read_records(size_t* num_rows, ColumnContentType content_type, vectorized::Column* dst) = 0;
 
+    // Skip the next num_rows rows. The pages whose rows are all skipped are not read or decompressed, and the
+    // rows of the partially skipped page are read into |scratch| and dropped. |scratch| must be a column which
+    // read_records can read values into.
+    virtual Status skip_rows(size_t num_rows, vectorized::Column* scratch) {
+        return Status::NotSupported("skip_rows is not supported");
+    }
+
     // This function can only be called after calling read_values. This function returns the
     // levels for last read_values.
     virtual void get_levels(level_t** def_levels, level_t** rep_levels, size_t* num_levels) = 0;
@@ -65,6 +72,11 @@ public:
     }
 
 protected:
+    // Skip the pages whose rows are all in the next |*num_rows| rows once the current page is finished, and parse
+    // the data of the next page which is not skipped. |*num_rows| is decreased by the skipped rows. Only for the
+    // columns which are not repeated, whose number of the values in a page is the number of the rows.
+    Status _skip_pages(size_t* num_rows, size_t* num_values_left_in_cur_page);
+
     std::unique_ptr<ColumnChunkReader> _reader;
 };
 
@@ -298,7 +298,15 @@ GeoPolygon::GeoPolygon() = default;
 GeoPolygon::~GeoPolygon() = default;
 
 GeoParseStatus GeoPolygon::from_coords(const GeoCoordinateListList& list) {
-    return to_s2polygon(list, &_polygon);
+    GeoParseStatus status = to_s2polygon(list, &_polygon);
+    if (status == GEO_PARSE_OK) {
+        _init_cap_bound();
+    }
+    return status;
+}
+
+void GeoPolygon::_init_cap_bound() {
+    _cap_bound = std::make_unique<S2Cap>(_polygon->GetCapBound());
 }
 
 void GeoPolygon::encode(std::string* buf) {
@@ -310,7 +318,11 @@ void GeoPolygon::encode(std::string* buf) {
 bool GeoPolygon::decode(const void* data, size_t size) {
     Decoder decoder(data, size);
     _polygon = std::make_unique<S2Polygon>();
-    return _polygon->Decode(&decoder) && _polygon->IsValid();
+    if (!_polygon->Decode(&decoder) || !_polygon->IsValid()) {
+        return false;
+    }
+    _init_cap_bound();
+    return true;
 }
 
 std::string GeoLine::as_wkt() const {
@@ -354,6 +366,9 @@ bool GeoPolygon::contains(const GeoShape* rhs) const {
     switch (rhs->type()) {
     case GEO_SHAPE_POINT: {
         const GeoPoint* point = (const GeoPoint*)rhs;
+        if (_cap_bound != nullptr && !_cap_bound->Contains(*point->point())) {
+            return false;
+        }
         return _polygon->Contains(*point->point());
 #if 0
         if (_polygon->Contains(point->point())) {
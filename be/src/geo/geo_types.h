@@ -131,7 +131,11 @@ protected:
     bool decode(const void* data, size_t size) override;
 
 private:
+    void _init_cap_bound();
+
     std::unique_ptr<S2Polygon> _polygon;
+    // The bounding cap of |_polygon|, which rejects the points far away from the polygon with a dot product.
+    std::unique_ptr<S2Cap> _cap_bound;
 };
 
 class GeoCircle : public GeoShape {
@@ -0,0 +1,55 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present StarRocks Limited.
+
+#include "http/action/list_query_resource_action.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/rapidjson.h>
+#include <rapidjson/stringbuffer.h>
+
+#include <string>
+
+#include "common/logging.h"
+#include "exec/pipeline/query_context.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+const static std::string HEADER_JSON = "application/json";
+
+void ListQueryResourceAction::handle(HttpRequest* req) {
+    LOG(INFO) << req->debug_string();
+    auto query_contexts = _exec_env->query_context_mgr()->list_all();
+
+    rapidjson::Document root;
+    root.SetArray();
+    auto& allocator = root.GetAllocator();
+    for (const auto& query_ctx : query_contexts) {
+        rapidjson::Document item;
+        item.SetObject();
+        std::string query_id = print_id(query_ctx->query_id());
+        item.AddMember("query_id", rapidjson::Value(query_id.c_str(), query_id.size(), allocator), allocator);
+        std::string workgroup = query_ctx->workgroup_name();
+        item.AddMember("workgroup", rapidjson::Value(workgroup.c_str(), workgroup.size(), allocator), allocator);
+        item.AddMember("cpu_ns", rapidjson::Value(query_ctx->cpu_ns()), allocator);
+        item.AddMember("scan_rows", rapidjson::Value(query_ctx->scan_rows()), allocator);
+        item.AddMember("scan_bytes", rapidjson::Value(query_ctx->scan_bytes()), allocator);
+        item.AddMember("spill_bytes", rapidjson::Value(query_ctx->spill_bytes()), allocator);
+        item.AddMember("network_sent_bytes", rapidjson::Value(query_ctx->network_sent_bytes()), allocator);
+        item.AddMember("network_received_bytes", rapidjson::Value(query_ctx->network_received_bytes()), allocator);
+        item.AddMember("mem_bytes", rapidjson::Value(query_ctx->current_mem_bytes()), allocator);
+        item.AddMember("peak_mem_bytes", rapidjson::Value(query_ctx->peak_mem_bytes()), allocator);
+        root.PushBack(item, allocator);
+    }
+    rapidjson::StringBuffer strbuf;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
+    root.Accept(writer);
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
+    HttpChannel::send_reply(req, HttpStatus::OK, strbuf.GetString());
+}
+
+} // namespace starrocks
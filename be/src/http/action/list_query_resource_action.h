@@ -0,0 +1,22 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present StarRocks Limited.
+
+#pragma once
+
+#include "http/http_handler.h"
+#include "runtime/exec_env.h"
+
+namespace starrocks {
+
+// List the realtime resource usage of the running queries in this BE.
+class ListQueryResourceAction : public HttpHandler {
+public:
+    explicit ListQueryResourceAction(ExecEnv* exec_env) : _exec_env(exec_env) {}
+    ~ListQueryResourceAction() override = default;
+
+    void handle(HttpRequest* req) override;
+
+private:
+    ExecEnv* _exec_env;
+};
+
+} // namespace starrocks
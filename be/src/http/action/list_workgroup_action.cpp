@@ -51,6 +51,9 @@ void ListWorkGroupAction::handle(HttpRequest* req) {
         wg_item.AddMember("type", type, allocator);
         wg_item.AddMember("state", rapidjson::Value(wg.state.c_str(), wg.state.size()), allocator);
         wg_item.AddMember("cpu_core_limit", rapidjson::Value(wg.cpu_core_limit), allocator);
+        wg_item.AddMember("cpu_hard_limit", rapidjson::Value(wg.cpu_hard_limit), allocator);
+        wg_item.AddMember("cpu_throttled_time_ns", rapidjson::Value(wg.cpu_throttled_time_ns), allocator);
+        wg_item.AddMember("num_cpu_throttled_periods", rapidjson::Value(wg.num_cpu_throttled_periods), allocator);
         wg_item.AddMember("mem_limit", rapidjson::Value(wg.mem_limit), allocator);
         int64_t mem_bytes_limit = _exec_env->query_pool_mem_tracker()->limit() * wg.mem_limit;
         wg_item.AddMember("mem_bytes_limit", rapidjson::Value(mem_bytes_limit), allocator);
@@ -28,12 +28,14 @@
 
 #include <string>
 
+#include "common/config.h"
 #include "http/http_channel.h"
 #include "http/http_headers.h"
 #include "http/http_request.h"
 #include "http/http_response.h"
 #include "runtime/exec_env.h"
 #include "util/metrics.h"
+#include "util/time.h"
 
 namespace starrocks {
 
@@ -45,6 +47,8 @@ public:
 
 private:
     void _visit_simple_metric(const std::string& name, const MetricLabels& labels, Metric* metric);
+    void _visit_histogram_metric(const std::string& name, const MetricLabels& labels, HistogramMetric* metric);
+    void _write_labels(const MetricLabels& labels, const std::string& le);
 
 private:
     std::stringstream _ss;
@@ -97,29 +101,70 @@ void PrometheusMetricsVisitor::visit(const std::string& prefix, const std::strin
             _visit_simple_metric(metric_name, it.first, (Metric*)it.second);
         }
         break;
+    case MetricType::HISTOGRAM:
+        for (auto& it : collector->metrics()) {
+            _visit_histogram_metric(metric_name, it.first, (HistogramMetric*)it.second);
+        }
+        break;
     default:
         break;
     }
 }
 
+void PrometheusMetricsVisitor::_write_labels(const MetricLabels& labels, const std::string& le) {
+    if (labels.empty() && le.empty()) {
+        return;
+    }
+    _ss << "{";
+    int i = 0;
+    for (auto& label : labels.labels) {
+        if (i++ > 0) {
+            _ss << ",";
+        }
+        _ss << label.name << "=\"" << label.value << "\"";
+    }
+    if (!le.empty()) {
+        if (i > 0) {
+            _ss << ",";
+        }
+        _ss << "le=\"" << le << "\"";
+    }
+    _ss << "}";
+}
+
 void PrometheusMetricsVisitor::_visit_simple_metric(const std::string& name, const MetricLabels& labels,
                                                     Metric* metric) {
     _ss << name;
-    // labels
-    if (!labels.empty()) {
-        _ss << "{";
-        int i = 0;
-        for (auto& label : labels.labels) {
-            if (i++ > 0) {
-                _ss << ",";
-            }
-            _ss << label.name << "=\"" << label.value << "\"";
-        }
-        _ss << "}";
-    }
+    _write_labels(labels, "");
     _ss << " " << metric->to_string() << "\n";
 }
 
+// eg:
+// starrocks_be_storage_io_latency_us_bucket{disk="/data1",type="data_page",le="1"} 0
+// ...
+// starrocks_be_storage_io_latency_us_bucket{disk="/data1",type="data_page",le="+Inf"} 1024
+// starrocks_be_storage_io_latency_us_sum{disk="/data1",type="data_page"} 345678
+// starrocks_be_storage_io_latency_us_count{disk="/data1",type="data_page"} 1024
+void PrometheusMetricsVisitor::_visit_histogram_metric(const std::string& name, const MetricLabels& labels,
+                                                       HistogramMetric* metric) {
+    // The buckets are read once, so the cumulative counts are monotonic even if the values are being added.
+    int64_t cumulative_count = 0;
+    for (int i = 0; i < HistogramMetric::kNumBuckets; ++i) {
+        cumulative_count += metric->bucket_count(i);
+        _ss << name << "_bucket";
+        _write_labels(labels, i + 1 < HistogramMetric::kNumBuckets
+                                      ? std::to_string(HistogramMetric::bucket_upper_bound(i))
+                                      : "+Inf");
+        _ss << " " << cumulative_count << "\n";
+    }
+    _ss << name << "_sum";
+    _write_labels(labels, "");
+    _ss << " " << metric->sum() << "\n";
+    _ss << name << "_count";
+    _write_labels(labels, "");
+    _ss << " " << cumulative_count << "\n";
+}
+
 void SimpleCoreMetricsVisitor::visit(const std::string& prefix, const std::string& name, MetricCollector* collector) {
     if (collector->empty() || name.empty()) {
         return;
@@ -168,6 +213,7 @@ void JsonMetricsVisitor::visit(const std::string& prefix, const std::string& nam
     switch (collector->type()) {
     case MetricType::COUNTER:
     case MetricType::GAUGE:
+    case MetricType::HISTOGRAM:
         for (auto& it : collector->metrics()) {
             const MetricLabels& labels = it.first;
             Metric* metric = reinterpret_cast<Metric*>(it.second);
@@ -193,21 +239,45 @@ void JsonMetricsVisitor::visit(const std::string& prefix, const std::string& nam
     }
 }
 
-void MetricsAction::handle(HttpRequest* req) {
-    const std::string& type = req->param("type");
-    std::string str;
-    if (type == "core") {
+std::string MetricsAction::_render(Format format) {
+    switch (format) {
+    case CORE: {
         SimpleCoreMetricsVisitor visitor;
         _metrics->collect(&visitor);
-        str.assign(visitor.to_string());
-    } else if (type == "json") {
+        return visitor.to_string();
+    }
+    case JSON: {
         JsonMetricsVisitor visitor;
         _metrics->collect(&visitor);
-        str.assign(visitor.to_string());
-    } else {
+        return visitor.to_string();
+    }
+    default: {
         PrometheusMetricsVisitor visitor;
         _metrics->collect(&visitor);
-        str.assign(visitor.to_string());
+        return visitor.to_string();
+    }
+    }
+}
+
+void MetricsAction::handle(HttpRequest* req) {
+    const std::string& type = req->param("type");
+    Format format = PROMETHEUS;
+    if (type == "core") {
+        format = CORE;
+    } else if (type == "json") {
+        format = JSON;
+    }
+
+    std::string str;
+    {
+        std::lock_guard l(_lock);
+        CachedOutput& cached = _cached[format];
+        int64_t now = MonotonicMillis();
+        if (cached.render_time_ms < 0 || now - cached.render_time_ms >= config::metrics_cache_ttl_ms) {
+            cached.output = _render(format);
+            cached.render_time_ms = now;
+        }
+        str = cached.output;
     }
 
     req->add_output_header(HttpHeaders::CONTENT_TYPE, "text/plain; version=0.0.4");
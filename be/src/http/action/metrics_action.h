@@ -21,6 +21,11 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
 #include "http/http_handler.h"
 
 namespace starrocks {
@@ -38,7 +43,22 @@ public:
     void handle(HttpRequest* req) override;
 
 private:
+    enum Format { PROMETHEUS = 0, CORE, JSON, NUM_FORMATS };
+
+    struct CachedOutput {
+        // -1 if not rendered yet
+        int64_t render_time_ms = -1;
+        std::string output;
+    };
+
+    std::string _render(Format format);
+
     MetricRegistry* _metrics;
+
+    // Held while rendering, so the concurrent scrapes wait for one rendering instead of each
+    // walking the whole registry on their event threads.
+    std::mutex _lock;
+    std::array<CachedOutput, NUM_FORMATS> _cached;
 };
 
 } // namespace starrocks
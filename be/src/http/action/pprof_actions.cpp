@@ -38,13 +38,18 @@
 #include "http/http_headers.h"
 #include "http/http_request.h"
 #include "http/http_response.h"
+#include "runtime/query_sampler.h"
 #include "util/bfd_parser.h"
+#include "util/uid_util.h"
 
 namespace starrocks {
 
 // pprof default sample time in seconds.
 static const std::string SECOND_KEY = "seconds";
 static const int kPprofDefaultSampleSecs = 30;
+static const std::string QUERY_ID_KEY = "query_id";
+static const std::string FREQUENCY_KEY = "frequency";
+static const int kQueryProfileDefaultSampleSecs = 10;
 
 // Protect, only one thread can work
 static std::mutex kPprofActionMutex;
@@ -130,6 +135,46 @@ void ProfileAction::handle(HttpRequest* req) {
 #endif
 }
 
+void QueryProfileAction::handle(HttpRequest* req) {
+#if defined(ADDRESS_SANITIZER) || defined(LEAK_SANITIZER) || defined(THREAD_SANITIZER)
+    std::string str = "Query profiling is not available with address sanitizer builds.";
+    HttpChannel::send_reply(req, str);
+#else
+    // QuerySampler and ProfileAction both use SIGPROF.
+    std::lock_guard<std::mutex> lock(kPprofActionMutex);
+
+    // The query id is printed by print_id, e.g. 8f2a7bc1d0e34a5b-9c8d7e6f5a4b3c2d.
+    const std::string& query_id_str = req->param(QUERY_ID_KEY);
+    auto pos = query_id_str.find('-');
+    if (pos == std::string::npos) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, "invalid query_id: " + query_id_str);
+        return;
+    }
+    UniqueId query_id(std::string_view(query_id_str).substr(0, pos), std::string_view(query_id_str).substr(pos + 1));
+
+    int seconds = kQueryProfileDefaultSampleSecs;
+    const std::string& seconds_str = req->param(SECOND_KEY);
+    if (!seconds_str.empty()) {
+        seconds = std::atoi(seconds_str.c_str());
+    }
+    int frequency = QuerySampler::kDefaultFrequency;
+    const std::string& frequency_str = req->param(FREQUENCY_KEY);
+    if (!frequency_str.empty()) {
+        frequency = std::atoi(frequency_str.c_str());
+    }
+
+    Status status = QuerySampler::start(query_id.to_thrift(), frequency);
+    if (!status.ok()) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, status.to_string());
+        return;
+    }
+    sleep(seconds);
+    std::string str = QuerySampler::stop(_parser);
+
+    HttpChannel::send_reply(req, str);
+#endif
+}
+
 void CmdlineAction::handle(HttpRequest* req) {
     FILE* fp = fopen("/proc/self/cmdline", "r");
     if (fp == nullptr) {
@@ -58,6 +58,18 @@ public:
     void handle(HttpRequest* req) override {}
 };
 
+// Samples the threads working for one query and returns the collapsed stacks, see QuerySampler.
+class QueryProfileAction : public HttpHandler {
+public:
+    QueryProfileAction(BfdParser* parser) : _parser(parser) {}
+    ~QueryProfileAction() override = default;
+
+    void handle(HttpRequest* req) override;
+
+private:
+    BfdParser* _parser;
+};
+
 class ContentionAction : public HttpHandler {
 public:
     ContentionAction() = default;
@@ -37,6 +37,7 @@
 #include "gen_cpp/FrontendService.h"
 #include "gen_cpp/FrontendService_types.h"
 #include "gen_cpp/HeartbeatService_types.h"
+#include "http/action/stream_load_group_commit.h"
 #include "http/http_channel.h"
 #include "http/http_common.h"
 #include "http/http_headers.h"
@@ -49,6 +50,7 @@
 #include "runtime/fragment_mgr.h"
 #include "runtime/load_path_mgr.h"
 #include "runtime/plan_fragment_executor.h"
+#include "runtime/stream_load/json_stream_load_pipe.h"
 #include "runtime/stream_load/load_stream_mgr.h"
 #include "runtime/stream_load/stream_load_context.h"
 #include "runtime/stream_load/stream_load_executor.h"
@@ -108,7 +110,8 @@ static bool is_format_support_streaming(TFileFormatType::type format) {
     }
 }
 
-StreamLoadAction::StreamLoadAction(ExecEnv* exec_env) : _exec_env(exec_env) {
+StreamLoadAction::StreamLoadAction(ExecEnv* exec_env)
+        : _exec_env(exec_env), _group_commit_mgr(std::make_unique<GroupCommitMgr>(exec_env)) {
     StarRocksMetrics::instance()->metrics()->register_metric("streaming_load_requests_total",
                                                              &streaming_load_requests_total);
     StarRocksMetrics::instance()->metrics()->register_metric("streaming_load_bytes", &streaming_load_bytes);
@@ -161,6 +164,10 @@ Status StreamLoadAction::_handle(StreamLoadContext* ctx) {
                      << ", receive_bytes=" << ctx->receive_bytes << ", id=" << ctx->id;
         return Status::InternalError("receive body don't equal with body bytes");
     }
+    if (ctx->group_commit) {
+        auto sink = std::static_pointer_cast<GroupCommitBodySink>(ctx->body_sink);
+        return _group_commit_mgr->load(ctx, sink->data());
+    }
     if (!ctx->use_streaming) {
         // if we use non-streaming, we need to close file first,
         // then execute_plan_fragment here
@@ -278,6 +285,18 @@ Status StreamLoadAction::_on_header(HttpRequest* http_req, StreamLoadContext* ct
         ctx->timeout_second = timeout_second;
     }
 
+    if (boost::iequals(http_req->header(HTTP_GROUP_COMMIT), "true")) {
+        if (!http_req->header(HTTP_LABEL_KEY).empty()) {
+            return Status::InvalidArgument("Can not specify label for group commit load");
+        }
+        // the others are loaded in their own transactions
+        if (ctx->format == TFileFormatType::FORMAT_CSV_PLAIN && http_req->header(HTTP_ROW_DELIMITER).empty() &&
+            !http_req->header(HttpHeaders::CONTENT_LENGTH).empty() &&
+            ctx->body_bytes <= config::stream_load_group_commit_max_body_bytes) {
+            return _process_group_commit(http_req, ctx);
+        }
+    }
+
     // begin transaction
     int64_t begin_txn_start_time = MonotonicNanos();
     RETURN_IF_ERROR(_exec_env->stream_load_executor()->begin_txn(ctx));
@@ -341,15 +360,19 @@ Status StreamLoadAction::_process_put(HttpRequest* http_req, StreamLoadContext*
 
     // put request
     TStreamLoadPutRequest request;
-    set_request_auth(&request, ctx->auth);
-    request.db = ctx->db;
-    request.tbl = ctx->table;
+    RETURN_IF_ERROR(_build_put_request(http_req, ctx, &request));
     request.txnId = ctx->txn_id;
-    request.formatType = ctx->format;
     request.__set_loadId(ctx->id.to_thrift());
     if (ctx->use_streaming) {
-        auto pipe =
-                std::make_shared<StreamLoadPipe>(1024 * 1024 /* max_buffered_bytes */, 64 * 1024 /* min_chunk_size */);
+        std::shared_ptr<StreamLoadPipe> pipe;
+        if (ctx->format == TFileFormatType::FORMAT_JSON) {
+            // The json scanner parses one message at a time, so the body is cut into complete json values.
+            pipe = std::make_shared<JsonStreamLoadPipe>(1024 * 1024 /* max_buffered_bytes */,
+                                                        64 * 1024 /* min_chunk_size */);
+        } else {
+            pipe = std::make_shared<StreamLoadPipe>(1024 * 1024 /* max_buffered_bytes */,
+                                                    64 * 1024 /* min_chunk_size */);
+        }
         RETURN_IF_ERROR(_exec_env->load_stream_mgr()->put(ctx->id, pipe));
         request.fileType = TFileType::FILE_STREAM;
         ctx->body_sink = pipe;
@@ -361,48 +384,104 @@ Status StreamLoadAction::_process_put(HttpRequest* http_req, StreamLoadContext*
         request.fileType = TFileType::FILE_LOCAL;
         ctx->body_sink = file_sink;
     }
+    // plan this load
+    TNetworkAddress master_addr = _exec_env->master_info()->network_address;
+#ifndef BE_TEST
+    if (!http_req->header(HTTP_MAX_FILTER_RATIO).empty()) {
+        ctx->max_filter_ratio = strtod(http_req->header(HTTP_MAX_FILTER_RATIO).c_str(), nullptr);
+    }
+
+    int64_t stream_load_put_start_time = MonotonicNanos();
+    RETURN_IF_ERROR(ThriftRpcHelper::rpc<FrontendServiceClient>(
+            master_addr.hostname, master_addr.port,
+            [&request, ctx](FrontendServiceConnection& client) { client->streamLoadPut(ctx->put_result, request); }));
+    ctx->stream_load_put_cost_nanos = MonotonicNanos() - stream_load_put_start_time;
+#else
+    ctx->put_result = k_stream_load_put_result;
+#endif
+    Status plan_status(ctx->put_result.status);
+    if (!plan_status.ok()) {
+        LOG(WARNING) << "plan streaming load failed. errmsg=" << plan_status.get_error_msg() << ctx->brief();
+        return plan_status;
+    }
+    VLOG(3) << "params is " << apache::thrift::ThriftDebugString(ctx->put_result.params);
+    // if we not use streaming, we must download total content before we begin
+    // to process this load
+    if (!ctx->use_streaming) {
+        return Status::OK();
+    }
+
+    if (!http_req->header(HTTP_EXEC_MEM_LIMIT).empty()) {
+        auto exec_mem_limit = std::stoll(http_req->header(HTTP_EXEC_MEM_LIMIT));
+        if (exec_mem_limit <= 0) {
+            return Status::InvalidArgument("exec_mem_limit must be greater than 0");
+        }
+        ctx->put_result.params.query_options.mem_limit = exec_mem_limit;
+    }
+
+    return _exec_env->stream_load_executor()->execute_plan_fragment(ctx);
+}
+
+Status StreamLoadAction::_process_group_commit(HttpRequest* http_req, StreamLoadContext* ctx) {
+    RETURN_IF_ERROR(_build_put_request(http_req, ctx, &ctx->group_commit_request));
+    if (!http_req->header(HTTP_MAX_FILTER_RATIO).empty()) {
+        ctx->max_filter_ratio = strtod(http_req->header(HTTP_MAX_FILTER_RATIO).c_str(), nullptr);
+    }
+    // the body is buffered until the load joins its group
+    ctx->group_commit = true;
+    ctx->body_sink = std::make_shared<GroupCommitBodySink>();
+    return Status::OK();
+}
+
+// Build the put request of |ctx| except for the transaction, load id and file.
+Status StreamLoadAction::_build_put_request(HttpRequest* http_req, StreamLoadContext* ctx,
+                                            TStreamLoadPutRequest* request) {
+    set_request_auth(request, ctx->auth);
+    request->db = ctx->db;
+    request->tbl = ctx->table;
+    request->formatType = ctx->format;
     if (!http_req->header(HTTP_COLUMNS).empty()) {
-        request.__set_columns(http_req->header(HTTP_COLUMNS));
+        request->__set_columns(http_req->header(HTTP_COLUMNS));
     }
     if (!http_req->header(HTTP_WHERE).empty()) {
-        request.__set_where(http_req->header(HTTP_WHERE));
+        request->__set_where(http_req->header(HTTP_WHERE));
     }
     if (!http_req->header(HTTP_COLUMN_SEPARATOR).empty()) {
-        request.__set_columnSeparator(http_req->header(HTTP_COLUMN_SEPARATOR));
+        request->__set_columnSeparator(http_req->header(HTTP_COLUMN_SEPARATOR));
     }
     if (!http_req->header(HTTP_ROW_DELIMITER).empty()) {
-        request.__set_rowDelimiter(http_req->header(HTTP_ROW_DELIMITER));
+        request->__set_rowDelimiter(http_req->header(HTTP_ROW_DELIMITER));
     }
     if (!http_req->header(HTTP_PARTITIONS).empty()) {
-        request.__set_partitions(http_req->header(HTTP_PARTITIONS));
-        request.__set_isTempPartition(false);
+        request->__set_partitions(http_req->header(HTTP_PARTITIONS));
+        request->__set_isTempPartition(false);
         if (!http_req->header(HTTP_TEMP_PARTITIONS).empty()) {
             return Status::InvalidArgument("Can not specify both partitions and temporary partitions");
         }
     }
     if (!http_req->header(HTTP_TEMP_PARTITIONS).empty()) {
-        request.__set_partitions(http_req->header(HTTP_TEMP_PARTITIONS));
-        request.__set_isTempPartition(true);
+        request->__set_partitions(http_req->header(HTTP_TEMP_PARTITIONS));
+        request->__set_isTempPartition(true);
         if (!http_req->header(HTTP_PARTITIONS).empty()) {
             return Status::InvalidArgument("Can not specify both partitions and temporary partitions");
         }
     }
     if (!http_req->header(HTTP_NEGATIVE).empty() && http_req->header(HTTP_NEGATIVE) == "true") {
-        request.__set_negative(true);
+        request->__set_negative(true);
     } else {
-        request.__set_negative(false);
+        request->__set_negative(false);
     }
     if (!http_req->header(HTTP_STRICT_MODE).empty()) {
         if (boost::iequals(http_req->header(HTTP_STRICT_MODE), "false")) {
-            request.__set_strictMode(false);
+            request->__set_strictMode(false);
         } else if (boost::iequals(http_req->header(HTTP_STRICT_MODE), "true")) {
-            request.__set_strictMode(true);
+            request->__set_strictMode(true);
         } else {
             return Status::InvalidArgument("Invalid strict mode format. Must be bool type");
         }
     }
     if (!http_req->header(HTTP_TIMEZONE).empty()) {
-        request.__set_timezone(http_req->header(HTTP_TIMEZONE));
+        request->__set_timezone(http_req->header(HTTP_TIMEZONE));
     }
     if (!http_req->header(HTTP_LOAD_MEM_LIMIT).empty()) {
         try {
@@ -410,86 +489,51 @@ Status StreamLoadAction::_process_put(HttpRequest* http_req, StreamLoadContext*
             if (load_mem_limit < 0) {
                 return Status::InvalidArgument("load_mem_limit must be equal or greater than 0");
             }
-            request.__set_loadMemLimit(load_mem_limit);
+            request->__set_loadMemLimit(load_mem_limit);
         } catch (const std::invalid_argument& e) {
             return Status::InvalidArgument("Invalid load mem limit format");
         }
     }
     if (!http_req->header(HTTP_JSONPATHS).empty()) {
-        request.__set_jsonpaths(http_req->header(HTTP_JSONPATHS));
+        request->__set_jsonpaths(http_req->header(HTTP_JSONPATHS));
     }
     if (!http_req->header(HTTP_JSONROOT).empty()) {
-        request.__set_json_root(http_req->header(HTTP_JSONROOT));
+        request->__set_json_root(http_req->header(HTTP_JSONROOT));
     }
     if (!http_req->header(HTTP_STRIP_OUTER_ARRAY).empty()) {
         if (boost::iequals(http_req->header(HTTP_STRIP_OUTER_ARRAY), "true")) {
-            request.__set_strip_outer_array(true);
+            request->__set_strip_outer_array(true);
         } else {
-            request.__set_strip_outer_array(false);
+            request->__set_strip_outer_array(false);
         }
     } else {
-        request.__set_strip_outer_array(false);
+        request->__set_strip_outer_array(false);
     }
     if (!http_req->header(HTTP_PARTIAL_UPDATE).empty()) {
         if (boost::iequals(http_req->header(HTTP_PARTIAL_UPDATE), "false")) {
-            request.__set_partial_update(false);
+            request->__set_partial_update(false);
         } else if (boost::iequals(http_req->header(HTTP_PARTIAL_UPDATE), "true")) {
-            request.__set_partial_update(true);
+            request->__set_partial_update(true);
         } else {
             return Status::InvalidArgument("Invalid partial update flag format. Must be bool type");
         }
     }
     if (!http_req->header(HTTP_TRANSMISSION_COMPRESSION_TYPE).empty()) {
-        request.__set_transmission_compression_type(http_req->header(HTTP_TRANSMISSION_COMPRESSION_TYPE));
+        request->__set_transmission_compression_type(http_req->header(HTTP_TRANSMISSION_COMPRESSION_TYPE));
     }
     if (!http_req->header(HTTP_LOAD_DOP).empty()) {
         try {
             auto parallel_request_num = std::stoll(http_req->header(HTTP_LOAD_DOP));
-            request.__set_load_dop(parallel_request_num);
+            request->__set_load_dop(parallel_request_num);
         } catch (const std::invalid_argument& e) {
             return Status::InvalidArgument("Invalid load_dop format");
         }
     }
     if (ctx->timeout_second != -1) {
-        request.__set_timeout(ctx->timeout_second);
-    }
-    request.__set_thrift_rpc_timeout_ms(config::thrift_rpc_timeout_ms);
-    // plan this load
-    TNetworkAddress master_addr = _exec_env->master_info()->network_address;
-#ifndef BE_TEST
-    if (!http_req->header(HTTP_MAX_FILTER_RATIO).empty()) {
-        ctx->max_filter_ratio = strtod(http_req->header(HTTP_MAX_FILTER_RATIO).c_str(), nullptr);
-    }
-
-    int64_t stream_load_put_start_time = MonotonicNanos();
-    RETURN_IF_ERROR(ThriftRpcHelper::rpc<FrontendServiceClient>(
-            master_addr.hostname, master_addr.port,
-            [&request, ctx](FrontendServiceConnection& client) { client->streamLoadPut(ctx->put_result, request); }));
-    ctx->stream_load_put_cost_nanos = MonotonicNanos() - stream_load_put_start_time;
-#else
-    ctx->put_result = k_stream_load_put_result;
-#endif
-    Status plan_status(ctx->put_result.status);
-    if (!plan_status.ok()) {
-        LOG(WARNING) << "plan streaming load failed. errmsg=" << plan_status.get_error_msg() << ctx->brief();
-        return plan_status;
-    }
-    VLOG(3) << "params is " << apache::thrift::ThriftDebugString(ctx->put_result.params);
-    // if we not use streaming, we must download total content before we begin
-    // to process this load
-    if (!ctx->use_streaming) {
-        return Status::OK();
+        request->__set_timeout(ctx->timeout_second);
     }
-
-    if (!http_req->header(HTTP_EXEC_MEM_LIMIT).empty()) {
-        auto exec_mem_limit = std::stoll(http_req->header(HTTP_EXEC_MEM_LIMIT));
-        if (exec_mem_limit <= 0) {
-            return Status::InvalidArgument("exec_mem_limit must be greater than 0");
-        }
-        ctx->put_result.params.query_options.mem_limit = exec_mem_limit;
-    }
-
-    return _exec_env->stream_load_executor()->execute_plan_fragment(ctx);
+    request->__set_thrift_rpc_timeout_ms(config::thrift_rpc_timeout_ms);
+    return Status::OK();
 }
 
 Status StreamLoadAction::_data_saved_path(HttpRequest* req, std::string* file_path) {
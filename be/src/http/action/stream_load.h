@@ -22,6 +22,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 
 #include "gen_cpp/PlanNodes_types.h"
 #include "http/http_handler.h"
@@ -32,8 +33,10 @@
 namespace starrocks {
 
 class ExecEnv;
+class GroupCommitMgr;
 class Status;
 class StreamLoadContext;
+class TStreamLoadPutRequest;
 
 class StreamLoadAction : public HttpHandler {
 public:
@@ -55,9 +58,12 @@ private:
     Status _data_saved_path(HttpRequest* req, std::string* file_path);
     Status _execute_plan_fragment(StreamLoadContext* ctx);
     Status _process_put(HttpRequest* http_req, StreamLoadContext* ctx);
+    Status _process_group_commit(HttpRequest* http_req, StreamLoadContext* ctx);
+    Status _build_put_request(HttpRequest* http_req, StreamLoadContext* ctx, TStreamLoadPutRequest* request);
 
 private:
     ExecEnv* _exec_env;
+    std::unique_ptr<GroupCommitMgr> _group_commit_mgr;
 };
 
 } // namespace starrocks
@@ -0,0 +1,231 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "http/action/stream_load_group_commit.h"
+
+#include <thrift/protocol/TDebugProtocol.h>
+
+#include <chrono>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "gen_cpp/FrontendService.h"
+#include "gen_cpp/FrontendService_types.h"
+#include "runtime/client_cache.h"
+#include "runtime/exec_env.h"
+#include "runtime/stream_load/load_stream_mgr.h"
+#include "runtime/stream_load/stream_load_context.h"
+#include "runtime/stream_load/stream_load_executor.h"
+#include "runtime/stream_load/stream_load_pipe.h"
+#include "util/thrift_rpc_helper.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+#ifdef BE_TEST
+extern TStreamLoadPutResult k_stream_load_put_result;
+#endif
+
+struct GroupCommitMgr::Group {
+    Group(ExecEnv* exec_env, std::string key_, const StreamLoadContext* leader)
+            : key(std::move(key_)),
+              ctx(new StreamLoadContext(exec_env)),
+              deadline(std::chrono::steady_clock::now() +
+                       std::chrono::milliseconds(config::stream_load_group_commit_interval_ms)) {
+        ctx->ref();
+        ctx->load_type = TLoadType::MANUAL_LOAD;
+        ctx->load_src_type = TLoadSourceType::RAW;
+        ctx->label = "group_commit_" + generate_uuid_string();
+        ctx->db = leader->db;
+        ctx->table = leader->table;
+        ctx->auth = leader->auth;
+        ctx->timeout_second = leader->timeout_second;
+        ctx->max_filter_ratio = leader->max_filter_ratio;
+        ctx->format = leader->format;
+        ctx->use_streaming = true;
+        request = leader->group_commit_request;
+    }
+
+    ~Group() {
+        if (ctx->unref()) {
+            delete ctx;
+        }
+    }
+
+    const std::string key;
+    // the stream load of the whole group
+    StreamLoadContext* ctx;
+    TStreamLoadPutRequest request;
+    std::shared_ptr<StreamLoadPipe> pipe;
+    const std::chrono::steady_clock::time_point deadline;
+
+    // protected by GroupCommitMgr::_lock
+    size_t bytes = 0;
+    int num_loads = 0;
+    // the number of members joined but not appended their data yet
+    int pending_appends = 0;
+    bool started = false;
+    Status start_status;
+    // set if no more member can join
+    bool closed = false;
+    bool done = false;
+    Status status;
+    std::condition_variable cv;
+
+    // serialize the appends to |pipe|
+    std::mutex append_lock;
+};
+
+Status GroupCommitMgr::load(StreamLoadContext* ctx, const std::string& data) {
+    std::string key = apache::thrift::ThriftDebugString(ctx->group_commit_request);
+    key.append("|").append(std::to_string(ctx->max_filter_ratio));
+
+    std::shared_ptr<Group> group;
+    bool is_leader = false;
+    {
+        std::lock_guard l(_lock);
+        auto& g = _groups[key];
+        if (g == nullptr) {
+            g = std::make_shared<Group>(_exec_env, key, ctx);
+            is_leader = true;
+        }
+        group = g;
+        group->bytes += data.size();
+        group->num_loads++;
+        group->pending_appends++;
+        if (group->bytes >= config::stream_load_group_commit_max_bytes) {
+            _groups.erase(key);
+            group->closed = true;
+            group->cv.notify_all();
+        }
+    }
+    StreamLoadContext* gctx = group->ctx;
+
+    if (is_leader) {
+        Status st = _start(group.get());
+        std::lock_guard l(_lock);
+        group->started = true;
+        group->start_status = st;
+        group->cv.notify_all();
+    }
+
+    // append the data of this member to the group
+    {
+        std::unique_lock l(_lock);
+        group->cv.wait(l, [&group] { return group->started; });
+        Status st = group->start_status;
+        l.unlock();
+        if (st.ok() && !data.empty()) {
+            std::lock_guard al(group->append_lock);
+            st = group->pipe->append(data.data(), data.size());
+            if (st.ok() && data.back() != '\n') {
+                st = group->pipe->append("\n", 1);
+            }
+            if (!st.ok()) {
+                LOG(WARNING) << "Fail to append to group commit load, errmsg=" << st.get_error_msg() << gctx->brief();
+                group->pipe->cancel(st);
+            }
+        }
+        l.lock();
+        group->pending_appends--;
+        group->cv.notify_all();
+    }
+
+    if (is_leader) {
+        {
+            std::unique_lock l(_lock);
+            if (group->start_status.ok()) {
+                group->cv.wait_until(l, group->deadline, [&group] { return group->closed; });
+            }
+            auto iter = _groups.find(group->key);
+            if (iter != _groups.end() && iter->second == group) {
+                _groups.erase(iter);
+            }
+            group->closed = true;
+            group->cv.wait(l, [&group] { return group->pending_appends == 0; });
+        }
+        Status st = group->start_status.ok() ? _commit(group.get()) : group->start_status;
+        if (!st.ok() && st.code() != TStatusCode::PUBLISH_TIMEOUT) {
+            LOG(WARNING) << "Fail to group commit " << group->num_loads << " loads, errmsg=" << st.get_error_msg()
+                         << gctx->brief();
+            gctx->status = st;
+            if (gctx->need_rollback) {
+                _exec_env->stream_load_executor()->rollback_txn(gctx);
+                gctx->need_rollback = false;
+            }
+            if (group->pipe != nullptr) {
+                group->pipe->cancel(st);
+            }
+        } else {
+            LOG(INFO) << "Group committed " << group->num_loads << " loads of " << group->bytes << " bytes"
+                      << gctx->brief();
+        }
+        std::lock_guard l(_lock);
+        group->status = st;
+        group->done = true;
+        group->cv.notify_all();
+    } else {
+        std::unique_lock l(_lock);
+        group->cv.wait(l, [&group] { return group->done; });
+    }
+
+    ctx->label = gctx->label;
+    ctx->txn_id = gctx->txn_id;
+    ctx->number_total_rows = gctx->number_total_rows;
+    ctx->number_loaded_rows = gctx->number_loaded_rows;
+    ctx->number_filtered_rows = gctx->number_filtered_rows;
+    ctx->number_unselected_rows = gctx->number_unselected_rows;
+    ctx->loaded_bytes = gctx->loaded_bytes;
+    ctx->error_url = gctx->error_url;
+    ctx->begin_txn_cost_nanos = gctx->begin_txn_cost_nanos;
+    ctx->stream_load_put_cost_nanos = gctx->stream_load_put_cost_nanos;
+    ctx->commit_and_publish_txn_cost_nanos = gctx->commit_and_publish_txn_cost_nanos;
+    return group->status;
+}
+
+Status GroupCommitMgr::_start(Group* group) {
+    StreamLoadContext* gctx = group->ctx;
+    int64_t begin_txn_start_time = MonotonicNanos();
+    RETURN_IF_ERROR(_exec_env->stream_load_executor()->begin_txn(gctx));
+    gctx->begin_txn_cost_nanos = MonotonicNanos() - begin_txn_start_time;
+
+    auto pipe = std::make_shared<StreamLoadPipe>(1024 * 1024 /* max_buffered_bytes */, 64 * 1024 /* min_chunk_size */);
+    RETURN_IF_ERROR(_exec_env->load_stream_mgr()->put(gctx->id, pipe));
+    gctx->body_sink = pipe;
+    group->pipe = pipe;
+
+    // plan this group as one stream load
+    TStreamLoadPutRequest& request = group->request;
+    request.txnId = gctx->txn_id;
+    request.__set_loadId(gctx->id.to_thrift());
+    request.fileType = TFileType::FILE_STREAM;
+#ifndef BE_TEST
+    TNetworkAddress master_addr = _exec_env->master_info()->network_address;
+    int64_t stream_load_put_start_time = MonotonicNanos();
+    RETURN_IF_ERROR(ThriftRpcHelper::rpc<FrontendServiceClient>(
+            master_addr.hostname, master_addr.port,
+            [&request, gctx](FrontendServiceConnection& client) { client->streamLoadPut(gctx->put_result, request); }));
+    gctx->stream_load_put_cost_nanos = MonotonicNanos() - stream_load_put_start_time;
+#else
+    gctx->put_result = k_stream_load_put_result;
+#endif
+    Status plan_status(gctx->put_result.status);
+    if (!plan_status.ok()) {
+        LOG(WARNING) << "plan group commit load failed. errmsg=" << plan_status.get_error_msg() << gctx->brief();
+        return plan_status;
+    }
+    return _exec_env->stream_load_executor()->execute_plan_fragment(gctx);
+}
+
+Status GroupCommitMgr::_commit(Group* group) {
+    StreamLoadContext* gctx = group->ctx;
+    RETURN_IF_ERROR(group->pipe->finish());
+    RETURN_IF_ERROR(gctx->future.get());
+
+    int64_t commit_and_publish_start_time = MonotonicNanos();
+    RETURN_IF_ERROR(_exec_env->stream_load_executor()->commit_txn(gctx));
+    gctx->commit_and_publish_txn_cost_nanos = MonotonicNanos() - commit_and_publish_start_time;
+    return Status::OK();
+}
+
+} // namespace starrocks
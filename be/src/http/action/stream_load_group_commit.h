@@ -0,0 +1,66 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/status.h"
+#include "runtime/message_body_sink.h"
+
+namespace starrocks {
+
+class ExecEnv;
+class StreamLoadContext;
+class StreamLoadPipe;
+
+// Buffer the body of a stream load in memory until it is handed over to its group.
+class GroupCommitBodySink : public MessageBodySink {
+public:
+    Status append(const char* data, size_t size) override {
+        _data.append(data, size);
+        return Status::OK();
+    }
+
+    std::string& data() { return _data; }
+
+private:
+    std::string _data;
+};
+
+// Group commit of the small stream loads.
+//
+// Every small stream load costs a load transaction, a plan from FE, and a rowset written and published
+// for each tablet it touches, which dominates the cost when clients send many tiny loads. The concurrent
+// small loads with the same load parameters into the same table are grouped into one stream load on this
+// BE instead: their bodies are appended to the pipe of the group, so they share the tablet writers and
+// MemTables, and are committed as a single transaction by the interval or size limit of the group. Each
+// client is replied after the transaction of its group is committed, with the label of the group.
+class GroupCommitMgr {
+public:
+    explicit GroupCommitMgr(ExecEnv* exec_env) : _exec_env(exec_env) {}
+
+    GroupCommitMgr(const GroupCommitMgr&) = delete;
+    const GroupCommitMgr& operator=(const GroupCommitMgr&) = delete;
+
+    // Load |data| of |ctx| as a member of a group, and wait for the group to be committed.
+    // The status, label, transaction and statistics of the group are set to |ctx|.
+    Status load(StreamLoadContext* ctx, const std::string& data);
+
+private:
+    struct Group;
+
+    Status _start(Group* group);
+    Status _commit(Group* group);
+
+    ExecEnv* _exec_env;
+
+    std::mutex _lock;
+    // the groups still accepting new members, by their load parameters
+    std::unordered_map<std::string, std::shared_ptr<Group>> _groups;
+};
+
+} // namespace starrocks
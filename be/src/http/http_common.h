@@ -49,6 +49,7 @@ static const std::string HTTP_STRIP_OUTER_ARRAY = "strip_outer_array";
 static const std::string HTTP_PARTIAL_UPDATE = "partial_update";
 static const std::string HTTP_TRANSMISSION_COMPRESSION_TYPE = "transmission_compression_type";
 static const std::string HTTP_LOAD_DOP = "load_dop";
+static const std::string HTTP_GROUP_COMMIT = "group_commit";
 
 static const std::string HTTP_100_CONTINUE = "100-continue";
 
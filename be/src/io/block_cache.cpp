@@ -0,0 +1,251 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "io/block_cache.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "env/env.h"
+#include "gutil/hash/city.h"
+#include "gutil/hash/hash128to64.h"
+#include "gutil/strings/split.h"
+#include "gutil/strings/strip.h"
+#include "util/starrocks_metrics.h"
+#include "util/threadpool.h"
+
+namespace starrocks::io {
+
+// The blocks beyond this number of pending writes are dropped, which bounds the memory of the pending blocks.
+static constexpr int kMaxPendingWrites = 64;
+
+BlockCache* BlockCache::_s_instance = nullptr;
+
+BlockCache::FileId BlockCache::file_id(const std::string& path, int64_t modification_time, int64_t file_size) {
+    std::string key = path;
+    key.append(reinterpret_cast<const char*>(&modification_time), sizeof(modification_time));
+    key.append(reinterpret_cast<const char*>(&file_size), sizeof(file_size));
+    return util_hash::CityHash128(key.data(), key.size());
+}
+
+bool BlockCache::is_admitted(const std::string& database, const std::string& table) {
+    const std::string full_name = database + "." + table;
+    std::vector<std::string> rules =
+            strings::Split(config::block_cache_admission_tables, ",", strings::SkipWhitespace());
+    for (auto& rule : rules) {
+        StripWhiteSpace(&rule);
+        if (rule == "*" || rule == table || rule == full_name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Status BlockCache::create_global_cache(const std::vector<std::string>& dirs, int64_t capacity_per_dir,
+                                       int64_t block_size) {
+    if (_s_instance != nullptr) {
+        return Status::OK();
+    }
+    auto cache = std::make_unique<BlockCache>(dirs, capacity_per_dir, block_size);
+    RETURN_IF_ERROR(cache->init());
+    _s_instance = cache.release();
+    return Status::OK();
+}
+
+void BlockCache::release_global_cache() {
+    if (_s_instance != nullptr) {
+        delete _s_instance;
+        _s_instance = nullptr;
+    }
+}
+
+size_t BlockCache::BlockKeyHash::operator()(const BlockKey& key) const {
+    return Hash128to64(uint128(Uint128Low64(key.file) ^ Uint128High64(key.file), key.index));
+}
+
+BlockCache::BlockCache(std::vector<std::string> dirs, int64_t capacity_per_dir, int64_t block_size)
+        : _dirs(std::move(dirs)), _capacity_per_dir(capacity_per_dir), _block_size(block_size) {}
+
+BlockCache::~BlockCache() {
+    if (_write_pool != nullptr) {
+        _write_pool->shutdown();
+    }
+    for (int fd : _fds) {
+        ::close(fd);
+    }
+}
+
+Status BlockCache::init() {
+    if (_dirs.empty() || _block_size <= 0 || _capacity_per_dir < _block_size) {
+        return Status::InvalidArgument("invalid block cache config");
+    }
+    _slots_per_dir = _capacity_per_dir / _block_size;
+    for (const auto& dir : _dirs) {
+        RETURN_IF_ERROR(Env::Default()->create_dir_recursive(dir));
+        // The index isn't persisted, so the blocks left by the last run are useless.
+        std::string path = dir + "/blocks";
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0) {
+            PLOG(WARNING) << "fail to open block cache file. path=" << path;
+            return Status::IOError("fail to open block cache file");
+        }
+        _fds.push_back(fd);
+        if (::ftruncate(fd, static_cast<off_t>(_slots_per_dir * _block_size)) != 0) {
+            PLOG(WARNING) << "fail to truncate block cache file. path=" << path;
+            return Status::IOError("fail to truncate block cache file");
+        }
+    }
+
+    _slots.resize(_slots_per_dir * _dirs.size());
+    // Interleave the directories, so the blocks are spread over the disks before the cache is full.
+    // The free slots are popped from the back.
+    _free_slots.reserve(_slots.size());
+    for (size_t i = _slots_per_dir; i > 0; i--) {
+        for (size_t dir = _dirs.size(); dir > 0; dir--) {
+            _free_slots.push_back((dir - 1) * _slots_per_dir + (i - 1));
+        }
+    }
+
+    return ThreadPoolBuilder("block_cache")
+            .set_min_threads(0)
+            .set_max_threads(static_cast<int>(_dirs.size()))
+            .set_max_queue_size(kMaxPendingWrites)
+            .build(&_write_pool);
+}
+
+Status BlockCache::read(const FileId& file, int64_t block_index, int64_t offset, void* out, int64_t count) {
+    StarRocksMetrics::instance()->block_cache_lookup_total.increment(1);
+    size_t slot;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        auto it = _index.find({file, block_index});
+        if (it == _index.end() || offset + count > _slots[it->second].size) {
+            return Status::NotFound("block not cached");
+        }
+        slot = it->second;
+        _slots[slot].num_readers++;
+        _lru.splice(_lru.begin(), _lru, _slots[slot].lru_it);
+    }
+
+    auto* data = static_cast<char*>(out);
+    int64_t pos = _offset(slot) + offset;
+    Status status;
+    while (count > 0) {
+        ssize_t r_size = ::pread(_fd(slot), data, count, pos);
+        if (r_size < 0 && errno == EINTR) {
+            continue;
+        }
+        if (r_size <= 0) {
+            PLOG(WARNING) << "fail to read block cache file";
+            status = Status::IOError("fail to read block cache file");
+            break;
+        }
+        data += r_size;
+        pos += r_size;
+        count -= r_size;
+    }
+
+    std::lock_guard<std::mutex> l(_mutex);
+    _slots[slot].num_readers--;
+    if (!status.ok()) {
+        // The block can't be read, and the caller reads the remote file instead.
+        return Status::NotFound("block not readable");
+    }
+    StarRocksMetrics::instance()->block_cache_hit_total.increment(1);
+    return Status::OK();
+}
+
+int64_t BlockCache::_acquire_slot_locked() {
+    if (!_free_slots.empty()) {
+        size_t slot = _free_slots.back();
+        _free_slots.pop_back();
+        return slot;
+    }
+    for (auto it = _lru.rbegin(); it != _lru.rend(); ++it) {
+        size_t slot = *it;
+        if (_slots[slot].num_readers > 0) {
+            continue;
+        }
+        _index.erase(_slots[slot].key);
+        _lru.erase(_slots[slot].lru_it);
+        _used_bytes -= _slots[slot].size;
+        StarRocksMetrics::instance()->block_cache_evict_total.increment(1);
+        return slot;
+    }
+    return -1;
+}
+
+void BlockCache::write_async(const FileId& file, int64_t block_index, std::shared_ptr<std::string> data) {
+    DCHECK_LE(static_cast<int64_t>(data->size()), _block_size);
+    BlockKey key{file, block_index};
+    int64_t slot;
+    {
+        std::lock_guard<std::mutex> l(_mutex);
+        if (_index.count(key) > 0 || _writing.count(key) > 0) {
+            return;
+        }
+        slot = _acquire_slot_locked();
+        if (slot < 0) {
+            StarRocksMetrics::instance()->block_cache_bypass_total.increment(1);
+            return;
+        }
+        _slots[slot].key = key;
+        _slots[slot].size = 0;
+        _writing.insert(key);
+    }
+
+    auto st = _write_pool->submit_func([this, slot, data = std::move(data)]() { _write(slot, data); });
+    if (!st.ok()) {
+        std::lock_guard<std::mutex> l(_mutex);
+        _writing.erase(key);
+        _free_slots.push_back(slot);
+        StarRocksMetrics::instance()->block_cache_bypass_total.increment(1);
+    }
+}
+
+void BlockCache::_write(size_t slot, std::shared_ptr<std::string> data) {
+    const char* buf = data->data();
+    int64_t size = data->size();
+    int64_t pos = _offset(slot);
+    bool ok = true;
+    while (size > 0) {
+        ssize_t w_size = ::pwrite(_fd(slot), buf, size, pos);
+        if (w_size < 0 && errno == EINTR) {
+            continue;
+        }
+        if (w_size <= 0) {
+            PLOG(WARNING) << "fail to write block cache file";
+            ok = false;
+            break;
+        }
+        buf += w_size;
+        pos += w_size;
+        size -= w_size;
+    }
+
+    std::lock_guard<std::mutex> l(_mutex);
+    Slot& s = _slots[slot];
+    _writing.erase(s.key);
+    if (!ok) {
+        _free_slots.push_back(slot);
+        return;
+    }
+    s.size = data->size();
+    _lru.push_front(slot);
+    s.lru_it = _lru.begin();
+    _index[s.key] = slot;
+    _used_bytes += s.size;
+    StarRocksMetrics::instance()->block_cache_insert_total.increment(1);
+}
+
+void BlockCache::wait_for_writes() {
+    _write_pool->wait();
+}
+
+int64_t BlockCache::used_bytes() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _used_bytes;
+}
+
+} // namespace starrocks::io
@@ -0,0 +1,123 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/status.h"
+#include "gutil/int128.h"
+
+namespace starrocks {
+class ThreadPool;
+}
+
+namespace starrocks::io {
+
+// BlockCache caches the fixed-size blocks of the remote files, e.g. the files of the hive tables on hdfs or s3,
+// on the local disks. Every directory has one cache file which is divided into slots of the block size,
+// and the blocks are evicted in LRU order once all the slots are used.
+//
+// The index is only kept in memory, so the cache is empty after the backend restarts. The blocks are
+// written by a background thread pool, and a block is dropped rather than delaying the scan if the
+// writes can't keep up.
+//
+// The lookup/hit/insert/evict/bypass counts are reported by StarRocksMetrics as `block_cache`.
+class BlockCache {
+public:
+    // The identifier of a version of a remote file, see file_id().
+    using FileId = uint128;
+
+    // The modification time and the size identify the version of the file, so the blocks of an overwritten
+    // file are never hit.
+    static FileId file_id(const std::string& path, int64_t modification_time, int64_t file_size);
+
+    // Whether the blocks of the table are admitted into the cache, see config `block_cache_admission_tables`.
+    static bool is_admitted(const std::string& database, const std::string& table);
+
+    // Create global instance of this class
+    static Status create_global_cache(const std::vector<std::string>& dirs, int64_t capacity_per_dir,
+                                      int64_t block_size);
+
+    static void release_global_cache();
+
+    // Return global instance, or nullptr if the cache isn't enabled.
+    static BlockCache* instance() { return _s_instance; }
+
+    BlockCache(std::vector<std::string> dirs, int64_t capacity_per_dir, int64_t block_size);
+    ~BlockCache();
+
+    Status init();
+
+    int64_t block_size() const { return _block_size; }
+
+    // Read |count| bytes at |offset| of the block |block_index| of |file| into |out|.
+    // Returns NotFound if the block isn't cached.
+    Status read(const FileId& file, int64_t block_index, int64_t offset, void* out, int64_t count);
+
+    // Cache the block |block_index| of |file| asynchronously. The block is skipped if it's cached already,
+    // or if there are too many pending writes.
+    void write_async(const FileId& file, int64_t block_index, std::shared_ptr<std::string> data);
+
+    // Wait for the submitted writes to finish.
+    void wait_for_writes();
+
+    int64_t capacity() const { return static_cast<int64_t>(_slots.size()) * _block_size; }
+
+    int64_t used_bytes() const;
+
+private:
+    struct BlockKey {
+        FileId file;
+        int64_t index;
+
+        bool operator==(const BlockKey& rhs) const { return file == rhs.file && index == rhs.index; }
+    };
+
+    struct BlockKeyHash {
+        size_t operator()(const BlockKey& key) const;
+    };
+
+    struct Slot {
+        BlockKey key;
+        int64_t size = 0;
+        int32_t num_readers = 0;
+        // The position in _lru, valid only if the slot is in _index.
+        std::list<size_t>::iterator lru_it;
+    };
+
+    // Returns a free slot, evicting the least recently used block if necessary, or -1 if all the slots
+    // are being read or written.
+    int64_t _acquire_slot_locked();
+    void _write(size_t slot, std::shared_ptr<std::string> data);
+
+    int _fd(size_t slot) const { return _fds[slot / _slots_per_dir]; }
+    int64_t _offset(size_t slot) const { return static_cast<int64_t>(slot % _slots_per_dir) * _block_size; }
+
+    static BlockCache* _s_instance;
+
+    const std::vector<std::string> _dirs;
+    const int64_t _capacity_per_dir;
+    const int64_t _block_size;
+    size_t _slots_per_dir = 0;
+    std::vector<int> _fds;
+
+    mutable std::mutex _mutex;
+    std::vector<Slot> _slots;
+    std::unordered_map<BlockKey, size_t, BlockKeyHash> _index;
+    // The cached slots, the most recently used first.
+    std::list<size_t> _lru;
+    std::vector<size_t> _free_slots;
+    // The blocks being written.
+    std::unordered_set<BlockKey, BlockKeyHash> _writing;
+    int64_t _used_bytes = 0;
+
+    std::unique_ptr<ThreadPool> _write_pool;
+};
+
+} // namespace starrocks::io
@@ -0,0 +1,92 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "io/cache_input_stream.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace starrocks::io {
+
+CacheInputStream::CacheInputStream(std::shared_ptr<SeekableInputStream> stream, BlockCache* cache,
+                                   BlockCache::FileId file_id)
+        : _stream(std::move(stream)), _cache(cache), _file_id(file_id) {}
+
+StatusOr<int64_t> CacheInputStream::get_size() {
+    if (_size < 0) {
+        ASSIGN_OR_RETURN(_size, _stream->get_size());
+    }
+    return _size;
+}
+
+Status CacheInputStream::seek(int64_t position) {
+    if (position < 0) {
+        return Status::InvalidArgument(fmt::format("Invalid offset {}", position));
+    }
+    _offset = position;
+    return Status::OK();
+}
+
+StatusOr<int64_t> CacheInputStream::read(void* data, int64_t count) {
+    ASSIGN_OR_RETURN(int64_t nread, read_at(_offset, data, count));
+    _offset += nread;
+    return nread;
+}
+
+Status CacheInputStream::_read_block(int64_t block_index, int64_t offset, char* out, int64_t count) {
+    if (_cache->read(_file_id, block_index, offset, out, count).ok()) {
+        _hit_bytes += count;
+        return Status::OK();
+    }
+
+    const int64_t block_size = _cache->block_size();
+    const int64_t block_offset = block_index * block_size;
+    const int64_t block_length = std::min(block_size, _size - block_offset);
+    auto block = std::make_shared<std::string>(block_length, '\0');
+    RETURN_IF_ERROR(_stream->read_at_fully(block_offset, block->data(), block_length));
+    _miss_bytes += block_length;
+    memcpy(out, block->data() + offset, count);
+    _cache->write_async(_file_id, block_index, std::move(block));
+    return Status::OK();
+}
+
+StatusOr<int64_t> CacheInputStream::read_at(int64_t offset, void* out, int64_t count) {
+    if (offset < 0 || count < 0) {
+        return Status::InvalidArgument(fmt::format("Invalid offset {} or count {}", offset, count));
+    }
+    ASSIGN_OR_RETURN(int64_t size, get_size());
+    count = std::min(count, std::max<int64_t>(0, size - offset));
+
+    const int64_t block_size = _cache->block_size();
+    auto* p = static_cast<char*>(out);
+    int64_t nread = 0;
+    while (nread < count) {
+        const int64_t pos = offset + nread;
+        const int64_t offset_in_block = pos % block_size;
+        const int64_t len = std::min(count - nread, block_size - offset_in_block);
+        RETURN_IF_ERROR(_read_block(pos / block_size, offset_in_block, p + nread, len));
+        nread += len;
+    }
+    return nread;
+}
+
+Status CacheInputStream::read_at_fully(int64_t offset, void* out, int64_t count) {
+    ASSIGN_OR_RETURN(int64_t nread, read_at(offset, out, count));
+    if (nread < count) {
+        return Status::IOError("cannot read fully");
+    }
+    return Status::OK();
+}
+
+StatusOr<std::unique_ptr<NumericStatistics>> CacheInputStream::get_numeric_statistics() {
+    ASSIGN_OR_RETURN(auto statistics, _stream->get_numeric_statistics());
+    if (statistics == nullptr) {
+        statistics = std::make_unique<NumericStatistics>();
+    }
+    statistics->append("BlockCacheHitBytes", _hit_bytes);
+    statistics->append("BlockCacheMissBytes", _miss_bytes);
+    return std::move(statistics);
+}
+
+} // namespace starrocks::io
@@ -0,0 +1,49 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "io/block_cache.h"
+#include "io/seekable_input_stream.h"
+
+namespace starrocks::io {
+
+// CacheInputStream reads a remote file through the BlockCache. A block missing from the cache is read
+// from the remote file as a whole and then cached asynchronously, so the later reads of any part of it hit.
+class CacheInputStream final : public SeekableInputStream {
+public:
+    CacheInputStream(std::shared_ptr<SeekableInputStream> stream, BlockCache* cache, BlockCache::FileId file_id);
+
+    ~CacheInputStream() override = default;
+
+    StatusOr<int64_t> read(void* data, int64_t count) override;
+
+    StatusOr<int64_t> read_at(int64_t offset, void* out, int64_t count) override;
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override;
+
+    Status seek(int64_t position) override;
+
+    StatusOr<int64_t> position() override { return _offset; }
+
+    StatusOr<int64_t> get_size() override;
+
+    StatusOr<std::unique_ptr<NumericStatistics>> get_numeric_statistics() override;
+
+private:
+    Status _read_block(int64_t block_index, int64_t offset, char* out, int64_t count);
+
+    std::shared_ptr<SeekableInputStream> _stream;
+    BlockCache* _cache;
+    const BlockCache::FileId _file_id;
+    int64_t _offset = 0;
+    int64_t _size = -1;
+
+    // Atomic, since the blocks may be read concurrently by read_at().
+    std::atomic<int64_t> _hit_bytes = 0;
+    std::atomic<int64_t> _miss_bytes = 0;
+};
+
+} // namespace starrocks::io
@@ -11,7 +11,12 @@ StatusOr<int64_t> CompressedInputStream::read(void* data, int64_t size) {
     size_t output_bytes = 0;
 
     while (output_bytes == 0) {
-        Status st = _compressed_buff.read(_source_stream.get());
+        // Refilling moves the buffered bytes to the beginning of the buffer, so it's done only when less than half
+        // of the buffer is left, instead of on every read.
+        Status st;
+        if (_need_more_input || _stream_end || _compressed_buff.available() < _compressed_buff.capacity() / 2) {
+            st = _compressed_buff.read(_source_stream.get());
+        }
         if (!st.ok() && !st.is_end_of_file()) {
             return st;
         } else if (st.is_end_of_file() && _stream_end) {
@@ -32,6 +37,7 @@ StatusOr<int64_t> CompressedInputStream::read(void* data, int64_t size) {
             return Status::InternalError(strings::Substitute("Failed to decompress. input_len:$0, output_len:$0",
                                                              compressed_data.size, output_len));
         }
+        _need_more_input = (output_bytes_written == 0 && input_bytes_read == 0);
         _compressed_buff.skip(input_bytes_read);
         output_bytes += output_bytes_written;
     }
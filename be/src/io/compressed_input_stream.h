@@ -69,6 +69,8 @@ private:
 
         size_t available() const { return _limit - _offset; }
 
+        size_t capacity() const { return _compressed_data.size(); }
+
     private:
         raw::RawVector<uint8_t> _compressed_data;
         size_t _offset;
@@ -79,6 +81,8 @@ private:
     std::shared_ptr<Decompressor> _decompressor;
     CompressedBuffer _compressed_buff;
     bool _stream_end = false;
+    // Whether the last decompression made no progress with the buffered data.
+    bool _need_more_input = false;
 };
 
 } // namespace starrocks::io
@@ -2,6 +2,7 @@
 
 #include "io/fd_input_stream.h"
 
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -9,6 +10,8 @@
 #include "common/logging.h"
 #include "gutil/macros.h"
 #include "io/io_error.h"
+#include "util/metrics.h"
+#include "util/time.h"
 
 namespace starrocks::io {
 
@@ -40,7 +43,11 @@ Status FdInputStream::close() {
 StatusOr<int64_t> FdInputStream::read(void* data, int64_t count) {
     CHECK_IS_CLOSED(_is_closed);
     ssize_t res;
+    const int64_t start_ns = _latency_histogram != nullptr ? MonotonicNanos() : 0;
     RETRY_ON_EINTR(res, ::pread(_fd, static_cast<char*>(data), count, _offset));
+    if (_latency_histogram != nullptr) {
+        _latency_histogram->add((MonotonicNanos() - start_ns) / 1000);
+    }
     if (UNLIKELY(res < 0)) {
         _errno = errno;
         return io_error("read", _errno);
@@ -68,7 +75,11 @@ Status FdInputStream::seek(int64_t offset) {
 StatusOr<int64_t> FdInputStream::read_at(int64_t offset, void* data, int64_t count) {
     CHECK_IS_CLOSED(_is_closed);
     ssize_t res;
+    const int64_t start_ns = _latency_histogram != nullptr ? MonotonicNanos() : 0;
     RETRY_ON_EINTR(res, ::pread(_fd, static_cast<char*>(data), count, offset));
+    if (_latency_histogram != nullptr) {
+        _latency_histogram->add((MonotonicNanos() - start_ns) / 1000);
+    }
     if (UNLIKELY(res < 0)) {
         _errno = errno;
         return io_error("read", _errno);
@@ -90,4 +101,14 @@ Status FdInputStream::read_at_fully(int64_t offset, void* data, int64_t count) {
 }
 
 #undef CHECK_IS_CLOSED
+void FdInputStream::will_need(int64_t offset, int64_t count) {
+    if (_is_closed) {
+        return;
+    }
+    // The readahead is queued by the kernel without waiting for it, so all the ranges hinted are
+    // read concurrently at the queue depth of the device, rather than one pread at a time.
+    int res = ::posix_fadvise(_fd, offset, count, POSIX_FADV_WILLNEED);
+    LOG_IF(WARNING, res != 0) << "posix_fadvise failed: " << res;
+}
+
 } // namespace starrocks::io
@@ -4,6 +4,10 @@
 
 #include "io/seekable_input_stream.h"
 
+namespace starrocks {
+class HistogramMetric;
+} // namespace starrocks
+
 namespace starrocks::io {
 
 // A RandomAccessFile which reads from a file descriptor.
@@ -45,16 +49,23 @@ public:
     // Otherwise, this is zero.
     int get_errno() const { return _errno; }
 
+    // If set, the latencies of the preads in microseconds are added to |histogram|.
+    void set_latency_histogram(HistogramMetric* histogram) { _latency_histogram = histogram; }
+
     StatusOr<int64_t> read_at(int64_t offset, void* data, int64_t count) override;
 
     Status read_at_fully(int64_t offset, void* data, int64_t count) override;
 
+    // Asks the kernel to read the range into the page cache asynchronously.
+    void will_need(int64_t offset, int64_t count) override;
+
 private:
     int _fd;
     int _errno;
     int64_t _offset;
     bool _close_on_delete;
     bool _is_closed;
+    HistogramMetric* _latency_histogram = nullptr;
 };
 
 } // namespace starrocks::io
@@ -8,32 +8,56 @@
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <fmt/format.h>
 
+#include "util/io_latency_metrics.h"
+#include "util/time.h"
+
 namespace starrocks::io {
 
 StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
+    ASSIGN_OR_RETURN(int64_t nread, read_at(_offset, out, count));
+    _offset += nread;
+    return nread;
+}
+
+StatusOr<int64_t> S3InputStream::read_at(int64_t offset, void* out, int64_t count) {
     if (UNLIKELY(_size == -1)) {
         ASSIGN_OR_RETURN(_size, S3InputStream::get_size());
     }
-    if (_offset >= _size) {
+    if (offset >= _size) {
         return 0;
     }
-    auto range = fmt::format("bytes={}-{}", _offset, std::min<int64_t>(_offset + count, _size));
+    auto range = fmt::format("bytes={}-{}", offset, std::min<int64_t>(offset + count, _size));
     Aws::S3::Model::GetObjectRequest request;
     request.SetBucket(_bucket);
     request.SetKey(_object);
     request.SetRange(std::move(range));
 
+    const int64_t start_ns = MonotonicNanos();
     Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
     if (outcome.IsSuccess()) {
         Aws::IOStream& body = outcome.GetResult().GetBody();
         body.read(static_cast<char*>(out), count);
-        _offset += body.gcount();
+        // The body is read from the connection lazily, so it's included.
+        IOLatencyMetrics::instance()->record(IOLatencyMetrics::kRemoteDisk, IOType::S3_READ,
+                                             MonotonicNanos() - start_ns);
         return body.gcount();
     } else {
         return Status::IOError(outcome.GetError().GetMessage());
     }
 }
 
+Status S3InputStream::read_at_fully(int64_t offset, void* out, int64_t count) {
+    int64_t nread = 0;
+    while (nread < count) {
+        ASSIGN_OR_RETURN(auto n, read_at(offset + nread, static_cast<char*>(out) + nread, count - nread));
+        if (n == 0) {
+            return Status::IOError("cannot read fully");
+        }
+        nread += n;
+    }
+    return Status::OK();
+}
+
 Status S3InputStream::seek(int64_t offset) {
     if (offset < 0) return Status::InvalidArgument(fmt::format("Invalid offset {}", offset));
     _offset = offset;
@@ -34,6 +34,11 @@ public:
 
     StatusOr<int64_t> read(void* data, int64_t count) override;
 
+    // Safe to call concurrently, since it doesn't touch the position of the stream.
+    StatusOr<int64_t> read_at(int64_t offset, void* data, int64_t count) override;
+
+    Status read_at_fully(int64_t offset, void* data, int64_t count) override;
+
     Status seek(int64_t offset) override;
 
     StatusOr<int64_t> position() override;
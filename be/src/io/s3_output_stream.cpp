@@ -9,6 +9,9 @@
 #include <aws/s3/model/UploadPartRequest.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "common/logging.h"
 
 namespace starrocks::io {
@@ -26,6 +29,12 @@ S3OutputStream::S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::s
     CHECK(_client != nullptr);
 }
 
+S3OutputStream::~S3OutputStream() {
+    for (auto& [part_number, outcome] : _parts_in_flight) {
+        outcome.wait();
+    }
+}
+
 Status S3OutputStream::write(const void* data, int64_t size) {
     _buffer.append(static_cast<const char*>(data), size);
     if (_upload_id.empty() && _buffer.size() > _max_single_part_size) {
@@ -68,6 +77,9 @@ Status S3OutputStream::close() {
         RETURN_IF_ERROR(singlepart_upload());
     } else {
         RETURN_IF_ERROR(multipart_upload());
+        while (!_parts_in_flight.empty()) {
+            RETURN_IF_ERROR(wait_for_part());
+        }
         RETURN_IF_ERROR(complete_multipart_upload());
     }
     _client = nullptr;
@@ -114,17 +126,32 @@ Status S3OutputStream::multipart_upload() {
     Aws::S3::Model::UploadPartRequest req;
     req.SetBucket(_bucket);
     req.SetKey(_object);
-    req.SetPartNumber(static_cast<int>(_etags.size() + 1));
+    int part_number = static_cast<int>(_etags.size() + 1);
+    req.SetPartNumber(part_number);
     req.SetUploadId(_upload_id);
     req.SetContentLength(static_cast<int64_t>(_buffer.size()));
     req.SetBody(std::make_shared<Aws::StringStream>(_buffer));
-    auto outcome = _client->UploadPart(req);
+    // The part is uploaded by the executor of the client, so that the caller can go on producing the next parts.
+    _etags.emplace_back();
+    _parts_in_flight.emplace_back(part_number, _client->UploadPartCallable(req));
+    auto max_parts_in_flight = static_cast<size_t>(std::max(1, config::experimental_s3_max_upload_parts_in_flight));
+    while (_parts_in_flight.size() > max_parts_in_flight) {
+        RETURN_IF_ERROR(wait_for_part());
+    }
+    return Status::OK();
+}
+
+Status S3OutputStream::wait_for_part() {
+    DCHECK(!_parts_in_flight.empty());
+    auto [part_number, callable] = std::move(_parts_in_flight.front());
+    _parts_in_flight.pop_front();
+    auto outcome = callable.get();
     if (outcome.IsSuccess()) {
-        _etags.push_back(outcome.GetResult().GetETag());
+        _etags[part_number - 1] = outcome.GetResult().GetETag();
         return Status::OK();
     }
-    return Status::IOError(
-            fmt::format("S3: Fail to upload part of {}/{}: {}", _bucket, _object, outcome.GetError().GetMessage()));
+    return Status::IOError(fmt::format("S3: Fail to upload part {} of {}/{}: {}", part_number, _bucket, _object,
+                                       outcome.GetError().GetMessage()));
 }
 
 Status S3OutputStream::complete_multipart_upload() {
@@ -4,6 +4,8 @@
 
 #include <aws/s3/S3Client.h>
 
+#include <deque>
+
 #include "io/output_stream.h"
 
 namespace starrocks::io {
@@ -13,7 +15,8 @@ public:
     explicit S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object,
                             int64_t max_single_part_size, int64_t min_upload_part_size);
 
-    ~S3OutputStream() override = default;
+    // Waits for the parts still being uploaded, the object isn't completed unless close() is called.
+    ~S3OutputStream() override;
 
     // Disallow copy and assignment
     S3OutputStream(const S3OutputStream&) = delete;
@@ -42,6 +45,8 @@ private:
     Status multipart_upload();
     Status singlepart_upload();
     Status complete_multipart_upload();
+    // Waits for the earliest part in flight and records its ETag.
+    Status wait_for_part();
 
     std::shared_ptr<Aws::S3::S3Client> _client;
     const Aws::String _bucket;
@@ -50,7 +55,10 @@ private:
     const int64_t _min_upload_part_size;
     Aws::String _buffer;
     Aws::String _upload_id;
+    // The ETags of the parts in the order of the part numbers, empty for the parts in flight.
     std::vector<Aws::String> _etags;
+    // The part numbers and the outcomes of the parts being uploaded.
+    std::deque<std::pair<int, Aws::S3::Model::UploadPartOutcomeCallable>> _parts_in_flight;
 };
 
 } // namespace starrocks::io
@@ -48,6 +48,10 @@ public:
     // Return the total file size in bytes, or error.
     virtual StatusOr<int64_t> get_size() = 0;
 
+    // Hints that [offset, offset + count) is going to be read soon, so the implementation may
+    // start fetching it in the background. It's only a hint, and does nothing by default.
+    virtual void will_need(int64_t offset, int64_t count) {}
+
     // Default implementation:
     // ```
     //    ASSIGN_OR_RETURN(auto pos, position());
@@ -100,6 +104,8 @@ public:
 
     StatusOr<int64_t> get_size() override { return _impl->get_size(); }
 
+    void will_need(int64_t offset, int64_t count) override { _impl->will_need(offset, count); }
+
     Status seek(int64_t offset) override { return _impl->seek(offset); }
 
 private:
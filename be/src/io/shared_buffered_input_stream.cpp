@@ -0,0 +1,130 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "io/shared_buffered_input_stream.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "util/threadpool.h"
+
+namespace starrocks::io {
+
+SharedBufferedInputStream::SharedBufferedInputStream(std::shared_ptr<SeekableInputStream> stream, int64_t max_gap,
+                                                     int64_t max_size)
+        : _stream(std::move(stream)), _max_gap(max_gap), _max_size(max_size) {}
+
+void SharedBufferedInputStream::set_io_ranges(const std::vector<IORange>& ranges) {
+    std::vector<IORange> sorted_ranges;
+    for (const auto& range : ranges) {
+        if (range.size > 0 && range.size <= _max_size) {
+            sorted_ranges.push_back(range);
+        }
+    }
+    std::sort(sorted_ranges.begin(), sorted_ranges.end(),
+              [](const IORange& lhs, const IORange& rhs) { return lhs.offset < rhs.offset; });
+
+    _coalesced_ranges.clear();
+    _buffers.clear();
+    _prefetched_bytes = 0;
+    for (const auto& range : sorted_ranges) {
+        if (!_coalesced_ranges.empty()) {
+            IORange& last = _coalesced_ranges.back();
+            const int64_t last_end = last.offset + last.size;
+            const int64_t end = std::max(last_end, range.offset + range.size);
+            if (range.offset <= last_end + _max_gap && end - last.offset <= _max_size) {
+                last.size = end - last.offset;
+                continue;
+            }
+        }
+        _coalesced_ranges.push_back(range);
+    }
+}
+
+Status SharedBufferedInputStream::prefetch(ThreadPool* pool) {
+    if (_coalesced_ranges.empty()) {
+        return Status::OK();
+    }
+    // Get the size before the concurrent reads, since the streams load it lazily.
+    ASSIGN_OR_RETURN(int64_t file_size, _stream->get_size());
+    std::vector<std::string> buffers(_coalesced_ranges.size());
+    RETURN_IF_ERROR(parallel_run(pool, _coalesced_ranges.size(), [&](size_t i) {
+        const IORange& range = _coalesced_ranges[i];
+        const int64_t size = std::min(range.size, file_size - range.offset);
+        if (size <= 0) {
+            return Status::OK();
+        }
+        buffers[i].resize(size);
+        return _stream->read_at_fully(range.offset, buffers[i].data(), size);
+    }));
+
+    _buffers = std::move(buffers);
+    _prefetched_bytes = 0;
+    for (const auto& buffer : _buffers) {
+        _prefetched_bytes += buffer.size();
+    }
+    return Status::OK();
+}
+
+const std::string* SharedBufferedInputStream::_find_buffer(int64_t offset, int64_t count,
+                                                           int64_t* buffer_offset) const {
+    if (_buffers.empty()) {
+        return nullptr;
+    }
+    auto it = std::upper_bound(_coalesced_ranges.begin(), _coalesced_ranges.end(), offset,
+                               [](int64_t offset, const IORange& range) { return offset < range.offset; });
+    if (it == _coalesced_ranges.begin()) {
+        return nullptr;
+    }
+    const size_t index = std::distance(_coalesced_ranges.begin(), it) - 1;
+    const std::string& buffer = _buffers[index];
+    const int64_t begin = _coalesced_ranges[index].offset;
+    if (offset + count > begin + static_cast<int64_t>(buffer.size())) {
+        return nullptr;
+    }
+    *buffer_offset = offset - begin;
+    return &buffer;
+}
+
+StatusOr<int64_t> SharedBufferedInputStream::read_at(int64_t offset, void* out, int64_t count) {
+    if (offset < 0 || count < 0) {
+        return Status::InvalidArgument(fmt::format("Invalid offset {} or count {}", offset, count));
+    }
+    int64_t buffer_offset = 0;
+    const std::string* buffer = _find_buffer(offset, count, &buffer_offset);
+    if (buffer == nullptr) {
+        return _stream->read_at(offset, out, count);
+    }
+    memcpy(out, buffer->data() + buffer_offset, count);
+    return count;
+}
+
+Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64_t count) {
+    if (offset < 0 || count < 0) {
+        return Status::InvalidArgument(fmt::format("Invalid offset {} or count {}", offset, count));
+    }
+    int64_t buffer_offset = 0;
+    const std::string* buffer = _find_buffer(offset, count, &buffer_offset);
+    if (buffer == nullptr) {
+        return _stream->read_at_fully(offset, out, count);
+    }
+    memcpy(out, buffer->data() + buffer_offset, count);
+    return Status::OK();
+}
+
+StatusOr<int64_t> SharedBufferedInputStream::read(void* data, int64_t count) {
+    ASSIGN_OR_RETURN(int64_t nread, read_at(_offset, data, count));
+    _offset += nread;
+    return nread;
+}
+
+Status SharedBufferedInputStream::seek(int64_t position) {
+    if (position < 0) {
+        return Status::InvalidArgument(fmt::format("Invalid offset {}", position));
+    }
+    _offset = position;
+    return Status::OK();
+}
+
+} // namespace starrocks::io
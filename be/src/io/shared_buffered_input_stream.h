@@ -0,0 +1,79 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "io/seekable_input_stream.h"
+
+namespace starrocks {
+class ThreadPool;
+}
+
+namespace starrocks::io {
+
+// SharedBufferedInputStream reads the byte ranges which are known in advance, e.g. the column chunks of a
+// parquet row group, with a few large reads instead of many small ones. The ranges not farther apart than
+// max_gap are coalesced as long as the coalesced range is not larger than max_size, and the coalesced ranges
+// are read concurrently by prefetch(). The reads inside the prefetched ranges are served from memory, and
+// all the other reads go to the underlying stream.
+//
+// A range larger than max_size is left to the readers, which read it piece by piece anyway, so the memory of
+// the prefetched ranges stays proportional to the number of the small ranges.
+class SharedBufferedInputStream final : public SeekableInputStream {
+public:
+    struct IORange {
+        int64_t offset;
+        int64_t size;
+    };
+
+    SharedBufferedInputStream(std::shared_ptr<SeekableInputStream> stream, int64_t max_gap, int64_t max_size);
+
+    ~SharedBufferedInputStream() override = default;
+
+    // Coalesce |ranges|, which may overlap and may be unordered. Must be called before prefetch().
+    void set_io_ranges(const std::vector<IORange>& ranges);
+
+    // Read the coalesced ranges concurrently in |pool| and the calling thread, or only in the calling thread
+    // if |pool| is nullptr. read_at() of the underlying stream must be safe to call concurrently.
+    Status prefetch(ThreadPool* pool);
+
+    StatusOr<int64_t> read(void* data, int64_t count) override;
+
+    StatusOr<int64_t> read_at(int64_t offset, void* out, int64_t count) override;
+
+    Status read_at_fully(int64_t offset, void* out, int64_t count) override;
+
+    Status seek(int64_t position) override;
+
+    StatusOr<int64_t> position() override { return _offset; }
+
+    StatusOr<int64_t> get_size() override { return _stream->get_size(); }
+
+    StatusOr<std::unique_ptr<NumericStatistics>> get_numeric_statistics() override {
+        return _stream->get_numeric_statistics();
+    }
+
+    // The coalesced ranges to prefetch, ordered by offset.
+    const std::vector<IORange>& coalesced_ranges() const { return _coalesced_ranges; }
+
+    int64_t prefetched_bytes() const { return _prefetched_bytes; }
+
+private:
+    // Returns the prefetched buffer containing [offset, offset + count), or nullptr.
+    const std::string* _find_buffer(int64_t offset, int64_t count, int64_t* buffer_offset) const;
+
+    std::shared_ptr<SeekableInputStream> _stream;
+    const int64_t _max_gap;
+    const int64_t _max_size;
+    int64_t _offset = 0;
+
+    std::vector<IORange> _coalesced_ranges;
+    // The contents of _coalesced_ranges, empty until prefetch() succeeds.
+    std::vector<std::string> _buffers;
+    int64_t _prefetched_bytes = 0;
+};
+
+} // namespace starrocks::io
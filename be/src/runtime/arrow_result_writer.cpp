@@ -0,0 +1,122 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/arrow_result_writer.h"
+
+#include <arrow/memory_pool.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+
+#include "column/chunk.h"
+#include "exprs/expr.h"
+#include "runtime/buffer_control_block.h"
+#include "util/arrow/row_batch.h"
+#include "util/arrow/starrocks_column_to_arrow.h"
+
+namespace starrocks {
+
+ArrowResultWriter::ArrowResultWriter(BufferControlBlock* sinker, const std::vector<ExprContext*>& output_expr_ctxs,
+                                     RuntimeProfile* parent_profile)
+        : _sinker(sinker), _output_expr_ctxs(output_expr_ctxs), _parent_profile(parent_profile) {}
+
+ArrowResultWriter::~ArrowResultWriter() = default;
+
+Status ArrowResultWriter::init(RuntimeState* state) {
+    _init_profile();
+    if (nullptr == _sinker) {
+        return Status::InternalError("sinker is NULL pointer.");
+    }
+
+    std::vector<std::shared_ptr<arrow::Field>> fields;
+    for (size_t i = 0; i < _output_expr_ctxs.size(); ++i) {
+        const TypeDescriptor& type = _output_expr_ctxs[i]->root()->type();
+        std::shared_ptr<arrow::DataType> arrow_type;
+        RETURN_IF_ERROR(convert_to_arrow_type(type, &arrow_type));
+        fields.emplace_back(arrow::field("c" + std::to_string(i), std::move(arrow_type), true));
+        _slot_types.push_back(&type);
+        _slot_ids.push_back(static_cast<SlotId>(i));
+    }
+    _arrow_schema = arrow::schema(std::move(fields));
+    return Status::OK();
+}
+
+void ArrowResultWriter::_init_profile() {
+    _append_chunk_timer = ADD_TIMER(_parent_profile, "AppendChunkTime");
+    _convert_arrow_timer = ADD_CHILD_TIMER(_parent_profile, "ArrowConvertTime", "AppendChunkTime");
+    _serialize_timer = ADD_CHILD_TIMER(_parent_profile, "ArrowSerializeTime", "AppendChunkTime");
+    _result_send_timer = ADD_CHILD_TIMER(_parent_profile, "ResultRendTime", "AppendChunkTime");
+    _sent_rows_counter = ADD_COUNTER(_parent_profile, "NumSentRows", TUnit::UNIT);
+}
+
+Status ArrowResultWriter::append_chunk(vectorized::Chunk* chunk) {
+    if (nullptr == chunk || 0 == chunk->num_rows()) {
+        return Status::OK();
+    }
+    ASSIGN_OR_RETURN(TFetchDataResultPtr result, process_chunk(chunk));
+    SCOPED_TIMER(_result_send_timer);
+    // Note: this method will delete result pointer if status is OK
+    auto* fetch_data = result.release();
+    auto status = _sinker->add_batch(fetch_data);
+    if (status.ok()) {
+        _written_rows += _num_pending_rows;
+        return status;
+    }
+    LOG(WARNING) << "append result batch to sink failed.";
+    delete fetch_data;
+    return status;
+}
+
+Status ArrowResultWriter::close() {
+    COUNTER_SET(_sent_rows_counter, _written_rows);
+    return Status::OK();
+}
+
+StatusOr<TFetchDataResultPtr> ArrowResultWriter::process_chunk(vectorized::Chunk* chunk) {
+    SCOPED_TIMER(_append_chunk_timer);
+    const size_t num_rows = chunk->num_rows();
+
+    // Step 1: compute expr
+    vectorized::Chunk result_chunk;
+    for (size_t i = 0; i < _output_expr_ctxs.size(); ++i) {
+        ASSIGN_OR_RETURN(ColumnPtr column, _output_expr_ctxs[i]->evaluate(chunk));
+        result_chunk.append_column(std::move(column), _slot_ids[i]);
+    }
+
+    // Step 2: convert chunk to arrow record batch
+    std::shared_ptr<arrow::RecordBatch> record_batch;
+    {
+        SCOPED_TIMER(_convert_arrow_timer);
+        RETURN_IF_ERROR(vectorized::convert_chunk_to_arrow_batch(&result_chunk, _slot_types, _slot_ids, _arrow_schema,
+                                                                 arrow::default_memory_pool(), &record_batch));
+    }
+
+    // Step 3: serialize record batch to arrow ipc stream
+    auto result = std::make_unique<TFetchDataResult>();
+    result->result_batch.rows.resize(1);
+    {
+        SCOPED_TIMER(_serialize_timer);
+        RETURN_IF_ERROR(serialize_record_batch(*record_batch, &result->result_batch.rows[0]));
+    }
+    _num_pending_rows = num_rows;
+    return result;
+}
+
+StatusOr<bool> ArrowResultWriter::try_add_batch(TFetchDataResultPtr& result) {
+    SCOPED_TIMER(_result_send_timer);
+    auto* fetch_data = result.release();
+    auto status = _sinker->try_add_batch(fetch_data);
+
+    if (status.ok()) {
+        if (status.value()) {
+            _written_rows += _num_pending_rows;
+        } else {
+            // the result is given back to chunk
+            result.reset(fetch_data);
+        }
+    } else {
+        delete fetch_data;
+        LOG(WARNING) << "Append result batch to sink failed: status=" << status.status().to_string();
+    }
+    return status;
+}
+
+} // namespace starrocks
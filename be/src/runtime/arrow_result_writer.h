@@ -0,0 +1,64 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include "runtime/result_writer.h"
+#include "runtime/runtime_state.h"
+
+namespace arrow {
+class Schema;
+} // namespace arrow
+
+namespace starrocks {
+
+class ExprContext;
+class BufferControlBlock;
+class RuntimeProfile;
+
+// ArrowResultWriter converts the result chunks to arrow record batches column by column, rather than to the
+// mysql text protocol row by row. Every TFetchDataResult has exactly one row, which is a self-contained
+// arrow ipc stream of one record batch, so the clients fetching the results of the fragment instances by
+// fetch_data rpc could read them in parallel without the conversion.
+// The fields of the schema are named by the position of the output expressions.
+class ArrowResultWriter final : public ResultWriter {
+public:
+    ArrowResultWriter(BufferControlBlock* sinker, const std::vector<ExprContext*>& output_expr_ctxs,
+                      RuntimeProfile* parent_profile);
+
+    ~ArrowResultWriter() override;
+
+    Status init(RuntimeState* state) override;
+
+    Status append_chunk(vectorized::Chunk* chunk) override;
+
+    Status close() override;
+
+    StatusOr<TFetchDataResultPtr> process_chunk(vectorized::Chunk* chunk) override;
+
+    StatusOr<bool> try_add_batch(TFetchDataResultPtr& result) override;
+
+private:
+    void _init_profile();
+
+    BufferControlBlock* _sinker;
+    const std::vector<ExprContext*>& _output_expr_ctxs;
+    std::shared_ptr<arrow::Schema> _arrow_schema;
+    std::vector<const TypeDescriptor*> _slot_types;
+    std::vector<SlotId> _slot_ids;
+    // The number of rows of the result returned by the last process_chunk().
+    size_t _num_pending_rows = 0;
+
+    RuntimeProfile* _parent_profile; // parent profile from result sink. not owned
+    // total time cost on append chunk operation
+    RuntimeProfile::Counter* _append_chunk_timer = nullptr;
+    // arrow convert timer, child timer of _append_chunk_timer
+    RuntimeProfile::Counter* _convert_arrow_timer = nullptr;
+    // arrow serialize timer, child timer of _append_chunk_timer
+    RuntimeProfile::Counter* _serialize_timer = nullptr;
+    // result send timer, child timer of _append_chunk_timer
+    RuntimeProfile::Counter* _result_send_timer = nullptr;
+    // number of sent rows
+    RuntimeProfile::Counter* _sent_rows_counter = nullptr;
+};
+
+} // namespace starrocks
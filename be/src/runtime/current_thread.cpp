@@ -2,10 +2,31 @@
 
 #include "runtime/current_thread.h"
 
+#include "common/compiler_util.h"
+DIAGNOSTIC_PUSH
+DIAGNOSTIC_IGNORE("-Wclass-memaccess")
+#include <bvar/bvar.h>
+DIAGNOSTIC_POP
+
 #include "storage/storage_engine.h"
 
 namespace starrocks {
 
+// Constructed on the first use, which may be in the memory hooks before the static initialization of this file.
+static bvar::Adder<int64_t>& mem_tracker_flush_adder() {
+    static auto* adder = new bvar::Adder<int64_t>("starrocks", "mem_tracker_flushes");
+    return *adder;
+}
+
+void CurrentThread::_record_flush() {
+    // bvar::Adder is combined from thread-local agents, it doesn't contend between the threads.
+    mem_tracker_flush_adder() << 1;
+}
+
+int64_t CurrentThread::mem_tracker_flushes() {
+    return mem_tracker_flush_adder().get_value();
+}
+
 CurrentThread::~CurrentThread() {
     StorageEngine* storage_engine = ExecEnv::GetInstance()->storage_engine();
     if (UNLIKELY(storage_engine != nullptr && storage_engine->bg_worker_stopped())) {
@@ -21,6 +21,9 @@
 #define SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(check) \
     auto VARNAME_LINENUM(check_setter) = CurrentThreadCheckMemLimitSetter(check)
 
+#define SCOPED_THREAD_LOCAL_PROFILING_TAG_SETTER(query_id, fragment_instance_id) \
+    auto VARNAME_LINENUM(profiling_tag_setter) = CurrentThreadProfilingTagSetter(query_id, fragment_instance_id)
+
 #define CHECK_MEM_LIMIT(err_msg)                                                     \
     do {                                                                             \
         if (tls_thread_status.check_mem_limit()) {                                   \
@@ -36,6 +39,18 @@ inline thread_local MemTracker* tls_mem_tracker = nullptr;
 inline thread_local MemTracker* tls_exceed_mem_tracker = nullptr;
 inline thread_local bool tls_is_thread_status_init = false;
 
+// The work which the thread is doing, the samples of QuerySampler are tagged by it. It's read in the signal
+// handler, so it must be constant-initialized, without the lazy initialization of thread_local objects.
+struct ThreadProfilingTag {
+    int64_t query_id_hi = 0;
+    int64_t query_id_lo = 0;
+    int64_t fragment_instance_id_hi = 0;
+    int64_t fragment_instance_id_lo = 0;
+    // The plan node whose operator is pulled or pushed by the pipeline driver, -1 if unknown.
+    int32_t plan_node_id = -1;
+};
+inline thread_local ThreadProfilingTag tls_profiling_tag;
+
 class CurrentThread {
 public:
     CurrentThread() { tls_is_thread_status_init = true; }
@@ -46,10 +61,15 @@ public:
         if (_cache_size != 0 && cur_tracker != nullptr) {
             cur_tracker->consume(_cache_size);
             _cache_size = 0;
+            _record_flush();
         }
     }
 
-    void set_query_id(const starrocks::TUniqueId& query_id) { _query_id = query_id; }
+    void set_query_id(const starrocks::TUniqueId& query_id) {
+        _query_id = query_id;
+        tls_profiling_tag.query_id_hi = query_id.hi;
+        tls_profiling_tag.query_id_lo = query_id.lo;
+    }
 
     const starrocks::TUniqueId& query_id() { return _query_id; }
 
@@ -92,6 +112,7 @@ public:
         if (cur_tracker != nullptr && _cache_size >= BATCH_SIZE) {
             cur_tracker->consume(_cache_size);
             _cache_size = 0;
+            _record_flush();
         }
     }
 
@@ -102,6 +123,7 @@ public:
             MemTracker* limit_tracker = cur_tracker->try_consume(_cache_size);
             if (LIKELY(limit_tracker == nullptr)) {
                 _cache_size = 0;
+                _record_flush();
                 return true;
             } else {
                 _cache_size -= size;
@@ -138,6 +160,7 @@ public:
         if (cur_tracker != nullptr && _cache_size <= -BATCH_SIZE) {
             cur_tracker->release(-_cache_size);
             _cache_size = 0;
+            _record_flush();
         }
     }
 
@@ -148,7 +171,14 @@ public:
         }
     }
 
+    // The number of times the cached consumption of the threads was propagated to the tracker hierarchy,
+    // each of which updates the atomic counters of all the ancestors.
+    static int64_t mem_tracker_flushes();
+
 private:
+    // Called after the cache is reset, the allocations it makes are cached.
+    static void _record_flush();
+
     const static int64_t BATCH_SIZE = 2 * 1024 * 1024;
 
     int64_t _cache_size = 0;
@@ -193,6 +223,28 @@ private:
     bool _prev_check;
 };
 
+class CurrentThreadProfilingTagSetter {
+public:
+    CurrentThreadProfilingTagSetter(const TUniqueId& query_id, const TUniqueId& fragment_instance_id)
+            : _prev_tag(tls_profiling_tag) {
+        tls_profiling_tag.query_id_hi = query_id.hi;
+        tls_profiling_tag.query_id_lo = query_id.lo;
+        tls_profiling_tag.fragment_instance_id_hi = fragment_instance_id.hi;
+        tls_profiling_tag.fragment_instance_id_lo = fragment_instance_id.lo;
+        tls_profiling_tag.plan_node_id = -1;
+    }
+
+    ~CurrentThreadProfilingTagSetter() { tls_profiling_tag = _prev_tag; }
+
+    CurrentThreadProfilingTagSetter(const CurrentThreadProfilingTagSetter&) = delete;
+    void operator=(const CurrentThreadProfilingTagSetter&) = delete;
+    CurrentThreadProfilingTagSetter(CurrentThreadProfilingTagSetter&&) = delete;
+    void operator=(CurrentThreadProfilingTagSetter&&) = delete;
+
+private:
+    ThreadProfilingTag _prev_tag;
+};
+
 class CurrentThreadCatchSetter {
 public:
     explicit CurrentThreadCatchSetter(bool catched) { _prev_catched = tls_thread_status.set_is_catched(catched); }
@@ -24,11 +24,13 @@
 #include <iostream>
 #include <utility>
 
+#include "common/tracer.h"
 #include "gen_cpp/InternalService_types.h"
 #include "gen_cpp/types.pb.h" // PUniqueId
 #include "runtime/data_stream_recvr.h"
 #include "runtime/raw_value.h"
 #include "runtime/runtime_state.h"
+#include "util/defer_op.h"
 #include "util/starrocks_metrics.h"
 
 namespace starrocks {
@@ -130,7 +132,21 @@ Status DataStreamMgr::transmit_data(const PTransmitDataParams* request, ::google
     return Status::OK();
 }
 
-Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done) {
+Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done,
+                                     PTransmitChunkResult* response) {
+    // The span of the sender is propagated if the query is traced.
+    Span span;
+    if (request.has_trace_parent()) {
+        span = Tracer::Instance().add_span("receive_chunk", Tracer::from_trace_parent(request.trace_parent()));
+        span->SetAttribute("node_id", request.node_id());
+        span->SetAttribute("sender_id", request.sender_id());
+    }
+    DeferOp end_span([&span]() {
+        if (span != nullptr) {
+            span->End();
+        }
+    });
+
     const PUniqueId& finst_id = request.finst_id();
     // TODO(zc): Use PUniqueId directly
     // We can use PUniqueId directly, because old version StarRocks has already use
@@ -147,9 +163,21 @@ Status DataStreamMgr::transmit_chunk(const PTransmitChunkParams& request, ::goog
         // in acquiring _lock.
         // TODO: Rethink the lifecycle of DataStreamRecvr to distinguish
         // errors from receiver-initiated teardowns.
+        if (response != nullptr) {
+            response->add_credit_bytes(-1);
+        }
         return Status::OK();
     }
 
+    // The credit must be set before the request is added, after which |done| may be run by the consumer.
+    if (response != nullptr) {
+        int64_t request_bytes = 0;
+        for (const auto& pchunk : request.chunks()) {
+            request_bytes += pchunk.data().size();
+        }
+        response->add_credit_bytes(recvr->credit_bytes(request_bytes));
+    }
+
     // request can only be used before calling recvr's add_batch or when request
     // is the last for the sender, because request maybe released after it's batch
     // is consumed by ExchangeNode.
@@ -85,7 +85,9 @@ public:
 
     Status transmit_data(const PTransmitDataParams* request, ::google::protobuf::Closure** done);
 
-    Status transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done);
+    // The credit granted to the sender is added to |response|, if it's not nullptr.
+    Status transmit_chunk(const PTransmitChunkParams& request, ::google::protobuf::Closure** done,
+                          PTransmitChunkResult* response = nullptr);
     // Closes all receivers registered for fragment_instance_id immediately.
     void cancel(const TUniqueId& fragment_instance_id);
 
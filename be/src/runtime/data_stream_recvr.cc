@@ -29,6 +29,8 @@
 #include <utility>
 
 #include "column/chunk.h"
+#include "exec/pipeline/fragment_context.h"
+#include "exec/pipeline/query_context.h"
 #include "exec/sort_exec_exprs.h"
 #include "gen_cpp/data.pb.h"
 #include "runtime/current_thread.h"
@@ -124,6 +126,10 @@ private:
     };
 
     Status _build_chunk_meta(const ChunkPB& pb_chunk);
+    // Wake up the blocked pipeline drivers waiting for the chunks or eos of this queue.
+    // Must be called with _lock held and when _is_cancelled is false, which guarantees that
+    // the fragment context is still alive.
+    void _notify_pipeline_drivers();
     Status _deserialize_chunk(const ChunkPB& pchunk, vectorized::Chunk* chunk, faststring* uncompressed_buffer);
 
     // Receiver of which this queue is a member.
@@ -495,6 +501,9 @@ Status DataStreamRecvr::SenderQueue::add_chunks(const PTransmitChunkParams& requ
             total_chunk_bytes += chunk_bytes;
         }
         COUNTER_UPDATE(_recvr->_bytes_received_counter, total_chunk_bytes);
+        if (_recvr->_query_ctx != nullptr) {
+            _recvr->_query_ctx->incr_network_received_bytes(total_chunk_bytes);
+        }
     }
 
     wait_timer.start();
@@ -528,6 +537,9 @@ Status DataStreamRecvr::SenderQueue::add_chunks(const PTransmitChunkParams& requ
         }
 
         _recvr->_num_buffered_bytes += total_chunk_bytes;
+        if (has_new_chunks) {
+            _notify_pipeline_drivers();
+        }
     }
     _data_arrival_cv.notify_one();
     return Status::OK();
@@ -626,6 +638,9 @@ Status DataStreamRecvr::SenderQueue::add_chunks_and_keep_order(const PTransmitCh
             total_chunk_bytes += chunk_bytes;
         }
         COUNTER_UPDATE(_recvr->_bytes_received_counter, total_chunk_bytes);
+        if (_recvr->_query_ctx != nullptr) {
+            _recvr->_query_ctx->incr_network_received_bytes(total_chunk_bytes);
+        }
     }
 
     wait_timer.start();
@@ -685,6 +700,7 @@ Status DataStreamRecvr::SenderQueue::add_chunks_and_keep_order(const PTransmitCh
         }
 
         _recvr->_num_buffered_bytes += total_chunk_bytes;
+        _notify_pipeline_drivers();
     }
     return Status::OK();
 }
@@ -737,6 +753,15 @@ void DataStreamRecvr::SenderQueue::decrement_senders(int be_number) {
               << " be_number=" << be_number;
     if (_num_remaining_senders == 0) {
         _data_arrival_cv.notify_one();
+        if (!_is_cancelled) {
+            _notify_pipeline_drivers();
+        }
+    }
+}
+
+void DataStreamRecvr::SenderQueue::_notify_pipeline_drivers() {
+    if (_recvr->_fragment_ctx != nullptr) {
+        _recvr->_fragment_ctx->notify_blocked_drivers();
     }
 }
 
@@ -860,6 +885,7 @@ DataStreamRecvr::DataStreamRecvr(DataStreamMgr* stream_mgr, RuntimeState* runtim
           _fragment_instance_id(fragment_instance_id),
           _dest_node_id(dest_node_id),
           _total_buffer_limit(total_buffer_limit),
+          _num_senders(num_senders),
           _row_desc(row_desc),
           _is_merging(is_merging),
           _num_buffered_bytes(0),
@@ -869,6 +895,8 @@ DataStreamRecvr::DataStreamRecvr(DataStreamMgr* stream_mgr, RuntimeState* runtim
           _instance_mem_tracker(runtime_state->instance_mem_tracker_ptr()),
           _sub_plan_query_statistics_recvr(std::move(sub_plan_query_statistics_recvr)),
           _is_pipeline(is_pipeline),
+          _fragment_ctx(is_pipeline ? runtime_state->fragment_ctx() : nullptr),
+          _query_ctx(is_pipeline ? runtime_state->query_ctx() : nullptr),
           _degree_of_parallelism(degree_of_parallelism),
           _keep_order(keep_order),
           _pass_through_context(pass_through_chunk_buffer, fragment_instance_id, dest_node_id) {
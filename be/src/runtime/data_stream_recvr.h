@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
 #include "common/status.h"
@@ -40,6 +42,11 @@ namespace vectorized {
 class SortedChunksMerger;
 }
 
+namespace pipeline {
+class FragmentContext;
+class QueryContext;
+} // namespace pipeline
+
 class DataStreamMgr;
 class MemTracker;
 class RuntimeProfile;
@@ -136,6 +143,13 @@ private:
     // total buffer limit.
     bool exceeds_limit(int chunk_size) { return _num_buffered_bytes + chunk_size > _total_buffer_limit; }
 
+    // Return the bytes which each sender could send more after the request of |request_bytes| is buffered,
+    // that is, the even share of the free buffer among the senders.
+    int64_t credit_bytes(int64_t request_bytes) const {
+        int64_t free_bytes = static_cast<int64_t>(_total_buffer_limit) - _num_buffered_bytes - request_bytes;
+        return std::max<int64_t>(0, free_bytes) / std::max(1, _num_senders);
+    }
+
     // DataStreamMgr instance used to create this recvr. (Not owned)
     DataStreamMgr* _mgr;
 
@@ -148,6 +162,8 @@ private:
     // exceeds this value
     int _total_buffer_limit;
 
+    int _num_senders;
+
     // Row schema, copied from the caller of CreateRecvr().
     RowDescriptor _row_desc;
 
@@ -198,6 +214,10 @@ private:
     // Sub plan query statistics receiver.
     std::shared_ptr<QueryStatisticsRecvr> _sub_plan_query_statistics_recvr;
     bool _is_pipeline;
+    // Used to wake up the blocked drivers when chunks arrive, nullptr if _is_pipeline is false.
+    pipeline::FragmentContext* _fragment_ctx;
+    // The received bytes are accounted to the query, it's nullptr for the non-pipeline engine.
+    pipeline::QueryContext* _query_ctx;
     // Invalid if _is_pipeline is false
     int32_t _degree_of_parallelism;
 
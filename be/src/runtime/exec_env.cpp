@@ -35,7 +35,9 @@
 #include "gen_cpp/FrontendService.h"
 #include "gen_cpp/HeartbeatService_types.h"
 #include "gen_cpp/TFileBrokerService.h"
+#include "formats/file_meta_cache.h"
 #include "gutil/strings/substitute.h"
+#include "io/block_cache.h"
 #include "plugin/plugin_mgr.h"
 #include "runtime/broker_mgr.h"
 #include "runtime/client_cache.h"
@@ -55,6 +57,7 @@
 #include "runtime/stream_load/stream_load_executor.h"
 #include "runtime/thread_resource_mgr.h"
 #include "storage/page_cache.h"
+#include "storage/rowset/segment_meta_cache.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_schema_map.h"
 #include "storage/update_manager.h"
@@ -173,6 +176,9 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
     _num_scan_operators = 0;
     _etl_thread_pool = new PriorityThreadPool("elt", config::etl_thread_pool_size, config::etl_thread_pool_queue_size);
     _udf_call_pool = new PriorityThreadPool("udf", config::udf_thread_pool_size, config::udf_thread_pool_size);
+    _segment_readahead_thread_pool =
+            new PriorityThreadPool("seg_readahead", config::segment_readahead_thread_pool_size,
+                                   config::segment_readahead_thread_pool_queue_size);
     _fragment_mgr = new FragmentMgr(this);
 
     std::unique_ptr<ThreadPool> driver_executor_thread_pool;
@@ -192,6 +198,34 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
 
     _driver_limiter = new pipeline::DriverLimiter(max_thread_num * config::pipeline_max_num_drivers_per_exec_thread);
 
+    if (config::pipeline_hash_join_build_thread_pool_thread_num > 0) {
+        std::unique_ptr<ThreadPool> join_build_thread_pool;
+        RETURN_IF_ERROR(ThreadPoolBuilder("join_build") // parallel build of the broadcast join hash tables
+                                .set_min_threads(0)
+                                .set_max_threads(config::pipeline_hash_join_build_thread_pool_thread_num)
+                                .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                                .build(&join_build_thread_pool));
+        _join_build_thread_pool = join_build_thread_pool.release();
+    }
+    if (config::pipeline_agg_output_thread_pool_thread_num > 0) {
+        std::unique_ptr<ThreadPool> agg_output_thread_pool;
+        RETURN_IF_ERROR(ThreadPoolBuilder("agg_output") // parallel output of the blocking aggregation hash tables
+                                .set_min_threads(0)
+                                .set_max_threads(config::pipeline_agg_output_thread_pool_thread_num)
+                                .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                                .build(&agg_output_thread_pool));
+        _agg_output_thread_pool = agg_output_thread_pool.release();
+    }
+    if (config::parquet_read_thread_pool_thread_num > 0) {
+        std::unique_ptr<ThreadPool> parquet_read_thread_pool;
+        RETURN_IF_ERROR(ThreadPoolBuilder("parquet_read") // concurrent reads of the parquet column chunks
+                                .set_min_threads(0)
+                                .set_max_threads(config::parquet_read_thread_pool_thread_num)
+                                .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                                .build(&parquet_read_thread_pool));
+        _parquet_read_thread_pool = parquet_read_thread_pool.release();
+    }
+
     std::unique_ptr<ThreadPool> wg_driver_executor_thread_pool;
     RETURN_IF_ERROR(ThreadPoolBuilder("pip_wg_executor") // pipeline executor for workgroup
                             .set_min_threads(0)
@@ -229,6 +263,7 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths) {
     _broker_mgr->init();
     _small_file_mgr->init();
     _init_mem_tracker();
+    RETURN_IF_ERROR(_init_block_cache());
 
     RETURN_IF_ERROR(_load_channel_mgr->init(_load_mem_tracker));
     _heartbeat_flags = new HeartbeatFlags();
@@ -289,6 +324,9 @@ Status ExecEnv::init_mem_tracker() {
     _load_mem_tracker = new MemTracker(MemTracker::LOAD, load_mem_limit, "load", _mem_tracker);
     // Metadata statistics memory statistics do not use new mem statistics framework with hook
     _tablet_meta_mem_tracker = new MemTracker(-1, "tablet_meta", nullptr);
+    _tablet_schema_mem_tracker = new MemTracker(-1, "tablet_schema", _tablet_meta_mem_tracker);
+    _rowset_mem_tracker = new MemTracker(-1, "rowset", _tablet_meta_mem_tracker);
+    _segment_mem_tracker = new MemTracker(-1, "segment", _tablet_meta_mem_tracker);
 
     int64_t compaction_mem_limit = calc_max_compaction_memory(_mem_tracker->limit());
     _compaction_mem_tracker = new MemTracker(compaction_mem_limit, "compaction", _mem_tracker);
@@ -304,7 +342,7 @@ Status ExecEnv::init_mem_tracker() {
 
     ChunkAllocator::init_instance(_chunk_allocator_mem_tracker, config::chunk_reserved_bytes_limit);
 
-    GlobalTabletSchemaMap::Instance()->set_mem_tracker(_tablet_meta_mem_tracker);
+    GlobalTabletSchemaMap::Instance()->set_mem_tracker(_tablet_schema_mem_tracker);
     SetMemTrackerForColumnPool op(_column_pool_mem_tracker);
     vectorized::ForEach<vectorized::ColumnPoolList>(op);
     starrocks::workgroup::DefaultWorkGroupInitialization default_workgroup_init;
@@ -326,13 +364,38 @@ Status ExecEnv::_init_mem_tracker() {
                      << config::storage_page_cache_limit << ", memory=" << MemInfo::physical_mem();
     }
     StoragePageCache::create_global_cache(_page_cache_mem_tracker, storage_cache_limit);
+    SegmentMetaCache::create_global_cache(_segment_mem_tracker, config::segment_meta_cache_capacity);
+    if (config::file_meta_cache_capacity > 0) {
+        FileMetaCache::create_global_cache(_page_cache_mem_tracker, config::file_meta_cache_capacity);
+    }
 
     // TODO(zc): The current memory usage configuration is a bit confusing,
     // we need to sort out the use of memory
     return Status::OK();
 }
 
+Status ExecEnv::_init_block_cache() {
+    if (config::block_cache_disk_capacity <= 0) {
+        return Status::OK();
+    }
+    std::vector<std::string> dirs;
+    for (const auto& path : _store_paths) {
+        if (path.storage_medium == TStorageMedium::SSD) {
+            dirs.push_back(path.path + "/block_cache");
+        }
+    }
+    if (dirs.empty()) {
+        for (const auto& path : _store_paths) {
+            dirs.push_back(path.path + "/block_cache");
+        }
+    }
+    return io::BlockCache::create_global_cache(dirs, config::block_cache_disk_capacity,
+                                               config::block_cache_block_size);
+}
+
 void ExecEnv::_destroy() {
+    io::BlockCache::release_global_cache();
+    FileMetaCache::release_global_cache();
     if (_runtime_filter_worker) {
         delete _runtime_filter_worker;
         _runtime_filter_worker = nullptr;
@@ -397,6 +460,21 @@ void ExecEnv::_destroy() {
         delete _driver_limiter;
         _driver_limiter = nullptr;
     }
+    if (_join_build_thread_pool) {
+        _join_build_thread_pool->shutdown();
+        delete _join_build_thread_pool;
+        _join_build_thread_pool = nullptr;
+    }
+    if (_agg_output_thread_pool) {
+        _agg_output_thread_pool->shutdown();
+        delete _agg_output_thread_pool;
+        _agg_output_thread_pool = nullptr;
+    }
+    if (_parquet_read_thread_pool) {
+        _parquet_read_thread_pool->shutdown();
+        delete _parquet_read_thread_pool;
+        _parquet_read_thread_pool = nullptr;
+    }
     if (_fragment_mgr) {
         delete _fragment_mgr;
         _fragment_mgr = nullptr;
@@ -409,6 +487,10 @@ void ExecEnv::_destroy() {
         delete _udf_call_pool;
         _udf_call_pool = nullptr;
     }
+    if (_segment_readahead_thread_pool) {
+        delete _segment_readahead_thread_pool;
+        _segment_readahead_thread_pool = nullptr;
+    }
     if (_pipeline_scan_io_thread_pool) {
         delete _pipeline_scan_io_thread_pool;
         _pipeline_scan_io_thread_pool = nullptr;
@@ -469,6 +551,18 @@ void ExecEnv::_destroy() {
         delete _compaction_mem_tracker;
         _compaction_mem_tracker = nullptr;
     }
+    if (_segment_mem_tracker) {
+        delete _segment_mem_tracker;
+        _segment_mem_tracker = nullptr;
+    }
+    if (_rowset_mem_tracker) {
+        delete _rowset_mem_tracker;
+        _rowset_mem_tracker = nullptr;
+    }
+    if (_tablet_schema_mem_tracker) {
+        delete _tablet_schema_mem_tracker;
+        _tablet_schema_mem_tracker = nullptr;
+    }
     if (_tablet_meta_mem_tracker) {
         delete _tablet_meta_mem_tracker;
         _tablet_meta_mem_tracker = nullptr;
@@ -116,6 +116,9 @@ public:
     MemTracker* query_pool_mem_tracker() { return _query_pool_mem_tracker; }
     MemTracker* load_mem_tracker() { return _load_mem_tracker; }
     MemTracker* tablet_meta_mem_tracker() { return _tablet_meta_mem_tracker; }
+    MemTracker* tablet_schema_mem_tracker() { return _tablet_schema_mem_tracker; }
+    MemTracker* rowset_mem_tracker() { return _rowset_mem_tracker; }
+    MemTracker* segment_mem_tracker() { return _segment_mem_tracker; }
     MemTracker* compaction_mem_tracker() { return _compaction_mem_tracker; }
     MemTracker* schema_change_mem_tracker() { return _schema_change_mem_tracker; }
     MemTracker* column_pool_mem_tracker() { return _column_pool_mem_tracker; }
@@ -134,6 +137,7 @@ public:
     size_t decrement_num_scan_operators(size_t n) { return _num_scan_operators.fetch_sub(n); }
     PriorityThreadPool* etl_thread_pool() { return _etl_thread_pool; }
     PriorityThreadPool* udf_call_pool() { return _udf_call_pool; }
+    PriorityThreadPool* segment_readahead_thread_pool() { return _segment_readahead_thread_pool; }
     FragmentMgr* fragment_mgr() { return _fragment_mgr; }
     starrocks::pipeline::DriverExecutor* driver_executor() { return _driver_executor; }
     starrocks::pipeline::DriverExecutor* wg_driver_executor() { return _wg_driver_executor; }
@@ -169,11 +173,19 @@ public:
 
     pipeline::DriverLimiter* driver_limiter() { return _driver_limiter; }
 
+    // The threads to build the hash tables of the broadcast joins in parallel, nullptr if disabled.
+    ThreadPool* join_build_thread_pool() { return _join_build_thread_pool; }
+    // The threads to output the hash tables of the blocking aggregations in parallel, nullptr if disabled.
+    ThreadPool* agg_output_thread_pool() { return _agg_output_thread_pool; }
+    // The threads to read the coalesced column chunks of the parquet files concurrently, nullptr if disabled.
+    ThreadPool* parquet_read_thread_pool() { return _parquet_read_thread_pool; }
+
 private:
     Status _init(const std::vector<StorePath>& store_paths);
     void _destroy();
 
     Status _init_mem_tracker();
+    Status _init_block_cache();
 
     std::vector<StorePath> _store_paths;
     // Leave protected so that subclasses can override
@@ -195,6 +207,11 @@ private:
 
     // The memory for tablet meta
     MemTracker* _tablet_meta_mem_tracker = nullptr;
+    // The children of _tablet_meta_mem_tracker, for the shared tablet schemas, the rowsets with their metas,
+    // and the opened segments with their footers and indexes.
+    MemTracker* _tablet_schema_mem_tracker = nullptr;
+    MemTracker* _rowset_mem_tracker = nullptr;
+    MemTracker* _segment_mem_tracker = nullptr;
 
     // The memory used for compaction
     MemTracker* _compaction_mem_tracker = nullptr;
@@ -224,11 +241,15 @@ private:
     std::atomic<size_t> _num_scan_operators;
     PriorityThreadPool* _etl_thread_pool = nullptr;
     PriorityThreadPool* _udf_call_pool = nullptr;
+    PriorityThreadPool* _segment_readahead_thread_pool = nullptr;
     FragmentMgr* _fragment_mgr = nullptr;
     starrocks::pipeline::QueryContextManager* _query_context_mgr = nullptr;
     starrocks::pipeline::DriverExecutor* _driver_executor = nullptr;
     pipeline::DriverExecutor* _wg_driver_executor = nullptr;
     pipeline::DriverLimiter* _driver_limiter;
+    ThreadPool* _join_build_thread_pool = nullptr;
+    ThreadPool* _agg_output_thread_pool = nullptr;
+    ThreadPool* _parquet_read_thread_pool = nullptr;
 
     TMasterInfo* _master_info = nullptr;
     LoadPathMgr* _load_path_mgr = nullptr;
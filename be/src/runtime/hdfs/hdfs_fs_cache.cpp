@@ -4,6 +4,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "gutil/strings/substitute.h"
 #include "util/hdfs_util.h"
 
@@ -15,6 +16,18 @@ static Status create_hdfs_fs_handle(const std::string& namenode, HdfsFsHandle* h
         handle->type = HdfsFsHandle::Type::HDFS;
         auto hdfs_builder = hdfsNewBuilder();
         hdfsBuilderSetNameNode(hdfs_builder, namenode.c_str());
+        // hdfsBuilderConfSetStr keeps the pointers of the values until connecting.
+        const std::string hedged_read_threadpool_size =
+                std::to_string(config::hdfs_client_hedged_read_threadpool_size);
+        const std::string hedged_read_threshold_millis =
+                std::to_string(config::hdfs_client_hedged_read_threshold_millis);
+        if (config::hdfs_client_enable_hedged_read) {
+            // The hedged reads are issued by the DFSClient for hdfsPread, to the DataNodes other than the slow one.
+            hdfsBuilderConfSetStr(hdfs_builder, "dfs.client.hedged.read.threadpool.size",
+                                  hedged_read_threadpool_size.c_str());
+            hdfsBuilderConfSetStr(hdfs_builder, "dfs.client.hedged.read.threshold.millis",
+                                  hedged_read_threshold_millis.c_str());
+        }
         handle->hdfs_fs = hdfsBuilderConnect(hdfs_builder);
         if (handle->hdfs_fs == nullptr) {
             return Status::InternalError(strings::Substitute("fail to connect hdfs namenode, namenode=$0, err=$1",
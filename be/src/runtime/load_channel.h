@@ -77,6 +77,8 @@ public:
 
     void remove_tablets_channel(int64_t index_id);
 
+    LoadChannelMgr* load_mgr() const { return _load_mgr; }
+
 private:
     friend class RefCountedThreadSafe<LoadChannel>;
     ~LoadChannel() = default;
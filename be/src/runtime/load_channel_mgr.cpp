@@ -68,6 +68,7 @@ LoadChannelMgr::~LoadChannelMgr() {
 
 Status LoadChannelMgr::init(MemTracker* mem_tracker) {
     _mem_tracker = mem_tracker;
+    _memory_manager = std::make_unique<LoadMemoryManager>(mem_tracker);
     RETURN_IF_ERROR(_start_bg_worker());
     return Status::OK();
 }
@@ -32,6 +32,7 @@
 #include "gen_cpp/Types_types.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "runtime/load_channel.h"
+#include "runtime/load_memory_manager.h"
 #include "runtime/tablets_channel.h"
 #include "util/blocking_queue.hpp"
 #include "util/threadpool.h"
@@ -65,6 +66,8 @@ public:
 
     scoped_refptr<LoadChannel> remove_load_channel(const UniqueId& load_id);
 
+    LoadMemoryManager* memory_manager() { return _memory_manager.get(); }
+
 private:
     Status _start_bg_worker();
 
@@ -77,6 +80,8 @@ private:
 
     // check the total load mem consumption of this Backend
     MemTracker* _mem_tracker = nullptr;
+    // schedule the flushes of the MemTables of all the loads, under the limit of |_mem_tracker|
+    std::unique_ptr<LoadMemoryManager> _memory_manager;
 
     // thread to clean timeout load channels
     std::thread _load_channels_clean_thread;
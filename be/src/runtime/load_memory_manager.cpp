@@ -0,0 +1,70 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/load_memory_manager.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "runtime/mem_tracker.h"
+#include "storage/async_delta_writer.h"
+
+namespace starrocks {
+
+void LoadMemoryManager::register_writer(vectorized::AsyncDeltaWriter* writer) {
+    std::lock_guard l(_lock);
+    _writers.insert(writer);
+}
+
+void LoadMemoryManager::unregister_writer(vectorized::AsyncDeltaWriter* writer) {
+    std::lock_guard l(_lock);
+    _writers.erase(writer);
+}
+
+void LoadMemoryManager::maybe_flush() {
+    const int64_t limit = _mem_tracker->limit();
+    if (limit <= 0) {
+        return;
+    }
+    const int64_t budget = limit * config::load_memtable_memory_percent / 100;
+    if (_mem_tracker->consumption() < budget) {
+        return;
+    }
+    // Another thread is scheduling the flushes.
+    std::unique_lock l(_lock, std::try_to_lock);
+    if (!l.owns_lock()) {
+        return;
+    }
+    std::vector<vectorized::AsyncDeltaWriter*> writers(_writers.begin(), _writers.end());
+    std::vector<int64_t> sizes;
+    sizes.reserve(writers.size());
+    for (auto* writer : writers) {
+        sizes.push_back(writer->memtable_write_buffer_size());
+    }
+    // The memory not used by the active MemTables, e.g. by the MemTables being flushed, is released by itself.
+    auto indexes = pick_memtables_to_flush(sizes, budget / 2);
+    int64_t flush_bytes = 0;
+    for (size_t i : indexes) {
+        writers[i]->flush();
+        flush_bytes += sizes[i];
+    }
+    VLOG(2) << "Flush " << indexes.size() << " of " << writers.size() << " memtables of " << flush_bytes
+            << " bytes, load memory consumption=" << _mem_tracker->consumption() << " limit=" << limit;
+}
+
+std::vector<size_t> LoadMemoryManager::pick_memtables_to_flush(const std::vector<int64_t>& sizes, int64_t target) {
+    std::vector<size_t> indexes(sizes.size());
+    std::iota(indexes.begin(), indexes.end(), 0);
+    std::sort(indexes.begin(), indexes.end(), [&sizes](size_t lhs, size_t rhs) { return sizes[lhs] > sizes[rhs]; });
+    int64_t total = std::accumulate(sizes.begin(), sizes.end(), int64_t(0));
+    size_t n = 0;
+    while (n < indexes.size() && total > target && sizes[indexes[n]] > 0) {
+        total -= sizes[indexes[n]];
+        n++;
+    }
+    indexes.resize(n);
+    return indexes;
+}
+
+} // namespace starrocks
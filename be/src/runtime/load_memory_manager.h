@@ -0,0 +1,52 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace starrocks {
+
+class MemTracker;
+
+namespace vectorized {
+class AsyncDeltaWriter;
+} // namespace vectorized
+
+// Schedule the flushes of the MemTables of all the loads on a Backend.
+//
+// Each DeltaWriter flushes its MemTable by itself once it's full. Under the memory pressure of the load
+// process, instead of the MemTable of whichever writer hits the limit however small it is, the largest
+// MemTables of all the active DeltaWriters are flushed first. So the MemTables of the small tablets can
+// grow, which makes fewer and larger segments, and less compaction afterwards.
+class LoadMemoryManager {
+public:
+    // |mem_tracker| tracks the memory of the load process.
+    explicit LoadMemoryManager(MemTracker* mem_tracker) : _mem_tracker(mem_tracker) {}
+
+    LoadMemoryManager(const LoadMemoryManager&) = delete;
+    const LoadMemoryManager& operator=(const LoadMemoryManager&) = delete;
+
+    // |writer| must be unregistered before it's destroyed.
+    void register_writer(vectorized::AsyncDeltaWriter* writer);
+
+    void unregister_writer(vectorized::AsyncDeltaWriter* writer);
+
+    // Flush the largest MemTables without waiting if the load process uses more than
+    // config::load_memtable_memory_percent of its memory limit.
+    void maybe_flush();
+
+    // Return the indexes of the largest of the MemTables of |sizes| to flush, so that the rest use no more
+    // than |target| bytes.
+    static std::vector<size_t> pick_memtables_to_flush(const std::vector<int64_t>& sizes, int64_t target);
+
+private:
+    MemTracker* _mem_tracker;
+
+    std::mutex _lock;
+    std::unordered_set<vectorized::AsyncDeltaWriter*> _writers;
+};
+
+} // namespace starrocks
@@ -11,12 +11,13 @@ namespace starrocks {
 class PassThroughSenderChannel {
 public:
     void append_chunk(const vectorized::Chunk* chunk, size_t chunk_size, int32_t driver_sequence) {
-        auto clone = chunk->clone_unique();
-        {
-            std::unique_lock lock(_mutex);
-            _buffer.emplace_back(std::make_pair(std::move(clone), driver_sequence));
-            _bytes.push_back(chunk_size);
-        }
+        append_chunk(chunk->clone_unique(), chunk_size, driver_sequence);
+    }
+
+    void append_chunk(vectorized::ChunkUniquePtr chunk, size_t chunk_size, int32_t driver_sequence) {
+        std::unique_lock lock(_mutex);
+        _buffer.emplace_back(std::make_pair(std::move(chunk), driver_sequence));
+        _bytes.push_back(chunk_size);
     }
 
     void pull_chunks(ChunkUniquePtrVector* chunks, std::vector<size_t>* bytes) {
@@ -91,6 +92,12 @@ void PassThroughContext::append_chunk(int sender_id, const vectorized::Chunk* ch
     PassThroughSenderChannel* sender_channel = _channel->get_or_create_sender_channel(sender_id);
     sender_channel->append_chunk(chunk, chunk_size, driver_sequence);
 }
+void PassThroughContext::append_chunk(int sender_id, vectorized::ChunkUniquePtr chunk, size_t chunk_size,
+                                      int32_t driver_sequence) {
+    PassThroughSenderChannel* sender_channel = _channel->get_or_create_sender_channel(sender_id);
+    sender_channel->append_chunk(std::move(chunk), chunk_size, driver_sequence);
+}
+
 void PassThroughContext::pull_chunks(int sender_id, ChunkUniquePtrVector* chunks, std::vector<size_t>* bytes) {
     PassThroughSenderChannel* sender_channel = _channel->get_or_create_sender_channel(sender_id);
     sender_channel->pull_chunks(chunks, bytes);
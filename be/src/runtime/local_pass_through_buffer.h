@@ -49,6 +49,8 @@ public:
             : _chunk_buffer(chunk_buffer), _fragment_instance_id(fragment_instance_id), _node_id(node_id) {}
     void init();
     void append_chunk(int sender_id, const vectorized::Chunk* chunk, size_t chunk_size, int32_t driver_sequence);
+    // Same as above, but take the ownership of |chunk| rather than copying it.
+    void append_chunk(int sender_id, vectorized::ChunkUniquePtr chunk, size_t chunk_size, int32_t driver_sequence);
     void pull_chunks(int sender_id, ChunkUniquePtrVector* chunks, std::vector<size_t>* bytes);
 
 private:
@@ -24,6 +24,7 @@
 #include <memory>
 #include <mutex>
 
+#include "common/config.h"
 #include "gutil/dynamic_annotations.h"
 #include "runtime/current_thread.h"
 #include "runtime/memory/chunk.h"
@@ -126,6 +127,7 @@ ChunkAllocator::ChunkAllocator(MemTracker* mem_tracker, size_t reserve_limit)
         : _mem_tracker(mem_tracker),
           _reserve_bytes_limit(reserve_limit),
           _reserved_bytes(0),
+          _numa_aware(config::pipeline_enable_numa_aware_scheduling && CpuInfo::get_max_num_numa_nodes() > 1),
           _arenas(CpuInfo::get_max_num_cores()) {
     for (auto& _arena : _arenas) {
         _arena = std::make_unique<ChunkArena>(_mem_tracker);
@@ -157,16 +159,31 @@ bool ChunkAllocator::allocate(size_t size, Chunk* chunk) {
         return ret;
     }
     if (_reserved_bytes > size) {
-        // try to allocate from other core's arena
-        ++core_id;
-        for (int i = 1; i < _arenas.size(); ++i, ++core_id) {
-            if (_arenas[core_id % _arenas.size()]->pop_free_chunk(size, &chunk->data)) {
-                _reserved_bytes.fetch_sub(size);
-                other_core_alloc_count.increment(1);
-                // reset chunk's core_id to other
-                chunk->core_id = core_id % _arenas.size();
-                ret = true;
-                return ret;
+        if (_numa_aware) {
+            // try to allocate from the arenas of the other cores in the same NUMA node only,
+            // the chunks of the remote nodes are slower to access than the ones newly allocated.
+            for (int other_core_id : CpuInfo::get_cores_of_same_numa_node(core_id)) {
+                if (other_core_id != core_id && _arenas[other_core_id]->pop_free_chunk(size, &chunk->data)) {
+                    _reserved_bytes.fetch_sub(size);
+                    other_core_alloc_count.increment(1);
+                    // reset chunk's core_id to other
+                    chunk->core_id = other_core_id;
+                    ret = true;
+                    return ret;
+                }
+            }
+        } else {
+            // try to allocate from other core's arena
+            ++core_id;
+            for (int i = 1; i < _arenas.size(); ++i, ++core_id) {
+                if (_arenas[core_id % _arenas.size()]->pop_free_chunk(size, &chunk->data)) {
+                    _reserved_bytes.fetch_sub(size);
+                    other_core_alloc_count.increment(1);
+                    // reset chunk's core_id to other
+                    chunk->core_id = core_id % _arenas.size();
+                    ret = true;
+                    return ret;
+                }
             }
         }
     }
@@ -50,6 +50,12 @@ class MemTracker;
 // ChunkArena will keep a separate free list for each chunk size. In common case, chunk will
 // be allocated from current core arena. In this case, there is no lock contention.
 //
+// NUMA Awareness
+// If pipeline_enable_numa_aware_scheduling is true on a machine with multiple NUMA nodes, the arenas of the
+// cores in a node make up the free lists of this node. A free chunk returns to the arena of the core it was
+// allocated from, and is only reused by the cores of the same node, so that a thread never gets the memory
+// of a remote node from ChunkAllocator.
+//
 // Must call CpuInfo::init() and StarRocksMetrics::instance()->initialize() to achieve good performance
 // before first object is created. And call init_instance() before use instance is called.
 class ChunkAllocator {
@@ -80,6 +86,8 @@ private:
     MemTracker* _mem_tracker = nullptr;
     size_t _reserve_bytes_limit;
     std::atomic<int64_t> _reserved_bytes;
+    // Only reuse the free chunks of the same NUMA node.
+    const bool _numa_aware;
     // each core has a ChunkArena
     std::vector<std::unique_ptr<ChunkArena>> _arenas;
 };
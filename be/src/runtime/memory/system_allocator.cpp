@@ -33,6 +33,19 @@
 namespace starrocks {
 
 #define PAGE_SIZE (4 * 1024) // 4K
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024) // 2M
+
+// Backs the large allocations with transparent huge pages to reduce the TLB misses of the random accesses,
+// e.g. hash tables. It only takes effect if THP is enabled in "madvise" or "always" mode.
+static void madvise_huge_pages(uint8_t* ptr, size_t length) {
+#ifdef MADV_HUGEPAGE
+    if (config::madvise_huge_pages && length >= HUGE_PAGE_SIZE) {
+        if (madvise(ptr, length, MADV_HUGEPAGE) != 0) {
+            LOG_FIRST_N(WARNING, 1) << "fail to madvise huge pages, errno=" << errno;
+        }
+    }
+#endif
+}
 
 uint8_t* SystemAllocator::allocate(MemTracker* mem_tracker, size_t length) {
     if (config::use_mmap_allocate_chunk) {
@@ -58,12 +71,14 @@ void SystemAllocator::free(MemTracker* mem_tracker, uint8_t* ptr, size_t length)
 
 uint8_t* SystemAllocator::allocate_via_malloc(size_t length) {
     void* ptr = nullptr;
-    // try to use a whole page instead of parts of one page
-    int res = posix_memalign(&ptr, PAGE_SIZE, length);
+    // try to use a whole page instead of parts of one page, the huge pages must be aligned to be used.
+    size_t alignment = (config::madvise_huge_pages && length >= HUGE_PAGE_SIZE) ? HUGE_PAGE_SIZE : PAGE_SIZE;
+    int res = posix_memalign(&ptr, alignment, length);
     if (res != 0) {
         PLOG(ERROR) << "fail to allocate mem via posix_memalign, res=" << res;
         return nullptr;
     }
+    madvise_huge_pages((uint8_t*)ptr, length);
     return (uint8_t*)ptr;
 }
 
@@ -73,6 +88,7 @@ uint8_t* SystemAllocator::allocate_via_mmap(MemTracker* mem_tracker, size_t leng
         PLOG(ERROR) << "fail to allocate memory via mmap";
         return nullptr;
     }
+    madvise_huge_pages(ptr, length);
     if (mem_tracker != nullptr) {
         mem_tracker->consume(length);
     }
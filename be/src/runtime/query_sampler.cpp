@@ -0,0 +1,179 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/query_sampler.h"
+
+#include <gperftools/stacktrace.h>
+#include <signal.h>
+#include <sys/time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/logging.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/current_thread.h"
+#include "util/bfd_parser.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+namespace {
+
+struct Sample {
+    int64_t fragment_instance_id_hi;
+    int64_t fragment_instance_id_lo;
+    int32_t plan_node_id;
+    int32_t depth;
+    void* pcs[QuerySampler::kMaxDepth];
+};
+
+std::mutex g_mutex;
+bool g_started = false;
+std::unique_ptr<Sample[]> g_samples;
+
+// Read by the signal handler.
+std::atomic<bool> g_running{false};
+std::atomic<int64_t> g_query_id_hi{0};
+std::atomic<int64_t> g_query_id_lo{0};
+std::atomic<size_t> g_num_samples{0};
+// The number of the signal handlers being run, stop() waits for them before reading the samples.
+std::atomic<int> g_num_running_handlers{0};
+
+} // namespace
+
+static void sample_handler(int, siginfo_t*, void*) {
+    int saved_errno = errno;
+    // Both are sequentially consistent, so a handler either is waited by stop(), or sees g_running is false.
+    g_num_running_handlers.fetch_add(1);
+    const auto& tag = tls_profiling_tag;
+    if (g_running.load() && tag.query_id_hi == g_query_id_hi.load(std::memory_order_relaxed) &&
+        tag.query_id_lo == g_query_id_lo.load(std::memory_order_relaxed)) {
+        size_t index = g_num_samples.fetch_add(1, std::memory_order_relaxed);
+        if (index < QuerySampler::kMaxSamples) {
+            Sample& sample = g_samples[index];
+            sample.fragment_instance_id_hi = tag.fragment_instance_id_hi;
+            sample.fragment_instance_id_lo = tag.fragment_instance_id_lo;
+            sample.plan_node_id = tag.plan_node_id;
+            // Skip this handler and the signal trampoline.
+            sample.depth = GetStackTrace(sample.pcs, QuerySampler::kMaxDepth, 2);
+        }
+    }
+    g_num_running_handlers.fetch_sub(1);
+    errno = saved_errno;
+}
+
+Status QuerySampler::start(const TUniqueId& query_id, int frequency) {
+    if (frequency <= 0 || frequency > 1000) {
+        return Status::InvalidArgument(strings::Substitute("invalid sampling frequency $0", frequency));
+    }
+    std::lock_guard<std::mutex> l(g_mutex);
+    if (g_started) {
+        return Status::ServiceUnavailable("another query is being sampled");
+    }
+    if (g_samples == nullptr) {
+        g_samples.reset(new Sample[kMaxSamples]);
+    }
+    g_num_samples.store(0);
+    g_query_id_hi.store(query_id.hi);
+    g_query_id_lo.store(query_id.lo);
+
+    // The handler is never uninstalled, because the default action of a pending SIGPROF delivered after
+    // stop() terminates the process. It does nothing when no query is being sampled.
+    struct sigaction action {};
+    action.sa_sigaction = sample_handler;
+    action.sa_flags = SA_RESTART | SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, nullptr) != 0) {
+        return Status::InternalError(strings::Substitute("failed to install SIGPROF handler, errno=$0", errno));
+    }
+    g_running.store(true);
+
+    struct itimerval timer {};
+    timer.it_interval.tv_usec = 1000000 / frequency;
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+        g_running.store(false);
+        return Status::InternalError(strings::Substitute("failed to set ITIMER_PROF, errno=$0", errno));
+    }
+    g_started = true;
+    return Status::OK();
+}
+
+static std::string symbolize(BfdParser* parser, void* pc, std::unordered_map<void*, std::string>* cache) {
+    auto iter = cache->find(pc);
+    if (iter != cache->end()) {
+        return iter->second;
+    }
+    char address[32];
+    snprintf(address, sizeof(address), "%lx", reinterpret_cast<uintptr_t>(pc));
+    std::string name;
+    if (parser != nullptr) {
+        const char* end = nullptr;
+        std::string file_name;
+        std::string func_name;
+        unsigned int lineno = 0;
+        if (parser->decode_address(address, &end, &file_name, &func_name, &lineno) == 0) {
+            name = std::move(func_name);
+        }
+    }
+    if (name.empty()) {
+        name = std::string("0x") + address;
+    }
+    // ';' separates the frames in the collapsed stacks.
+    std::replace(name.begin(), name.end(), ';', ':');
+    return cache->emplace(pc, std::move(name)).first->second;
+}
+
+std::string QuerySampler::stop(BfdParser* parser) {
+    std::lock_guard<std::mutex> l(g_mutex);
+    if (!g_started) {
+        return "";
+    }
+    struct itimerval timer {};
+    setitimer(ITIMER_PROF, &timer, nullptr);
+    g_running.store(false);
+    while (g_num_running_handlers.load() > 0) {
+        sched_yield();
+    }
+    g_started = false;
+
+    size_t num_samples = g_num_samples.load();
+    if (num_samples > kMaxSamples) {
+        LOG(WARNING) << "QuerySampler dropped " << num_samples - kMaxSamples << " samples";
+        num_samples = kMaxSamples;
+    }
+
+    std::unordered_map<void*, std::string> symbols;
+    std::unordered_map<std::string, int64_t> stacks;
+    for (size_t i = 0; i < num_samples; ++i) {
+        const Sample& sample = g_samples[i];
+        std::string stack = strings::Substitute(
+                "fragment_instance=$0;plan_node=$1",
+                print_id(UniqueId(sample.fragment_instance_id_hi, sample.fragment_instance_id_lo).to_thrift()),
+                sample.plan_node_id);
+        for (int j = sample.depth - 1; j >= 0; --j) {
+            stack.push_back(';');
+            stack.append(symbolize(parser, sample.pcs[j], &symbols));
+        }
+        stacks[stack]++;
+    }
+
+    std::vector<std::pair<std::string, int64_t>> sorted_stacks(stacks.begin(), stacks.end());
+    std::sort(sorted_stacks.begin(), sorted_stacks.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+    std::string result;
+    for (const auto& [stack, count] : sorted_stacks) {
+        result.append(stack);
+        result.push_back(' ');
+        result.append(std::to_string(count));
+        result.push_back('\n');
+    }
+    return result;
+}
+
+} // namespace starrocks
@@ -0,0 +1,40 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <string>
+
+#include "common/status.h"
+#include "gen_cpp/Types_types.h"
+
+namespace starrocks {
+
+class BfdParser;
+
+// QuerySampler samples the call stacks of the threads working for one query, which are tagged by
+// tls_profiling_tag, and aggregates them into collapsed stacks that can be rendered by flamegraph.pl:
+//
+//   fragment_instance=<id>;plan_node=<id>;<outermost frame>;...;<innermost frame> <count>
+//
+// The samples are taken by SIGPROF every 1/frequency second of the CPU time of the process, the signal
+// handler of the threads working for other queries only compares the query id. With the default frequency,
+// the overhead is far less than 1% of the CPU time.
+//
+// Only one sampling can run at a time, and it must not run with the gperftools CPU profiler, which also
+// uses SIGPROF.
+class QuerySampler {
+public:
+    static constexpr int kMaxDepth = 64;
+    // The samples beyond it are dropped.
+    static constexpr size_t kMaxSamples = 1 << 15;
+    static constexpr int kDefaultFrequency = 99;
+
+    // Starts to sample the threads working for |query_id|, |frequency| samples per second of CPU time.
+    static Status start(const TUniqueId& query_id, int frequency = kDefaultFrequency);
+
+    // Stops the sampling and returns the collapsed stacks ordered by the count descendingly. The frames are
+    // symbolized by |parser|, or printed as the addresses if it's nullptr.
+    static std::string stop(BfdParser* parser);
+};
+
+} // namespace starrocks
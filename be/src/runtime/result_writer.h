@@ -21,14 +21,19 @@
 
 #pragma once
 
+#include <memory>
+
 #include "column/vectorized_fwd.h"
 #include "common/status.h"
+#include "common/statusor.h"
+#include "gen_cpp/InternalService_types.h"
 #include "gen_cpp/PlanNodes_types.h"
 
 namespace starrocks {
 
 class Status;
 class RuntimeState;
+using TFetchDataResultPtr = std::unique_ptr<TFetchDataResult>;
 
 // abstract class of the result writer
 class ResultWriter {
@@ -44,6 +49,20 @@ public:
 
     virtual Status close() = 0;
 
+    // decompose append_chunk into two functions: process_chunk and try_add_batch,
+    // the former transform input chunk into TFetchDataResult, the latter add TFetchDataResult
+    // to queue whose consumers are rpc threads that invoke fetch_data rpc.
+    // They are only supported by the writers whose results are fetched by fetch_data rpc.
+    virtual StatusOr<TFetchDataResultPtr> process_chunk(vectorized::Chunk* chunk) {
+        return Status::NotSupported("process_chunk is not supported by this result writer");
+    }
+
+    // try to add result into the sinker if ResultQueue is not full and this operation is
+    // non-blocking. return true on success, false in case of that ResultQueue is full.
+    virtual StatusOr<bool> try_add_batch(TFetchDataResultPtr& result) {
+        return Status::NotSupported("try_add_batch is not supported by this result writer");
+    }
+
     int64_t get_written_rows() const { return _written_rows; }
 
 protected:
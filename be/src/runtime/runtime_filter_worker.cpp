@@ -4,6 +4,7 @@
 
 #include <random>
 
+#include "exec/pipeline/fragment_context.h"
 #include "exec/pipeline/query_context.h"
 #include "exprs/vectorized/runtime_filter_bank.h"
 #include "gen_cpp/PlanNodes_types.h"
@@ -15,6 +16,7 @@
 #include "runtime/fragment_mgr.h"
 #include "runtime/runtime_state.h"
 #include "service/backend_options.h"
+#include "util/block_compression.h"
 #include "util/brpc_stub_cache.h"
 #include "util/defer_op.h"
 #include "util/ref_count_closure.h"
@@ -52,6 +54,83 @@ static void send_rpc_runtime_filter(doris::PBackendService_Stub* stub, RuntimeFi
     rpc_closure->seq++;
 }
 
+// Sends |request| to |targets|. The targets are split into at most config::runtime_filter_forward_fanout groups, and
+// the first target of each group receives the request with the rest of the group as its forward targets, which are
+// sent to in the same way. So the filter reaches all the targets in log(fanout, #targets) hops.
+static void send_rpc_runtime_filter_to_targets(ExecEnv* env, PTransmitRuntimeFilterParams& request,
+                                               const std::vector<PTransmitRuntimeFilterForwardTarget>& targets,
+                                               int timeout_ms, const std::string& event_name) {
+    if (targets.empty()) return;
+    size_t fanout = std::max<int64_t>(config::runtime_filter_forward_fanout, 1);
+    size_t num_groups = std::min(fanout, targets.size());
+    std::vector<RuntimeFilterRpcClosure*> rpc_closures;
+    size_t begin = 0;
+    for (size_t group = 0; group < num_groups; group++) {
+        size_t end = begin + targets.size() / num_groups + (group < targets.size() % num_groups);
+        const auto& target = targets[begin];
+        TNetworkAddress addr;
+        addr.hostname = target.host();
+        addr.port = target.port();
+
+        request.clear_probe_finst_ids();
+        request.clear_forward_targets();
+        *request.mutable_probe_finst_ids() = target.probe_finst_ids();
+        for (size_t i = begin + 1; i < end; i++) {
+            *request.add_forward_targets() = targets[i];
+        }
+        if (end - begin > 1) {
+            VLOG_FILE << "send_rpc_runtime_filter_to_targets. target " << addr << " will forward to "
+                      << end - begin - 1 << " nodes. nodes[0] = " << request.forward_targets(0).DebugString();
+        }
+
+        auto* rpc_closure = new RuntimeFilterRpcClosure();
+        rpc_closure->ref();
+        doris::PBackendService_Stub* stub = env->brpc_stub_cache()->get_stub(addr);
+        env->add_rf_event({request.query_id(), request.filter_id(), addr.hostname, event_name});
+        send_rpc_runtime_filter(stub, rpc_closure, timeout_ms, request);
+        rpc_closures.emplace_back(rpc_closure);
+        begin = end;
+    }
+
+    for (auto* rpc_closure : rpc_closures) {
+        brpc::Join(rpc_closure->cntl.call_id());
+        rpc_closure->unref();
+        delete rpc_closure;
+    }
+}
+
+// Compresses the serialized runtime filter in |params| if it's large and compressible enough.
+static void compress_runtime_filter_data(PTransmitRuntimeFilterParams* params) {
+    size_t size = params->data().size();
+    if (size < config::runtime_filter_compress_bytes_threshold) return;
+    const BlockCompressionCodec* codec = nullptr;
+    if (!get_block_compression_codec(CompressionTypePB::LZ4, &codec).ok()) return;
+
+    std::string compressed(codec->max_compressed_len(size), 0);
+    Slice output(compressed.data(), compressed.size());
+    if (!codec->compress(Slice(params->data()), &output).ok()) return;
+    if (static_cast<double>(size) / output.size < config::rpc_compress_ratio_threshold) return;
+    compressed.resize(output.size);
+    params->mutable_data()->swap(compressed);
+    params->set_compress_type(CompressionTypePB::LZ4);
+    params->set_uncompressed_size(size);
+}
+
+// Gets the serialized runtime filter in |params|, which is decompressed into |buffer| if it's compressed.
+static Status get_runtime_filter_data(const PTransmitRuntimeFilterParams& params, std::string* buffer, Slice* data) {
+    if (!params.has_compress_type() || params.compress_type() == CompressionTypePB::NO_COMPRESSION) {
+        *data = Slice(params.data());
+        return Status::OK();
+    }
+    const BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(params.compress_type(), &codec));
+    buffer->resize(params.uncompressed_size());
+    Slice output(buffer->data(), buffer->size());
+    RETURN_IF_ERROR(codec->decompress(Slice(params.data()), &output));
+    *data = output;
+    return Status::OK();
+}
+
 void RuntimeFilterPort::add_listener(vectorized::RuntimeFilterProbeDescriptor* rf_desc) {
     int32_t rf_id = rf_desc->filter_id();
     if (_listeners.find(rf_id) == _listeners.end()) {
@@ -115,12 +194,21 @@ void RuntimeFilterPort::publish_runtime_filters(std::list<vectorized::RuntimeFil
 
         std::string* rf_data = params.mutable_data();
         size_t max_size = vectorized::RuntimeFilterHelper::max_runtime_filter_serialized_size(filter);
+        // the bloom filter too large is not worth shipping, and only its min/max are sent.
+        ObjectPool pool;
+        if (max_size > config::runtime_filter_max_ship_bytes) {
+            VLOG_FILE << "RuntimeFilterPort::publish_runtime_filters. ship min/max only since size too large. size = "
+                      << max_size;
+            filter = filter->create_min_max_only(&pool);
+            max_size = vectorized::RuntimeFilterHelper::max_runtime_filter_serialized_size(filter);
+        }
         rf_data->resize(max_size);
         size_t actual_size = vectorized::RuntimeFilterHelper::serialize_runtime_filter(
                 filter, reinterpret_cast<uint8_t*>(rf_data->data()));
         rf_data->resize(actual_size);
+        compress_runtime_filter_data(&params);
 
-        auto passthrough_delivery = actual_size <= config::deliver_broadcast_rf_passthrough_bytes_limit;
+        auto passthrough_delivery = params.data().size() <= config::deliver_broadcast_rf_passthrough_bytes_limit;
         if (directly_send_broadcast_grf) {
             auto sender_id =
                     std::min_element(rf_desc->broadcast_grf_senders().begin(), rf_desc->broadcast_grf_senders().end(),
@@ -176,14 +264,13 @@ Status RuntimeFilterMerger::init(const TRuntimeFilterParams& params) {
         status.expect_number = it.second;
         status.max_size = params.runtime_filter_max_size;
         status.current_size = 0;
-        status.stop = false;
+        status.min_max_only = false;
         _statuses.insert(std::make_pair(filter_id, std::move(status)));
     }
     return Status::OK();
 }
 
-void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& params,
-                                               RuntimeFilterRpcClosure* rpc_closure) {
+void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& params) {
     auto mem_tracker = get_mem_tracker(params.query_id(), params.is_pipeline());
     SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker.get());
 
@@ -209,9 +296,6 @@ void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& par
             // duplicated one, just skip it.
             return;
         }
-        if (status->stop) {
-            return;
-        }
     }
 
     int64_t now = UnixMillis();
@@ -223,22 +307,31 @@ void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& par
     // to merge runtime filters
     ObjectPool* pool = &(status->pool);
     vectorized::JoinRuntimeFilter* rf = nullptr;
-    vectorized::RuntimeFilterHelper::deserialize_runtime_filter(
-            pool, &rf, reinterpret_cast<const uint8_t*>(params.data().data()), params.data().size());
+    std::string buffer;
+    Slice data;
+    if (!get_runtime_filter_data(params, &buffer, &data).ok()) {
+        return;
+    }
+    vectorized::RuntimeFilterHelper::deserialize_runtime_filter(pool, &rf, reinterpret_cast<const uint8_t*>(data.data),
+                                                                data.size);
     if (rf == nullptr) {
         // something wrong with deserialization.
         return;
     }
 
-    // exceeds max size, stop building it.
+    // exceeds max size, only min/max of the filters are kept.
     status->current_size += rf->size();
     if (status->current_size > status->max_size) {
-        // alreay exceeds max size, no need to build it.
-        VLOG_FILE << "RuntimeFilterMerger::merge_runtime_filter. stop building since size too "
-                     "large. size = "
-                  << status->current_size;
-        status->stop = true;
-        return;
+        if (!status->min_max_only) {
+            VLOG_FILE << "RuntimeFilterMerger::merge_runtime_filter. keep min/max only since size too "
+                         "large. size = "
+                      << status->current_size;
+            status->min_max_only = true;
+            for (auto& it : status->filters) {
+                it.second = it.second->create_min_max_only(pool);
+            }
+        }
+        rf = rf->create_min_max_only(pool);
     }
 
     status->arrives.insert(be_number);
@@ -246,10 +339,10 @@ void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& par
 
     // not ready. still have to wait more filters.
     if (status->filters.size() < status->expect_number) return;
-    _send_total_runtime_filter(filter_id, rpc_closure);
+    _send_total_runtime_filter(filter_id);
 }
 
-void RuntimeFilterMerger::_send_total_runtime_filter(int32_t filter_id, RuntimeFilterRpcClosure* rpc_closure) {
+void RuntimeFilterMerger::_send_total_runtime_filter(int32_t filter_id) {
     auto status_it = _statuses.find(filter_id);
     DCHECK(status_it != _statuses.end());
     RuntimeFilterMergerStatus* status = &(status_it->second);
@@ -285,6 +378,7 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int32_t filter_id, RuntimeF
     size_t actual_size = vectorized::RuntimeFilterHelper::serialize_runtime_filter(
             out, reinterpret_cast<uint8_t*>(send_data->data()));
     send_data->resize(actual_size);
+    compress_runtime_filter_data(&request);
     int timeout_ms = config::send_rpc_runtime_filter_timeout_ms;
     if (_query_options.__isset.runtime_filter_send_timeout_ms) {
         timeout_ms = _query_options.runtime_filter_send_timeout_ms;
@@ -313,70 +407,31 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int32_t filter_id, RuntimeF
     TNetworkAddress local;
     local.hostname = BackendOptions::get_localhost();
     local.port = config::brpc_port;
-    std::vector<std::pair<TNetworkAddress, std::vector<TUniqueId>>> targets;
-
-    // put localhost to the first of targets.
-    // local -> local can be very fast
-    // but we don't want to go short-circuit because it's complicated.
-    // we have to deal with deserialization and shared runtime filter.
-    {
-        const auto it = nodes_to_frag_insts.find(local);
-        if (it != nodes_to_frag_insts.end()) {
-            targets.emplace_back(make_pair(it->first, it->second));
-        }
-    }
+    std::vector<PTransmitRuntimeFilterForwardTarget> local_targets;
+    std::vector<PTransmitRuntimeFilterForwardTarget> remote_targets;
     for (const auto& it : nodes_to_frag_insts) {
-        if (it.first != local) {
-            targets.emplace_back(make_pair(it.first, it.second));
-        }
-    }
-
-    size_t index = 0;
-    size_t size = targets.size();
-
-    while (index < size) {
-        auto& t = targets[index];
-        bool is_local = (local == t.first);
-        doris::PBackendService_Stub* stub = _exec_env->brpc_stub_cache()->get_stub(t.first);
-        request.clear_probe_finst_ids();
-        request.clear_forward_targets();
-        for (const auto& inst : t.second) {
-            PUniqueId* frag_inst_id = request.add_probe_finst_ids();
-            frag_inst_id->set_hi(inst.hi);
-            frag_inst_id->set_lo(inst.lo);
-        }
-
-        // add forward targets.
-        // forward [index+1, index+1+half) to [index]
-        size_t half = (size - index) / 2;
-        // if X->X, and we split into two half [A, B]
-        // then in next step,  X->A, and X->B, which is in-efficient
-        // so if X->X, we don't do split.
-        if (is_local) {
-            half = 0;
-        }
-        for (size_t i = 0; i < half; i++) {
-            auto& ft = targets[index + 1 + i];
-            PTransmitRuntimeFilterForwardTarget* fwd = request.add_forward_targets();
-            fwd->set_host(ft.first.hostname);
-            fwd->set_port(ft.first.port);
-            for (const auto& inst : ft.second) {
-                PUniqueId* finst_id = fwd->add_probe_finst_ids();
-                finst_id->set_hi(inst.hi);
-                finst_id->set_lo(inst.lo);
-            }
+        PTransmitRuntimeFilterForwardTarget target;
+        target.set_host(it.first.hostname);
+        target.set_port(it.first.port);
+        for (const auto& inst : it.second) {
+            PUniqueId* finst_id = target.add_probe_finst_ids();
+            finst_id->set_hi(inst.hi);
+            finst_id->set_lo(inst.lo);
         }
-
-        if (half != 0) {
-            VLOG_FILE << "RuntimeFilterMerger::merge_runtime_filter. target " << t.first << " will forward to " << half
-                      << " nodes. nodes[0] = " << request.forward_targets(0).DebugString();
+        if (it.first == local) {
+            local_targets.emplace_back(std::move(target));
+        } else {
+            remote_targets.emplace_back(std::move(target));
         }
-
-        index += (1 + half);
-        _exec_env->add_rf_event({request.query_id(), request.filter_id(), t.first.hostname, "SEND_TOTAL_RF_RPC"});
-        send_rpc_runtime_filter(stub, rpc_closure, timeout_ms, request);
     }
 
+    // send to localhost first without forward targets.
+    // local -> local can be very fast
+    // but we don't want to go short-circuit because it's complicated.
+    // we have to deal with deserialization and shared runtime filter.
+    send_rpc_runtime_filter_to_targets(_exec_env, request, local_targets, timeout_ms, "SEND_TOTAL_RF_RPC");
+    send_rpc_runtime_filter_to_targets(_exec_env, request, remote_targets, timeout_ms, "SEND_TOTAL_RF_RPC");
+
     // we don't need to hold rf any more.
     pool->clear();
 }
@@ -532,19 +587,24 @@ static inline Status receive_total_runtime_filter_pipeline(
             continue;
         }
         fragment_ctx->runtime_filter_port()->receive_shared_runtime_filter(params.filter_id(), shared_rf);
+        // The drivers waiting for this runtime filter may be unblocked.
+        fragment_ctx->notify_blocked_drivers();
     }
     return Status::OK();
 }
 
-void RuntimeFilterWorker::_receive_total_runtime_filter(PTransmitRuntimeFilterParams& request,
-                                                        RuntimeFilterRpcClosure* rpc_closure) {
+void RuntimeFilterWorker::_receive_total_runtime_filter(PTransmitRuntimeFilterParams& request) {
     auto mem_tracker = get_mem_tracker(request.query_id(), request.is_pipeline());
     SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker.get());
     // deserialize once, and all fragment instance shared that runtime filter.
     vectorized::JoinRuntimeFilter* rf = nullptr;
-    const std::string& data = request.data();
-    vectorized::RuntimeFilterHelper::deserialize_runtime_filter(
-            nullptr, &rf, reinterpret_cast<const uint8_t*>(data.data()), data.size());
+    std::string buffer;
+    Slice data;
+    if (!get_runtime_filter_data(request, &buffer, &data).ok()) {
+        return;
+    }
+    vectorized::RuntimeFilterHelper::deserialize_runtime_filter(nullptr, &rf, reinterpret_cast<const uint8_t*>(data.data),
+                                                                data.size);
     if (rf == nullptr) {
         return;
     }
@@ -558,44 +618,10 @@ void RuntimeFilterWorker::_receive_total_runtime_filter(PTransmitRuntimeFilterPa
 
     // not enough, have to forward this request to continue broadcast.
     // copy modified fields out.
-    std::vector<PTransmitRuntimeFilterForwardTarget> targets;
-    size_t size = request.forward_targets_size();
-    for (size_t i = 0; i < size; i++) {
-        const auto& fwd = request.forward_targets(i);
-        targets.emplace_back(fwd);
-    }
-
-    size_t index = 0;
-    while (index < size) {
-        auto& t = targets[index];
-        TNetworkAddress addr;
-        addr.hostname = t.host();
-        addr.port = t.port();
-        doris::PBackendService_Stub* stub = _exec_env->brpc_stub_cache()->get_stub(addr);
-
-        request.clear_probe_finst_ids();
-        request.clear_forward_targets();
-        for (size_t i = 0; i < t.probe_finst_ids_size(); i++) {
-            PUniqueId* frag_inst_id = request.add_probe_finst_ids();
-            *frag_inst_id = t.probe_finst_ids(i);
-        }
-
-        // add forward targets.
-        size_t half = (size - index) / 2;
-        for (size_t i = 0; i < half; i++) {
-            PTransmitRuntimeFilterForwardTarget* fwd = request.add_forward_targets();
-            *fwd = targets[index + 1 + i];
-        }
-
-        if (half != 0) {
-            VLOG_FILE << "RuntimeFilterWorker::receive_total_rf. target " << addr << " will forward to " << half
-                      << " nodes. nodes[0] = " << request.forward_targets(0).DebugString();
-        }
-
-        index += (1 + half);
-        _exec_env->add_rf_event({request.query_id(), request.filter_id(), addr.hostname, "FORWARD"});
-        send_rpc_runtime_filter(stub, rpc_closure, config::send_rpc_runtime_filter_timeout_ms, request);
-    }
+    std::vector<PTransmitRuntimeFilterForwardTarget> targets(request.forward_targets().begin(),
+                                                             request.forward_targets().end());
+    send_rpc_runtime_filter_to_targets(_exec_env, request, targets, config::send_rpc_runtime_filter_timeout_ms,
+                                       "FORWARD");
 }
 
 void RuntimeFilterWorker::_process_send_broadcast_runtime_filter_event(
@@ -642,34 +668,18 @@ void RuntimeFilterWorker::_deliver_broadcast_runtime_filter_relay(PTransmitRunti
                                                                   std::vector<TRuntimeFilterDestination>&& destinations,
                                                                   int timeout_ms) {
     DCHECK(!destinations.empty());
-    request.clear_probe_finst_ids();
-    request.clear_forward_targets();
-    auto first_dest = destinations[0];
-    for (const auto& id : first_dest.finstance_ids) {
-        auto* finst_id = request.add_probe_finst_ids();
-        finst_id->set_hi(id.hi);
-        finst_id->set_lo(id.lo);
-    }
-    for (auto i = 1; i < destinations.size(); ++i) {
-        auto& rest_dest = destinations[i];
-        auto* forward_target = request.add_forward_targets();
-        forward_target->set_host(rest_dest.address.hostname);
-        forward_target->set_port(rest_dest.address.port);
-        for (const auto& id : rest_dest.finstance_ids) {
-            auto* finst_id = forward_target->add_probe_finst_ids();
+    std::vector<PTransmitRuntimeFilterForwardTarget> targets;
+    for (const auto& dest : destinations) {
+        auto& target = targets.emplace_back();
+        target.set_host(dest.address.hostname);
+        target.set_port(dest.address.port);
+        for (const auto& id : dest.finstance_ids) {
+            auto* finst_id = target.add_probe_finst_ids();
             finst_id->set_hi(id.hi);
             finst_id->set_lo(id.lo);
         }
     }
-
-    auto* rpc_closure = new RuntimeFilterRpcClosure();
-    rpc_closure->ref();
-    doris::PBackendService_Stub* stub = _exec_env->brpc_stub_cache()->get_stub(first_dest.address);
-    _exec_env->add_rf_event(
-            {request.query_id(), request.filter_id(), first_dest.address.hostname, "DELIVER_BROADCAST_RF_RELAY"});
-    send_rpc_runtime_filter(stub, rpc_closure, timeout_ms, request);
-    brpc::Join(rpc_closure->cntl.call_id());
-    rpc_closure->unref();
+    send_rpc_runtime_filter_to_targets(_exec_env, request, targets, timeout_ms, "DELIVER_BROADCAST_RF_RELAY");
 }
 
 void RuntimeFilterWorker::_deliver_broadcast_runtime_filter_passthrough(
@@ -721,7 +731,7 @@ void RuntimeFilterWorker::_deliver_broadcast_runtime_filter_local(PTransmitRunti
         finst_id->set_lo(id.lo);
     }
     _exec_env->add_rf_event({param.query_id(), param.filter_id(), "", "DELIVER_BROADCAST_RF_LOCAL"});
-    _receive_total_runtime_filter(param, nullptr);
+    _receive_total_runtime_filter(param);
 }
 
 void RuntimeFilterWorker::execute() {
@@ -737,7 +747,7 @@ void RuntimeFilterWorker::execute() {
         }
         switch (ev.type) {
         case RECEIVE_TOTAL_RF: {
-            _receive_total_runtime_filter(ev.transmit_rf_request, rpc_closure);
+            _receive_total_runtime_filter(ev.transmit_rf_request);
             break;
         }
 
@@ -774,7 +784,7 @@ void RuntimeFilterWorker::execute() {
             RuntimeFilterMerger& merger = it->second;
             _exec_env->add_rf_event(
                     {ev.transmit_rf_request.query_id(), ev.transmit_rf_request.filter_id(), "", "RECV_PART_RF_RPC"});
-            merger.merge_runtime_filter(ev.transmit_rf_request, rpc_closure);
+            merger.merge_runtime_filter(ev.transmit_rf_request);
             break;
         }
 
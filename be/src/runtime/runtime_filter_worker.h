@@ -55,7 +55,7 @@ public:
               filters(std::move(other.filters)),
               current_size(other.current_size),
               max_size(other.max_size),
-              stop(other.stop),
+              min_max_only(other.min_max_only),
               recv_first_filter_ts(other.recv_first_filter_ts),
               recv_last_filter_ts(other.recv_last_filter_ts),
               broadcast_filter_ts(other.broadcast_filter_ts) {}
@@ -68,7 +68,8 @@ public:
     std::map<int32_t, vectorized::JoinRuntimeFilter*> filters;
     size_t current_size = 0;
     size_t max_size = 0;
-    bool stop = false;
+    // the filters exceed max size, and only their min/max are kept.
+    bool min_max_only = false;
 
     // statistics.
     // timestamp in ms since unix epoch;
@@ -84,10 +85,10 @@ class RuntimeFilterMerger {
 public:
     RuntimeFilterMerger(ExecEnv* env, const UniqueId& query_id, const TQueryOptions& query_options, bool is_pipeline);
     Status init(const TRuntimeFilterParams& params);
-    void merge_runtime_filter(PTransmitRuntimeFilterParams& params, RuntimeFilterRpcClosure* rpc_closure);
+    void merge_runtime_filter(PTransmitRuntimeFilterParams& params);
 
 private:
-    void _send_total_runtime_filter(int32_t filter_id, RuntimeFilterRpcClosure* rpc_closure);
+    void _send_total_runtime_filter(int32_t filter_id);
     // filter_id -> where this filter should send to
     std::map<int32_t, std::vector<TRuntimeFilterProberParams>> _targets;
     std::map<int32_t, RuntimeFilterMergerStatus> _statuses;
@@ -124,7 +125,7 @@ public:
                                        const std::vector<TRuntimeFilterDestination>& destinations, int timeout_ms);
 
 private:
-    void _receive_total_runtime_filter(PTransmitRuntimeFilterParams& params, RuntimeFilterRpcClosure* rpc_closure);
+    void _receive_total_runtime_filter(PTransmitRuntimeFilterParams& params);
     void _process_send_broadcast_runtime_filter_event(PTransmitRuntimeFilterParams&& params,
                                                       std::vector<TRuntimeFilterDestination>&& destinations,
                                                       int timeout_ms);
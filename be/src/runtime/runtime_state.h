@@ -59,7 +59,8 @@ class RuntimeFilterPort;
 
 namespace pipeline {
 class QueryContext;
-}
+class FragmentContext;
+} // namespace pipeline
 
 // A collection of items that are part of the global state of a
 // query and shared across all execution nodes of that query.
@@ -99,6 +100,9 @@ public:
     ObjectPool* global_obj_pool() const;
     void set_query_ctx(pipeline::QueryContext* ctx) { _query_ctx = ctx; }
     pipeline::QueryContext* query_ctx() { return _query_ctx; }
+    // Only set for the fragment instances executed by the pipeline engine.
+    void set_fragment_ctx(pipeline::FragmentContext* ctx) { _fragment_ctx = ctx; }
+    pipeline::FragmentContext* fragment_ctx() { return _fragment_ctx; }
     const DescriptorTbl& desc_tbl() const { return *_desc_tbl; }
     void set_desc_tbl(DescriptorTbl* desc_tbl) { _desc_tbl = desc_tbl; }
     int chunk_size() const { return _query_options.batch_size; }
@@ -388,6 +392,7 @@ private:
     vectorized::GlobalDictMaps _load_global_dicts;
 
     pipeline::QueryContext* _query_ctx = nullptr;
+    pipeline::FragmentContext* _fragment_ctx = nullptr;
 };
 
 #define LIMIT_EXCEEDED(tracker, state, msg)                                                                         \
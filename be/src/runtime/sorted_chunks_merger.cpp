@@ -3,6 +3,7 @@
 #include "runtime/sorted_chunks_merger.h"
 
 #include "exec/sort_exec_exprs.h"
+#include "exec/vectorized/sorting/merge.h"
 
 namespace starrocks::vectorized {
 
@@ -46,63 +47,30 @@ Status SortedChunksMerger::init_for_pipeline(const ChunkSuppliers& chunk_supplie
         _single_supplier = chunk_suppliers[0];
         _single_probe_supplier = chunk_probe_suppliers[0];
         _single_has_supplier = chunk_has_suppliers[0];
+        return Status::OK();
     }
 
-    _cursors.reserve(chunk_suppliers.size());
-    for (int i = 0; i < chunk_suppliers.size(); ++i) {
-        _cursors.emplace_back(std::make_unique<ChunkCursor>(chunk_suppliers[i], chunk_probe_suppliers[i],
-                                                            chunk_has_suppliers[i], sort_exprs, is_asc, is_null_first,
-                                                            _is_pipeline));
-    }
-    return Status::OK();
-}
-
-bool SortedChunksMerger::is_data_ready() {
-    if (_cursors.size() == 1) {
-        return _cursors[0]->chunk_has_supplier();
-    } else {
-        if (!_after_min_heap) {
-            for (auto& cursor : _cursors) {
-                if (!cursor->chunk_has_supplier()) {
-                    return false;
-                }
-            }
-            init_for_min_heap();
-            return true;
+    DCHECK_EQ(is_asc->size(), is_null_first->size());
+    std::vector<int> sort_order_flag(is_asc->size());
+    std::vector<int> null_first_flag(is_asc->size());
+    for (size_t i = 0; i < is_asc->size(); ++i) {
+        sort_order_flag[i] = (*is_asc)[i] ? 1 : -1;
+        if ((*is_asc)[i]) {
+            null_first_flag[i] = (*is_null_first)[i] ? -1 : 1;
         } else {
-            // if wait for data, we should probe next row;
-            // else because we have move to next row, so just test min_heap.
-            if (_wait_for_data) {
-                return _cursor->has_next() || _cursor->chunk_has_supplier();
-            } else {
-                // when _wait_for_data is false, min heap is ready to produce output.
-                // case 1: min heap is empty, EOS has arrived.
-                // case 2: min heap is not emtpy, each cursor in min heap must satisfy one of properties following:
-                //     property 1: the current chunk is the cursor is not exhausted, or
-                //     property 2: the SenderQueue of the cursor has chunks ready for processing, or
-                //     property 3: the SenderQueue of the cursor has received the EOS.
-                //
-                // so in conclusion, in such situations, min_heap is always ready.
-                return true;
-            }
+            null_first_flag[i] = (*is_null_first)[i] ? 1 : -1;
         }
     }
+    _loser_tree_merger = std::make_unique<LoserTreeMerger>(SortDescs(sort_order_flag, null_first_flag), sort_exprs,
+                                                           _state->chunk_size());
+    return _loser_tree_merger->init(chunk_probe_suppliers, chunk_has_suppliers);
 }
 
-void SortedChunksMerger::init_for_min_heap() {
-    if (_cursors.size() > 1) {
-        _min_heap.reserve(_cursors.size());
-        for (auto& cursor_ptr : _cursors) {
-            ChunkCursor* cursor = cursor_ptr.get();
-            cursor->reset_with_next_chunk_for_pipeline();
-            cursor->next_for_pipeline();
-            if (cursor->is_valid()) {
-                _min_heap.push_back(cursor);
-            }
-        }
-        std::make_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
+bool SortedChunksMerger::is_data_ready() {
+    if (_single_has_supplier) {
+        return _single_has_supplier();
     }
-    _after_min_heap = true;
+    return _loser_tree_merger->is_data_ready();
 }
 
 void SortedChunksMerger::set_profile(RuntimeProfile* profile) {
@@ -181,10 +149,6 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
 
     DCHECK(chunk != nullptr);
     *chunk = std::make_shared<Chunk>();
-    if (_min_heap.empty() && !_single_probe_supplier) {
-        *eos = true;
-        return Status::OK();
-    }
 
     // single source
     if (_single_probe_supplier) {
@@ -198,91 +162,15 @@ Status SortedChunksMerger::get_next_for_pipeline(ChunkPtr* chunk, std::atomic<bo
         return Status::OK();
     }
 
-    /*
-     * Because compute thread couldn't blocking in pipeline, and merge-sort is
-     * accept chunks from network in default, so if chunk hasn't come compute thread
-     * should exit this operator and come back when you have data.
-     * STEP 0 as the process to collect merged result.
-     * STEP 1 as the process to drive cursor move to next row then execute STEP 0.
-     * STEP 2 is almost like STEP 1 except it is executed when data is ready. 
-     * 
-     */
-    for (;;) {
-        // STEP 2:
-        // move to next row
-        if (_wait_for_data) {
-            _wait_for_data = false;
-            move_cursor_and_adjust_min_heap(eos);
-            if (_row_number >= _state->chunk_size() || _min_heap.empty()) {
-                collect_merged_chunks(chunk);
-                break;
-            }
-        }
-
-        // STEP 0:
-        // Guarantee: min_heap is keep min heap property, and it isn't empty.
-        _cursor = _min_heap[0];
-        if (!_row_number) {
-            _result_chunk = _cursor->clone_empty_chunk(_state->chunk_size());
-            _current_chunk = _cursor->get_current_chunk();
-            _selective_values.clear();
-            _selective_values.reserve(_state->chunk_size());
-            _selective_values.push_back(_cursor->get_current_position_in_chunk());
-        } else {
-            const auto& ptr = _cursor->get_current_chunk();
-            // If it is the same chunk, we just add a index for this row.
-            // else we copy These datas, and record a new chunk.
-            if (_current_chunk == ptr) {
-                _selective_values.push_back(_cursor->get_current_position_in_chunk());
-            } else {
-                _result_chunk->append_selective(*_current_chunk, _selective_values.data(), 0, _selective_values.size());
-                _current_chunk = ptr;
-                _selective_values.clear();
-                _selective_values.push_back(_cursor->get_current_position_in_chunk());
-            }
-        }
-
-        ++_row_number;
-        // we move min-element in the heap and then probe next row in cursor.
-        std::pop_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
-        _wait_for_data = true;
-
-        // probe next row.
-        if (!_cursor->has_next() && !_cursor->chunk_has_supplier()) {
-            *should_exit = true;
-            break;
-        } else {
-            // STEP 1:
-            // move to next row
-            _wait_for_data = false;
-            move_cursor_and_adjust_min_heap(eos);
-            if (_row_number >= _state->chunk_size() || _min_heap.empty()) {
-                collect_merged_chunks(chunk);
-                break;
-            }
-        }
+    // Because the chunks are transferred from network, the compute thread couldn't block for them. If no row
+    // could be merged, it exits this operator and comes back when the data is ready.
+    ASSIGN_OR_RETURN(ChunkUniquePtr merged, _loser_tree_merger->get_next());
+    if (merged != nullptr) {
+        *chunk = std::move(merged);
     }
-
+    *eos = _loser_tree_merger->is_eos();
+    *should_exit = (*chunk)->is_empty() && !*eos;
     return Status::OK();
 }
 
-void SortedChunksMerger::move_cursor_and_adjust_min_heap(std::atomic<bool>* eos) {
-    // It has next row, so we move cursor.
-    _cursor->next_for_pipeline();
-    if (_cursor->is_valid()) {
-        // we should adjust min_heap to keep min heap property.
-        std::push_heap(_min_heap.begin(), _min_heap.end(), _cursor_cmp_greater);
-    } else {
-        // just remove one source.
-        _min_heap.pop_back();
-        *eos = _min_heap.empty();
-    }
-}
-void SortedChunksMerger::collect_merged_chunks(ChunkPtr* chunk) {
-    _result_chunk->append_selective(*_current_chunk, _selective_values.data(), 0, _selective_values.size());
-    _result_chunk->set_num_rows(_row_number); // set constant column in chunk with right size.
-    (*chunk) = std::move(_result_chunk);
-    _row_number = 0;
-}
-
-} // namespace starrocks::vectorized
\ No newline at end of file
+} // namespace starrocks::vectorized
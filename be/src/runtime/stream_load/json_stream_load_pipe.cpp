@@ -0,0 +1,93 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/stream_load/json_stream_load_pipe.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace starrocks {
+
+Status JsonStreamLoadPipe::append(const char* data, size_t size) {
+    _pending.append(data, size);
+    for (; _scanned < _pending.size() && !_outer_array_closed; ++_scanned) {
+        char c = _pending[_scanned];
+        if (_in_string) {
+            if (_escaped) {
+                _escaped = false;
+            } else if (c == '\\') {
+                _escaped = true;
+            } else if (c == '"') {
+                _in_string = false;
+            }
+            continue;
+        }
+        switch (c) {
+        case '"':
+            _in_string = true;
+            break;
+        case '[':
+        case '{':
+            if (!_started) {
+                _started = true;
+                if (c == '[') {
+                    // Drop the leading spaces, so that the message can be built in place from _pending.
+                    _outer_array = true;
+                    _pending.erase(0, _scanned);
+                    _scanned = 0;
+                }
+            }
+            ++_depth;
+            break;
+        case ']':
+        case '}':
+            if (--_depth == 0) {
+                _boundary = _scanned + 1;
+                _outer_array_closed = _outer_array;
+            }
+            break;
+        case ',':
+            if (_outer_array && _depth == 1) {
+                _boundary = _scanned + 1;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    if (_boundary >= _min_message_size || _outer_array_closed) {
+        return _flush_complete_values();
+    }
+    return Status::OK();
+}
+
+Status JsonStreamLoadPipe::_flush_complete_values() {
+    if (_boundary == 0) {
+        return Status::OK();
+    }
+    if (_outer_array && !_outer_array_closed) {
+        // "[e1,...,en," is sent as "[e1,...,en]" and the '[' is kept for the next message.
+        _pending[_boundary - 1] = ']';
+        RETURN_IF_ERROR(append_and_flush(_pending.data(), _boundary));
+        _pending.erase(1, _boundary - 1);
+        _scanned -= _boundary - 1;
+    } else {
+        RETURN_IF_ERROR(append_and_flush(_pending.data(), _boundary));
+        _pending.erase(0, _boundary);
+        _scanned -= std::min(_scanned, _boundary);
+    }
+    _boundary = 0;
+    return Status::OK();
+}
+
+Status JsonStreamLoadPipe::finish() {
+    RETURN_IF_ERROR(_flush_complete_values());
+    // An incomplete value is sent as is, the scanner reports the error when parsing it.
+    auto is_not_space = [](char c) { return !std::isspace(static_cast<unsigned char>(c)); };
+    if (std::any_of(_pending.begin(), _pending.end(), is_not_space)) {
+        RETURN_IF_ERROR(append_and_flush(_pending.data(), _pending.size()));
+    }
+    _pending.clear();
+    return StreamLoadPipe::finish();
+}
+
+} // namespace starrocks
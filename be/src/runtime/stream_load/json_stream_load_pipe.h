@@ -0,0 +1,52 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <string>
+
+#include "runtime/stream_load/stream_load_pipe.h"
+
+namespace starrocks {
+
+// JsonStreamLoadPipe receives the body of a json stream load in arbitrary pieces, and cuts it into messages
+// of complete json values, so that the json scanner can parse each message read by read_one_message while
+// the rest of the body is still being received. A message holds at least min_chunk_size bytes unless it's
+// the last one, and the memory is bounded by max_buffered_bytes plus the largest single value.
+//
+// A body starting with '[' is an outer array, each message is a json array of some of its elements.
+// Otherwise, the body is a stream of json values, e.g. ndjson, each message is some of the values.
+class JsonStreamLoadPipe final : public StreamLoadPipe {
+public:
+    JsonStreamLoadPipe(size_t max_buffered_bytes = 1024 * 1024, size_t min_chunk_size = 64 * 1024)
+            : StreamLoadPipe(max_buffered_bytes, min_chunk_size), _min_message_size(min_chunk_size) {}
+
+    ~JsonStreamLoadPipe() override = default;
+
+    Status append(const char* data, size_t size) override;
+
+    Status finish() override;
+
+private:
+    // Sends _pending[0, _boundary) as a message.
+    Status _flush_complete_values();
+
+    const size_t _min_message_size;
+
+    // The received data not sent yet, starting with '[' for an outer array.
+    std::string _pending;
+    // The bytes of _pending that have been scanned.
+    size_t _scanned = 0;
+    // The end of the complete values in _pending. For an outer array, it's the end of the ',' or ']' following
+    // the last complete element.
+    size_t _boundary = 0;
+
+    int _depth = 0;
+    bool _in_string = false;
+    bool _escaped = false;
+    bool _started = false;
+    bool _outer_array = false;
+    // The data after the outer array isn't split any more.
+    bool _outer_array_closed = false;
+};
+
+} // namespace starrocks
@@ -183,6 +183,11 @@ public:
 
     std::unique_ptr<KafkaLoadInfo> kafka_info;
 
+    // set if this stream load is grouped with the others into one load transaction by
+    // GroupCommitMgr, which plans the group by |group_commit_request|
+    bool group_commit = false;
+    TStreamLoadPutRequest group_commit_request;
+
 public:
     ExecEnv* exec_env() { return _exec_env; }
 
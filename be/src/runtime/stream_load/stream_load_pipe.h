@@ -41,6 +41,14 @@ public:
     ~StreamLoadPipe() override = default;
 
     Status append_and_flush(const char* data, size_t size) {
+        if (_write_buf == nullptr) {
+            // The data is read back as one message, so it gets a buffer of its own size instead of a chunk of at
+            // least _min_chunk_size, which would waste most of the memory for the small messages.
+            ByteBufferPtr buf = ByteBuffer::allocate(size);
+            buf->put_bytes(data, size);
+            buf->flip();
+            return _append(buf);
+        }
         RETURN_IF_ERROR(append(data, size));
         if (_write_buf != nullptr) {
             ByteBufferPtr buf;
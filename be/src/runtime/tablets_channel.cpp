@@ -27,16 +27,21 @@
 #include <chrono>
 
 #include "common/closure_guard.h"
+#include "common/tracer.h"
 #include "exec/tablet_info.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/load_channel.h"
+#include "runtime/load_channel_mgr.h"
 #include "serde/protobuf_serde.h"
 #include "storage/delta_writer.h"
 #include "storage/memtable.h"
 #include "storage/storage_engine.h"
 #include "util/block_compression.h"
+#include "util/defer_op.h"
 #include "util/faststring.h"
 #include "util/starrocks_metrics.h"
+#include "util/time.h"
+#include "util/trace.h"
 
 namespace starrocks {
 
@@ -46,6 +51,7 @@ TabletsChannel::TabletsChannel(LoadChannel* load_channel, const TabletsChannelKe
         : _load_channel(load_channel),
           _key(key),
           _mem_tracker(mem_tracker),
+          _memory_manager(load_channel->load_mgr()->memory_manager()),
           _has_chunk_meta(false),
           _mem_pool(std::make_unique<MemPool>()) {
     static std::once_flag once_flag;
@@ -56,6 +62,9 @@ TabletsChannel::TabletsChannel(LoadChannel* load_channel, const TabletsChannelKe
 
 TabletsChannel::~TabletsChannel() {
     _s_tablet_writer_count -= _delta_writers.size();
+    for (auto& [_, delta_writer] : _delta_writers) {
+        _memory_manager->unregister_writer(delta_writer.get());
+    }
     delete _row_desc;
     delete _schema;
     _mem_pool.reset();
@@ -80,6 +89,19 @@ void TabletsChannel::add_chunk(brpc::Controller* cntl, const PTabletWriterAddChu
                                PTabletWriterAddBatchResult* response, google::protobuf::Closure* done) {
     ClosureGuard done_guard(done);
 
+    // The sender of an old version doesn't propagate its span, the span is added to the trace of the load then.
+    auto span = Tracer::Instance().add_span("tablets_channel_add_chunk",
+                                            request.has_trace_parent()
+                                                    ? Tracer::from_trace_parent(request.trace_parent())
+                                                    : Tracer::Instance().query_trace_context(_key.id.to_thrift()));
+    DeferOp end_span([&span]() { span->End(); });
+    if (span->IsRecording()) {
+        span->SetAttribute("index_id", _key.index_id);
+        span->SetAttribute("sender_id", request.sender_id());
+        span->SetAttribute("num_tablets", request.tablet_ids_size());
+        span->SetAttribute("eos", request.eos());
+    }
+
     auto t0 = std::chrono::steady_clock::now();
 
     if (UNLIKELY(!request.has_sender_id())) {
@@ -105,8 +127,11 @@ void TabletsChannel::add_chunk(brpc::Controller* cntl, const PTabletWriterAddChu
         return;
     }
 
+    int64_t wait_lock_time_us = 0;
     {
+        int64_t wait_start_us = MonotonicMicros();
         std::lock_guard lock(_senders[request.sender_id()].lock);
+        wait_lock_time_us += MonotonicMicros() - wait_start_us;
 
         // receive exists packet
         if (_senders[request.sender_id()].receive_sliding_window.count(request.packet_seq()) != 0) {
@@ -145,7 +170,7 @@ void TabletsChannel::add_chunk(brpc::Controller* cntl, const PTabletWriterAddChu
         }
     }
 
-    auto res = _create_write_context(request, response, done);
+    auto res = _create_write_context(cntl, request, response, done);
     if (!res.ok()) {
         res.status().to_protobuf(response->mutable_status());
         return;
@@ -193,6 +218,10 @@ void TabletsChannel::add_chunk(brpc::Controller* cntl, const PTabletWriterAddChu
     // _channel_row_idx_start_points no longer used, release it to free memory.
     context->_channel_row_idx_start_points.reset();
 
+    if (channel_size > 0) {
+        _memory_manager->maybe_flush();
+    }
+
     bool close_channel = false;
 
     // NOTE: Must close sender *AFTER* the write requests submitted, otherwise a delta writer commit request may
@@ -216,11 +245,18 @@ void TabletsChannel::add_chunk(brpc::Controller* cntl, const PTabletWriterAddChu
     // here.
     context.reset();
 
-    // This will only block the bthread, will not block the pthread
-    count_down_latch.wait();
+    TRACE("submitted the chunk to the delta writers");
+    {
+        TRACE_COUNTER_SCOPE_LATENCY_US("delta_writer_wait_us");
+        // This will only block the bthread, will not block the pthread
+        count_down_latch.wait();
+    }
+    TRACE("the delta writers finished");
 
     {
+        int64_t wait_start_us = MonotonicMicros();
         std::lock_guard lock(_senders[request.sender_id()].lock);
+        wait_lock_time_us += MonotonicMicros() - wait_start_us;
 
         _senders[request.sender_id()].success_sliding_window.insert(request.packet_seq());
         while (_senders[request.sender_id()].success_sliding_window.size() > _max_sliding_window_size / 2) {
@@ -237,7 +273,8 @@ void TabletsChannel::add_chunk(brpc::Controller* cntl, const PTabletWriterAddChu
 
     auto t1 = std::chrono::steady_clock::now();
     response->set_execution_time_us(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
-    response->set_wait_lock_time_us(0); // We didn't measure the lock wait time, just give the caller a fake time
+    response->set_wait_lock_time_us(wait_lock_time_us);
+    TRACE_COUNTER_INCREMENT("tablets_channel_lock_wait_us", wait_lock_time_us);
 
     if (close_channel) {
         _load_channel->remove_tablets_channel(_index_id);
@@ -325,10 +362,13 @@ Status TabletsChannel::_open_all_writers(const PTabletWriterOpenRequest& params)
         options.tuple_desc = _tuple_desc;
         options.slots = index_slots;
         options.global_dicts = &_global_dicts;
+        // the largest MemTables are flushed by the memory manager under memory pressure
+        options.max_buffer_size = config::load_memtable_max_buffer_size;
 
         auto res = AsyncDeltaWriter::open(options, _mem_tracker);
         RETURN_IF_ERROR(res.status());
         auto writer = std::move(res).value();
+        _memory_manager->register_writer(writer.get());
         _delta_writers.emplace(tablet.tablet_id(), std::move(writer));
         tablet_ids.emplace_back(tablet.tablet_id());
     }
@@ -348,40 +388,87 @@ void TabletsChannel::cancel() {
     }
 }
 
-Status TabletsChannel::_deserialize_chunk(const ChunkPB& pchunk, vectorized::Chunk& chunk,
+Status TabletsChannel::_deserialize_chunk(const ChunkPB& pchunk, const butil::IOBuf* attachment,
+                                          vectorized::Chunk& chunk, faststring* attachment_buffer,
                                           faststring* uncompressed_buffer) {
+    std::string_view data = pchunk.data();
+    if (pchunk.has_data_size() && attachment != nullptr && !attachment->empty()) {
+        size_t data_size = pchunk.data_size();
+        if (UNLIKELY(attachment->size() < data_size)) {
+            return Status::InternalError(
+                    fmt::format("brpc attachment size {} is less than chunk size {}", attachment->size(), data_size));
+        }
+        // Read the data in place if it's in the first block of the attachment, otherwise copy it out.
+        auto first_block = attachment->backing_block(0);
+        if (first_block.size() >= data_size) {
+            data = std::string_view(first_block.data(), data_size);
+        } else {
+            TRY_CATCH_BAD_ALLOC(attachment_buffer->resize(data_size));
+            attachment->copy_to(attachment_buffer->data(), data_size);
+            data = std::string_view(reinterpret_cast<const char*>(attachment_buffer->data()), data_size);
+        }
+    }
     if (pchunk.compress_type() == CompressionTypePB::NO_COMPRESSION) {
         TRY_CATCH_BAD_ALLOC({
             serde::ProtobufChunkDeserializer des(_chunk_meta);
-            StatusOr<vectorized::Chunk> res = des.deserialize(pchunk.data());
-            if (!res.ok()) return res.status();
-            chunk = std::move(res).value();
+            RETURN_IF_ERROR(des.deserialize(data, &chunk));
         });
     } else {
-        size_t uncompressed_size = 0;
-        {
-            const BlockCompressionCodec* codec = nullptr;
-            RETURN_IF_ERROR(get_block_compression_codec(pchunk.compress_type(), &codec));
-            uncompressed_size = pchunk.uncompressed_size();
-            TRY_CATCH_BAD_ALLOC(uncompressed_buffer->resize(uncompressed_size));
-            Slice output{uncompressed_buffer->data(), uncompressed_size};
-            RETURN_IF_ERROR(codec->decompress(pchunk.data(), &output));
-        }
-        {
-            TRY_CATCH_BAD_ALLOC({
-                std::string_view buff(reinterpret_cast<const char*>(uncompressed_buffer->data()), uncompressed_size);
-                serde::ProtobufChunkDeserializer des(_chunk_meta);
-                StatusOr<vectorized::Chunk> res = des.deserialize(buff);
-                if (!res.ok()) return res.status();
-                chunk = std::move(res).value();
-            });
-        }
+        const BlockCompressionCodec* codec = nullptr;
+        RETURN_IF_ERROR(get_block_compression_codec(pchunk.compress_type(), &codec));
+        size_t uncompressed_size = pchunk.uncompressed_size();
+        TRY_CATCH_BAD_ALLOC(uncompressed_buffer->resize(uncompressed_size));
+        Slice output{uncompressed_buffer->data(), uncompressed_size};
+        RETURN_IF_ERROR(codec->decompress(Slice(data.data(), data.size()), &output));
+        TRY_CATCH_BAD_ALLOC({
+            std::string_view buff(reinterpret_cast<const char*>(uncompressed_buffer->data()), uncompressed_size);
+            serde::ProtobufChunkDeserializer des(_chunk_meta);
+            RETURN_IF_ERROR(des.deserialize(buff, &chunk));
+        });
     }
     return Status::OK();
 }
 
+std::unique_ptr<faststring> TabletsChannel::_get_reusable_buffer() {
+    std::lock_guard l(_reusable_lock);
+    if (_reusable_buffers.empty()) {
+        return std::make_unique<faststring>();
+    }
+    auto buffer = std::move(_reusable_buffers.back());
+    _reusable_buffers.pop_back();
+    return buffer;
+}
+
+void TabletsChannel::_return_reusable_buffer(std::unique_ptr<faststring> buffer) {
+    if (buffer->capacity() > config::tablets_channel_reusable_chunk_max_bytes) {
+        return;
+    }
+    buffer->clear();
+    std::lock_guard l(_reusable_lock);
+    _reusable_buffers.emplace_back(std::move(buffer));
+}
+
+bool TabletsChannel::_get_reusable_chunk(vectorized::Chunk* chunk) {
+    std::lock_guard l(_reusable_lock);
+    if (_reusable_chunks.empty()) {
+        return false;
+    }
+    *chunk = std::move(_reusable_chunks.back());
+    _reusable_chunks.pop_back();
+    return true;
+}
+
+void TabletsChannel::_recycle_chunk(vectorized::Chunk* chunk) {
+    if (!chunk->has_columns() || chunk->memory_usage() > config::tablets_channel_reusable_chunk_max_bytes) {
+        return;
+    }
+    chunk->reset();
+    std::lock_guard l(_reusable_lock);
+    _reusable_chunks.emplace_back(std::move(*chunk));
+}
+
 StatusOr<scoped_refptr<TabletsChannel::WriteContext>> TabletsChannel::_create_write_context(
-        const PTabletWriterAddChunkRequest& request, PTabletWriterAddBatchResult* response,
+        brpc::Controller* cntl, const PTabletWriterAddChunkRequest& request, PTabletWriterAddBatchResult* response,
         google::protobuf::Closure* done) {
     if (!request.has_chunk() && !request.eos()) {
         return Status::InvalidArgument("PTabletWriterAddChunkRequest has no chunk or eos");
@@ -398,8 +485,18 @@ StatusOr<scoped_refptr<TabletsChannel::WriteContext>> TabletsChannel::_create_wr
 
     vectorized::Chunk& chunk = context->_chunk;
 
-    faststring uncompressed_buffer;
-    RETURN_IF_ERROR(_deserialize_chunk(pchunk, chunk, &uncompressed_buffer));
+    auto t0 = std::chrono::steady_clock::now();
+    response->set_reused_chunk(_get_reusable_chunk(&chunk));
+    context->_channel = this;
+    auto attachment_buffer = _get_reusable_buffer();
+    auto uncompressed_buffer = _get_reusable_buffer();
+    Status st = _deserialize_chunk(pchunk, cntl != nullptr ? &cntl->request_attachment() : nullptr, chunk,
+                                   attachment_buffer.get(), uncompressed_buffer.get());
+    _return_reusable_buffer(std::move(attachment_buffer));
+    _return_reusable_buffer(std::move(uncompressed_buffer));
+    RETURN_IF_ERROR(st);
+    auto t1 = std::chrono::steady_clock::now();
+    response->set_deserialize_time_us(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
 
     if (UNLIKELY(request.tablet_ids_size() != chunk.num_rows())) {
         return Status::InvalidArgument("request.tablet_ids_size() != chunk.num_rows()");
@@ -45,15 +45,21 @@ DIAGNOSTIC_POP
 #include "serde/protobuf_serde.h"
 #include "storage/async_delta_writer.h"
 #include "util/countdown_latch.h"
+#include "util/faststring.h"
 
 namespace brpc {
 class Controller;
 }
 
+namespace butil {
+class IOBuf;
+}
+
 namespace starrocks {
 
 class OlapTableSchemaParam;
 class LoadChannel;
+class LoadMemoryManager;
 
 struct TabletsChannelKey {
     UniqueId id;
@@ -147,12 +153,15 @@ private:
         friend class TabletsChannel;
         friend class RefCountedThreadSafe<WriteContext>;
         ~WriteContext() {
+            if (_channel != nullptr) _channel->_recycle_chunk(&_chunk);
             if (_latch) _latch->count_down();
         }
 
         mutable std::mutex _response_lock;
         PTabletWriterAddBatchResult* _response;
         BThreadCountDownLatch* _latch;
+        // set if |_chunk| is recycled to the channel when this context is destroyed
+        TabletsChannel* _channel = nullptr;
 
         vectorized::Chunk _chunk;
         std::unique_ptr<uint32_t[]> _row_indexes;
@@ -180,13 +189,24 @@ private:
 
     Status _build_chunk_meta(const ChunkPB& pb_chunk);
 
-    StatusOr<scoped_refptr<WriteContext>> _create_write_context(const PTabletWriterAddChunkRequest& request,
+    StatusOr<scoped_refptr<WriteContext>> _create_write_context(brpc::Controller* cntl,
+                                                                const PTabletWriterAddChunkRequest& request,
                                                                 PTabletWriterAddBatchResult* response,
                                                                 google::protobuf::Closure* done);
 
     int _close_sender(const int64_t* partitions, size_t partitions_size);
 
-    Status _deserialize_chunk(const ChunkPB& pchunk, vectorized::Chunk& chunk, faststring* uncompressed_buffer);
+    // Deserialize |pchunk| into |chunk|, reading its data from |attachment| if it's sent in the attachment.
+    // |attachment_buffer| holds the data copied from a fragmented attachment, and |uncompressed_buffer| holds
+    // the decompressed data.
+    Status _deserialize_chunk(const ChunkPB& pchunk, const butil::IOBuf* attachment, vectorized::Chunk& chunk,
+                              faststring* attachment_buffer, faststring* uncompressed_buffer);
+
+    std::unique_ptr<faststring> _get_reusable_buffer();
+    void _return_reusable_buffer(std::unique_ptr<faststring> buffer);
+    // Return true if a recycled chunk is moved to |chunk|.
+    bool _get_reusable_chunk(vectorized::Chunk* chunk);
+    void _recycle_chunk(vectorized::Chunk* chunk);
 
     LoadChannel* _load_channel;
 
@@ -194,6 +214,8 @@ private:
 
     MemTracker* _mem_tracker;
 
+    LoadMemoryManager* _memory_manager;
+
     // initialized in open function
     int64_t _txn_id = -1;
     int64_t _index_id = -1;
@@ -213,6 +235,12 @@ private:
     serde::ProtobufChunkMeta _chunk_meta;
     std::atomic<bool> _has_chunk_meta;
 
+    // The buffers and the chunks of the finished requests, reused to deserialize the next requests. There are
+    // no more of them than the concurrent requests to this channel.
+    std::mutex _reusable_lock;
+    std::vector<std::unique_ptr<faststring>> _reusable_buffers;
+    std::vector<vectorized::Chunk> _reusable_chunks;
+
     std::unordered_map<int64_t, uint32_t> _tablet_id_to_sorted_indexes;
     // tablet_id -> TabletChannel
     std::unordered_map<int64_t, std::unique_ptr<AsyncDeltaWriter>> _delta_writers;
@@ -22,52 +22,61 @@ int64_t ProtobufChunkSerde::max_serialized_size(const vectorized::Chunk& chunk)
 StatusOr<ChunkPB> ProtobufChunkSerde::serialize(const vectorized::Chunk& chunk) {
     StatusOr<ChunkPB> res = serialize_without_meta(chunk);
     if (!res.ok()) return res.status();
+    serialize_meta(chunk, &res.value());
+    return res;
+}
 
+void ProtobufChunkSerde::serialize_meta(const vectorized::Chunk& chunk, ChunkPB* chunk_pb) {
     const auto& slot_id_to_index = chunk.get_slot_id_to_index_map();
     const auto& tuple_id_to_index = chunk.get_tuple_id_to_index_map();
     const auto& columns = chunk.columns();
 
-    res->mutable_slot_id_map()->Reserve(static_cast<int>(slot_id_to_index.size()) * 2);
+    chunk_pb->mutable_slot_id_map()->Reserve(static_cast<int>(slot_id_to_index.size()) * 2);
     for (const auto& kv : slot_id_to_index) {
-        res->mutable_slot_id_map()->Add(kv.first);
-        res->mutable_slot_id_map()->Add(static_cast<int>(kv.second));
+        chunk_pb->mutable_slot_id_map()->Add(kv.first);
+        chunk_pb->mutable_slot_id_map()->Add(static_cast<int>(kv.second));
     }
 
-    res->mutable_tuple_id_map()->Reserve(static_cast<int>(tuple_id_to_index.size()) * 2);
+    chunk_pb->mutable_tuple_id_map()->Reserve(static_cast<int>(tuple_id_to_index.size()) * 2);
     for (const auto& kv : tuple_id_to_index) {
-        res->mutable_tuple_id_map()->Add(kv.first);
-        res->mutable_tuple_id_map()->Add(static_cast<int>(kv.second));
+        chunk_pb->mutable_tuple_id_map()->Add(kv.first);
+        chunk_pb->mutable_tuple_id_map()->Add(static_cast<int>(kv.second));
     }
 
-    res->mutable_is_nulls()->Reserve(static_cast<int>(columns.size()));
+    chunk_pb->mutable_is_nulls()->Reserve(static_cast<int>(columns.size()));
     for (const auto& column : columns) {
-        res->mutable_is_nulls()->Add(column->is_nullable());
+        chunk_pb->mutable_is_nulls()->Add(column->is_nullable());
     }
 
-    res->mutable_is_consts()->Reserve(static_cast<int>(columns.size()));
+    chunk_pb->mutable_is_consts()->Reserve(static_cast<int>(columns.size()));
     for (const auto& column : columns) {
-        res->mutable_is_consts()->Add(column->is_constant());
+        chunk_pb->mutable_is_consts()->Add(column->is_constant());
     }
 
     DCHECK_EQ(columns.size(), tuple_id_to_index.size() + slot_id_to_index.size());
-    return res;
 }
 
-StatusOr<ChunkPB> ProtobufChunkSerde::serialize_without_meta(const vectorized::Chunk& chunk) {
-    ChunkPB chunk_pb;
-    chunk_pb.set_compress_type(CompressionTypePB::NO_COMPRESSION);
-
-    std::string* serialized_data = chunk_pb.mutable_data();
-    raw::stl_string_resize_uninitialized(serialized_data, ProtobufChunkSerde::max_serialized_size(chunk));
-    auto* buff = reinterpret_cast<uint8_t*>(serialized_data->data());
+uint8_t* ProtobufChunkSerde::serialize_data(const vectorized::Chunk& chunk, uint8_t* buff) {
     encode_fixed32_le(buff + 0, 1);
     encode_fixed32_le(buff + 4, chunk.num_rows());
     buff = buff + 8;
 
     for (const auto& column : chunk.columns()) {
         buff = ColumnArraySerde::serialize(*column, buff);
-        if (UNLIKELY(buff == nullptr)) return Status::InternalError("has unsupported column");
+        if (UNLIKELY(buff == nullptr)) return nullptr;
     }
+    return buff;
+}
+
+StatusOr<ChunkPB> ProtobufChunkSerde::serialize_without_meta(const vectorized::Chunk& chunk) {
+    ChunkPB chunk_pb;
+    chunk_pb.set_compress_type(CompressionTypePB::NO_COMPRESSION);
+
+    std::string* serialized_data = chunk_pb.mutable_data();
+    raw::stl_string_resize_uninitialized(serialized_data, ProtobufChunkSerde::max_serialized_size(chunk));
+    auto* buff = reinterpret_cast<uint8_t*>(serialized_data->data());
+    buff = serialize_data(chunk, buff);
+    if (UNLIKELY(buff == nullptr)) return Status::InternalError("has unsupported column");
     chunk_pb.set_serialized_size(buff - reinterpret_cast<const uint8_t*>(serialized_data->data()));
     chunk_pb.set_uncompressed_size(serialized_data->size());
     return std::move(chunk_pb);
@@ -109,6 +118,13 @@ StatusOr<vectorized::Chunk> ProtobufChunkSerde::deserialize(const RowDescriptor&
 }
 
 StatusOr<vectorized::Chunk> ProtobufChunkDeserializer::deserialize(std::string_view buff, int64_t* deserialized_bytes) {
+    vectorized::Chunk chunk;
+    RETURN_IF_ERROR(deserialize(buff, &chunk, deserialized_bytes));
+    return std::move(chunk);
+}
+
+Status ProtobufChunkDeserializer::deserialize(std::string_view buff, vectorized::Chunk* chunk,
+                                              int64_t* deserialized_bytes) {
     using ColumnHelper = vectorized::ColumnHelper;
     using Chunk = vectorized::Chunk;
 
@@ -124,9 +140,15 @@ StatusOr<vectorized::Chunk> ProtobufChunkDeserializer::deserialize(std::string_v
     cur += 4;
 
     std::vector<vectorized::ColumnPtr> columns;
-    columns.resize(_meta.slot_id_to_index.size() + _meta.tuple_id_to_index.size());
-    for (size_t i = 0, sz = _meta.is_nulls.size(); i < sz; ++i) {
-        columns[i] = ColumnHelper::create_column(_meta.types[i], _meta.is_nulls[i], _meta.is_consts[i], rows);
+    const size_t num_columns = _meta.slot_id_to_index.size() + _meta.tuple_id_to_index.size();
+    if (chunk->num_columns() == num_columns) {
+        // the serde of the columns overwrites their contents
+        columns = chunk->columns();
+    } else {
+        columns.resize(num_columns);
+        for (size_t i = 0, sz = _meta.is_nulls.size(); i < sz; ++i) {
+            columns[i] = ColumnHelper::create_column(_meta.types[i], _meta.is_nulls[i], _meta.is_consts[i], rows);
+        }
     }
 
     for (auto& column : columns) {
@@ -139,7 +161,8 @@ StatusOr<vectorized::Chunk> ProtobufChunkDeserializer::deserialize(std::string_v
         }
     }
     if (deserialized_bytes != nullptr) *deserialized_bytes = cur - reinterpret_cast<const uint8_t*>(buff.data());
-    return Chunk(std::move(columns), _meta.slot_id_to_index, _meta.tuple_id_to_index);
+    *chunk = Chunk(std::move(columns), _meta.slot_id_to_index, _meta.tuple_id_to_index);
+    return Status::OK();
 }
 
 StatusOr<ProtobufChunkMeta> build_protobuf_chunk_meta(const RowDescriptor& row_desc, const ChunkPB& chunk_pb) {
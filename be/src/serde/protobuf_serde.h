@@ -31,6 +31,18 @@ public:
     //  - is_consts()
     static StatusOr<ChunkPB> serialize_without_meta(const vectorized::Chunk& chunk);
 
+    // Fill the following fields of |chunk_pb|, which are left unfilled by `serialize_without_meta()`:
+    //  - slot_id_map()
+    //  - tuple_id_map()
+    //  - is_nulls()
+    //  - is_consts()
+    static void serialize_meta(const vectorized::Chunk& chunk, ChunkPB* chunk_pb);
+
+    // Write the data of |chunk| to |buff|, which must have at least `max_serialized_size(chunk)` bytes.
+    // It's the same as the data of `serialize_without_meta()`, but lets the caller own the buffer.
+    // Returns the end of the written data, or nullptr if there is an unsupported column.
+    static uint8_t* serialize_data(const vectorized::Chunk& chunk, uint8_t* buff);
+
     // REQUIRE: the following fields of |chunk_pb| must be non-empty:
     //  - slot_id_map()
     //  - tuple_id_map()
@@ -53,6 +65,11 @@ public:
 
     StatusOr<vectorized::Chunk> deserialize(std::string_view buff, int64_t* deserialized_bytes = nullptr);
 
+    // Like `deserialize()` but deserialize into |chunk|. If |chunk| has the columns of the meta, e.g. it's
+    // recycled from a previous deserialization with the same meta, its columns and their buffers are reused
+    // instead of allocating new ones.
+    Status deserialize(std::string_view buff, vectorized::Chunk* chunk, int64_t* deserialized_bytes = nullptr);
+
 private:
     const ProtobufChunkMeta& _meta;
 };
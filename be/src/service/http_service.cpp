@@ -25,6 +25,7 @@
 #include "http/action/checksum_action.h"
 #include "http/action/compaction_action.h"
 #include "http/action/health_action.h"
+#include "http/action/list_query_resource_action.h"
 #include "http/action/list_workgroup_action.h"
 #include "http/action/meta_action.h"
 #include "http/action/metrics_action.h"
@@ -114,6 +115,10 @@ Status HttpService::start() {
     _ev_http_server->register_handler(HttpMethod::GET, "/pprof/pmuprofile", pmu_profile_action);
     _http_handlers.emplace_back(pmu_profile_action);
 
+    QueryProfileAction* query_profile_action = new QueryProfileAction(_env->bfd_parser());
+    _ev_http_server->register_handler(HttpMethod::GET, "/pprof/query_profile", query_profile_action);
+    _http_handlers.emplace_back(query_profile_action);
+
     ContentionAction* contention_action = new ContentionAction();
     _ev_http_server->register_handler(HttpMethod::GET, "/pprof/contention", contention_action);
     _http_handlers.emplace_back(contention_action);
@@ -177,6 +182,10 @@ Status HttpService::start() {
     _ev_http_server->register_handler(HttpMethod::POST, "/api/list_resource_groups", list_workgroup_action);
     _http_handlers.emplace_back(list_workgroup_action);
 
+    auto* list_query_resource_action = new ListQueryResourceAction(_env);
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/list_query_resources", list_query_resource_action);
+    _http_handlers.emplace_back(list_query_resource_action);
+
     RuntimeFilterCacheAction* runtime_filter_cache_action = new RuntimeFilterCacheAction(_env);
     _ev_http_server->register_handler(HttpMethod::GET, "/api/runtime_filter_cache/{action}",
                                       runtime_filter_cache_action);
@@ -21,6 +21,8 @@
 
 #include "service/internal_service.h"
 
+#include <atomic>
+
 #include "common/closure_guard.h"
 #include "common/config.h"
 #include "exec/pipeline/fragment_context.h"
@@ -36,6 +38,8 @@
 #include "runtime/routine_load/routine_load_task_executor.h"
 #include "runtime/runtime_filter_worker.h"
 #include "service/brpc.h"
+#include "util/raw_container.h"
+#include "util/slow_op_trace.h"
 #include "util/thrift_util.h"
 #include "util/uid_util.h"
 
@@ -77,10 +81,41 @@ void PInternalServiceImpl<T>::transmit_data(google::protobuf::RpcController* cnt
     }
 }
 
+// Copy the data of the chunks of |request| out of |io_buf| from |*offset|, and advance |*offset|.
+static void copy_chunk_data(const butil::IOBuf& io_buf, PTransmitChunkParams* request, size_t* offset) {
+    for (size_t i = 0; i < request->chunks().size(); ++i) {
+        auto chunk = request->mutable_chunks(i);
+        // Copy the data out of the attachment blocks directly, without zero-filling the string first.
+        raw::stl_string_resize_uninitialized(chunk->mutable_data(), chunk->data_size());
+        io_buf.copy_to(chunk->mutable_data()->data(), chunk->data_size(), *offset);
+        *offset += chunk->data_size();
+    }
+}
+
+// The closure of a batch rpc, which is shared by the requests of the batch, because each receiver may
+// hold the closure of its request until the received chunks are consumed.
+// It runs the closure of the rpc after it's run by all the requests and the rpc handler.
+class BatchClosure : public google::protobuf::Closure {
+public:
+    BatchClosure(google::protobuf::Closure* done, int32_t refs) : _done(done), _refs(refs) {}
+
+    void Run() override {
+        if (_refs.fetch_sub(1) == 1) {
+            _done->Run();
+            delete this;
+        }
+    }
+
+private:
+    google::protobuf::Closure* _done;
+    std::atomic<int32_t> _refs;
+};
+
 template <typename T>
 void PInternalServiceImpl<T>::transmit_chunk(google::protobuf::RpcController* cntl_base,
                                              const PTransmitChunkParams* request, PTransmitChunkResult* response,
                                              google::protobuf::Closure* done) {
+    SCOPED_SLOW_OP_TRACE("rpc.transmit_chunk", config::slow_rpc_trace_threshold_ms);
     VLOG_ROW << "transmit data: fragment_instance_id=" << print_id(request->finst_id())
              << " node=" << request->node_id();
     // NOTE: we should give a default value to response to avoid concurrent risk
@@ -91,17 +126,12 @@ void PInternalServiceImpl<T>::transmit_chunk(google::protobuf::RpcController* cn
     const auto receive_timestamp = GetCurrentTimeNanos();
     response->set_receive_timestamp(receive_timestamp);
     if (cntl->request_attachment().size() > 0) {
-        const butil::IOBuf& io_buf = cntl->request_attachment();
         size_t offset = 0;
-        for (size_t i = 0; i < req->chunks().size(); ++i) {
-            auto chunk = req->mutable_chunks(i);
-            io_buf.copy_to(chunk->mutable_data(), chunk->data_size(), offset);
-            offset += chunk->data_size();
-        }
+        copy_chunk_data(cntl->request_attachment(), req, &offset);
     }
     Status st;
     st.to_protobuf(response->mutable_status());
-    st = _exec_env->stream_mgr()->transmit_chunk(*request, &done);
+    st = _exec_env->stream_mgr()->transmit_chunk(*request, &done, response);
     if (!st.ok()) {
         LOG(WARNING) << "transmit_data failed, message=" << st.get_error_msg()
                      << ", fragment_instance_id=" << print_id(request->finst_id()) << ", node=" << request->node_id();
@@ -113,11 +143,53 @@ void PInternalServiceImpl<T>::transmit_chunk(google::protobuf::RpcController* cn
     }
 }
 
+template <typename T>
+void PInternalServiceImpl<T>::transmit_chunk_batch(google::protobuf::RpcController* cntl_base,
+                                                   const PTransmitChunkBatchParams* request,
+                                                   PTransmitChunkResult* response, google::protobuf::Closure* done) {
+    SCOPED_SLOW_OP_TRACE("rpc.transmit_chunk_batch", config::slow_rpc_trace_threshold_ms);
+    VLOG_ROW << "transmit data batch: num_requests=" << request->requests_size();
+    brpc::Controller* cntl = static_cast<brpc::Controller*>(cntl_base);
+    PTransmitChunkBatchParams* req = const_cast<PTransmitChunkBatchParams*>(request);
+    const auto receive_timestamp = GetCurrentTimeNanos();
+    response->set_receive_timestamp(receive_timestamp);
+    if (cntl->request_attachment().size() > 0) {
+        size_t offset = 0;
+        for (auto& sub_request : *req->mutable_requests()) {
+            copy_chunk_data(cntl->request_attachment(), &sub_request, &offset);
+        }
+    }
+    Status st;
+    st.to_protobuf(response->mutable_status());
+
+    // The extra reference is released after all the requests are handed to the receivers,
+    // so the response isn't sent while the status is still being set.
+    auto* batch_done = new BatchClosure(done, request->requests_size() + 1);
+    for (const auto& sub_request : request->requests()) {
+        google::protobuf::Closure* sub_done = batch_done;
+        Status sub_st = _exec_env->stream_mgr()->transmit_chunk(sub_request, &sub_done, response);
+        if (!sub_st.ok()) {
+            LOG(WARNING) << "transmit_data failed, message=" << sub_st.get_error_msg()
+                         << ", fragment_instance_id=" << print_id(sub_request.finst_id())
+                         << ", node=" << sub_request.node_id();
+            if (st.ok()) {
+                st = sub_st;
+                st.to_protobuf(response->mutable_status());
+            }
+        }
+        if (sub_done != nullptr) {
+            sub_done->Run();
+        }
+    }
+    batch_done->Run();
+}
+
 template <typename T>
 void PInternalServiceImpl<T>::transmit_runtime_filter(google::protobuf::RpcController* cntl_base,
                                                       const PTransmitRuntimeFilterParams* request,
                                                       PTransmitRuntimeFilterResult* response,
                                                       google::protobuf::Closure* done) {
+    SCOPED_SLOW_OP_TRACE("rpc.transmit_runtime_filter", config::slow_rpc_trace_threshold_ms);
     VLOG_FILE << "transmit runtime filter: fragment_instance_id=" << print_id(request->finst_id())
               << " query_id=" << print_id(request->query_id()) << ", is_partial=" << request->is_partial()
               << ", filter_id=" << request->filter_id() << ", is_pipeline=" << request->is_pipeline();
@@ -131,6 +203,7 @@ template <typename T>
 void PInternalServiceImpl<T>::tablet_writer_open(google::protobuf::RpcController* cntl_base,
                                                  const PTabletWriterOpenRequest* request,
                                                  PTabletWriterOpenResult* response, google::protobuf::Closure* done) {
+    SCOPED_SLOW_OP_TRACE("rpc.tablet_writer_open", config::slow_rpc_trace_threshold_ms);
     VLOG_RPC << "tablet writer open, id=" << print_id(request->id()) << ", index_id=" << request->index_id()
              << ", txn_id=" << request->txn_id();
     _exec_env->load_channel_mgr()->open(static_cast<brpc::Controller*>(cntl_base), *request, response, done);
@@ -140,6 +213,7 @@ template <typename T>
 void PInternalServiceImpl<T>::exec_plan_fragment(google::protobuf::RpcController* cntl_base,
                                                  const PExecPlanFragmentRequest* request,
                                                  PExecPlanFragmentResult* response, google::protobuf::Closure* done) {
+    SCOPED_SLOW_OP_TRACE("rpc.exec_plan_fragment", config::slow_rpc_trace_threshold_ms);
     ClosureGuard closure_guard(done);
     brpc::Controller* cntl = static_cast<brpc::Controller*>(cntl_base);
     auto st = _exec_plan_fragment(cntl);
@@ -163,6 +237,7 @@ void PInternalServiceImpl<T>::tablet_writer_add_chunk(google::protobuf::RpcContr
                                                       const PTabletWriterAddChunkRequest* request,
                                                       PTabletWriterAddBatchResult* response,
                                                       google::protobuf::Closure* done) {
+    SCOPED_SLOW_OP_TRACE("rpc.tablet_writer_add_chunk", config::slow_rpc_trace_threshold_ms);
     VLOG_RPC << "tablet writer add chunk, id=" << print_id(request->id()) << ", index_id=" << request->index_id()
              << ", sender_id=" << request->sender_id();
     _exec_env->load_channel_mgr()->add_chunk(static_cast<brpc::Controller*>(cntl_base), *request, response, done);
@@ -173,6 +248,7 @@ void PInternalServiceImpl<T>::tablet_writer_cancel(google::protobuf::RpcControll
                                                    const PTabletWriterCancelRequest* request,
                                                    PTabletWriterCancelResult* response,
                                                    google::protobuf::Closure* done) {
+    SCOPED_SLOW_OP_TRACE("rpc.tablet_writer_cancel", config::slow_rpc_trace_threshold_ms);
     VLOG_RPC << "tablet writer cancel, id=" << print_id(request->id()) << ", index_id=" << request->index_id()
              << ", sender_id=" << request->sender_id();
     _exec_env->load_channel_mgr()->cancel(static_cast<brpc::Controller*>(cntl_base), *request, response, done);
@@ -187,6 +263,7 @@ Status PInternalServiceImpl<T>::_exec_plan_fragment(brpc::Controller* cntl) {
         uint32_t len = ser_request.size();
         RETURN_IF_ERROR(deserialize_thrift_msg(buf, &len, TProtocolType::BINARY, &t_request));
     }
+    TRACE("deserialized the request");
     bool is_pipeline = t_request.__isset.is_pipeline && t_request.is_pipeline;
     LOG(INFO) << "exec plan fragment, fragment_instance_id=" << print_id(t_request.params.fragment_instance_id)
               << ", coord=" << t_request.coord << ", backend=" << t_request.backend_num
@@ -194,6 +271,7 @@ Status PInternalServiceImpl<T>::_exec_plan_fragment(brpc::Controller* cntl) {
     if (is_pipeline) {
         auto fragment_executor = std::make_unique<starrocks::pipeline::FragmentExecutor>();
         auto status = fragment_executor->prepare(_exec_env, t_request);
+        TRACE("prepared the fragment instance");
         if (status.ok()) {
             return fragment_executor->execute(_exec_env);
         } else {
@@ -223,6 +301,7 @@ template <typename T>
 void PInternalServiceImpl<T>::cancel_plan_fragment(google::protobuf::RpcController* cntl_base,
                                                    const PCancelPlanFragmentRequest* request,
                                                    PCancelPlanFragmentResult* result, google::protobuf::Closure* done) {
+    SCOPED_SLOW_OP_TRACE("rpc.cancel_plan_fragment", config::slow_rpc_trace_threshold_ms);
     ClosureGuard closure_guard(done);
     TUniqueId tid;
     tid.__set_hi(request->finst_id().hi());
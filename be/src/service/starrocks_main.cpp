@@ -78,11 +78,15 @@ static void thrift_output(const char* x) {
 } // namespace starrocks
 
 extern int meta_tool_main(int argc, char** argv);
+extern int be_bench_main(int argc, char** argv);
 
 int main(int argc, char** argv) {
     if (argc > 1 && strcmp(argv[1], "meta_tool") == 0) {
         return meta_tool_main(argc - 1, argv + 1);
     }
+    if (argc > 1 && strcmp(argv[1], "be_bench") == 0) {
+        return be_bench_main(argc - 1, argv + 1);
+    }
     // Check if print version or help.
     if (argc > 1) {
         if (strcmp(argv[1], "--version") == 0 || strcmp(argv[1], "-v") == 0) {
@@ -3,11 +3,12 @@
 #pragma once
 
 #include <type_traits>
-#ifdef __AVX2__
+#if defined(__AVX2__) || defined(__AVX512F__)
 #include <emmintrin.h>
 #include <immintrin.h>
 #endif
 
+#include <cstddef>
 #include <cstdint>
 
 namespace starrocks::vectorized {
@@ -45,5 +46,46 @@ struct SIMDGather {
             c++;
         }
     }
+
+    // b[i] = a[c[i]];
+    // T is a 4-byte or an 8-byte value, e.g. the values of a dictionary indexed by c.
+    template <class T>
+    static void gather(T* b, const T* a, const uint32_t* c, size_t num_rows) {
+        static_assert(sizeof(T) == 4 || sizeof(T) == 8);
+        size_t i = 0;
+#if defined(__AVX512F__)
+        if constexpr (sizeof(T) == 4) {
+            for (; i + 16 <= num_rows; i += 16) {
+                __m512i indexes = _mm512_loadu_si512(reinterpret_cast<const void*>(c + i));
+                __m512i gathered = _mm512_i32gather_epi32(indexes, reinterpret_cast<const void*>(a), 4);
+                _mm512_storeu_si512(reinterpret_cast<void*>(b + i), gathered);
+            }
+        } else {
+            for (; i + 8 <= num_rows; i += 8) {
+                __m256i indexes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + i));
+                __m512i gathered = _mm512_i32gather_epi64(indexes, reinterpret_cast<const void*>(a), 8);
+                _mm512_storeu_si512(reinterpret_cast<void*>(b + i), gathered);
+            }
+        }
+#elif defined(__AVX2__)
+        if constexpr (sizeof(T) == 4) {
+            for (; i + 8 <= num_rows; i += 8) {
+                __m256i indexes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(c + i));
+                __m256i gathered = _mm256_i32gather_epi32(reinterpret_cast<const int32_t*>(a), indexes, 4);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + i), gathered);
+            }
+        } else {
+            for (; i + 4 <= num_rows; i += 4) {
+                __m128i indexes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(c + i));
+                __m256i gathered = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(a), indexes, 8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(b + i), gathered);
+            }
+        }
+        _mm256_zeroupper();
+#endif
+        for (; i < num_rows; i++) {
+            b[i] = a[c[i]];
+        }
+    }
 };
 } // namespace starrocks::vectorized
\ No newline at end of file
@@ -22,8 +22,16 @@ int AsyncDeltaWriter::_execute(void* meta, bthread::TaskIterator<AsyncDeltaWrite
     if (iter.is_queue_stopped()) {
         return 0;
     }
-    auto writer = static_cast<DeltaWriter*>(meta);
+    auto async_writer = static_cast<AsyncDeltaWriter*>(meta);
+    auto writer = async_writer->_writer.get();
     for (; iter; ++iter) {
+        if (iter->flush) {
+            async_writer->_flush_pending.store(false);
+            auto st = writer->flush_memtable_async();
+            LOG_IF(WARNING, !st.ok()) << "Fail to flush memtable of tablet " << writer->tablet()->tablet_id() << ": "
+                                      << st;
+            continue;
+        }
         Status st;
         if (iter->chunk != nullptr && iter->indexes_size > 0) {
             st = writer->write(*iter->chunk, iter->indexes, 0, iter->indexes_size);
@@ -69,7 +77,7 @@ Status AsyncDeltaWriter::_init() {
     if (UNLIKELY(opts.executor == nullptr)) {
         return Status::InternalError("AsyncDeltaWriterExecutor init failed");
     }
-    if (int r = bthread::execution_queue_start(&_queue_id, &opts, _execute, _writer.get()); r != 0) {
+    if (int r = bthread::execution_queue_start(&_queue_id, &opts, _execute, this); r != 0) {
         return Status::InternalError(fmt::format("fail to create bthread execution queue: {}", r));
     }
     return Status::OK();
@@ -109,4 +117,18 @@ void AsyncDeltaWriter::abort() {
     _writer->abort();
 }
 
+void AsyncDeltaWriter::flush() {
+    if (_flush_pending.exchange(true)) {
+        return;
+    }
+    Task task;
+    task.write_cb = nullptr;
+    task.flush = true;
+    int r = bthread::execution_queue_execute(_queue_id, task);
+    if (r != 0) {
+        LOG(WARNING) << "Fail to execution_queue_execute: " << r;
+        _flush_pending.store(false);
+    }
+}
+
 } // namespace starrocks::vectorized
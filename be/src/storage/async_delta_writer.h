@@ -49,8 +49,16 @@ public:
     // [thread-safe and wait-free]
     void abort();
 
+    // Flush the current MemTable after the submitted writes, without waiting for the flush. Does nothing if a
+    // flush submitted by this method is still pending.
+    // [thread-safe and wait-free]
+    void flush();
+
     int64_t partition_id() const { return _writer->partition_id(); }
 
+    // [thread-safe]
+    int64_t memtable_write_buffer_size() const { return _writer->memtable_write_buffer_size(); }
+
 private:
     struct private_type {
         explicit private_type(int) {}
@@ -63,6 +71,7 @@ private:
         AsyncDeltaWriterCallback* write_cb;
         uint32_t indexes_size = 0;
         bool commit_after_write = false;
+        bool flush = false;
     };
 
     Status _init();
@@ -71,6 +80,7 @@ private:
 
     std::unique_ptr<DeltaWriter> _writer;
     bthread::ExecutionQueueId<Task> _queue_id;
+    std::atomic<bool> _flush_pending{false};
 };
 
 class CommittedRowsetInfo {
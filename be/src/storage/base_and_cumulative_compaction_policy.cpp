@@ -1,6 +1,7 @@
 // This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
 #include "storage/base_and_cumulative_compaction_policy.h"
 
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -16,6 +17,8 @@ namespace starrocks {
 bool BaseAndCumulativeCompactionPolicy::need_compaction() {
     _compaction_context->cumulative_score = _get_cumulative_compaction_score();
     _compaction_context->base_score = _get_base_compaction_score();
+    _compaction_context->cumulative_io_priority = _get_io_priority(CUMULATIVE_COMPACTION);
+    _compaction_context->base_io_priority = _get_io_priority(BASE_COMPACTION);
 
     VLOG(2) << "need_compaction compaction context:" << _compaction_context->to_string();
     // for max_compaction_score is double type, use 0.999 instead of 1
@@ -214,6 +217,24 @@ double BaseAndCumulativeCompactionPolicy::_get_cumulative_compaction_score() {
     return score;
 }
 
+double BaseAndCumulativeCompactionPolicy::_get_io_priority(CompactionType type) {
+    // cumulative compaction merges the level 0 rowsets, base compaction merges the level 1 rowsets into the base
+    const auto& merged_rowsets = _compaction_context->rowset_levels[type == BASE_COMPACTION ? 1 : 0];
+    uint32_t segment_num_score = 0;
+    size_t rewrite_size = 0;
+    for (auto& rowset : merged_rowsets) {
+        segment_num_score += rowset->rowset_meta()->get_compaction_score();
+        rewrite_size += rowset->data_disk_size();
+    }
+    if (type == BASE_COMPACTION) {
+        for (auto& rowset : _compaction_context->rowset_levels[2]) {
+            rewrite_size += rowset->data_disk_size();
+        }
+    }
+    double rewrite_mb = std::max(1.0, static_cast<double>(rewrite_size) / (1024 * 1024));
+    return segment_num_score / rewrite_mb;
+}
+
 double BaseAndCumulativeCompactionPolicy::_get_base_compaction_score() {
     uint32_t segment_num_score = 0;
     size_t level_1_rowsets_size = 0;
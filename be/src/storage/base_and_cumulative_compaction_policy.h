@@ -34,6 +34,9 @@ private:
     double _get_base_compaction_score();
     void _pick_base_rowsets(std::vector<RowsetSharedPtr>* rowsets);
 
+    // the number of segments merged away per MB rewritten by the compaction of |type|
+    double _get_io_priority(CompactionType type);
+
     Status _check_version_continuity(const std::vector<RowsetSharedPtr>& rowsets);
 
     std::shared_ptr<CompactionTask> _create_cumulative_compaction();
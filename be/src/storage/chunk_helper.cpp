@@ -6,6 +6,8 @@
 #include "column/column_pool.h"
 #include "column/schema.h"
 #include "column/type_traits.h"
+#include "runtime/descriptors.h"
+#include "runtime/primitive_type_infra.h"
 #include "storage/olap_type_infra.h"
 #include "storage/tablet_schema.h"
 #include "storage/type_utils.h"
@@ -177,6 +179,40 @@ Chunk* ChunkHelper::new_chunk_pooled(const vectorized::Schema& schema, size_t ch
     return new Chunk(std::move(columns), std::make_shared<vectorized::Schema>(schema));
 }
 
+struct PooledColumnBuilder {
+    template <PrimitiveType ptype>
+    ColumnPtr operator()(const TypeDescriptor& type_desc, size_t chunk_size) {
+        using ColumnType = RunTimeColumnType<ptype>;
+        if constexpr (pt_is_decimal<ptype>) {
+            return get_decimal_column_ptr<ColumnType, true>(type_desc.precision, type_desc.scale, chunk_size);
+        } else {
+            return get_column_ptr<ColumnType, true>(chunk_size);
+        }
+    }
+};
+
+std::shared_ptr<Chunk> ChunkHelper::new_chunk_pooled(const std::vector<SlotDescriptor*>& slots, size_t chunk_size) {
+    if (config::disable_column_pool) {
+        return new_chunk(slots, chunk_size);
+    }
+    auto chunk = std::make_shared<Chunk>();
+    for (const auto slot : slots) {
+        const TypeDescriptor& type_desc = slot->type();
+        ColumnPtr column;
+        if (type_desc.type == TYPE_ARRAY || type_desc.type == TYPE_NULL) {
+            column = ColumnHelper::create_column(type_desc, slot->is_nullable());
+        } else {
+            column = type_dispatch_column(type_desc.type, PooledColumnBuilder(), type_desc, chunk_size);
+            if (slot->is_nullable()) {
+                column = NullableColumn::create(std::move(column), get_column_ptr<NullColumn, true>(chunk_size));
+            }
+        }
+        column->reserve(chunk_size);
+        chunk->append_column(std::move(column), slot->id());
+    }
+    return chunk;
+}
+
 size_t ChunkHelper::approximate_sizeof_type(FieldType type) {
     switch (type) {
     case OLAP_FIELD_TYPE_HLL:
@@ -61,6 +61,11 @@ public:
 
     static Chunk* new_chunk_pooled(const vectorized::Schema& schema, size_t n, bool force = true);
 
+    // Create an empty chunk according to the |slots| and reserve it of size |chunk_size|. The columns of
+    // the fixed-length and binary types are taken from the column pool, and go back to the pool of the
+    // thread releasing the chunk, so a pipeline producing chunks of the same slots reuses their memory.
+    static std::shared_ptr<Chunk> new_chunk_pooled(const std::vector<SlotDescriptor*>& slots, size_t chunk_size);
+
     // Create a vectorized column from field .
     // REQUIRE: |type| must be scalar type.
     static std::shared_ptr<Column> column_from_field_type(FieldType type, bool nullable);
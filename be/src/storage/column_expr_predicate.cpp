@@ -144,6 +144,47 @@ bool ColumnExprPredicate::zone_map_filter(const ZoneMapDetail& detail) const {
     return false;
 }
 
+bool ColumnExprPredicate::get_ngram_substrings(std::vector<std::string>* substrings) const {
+    // The cast exprs appended by convert_to() change the values to match, so they are not supported.
+    if (_expr_ctxs.size() != 1) {
+        return false;
+    }
+    ExprContext* ctx = _expr_ctxs[0];
+    Expr* root = ctx->root();
+    if (root->node_type() != TExprNodeType::FUNCTION_CALL || root->fn().name.function_name != "like" ||
+        root->get_num_children() != 2 || !root->get_child(0)->is_slotref() || !root->get_child(1)->is_constant()) {
+        return false;
+    }
+    auto res = ctx->evaluate(root->get_child(1), nullptr);
+    if (!res.ok() || !res.value()->is_constant() || res.value()->only_null()) {
+        return false;
+    }
+    Slice pattern = ColumnHelper::get_const_value<TYPE_VARCHAR>(res.value());
+
+    // Split the pattern by the wildcards '%' and '_', the literal parts between them must be contained.
+    bool found = false;
+    std::string literal;
+    for (size_t i = 0; i < pattern.size; i++) {
+        char c = pattern.data[i];
+        if (c == '\\' && i + 1 < pattern.size) {
+            literal.push_back(pattern.data[++i]);
+        } else if (c == '%' || c == '_') {
+            if (!literal.empty()) {
+                substrings->emplace_back(std::move(literal));
+                literal.clear();
+                found = true;
+            }
+        } else {
+            literal.push_back(c);
+        }
+    }
+    if (!literal.empty()) {
+        substrings->emplace_back(std::move(literal));
+        found = true;
+    }
+    return found;
+}
+
 Status ColumnExprPredicate::convert_to(const ColumnPredicate** output, const TypeInfoPtr& target_type_info,
                                        ObjectPool* obj_pool) const {
     TypeDescriptor input_type = TypeDescriptor::from_storage_type_info(target_type_info.get());
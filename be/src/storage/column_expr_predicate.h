@@ -43,6 +43,8 @@ public:
 
     bool zone_map_filter(const ZoneMapDetail& detail) const override;
     bool support_bloom_filter() const override { return false; }
+    // Only the LIKE predicate with a constant pattern is supported.
+    bool get_ngram_substrings(std::vector<std::string>* substrings) const override;
     PredicateType type() const override { return PredicateType::kExpr; }
     bool can_vectorized() const override { return true; }
 
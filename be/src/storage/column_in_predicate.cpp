@@ -10,6 +10,7 @@
 #include "storage/rowset/bitmap_index_reader.h"
 #include "storage/rowset/bloom_filter.h"
 #include "storage/vectorized_column_predicate.h"
+#include "util/dense_int_set.h"
 
 namespace starrocks::vectorized {
 
@@ -184,6 +185,18 @@ public:
         } else {
             binary_column = down_cast<const BinaryColumn*>(column);
         }
+        if (_slices.bucket_count() >= kPrefetchBucketCount) {
+            std::vector<uint8_t> found(to - from);
+            _contains_prefetch(binary_column, to - from, [from](size_t k) { return from + k; }, found.data());
+            const uint8_t* null_data =
+                    column->has_null() ? down_cast<const NullableColumn*>(column)->immutable_null_column_data().data()
+                                       : nullptr;
+            for (size_t i = from; i < to; i++) {
+                bool null = null_data != nullptr && null_data[i];
+                sel[i] = Op::apply(sel[i], (uint8_t)(!null && found[i - from]));
+            }
+            return;
+        }
         if (!column->has_null()) {
             for (size_t i = from; i < to; i++) {
                 sel[i] = Op::apply(sel[i], (uint8_t)(_slices.contains(binary_column->get_slice(i))));
@@ -221,6 +234,19 @@ public:
         }
 
         uint16_t new_size = 0;
+        if (_slices.bucket_count() >= kPrefetchBucketCount) {
+            std::vector<uint8_t> found(sel_size);
+            _contains_prefetch(binary_column, sel_size, [sel](size_t k) { return sel[k]; }, found.data());
+            const uint8_t* null_data =
+                    column->has_null() ? down_cast<const NullableColumn*>(column)->immutable_null_column_data().data()
+                                       : nullptr;
+            for (uint16_t i = 0; i < sel_size; ++i) {
+                uint16_t data_idx = sel[i];
+                sel[new_size] = data_idx;
+                new_size += !(null_data != nullptr && null_data[data_idx]) && found[i];
+            }
+            return new_size;
+        }
         if (!column->has_null()) {
             for (uint16_t i = 0; i < sel_size; ++i) {
                 uint16_t data_idx = sel[i];
@@ -312,6 +338,27 @@ public:
     }
 
 private:
+    // The buckets of a set of this size or larger are unlikely to be in the cpu cache.
+    static constexpr size_t kPrefetchBucketCount = 8192;
+    static constexpr size_t kPrefetchDistance = 16;
+
+    // Sets |found[k]| for the row |row_at(k)| of the n rows, the hashes are computed in one pass ahead of the
+    // probes, so that the buckets of the later rows are prefetched while the earlier ones are compared.
+    template <typename RowAt>
+    void _contains_prefetch(const BinaryColumn* column, size_t n, RowAt row_at, uint8_t* found) const {
+        std::vector<size_t> hashes(n);
+        const auto& hash = _slices.hash_function();
+        for (size_t k = 0; k < n; k++) {
+            hashes[k] = hash(column->get_slice(row_at(k)));
+        }
+        for (size_t k = 0; k < n; k++) {
+            if (k + kPrefetchDistance < n) {
+                _slices.prefetch_hash(hashes[k + kPrefetchDistance]);
+            }
+            found[k] = _slices.find(column->get_slice(row_at(k)), hashes[k]) != _slices.end();
+        }
+    }
+
     std::vector<std::string> _zero_padded_strs;
     ItemHashSet<Slice> _slices;
 };
@@ -444,9 +491,41 @@ ColumnPredicate* new_column_in_predicate_small(const TypeInfoPtr& type_info, Col
     return nullptr;
 }
 
+// Returns nullptr if the values are not dense.
+template <FieldType field_type>
+ColumnPredicate* new_dense_column_in_predicate(const TypeInfoPtr& type_info, ColumnId id,
+                                               const std::vector<std::string>& strs) {
+    using CppType = typename CppTypeTraits<field_type>::CppType;
+    std::vector<CppType> values = predicate_internal::strings_to_set<field_type>(strs);
+    DenseIntSet<CppType> set;
+    if (!set.init(std::move(values))) {
+        return nullptr;
+    }
+    return new ColumnInPredicate<field_type, DenseIntSet<CppType>>(type_info, id, std::move(set));
+}
+
+ColumnPredicate* new_dense_column_in_predicate(const TypeInfoPtr& type_info, ColumnId id,
+                                               const std::vector<std::string>& strs) {
+    switch (type_info->type()) {
+    case OLAP_FIELD_TYPE_TINYINT:
+        return new_dense_column_in_predicate<OLAP_FIELD_TYPE_TINYINT>(type_info, id, strs);
+    case OLAP_FIELD_TYPE_SMALLINT:
+        return new_dense_column_in_predicate<OLAP_FIELD_TYPE_SMALLINT>(type_info, id, strs);
+    case OLAP_FIELD_TYPE_INT:
+        return new_dense_column_in_predicate<OLAP_FIELD_TYPE_INT>(type_info, id, strs);
+    case OLAP_FIELD_TYPE_BIGINT:
+        return new_dense_column_in_predicate<OLAP_FIELD_TYPE_BIGINT>(type_info, id, strs);
+    default:
+        return nullptr;
+    }
+}
+
 ColumnPredicate* new_column_in_predicate(const TypeInfoPtr& type_info, ColumnId id,
                                          const std::vector<std::string>& strs) {
     if (strs.size() > 3) {
+        if (auto* pred = new_dense_column_in_predicate(type_info, id, strs); pred != nullptr) {
+            return pred;
+        }
         return new_column_in_predicate_generic<ItemHashSet>(type_info, id, strs);
     } else {
         return new_column_in_predicate_small(type_info, id, strs);
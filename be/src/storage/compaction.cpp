@@ -253,7 +253,7 @@ Status Compaction::_merge_rowsets_vertically(size_t segment_iterator_num, Statis
             auto* beta_rowset = down_cast<BetaRowset*>(rowset.get());
             for (auto& segment : beta_rowset->segments()) {
                 for (uint32_t column_index : _column_groups[i]) {
-                    const auto* column_reader = segment->column(column_index);
+                    ASSIGN_OR_RETURN(auto column_reader, segment->column(column_index));
                     if (column_reader == nullptr) {
                         continue;
                     }
@@ -6,6 +6,7 @@
 #include <set>
 #include <vector>
 
+#include "common/config.h"
 #include "storage/olap_common.h"
 #include "storage/tablet.h"
 
@@ -61,8 +62,17 @@ struct CompactionCandidate {
 // Comparator should compare tablet by compaction score in descending order
 // When compaction scores are equal, put smaller level ahead
 // when compaction score and level are equal, use tablet id(to be unique) instead(ascending)
+// If enable_compaction_io_efficiency_priority is true, the compaction io priority is compared first in descending
+// order, so that the compaction saving more segments to read per byte rewritten is scheduled first.
 struct CompactionCandidateComparator {
     bool operator()(const CompactionCandidate& left, const CompactionCandidate& right) const {
+        if (config::enable_compaction_io_efficiency_priority) {
+            int64_t left_priority = static_cast<int64_t>(left.tablet->compaction_io_priority(left.type) * 100);
+            int64_t right_priority = static_cast<int64_t>(right.tablet->compaction_io_priority(right.type) * 100);
+            if (left_priority != right_priority) {
+                return left_priority > right_priority;
+            }
+        }
         int64_t left_score = static_cast<int64_t>(left.tablet->compaction_score(left.type) * 100);
         int64_t right_score = static_cast<int64_t>(right.tablet->compaction_score(right.type) * 100);
         return left_score > right_score || (left_score == right_score && left.type > right.type) ||
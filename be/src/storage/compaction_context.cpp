@@ -14,6 +14,8 @@ std::string CompactionContext::to_string() const {
     ss << "compaction type:" << chosen_compaction_type << "\n";
     ss << "cumulative score:" << cumulative_score << "\n";
     ss << "base score:" << base_score << "\n";
+    ss << "cumulative io priority:" << cumulative_io_priority << "\n";
+    ss << "base io priority:" << base_io_priority << "\n";
     ss << "cumulative rowset candidates:";
     for (auto& rowset : rowset_levels[0]) {
         ss << rowset->version() << ";";
@@ -30,6 +30,10 @@ struct CompactionContext {
     std::set<Rowset*, RowsetComparator> rowset_levels[LEVEL_NUMBER];
     double cumulative_score = 0;
     double base_score = 0;
+    // The number of segments merged away per MB rewritten by each compaction type,
+    // to prefer the compaction saving more read amplification for the I/O it costs.
+    double cumulative_io_priority = 0;
+    double base_io_priority = 0;
     TabletSharedPtr tablet;
     CompactionType chosen_compaction_type = INVALID_COMPACTION;
 
@@ -0,0 +1,129 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/compaction_io_budget.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "common/logging.h"
+
+namespace starrocks {
+
+bool CompactionIOBudget::can_start(const std::string& path, int64_t now_ms) {
+    std::lock_guard l(_mutex);
+    if (_budget_bytes_per_second_unlocked() <= 0) {
+        return true;
+    }
+    DiskIO& io = _disks[path];
+    _refill_unlocked(&io, now_ms);
+    return io.available_bytes > 0;
+}
+
+void CompactionIOBudget::charge(const std::string& path, int64_t bytes, int64_t now_ms) {
+    std::lock_guard l(_mutex);
+    DiskIO& io = _disks[path];
+    _refill_unlocked(&io, now_ms);
+    io.available_bytes -= bytes;
+}
+
+void CompactionIOBudget::finish(const std::string& path, int64_t charged_bytes, int64_t read_bytes,
+                                int64_t write_bytes, int64_t elapsed_us) {
+    std::lock_guard l(_mutex);
+    DiskIO& io = _disks[path];
+    io.available_bytes -= read_bytes + write_bytes - charged_bytes;
+    io.read_bytes += read_bytes;
+    io.write_bytes += write_bytes;
+    if (read_bytes + write_bytes == 0) {
+        // the task did not run
+        return;
+    }
+    double throughput = static_cast<double>(read_bytes + write_bytes) * 1000000 / std::max<int64_t>(elapsed_us, 1);
+    io.throughput = io.throughput == 0 ? throughput : io.throughput * 0.8 + throughput * 0.2;
+    VLOG(1) << "compaction io of disk:" << path << ", read bytes:" << io.read_bytes
+            << ", write bytes:" << io.write_bytes << ", throughput:" << io.throughput
+            << ", available budget bytes:" << io.available_bytes;
+}
+
+double CompactionIOBudget::throughput(const std::string& path) {
+    std::lock_guard l(_mutex);
+    auto iter = _disks.find(path);
+    return iter == _disks.end() ? 0 : iter->second.throughput;
+}
+
+void CompactionIOBudget::sample_query_latency(int64_t fragment_requests, int64_t fragment_duration_us,
+                                              int64_t now_ms) {
+    int64_t requests = 0;
+    int64_t duration_us = 0;
+    {
+        std::lock_guard l(_mutex);
+        int64_t interval_ms = config::compaction_query_latency_check_interval_sec * 1000;
+        if (_last_sample_ms >= 0 && now_ms - _last_sample_ms < interval_ms) {
+            return;
+        }
+        bool first_sample = _last_sample_ms < 0;
+        requests = fragment_requests - _last_fragment_requests;
+        duration_us = fragment_duration_us - _last_fragment_duration_us;
+        _last_sample_ms = now_ms;
+        _last_fragment_requests = fragment_requests;
+        _last_fragment_duration_us = fragment_duration_us;
+        if (first_sample || requests <= 0) {
+            return;
+        }
+    }
+    update_query_latency(static_cast<double>(duration_us) / requests);
+}
+
+void CompactionIOBudget::update_query_latency(double latency_us) {
+    if (latency_us <= 0) {
+        return;
+    }
+    std::lock_guard l(_mutex);
+    if (_avg_latency_us <= 0) {
+        _avg_latency_us = latency_us;
+        return;
+    }
+    double ratio = config::compaction_backoff_query_latency_ratio;
+    if (ratio > 0 && latency_us > _avg_latency_us * ratio) {
+        double factor = std::max(kMinBackoffFactor, _backoff_factor / 2);
+        if (factor != _backoff_factor) {
+            LOG(INFO) << "compaction backs off for query latency:" << latency_us << "us, average:" << _avg_latency_us
+                      << "us, backoff factor:" << factor;
+        }
+        _backoff_factor = factor;
+        // follow the latency slowly, in case the workload of the queries becomes heavier
+        _avg_latency_us = _avg_latency_us * 0.98 + latency_us * 0.02;
+    } else {
+        _backoff_factor = std::min(1.0, _backoff_factor + 0.1);
+        _avg_latency_us = _avg_latency_us * 0.9 + latency_us * 0.1;
+    }
+}
+
+double CompactionIOBudget::backoff_factor() {
+    std::lock_guard l(_mutex);
+    return _backoff_factor;
+}
+
+double CompactionIOBudget::budget_bytes_per_second() {
+    std::lock_guard l(_mutex);
+    return _budget_bytes_per_second_unlocked();
+}
+
+double CompactionIOBudget::_budget_bytes_per_second_unlocked() const {
+    int64_t budget_mb = config::compaction_io_budget_mb_per_disk;
+    return budget_mb <= 0 ? 0 : static_cast<double>(budget_mb) * 1024 * 1024 * _backoff_factor;
+}
+
+void CompactionIOBudget::_refill_unlocked(DiskIO* io, int64_t now_ms) const {
+    double rate = _budget_bytes_per_second_unlocked();
+    if (rate <= 0) {
+        io->available_bytes = 0;
+    } else if (io->last_refill_ms < 0) {
+        io->available_bytes = rate;
+    } else if (now_ms > io->last_refill_ms) {
+        // at most one second of budget can be accumulated
+        io->available_bytes = std::min(rate, io->available_bytes + rate * (now_ms - io->last_refill_ms) / 1000);
+    }
+    io->last_refill_ms = std::max(io->last_refill_ms, now_ms);
+}
+
+} // namespace starrocks
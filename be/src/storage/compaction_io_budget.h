@@ -0,0 +1,82 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace starrocks {
+
+// The I/O budget of the compaction.
+//
+// It tracks the bytes read and written by the compaction tasks of each disk, and throttles the compaction of
+// each disk by a rate budget (config::compaction_io_budget_mb_per_disk): a task is charged with its estimated
+// I/O when it starts, the budget is refilled by the rate as time goes by, and no more task can start on a disk
+// in debt of its budget. When a task finishes, the charge is corrected by the bytes it actually read and wrote.
+//
+// The compaction competes with the queries for the disk bandwidth, so the budget (and the concurrency of the
+// compaction) is scaled by a backoff factor, which is halved when the average latency of the query fragments
+// exceeds config::compaction_backoff_query_latency_ratio of its moving average, and recovers gradually when
+// the latency is back to normal.
+class CompactionIOBudget {
+public:
+    CompactionIOBudget() = default;
+
+    CompactionIOBudget(const CompactionIOBudget&) = delete;
+    const CompactionIOBudget& operator=(const CompactionIOBudget&) = delete;
+
+    // Whether a compaction task can start on the disk |path| at |now_ms|.
+    bool can_start(const std::string& path, int64_t now_ms);
+
+    // Charge the estimated |bytes| to read and write by a compaction task started on |path|.
+    void charge(const std::string& path, int64_t bytes, int64_t now_ms);
+
+    // Record the bytes read and written by a compaction task finished on |path| in |elapsed_us|,
+    // which was charged with |charged_bytes| when it started.
+    void finish(const std::string& path, int64_t charged_bytes, int64_t read_bytes, int64_t write_bytes,
+                int64_t elapsed_us);
+
+    // The moving average of the compaction throughput of |path|, in bytes per second.
+    double throughput(const std::string& path);
+
+    // Sample the accumulated number and duration of the query fragments at |now_ms|, at most once
+    // every config::compaction_query_latency_check_interval_sec, to update the backoff factor.
+    void sample_query_latency(int64_t fragment_requests, int64_t fragment_duration_us, int64_t now_ms);
+
+    // Update the backoff factor by the average latency of the queries during the last interval.
+    void update_query_latency(double latency_us);
+
+    // The ratio in (0, 1] to scale the I/O budget and the concurrency of the compaction by.
+    double backoff_factor();
+
+    // The I/O budget of each disk in bytes per second after backoff, <= 0 means no limit.
+    double budget_bytes_per_second();
+
+    static constexpr double kMinBackoffFactor = 1.0 / 16;
+
+private:
+    struct DiskIO {
+        // the bytes can be charged, negative if in debt
+        double available_bytes = 0;
+        int64_t last_refill_ms = -1;
+        double throughput = 0;
+        int64_t read_bytes = 0;
+        int64_t write_bytes = 0;
+    };
+
+    double _budget_bytes_per_second_unlocked() const;
+    void _refill_unlocked(DiskIO* io, int64_t now_ms) const;
+
+    std::mutex _mutex;
+    std::unordered_map<std::string, DiskIO> _disks;
+
+    double _backoff_factor = 1.0;
+    double _avg_latency_us = 0;
+    int64_t _last_sample_ms = -1;
+    int64_t _last_fragment_requests = 0;
+    int64_t _last_fragment_duration_us = 0;
+};
+
+} // namespace starrocks
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "storage/compaction_candidate.h"
+#include "storage/compaction_io_budget.h"
 #include "storage/compaction_task.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/rowset.h"
@@ -73,6 +74,8 @@ public:
 
     uint64_t next_compaction_task_id() { return ++_next_task_id; }
 
+    CompactionIOBudget* io_budget() { return &_io_budget; }
+
 private:
     CompactionManager(const CompactionManager& compaction_manager) = delete;
     CompactionManager(CompactionManager&& compaction_manager) = delete;
@@ -95,6 +98,8 @@ private:
 
     std::mutex _scheduler_mutex;
     std::vector<CompactionScheduler*> _schedulers;
+
+    CompactionIOBudget _io_budget;
 };
 
 } // namespace starrocks
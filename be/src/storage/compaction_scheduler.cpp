@@ -10,6 +10,8 @@
 #include "storage/data_dir.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet.h"
+#include "util/starrocks_metrics.h"
+#include "util/time.h"
 
 using namespace std::chrono_literals;
 
@@ -46,6 +48,8 @@ void CompactionScheduler::schedule() {
             if (!st.ok()) {
                 LOG(WARNING) << "submit compaction task to compaction pool failed. status:" << st.to_string();
                 compaction_task->tablet()->reset_compaction(compaction_task->compaction_type());
+                StorageEngine::instance()->compaction_manager()->io_budget()->finish(
+                        compaction_task->tablet()->data_dir()->path(), compaction_task->io_charged_bytes(), 0, 0, 0);
                 CompactionCandidate candidate;
                 candidate.tablet = compaction_task->tablet();
                 candidate.type = compaction_task->compaction_type();
@@ -65,6 +69,12 @@ bool CompactionScheduler::_can_schedule_next() {
                                     static_cast<int32_t>(StorageEngine::instance()->get_store_num() *
                                                          (config::cumulative_compaction_num_threads_per_disk +
                                                           config::base_compaction_num_threads_per_disk)));
+    // the concurrency is scaled down with the io budget when the compaction backs off for the query latency
+    CompactionIOBudget* io_budget = StorageEngine::instance()->compaction_manager()->io_budget();
+    StarRocksMetrics* metrics = StarRocksMetrics::instance();
+    io_budget->sample_query_latency(metrics->fragment_requests_total.value(),
+                                    metrics->fragment_request_duration_us.value(), MonotonicMillis());
+    max_task_num = std::max(1, static_cast<int32_t>(max_task_num * io_budget->backoff_factor()));
     return config::enable_compaction &&
            StorageEngine::instance()->compaction_manager()->running_tasks_num() < max_task_num &&
            StorageEngine::instance()->compaction_manager()->candidates_size() > 0;
@@ -144,6 +154,18 @@ bool CompactionScheduler::_can_do_compaction_task(Tablet* tablet, CompactionTask
         return false;
     }
 
+    // a compaction reads its input rowsets and writes about the same size of output rowset
+    CompactionIOBudget* io_budget = StorageEngine::instance()->compaction_manager()->io_budget();
+    if (!io_budget->can_start(data_dir->path(), MonotonicMillis())) {
+        VLOG(1) << "skip tablet:" << tablet->tablet_id() << " for io budget of disk:" << data_dir->path()
+                << ", budget bytes per second:" << io_budget->budget_bytes_per_second()
+                << ", throughput:" << io_budget->throughput(data_dir->path());
+        return false;
+    }
+    int64_t io_bytes = 2 * compaction_task->input_rowsets_size();
+    io_budget->charge(data_dir->path(), io_bytes, MonotonicMillis());
+    compaction_task->set_io_charged_bytes(io_bytes);
+
     // found a qualified tablet
     // qualified tablet will be removed from candidates
     need_reset_task = false;
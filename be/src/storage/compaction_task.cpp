@@ -3,6 +3,7 @@
 
 #include "runtime/current_thread.h"
 #include "storage/compaction_scheduler.h"
+#include "storage/data_dir.h"
 #include "storage/storage_engine.h"
 #include "util/scoped_cleanup.h"
 #include "util/time.h"
@@ -49,11 +50,17 @@ void CompactionTask::run() {
     SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
 
     bool is_finished = false;
+    bool is_run = false;
     DeferOp op([&] {
         TRACE("[Compaction] do compaction callback.");
         if (!is_finished) {
             set_compaction_task_state(COMPACTION_FAILED);
         }
+        int64_t read_bytes = is_run ? _task_info.input_rowsets_size : 0;
+        int64_t write_bytes = _output_rowset ? _output_rowset->data_disk_size() : 0;
+        StorageEngine::instance()->compaction_manager()->io_budget()->finish(
+                _tablet->data_dir()->path(), _io_charged_bytes, read_bytes, write_bytes,
+                (UnixMillis() - _task_info.start_time) * 1000);
         // reset compaction before judge need_compaction again
         // because if there is a compaction task for one compaction type in a tablet,
         // it will not be able to run another one for that type
@@ -87,6 +94,7 @@ void CompactionTask::run() {
     }
     TRACE("[Compaction] got compaction lock");
 
+    is_run = true;
     Status status = run_impl();
     if (status.ok()) {
         _success_callback();
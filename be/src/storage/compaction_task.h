@@ -216,6 +216,11 @@ public:
 
     void set_compaction_scheduler(CompactionScheduler* scheduler) { _scheduler = scheduler; }
 
+    // the estimated bytes to read and write charged to the compaction io budget when scheduled
+    void set_io_charged_bytes(int64_t io_charged_bytes) { _io_charged_bytes = io_charged_bytes; }
+
+    int64_t io_charged_bytes() const { return _io_charged_bytes; }
+
 protected:
     virtual Status run_impl() = 0;
 
@@ -275,6 +280,7 @@ protected:
     MonotonicStopWatch _watch;
     MemTracker* _mem_tracker;
     CompactionScheduler* _scheduler;
+    int64_t _io_charged_bytes = 0;
 };
 
 } // namespace starrocks
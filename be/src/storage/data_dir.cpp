@@ -28,6 +28,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <utility>
@@ -47,8 +48,10 @@
 #include "util/defer_op.h"
 #include "util/errno.h"
 #include "util/file_utils.h"
+#include "util/io_latency_metrics.h"
 #include "util/monotime.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 
 using strings::Substitute;
 
@@ -92,6 +95,7 @@ Status DataDir::init(bool read_only) {
     RETURN_IF_ERROR_WITH_WARN(_init_tmp_dir(), "_init_tmp_dir failed");
     RETURN_IF_ERROR_WITH_WARN(_init_meta(read_only), "_init_meta failed");
 
+    IOLatencyMetrics::instance()->register_disk(_path);
     _is_used = true;
     return Status::OK();
 }
@@ -357,29 +361,62 @@ std::string DataDir::get_root_path_from_schema_hash_path_in_trash(const std::str
 // TODO(ygl): deal with rowsets and tablets when load failed
 Status DataDir::load() {
     LOG(INFO) << "start to load tablets from " << _path;
+    // The metas are iterated by the calling thread, and parsed by the pool in batches.
+    constexpr size_t kLoadBatchSize = 256;
+    std::unique_ptr<ThreadPool> load_pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("load_tablet")
+                            .set_min_threads(1)
+                            .set_max_threads(std::max(1, config::load_tablet_threads_per_data_dir))
+                            .build(&load_pool));
+    auto submit = [&load_pool](std::function<void()> task) {
+        // Run it by the calling thread if the pool fails to accept it.
+        if (!load_pool->submit_func(task).ok()) {
+            task();
+        }
+    };
+
     // load rowset meta from meta env and create rowset
     // COMMITTED: add to txn manager
     // VISIBLE: add to tablet
     // if one rowset load failed, then the total data dir will not be loaded
+    std::mutex rowset_metas_lock;
     std::vector<RowsetMetaSharedPtr> dir_rowset_metas;
+    std::vector<std::pair<RowsetId, std::string>> rowset_batch;
+    auto parse_rowset_batch = [&](std::vector<std::pair<RowsetId, std::string>> batch) {
+        std::vector<RowsetMetaSharedPtr> rowset_metas;
+        rowset_metas.reserve(batch.size());
+        for (const auto& [rowset_id, meta_str] : batch) {
+            auto rowset_meta = std::make_shared<RowsetMeta>();
+            bool parsed = rowset_meta->init(meta_str);
+            if (!parsed) {
+                LOG(WARNING) << "parse rowset meta string failed for rowset_id:" << rowset_id;
+                continue;
+            }
+            LOG_IF(FATAL, rowset_meta->rowset_type() == ALPHA_ROWSET)
+                    << "must change V1 format to V2 format."
+                    << "tablet_id: " << rowset_meta->tablet_id() << ", tablet_uid:" << rowset_meta->tablet_uid()
+                    << ", schema_hash: " << rowset_meta->tablet_schema_hash()
+                    << ", rowset_id:" << rowset_meta->rowset_id();
+            rowset_metas.push_back(std::move(rowset_meta));
+        }
+        std::lock_guard l(rowset_metas_lock);
+        dir_rowset_metas.insert(dir_rowset_metas.end(), rowset_metas.begin(), rowset_metas.end());
+    };
     LOG(INFO) << "begin loading rowset from meta";
-    auto load_rowset_func = [&dir_rowset_metas](const TabletUid& tablet_uid, RowsetId rowset_id,
-                                                std::string_view meta_str) -> bool {
-        auto rowset_meta = std::make_shared<RowsetMeta>();
-        bool parsed = rowset_meta->init(meta_str);
-        if (!parsed) {
-            LOG(WARNING) << "parse rowset meta string failed for rowset_id:" << rowset_id;
-            // return false will break meta iterator, return true to skip this error
-            return true;
+    auto load_rowset_func = [&](const TabletUid& tablet_uid, RowsetId rowset_id, std::string_view meta_str) -> bool {
+        rowset_batch.emplace_back(rowset_id, std::string(meta_str));
+        if (rowset_batch.size() >= kLoadBatchSize) {
+            submit([&parse_rowset_batch, batch = std::move(rowset_batch)]() mutable {
+                parse_rowset_batch(std::move(batch));
+            });
+            rowset_batch.clear();
         }
-        LOG_IF(FATAL, rowset_meta->rowset_type() == ALPHA_ROWSET)
-                << "must change V1 format to V2 format."
-                << "tablet_id: " << rowset_meta->tablet_id() << ", tablet_uid:" << rowset_meta->tablet_uid()
-                << ", schema_hash: " << rowset_meta->tablet_schema_hash() << ", rowset_id:" << rowset_meta->rowset_id();
-        dir_rowset_metas.push_back(rowset_meta);
+        // return false will break meta iterator, return true to skip the errors
         return true;
     };
     Status load_rowset_status = RowsetMetaManager::traverse_rowset_metas(_kv_store, load_rowset_func);
+    parse_rowset_batch(std::move(rowset_batch));
+    load_pool->wait();
 
     if (!load_rowset_status.ok()) {
         LOG(WARNING) << "errors when load rowset meta from meta env, skip this data dir:" << _path;
@@ -390,28 +427,48 @@ Status DataDir::load() {
     // load tablet
     // create tablet from tablet meta and add it to tablet mgr
     LOG(INFO) << "begin loading tablet from meta";
+    std::mutex tablet_ids_lock;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](int64_t tablet_id, int32_t schema_hash,
-                                                                    std::string_view value) -> bool {
-        Status st =
-                _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, value, false, false, false, false);
-        if (!st.ok() && !st.is_not_found()) {
-            // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
-            // This may happen when the tablet was just deleted before the BE restarted,
-            // but it has not been cleared from rocksdb. At this time, restarting the BE
-            // will read the tablet in the DELETE state from rocksdb. These tablets have been
-            // added to the garbage collection queue and will be automatically deleted afterwards.
-            // Therefore, we believe that this situation is not a failure.
-            LOG(WARNING) << "load tablet from header failed. status:" << st.to_string() << ", tablet=" << tablet_id
-                         << "." << schema_hash;
-            failed_tablet_ids.insert(tablet_id);
-        } else {
-            tablet_ids.insert(tablet_id);
+    struct TabletMetaEntry {
+        int64_t tablet_id;
+        int32_t schema_hash;
+        std::string meta;
+    };
+    std::vector<TabletMetaEntry> tablet_batch;
+    auto load_tablet_batch = [&](std::vector<TabletMetaEntry> batch) {
+        for (const auto& [tablet_id, schema_hash, meta] : batch) {
+            Status st = _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, meta, false, false, false,
+                                                               false);
+            std::lock_guard l(tablet_ids_lock);
+            if (!st.ok() && !st.is_not_found()) {
+                // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
+                // This may happen when the tablet was just deleted before the BE restarted,
+                // but it has not been cleared from rocksdb. At this time, restarting the BE
+                // will read the tablet in the DELETE state from rocksdb. These tablets have been
+                // added to the garbage collection queue and will be automatically deleted afterwards.
+                // Therefore, we believe that this situation is not a failure.
+                LOG(WARNING) << "load tablet from header failed. status:" << st.to_string() << ", tablet=" << tablet_id
+                             << "." << schema_hash;
+                failed_tablet_ids.insert(tablet_id);
+            } else {
+                tablet_ids.insert(tablet_id);
+            }
+        }
+    };
+    auto load_tablet_func = [&](int64_t tablet_id, int32_t schema_hash, std::string_view value) -> bool {
+        tablet_batch.push_back(TabletMetaEntry{tablet_id, schema_hash, std::string(value)});
+        if (tablet_batch.size() >= kLoadBatchSize) {
+            submit([&load_tablet_batch, batch = std::move(tablet_batch)]() mutable {
+                load_tablet_batch(std::move(batch));
+            });
+            tablet_batch.clear();
         }
         return true;
     };
     Status load_tablet_status = TabletMetaManager::walk(_kv_store, load_tablet_func);
+    load_tablet_batch(std::move(tablet_batch));
+    load_pool->wait();
     if (failed_tablet_ids.size() != 0) {
         LOG(ERROR) << "load tablets from header failed"
                    << ", loaded tablet: " << tablet_ids.size() << ", error tablet: " << failed_tablet_ids.size()
@@ -434,54 +491,66 @@ Status DataDir::load() {
     // 1. add committed rowset to txn map
     // 2. add visible rowset to tablet
     // ignore any errors when load tablet or rowset, because fe will repair them after report
-    for (const auto& rowset_meta : dir_rowset_metas) {
-        TabletSharedPtr tablet = _tablet_manager->get_tablet(rowset_meta->tablet_id(), false);
-        // tablet maybe dropped, but not drop related rowset meta
-        if (tablet == nullptr) {
-            // LOG(WARNING) << "could not find tablet id: " << rowset_meta->tablet_id()
-            //              << ", schema hash: " << rowset_meta->tablet_schema_hash()
-            //              << ", for rowset: " << rowset_meta->rowset_id() << ", skip this rowset";
-            continue;
-        }
-        RowsetSharedPtr rowset;
-        Status create_status = RowsetFactory::create_rowset(&tablet->tablet_schema(), tablet->schema_hash_path(),
-                                                            rowset_meta, &rowset);
-        if (!create_status.ok()) {
-            LOG(WARNING) << "Fail to create rowset from rowsetmeta,"
-                         << " rowset=" << rowset_meta->rowset_id() << " type=" << rowset_meta->rowset_type()
-                         << " state=" << rowset_meta->rowset_state();
-            continue;
-        }
-        if (rowset_meta->rowset_state() == RowsetStatePB::COMMITTED &&
-            rowset_meta->tablet_uid() == tablet->tablet_uid()) {
-            Status commit_txn_status = _txn_manager->commit_txn(
-                    _kv_store, rowset_meta->partition_id(), rowset_meta->txn_id(), rowset_meta->tablet_id(),
-                    rowset_meta->tablet_schema_hash(), rowset_meta->tablet_uid(), rowset_meta->load_id(), rowset, true);
-            if (!commit_txn_status.ok() && !commit_txn_status.is_already_exist()) {
-                LOG(WARNING) << "Fail to add committed rowset=" << rowset_meta->rowset_id()
-                             << " tablet=" << rowset_meta->tablet_id() << " txn=" << rowset_meta->txn_id();
-            } else {
-                LOG(INFO) << "Added committed rowset=" << rowset_meta->rowset_id()
-                          << " tablet=" << rowset_meta->tablet_id()
-                          << " schema hash=" << rowset_meta->tablet_schema_hash() << " txn=" << rowset_meta->txn_id();
-            }
-        } else if (rowset_meta->rowset_state() == RowsetStatePB::VISIBLE &&
-                   rowset_meta->tablet_uid() == tablet->tablet_uid()) {
-            Status publish_status = tablet->add_rowset(rowset, false);
-            if (!publish_status.ok() && !publish_status.is_already_exist()) {
-                LOG(WARNING) << "Fail to add visible rowset=" << rowset->rowset_id()
-                             << " to tablet=" << rowset_meta->tablet_id() << " txn id=" << rowset_meta->txn_id()
-                             << " start version=" << rowset_meta->version().first
-                             << " end version=" << rowset_meta->version().second;
+    // The rowsets are partitioned by the tablet, so that the rowsets of one tablet are added in order by one thread.
+    size_t num_partitions = std::max(1, config::load_tablet_threads_per_data_dir) * 4;
+    std::vector<std::vector<RowsetMetaSharedPtr>> partitions(num_partitions);
+    for (auto& rowset_meta : dir_rowset_metas) {
+        partitions[static_cast<uint64_t>(rowset_meta->tablet_id()) % num_partitions].push_back(std::move(rowset_meta));
+    }
+    dir_rowset_metas.clear();
+    for (auto& partition : partitions) {
+        submit([this, &partition] {
+            for (const auto& rowset_meta : partition) {
+                _load_rowset(rowset_meta);
             }
+            partition.clear();
+        });
+    }
+    load_pool->wait();
+    return Status::OK();
+}
+
+void DataDir::_load_rowset(const RowsetMetaSharedPtr& rowset_meta) {
+    TabletSharedPtr tablet = _tablet_manager->get_tablet(rowset_meta->tablet_id(), false);
+    // tablet maybe dropped, but not drop related rowset meta
+    if (tablet == nullptr) {
+        return;
+    }
+    RowsetSharedPtr rowset;
+    Status create_status =
+            RowsetFactory::create_rowset(&tablet->tablet_schema(), tablet->schema_hash_path(), rowset_meta, &rowset);
+    if (!create_status.ok()) {
+        LOG(WARNING) << "Fail to create rowset from rowsetmeta,"
+                     << " rowset=" << rowset_meta->rowset_id() << " type=" << rowset_meta->rowset_type()
+                     << " state=" << rowset_meta->rowset_state();
+        return;
+    }
+    if (rowset_meta->rowset_state() == RowsetStatePB::COMMITTED && rowset_meta->tablet_uid() == tablet->tablet_uid()) {
+        Status commit_txn_status = _txn_manager->commit_txn(
+                _kv_store, rowset_meta->partition_id(), rowset_meta->txn_id(), rowset_meta->tablet_id(),
+                rowset_meta->tablet_schema_hash(), rowset_meta->tablet_uid(), rowset_meta->load_id(), rowset, true);
+        if (!commit_txn_status.ok() && !commit_txn_status.is_already_exist()) {
+            LOG(WARNING) << "Fail to add committed rowset=" << rowset_meta->rowset_id()
+                         << " tablet=" << rowset_meta->tablet_id() << " txn=" << rowset_meta->txn_id();
         } else {
-            LOG(WARNING) << "Found invalid rowset=" << rowset_meta->rowset_id()
-                         << " tablet id=" << rowset_meta->tablet_id() << " tablet uid=" << rowset_meta->tablet_uid()
-                         << " schema hash=" << rowset_meta->tablet_schema_hash() << " txn=" << rowset_meta->txn_id()
-                         << " current valid tablet uid=" << tablet->tablet_uid();
+            LOG(INFO) << "Added committed rowset=" << rowset_meta->rowset_id() << " tablet=" << rowset_meta->tablet_id()
+                      << " schema hash=" << rowset_meta->tablet_schema_hash() << " txn=" << rowset_meta->txn_id();
         }
+    } else if (rowset_meta->rowset_state() == RowsetStatePB::VISIBLE &&
+               rowset_meta->tablet_uid() == tablet->tablet_uid()) {
+        Status publish_status = tablet->add_rowset(rowset, false);
+        if (!publish_status.ok() && !publish_status.is_already_exist()) {
+            LOG(WARNING) << "Fail to add visible rowset=" << rowset->rowset_id()
+                         << " to tablet=" << rowset_meta->tablet_id() << " txn id=" << rowset_meta->txn_id()
+                         << " start version=" << rowset_meta->version().first
+                         << " end version=" << rowset_meta->version().second;
+        }
+    } else {
+        LOG(WARNING) << "Found invalid rowset=" << rowset_meta->rowset_id() << " tablet id=" << rowset_meta->tablet_id()
+                     << " tablet uid=" << rowset_meta->tablet_uid()
+                     << " schema hash=" << rowset_meta->tablet_schema_hash() << " txn=" << rowset_meta->txn_id()
+                     << " current valid tablet uid=" << tablet->tablet_uid();
     }
-    return Status::OK();
 }
 
 // gc unused tablet schemahash dir
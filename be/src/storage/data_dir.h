@@ -38,6 +38,7 @@
 
 namespace starrocks {
 
+class RowsetMeta;
 class Tablet;
 class TabletManager;
 class TxnManager;
@@ -134,6 +135,9 @@ private:
 
     void _process_garbage_path(const std::string& path);
 
+    // Adds the rowset loaded from meta to its tablet, or to the txn manager if it's committed.
+    void _load_rowset(const std::shared_ptr<RowsetMeta>& rowset_meta);
+
     bool _stop_bg_worker = false;
 
     std::shared_ptr<Env> _env;
@@ -165,6 +165,7 @@ Status DeltaWriter::_init() {
     writer_context.load_id = _opt.load_id;
     writer_context.segments_overlap = OVERLAPPING;
     writer_context.global_dicts = _opt.global_dicts;
+    writer_context.parallel_pool = _storage_engine->memtable_flush_executor()->parallel_pool();
     Status st = RowsetFactory::create_rowset_writer(writer_context, &_rowset_writer);
     if (!st.ok()) {
         _set_state(kUninitialized);
@@ -211,6 +212,7 @@ Status DeltaWriter::write(const Chunk& chunk, const uint32_t* indexes, uint32_t
     RETURN_IF_ERROR(_prepare());
     Status st;
     bool full = _mem_table->insert(chunk, indexes, from, size);
+    _memtable_write_buffer_size.store(_mem_table->write_buffer_size(), std::memory_order_relaxed);
     if (_mem_tracker->limit_exceeded()) {
         VLOG(2) << "Flushing memory table due to memory limit exceeded";
         st = _flush_memtable();
@@ -229,6 +231,19 @@ Status DeltaWriter::write(const Chunk& chunk, const uint32_t* indexes, uint32_t
     return st;
 }
 
+Status DeltaWriter::flush_memtable_async() {
+    SCOPED_THREAD_LOCAL_MEM_SETTER(_mem_tracker, false);
+    if (_get_state() != kPrepared || _mem_table->write_buffer_size() == 0) {
+        return Status::OK();
+    }
+    Status st = _flush_memtable_async();
+    _reset_mem_table();
+    if (!st.ok()) {
+        _set_state(kAborted);
+    }
+    return st;
+}
+
 Status DeltaWriter::close() {
     SCOPED_THREAD_LOCAL_MEM_SETTER(_mem_tracker, false);
     Status st;
@@ -265,6 +280,11 @@ Status DeltaWriter::_flush_memtable() {
 void DeltaWriter::_reset_mem_table() {
     _mem_table = std::make_unique<MemTable>(_tablet->tablet_id(), _tablet_schema, _opt.slots, _rowset_writer.get(),
                                             _mem_tracker);
+    _mem_table->set_parallel_pool(_storage_engine->memtable_flush_executor()->parallel_pool());
+    if (_opt.max_buffer_size > 0) {
+        _mem_table->set_max_buffer_size(_opt.max_buffer_size);
+    }
+    _memtable_write_buffer_size.store(0, std::memory_order_relaxed);
 }
 
 Status DeltaWriter::commit() {
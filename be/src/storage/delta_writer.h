@@ -34,6 +34,8 @@ struct DeltaWriterOptions {
     // slots are in order of tablet's schema
     const std::vector<SlotDescriptor*>* slots;
     vectorized::GlobalDictByNameMaps* global_dicts = nullptr;
+    // The write buffer size at which a MemTable is flushed, 0 means config::write_buffer_size.
+    int64_t max_buffer_size = 0;
 };
 
 // Writer for a particular (load, index, tablet).
@@ -49,6 +51,14 @@ public:
     // [NOT thread-safe]
     [[nodiscard]] Status write(const Chunk& chunk, const uint32_t* indexes, uint32_t from, uint32_t size);
 
+    // Flush the current MemTable without waiting if it's not empty, e.g. to reduce the memory usage of loads.
+    // [NOT thread-safe]
+    [[nodiscard]] Status flush_memtable_async();
+
+    // The write buffer size of the current MemTable.
+    // [thread-safe]
+    int64_t memtable_write_buffer_size() const { return _memtable_write_buffer_size.load(std::memory_order_relaxed); }
+
     // Flush all in-memory data to disk, without waiting.
     // Subsequent `write()`s to this DeltaWriter will fail after this method returned.
     // [NOT thread-safe]
@@ -120,6 +130,7 @@ private:
     RowsetSharedPtr _cur_rowset;
     std::unique_ptr<RowsetWriter> _rowset_writer;
     std::unique_ptr<MemTable> _mem_table;
+    std::atomic<int64_t> _memtable_write_buffer_size{0};
     const TabletSchema* _tablet_schema;
 
     std::unique_ptr<FlushToken> _flush_token;
@@ -161,6 +161,9 @@ public:
     // If an error was encountered, returns a non-OK status.
     virtual Status read(uint64_t offset, Slice result) = 0;
 
+    // Hints that [offset, offset + size) is going to be read soon. Does nothing by default.
+    virtual void will_need(uint64_t offset, uint64_t size) {}
+
     // Returns the memory usage of this object including the object itself.
     // virtual size_t memory_footprint() const = 0;
 };
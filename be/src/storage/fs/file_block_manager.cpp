@@ -249,6 +249,8 @@ public:
 
     Status read(uint64_t offset, Slice result) override;
 
+    void will_need(uint64_t offset, uint64_t size) override;
+
     void handle_error(const Status& s) const;
 
 private:
@@ -314,6 +316,11 @@ Status FileReadableBlock::read(uint64_t offset, Slice result) {
     return _file->read_at_fully(offset, result.data, result.size);
 }
 
+void FileReadableBlock::will_need(uint64_t offset, uint64_t size) {
+    DCHECK(!_closed.load());
+    _file->will_need(offset, size);
+}
+
 } // namespace internal
 
 ////////////////////////////////////////////////////////////
@@ -25,6 +25,8 @@
 #include <immintrin.h>
 #endif
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <map>
 
@@ -72,8 +74,94 @@ void HyperLogLog::_convert_explicit_to_register() {
     phmap::flat_hash_set<uint64_t>().swap(_hash_set);
 }
 
-// Change HLL_DATA_EXPLICIT to HLL_DATA_FULL directly, because HLL_DATA_SPARSE
-// is implemented in the same way in memory with HLL_DATA_FULL.
+void HyperLogLog::_convert_explicit_to_sparse() {
+    DCHECK_EQ(_type, HLL_DATA_EXPLICIT);
+    DCHECK(_sparse_registers.empty());
+    _type = HLL_DATA_SPARSE;
+    _sparse_registers.reserve(_hash_set.size());
+    for (auto value : _hash_set) {
+        uint32_t idx;
+        uint8_t first_one_bit;
+        _hash_to_register(value, &idx, &first_one_bit);
+        _sparse_registers.push_back((idx << 8) | first_one_bit);
+    }
+    phmap::flat_hash_set<uint64_t>().swap(_hash_set);
+    _normalize_sparse_registers();
+}
+
+void HyperLogLog::_normalize_sparse_registers() {
+    DCHECK_EQ(_type, HLL_DATA_SPARSE);
+    // Keep the max value of the same register, which is the last one after sorting.
+    std::sort(_sparse_registers.begin(), _sparse_registers.end());
+    auto last = std::unique(_sparse_registers.rbegin(), _sparse_registers.rend(),
+                            [](uint32_t lhs, uint32_t rhs) { return (lhs >> 8) == (rhs >> 8); });
+    _sparse_registers.erase(_sparse_registers.begin(), last.base());
+    if (_sparse_registers.size() > HLL_SPARSE_MEMORY_THRESHOLD) {
+        _convert_sparse_to_full();
+    }
+}
+
+void HyperLogLog::_convert_sparse_to_full() {
+    DCHECK_EQ(_type, HLL_DATA_SPARSE);
+    DCHECK_EQ(_registers.data, nullptr);
+    ChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
+    DCHECK_NE(_registers.data, nullptr);
+    DCHECK_EQ(_registers.size, HLL_REGISTERS_COUNT);
+    memset(_registers.data, 0, HLL_REGISTERS_COUNT);
+
+    for (auto entry : _sparse_registers) {
+        _registers.data[entry >> 8] = entry & 0xFF;
+    }
+    std::vector<uint32_t>().swap(_sparse_registers);
+    _type = HLL_DATA_FULL;
+}
+
+void HyperLogLog::_update_sparse_register(uint32_t idx, uint8_t value) {
+    DCHECK_EQ(_type, HLL_DATA_SPARSE);
+    auto iter = std::lower_bound(_sparse_registers.begin(), _sparse_registers.end(), idx << 8);
+    if (iter != _sparse_registers.end() && (*iter >> 8) == idx) {
+        if ((*iter & 0xFF) < value) {
+            *iter = (idx << 8) | value;
+        }
+        return;
+    }
+    _sparse_registers.insert(iter, (idx << 8) | value);
+    if (_sparse_registers.size() > HLL_SPARSE_MEMORY_THRESHOLD) {
+        _convert_sparse_to_full();
+    }
+}
+
+void HyperLogLog::_merge_sparse_registers(const std::vector<uint32_t>& other_registers) {
+    if (_type == HLL_DATA_FULL) {
+        for (auto entry : other_registers) {
+            _registers.data[entry >> 8] = std::max<uint8_t>(_registers.data[entry >> 8], entry & 0xFF);
+        }
+        return;
+    }
+    DCHECK_EQ(_type, HLL_DATA_SPARSE);
+    std::vector<uint32_t> registers;
+    registers.reserve(_sparse_registers.size() + other_registers.size());
+    auto iter = _sparse_registers.begin();
+    auto other_iter = other_registers.begin();
+    while (iter != _sparse_registers.end() && other_iter != other_registers.end()) {
+        if ((*iter >> 8) == (*other_iter >> 8)) {
+            registers.push_back(std::max(*iter, *other_iter));
+            ++iter;
+            ++other_iter;
+        } else if (*iter < *other_iter) {
+            registers.push_back(*iter++);
+        } else {
+            registers.push_back(*other_iter++);
+        }
+    }
+    registers.insert(registers.end(), iter, _sparse_registers.end());
+    registers.insert(registers.end(), other_iter, other_registers.end());
+    _sparse_registers.swap(registers);
+    if (_sparse_registers.size() > HLL_SPARSE_MEMORY_THRESHOLD) {
+        _convert_sparse_to_full();
+    }
+}
+
 void HyperLogLog::update(uint64_t hash_value) {
     switch (_type) {
     case HLL_DATA_EMPTY:
@@ -85,10 +173,17 @@ void HyperLogLog::update(uint64_t hash_value) {
             _hash_set.insert(hash_value);
             break;
         }
-        _convert_explicit_to_register();
-        _type = HLL_DATA_FULL;
+        _convert_explicit_to_sparse();
         // fall through
     case HLL_DATA_SPARSE:
+        if (_type == HLL_DATA_SPARSE) {
+            uint32_t idx;
+            uint8_t first_one_bit;
+            _hash_to_register(hash_value, &idx, &first_one_bit);
+            _update_sparse_register(idx, first_one_bit);
+            break;
+        }
+        // fall through
     case HLL_DATA_FULL:
         _update_registers(hash_value);
         break;
@@ -109,6 +204,8 @@ void HyperLogLog::merge(const HyperLogLog& other) {
             _hash_set = other._hash_set;
             break;
         case HLL_DATA_SPARSE:
+            _sparse_registers = other._sparse_registers;
+            break;
         case HLL_DATA_FULL:
             DCHECK_EQ(_registers.data, nullptr);
             ChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
@@ -128,11 +225,13 @@ void HyperLogLog::merge(const HyperLogLog& other) {
             // HLL_EXPLICLIT_INT64_NUM. This is OK because the max value is 2 * 160.
             _hash_set.insert(other._hash_set.begin(), other._hash_set.end());
             if (_hash_set.size() > HLL_EXPLICLIT_INT64_NUM) {
-                _convert_explicit_to_register();
-                _type = HLL_DATA_FULL;
+                _convert_explicit_to_sparse();
             }
             break;
         case HLL_DATA_SPARSE:
+            _convert_explicit_to_sparse();
+            _merge_sparse_registers(other._sparse_registers);
+            break;
         case HLL_DATA_FULL:
             _convert_explicit_to_register();
             _merge_registers(other._registers.data);
@@ -143,7 +242,26 @@ void HyperLogLog::merge(const HyperLogLog& other) {
         }
         break;
     }
-    case HLL_DATA_SPARSE:
+    case HLL_DATA_SPARSE: {
+        switch (other._type) {
+        case HLL_DATA_EXPLICIT:
+            for (auto hash_value : other._hash_set) {
+                // this may become full during the loop.
+                update(hash_value);
+            }
+            break;
+        case HLL_DATA_SPARSE:
+            _merge_sparse_registers(other._sparse_registers);
+            break;
+        case HLL_DATA_FULL:
+            _convert_sparse_to_full();
+            _merge_registers(other._registers.data);
+            break;
+        default:
+            break;
+        }
+        break;
+    }
     case HLL_DATA_FULL: {
         switch (other._type) {
         case HLL_DATA_EXPLICIT:
@@ -152,6 +270,8 @@ void HyperLogLog::merge(const HyperLogLog& other) {
             }
             break;
         case HLL_DATA_SPARSE:
+            _merge_sparse_registers(other._sparse_registers);
+            break;
         case HLL_DATA_FULL:
             _merge_registers(other._registers.data);
             break;
@@ -171,6 +291,7 @@ size_t HyperLogLog::max_serialized_size() const {
     case HLL_DATA_EXPLICIT:
         return 2 + _hash_set.size() * 8;
     case HLL_DATA_SPARSE:
+        return 1 + 4 + 3 * _sparse_registers.size();
     case HLL_DATA_FULL:
         return 1 + HLL_REGISTERS_COUNT;
     }
@@ -198,7 +319,18 @@ size_t HyperLogLog::serialize(uint8_t* dst) const {
         }
         break;
     }
-    case HLL_DATA_SPARSE:
+    case HLL_DATA_SPARSE: {
+        DCHECK_LE(_sparse_registers.size(), HLL_SPARSE_THRESHOLD);
+        *ptr++ = HLL_DATA_SPARSE;
+        encode_fixed32_le(ptr, _sparse_registers.size());
+        ptr += 4;
+        for (auto entry : _sparse_registers) {
+            encode_fixed16_le(ptr, entry >> 8);
+            ptr += 2;
+            *ptr++ = entry & 0xFF;
+        }
+        break;
+    }
     case HLL_DATA_FULL: {
         uint32_t num_non_zero_registers = 0;
         for (int i = 0; i < HLL_REGISTERS_COUNT; i++) {
@@ -307,22 +439,21 @@ bool HyperLogLog::deserialize(const Slice& slice) {
         break;
     }
     case HLL_DATA_SPARSE: {
-        DCHECK_EQ(_registers.data, nullptr);
-        ChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
-        DCHECK_NE(_registers.data, nullptr);
-        DCHECK_EQ(_registers.size, HLL_REGISTERS_COUNT);
-        memset(_registers.data, 0, HLL_REGISTERS_COUNT);
-
         // 2-5(4 byte): number of registers
         uint32_t num_registers = decode_fixed32_le(ptr);
         ptr += 4;
+        _sparse_registers.reserve(num_registers);
         for (uint32_t i = 0; i < num_registers; ++i) {
             // 2 bytes: register index
             // 1 byte: register value
             uint16_t register_idx = decode_fixed16_le(ptr);
             ptr += 2;
-            _registers.data[register_idx] = *ptr++;
+            uint8_t value = *ptr++;
+            if (value != 0) {
+                _sparse_registers.push_back((register_idx << 8) | value);
+            }
         }
+        _normalize_sparse_registers();
         break;
     }
     case HLL_DATA_FULL: {
@@ -364,18 +495,35 @@ int64_t HyperLogLog::estimate_cardinality() const {
         alpha = 0.7213f / (1 + 1.079f / num_streams);
     }
 
-    float harmonic_mean = 0;
-    int num_zero_registers = 0;
-
-    for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
-        harmonic_mean += powf(2.0f, -_registers.data[i]);
-
-        if (_registers.data[i] == 0) {
-            ++num_zero_registers;
+    // Count the registers of each value, and sum 2^-value by the counts, which doesn't depend on the
+    // order of the registers, so the sparse and full registers get the same estimate.
+    // The register value is at most HLL_ZERO_COUNT_BITS + 1, but the deserialized ones are not checked.
+    uint32_t value_counts[256] = {0};
+    if (_type == HLL_DATA_SPARSE) {
+        for (auto entry : _sparse_registers) {
+            value_counts[entry & 0xFF]++;
         }
+        value_counts[0] = HLL_REGISTERS_COUNT - _sparse_registers.size();
+    } else {
+        for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
+            value_counts[_registers.data[i]]++;
+        }
+    }
+    static const auto inverse_powers = [] {
+        std::array<double, 256> powers;
+        for (int i = 0; i < powers.size(); ++i) {
+            powers[i] = std::ldexp(1.0, -i);
+        }
+        return powers;
+    }();
+
+    double harmonic_mean = 0;
+    for (int i = 0; i < 256; ++i) {
+        harmonic_mean += value_counts[i] * inverse_powers[i];
     }
+    int num_zero_registers = value_counts[0];
 
-    harmonic_mean = 1.0f / harmonic_mean;
+    harmonic_mean = 1.0 / harmonic_mean;
     double estimate = alpha * num_streams * num_streams * harmonic_mean;
     // according to HerperLogLog current correction, if E is cardinal
     // E =< num_streams * 2.5 , LC has higher accuracy.
@@ -423,6 +571,17 @@ void HyperLogLog::_merge_registers(uint8_t* other_registers) {
         src += 32;
         dst += 32;
     }
+#elif defined(__SSE2__)
+    int loop = HLL_REGISTERS_COUNT / 16;
+    uint8_t* dst = _registers.data;
+    const uint8_t* src = other_registers;
+    for (int i = 0; i < loop; i++) {
+        __m128i xa = _mm_loadu_si128((const __m128i*)dst);
+        __m128i xb = _mm_loadu_si128((const __m128i*)src);
+        _mm_storeu_si128((__m128i*)dst, _mm_max_epu8(xa, xb));
+        src += 16;
+        dst += 16;
+    }
 #else
     for (int i = 0; i < HLL_REGISTERS_COUNT; i++) {
         _registers.data[i] = std::max(_registers.data[i], other_registers[i]);
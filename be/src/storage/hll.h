@@ -43,6 +43,8 @@ const static int HLL_COLUMN_PRECISION = 14;
 const static int HLL_ZERO_COUNT_BITS = (64 - HLL_COLUMN_PRECISION);
 const static int HLL_EXPLICLIT_INT64_NUM = 160;
 const static int HLL_SPARSE_THRESHOLD = 4096;
+// maximum number of non-zero registers kept in the sparse format in memory, which takes 4 bytes for each register.
+const static int HLL_SPARSE_MEMORY_THRESHOLD = 1024;
 const static int HLL_REGISTERS_COUNT = 16 * 1024;
 // maximum size in byte of serialized HLL: type(1) + registers (2^14)
 const static int HLL_COLUMN_DEFAULT_LEN = HLL_REGISTERS_COUNT + 1;
@@ -77,6 +79,10 @@ const static int HLL_EMPTY_SIZE = 1;
 // A HLL value will change in the sequence empty -> explicit -> sparse -> full, and not
 // allow reverse.
 //
+// In memory, HLL_DATA_SPARSE keeps the non-zero registers in a sorted vector, until there are
+// more than HLL_SPARSE_MEMORY_THRESHOLD of them, so the HLL values of medium cardinalities don't
+// allocate the 16K registers, e.g. the states of hll_union_agg with lots of groups.
+//
 // NOTE: This values are persisted in storage devices, so don't change exist
 // enum values.
 enum HllDataType {
@@ -90,7 +96,8 @@ class HyperLogLog {
 public:
     HyperLogLog() = default;
 
-    HyperLogLog(const HyperLogLog& other) : _type(other._type), _hash_set(other._hash_set) {
+    HyperLogLog(const HyperLogLog& other)
+            : _type(other._type), _hash_set(other._hash_set), _sparse_registers(other._sparse_registers) {
         if (_registers.data != nullptr) {
             ChunkAllocator::instance()->free(_registers);
             _registers.data = nullptr;
@@ -108,6 +115,7 @@ public:
         if (this != &other) {
             this->_type = other._type;
             this->_hash_set = other._hash_set;
+            this->_sparse_registers = other._sparse_registers;
 
             if (_registers.data != nullptr) {
                 ChunkAllocator::instance()->free(_registers);
@@ -124,7 +132,10 @@ public:
         return *this;
     }
 
-    HyperLogLog(HyperLogLog&& other) noexcept : _type(other._type), _hash_set(std::move(other._hash_set)) {
+    HyperLogLog(HyperLogLog&& other) noexcept
+            : _type(other._type),
+              _hash_set(std::move(other._hash_set)),
+              _sparse_registers(std::move(other._sparse_registers)) {
         if (_registers.data != nullptr) {
             ChunkAllocator::instance()->free(_registers);
         }
@@ -138,6 +149,7 @@ public:
         if (this != &other) {
             this->_type = other._type;
             this->_hash_set = std::move(other._hash_set);
+            this->_sparse_registers = std::move(other._sparse_registers);
 
             if (_registers.data != nullptr) {
                 ChunkAllocator::instance()->free(_registers);
@@ -203,12 +215,16 @@ public:
     void clear() {
         _type = HLL_DATA_EMPTY;
         _hash_set.clear();
+        _sparse_registers.clear();
     }
 
 private:
     HllDataType _type = HLL_DATA_EMPTY;
     phmap::flat_hash_set<uint64_t> _hash_set;
 
+    // The non-zero registers of HLL_DATA_SPARSE sorted by the index, each is (index << 8 | value).
+    std::vector<uint32_t> _sparse_registers;
+
     // This field is much space consumming(HLL_REGISTERS_COUNT), we create
     // it only when it is really needed.
     // Allocate memory by ChunkAllocator in order to reuse memory.
@@ -217,20 +233,42 @@ private:
 private:
     void _convert_explicit_to_register();
 
+    // Convert explicit values to the sparse registers, and change _type to HLL_DATA_SPARSE.
+    void _convert_explicit_to_sparse();
+
+    // Convert the sparse registers to the full registers, and change _type to HLL_DATA_FULL.
+    void _convert_sparse_to_full();
+
+    // Sort the sparse registers and remove the duplicated ones, convert them to the full registers
+    // if there are too many of them.
+    void _normalize_sparse_registers();
+
     // absorb other registers into this registers
     void _merge_registers(uint8_t* other_registers);
 
-    // update one hash value into this registers
-    void _update_registers(uint64_t hash_value) {
-        // Use the lower bits to index into the number of streams and then
-        // find the first 1 bit after the index bits.
-        int idx = hash_value % HLL_REGISTERS_COUNT;
+    // absorb other sparse registers into this registers, this sparse registers may become full.
+    void _merge_sparse_registers(const std::vector<uint32_t>& other_registers);
+
+    // Use the lower bits to index into the number of streams and then
+    // find the first 1 bit after the index bits.
+    static void _hash_to_register(uint64_t hash_value, uint32_t* idx, uint8_t* first_one_bit) {
+        *idx = hash_value % HLL_REGISTERS_COUNT;
         hash_value >>= HLL_COLUMN_PRECISION;
         // make sure max first_one_bit is HLL_ZERO_COUNT_BITS + 1
         hash_value |= ((uint64_t)1 << HLL_ZERO_COUNT_BITS);
-        uint8_t first_one_bit = __builtin_ctzl(hash_value) + 1;
+        *first_one_bit = __builtin_ctzl(hash_value) + 1;
+    }
+
+    // update one hash value into this registers
+    void _update_registers(uint64_t hash_value) {
+        uint32_t idx;
+        uint8_t first_one_bit;
+        _hash_to_register(hash_value, &idx, &first_one_bit);
         _registers.data[idx] = std::max((uint8_t)_registers.data[idx], first_one_bit);
     }
+
+    // update one register of the sparse registers, which may become full.
+    void _update_sparse_register(uint32_t idx, uint8_t value);
 };
 
 // todo(kks): remove this when dpp_sink class was removed
@@ -21,12 +21,17 @@
 
 #include "storage/kv_store.h"
 
+#include <algorithm>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "rocksdb/db.h"
+#include "rocksdb/listener.h"
 #include "rocksdb/options.h"
 #include "rocksdb/slice.h"
 #include "rocksdb/slice_transform.h"
@@ -34,6 +39,7 @@
 #include "storage/rocksdb_status_adapter.h"
 #include "util/runtime_profile.h"
 #include "util/starrocks_metrics.h"
+#include "util/time.h"
 
 using rocksdb::DB;
 using rocksdb::DBOptions;
@@ -51,6 +57,51 @@ const std::string META_POSTFIX = "/meta"; // NOLINT
 const std::string SECOND_POSTFIX = "_secondary";
 const size_t PREFIX_LENGTH = 4;
 
+// Counts the write stalls of the column families, and the time from a stall begins to the writes are normal again.
+class WriteStallListener : public rocksdb::EventListener {
+public:
+    void OnStallConditionsChanged(const rocksdb::WriteStallInfo& info) override {
+        using rocksdb::WriteStallCondition;
+        if (info.condition.cur == WriteStallCondition::kDelayed) {
+            StarRocksMetrics::instance()->meta_write_delayed_total.increment(1);
+        } else if (info.condition.cur == WriteStallCondition::kStopped) {
+            StarRocksMetrics::instance()->meta_write_stopped_total.increment(1);
+        }
+        LOG(INFO) << "meta column family " << info.cf_name << " write stall condition changed from "
+                  << static_cast<int>(info.condition.prev) << " to " << static_cast<int>(info.condition.cur);
+
+        std::lock_guard l(_mutex);
+        if (info.condition.prev == WriteStallCondition::kNormal) {
+            _stall_start_us[info.cf_name] = MonotonicMicros();
+        } else if (info.condition.cur == WriteStallCondition::kNormal) {
+            auto iter = _stall_start_us.find(info.cf_name);
+            if (iter != _stall_start_us.end()) {
+                StarRocksMetrics::instance()->meta_write_stall_duration_us.increment(MonotonicMicros() -
+                                                                                      iter->second);
+                _stall_start_us.erase(iter);
+            }
+        }
+    }
+
+private:
+    std::mutex _mutex;
+    std::unordered_map<std::string, int64_t> _stall_start_us;
+};
+
+// The metas are written by many small writes, and read by point lookups and prefix scans. The larger memtables and
+// level 0 triggers than the defaults absorb the bursts of the commits without stalling the writes.
+static ColumnFamilyOptions meta_column_family_options() {
+    ColumnFamilyOptions options;
+    options.write_buffer_size = config::meta_store_write_buffer_size;
+    options.max_write_buffer_number = config::meta_store_max_write_buffer_number;
+    options.min_write_buffer_number_to_merge = 1;
+    options.level0_file_num_compaction_trigger = 4;
+    options.level0_slowdown_writes_trigger = config::meta_store_level0_slowdown_writes_trigger;
+    options.level0_stop_writes_trigger =
+            std::max(config::meta_store_level0_stop_writes_trigger, config::meta_store_level0_slowdown_writes_trigger);
+    return options;
+}
+
 KVStore::KVStore(std::string root_path) : _root_path(std::move(root_path)), _db(nullptr) {}
 
 KVStore::~KVStore() {
@@ -69,6 +120,8 @@ Status KVStore::init(bool read_only) {
     options.IncreaseParallelism();
     options.create_if_missing = true;
     options.create_missing_column_families = true;
+    options.enable_pipelined_write = config::meta_store_pipelined_write;
+    options.listeners.emplace_back(std::make_shared<WriteStallListener>());
     std::string db_path = _root_path + META_POSTFIX;
 
     // The index of each column family must be consistent with the enum `ColumnFamilyIndex`
@@ -76,7 +129,9 @@ Status KVStore::init(bool read_only) {
     std::vector<ColumnFamilyDescriptor> cf_descs(NUM_COLUMN_FAMILY_INDEX);
     cf_descs[0].name = DEFAULT_COLUMN_FAMILY;
     cf_descs[1].name = STARROCKS_COLUMN_FAMILY;
+    cf_descs[1].options = meta_column_family_options();
     cf_descs[2].name = META_COLUMN_FAMILY;
+    cf_descs[2].options = meta_column_family_options();
     cf_descs[2].options.prefix_extractor.reset(NewFixedPrefixTransform(PREFIX_LENGTH));
     static_assert(NUM_COLUMN_FAMILY_INDEX == 3);
 
@@ -7,6 +7,7 @@
 #include "column/json_column.h"
 #include "column/type_traits.h"
 #include "common/logging.h"
+#include "exec/vectorized/sorting/merge.h"
 #include "exec/vectorized/sorting/sorting.h"
 #include "runtime/current_thread.h"
 #include "runtime/primitive_type_infra.h"
@@ -16,6 +17,7 @@
 #include "storage/schema.h"
 #include "util/orlp/pdqsort.h"
 #include "util/starrocks_metrics.h"
+#include "util/threadpool.h"
 #include "util/time.h"
 
 namespace starrocks::vectorized {
@@ -359,8 +361,105 @@ void MemTable::_sort_column_inc() {
         null_firsts.push_back(-1);
     }
 
-    Status st = stable_sort_and_tie_columns(false, columns, sort_orders, null_firsts, &_permutations);
+    size_t num_rows = _chunk->num_rows();
+    size_t num_partitions = 1;
+    if (_parallel_pool != nullptr && config::memtable_parallel_sort_rows_per_partition > 0) {
+        num_partitions = std::min<size_t>(num_rows / config::memtable_parallel_sort_rows_per_partition,
+                                          config::memtable_flush_parallel_thread_num + 1);
+    }
+    Status st;
+    if (num_partitions > 1) {
+        st = _parallel_sort_columns(columns, sort_orders, null_firsts, num_partitions);
+    } else {
+        st = stable_sort_and_tie_columns(false, columns, sort_orders, null_firsts, &_permutations);
+    }
     CHECK(st.ok());
 }
 
+// Sort the key columns of contiguous partitions of rows in parallel, and then merge the sorted runs in a
+// tree of parallel two-way merges. The merges take the rows of the left run first on equal keys, so the
+// result is as stable as the sort of the whole chunk.
+Status MemTable::_parallel_sort_columns(const Columns& columns, const std::vector<int>& sort_orders,
+                                        const std::vector<int>& null_firsts, size_t num_partitions) {
+    const size_t num_rows = columns[0]->size();
+    const size_t partition_rows = (num_rows + num_partitions - 1) / num_partitions;
+    num_partitions = (num_rows + partition_rows - 1) / partition_rows;
+    MemTracker* mem_tracker = tls_mem_tracker;
+
+    // the sorted key columns of each run, and the row ids in |_chunk| of their rows
+    std::vector<Columns> runs(num_partitions);
+    std::vector<std::vector<uint32_t>> run_rowids(num_partitions);
+    RETURN_IF_ERROR(parallel_run(_parallel_pool, num_partitions, [&](size_t i) {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+        const size_t from = i * partition_rows;
+        const size_t count = std::min(partition_rows, num_rows - from);
+        Columns partition;
+        for (const auto& column : columns) {
+            partition.emplace_back(column->clone_empty());
+            partition.back()->append(*column, from, count);
+        }
+        SmallPermutation perm = create_small_permutation(count);
+        RETURN_IF_ERROR(stable_sort_and_tie_columns(false, partition, sort_orders, null_firsts, &perm));
+        std::vector<uint32_t> selective(count);
+        run_rowids[i].resize(count);
+        for (size_t j = 0; j < count; j++) {
+            selective[j] = perm[j].index_in_chunk;
+            run_rowids[i][j] = from + perm[j].index_in_chunk;
+        }
+        for (auto& column : partition) {
+            ColumnPtr sorted = column->clone_empty();
+            sorted->append_selective(*column, selective.data(), 0, count);
+            runs[i].emplace_back(std::move(sorted));
+        }
+        return Status::OK();
+    }));
+
+    Chunk::SlotHashMap slot_map;
+    for (int i = 0; i < columns.size(); i++) {
+        slot_map[i] = i;
+    }
+    SortDescs sort_descs(sort_orders, null_firsts);
+    while (runs.size() > 1) {
+        const size_t num_merges = runs.size() / 2;
+        // the key columns are not needed by the last merge
+        const bool is_last = runs.size() == 2;
+        std::vector<Columns> merged_runs((runs.size() + 1) / 2);
+        std::vector<std::vector<uint32_t>> merged_rowids(merged_runs.size());
+        RETURN_IF_ERROR(parallel_run(_parallel_pool, num_merges, [&](size_t i) {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            const Columns& left = runs[2 * i];
+            const Columns& right = runs[2 * i + 1];
+            auto left_chunk = std::make_shared<Chunk>(left, slot_map);
+            auto right_chunk = std::make_shared<Chunk>(right, slot_map);
+            Permutation perm;
+            RETURN_IF_ERROR(merge_sorted_chunks_two_way(sort_descs, {left_chunk, left}, {right_chunk, right}, &perm));
+            auto& rowids = merged_rowids[i];
+            rowids.resize(perm.size());
+            for (size_t j = 0; j < perm.size(); j++) {
+                rowids[j] = run_rowids[2 * i + perm[j].chunk_index][perm[j].index_in_chunk];
+            }
+            if (!is_last) {
+                for (int c = 0; c < left.size(); c++) {
+                    ColumnPtr merged = left[c]->clone_empty();
+                    append_by_permutation(merged.get(), {left[c], right[c]}, perm);
+                    merged_runs[i].emplace_back(std::move(merged));
+                }
+            }
+            return Status::OK();
+        }));
+        if (runs.size() % 2 == 1) {
+            merged_runs.back() = std::move(runs.back());
+            merged_rowids.back() = std::move(run_rowids.back());
+        }
+        runs = std::move(merged_runs);
+        run_rowids = std::move(merged_rowids);
+    }
+
+    DCHECK_EQ(num_rows, run_rowids[0].size());
+    for (size_t i = 0; i < num_rows; i++) {
+        _permutations[i].index_in_chunk = run_rowids[0][i];
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks::vectorized
@@ -15,6 +15,7 @@ namespace starrocks {
 class RowsetWriter;
 class SlotDescriptor;
 class TabletSchema;
+class ThreadPool;
 
 namespace vectorized {
 
@@ -46,11 +47,19 @@ public:
 
     bool is_full() const;
 
+    // Sort a large memtable in parallel in |pool|, see config::memtable_parallel_sort_rows_per_partition.
+    void set_parallel_pool(ThreadPool* pool) { _parallel_pool = pool; }
+
+    // Override config::write_buffer_size, the size at which `insert()` suggests flushing this memory table.
+    void set_max_buffer_size(int64_t max_buffer_size) { _max_buffer_size = max_buffer_size; }
+
 private:
     void _merge();
 
     void _sort(bool is_final);
     void _sort_column_inc();
+    Status _parallel_sort_columns(const Columns& columns, const std::vector<int>& sort_orders,
+                                  const std::vector<int>& null_firsts, size_t num_partitions);
     void _append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final);
 
     void _aggregate(bool is_final);
@@ -73,6 +82,7 @@ private:
     KeysType _keys_type;
 
     RowsetWriter* _rowset_writer;
+    ThreadPool* _parallel_pool = nullptr;
 
     // aggregate
     std::unique_ptr<ChunkAggregator> _aggregator;
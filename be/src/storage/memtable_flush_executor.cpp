@@ -23,6 +23,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "runtime/current_thread.h"
 #include "storage/memtable.h"
 
@@ -89,10 +90,17 @@ Status MemTableFlushExecutor::init(const std::vector<DataDir*>& data_dirs) {
     int data_dir_num = static_cast<int>(data_dirs.size());
     int min_threads = std::max<int>(1, config::flush_thread_num_per_store);
     int max_threads = data_dir_num * min_threads;
-    return ThreadPoolBuilder("mem_tab_flush") // mem table flush
-            .set_min_threads(min_threads)
-            .set_max_threads(max_threads)
-            .build(&_flush_pool);
+    RETURN_IF_ERROR(ThreadPoolBuilder("mem_tab_flush") // mem table flush
+                            .set_min_threads(min_threads)
+                            .set_max_threads(max_threads)
+                            .build(&_flush_pool));
+    if (config::memtable_flush_parallel_thread_num > 0) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("mem_tab_parallel")
+                                .set_min_threads(0)
+                                .set_max_threads(config::memtable_flush_parallel_thread_num)
+                                .build(&_parallel_pool));
+    }
+    return Status::OK();
 }
 
 std::unique_ptr<FlushToken> MemTableFlushExecutor::create_flush_token(ThreadPool::ExecutionMode execution_mode) {
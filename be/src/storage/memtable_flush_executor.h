@@ -122,8 +122,13 @@ public:
     std::unique_ptr<FlushToken> create_flush_token(
             ThreadPool::ExecutionMode execution_mode = ThreadPool::ExecutionMode::SERIAL);
 
+    // The pool to sort a large memtable and encode the columns of a large chunk in parallel
+    // within one flush, or nullptr if disabled.
+    ThreadPool* parallel_pool() { return _parallel_pool.get(); }
+
 private:
     std::unique_ptr<ThreadPool> _flush_pool;
+    std::unique_ptr<ThreadPool> _parallel_pool;
 };
 
 } // namespace starrocks
@@ -2,6 +2,7 @@
 
 #include "storage/merge_iterator.h"
 
+#include <algorithm>
 #include <boost/heap/skew_heap.hpp>
 #include <memory>
 #include <queue>
@@ -68,9 +69,41 @@ public:
         return (r < 0) | ((r == 0) & (_order < rhs._order));
     }
 
+    // return the number of rows, starting from the compared row and at most |max_rows|, which are less than
+    // the compared row of |rhs|. The compared row of |this| must be less than that of |rhs|.
+    // The rows are found by a galloping search, so a run of only one row costs one comparison, and a long
+    // run costs a logarithmic number of comparisons rather than one heap operation per row.
+    size_t num_rows_less_than(const ComparableChunk& rhs, size_t max_rows) const {
+        size_t end = std::min<size_t>(_chunk->num_rows(), _compared_row + max_rows);
+        // row |lo| is less than |rhs|, and row |hi| is not less than |rhs| if it's before |end|.
+        size_t lo = _compared_row;
+        size_t hi = lo + 1;
+        size_t step = 1;
+        while (hi < end && row_less_than(hi, rhs)) {
+            lo = hi;
+            step *= 2;
+            hi = lo + step;
+        }
+        hi = std::min(hi, end);
+        while (lo + 1 < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (row_less_than(mid, rhs)) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo + 1 - _compared_row;
+    }
+
 private:
     friend class HeapMergeIterator;
 
+    bool row_less_than(size_t row, const ComparableChunk& rhs) const {
+        int r = compare_chunk(_key_columns, *_chunk, row, *rhs._chunk, rhs._compared_row);
+        return (r < 0) | ((r == 0) & (_order < rhs._order));
+    }
+
     // used to determinate the order of two rows when their key columns are all equals.
     uint16_t _order;
     uint16_t _key_columns;
@@ -209,11 +242,14 @@ inline Status HeapMergeIterator::do_get_next(Chunk* chunk, std::vector<RowSource
             }
         }
 
-        chunk->append(*min_chunk._chunk, offset, 1);
-        min_chunk.advance(1);
-        rows += 1;
+        // all the rows of |min_chunk| less than the next smallest row of the other chunks are copied at once.
+        size_t run_rows = _heap.empty() ? std::min(min_chunk.remaining_rows(), _chunk_size - rows)
+                                        : min_chunk.num_rows_less_than(_heap.top(), _chunk_size - rows);
+        chunk->append(*min_chunk._chunk, offset, run_rows);
+        min_chunk.advance(run_rows);
+        rows += run_rows;
         if (source_masks) {
-            source_masks->emplace_back(RowSourceMask{min_chunk._order, false});
+            source_masks->insert(source_masks->end(), run_rows, RowSourceMask{min_chunk._order, false});
         }
         if (min_chunk.remaining_rows() > 0) {
             _heap.push(min_chunk);
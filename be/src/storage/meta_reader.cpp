@@ -2,6 +2,7 @@
 
 #include "storage/meta_reader.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "column/datum_convert.h"
@@ -15,7 +16,7 @@
 
 namespace starrocks::vectorized {
 
-std::vector<std::string> SegmentMetaCollecter::support_collect_fields = {"dict_merge", "max", "min"};
+std::vector<std::string> SegmentMetaCollecter::support_collect_fields = {"dict_merge", "max", "min", "rows"};
 
 Status SegmentMetaCollecter::parse_field_and_colname(const std::string& item, std::string* field,
                                                      std::string* col_name) {
@@ -142,6 +143,19 @@ Status MetaReader::_get_segments(const TabletSharedPtr& tablet, const Version& v
     }
     Rowset::acquire_readers(_rowsets);
 
+    // The row count of a segment is the count of the tablet only if the rows are neither merged nor deleted.
+    const auto& fields = _collect_context.seg_collecter_params.fields;
+    if (std::find(fields.begin(), fields.end(), "rows") != fields.end()) {
+        if (tablet->keys_type() != DUP_KEYS) {
+            return Status::NotSupported("rows can only be collected from the tablets of duplicate keys");
+        }
+        for (auto& rs : _rowsets) {
+            if (rs->rowset_meta()->has_delete_predicate()) {
+                return Status::NotSupported("rows can't be collected from the tablets with delete predicates");
+            }
+        }
+    }
+
     for (auto& rs : _rowsets) {
         RETURN_IF_ERROR(rs->load());
         auto beta_rowset = down_cast<BetaRowset*>(rs.get());
@@ -282,6 +296,8 @@ Status SegmentMetaCollecter::_collect(const std::string& name, ColumnId cid, vec
         return _collect_max(cid, column, type);
     } else if (name == "min") {
         return _collect_min(cid, column, type);
+    } else if (name == "rows") {
+        return _collect_rows(column);
     }
     return Status::NotSupported("Not Support Collect Meta: " + name);
 }
@@ -327,12 +343,18 @@ Status SegmentMetaCollecter::_collect_min(ColumnId cid, vectorized::Column* colu
     return __collect_max_or_min<false>(cid, column, type);
 }
 
+// collect the number of rows recorded in the footer, so count(*) doesn't read any data page
+Status SegmentMetaCollecter::_collect_rows(vectorized::Column* column) {
+    column->append_datum(vectorized::Datum(static_cast<int64_t>(_segment->num_rows())));
+    return Status::OK();
+}
+
 template <bool is_max>
 Status SegmentMetaCollecter::__collect_max_or_min(ColumnId cid, vectorized::Column* column, FieldType type) {
     if (cid >= _segment->num_columns()) {
         return Status::NotFound("");
     }
-    const ColumnReader* col_reader = _segment->column(cid);
+    ASSIGN_OR_RETURN(auto col_reader, _segment->column(cid));
     if (col_reader == nullptr || col_reader->segment_zone_map() == nullptr) {
         return Status::NotFound("");
     }
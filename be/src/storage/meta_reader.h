@@ -51,7 +51,7 @@ struct SegmentMetaCollecterParams {
 };
 
 // MetaReader will implements
-// 1. read meta info from segment footer
+// 1. read meta info from segment footer, e.g. max, min and rows
 // 2. read dict info from dict page if column is dict encoding type
 class MetaReader {
 public:
@@ -123,6 +123,7 @@ private:
     Status _collect_dict(ColumnId cid, vectorized::Column* column, FieldType type);
     Status _collect_max(ColumnId cid, vectorized::Column* column, FieldType type);
     Status _collect_min(ColumnId cid, vectorized::Column* column, FieldType type);
+    Status _collect_rows(vectorized::Column* column);
     template <bool is_max>
     Status __collect_max_or_min(ColumnId cid, vectorized::Column* column, FieldType type);
     SegmentSharedPtr _segment;
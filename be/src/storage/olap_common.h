@@ -409,6 +409,11 @@ struct OlapReaderStatistics {
     // total read bytes in memory
     int64_t bytes_read = 0;
 
+    // count of the data pages served by the readahead of segment iterators,
+    // and the bytes read by the coalesced readahead io.
+    int64_t readahead_pages = 0;
+    int64_t readahead_bytes = 0;
+
     int64_t block_load_ns = 0;
     int64_t blocks_load = 0;
     int64_t block_fetch_ns = 0; // time of rowset reader's `next_batch()` call
@@ -435,6 +440,7 @@ struct OlapReaderStatistics {
     int64_t rows_key_range_filtered = 0;
     int64_t rows_stats_filtered = 0;
     int64_t rows_bf_filtered = 0;
+    int64_t rows_ngram_index_filtered = 0;
     int64_t rows_del_filtered = 0;
     int64_t del_filter_ns = 0;
 
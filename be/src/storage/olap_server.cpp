@@ -153,6 +153,10 @@ Status StorageEngine::start_bg_threads() {
     Thread::set_thread_name(_fd_cache_clean_thread, "fd_cache_clean");
     LOG(INFO) << "fd cache clean thread started";
 
+    _hot_tablets_thread = std::thread([this] { _hot_tablets_thread_callback(nullptr); });
+    Thread::set_thread_name(_hot_tablets_thread, "hot_tablets");
+    LOG(INFO) << "hot tablets thread started";
+
     // path scan and gc thread
     if (config::path_gc_check) {
         for (auto data_dir : get_stores()) {
@@ -186,6 +190,33 @@ void* StorageEngine::_fd_cache_clean_callback(void* arg) {
     return nullptr;
 }
 
+void* StorageEngine::_hot_tablets_thread_callback(void* arg) {
+#ifdef GOOGLE_PROFILER
+    ProfilerRegisterThread();
+#endif
+    if (config::storage_warmup_hot_tablet_num > 0) {
+        _warmup_hot_tablets();
+    }
+    while (!_bg_worker_stopped.load(std::memory_order_consume)) {
+        int32_t interval = config::storage_warmup_record_interval_seconds;
+        if (interval <= 0) {
+            LOG(WARNING) << "config of hot tablets record interval is illegal: " << interval << "force set to 600";
+            interval = 600;
+        }
+        SLEEP_IN_BG_WORKER(interval);
+
+        if (config::storage_warmup_hot_tablet_num > 0) {
+            _save_hot_tablets();
+        }
+    }
+    // Record the hot tablets when BE stops, so they are warmed up after it restarts.
+    if (config::storage_warmup_hot_tablet_num > 0) {
+        _save_hot_tablets();
+    }
+
+    return nullptr;
+}
+
 void* StorageEngine::_base_compaction_thread_callback(void* arg, DataDir* data_dir) {
 #ifdef GOOGLE_PROFILER
     ProfilerRegisterThread();
@@ -23,10 +23,13 @@
 
 #include <malloc.h>
 
+#include "common/config.h"
+#include "gutil/hash/city.h"
 #include "runtime/current_thread.h"
 #include "runtime/mem_tracker.h"
 #include "util/defer_op.h"
 #include "util/metrics.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks {
 
@@ -46,15 +49,26 @@ void StoragePageCache::release_global_cache() {
 }
 
 StoragePageCache::StoragePageCache(MemTracker* mem_tracker, size_t capacity)
-        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity)) {}
+        : _mem_tracker(mem_tracker), _capacity(capacity), _cache(new_lru_cache(capacity)) {}
 
 StoragePageCache::~StoragePageCache() {}
 
+StoragePageCache::FileId StoragePageCache::file_id(const std::string& fname) {
+    return util_hash::CityHash128(fname.data(), fname.size());
+}
+
+bool StoragePageCache::is_large_scan(int64_t scan_bytes) const {
+    const double ratio = config::storage_page_cache_large_scan_ratio;
+    return ratio > 0 && scan_bytes > _capacity * ratio;
+}
+
 bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle) {
+    StarRocksMetrics::instance()->page_cache_lookup_total.increment(1);
     auto* lru_handle = _cache->lookup(key.encode());
     if (lru_handle == nullptr) {
         return false;
     }
+    StarRocksMetrics::instance()->page_cache_hit_total.increment(1);
     *handle = PageCacheHandle(_cache.get(), lru_handle);
     return true;
 }
@@ -68,13 +82,18 @@ void StoragePageCache::insert(const CacheKey& key, const Slice& data, PageCacheH
     DeferOp op([&] { tls_thread_status.set_mem_tracker(prev_tracker); });
 #endif
 
-    auto deleter = [](const starrocks::CacheKey& key, void* value) { delete[](uint8_t*) value; };
+    // The deleter is called when the page is evicted, or replaced by the same page inserted concurrently.
+    auto deleter = [](const starrocks::CacheKey& key, void* value) {
+        StarRocksMetrics::instance()->page_cache_evict_total.increment(1);
+        delete[](uint8_t*) value;
+    };
 
     CachePriority priority = CachePriority::NORMAL;
     if (in_memory) {
         priority = CachePriority::DURABLE;
     }
 
+    StarRocksMetrics::instance()->page_cache_insert_total.increment(1);
     auto* lru_handle = _cache->insert(key.encode(), data.data, data.size, deleter, priority);
     *handle = PageCacheHandle(_cache.get(), lru_handle);
 }
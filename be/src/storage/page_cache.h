@@ -21,10 +21,12 @@
 
 #pragma once
 
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
 
+#include "gutil/int128.h"
 #include "gutil/macros.h" // for DISALLOW_COPY_AND_ASSIGN
 #include "runtime/current_thread.h"
 #include "util/defer_op.h"
@@ -37,27 +39,36 @@ class MemTracker;
 
 // Warpper around Cache, and used for cache page of column datas
 // in Segment.
-// TODO(zc): We should add some metric to see cache hit/miss rate.
+// The hit/miss/insert/eviction counts are reported by StarRocksMetrics as `page_cache`.
 class StoragePageCache {
 public:
     virtual ~StoragePageCache();
+
+    // The identifier of a file in the page cache, which is the 128-bit fingerprint of the file path.
+    // Segment computes it once when it's created, so that the path isn't encoded into the key of
+    // each page lookup.
+    using FileId = uint128;
+
+    static FileId file_id(const std::string& fname);
+
     // The unique key identifying entries in the page cache.
     // Each cached page corresponds to a specific offset within
     // a file.
-    //
-    // TODO(zc): Now we use file name(std::string) as a part of
-    // key, which is not efficient. We should make it better later
     struct CacheKey {
-        CacheKey(std::string fname_, int64_t offset_) : fname(std::move(fname_)), offset(offset_) {}
-        std::string fname;
-        int64_t offset;
-
-        // Encode to a flat binary which can be used as LRUCache's key
-        std::string encode() const {
-            std::string key_buf(fname);
-            key_buf.append((char*)&offset, sizeof(offset));
-            return key_buf;
+        CacheKey(const FileId& file_id, int64_t offset) {
+            uint64_t high = Uint128High64(file_id);
+            uint64_t low = Uint128Low64(file_id);
+            memcpy(_data, &high, sizeof(high));
+            memcpy(_data + sizeof(high), &low, sizeof(low));
+            memcpy(_data + sizeof(high) + sizeof(low), &offset, sizeof(offset));
         }
+        CacheKey(const std::string& fname, int64_t offset) : CacheKey(file_id(fname), offset) {}
+
+        // The flat binary used as LRUCache's key, which refers to this CacheKey.
+        starrocks::CacheKey encode() const { return {_data, sizeof(_data)}; }
+
+    private:
+        char _data[2 * sizeof(uint64_t) + sizeof(int64_t)];
     };
 
     // Create global instance of this class
@@ -89,10 +100,15 @@ public:
 
     size_t memory_usage() const { return _cache->get_memory_usage(); }
 
+    // Whether a scan reading |scan_bytes| is so large that it should only look up the cache without
+    // inserting the pages it reads, see config `storage_page_cache_large_scan_ratio`.
+    bool is_large_scan(int64_t scan_bytes) const;
+
 private:
     static StoragePageCache* _s_instance;
 
     MemTracker* _mem_tracker = nullptr;
+    const size_t _capacity;
     std::unique_ptr<Cache> _cache = nullptr;
 };
 
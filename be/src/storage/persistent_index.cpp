@@ -4,7 +4,9 @@
 
 #include <cstring>
 #include <numeric>
+#include <set>
 
+#include "common/config.h"
 #include "gutil/strings/substitute.h"
 #include "storage/chunk_helper.h"
 #include "storage/fs/fs_util.h"
@@ -41,6 +43,8 @@ constexpr size_t l0_snapshot_size_max = 4 * 1024 * 1024;
 constexpr size_t l0_flush_size_min = 8 * 1024 * 1024;
 // perform l0 l1 merge compaction if l1_file_size / l0_memory >= this value and l0_memory > l0_snapshot_size_max
 constexpr size_t l0_l1_merge_ratio = 10;
+// false positive probability of the bloom filters of the l1 tier shards
+constexpr double l1_tier_bloom_filter_fpp = 0.01;
 
 const char* const index_file_magic = "IDX1";
 
@@ -90,6 +94,12 @@ uint64_t key_index_hash(const void* data, size_t len) {
     return XXH3_64bits(data, len);
 }
 
+// The keys in a shard share the most significant bits of their hashes, which the block split bloom filter uses to
+// select the block, so the hash is remixed before being added to the bloom filter of a shard.
+static uint64_t bloom_filter_hash(uint64_t hash) {
+    return hash * 0x9E3779B97F4A7C15ULL;
+}
+
 static std::tuple<size_t, size_t> estimate_nshard_and_npage(size_t kv_size, size_t size, size_t usage_percent) {
     // if size == 0, will return { nshard:1, npage:0 }, meaning an empty shard
     size_t usage = size * kv_size;
@@ -436,8 +446,10 @@ public:
         }
     }
 
-    Status init(const string& dir, const EditVersion& version) {
+    // |write_bloom_filter|: write the bloom filter of each shard after the pages of the shard
+    Status init(const string& dir, const EditVersion& version, bool write_bloom_filter) {
         _version = version;
+        _write_bloom_filter = write_bloom_filter;
         _idx_file_path = strings::Substitute("$0/index.l1.$1.$2", dir, version.major(), version.minor());
         _idx_file_path_tmp = _idx_file_path + ".tmp";
         ASSIGN_OR_RETURN(_block_mgr, fs::fs_util::block_manager(_idx_file_path_tmp));
@@ -468,6 +480,18 @@ public:
         auto ptr_meta = shard_meta->mutable_data();
         ptr_meta->set_offset(pos_before);
         ptr_meta->set_size(pos_after - pos_before);
+        if (_write_bloom_filter && !kvs.empty()) {
+            std::unique_ptr<BloomFilter> bf;
+            RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, &bf));
+            RETURN_IF_ERROR(bf->init(kvs.size(), l1_tier_bloom_filter_fpp, HASH_MURMUR3_X64_64));
+            for (const auto& kv : kvs) {
+                bf->add_hash(bloom_filter_hash(kv.hash));
+            }
+            auto bf_meta = shard_meta->mutable_bloom_filter();
+            bf_meta->set_offset(_wb->bytes_appended());
+            bf_meta->set_size(bf->size());
+            RETURN_IF_ERROR(_wb->append(Slice(bf->data(), bf->size())));
+        }
         _total += kvs.size();
         _total_moved += shard->num_entry_moved;
         _total_kv_size += kvs.size() * kv_size;
@@ -507,6 +531,7 @@ private:
     string _idx_file_path;
     std::shared_ptr<fs::BlockManager> _block_mgr;
     std::unique_ptr<fs::WritableBlock> _wb;
+    bool _write_bloom_filter = false;
     size_t _nshard = 0;
     size_t _fixed_key_size = 0;
     size_t _fixed_value_size = 0;
@@ -692,14 +717,15 @@ public:
         return ret;
     }
 
-    Status flush_to_immutable_index(const std::string& dir, const EditVersion& version) const override {
+    Status flush_to_immutable_index(const std::string& dir, const EditVersion& version,
+                                    bool as_tier) const override {
         size_t value_size = sizeof(IndexValue);
         size_t kv_size = KeySize + value_size;
         auto [nshard, npage_hint] = estimate_nshard_and_npage(kv_size, size(), default_usage_percent);
         ImmutableIndexWriter writer;
-        RETURN_IF_ERROR(writer.init(dir, version));
+        RETURN_IF_ERROR(writer.init(dir, version, as_tier));
         if (nshard > 0) {
-            auto kv_ref_by_shard = get_kv_refs_by_shard(nshard, size(), true);
+            auto kv_ref_by_shard = get_kv_refs_by_shard(nshard, size(), !as_tier);
             for (auto& kvs : kv_ref_by_shard) {
                 RETURN_IF_ERROR(writer.write_shard(KeySize, value_size, npage_hint, kvs));
             }
@@ -805,38 +831,75 @@ Status ImmutableIndex::_get_kvs_for_shard(std::vector<std::vector<KVRef>>& kvs_b
     return Status::OK();
 }
 
+static void add_key_to_next_level(const KeysInfo& keys_info, size_t i, KeysInfo* next_level) {
+    if (next_level != nullptr) {
+        next_level->key_idxes.emplace_back(keys_info.key_idxes[i]);
+        next_level->hashes.emplace_back(keys_info.hashes[i]);
+    }
+}
+
 Status ImmutableIndex::_get_in_shard(size_t shard_idx, size_t n, const void* keys, const KeysInfo& keys_info,
-                                     IndexValue* values, size_t* num_found) const {
+                                     IndexValue* values, size_t* num_found, KeysInfo* next_level) const {
     const auto& shard_info = _shards[shard_idx];
-    if (shard_info.size == 0 || shard_info.npage == 0 || keys_info.size() == 0) {
+    if (keys_info.size() == 0) {
         return Status::OK();
     }
+    if (shard_info.size == 0 || shard_info.npage == 0) {
+        for (size_t i = 0; i < keys_info.size(); i++) {
+            add_key_to_next_level(keys_info, i, next_level);
+        }
+        return Status::OK();
+    }
+    // filter out the keys not in this shard by the bloom filter, and skip reading the shard if no key is left
+    KeysInfo bf_checked;
+    const KeysInfo* checks = &keys_info;
+    if (shard_info.bloom_filter != nullptr) {
+        for (size_t i = 0; i < keys_info.size(); i++) {
+            if (shard_info.bloom_filter->test_hash(bloom_filter_hash(keys_info.hashes[i]))) {
+                bf_checked.key_idxes.emplace_back(keys_info.key_idxes[i]);
+                bf_checked.hashes.emplace_back(keys_info.hashes[i]);
+            } else {
+                values[keys_info.key_idxes[i]] = NullIndexValue;
+                add_key_to_next_level(keys_info, i, next_level);
+            }
+        }
+        if (bf_checked.size() == 0) {
+            return Status::OK();
+        }
+        checks = &bf_checked;
+    }
     size_t found = 0;
     std::unique_ptr<ImmutableIndexShard> shard = std::make_unique<ImmutableIndexShard>(shard_info.npage);
     CHECK(shard->pages.size() * page_size == shard_info.bytes) << "illegal shard size";
     RETURN_IF_ERROR(_rb->read(shard_info.offset, Slice((uint8_t*)shard->pages.data(), shard_info.bytes)));
     uint8_t candidate_idxes[bucket_size_max];
-    for (size_t i = 0; i < keys_info.size(); i++) {
-        IndexHash h(keys_info.hashes[i]);
+    for (size_t i = 0; i < checks->size(); i++) {
+        IndexHash h(checks->hashes[i]);
         auto pageid = h.page() % shard_info.npage;
         auto bucketid = h.bucket();
         auto& bucket_info = shard->bucket(pageid, bucketid);
         uint8_t* bucket_pos = shard->pages[bucket_info.pageid].pack(bucket_info.packid);
         auto nele = bucket_info.size;
         auto ncandidates = get_matched_tag_idxes(bucket_pos, nele, h.tag(), candidate_idxes);
-        auto key_idx = keys_info.key_idxes[i];
+        auto key_idx = checks->key_idxes[i];
         const uint8_t* fixed_key_probe = (const uint8_t*)keys + _fixed_key_size * key_idx;
         auto kv_pos = bucket_pos + pad(nele, pack_size);
         values[key_idx] = NullIndexValue;
+        bool key_found = false;
         for (size_t candidate_idx = 0; candidate_idx < ncandidates; candidate_idx++) {
             auto idx = candidate_idxes[candidate_idx];
             auto candidate_kv = kv_pos + (_fixed_key_size + _fixed_value_size) * idx;
             if (strings::memeq(candidate_kv, fixed_key_probe, _fixed_key_size)) {
+                // the value of a deleted key in a tier file is NullIndexValue
                 values[key_idx] = UNALIGNED_LOAD64(candidate_kv + _fixed_key_size);
-                found++;
+                found += (values[key_idx] != NullIndexValue);
+                key_found = true;
                 break;
             }
         }
+        if (!key_found) {
+            add_key_to_next_level(*checks, i, next_level);
+        }
     }
     *num_found += found;
     return Status::OK();
@@ -854,6 +917,9 @@ Status ImmutableIndex::_check_not_exist_in_shard(size_t shard_idx, size_t n, con
     uint8_t candidate_idxes[bucket_size_max];
     for (size_t i = 0; i < keys_info.size(); i++) {
         IndexHash h(keys_info.hashes[i]);
+        if (shard_info.bloom_filter != nullptr && !shard_info.bloom_filter->test_hash(bloom_filter_hash(h.hash))) {
+            continue;
+        }
         auto pageid = h.page() % shard_info.npage;
         auto bucketid = h.bucket();
         auto& bucket_info = shard->bucket(pageid, bucketid);
@@ -886,16 +952,16 @@ static void split_keys_info_by_shard(const KeysInfo& keys_info, std::vector<Keys
 }
 
 Status ImmutableIndex::get(size_t n, const void* keys, const KeysInfo& keys_info, IndexValue* values,
-                           size_t* num_found) const {
+                           size_t* num_found, KeysInfo* next_level) const {
     size_t found = 0;
     if (_shards.size() > 1) {
         std::vector<KeysInfo> keys_info_by_shard(_shards.size());
         split_keys_info_by_shard(keys_info, keys_info_by_shard);
         for (size_t i = 0; i < _shards.size(); i++) {
-            RETURN_IF_ERROR(_get_in_shard(i, n, keys, keys_info_by_shard[i], values, &found));
+            RETURN_IF_ERROR(_get_in_shard(i, n, keys, keys_info_by_shard[i], values, &found, next_level));
         }
     } else {
-        RETURN_IF_ERROR(_get_in_shard(0, n, keys, keys_info, values, &found));
+        RETURN_IF_ERROR(_get_in_shard(0, n, keys, keys_info, values, &found, next_level));
     }
     *num_found += found;
     return Status::OK();
@@ -965,11 +1031,26 @@ StatusOr<std::unique_ptr<ImmutableIndex>> ImmutableIndex::load(std::unique_ptr<f
         dest.npage = src.npage();
         dest.offset = src.data().offset();
         dest.bytes = src.data().size();
+        if (src.has_bloom_filter() && src.bloom_filter().size() > 0) {
+            std::string bf_buff;
+            raw::stl_string_resize_uninitialized(&bf_buff, src.bloom_filter().size());
+            RETURN_IF_ERROR(rb->read(src.bloom_filter().offset(), bf_buff));
+            RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, &dest.bloom_filter));
+            RETURN_IF_ERROR(dest.bloom_filter->init(bf_buff.data(), bf_buff.size(), HASH_MURMUR3_X64_64));
+        }
     }
     idx->_rb.swap(rb);
     return std::move(idx);
 }
 
+size_t ImmutableIndex::memory_usage() const {
+    size_t usage = 0;
+    for (const auto& shard_info : _shards) {
+        usage += (shard_info.bloom_filter != nullptr) ? shard_info.bloom_filter->size() : 0;
+    }
+    return usage;
+}
+
 PersistentIndex::PersistentIndex(const std::string& path) : _path(path) {}
 
 PersistentIndex::~PersistentIndex() {
@@ -979,6 +1060,17 @@ PersistentIndex::~PersistentIndex() {
     if (_l1) {
         _l1->clear();
     }
+    for (auto& tier : _l1_tiers) {
+        tier->clear();
+    }
+}
+
+size_t PersistentIndex::memory_usage() const {
+    size_t usage = _l0 ? _l0->memory_usage() : 0;
+    for (const auto& tier : _l1_tiers) {
+        usage += tier->memory_usage();
+    }
+    return usage;
 }
 
 std::string PersistentIndex::_get_l0_index_file_name(std::string& dir, const EditVersion& version) {
@@ -1043,7 +1135,6 @@ Status PersistentIndex::_load(const PersistentIndexMetaPB& index_meta) {
     size_t snapshot_off = page_pb.offset();
     size_t snapshot_size = page_pb.size();
     std::unique_ptr<fs::ReadableBlock> rblock;
-    std::unique_ptr<fs::ReadableBlock> l1_rblock;
 
     std::string l0_index_file_name = _get_l0_index_file_name(_path, start_version);
     RETURN_IF_ERROR(_block_mgr->open_block(l0_index_file_name, &rblock));
@@ -1097,17 +1188,25 @@ Status PersistentIndex::_load(const PersistentIndexMetaPB& index_meta) {
 
     if (index_meta.has_l1_version()) {
         _l1_version = index_meta.l1_version();
-        auto l1_block_path = strings::Substitute("$0/index.l1.$1.$2", _path, _l1_version.major(), _l1_version.minor());
-        RETURN_IF_ERROR(_block_mgr->open_block(l1_block_path, &l1_rblock));
-        auto l1_st = ImmutableIndex::load(std::move(l1_rblock));
-        if (!l1_st.ok()) {
-            return l1_st.status();
-        }
-        _l1 = std::move(l1_st).value();
+        ASSIGN_OR_RETURN(_l1, _load_immutable_index(_l1_version));
+    }
+    _l1_tiers.clear();
+    _l1_tier_versions.clear();
+    for (const auto& version_pb : index_meta.l1_tier_versions()) {
+        _l1_tier_versions.emplace_back(version_pb);
+        ASSIGN_OR_RETURN(auto tier, _load_immutable_index(_l1_tier_versions.back()));
+        _l1_tiers.emplace_back(std::move(tier));
     }
     return Status::OK();
 }
 
+StatusOr<std::unique_ptr<ImmutableIndex>> PersistentIndex::_load_immutable_index(const EditVersion& version) {
+    std::unique_ptr<fs::ReadableBlock> rblock;
+    auto block_path = strings::Substitute("$0/index.l1.$1.$2", _path, version.major(), version.minor());
+    RETURN_IF_ERROR(_block_mgr->open_block(block_path, &rblock));
+    return ImmutableIndex::load(std::move(rblock));
+}
+
 Status PersistentIndex::_build_commit(Tablet* tablet, PersistentIndexMetaPB& index_meta) {
     // commit: flush _l0 and build _l1
     // write PersistentIndexMetaPB in RocksDB
@@ -1355,11 +1454,11 @@ Status PersistentIndex::abort() {
 }
 
 // There are four cases as below in commit
-//   1. _flush_l0
+//   1. _flush_l0, _flush_l0_to_tier
 //   2. _merge_compaction
 //   3. _dump_snapshot
 //   4. _append_wal
-// both case1 and case2 will create a new l1 file and a new empty l0 file
+// both case1 and case2 will create a new l1 or l1 tier file and a new empty l0 file
 // case3 will write a new snapshot l0
 // case4 will append wals into l0 file
 Status PersistentIndex::commit(PersistentIndexMetaPB* index_meta) {
@@ -1383,7 +1482,13 @@ Status PersistentIndex::commit(PersistentIndexMetaPB* index_meta) {
         VLOG(1) << "new l0 file path(flush) is " << file_name;
         index_meta->set_size(_size);
         _version.to_pb(index_meta->mutable_version());
-        _version.to_pb(index_meta->mutable_l1_version());
+        if (!_flushed_to_tier) {
+            _version.to_pb(index_meta->mutable_l1_version());
+        }
+        index_meta->clear_l1_tier_versions();
+        for (const auto& version : _new_l1_tier_versions) {
+            version.to_pb(index_meta->add_l1_tier_versions());
+        }
         MutableIndexMetaPB* l0_meta = index_meta->mutable_l0_meta();
         l0_meta->clear_wals();
         IndexSnapshotMetaPB* snapshot = l0_meta->mutable_snapshot();
@@ -1467,14 +1572,29 @@ Status PersistentIndex::on_commited() {
     return Status::OK();
 }
 
+Status PersistentIndex::_get_from_immutable_index(size_t n, const void* keys, const KeysInfo& keys_info,
+                                                  IndexValue* values, size_t* num_found) const {
+    if (_l1_tiers.empty()) {
+        return _l1 ? _l1->get(n, keys, keys_info, values, num_found) : Status::OK();
+    }
+    // each level only checks the keys not found in the upper levels, including the deleted ones
+    KeysInfo checks = keys_info;
+    for (auto iter = _l1_tiers.rbegin(); iter != _l1_tiers.rend() && checks.size() > 0; ++iter) {
+        KeysInfo next_level;
+        RETURN_IF_ERROR((*iter)->get(n, keys, checks, values, num_found, &next_level));
+        checks = std::move(next_level);
+    }
+    if (_l1 && checks.size() > 0) {
+        RETURN_IF_ERROR(_l1->get(n, keys, checks, values, num_found));
+    }
+    return Status::OK();
+}
+
 Status PersistentIndex::get(size_t n, const void* keys, IndexValue* values) {
     KeysInfo l1_checks;
     size_t num_found = 0;
     RETURN_IF_ERROR(_l0->get(n, keys, values, &l1_checks, &num_found));
-    if (_l1) {
-        RETURN_IF_ERROR(_l1->get(n, keys, l1_checks, values, &num_found));
-    }
-    return Status::OK();
+    return _get_from_immutable_index(n, keys, l1_checks, values, &num_found);
 }
 
 Status PersistentIndex::upsert(size_t n, const void* keys, const IndexValue* values, IndexValue* old_values) {
@@ -1482,9 +1602,7 @@ Status PersistentIndex::upsert(size_t n, const void* keys, const IndexValue* val
     size_t num_found = 0;
     RETURN_IF_ERROR(_l0->upsert(n, keys, values, old_values, &l1_checks, &num_found));
     _dump_snapshot |= _can_dump_directly();
-    if (_l1) {
-        RETURN_IF_ERROR(_l1->get(n, keys, l1_checks, old_values, &num_found));
-    }
+    RETURN_IF_ERROR(_get_from_immutable_index(n, keys, l1_checks, old_values, &num_found));
     _size += (n - num_found);
     if (!_dump_snapshot) {
         RETURN_IF_ERROR(_append_wal(n, keys, values));
@@ -1494,7 +1612,22 @@ Status PersistentIndex::upsert(size_t n, const void* keys, const IndexValue* val
 
 Status PersistentIndex::insert(size_t n, const void* keys, const IndexValue* values, bool check_l1) {
     RETURN_IF_ERROR(_l0->insert(n, keys, values));
-    if (_l1 && check_l1) {
+    if (check_l1 && !_l1_tiers.empty()) {
+        // a key in _l1 may be deleted in the tier files, so the keys are looked up in all the levels
+        KeysInfo keys_info;
+        keys_info.key_idxes.resize(n);
+        keys_info.hashes.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            keys_info.key_idxes[i] = i;
+            keys_info.hashes[i] = key_index_hash((const uint8_t*)keys + _key_size * i, _key_size);
+        }
+        std::vector<IndexValue> found_values(n, NullIndexValue);
+        size_t num_found = 0;
+        RETURN_IF_ERROR(_get_from_immutable_index(n, keys, keys_info, found_values.data(), &num_found));
+        if (num_found > 0) {
+            return Status::AlreadyExist("key already exists in immutable index");
+        }
+    } else if (_l1 && check_l1) {
         RETURN_IF_ERROR(_l1->check_not_exist(n, keys));
     }
     _dump_snapshot |= _can_dump_directly();
@@ -1510,9 +1643,7 @@ Status PersistentIndex::erase(size_t n, const void* keys, IndexValue* old_values
     size_t num_erased = 0;
     RETURN_IF_ERROR(_l0->erase(n, keys, old_values, &l1_checks, &num_erased));
     _dump_snapshot |= _can_dump_directly();
-    if (_l1) {
-        RETURN_IF_ERROR(_l1->get(n, keys, l1_checks, old_values, &num_erased));
-    }
+    RETURN_IF_ERROR(_get_from_immutable_index(n, keys, l1_checks, old_values, &num_erased));
     CHECK(_size >= num_erased) << strings::Substitute("_size($0) < num_erased($1)", _size, num_erased);
     _size -= num_erased;
     if (!_dump_snapshot) {
@@ -1572,13 +1703,34 @@ Status PersistentIndex::_flush_l0() {
     auto [nshard, npage_hint] = estimate_nshard_and_npage(kv_size, _size, default_usage_percent);
     auto kv_ref_by_shard = _l0->get_kv_refs_by_shard(nshard, _size, true);
     ImmutableIndexWriter writer;
-    RETURN_IF_ERROR(writer.init(_path, _version));
+    RETURN_IF_ERROR(writer.init(_path, _version, false));
     for (auto& kvs : kv_ref_by_shard) {
         RETURN_IF_ERROR(writer.write_shard(_key_size, value_size, npage_hint, kvs));
     }
     return writer.finish();
 }
 
+Status PersistentIndex::_flush_l0_to_tier(bool merge_tiers) {
+    if (!merge_tiers) {
+        return _l0->flush_to_immutable_index(_path, _version, true);
+    }
+    size_t value_size = sizeof(IndexValue);
+    size_t kv_size = _key_size + value_size;
+    size_t num_entry = _l0->size();
+    for (const auto& tier : _l1_tiers) {
+        num_entry += tier->_size;
+    }
+    auto [nshard, npage_hint] = estimate_nshard_and_npage(kv_size, num_entry, default_usage_percent);
+    std::vector<std::unique_ptr<ImmutableIndexShard>> tier_shards;
+    ASSIGN_OR_RETURN(auto kvs_by_shard, _get_l0_and_tier_kvs_by_shard(nshard, &tier_shards));
+    ImmutableIndexWriter writer;
+    RETURN_IF_ERROR(writer.init(_path, _version, true));
+    for (auto& kvs : kvs_by_shard) {
+        RETURN_IF_ERROR(writer.write_shard(_key_size, value_size, npage_hint, kvs));
+    }
+    return writer.finish();
+}
+
 Status PersistentIndex::_reload(const PersistentIndexMetaPB& index_meta) {
     _offset = 0;
     _page_size = 0;
@@ -1596,9 +1748,11 @@ Status PersistentIndex::_reload(const PersistentIndexMetaPB& index_meta) {
 }
 
 // check _l0 should be flush or not, if not, return
-// if _l0 should be flush, there are two conditions:
+// if _l0 should be flush, there are three conditions:
 //   1. _l1 is not exist, _flush_l0 and build _l1
-//   2. _l1 is exist, merge _l0 and _l1
+//   2. _l1 is exist and much larger than _l0, write _l0 into a new tier file, or merge _l0 and the tier files into
+//      one tier file if there are too many tier files, unless they are large enough to be merged into _l1
+//   3. otherwise, merge _l0, the tier files and _l1
 // rebuild _l0 and _l1
 // In addition, there may be io waste because we append wals first and
 // do _flush_l0 or merge compaction.
@@ -1614,12 +1768,35 @@ Status PersistentIndex::_check_and_flush_l0() {
         return Status::OK();
     }
     _flushed = true;
+    _flushed_to_tier = false;
+    _new_l1_tier_versions.clear();
     // flush _l0
     if (_l1 == nullptr) {
         RETURN_IF_ERROR(_flush_l0());
-    } else {
-        RETURN_IF_ERROR(_merge_compaction());
+        return Status::OK();
     }
+    size_t max_tier_files = std::max(config::persistent_index_max_l1_tier_files, 0);
+    if (l1_file_size / l0_mem_size > l0_l1_merge_ratio && max_tier_files > 0) {
+        uint64_t tiers_file_size = 0;
+        for (const auto& tier : _l1_tiers) {
+            uint64_t tier_file_size = 0;
+            tier->file_size(&tier_file_size);
+            tiers_file_size += tier_file_size;
+        }
+        if (_l1_tiers.size() < max_tier_files) {
+            RETURN_IF_ERROR(_flush_l0_to_tier(false));
+            _flushed_to_tier = true;
+            _new_l1_tier_versions = _l1_tier_versions;
+        } else if ((tiers_file_size + l0_mem_size) * l0_l1_merge_ratio < l1_file_size) {
+            RETURN_IF_ERROR(_flush_l0_to_tier(true));
+            _flushed_to_tier = true;
+        }
+        if (_flushed_to_tier) {
+            _new_l1_tier_versions.push_back(_version);
+            return Status::OK();
+        }
+    }
+    RETURN_IF_ERROR(_merge_compaction());
     return Status::OK();
 }
 
@@ -1651,14 +1828,18 @@ bool PersistentIndex::_load_snapshot(phmap::BinaryInputArchive& ar) {
 
 Status PersistentIndex::_delete_expired_index_file(const EditVersion& l0_version, const EditVersion& l1_version) {
     std::string l0_file_name = strings::Substitute("index.l0.$0.$1", l0_version.major(), l0_version.minor());
-    std::string l1_file_name = strings::Substitute("index.l1.$0.$1", l1_version.major(), l1_version.minor());
+    std::set<std::string> l1_file_names;
+    l1_file_names.insert(strings::Substitute("index.l1.$0.$1", l1_version.major(), l1_version.minor()));
+    for (const auto& version : _l1_tier_versions) {
+        l1_file_names.insert(strings::Substitute("index.l1.$0.$1", version.major(), version.minor()));
+    }
     std::string l0_prefix("index.l0");
     std::string l1_prefix("index.l1");
     std::string dir = _path;
     auto cb = [&](std::string_view name) -> bool {
         std::string full(name);
         if ((full.compare(0, l0_prefix.length(), l0_prefix) == 0 && full.compare(l0_file_name) != 0) ||
-            (full.compare(0, l1_prefix.length(), l1_prefix) == 0 && full.compare(l1_file_name) != 0)) {
+            (full.compare(0, l1_prefix.length(), l1_prefix) == 0 && l1_file_names.count(full) == 0)) {
             std::string path = dir + "/" + full;
             VLOG(1) << "delete expired index file " << path;
             Status st = Env::Default()->delete_file(path);
@@ -1683,9 +1864,10 @@ struct KVRefHash {
     uint64_t operator()(const KVRef& kv) const { return kv.hash; }
 };
 
+// |keep_deleted|: keep the keys deleted in l0 as NullIndexValue, rather than erase them from l1
 template <size_t KeySize>
 Status merge_shard_kvs_fixed_len(std::vector<KVRef>& l0_kvs, std::vector<KVRef>& l1_kvs, size_t estimated_size,
-                                 std::vector<KVRef>& ret) {
+                                 bool keep_deleted, std::vector<KVRef>& ret) {
     phmap::flat_hash_set<KVRef, KVRefHash, KVRefEq<KeySize>> kvs_set;
     kvs_set.reserve(estimated_size);
     for (auto& kv : l1_kvs) {
@@ -1698,7 +1880,7 @@ Status merge_shard_kvs_fixed_len(std::vector<KVRef>& l0_kvs, std::vector<KVRef>&
     }
     for (auto& kv : l0_kvs) {
         IndexValue v = UNALIGNED_LOAD64(kv.kv_pos + KeySize);
-        if (v == NullIndexValue) {
+        if (v == NullIndexValue && !keep_deleted) {
             // delete
             kvs_set.erase(kv);
         } else {
@@ -1720,13 +1902,13 @@ Status merge_shard_kvs_fixed_len(std::vector<KVRef>& l0_kvs, std::vector<KVRef>&
 }
 
 static Status merge_shard_kvs(size_t key_size, std::vector<KVRef>& l0_kvs, std::vector<KVRef>& l1_kvs,
-                              size_t estimated_size, std::vector<KVRef>& ret) {
+                              size_t estimated_size, bool keep_deleted, std::vector<KVRef>& ret) {
     if (key_size == 0) {
         return Status::NotSupported("merge_shard: varlen key size not supported");
     }
 #define CASE_SIZE(s) \
     case s:          \
-        return merge_shard_kvs_fixed_len<s>(l0_kvs, l1_kvs, estimated_size, ret);
+        return merge_shard_kvs_fixed_len<s>(l0_kvs, l1_kvs, estimated_size, keep_deleted, ret);
 
 #define CASE_SIZE_8(s) \
     CASE_SIZE(s)       \
@@ -1755,17 +1937,52 @@ static Status merge_shard_kvs(size_t key_size, std::vector<KVRef>& l0_kvs, std::
 #undef CASE_SIZE
 }
 
+StatusOr<std::vector<std::vector<KVRef>>> PersistentIndex::_get_l0_and_tier_kvs_by_shard(
+        size_t nshard, std::vector<std::unique_ptr<ImmutableIndexShard>>* index_shards) {
+    std::vector<std::vector<KVRef>> l0_kvs_by_shard = _l0->get_kv_refs_by_shard(nshard, _l0->size(), false);
+    if (_l1_tiers.empty()) {
+        return std::move(l0_kvs_by_shard);
+    }
+    uint32_t shard_bits = log2(nshard);
+    std::vector<std::vector<KVRef>> kvs_by_shard(nshard);
+    std::vector<KVRef> kvs;
+    auto merge_upper_level = [&](std::vector<std::vector<KVRef>>& upper_kvs_by_shard) -> Status {
+        for (size_t i = 0; i < nshard; i++) {
+            kvs.clear();
+            RETURN_IF_ERROR(merge_shard_kvs(_key_size, upper_kvs_by_shard[i], kvs_by_shard[i],
+                                            kvs_by_shard[i].size() + upper_kvs_by_shard[i].size(), true, kvs));
+            kvs_by_shard[i].swap(kvs);
+            upper_kvs_by_shard[i].clear();
+            upper_kvs_by_shard[i].shrink_to_fit();
+        }
+        return Status::OK();
+    };
+    // from old to new
+    for (const auto& tier : _l1_tiers) {
+        std::vector<std::vector<KVRef>> tier_kvs_by_shard(nshard);
+        for (size_t shard_idx = 0; shard_idx < tier->_shards.size(); shard_idx++) {
+            index_shards->emplace_back();
+            RETURN_IF_ERROR(tier->_get_kvs_for_shard(tier_kvs_by_shard, shard_idx, shard_bits, &index_shards->back()));
+        }
+        RETURN_IF_ERROR(merge_upper_level(tier_kvs_by_shard));
+    }
+    RETURN_IF_ERROR(merge_upper_level(l0_kvs_by_shard));
+    return std::move(kvs_by_shard);
+}
+
 Status PersistentIndex::_merge_compaction() {
     if (!_l1) {
         return Status::InternalError("cannot do merge_compaction without l1");
     }
     ImmutableIndexWriter writer;
-    RETURN_IF_ERROR(writer.init(_path, _version));
+    RETURN_IF_ERROR(writer.init(_path, _version, false));
     size_t value_size = sizeof(IndexValue);
     size_t kv_size = _key_size + value_size;
     auto [nshard, npage_hint] = estimate_nshard_and_npage(kv_size, _size, default_usage_percent);
     size_t estimated_size_per_shard = _size / nshard;
-    std::vector<std::vector<KVRef>> l0_kvs_by_shard = _l0->get_kv_refs_by_shard(nshard, _l0->size(), false);
+    // the kvs of the tier files are merged with _l0 in memory, as they are much smaller than _l1
+    std::vector<std::unique_ptr<ImmutableIndexShard>> tier_shards;
+    ASSIGN_OR_RETURN(auto l0_kvs_by_shard, _get_l0_and_tier_kvs_by_shard(nshard, &tier_shards));
     std::vector<std::vector<KVRef>> l1_kvs_by_shard(nshard);
     size_t nshard_l1 = _l1->_shards.size();
     size_t cur_shard_idx = 0;
@@ -1796,7 +2013,7 @@ Status PersistentIndex::_merge_compaction() {
         while (cur_shard_idx < num_shard_finished) {
             kvs.clear();
             RETURN_IF_ERROR(merge_shard_kvs(_key_size, l0_kvs_by_shard[cur_shard_idx], l1_kvs_by_shard[cur_shard_idx],
-                                            estimated_size_per_shard, kvs));
+                                            estimated_size_per_shard, false, kvs));
             RETURN_IF_ERROR(writer.write_shard(_key_size, value_size, npage_hint, kvs));
             // clear to optimize memory usage
             l0_kvs_by_shard[cur_shard_idx].clear();
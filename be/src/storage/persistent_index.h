@@ -9,6 +9,7 @@
 #include "gen_cpp/persistent_index.pb.h"
 #include "storage/edit_version.h"
 #include "storage/fs/block_manager.h"
+#include "storage/rowset/bloom_filter.h"
 #include "storage/rowset/rowset.h"
 #include "util/phmap/phmap.h"
 #include "util/phmap/phmap_dump.h"
@@ -132,8 +133,11 @@ public:
                                                                  bool without_null) const = 0;
 
     // flush to immutable index
+    // |as_tier|: also write the deleted keys as NullIndexValue and the bloom filters of the shards, which is used
+    //            by the l1 tier files
     // [not thread-safe]
-    virtual Status flush_to_immutable_index(const std::string& dir, const EditVersion& version) const = 0;
+    virtual Status flush_to_immutable_index(const std::string& dir, const EditVersion& version,
+                                            bool as_tier) const = 0;
 
     static StatusOr<std::unique_ptr<MutableIndex>> create(size_t key_size);
 };
@@ -146,7 +150,11 @@ public:
     // |not_found|: information of keys not found in upper level, which needs to be checked in this level
     // |values|: value array for return values
     // |num_found|: add the number of keys found in L1 to this argument
-    Status get(size_t n, const void* keys, const KeysInfo& keys_info, IndexValue* values, size_t* num_found) const;
+    // |next_level|: if not null, add information of keys not found in this level to it, which need to be further
+    //               checked in next level. A key deleted in this level is returned as NullIndexValue, but is not
+    //               counted in |num_found| nor added to |next_level|
+    Status get(size_t n, const void* keys, const KeysInfo& keys_info, IndexValue* values, size_t* num_found,
+               KeysInfo* next_level = nullptr) const;
 
     // batch check key existence
     Status check_not_exist(size_t n, const void* keys);
@@ -164,6 +172,9 @@ public:
         }
     }
 
+    // memory usage of the bloom filters
+    size_t memory_usage() const;
+
     static StatusOr<std::unique_ptr<ImmutableIndex>> load(std::unique_ptr<fs::ReadableBlock>&& rb);
 
 private:
@@ -176,7 +187,7 @@ private:
                               std::unique_ptr<ImmutableIndexShard>* shard) const;
 
     Status _get_in_shard(size_t shard_idx, size_t n, const void* keys, const KeysInfo& keys_info, IndexValue* values,
-                         size_t* num_found) const;
+                         size_t* num_found, KeysInfo* next_level) const;
 
     Status _check_not_exist_in_shard(size_t shard_idx, size_t n, const void* keys, const KeysInfo& keys_info) const;
 
@@ -191,6 +202,8 @@ private:
         uint64_t bytes;
         uint32_t npage;
         uint32_t size;
+        // null if the shard has no bloom filter
+        std::unique_ptr<BloomFilter> bloom_filter;
     };
 
     std::vector<ShardInfo> _shards;
@@ -226,7 +239,7 @@ public:
     size_t size() const { return _size; }
     size_t kv_size = key_size() + sizeof(IndexValue);
     size_t capacity() const { return _l0 ? _l0->capacity() : 0; }
-    size_t memory_usage() const { return _l0 ? _l0->memory_usage() : 0; }
+    size_t memory_usage() const;
 
     EditVersion version() const { return _version; }
 
@@ -316,9 +329,23 @@ private:
 
     Status _flush_l0();
 
-    // merge l0 and l1 into new l1, then clear l0
+    // write l0 into a new l1 tier file, or merge l0 and all the tier files into one if |merge_tiers|
+    Status _flush_l0_to_tier(bool merge_tiers);
+
+    // merge l0 and the tier files into new l1 with l1, then clear l0
     Status _merge_compaction();
 
+    // get the kvs of l0 and the tier files by |nshard| shards, the newer kvs override the older ones, and the
+    // deleted keys are kept as NullIndexValue, |index_shards| holds the tier shards the kv refs point to
+    StatusOr<std::vector<std::vector<KVRef>>> _get_l0_and_tier_kvs_by_shard(
+            size_t nshard, std::vector<std::unique_ptr<ImmutableIndexShard>>* index_shards);
+
+    // get the keys in |keys_info| from the tier files from new to old, then from l1
+    Status _get_from_immutable_index(size_t n, const void* keys, const KeysInfo& keys_info, IndexValue* values,
+                                     size_t* num_found) const;
+
+    StatusOr<std::unique_ptr<ImmutableIndex>> _load_immutable_index(const EditVersion& version);
+
     Status _load(const PersistentIndexMetaPB& index_meta);
     Status _reload(const PersistentIndexMetaPB& index_meta);
 
@@ -338,6 +365,13 @@ private:
     EditVersion _l1_version;
     std::unique_ptr<MutableIndex> _l0;
     std::unique_ptr<ImmutableIndex> _l1;
+    // The small l1 files flushed from _l0 when _l1 is much larger than _l0, ordered from old to new, to avoid
+    // rewriting the whole _l1 in each flush. They are merged into one when the number of them reaches
+    // config::persistent_index_max_l1_tier_files, and merged into _l1 when they are large enough.
+    // Keys are looked up in _l0, the tier files from new to old, and _l1, the bloom filters of the tier shards
+    // skip most of the reads of the tier files.
+    std::vector<std::unique_ptr<ImmutableIndex>> _l1_tiers;
+    std::vector<EditVersion> _l1_tier_versions;
     // |_offset|: the start offset of last wal in index file
     // |_page_size|: the size of last wal in index file
     uint64_t _offset = 0;
@@ -347,6 +381,9 @@ private:
 
     bool _dump_snapshot = false;
     bool _flushed = false;
+    // if _flushed, whether _l0 is flushed into the tier files rather than _l1, and the new tier versions
+    bool _flushed_to_tier = false;
+    std::vector<EditVersion> _new_l1_tier_versions;
 };
 
 } // namespace starrocks
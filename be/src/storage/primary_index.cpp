@@ -4,6 +4,7 @@
 
 #include <mutex>
 
+#include "column/binary_column.h"
 #include "storage/chunk_helper.h"
 #include "storage/primary_key_encoder.h"
 #include "storage/rowset/beta_rowset.h"
@@ -208,9 +209,10 @@ struct FixSlice {
     explicit FixSlice(const Slice& s) { assign(s); }
     void clear() { memset(v, 0, sizeof(FixSlice)); }
     void assign(const Slice& s) {
-        clear();
         DCHECK(s.size <= S * 4) << "slice size > FixSlice size";
         memcpy(v, s.data, s.size);
+        // only the padding is cleared, it's empty for the most common fixed size encoded keys, e.g. (int32, int32)
+        memset(reinterpret_cast<uint8_t*>(v) + s.size, 0, S * 4 - s.size);
     }
     bool operator==(const FixSlice<S>& rhs) const { return memcmp(v, rhs.v, S * 4) == 0; }
 };
@@ -220,6 +222,21 @@ struct FixSliceHash {
     size_t operator()(const FixSlice<S>& v) const { return vectorized::crc_hash_64(v.v, 4 * S, 0x811C9DC5); }
 };
 
+// The keys of a binary column read from its bytes and offsets directly, which saves building the slices of the
+// column, e.g. for the keys encoded by PrimaryKeyEncoder into a reused column per batch.
+class BinaryKeys {
+public:
+    explicit BinaryKeys(const vectorized::Column& pks)
+            : _bytes(down_cast<const vectorized::BinaryColumn&>(pks).get_bytes().data()),
+              _offsets(down_cast<const vectorized::BinaryColumn&>(pks).get_offset().data()) {}
+
+    Slice operator[](size_t i) const { return Slice(_bytes + _offsets[i], _offsets[i + 1] - _offsets[i]); }
+
+private:
+    const uint8_t* _bytes;
+    const uint32_t* _offsets;
+};
+
 template <size_t S>
 class FixSliceHashIndex : public HashIndex {
 private:
@@ -240,7 +257,7 @@ public:
 
     Status insert(uint32_t rssid, const vector<uint32_t>& rowids, const vectorized::Column& pks, uint32_t idx_begin,
                   uint32_t idx_end) override {
-        const Slice* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        BinaryKeys keys(pks);
         DCHECK(idx_end <= rowids.size());
         uint64_t base = (((uint64_t)rssid) << 32);
         uint32_t n = idx_end - idx_begin;
@@ -294,7 +311,7 @@ public:
 
     void upsert(uint32_t rssid, uint32_t rowid_start, const vectorized::Column& pks, uint32_t idx_begin,
                 uint32_t idx_end, DeletesMap* deletes) override {
-        const Slice* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        BinaryKeys keys(pks);
         uint64_t base = (((uint64_t)rssid) << 32) + rowid_start;
         uint32_t n = idx_end - idx_begin;
         if (n >= PREFETCHN * 2) {
@@ -344,7 +361,7 @@ public:
     void try_replace(uint32_t rssid, uint32_t rowid_start, const vectorized::Column& pks,
                      const vector<uint32_t>& src_rssid, uint32_t idx_begin, uint32_t idx_end,
                      vector<uint32_t>* failed) override {
-        const Slice* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        BinaryKeys keys(pks);
         uint64_t base = (((uint64_t)rssid) << 32) + rowid_start;
         uint32_t n = idx_end - idx_begin;
         if (n >= PREFETCHN * 2) {
@@ -387,7 +404,7 @@ public:
     }
 
     void erase(const vectorized::Column& pks, uint32_t idx_begin, uint32_t idx_end, DeletesMap* deletes) override {
-        const Slice* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        BinaryKeys keys(pks);
         uint32_t n = idx_end - idx_begin;
         if (n >= PREFETCHN * 2) {
             FixSlice<S> prefetch_keys[PREFETCHN];
@@ -426,7 +443,7 @@ public:
 
     void get(const vectorized::Column& pks, uint32_t idx_begin, uint32_t idx_end,
              std::vector<uint64_t>* rowids) override {
-        const Slice* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+        BinaryKeys keys(pks);
         uint32_t n = idx_end - idx_begin;
         if (n >= PREFETCHN * 2) {
             FixSlice<S> prefetch_keys[PREFETCHN];
@@ -682,7 +699,7 @@ public:
     Status insert(uint32_t rssid, const vector<uint32_t>& rowids, const vectorized::Column& pks, uint32_t idx_begin,
                   uint32_t idx_end) override {
         if (idx_begin < idx_end) {
-            auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+            BinaryKeys keys(pks);
             for (uint32_t i = idx_begin + 1; i < idx_end; i++) {
                 if (keys[i].size != keys[idx_begin].size) {
                     RETURN_IF_ERROR(
@@ -698,7 +715,7 @@ public:
     void upsert(uint32_t rssid, uint32_t rowid_start, const vectorized::Column& pks, uint32_t idx_begin,
                 uint32_t idx_end, DeletesMap* deletes) override {
         if (idx_begin < idx_end) {
-            auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+            BinaryKeys keys(pks);
             for (uint32_t i = idx_begin + 1; i < idx_end; i++) {
                 if (keys[i].size != keys[idx_begin].size) {
                     get_index_by_length(keys[idx_begin].size)->upsert(rssid, rowid_start, pks, idx_begin, i, deletes);
@@ -713,7 +730,7 @@ public:
                      const vector<uint32_t>& src_rssid, uint32_t idx_begin, uint32_t idx_end,
                      vector<uint32_t>* failed) override {
         if (idx_begin < idx_end) {
-            auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+            BinaryKeys keys(pks);
             for (uint32_t i = idx_begin + 1; i < idx_end; i++) {
                 if (keys[i].size != keys[idx_begin].size) {
                     get_index_by_length(keys[idx_begin].size)
@@ -728,7 +745,7 @@ public:
 
     void erase(const vectorized::Column& pks, uint32_t idx_begin, uint32_t idx_end, DeletesMap* deletes) override {
         if (idx_begin < idx_end) {
-            auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+            BinaryKeys keys(pks);
             for (uint32_t i = idx_begin + 1; i < idx_end; i++) {
                 if (keys[i].size != keys[idx_begin].size) {
                     get_index_by_length(keys[idx_begin].size)->erase(pks, idx_begin, i, deletes);
@@ -742,7 +759,7 @@ public:
     void get(const vectorized::Column& pks, uint32_t idx_begin, uint32_t idx_end,
              std::vector<uint64_t>* rowids) override {
         if (idx_begin < idx_end) {
-            auto* keys = reinterpret_cast<const Slice*>(pks.raw_data());
+            BinaryKeys keys(pks);
             for (uint32_t i = idx_begin + 1; i < idx_end; i++) {
                 if (keys[i].size != keys[idx_begin].size) {
                     get_index_by_length(keys[idx_begin].size)->get(pks, idx_begin, i, rowids);
@@ -1041,7 +1058,10 @@ Status PrimaryIndex::_insert_into_persistent_index(uint32_t rssid, const vector<
                                                    const vectorized::Column& pks) {
     std::vector<uint64_t> values;
     values.reserve(pks.size());
-    _build_persistent_values(rssid, rowids[0], pks, 0, pks.size(), &values);
+    // the rowids may be not consecutive, e.g. the new rows of a column mode partial update
+    for (uint32_t rowid : rowids) {
+        values.emplace_back((((uint64_t)rssid) << 32) + rowid);
+    }
     RETURN_IF_ERROR(_persistent_index->insert(pks.size(), pks.raw_data(), values.data(), true));
     return Status::OK();
 }
@@ -1099,7 +1119,7 @@ void PrimaryIndex::_replace_persistent_index(uint32_t rssid, uint32_t rowid_star
 Status PrimaryIndex::insert(uint32_t rssid, const vector<uint32_t>& rowids, const vectorized::Column& pks) {
     DCHECK(_status.ok() && (_pkey_to_rssid_rowid || _persistent_index));
     if (_persistent_index != nullptr) {
-        _insert_into_persistent_index(rssid, rowids, pks);
+        return _insert_into_persistent_index(rssid, rowids, pks);
     }
     return _pkey_to_rssid_rowid->insert(rssid, rowids, pks, 0, pks.size());
 }
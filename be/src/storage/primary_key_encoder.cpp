@@ -330,6 +330,76 @@ Status PrimaryKeyEncoder::create_column(const vectorized::Schema& schema,
     return Status::OK();
 }
 
+// Encode column |data| of a fixed size type into the field at |field_offset| of each row of |dest|, whose rows
+// are |row_size| bytes. The rows are read from |data| at |indexes| if not null, or from |offset| otherwise.
+template <class T>
+static void encode_fixed_column(const void* data, size_t offset, const uint32_t* indexes, size_t len,
+                                size_t field_offset, size_t row_size, uint8_t* dest) {
+    using UT = typename std::make_unsigned<T>::type;
+    const T* values = reinterpret_cast<const T*>(data);
+    uint8_t* p = dest + field_offset;
+    for (size_t i = 0; i < len; i++, p += row_size) {
+        UT uv = indexes != nullptr ? values[indexes[i]] : values[offset + i];
+        if constexpr (std::is_signed<T>::value) {
+            uv ^= static_cast<UT>(1) << (sizeof(UT) * 8 - 1);
+        }
+        uv = to_bigendian(uv);
+        memcpy(p, &uv, sizeof(uv));
+    }
+}
+
+// Encode the keys of fixed size types column by column into the preallocated rows of |dest|, which saves
+// building each key in a temporary buffer, and the calls per field.
+static void encode_fixed_size(const vectorized::Schema& schema, const vectorized::Chunk& chunk, size_t offset,
+                              const uint32_t* indexes, size_t len, size_t row_size, vectorized::BinaryColumn* dest) {
+    auto& bytes = dest->get_bytes();
+    auto& offsets = dest->get_offset();
+    size_t base = bytes.size();
+    bytes.resize(base + len * row_size);
+    offsets.reserve(offsets.size() + len);
+    for (size_t i = 1; i <= len; i++) {
+        offsets.push_back(base + i * row_size);
+    }
+    dest->invalidate_slice_cache();
+    uint8_t* rows = bytes.data() + base;
+    size_t field_offset = 0;
+    for (size_t j = 0; j < schema.num_key_fields(); j++) {
+        const void* data = chunk.get_column_by_index(j)->raw_data();
+        switch (schema.field(j)->type()->type()) {
+        case OLAP_FIELD_TYPE_BOOL:
+            encode_fixed_column<uint8_t>(data, offset, indexes, len, field_offset, row_size, rows);
+            field_offset += sizeof(uint8_t);
+            break;
+        case OLAP_FIELD_TYPE_TINYINT:
+            encode_fixed_column<int8_t>(data, offset, indexes, len, field_offset, row_size, rows);
+            field_offset += sizeof(int8_t);
+            break;
+        case OLAP_FIELD_TYPE_SMALLINT:
+            encode_fixed_column<int16_t>(data, offset, indexes, len, field_offset, row_size, rows);
+            field_offset += sizeof(int16_t);
+            break;
+        case OLAP_FIELD_TYPE_INT:
+        case OLAP_FIELD_TYPE_DATE_V2:
+            encode_fixed_column<int32_t>(data, offset, indexes, len, field_offset, row_size, rows);
+            field_offset += sizeof(int32_t);
+            break;
+        case OLAP_FIELD_TYPE_BIGINT:
+        case OLAP_FIELD_TYPE_TIMESTAMP:
+            encode_fixed_column<int64_t>(data, offset, indexes, len, field_offset, row_size, rows);
+            field_offset += sizeof(int64_t);
+            break;
+        case OLAP_FIELD_TYPE_LARGEINT:
+            encode_fixed_column<int128_t>(data, offset, indexes, len, field_offset, row_size, rows);
+            field_offset += sizeof(int128_t);
+            break;
+        default:
+            CHECK(false) << "type not supported for fixed size primary key encoding "
+                         << field_type_to_string(schema.field(j)->type()->type());
+        }
+    }
+    DCHECK_EQ(row_size, field_offset);
+}
+
 typedef void (*EncodeOp)(const void*, int, string*);
 
 static void prepare_ops_datas(const vectorized::Schema& schema, const vectorized::Chunk& chunk, vector<EncodeOp>* pops,
@@ -406,11 +476,16 @@ void PrimaryKeyEncoder::encode(const vectorized::Schema& schema, const vectorize
         dest->append(*src, offset, len);
     } else {
         CHECK(dest->is_binary()) << "dest column should be binary";
+        vectorized::BinaryColumn& bdest = down_cast<vectorized::BinaryColumn&>(*dest);
+        size_t fixed_size = get_encoded_fixed_size(schema);
+        if (fixed_size > 0) {
+            encode_fixed_size(schema, chunk, offset, nullptr, len, fixed_size, &bdest);
+            return;
+        }
         int ncol = schema.num_key_fields();
         vector<EncodeOp> ops;
         vector<const void*> datas;
         prepare_ops_datas(schema, chunk, &ops, &datas);
-        vectorized::BinaryColumn& bdest = down_cast<vectorized::BinaryColumn&>(*dest);
         bdest.reserve(bdest.size() + len);
         string buff;
         for (size_t i = 0; i < len; i++) {
@@ -431,11 +506,16 @@ void PrimaryKeyEncoder::encode_selective(const vectorized::Schema& schema, const
         dest->append_selective(*src, indexes, 0, len);
     } else {
         CHECK(dest->is_binary()) << "dest column should be binary";
+        vectorized::BinaryColumn& bdest = down_cast<vectorized::BinaryColumn&>(*dest);
+        size_t fixed_size = get_encoded_fixed_size(schema);
+        if (fixed_size > 0) {
+            encode_fixed_size(schema, chunk, 0, indexes, len, fixed_size, &bdest);
+            return;
+        }
         int ncol = schema.num_key_fields();
         vector<EncodeOp> ops;
         vector<const void*> datas;
         prepare_ops_datas(schema, chunk, &ops, &datas);
-        vectorized::BinaryColumn& bdest = down_cast<vectorized::BinaryColumn&>(*dest);
         bdest.reserve(bdest.size() + len);
         string buff;
         for (int i = 0; i < len; i++) {
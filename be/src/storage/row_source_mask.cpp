@@ -17,7 +17,7 @@ RowSourceMaskBuffer::RowSourceMaskBuffer(int64_t tablet_id, const std::string& s
 
 RowSourceMaskBuffer::~RowSourceMaskBuffer() {
     _reset_mask_column();
-    if (_tmp_file_fd > 0) {
+    if (_tmp_file_fd > 0 && _owns_tmp_file) {
         ::close(_tmp_file_fd);
     }
 }
@@ -75,16 +75,25 @@ bool RowSourceMaskBuffer::has_same_source(uint16_t source, size_t count) const {
 Status RowSourceMaskBuffer::flip_to_read() {
     _current_index = 0;
     if (_tmp_file_fd > 0) {
-        off_t offset = lseek(_tmp_file_fd, 0, SEEK_SET);
-        if (offset != 0) {
-            PLOG(WARNING) << "fail to seek to offset 0. offset=" << offset;
-            return Status::InternalError("fail to seek to offset 0");
-        }
+        _read_offset = 0;
         _reset_mask_column();
     }
     return Status::OK();
 }
 
+StatusOr<std::unique_ptr<RowSourceMaskBuffer>> RowSourceMaskBuffer::new_reader() const {
+    auto reader = std::make_unique<RowSourceMaskBuffer>(_tablet_id, _storage_root_path);
+    if (_tmp_file_fd > 0) {
+        // all the masks are in the file after flush
+        DCHECK(_mask_column->empty());
+        reader->_tmp_file_fd = _tmp_file_fd;
+        reader->_owns_tmp_file = false;
+    } else {
+        reader->_mask_column->append(*_mask_column, 0, _mask_column->size());
+    }
+    return std::move(reader);
+}
+
 Status RowSourceMaskBuffer::flush() {
     if (_tmp_file_fd > 0 && !_mask_column->empty()) {
         RETURN_IF_ERROR(_serialize_masks());
@@ -126,7 +135,8 @@ Status RowSourceMaskBuffer::_serialize_masks() {
 
 Status RowSourceMaskBuffer::_deserialize_masks() {
     uint64_t num_rows = 0;
-    ssize_t r_size = ::read(_tmp_file_fd, &num_rows, sizeof(num_rows));
+    // read with pread() at its own offset, as the file may be shared by multiple readers
+    ssize_t r_size = ::pread(_tmp_file_fd, &num_rows, sizeof(num_rows), _read_offset);
     if (r_size == 0) {
         return Status::EndOfFile("end of file");
     } else if (r_size != sizeof(uint64_t)) {
@@ -136,11 +146,13 @@ Status RowSourceMaskBuffer::_deserialize_masks() {
 
     std::vector<uint16_t> content;
     raw::stl_vector_resize_uninitialized(&content, num_rows);
-    r_size = ::read(_tmp_file_fd, content.data(), content.size() * sizeof(content[0]));
+    r_size = ::pread(_tmp_file_fd, content.data(), content.size() * sizeof(content[0]),
+                     _read_offset + sizeof(num_rows));
     if (r_size != content.size() * sizeof(content[0])) {
         PLOG(WARNING) << "fail to read masks from mask file. read size=" << r_size;
         return Status::InternalError("fail to read masks from mask file");
     }
+    _read_offset += sizeof(num_rows) + r_size;
     _mask_column->get_data().swap(content);
     return Status::OK();
 }
@@ -74,6 +74,11 @@ public:
     Status flip_to_read();
     Status flush();
 
+    // Return a buffer to read the masks of this buffer from the beginning, independent of the other readers,
+    // so that multiple column groups can be merged in parallel.
+    // REQUIRE: `flush()` has been called, and this buffer outlives the returned one.
+    StatusOr<std::unique_ptr<RowSourceMaskBuffer>> new_reader() const;
+
 private:
     void _reset_mask_column() { _mask_column->reset_column(); }
     Status _create_tmp_file();
@@ -87,6 +92,10 @@ private:
 
     // temporary file for persistence
     int _tmp_file_fd = -1;
+    // false if the temporary file is shared from the buffer creating this one by `new_reader()`
+    bool _owns_tmp_file = true;
+    // the offset in the temporary file to read the next masks from
+    off_t _read_offset = 0;
     int64_t _tablet_id;
     std::string _storage_root_path;
 };
@@ -0,0 +1,48 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "storage/olap_common.h"
+#include "storage/range.h"
+
+namespace starrocks::vectorized {
+
+// RowidRangeOption selects the rows to read from some segments of a tablet by row ids.
+// The segments not added are skipped entirely.
+//
+// It is used by the pipeline engine to split a big tablet into multiple morsels, which are scanned by
+// different drivers in parallel. Since the rows of different segments are not merged with each other,
+// it can only be used when the reader doesn't need to return rows in key order.
+class RowidRangeOption {
+public:
+    void add(const RowsetId& rowset_id, uint32_t segment_id, const SparseRange& rowid_range) {
+        _segment_ranges[{rowset_id, segment_id}] |= rowid_range;
+        _num_rows += rowid_range.span_size();
+    }
+
+    bool contains_rowset(const RowsetId& rowset_id) const {
+        auto iter = _segment_ranges.lower_bound({rowset_id, 0});
+        return iter != _segment_ranges.end() && iter->first.first == rowset_id;
+    }
+
+    // Return nullptr if no rows of the segment are selected.
+    const SparseRange* get_segment_rowid_range(const RowsetId& rowset_id, uint32_t segment_id) const {
+        auto iter = _segment_ranges.find({rowset_id, segment_id});
+        return iter == _segment_ranges.end() ? nullptr : &iter->second;
+    }
+
+    size_t num_segments() const { return _segment_ranges.size(); }
+    size_t num_rows() const { return _num_rows; }
+
+private:
+    std::map<std::pair<RowsetId, uint32_t>, SparseRange> _segment_ranges;
+    size_t _num_rows = 0;
+};
+
+using RowidRangeOptionPtr = std::shared_ptr<RowidRangeOption>;
+
+} // namespace starrocks::vectorized
@@ -0,0 +1,517 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "column/column.h"
+#include "gutil/strings/substitute.h"
+#include "storage/range.h"
+#include "storage/rowset/options.h"
+#include "storage/rowset/page_builder.h"
+#include "storage/rowset/page_decoder.h"
+#include "storage/types.h"
+#include "util/bit_packing.inline.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+
+namespace starrocks {
+
+// The pages of DELTA_ENCODING and ALP_ENCODING choose their format by the values of each page when the page
+// is finished: the values are stored plainly if they cannot be encoded smaller, so that a page of a column
+// with random values doesn't get bigger than a plain page.
+//
+// The page starts with:
+//     count: uint32
+//     mode: uint8, ADAPTIVE_PAGE_PLAIN or ADAPTIVE_PAGE_ENCODED
+// and is followed by |count| plain values in ADAPTIVE_PAGE_PLAIN mode, or the encoded values otherwise.
+static const size_t ADAPTIVE_PAGE_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint8_t);
+static const uint8_t ADAPTIVE_PAGE_PLAIN = 0;
+static const uint8_t ADAPTIVE_PAGE_ENCODED = 1;
+
+namespace adaptive_page {
+
+inline int bit_width(uint64_t max_value) {
+    return max_value == 0 ? 0 : 64 - __builtin_clzll(max_value);
+}
+
+inline size_t bit_packed_size(size_t count, int bit_width) {
+    return (count * bit_width + 7) / 8;
+}
+
+// Subtract the minimum from |values| and append them to |buf| with the least bits, as:
+//     min: int64
+//     bit_width: uint8
+//     packed values: bit_packed_size(count, bit_width) bytes
+inline void put_frame_of_reference(std::vector<uint64_t>* values, faststring* buf) {
+    int64_t min = std::numeric_limits<int64_t>::max();
+    int64_t max = std::numeric_limits<int64_t>::min();
+    for (uint64_t v : *values) {
+        min = std::min(min, static_cast<int64_t>(v));
+        max = std::max(max, static_cast<int64_t>(v));
+    }
+    if (values->empty()) {
+        min = max = 0;
+    }
+    // Computed in uint64_t, since the difference may overflow int64_t.
+    const int width = bit_width(static_cast<uint64_t>(max) - static_cast<uint64_t>(min));
+    put_fixed64_le(buf, static_cast<uint64_t>(min));
+    buf->push_back(static_cast<uint8_t>(width));
+    if (width == 0) {
+        return;
+    }
+    faststring packed;
+    BitWriter writer(&packed);
+    for (uint64_t v : *values) {
+        writer.PutValue(v - static_cast<uint64_t>(min), width);
+    }
+    writer.Flush();
+    DCHECK_EQ(bit_packed_size(values->size(), width), packed.size());
+    buf->append(packed.data(), packed.size());
+}
+
+inline size_t frame_of_reference_size(size_t count, int bit_width) {
+    return sizeof(int64_t) + sizeof(uint8_t) + bit_packed_size(count, bit_width);
+}
+
+// Decode |count| values written by put_frame_of_reference() from |*data| to |values|, and advance |*data|.
+inline Status get_frame_of_reference(Slice* data, size_t count, uint64_t* values) {
+    if (data->size < sizeof(int64_t) + sizeof(uint8_t)) {
+        return Status::Corruption("not enough bytes for frame of reference header");
+    }
+    const uint64_t min = decode_fixed64_le(reinterpret_cast<const uint8_t*>(data->data));
+    const int width = static_cast<uint8_t>(data->data[sizeof(int64_t)]);
+    data->remove_prefix(sizeof(int64_t) + sizeof(uint8_t));
+    if (width > 64) {
+        return Status::Corruption("invalid bit width of frame of reference");
+    }
+    const size_t packed_size = bit_packed_size(count, width);
+    if (data->size < packed_size) {
+        return Status::Corruption("not enough bytes for bit packed values");
+    }
+    if (width == 0) {
+        std::fill(values, values + count, min);
+        return Status::OK();
+    }
+    // The unpacking is unrolled for each bit width, which is vectorized by the compiler.
+    auto res = BitPacking::UnpackValues<uint64_t>(width, reinterpret_cast<const uint8_t*>(data->data), packed_size,
+                                                  count, values);
+    if (res.second != static_cast<int64_t>(count)) {
+        return Status::Corruption("fail to unpack values");
+    }
+    for (size_t i = 0; i < count; i++) {
+        values[i] += min;
+    }
+    data->remove_prefix(packed_size);
+    return Status::OK();
+}
+
+} // namespace adaptive_page
+
+// The builder of the adaptive pages, which buffers the values plainly and encodes them by |Codec| when the
+// page is finished. |Codec| provides:
+//     // Append the encoded |values| to |buf|, return false if they cannot be encoded smaller than plain.
+//     static bool encode(const CppType* values, size_t count, faststring* buf);
+//     // Decode |count| values from |data| to |values|.
+//     static Status decode(Slice data, size_t count, CppType* values);
+template <FieldType Type, typename Codec>
+class AdaptivePageBuilder final : public PageBuilder {
+public:
+    explicit AdaptivePageBuilder(const PageBuilderOptions& options) : _options(options) { reset(); }
+
+    bool is_page_full() override { return _buffer.size() >= _options.data_page_size; }
+
+    size_t add(const uint8_t* vals, size_t count) override {
+        if (is_page_full()) {
+            return 0;
+        }
+        size_t to_add = std::min(count, (_options.data_page_size - _buffer.size()) / SIZE_OF_TYPE + 1);
+        _buffer.append(vals, to_add * SIZE_OF_TYPE);
+        _count += to_add;
+        return to_add;
+    }
+
+    faststring* finish() override {
+        _result.clear();
+        _result.resize(ADAPTIVE_PAGE_HEADER_SIZE);
+        encode_fixed32_le(_result.data(), _count);
+        if (_count > 0) {
+            _first_value.assign_copy(_buffer.data(), SIZE_OF_TYPE);
+            _last_value.assign_copy(_buffer.data() + (_count - 1) * SIZE_OF_TYPE, SIZE_OF_TYPE);
+        }
+        if (_count > 0 && Codec::encode(reinterpret_cast<const CppType*>(_buffer.data()), _count, &_result) &&
+            _result.size() < ADAPTIVE_PAGE_HEADER_SIZE + _buffer.size()) {
+            _result[sizeof(uint32_t)] = ADAPTIVE_PAGE_ENCODED;
+        } else {
+            _result.resize(ADAPTIVE_PAGE_HEADER_SIZE);
+            _result[sizeof(uint32_t)] = ADAPTIVE_PAGE_PLAIN;
+            _result.append(_buffer.data(), _buffer.size());
+        }
+        return &_result;
+    }
+
+    void reset() override {
+        _count = 0;
+        _buffer.clear();
+        _buffer.reserve(_options.data_page_size + SIZE_OF_TYPE);
+    }
+
+    size_t count() const override { return _count; }
+
+    uint64_t size() const override { return _buffer.size(); }
+
+    Status get_first_value(void* value) const override {
+        if (_count == 0) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, _first_value.data(), SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_count == 0) {
+            return Status::NotFound("page is empty");
+        }
+        memcpy(value, _last_value.data(), SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+
+    PageBuilderOptions _options;
+    // the plain values added
+    faststring _buffer;
+    faststring _result;
+    size_t _count = 0;
+    faststring _first_value;
+    faststring _last_value;
+};
+
+template <FieldType Type, typename Codec, EncodingTypePB Encoding>
+class AdaptivePageDecoder final : public PageDecoder {
+public:
+    AdaptivePageDecoder(Slice data, const PageDecoderOptions& options) : _data(data), _options(options) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < ADAPTIVE_PAGE_HEADER_SIZE) {
+            return Status::Corruption("not enough bytes for the header of adaptive page");
+        }
+        _num_elems = decode_fixed32_le(reinterpret_cast<const uint8_t*>(_data.data));
+        const uint8_t mode = _data.data[sizeof(uint32_t)];
+        Slice body(_data.data + ADAPTIVE_PAGE_HEADER_SIZE, _data.size - ADAPTIVE_PAGE_HEADER_SIZE);
+        if (mode == ADAPTIVE_PAGE_PLAIN) {
+            if (body.size != _num_elems * SIZE_OF_TYPE) {
+                return Status::Corruption("unexpected data size of plain adaptive page");
+            }
+            _values = reinterpret_cast<const uint8_t*>(body.data);
+        } else if (mode == ADAPTIVE_PAGE_ENCODED) {
+            // The whole page is decoded at once, which is much faster than decoding in small batches.
+            _decoded.reset(new uint8_t[_num_elems * SIZE_OF_TYPE]);
+            RETURN_IF_ERROR(Codec::decode(body, _num_elems, reinterpret_cast<CppType*>(_decoded.get())));
+            _values = _decoded.get();
+        } else {
+            return Status::Corruption(strings::Substitute("invalid mode of adaptive page: $0", mode));
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init()";
+        DCHECK_LE(pos, _num_elems);
+        _cur_idx = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, ColumnBlockView* dst) override {
+        DCHECK(_parsed);
+        size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elems - _cur_idx));
+        memcpy(dst->data(), _values + _cur_idx * SIZE_OF_TYPE, max_fetch * SIZE_OF_TYPE);
+        _cur_idx += max_fetch;
+        *n = max_fetch;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* count, vectorized::Column* dst) override {
+        DCHECK(_parsed);
+        size_t max_fetch = std::min(*count, static_cast<size_t>(_num_elems - _cur_idx));
+        int n = dst->append_numbers(_values + _cur_idx * SIZE_OF_TYPE, max_fetch * SIZE_OF_TYPE);
+        DCHECK_EQ(max_fetch, n);
+        _cur_idx += max_fetch;
+        *count = max_fetch;
+        return Status::OK();
+    }
+
+    Status next_batch(const vectorized::SparseRange& range, vectorized::Column* dst) override {
+        DCHECK(_parsed);
+        vectorized::SparseRangeIterator iter = range.new_iterator();
+        while (iter.has_more() && _cur_idx < _num_elems) {
+            _cur_idx = iter.begin();
+            vectorized::Range r = iter.next(range.span_size());
+            size_t max_fetch = std::min(r.span_size(), _num_elems - _cur_idx);
+            int n = dst->append_numbers(_values + _cur_idx * SIZE_OF_TYPE, max_fetch * SIZE_OF_TYPE);
+            DCHECK_EQ(max_fetch, n);
+            _cur_idx += max_fetch;
+        }
+        return Status::OK();
+    }
+
+    size_t count() const override { return _num_elems; }
+
+    size_t current_index() const override { return _cur_idx; }
+
+    EncodingTypePB encoding_type() const override { return Encoding; }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+
+    Slice _data;
+    PageDecoderOptions _options;
+    bool _parsed = false;
+    uint32_t _num_elems = 0;
+    uint32_t _cur_idx = 0;
+    // points to the plain values in |_data|, or |_decoded|.
+    const uint8_t* _values = nullptr;
+    std::unique_ptr<uint8_t[]> _decoded;
+};
+
+// Delta-of-delta coding of the integers, e.g. the timestamps increasing by a similar step.
+// The values v[0..n) are encoded as:
+//     v[0]: int64
+//     v[1] - v[0]: int64, 0 if n < 2
+//     the delta of deltas (v[i] - v[i-1]) - (v[i-1] - v[i-2]) for i in [2, n), by put_frame_of_reference().
+// All the arithmetic is done in uint64_t, the overflow of which is well defined and reverted by decoding.
+template <FieldType Type>
+struct DeltaCodec {
+    using CppType = typename TypeTraits<Type>::CppType;
+    using IntType = std::conditional_t<sizeof(CppType) == sizeof(int32_t), int32_t, int64_t>;
+    static_assert(sizeof(CppType) == sizeof(IntType), "only 4 and 8 bytes integers are supported");
+
+    static uint64_t to_uint64(const CppType& value) {
+        IntType v;
+        memcpy(&v, &value, sizeof(IntType));
+        return static_cast<uint64_t>(static_cast<int64_t>(v));
+    }
+
+    static bool encode(const CppType* values, size_t count, faststring* buf) {
+        const uint64_t first = to_uint64(values[0]);
+        const uint64_t first_delta = count > 1 ? to_uint64(values[1]) - first : 0;
+        std::vector<uint64_t> dods;
+        dods.reserve(count);
+        uint64_t prev = first + first_delta;
+        uint64_t prev_delta = first_delta;
+        for (size_t i = 2; i < count; i++) {
+            uint64_t v = to_uint64(values[i]);
+            uint64_t delta = v - prev;
+            dods.push_back(delta - prev_delta);
+            prev = v;
+            prev_delta = delta;
+        }
+        put_fixed64_le(buf, first);
+        put_fixed64_le(buf, first_delta);
+        adaptive_page::put_frame_of_reference(&dods, buf);
+        return true;
+    }
+
+    static Status decode(Slice data, size_t count, CppType* values) {
+        if (count == 0) {
+            return Status::OK();
+        }
+        if (data.size < 2 * sizeof(uint64_t)) {
+            return Status::Corruption("not enough bytes for delta page");
+        }
+        const uint64_t first = decode_fixed64_le(reinterpret_cast<const uint8_t*>(data.data));
+        uint64_t delta = decode_fixed64_le(reinterpret_cast<const uint8_t*>(data.data) + sizeof(uint64_t));
+        data.remove_prefix(2 * sizeof(uint64_t));
+        std::vector<uint64_t> dods(count > 2 ? count - 2 : 0);
+        RETURN_IF_ERROR(adaptive_page::get_frame_of_reference(&data, dods.size(), dods.data()));
+
+        uint64_t v = first;
+        _store(v, &values[0]);
+        if (count > 1) {
+            v += delta;
+            _store(v, &values[1]);
+        }
+        for (size_t i = 2; i < count; i++) {
+            delta += dods[i - 2];
+            v += delta;
+            _store(v, &values[i]);
+        }
+        return Status::OK();
+    }
+
+private:
+    static void _store(uint64_t v, CppType* dst) {
+        auto value = static_cast<IntType>(static_cast<int64_t>(v));
+        memcpy(dst, &value, sizeof(IntType));
+    }
+};
+
+// An ALP-style coding of the floating point numbers, which are mostly decimals of a few digits, e.g. prices
+// and metrics. Each value v is stored as the integer round(v * 10^e), for an exponent e chosen by the page,
+// if the integer is decoded to exactly the same value. The integers are stored by put_frame_of_reference(),
+// and the values that cannot be decoded exactly, e.g. NaN and -0.0, are stored plainly as exceptions:
+//     e: uint8
+//     the integers, by put_frame_of_reference(), with the exceptions set to the integer of the first value
+//     num_exceptions: uint32
+//     positions of the exceptions: uint32 * num_exceptions
+//     values of the exceptions: CppType * num_exceptions
+template <FieldType Type>
+struct AlpCodec {
+    using CppType = typename TypeTraits<Type>::CppType;
+    static_assert(std::is_floating_point_v<CppType>, "only floating point numbers are supported");
+
+    // The powers of 10 that are exactly representable by double.
+    static constexpr int kMaxExponent = std::is_same_v<CppType, float> ? 10 : 18;
+    // The values are encoded as integers in (-2^62, 2^62).
+    static constexpr double kMaxEncodedValue = 4611686018427387904.0;
+    // The number of the values used to choose the exponent.
+    static constexpr size_t kNumSamples = 256;
+
+    static double pow10(int e) {
+        static const double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8, 1e9,
+                                        1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+        return kPow10[e];
+    }
+
+    // Return false if |value| cannot be encoded by the exponent |e| exactly.
+    static bool encode_value(CppType value, int e, int64_t* encoded) {
+        double scaled = static_cast<double>(value) * pow10(e);
+        if (!(std::fabs(scaled) < kMaxEncodedValue)) {
+            // NaN or too large
+            return false;
+        }
+        int64_t n = std::llround(scaled);
+        CppType decoded = decode_value(n, e);
+        if (memcmp(&decoded, &value, sizeof(CppType)) != 0) {
+            return false;
+        }
+        *encoded = n;
+        return true;
+    }
+
+    static CppType decode_value(int64_t n, int e) { return static_cast<CppType>(static_cast<double>(n) / pow10(e)); }
+
+    // Choose the exponent with the fewest exceptions on the sampled values, prefer the smaller one on a tie,
+    // for the integers of it are smaller.
+    static int choose_exponent(const CppType* values, size_t count, size_t* num_exceptions) {
+        size_t step = std::max<size_t>(1, count / kNumSamples);
+        int best_e = 0;
+        size_t best_exceptions = std::numeric_limits<size_t>::max();
+        for (int e = 0; e <= kMaxExponent && best_exceptions > 0; e++) {
+            size_t exceptions = 0;
+            int64_t n;
+            for (size_t i = 0; i < count; i += step) {
+                exceptions += !encode_value(values[i], e, &n);
+            }
+            if (exceptions < best_exceptions) {
+                best_e = e;
+                best_exceptions = exceptions;
+            }
+        }
+        *num_exceptions = best_exceptions;
+        return best_e;
+    }
+
+    static bool encode(const CppType* values, size_t count, faststring* buf) {
+        size_t sampled_exceptions = 0;
+        const int e = choose_exponent(values, count, &sampled_exceptions);
+        // Not worth it if more than 1/8 of the values are exceptions.
+        if (sampled_exceptions * 8 > std::min(count, kNumSamples)) {
+            return false;
+        }
+        std::vector<uint64_t> encoded(count);
+        std::vector<uint32_t> exception_positions;
+        int64_t n = 0;
+        int64_t placeholder = 0;
+        bool has_placeholder = false;
+        for (size_t i = 0; i < count; i++) {
+            if (encode_value(values[i], e, &n)) {
+                encoded[i] = static_cast<uint64_t>(n);
+                if (!has_placeholder) {
+                    placeholder = n;
+                    has_placeholder = true;
+                }
+            } else {
+                exception_positions.push_back(i);
+            }
+        }
+        if (exception_positions.size() * 8 > count) {
+            return false;
+        }
+        // Fill the exceptions with an encoded value, to not widen the bit width.
+        for (uint32_t pos : exception_positions) {
+            encoded[pos] = static_cast<uint64_t>(placeholder);
+        }
+        buf->push_back(static_cast<uint8_t>(e));
+        adaptive_page::put_frame_of_reference(&encoded, buf);
+        put_fixed32_le(buf, exception_positions.size());
+        for (uint32_t pos : exception_positions) {
+            put_fixed32_le(buf, pos);
+        }
+        for (uint32_t pos : exception_positions) {
+            buf->append(&values[pos], sizeof(CppType));
+        }
+        return true;
+    }
+
+    static Status decode(Slice data, size_t count, CppType* values) {
+        if (count == 0) {
+            return Status::OK();
+        }
+        if (data.size < sizeof(uint8_t)) {
+            return Status::Corruption("not enough bytes for alp page");
+        }
+        const int e = static_cast<uint8_t>(data.data[0]);
+        if (e > kMaxExponent) {
+            return Status::Corruption("invalid exponent of alp page");
+        }
+        data.remove_prefix(sizeof(uint8_t));
+        std::vector<uint64_t> encoded(count);
+        RETURN_IF_ERROR(adaptive_page::get_frame_of_reference(&data, count, encoded.data()));
+        const double divisor = pow10(e);
+        for (size_t i = 0; i < count; i++) {
+            values[i] = static_cast<CppType>(static_cast<double>(static_cast<int64_t>(encoded[i])) / divisor);
+        }
+
+        if (data.size < sizeof(uint32_t)) {
+            return Status::Corruption("not enough bytes for exceptions of alp page");
+        }
+        const uint32_t num_exceptions = decode_fixed32_le(reinterpret_cast<const uint8_t*>(data.data));
+        data.remove_prefix(sizeof(uint32_t));
+        if (data.size != num_exceptions * (sizeof(uint32_t) + sizeof(CppType))) {
+            return Status::Corruption("unexpected size of exceptions of alp page");
+        }
+        const auto* positions = reinterpret_cast<const uint8_t*>(data.data);
+        const char* exception_values = data.data + num_exceptions * sizeof(uint32_t);
+        for (uint32_t i = 0; i < num_exceptions; i++) {
+            uint32_t pos = decode_fixed32_le(positions + i * sizeof(uint32_t));
+            if (pos >= count) {
+                return Status::Corruption("invalid exception position of alp page");
+            }
+            memcpy(&values[pos], exception_values + i * sizeof(CppType), sizeof(CppType));
+        }
+        return Status::OK();
+    }
+};
+
+template <FieldType Type>
+using DeltaPageBuilder = AdaptivePageBuilder<Type, DeltaCodec<Type>>;
+template <FieldType Type>
+using DeltaPageDecoder = AdaptivePageDecoder<Type, DeltaCodec<Type>, DELTA_ENCODING>;
+template <FieldType Type>
+using AlpPageBuilder = AdaptivePageBuilder<Type, AlpCodec<Type>>;
+template <FieldType Type>
+using AlpPageDecoder = AdaptivePageDecoder<Type, AlpCodec<Type>, ALP_ENCODING>;
+
+} // namespace starrocks
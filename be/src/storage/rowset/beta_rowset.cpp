@@ -37,6 +37,8 @@
 #include "storage/empty_iterator.h"
 #include "storage/merge_iterator.h"
 #include "storage/projection_iterator.h"
+#include "storage/rowid_range_option.h"
+#include "storage/rowset/segment_row_fetcher.h"
 #include "storage/storage_engine.h"
 #include "storage/union_iterator.h"
 #include "storage/update_manager.h"
@@ -76,7 +78,7 @@ Status BetaRowset::do_load() {
     size_t footer_size_hint = 16 * 1024;
     for (int seg_id = 0; seg_id < num_segments(); ++seg_id) {
         std::string seg_path = segment_file_path(_rowset_path, rowset_id(), seg_id);
-        auto res = Segment::open(ExecEnv::GetInstance()->tablet_meta_mem_tracker(), block_mgr, seg_path, seg_id,
+        auto res = Segment::open(ExecEnv::GetInstance()->segment_mem_tracker(), block_mgr, seg_path, seg_id,
                                  _schema, &footer_size_hint, rowset_meta()->partial_rowset_footer(seg_id));
         if (!res.ok()) {
             LOG(WARNING) << "Fail to open " << seg_path << ": " << res.status();
@@ -144,7 +146,7 @@ Status BetaRowset::link_files_to(const std::string& dir, RowsetId new_rowset_id)
     return Status::OK();
 }
 
-Status BetaRowset::copy_files_to(const std::string& dir) {
+Status BetaRowset::copy_files_to(const std::string& dir, int64_t max_bytes_per_sec) {
     for (int i = 0; i < num_segments(); ++i) {
         std::string dst_path = segment_file_path(dir, rowset_id(), i);
         if (FileUtils::check_exist(dst_path)) {
@@ -152,7 +154,7 @@ Status BetaRowset::copy_files_to(const std::string& dir) {
             return Status::AlreadyExist(fmt::format("Path already exist: {}", dst_path));
         }
         std::string src_path = segment_file_path(_rowset_path, rowset_id(), i);
-        if (!FileUtils::copy_file(src_path, dst_path).ok()) {
+        if (!FileUtils::copy_file(src_path, dst_path, max_bytes_per_sec).ok()) {
             LOG(WARNING) << "Error to copy file. src:" << src_path << ", dst:" << dst_path << ", errno=" << Errno::no();
             return Status::IOError(fmt::format("Error to copy file. src: {}, dst: {}, error:{} ", src_path, dst_path,
                                                std::strerror(Errno::no())));
@@ -166,7 +168,7 @@ Status BetaRowset::copy_files_to(const std::string& dir) {
                 LOG(WARNING) << "Path already exist: " << dst_path;
                 return Status::AlreadyExist(fmt::format("Path already exist: {}", dst_path));
             }
-            if (!FileUtils::copy_file(src_path, dst_path).ok()) {
+            if (!FileUtils::copy_file(src_path, dst_path, max_bytes_per_sec).ok()) {
                 LOG(WARNING) << "Error to copy file. src:" << src_path << ", dst:" << dst_path
                              << ", errno=" << Errno::no();
                 return Status::IOError(fmt::format("Error to copy file. src: {}, dst: {}, error:{} ", src_path,
@@ -232,6 +234,9 @@ StatusOr<vectorized::ChunkIteratorPtr> BetaRowset::new_iterator(const vectorized
 Status BetaRowset::get_segment_iterators(const vectorized::Schema& schema, const vectorized::RowsetReadOptions& options,
                                          std::vector<vectorized::ChunkIteratorPtr>* segment_iterators) {
     RowsetReleaseGuard guard(shared_from_this());
+    if (options.rowid_range_option != nullptr && !options.rowid_range_option->contains_rowset(rowset_id())) {
+        return Status::OK();
+    }
 
     RETURN_IF_ERROR(load());
 
@@ -241,7 +246,10 @@ Status BetaRowset::get_segment_iterators(const vectorized::Schema& schema, const
     seg_options.ranges = options.ranges;
     seg_options.predicates = options.predicates;
     seg_options.predicates_for_zone_map = options.predicates_for_zone_map;
+    seg_options.runtime_range_pruner = options.runtime_range_pruner;
     seg_options.use_page_cache = options.use_page_cache;
+    seg_options.fill_page_cache = options.fill_page_cache;
+    seg_options.readahead_bytes = options.readahead_bytes;
     seg_options.profile = options.profile;
     seg_options.reader_type = options.reader_type;
     seg_options.chunk_size = options.chunk_size;
@@ -258,17 +266,28 @@ Status BetaRowset::get_segment_iterators(const vectorized::Schema& schema, const
         seg_options.meta = options.meta;
     }
 
-    auto segment_schema = schema;
+    auto read_schema = schema;
+    // The global row id column is filled by the wrapper of the segment iterator.
+    if (options.global_rowid_fetcher != nullptr) {
+        DCHECK_EQ(options.global_rowid_column_id, schema.field(schema.num_fields() - 1)->id());
+        read_schema.remove(read_schema.num_fields() - 1);
+    }
+    const size_t num_read_fields = read_schema.num_fields();
     // Append the columns with delete condition to segment schema.
-    std::set<ColumnId> delete_columns;
-    seg_options.delete_predicates.get_column_ids(&delete_columns);
-    for (ColumnId cid : delete_columns) {
-        const TabletColumn& col = options.tablet_schema->column(cid);
-        if (segment_schema.get_field_by_name(std::string(col.name())) == nullptr) {
-            auto f = vectorized::ChunkHelper::convert_field_to_format_v2(cid, col);
-            segment_schema.append(std::make_shared<vectorized::Field>(std::move(f)));
+    auto build_segment_schema = [&](const vectorized::DisjunctivePredicates& delete_predicates) {
+        auto segment_schema = read_schema;
+        std::set<ColumnId> delete_columns;
+        delete_predicates.get_column_ids(&delete_columns);
+        for (ColumnId cid : delete_columns) {
+            const TabletColumn& col = options.tablet_schema->column(cid);
+            if (segment_schema.get_field_by_name(std::string(col.name())) == nullptr) {
+                auto f = vectorized::ChunkHelper::convert_field_to_format_v2(cid, col);
+                segment_schema.append(std::make_shared<vectorized::Field>(std::move(f)));
+            }
         }
-    }
+        return segment_schema;
+    };
+    const auto segment_schema = build_segment_schema(seg_options.delete_predicates);
 
     std::vector<vectorized::ChunkIteratorPtr> tmp_seg_iters;
     tmp_seg_iters.reserve(num_segments());
@@ -279,17 +298,45 @@ Status BetaRowset::get_segment_iterators(const vectorized::Schema& schema, const
         if (seg_ptr->num_rows() == 0) {
             continue;
         }
-        auto res = seg_ptr->new_iterator(segment_schema, seg_options);
+        if (options.rowid_range_option != nullptr) {
+            seg_options.rowid_range = options.rowid_range_option->get_segment_rowid_range(rowset_id(), seg_ptr->id());
+            if (seg_options.rowid_range == nullptr) {
+                continue;
+            }
+        }
+        // The delete predicates which can't be satisfied by any row of the segment are pruned by its zone maps,
+        // so they are not evaluated on every read, and the columns only used by them are not read.
+        const vectorized::Schema* seg_schema = &segment_schema;
+        const vectorized::SegmentReadOptions* seg_read_options = &seg_options;
+        vectorized::Schema pruned_schema;
+        vectorized::SegmentReadOptions pruned_options;
+        if (!seg_options.delete_predicates.empty()) {
+            vectorized::DisjunctivePredicates delete_predicates;
+            RETURN_IF_ERROR(seg_ptr->prune_delete_predicates(seg_options.delete_predicates, &delete_predicates));
+            if (delete_predicates.size() < seg_options.delete_predicates.size()) {
+                pruned_options = seg_options;
+                pruned_options.delete_predicates = std::move(delete_predicates);
+                pruned_schema = build_segment_schema(pruned_options.delete_predicates);
+                seg_schema = &pruned_schema;
+                seg_read_options = &pruned_options;
+            }
+        }
+        auto res = seg_ptr->new_iterator(*seg_schema, *seg_read_options);
         if (res.status().is_end_of_file()) {
             continue;
         }
         if (!res.ok()) {
             return res.status();
         }
-        if (segment_schema.num_fields() > schema.num_fields()) {
-            tmp_seg_iters.emplace_back(vectorized::new_projection_iterator(schema, std::move(res).value()));
+        auto seg_iter = std::move(res).value();
+        if (options.global_rowid_fetcher != nullptr) {
+            uint32_t ordinal = options.global_rowid_fetcher->add_segment(seg_options.block_mgr, seg_ptr);
+            seg_iter = vectorized::new_global_rowid_iterator(seg_iter, ordinal, options.global_rowid_column_id);
+        }
+        if (seg_schema->num_fields() > num_read_fields) {
+            tmp_seg_iters.emplace_back(vectorized::new_projection_iterator(schema, std::move(seg_iter)));
         } else {
-            tmp_seg_iters.emplace_back(std::move(res).value());
+            tmp_seg_iters.emplace_back(std::move(seg_iter));
         }
     }
 
@@ -352,7 +399,7 @@ Status BetaRowset::reload() {
     for (int seg_id = 0; seg_id < num_segments(); ++seg_id) {
         std::string seg_path = segment_file_path(_rowset_path, rowset_id(), seg_id);
         block_mgr->erase_block_cache(seg_path);
-        auto res = Segment::open(ExecEnv::GetInstance()->tablet_meta_mem_tracker(), block_mgr, seg_path, seg_id,
+        auto res = Segment::open(ExecEnv::GetInstance()->segment_mem_tracker(), block_mgr, seg_path, seg_id,
                                  _schema, &footer_size_hint);
         if (!res.ok()) {
             LOG(WARNING) << "Fail to open " << seg_path << ": " << res.status();
@@ -89,7 +89,7 @@ public:
 
     Status link_files_to(const std::string& dir, RowsetId new_rowset_id) override;
 
-    Status copy_files_to(const std::string& dir) override;
+    Status copy_files_to(const std::string& dir, int64_t max_bytes_per_sec) override;
 
     bool check_path(const std::string& path) override;
 
@@ -96,6 +96,7 @@ Status BetaRowsetWriter::init() {
     _writer_options.storage_format_version = _context.storage_format_version;
     _writer_options.global_dicts = _context.global_dicts != nullptr ? _context.global_dicts : nullptr;
     _writer_options.referenced_column_ids = _context.referenced_column_ids;
+    _writer_options.parallel_pool = _context.parallel_pool;
 
     if (_context.tablet_schema->keys_type() == KeysType::PRIMARY_KEYS && _context.partial_update_tablet_schema) {
         _rowset_txn_meta_pb = std::make_unique<RowsetTxnMetaPB>();
@@ -298,10 +299,55 @@ Status HorizontalBetaRowsetWriter::flush_chunk(const vectorized::Chunk& chunk) {
         std::lock_guard<std::mutex> l(_lock);
         _num_rows_written += static_cast<int64_t>(chunk.num_rows());
         _total_row_size += static_cast<int64_t>(chunk.bytes_usage());
+        _record_segment_key_bounds((*segment_writer)->segment_id(), chunk);
     }
     return _flush_segment_writer(&segment_writer.value());
 }
 
+void HorizontalBetaRowsetWriter::_record_segment_key_bounds(uint32_t segment_id, const vectorized::Chunk& chunk) {
+    // The primary key tablets merge the segments by the primary index instead.
+    if (_context.tablet_schema->keys_type() == KeysType::PRIMARY_KEYS || chunk.num_rows() == 0) {
+        return;
+    }
+    if (_segment_key_bounds.size() <= segment_id) {
+        _segment_key_bounds.resize(segment_id + 1);
+    }
+    auto& bounds = _segment_key_bounds[segment_id];
+    for (size_t i = 0; i < _context.tablet_schema->num_key_columns(); i++) {
+        const auto& column = chunk.get_column_by_index(i);
+        auto bound = column->clone_empty();
+        bound->append(*column, 0, 1);
+        bound->append(*column, chunk.num_rows() - 1, 1);
+        bounds.emplace_back(std::move(bound));
+    }
+}
+
+bool HorizontalBetaRowsetWriter::_are_segments_ordered_by_keys() const {
+    if (_segment_key_bounds.size() != static_cast<size_t>(_num_segment)) {
+        return false;
+    }
+    for (size_t seg = 0; seg < _segment_key_bounds.size(); seg++) {
+        if (_segment_key_bounds[seg].empty()) {
+            return false;
+        }
+        if (seg == 0) {
+            continue;
+        }
+        // The last key of the previous segment must be less than the first key of this segment, the equal keys in
+        // different segments still need to be merged for the aggregate and unique key tablets.
+        const auto& prev = _segment_key_bounds[seg - 1];
+        const auto& curr = _segment_key_bounds[seg];
+        int cmp = 0;
+        for (size_t i = 0; i < curr.size() && cmp == 0; i++) {
+            cmp = prev[i]->compare_at(1, 0, *curr[i], -1);
+        }
+        if (cmp >= 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Status HorizontalBetaRowsetWriter::flush_chunk_with_deletes(const vectorized::Chunk& upserts,
                                                             const vectorized::Column& deletes) {
     if (!deletes.empty()) {
@@ -359,6 +405,11 @@ StatusOr<RowsetSharedPtr> HorizontalBetaRowsetWriter::build() {
     // When building a rowset, we must ensure that the current _segment_writer has been
     // flushed, that is, the current _segment_wirter is nullptr
     DCHECK(_segment_writer == nullptr) << "segment must be null when build rowset";
+    if (_num_segment > 1 && _context.segments_overlap != NONOVERLAPPING && _are_segments_ordered_by_keys()) {
+        // e.g. a load whose data is ordered by the sort key, the readers can concatenate the segments instead of
+        // merging them.
+        _rowset_meta->set_segments_overlap(NONOVERLAPPING);
+    }
     return BetaRowsetWriter::build();
 }
 
@@ -397,7 +448,7 @@ Status HorizontalBetaRowsetWriter::_final_merge() {
         std::string tmp_segment_file =
                 BetaRowset::segment_temp_file_path(_context.rowset_path_prefix, _context.rowset_id, seg_id);
 
-        auto segment_ptr = Segment::open(ExecEnv::GetInstance()->tablet_meta_mem_tracker(), _block_mgr,
+        auto segment_ptr = Segment::open(ExecEnv::GetInstance()->segment_mem_tracker(), _block_mgr,
                                          tmp_segment_file, seg_id, _context.tablet_schema);
         if (!segment_ptr.ok()) {
             LOG(WARNING) << "Fail to open " << tmp_segment_file << ": " << segment_ptr.status();
@@ -24,6 +24,7 @@
 #include <mutex>
 #include <vector>
 
+#include "column/vectorized_fwd.h"
 #include "common/statusor.h"
 #include "gen_cpp/olap_file.pb.h"
 #include "storage/rowset/rowset_writer.h"
@@ -108,7 +109,17 @@ private:
 
     Status _final_merge();
 
+    // Records the keys of the first and the last rows of a segment flushed from a sorted chunk.
+    void _record_segment_key_bounds(uint32_t segment_id, const vectorized::Chunk& chunk);
+
+    // Whether all the segments are flushed from sorted chunks, and the key ranges of them are ascending and
+    // disjoint in the order of the segment ids.
+    bool _are_segments_ordered_by_keys() const;
+
     std::unique_ptr<SegmentWriter> _segment_writer;
+    // The key columns of the first and the last rows of each segment written by flush_chunk(), indexed by the
+    // segment id, guarded by _lock.
+    std::vector<vectorized::Columns> _segment_key_bounds;
 };
 
 // Chunk contains partial columns data corresponding to column_indexes.
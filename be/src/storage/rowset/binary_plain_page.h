@@ -261,7 +261,11 @@ public:
         return -1;
     }
 
+    // The result is cached, a dictionary page is shared by all the data pages of the column.
     uint32_t max_value_length() const {
+        if (_max_value_length >= 0) {
+            return _max_value_length;
+        }
         uint32_t max_length = 0;
         for (int i = 0; i < _num_elems; ++i) {
             uint32_t length = offset(i + 1) - offset_uncheck(i);
@@ -269,6 +273,7 @@ public:
                 max_length = length;
             }
         }
+        _max_value_length = max_length;
         return max_length;
     }
 
@@ -298,6 +303,8 @@ private:
 
     // Index of the currently seeked element in the page.
     uint32_t _cur_idx;
+
+    mutable int64_t _max_value_length = -1;
 };
 
 } // namespace starrocks
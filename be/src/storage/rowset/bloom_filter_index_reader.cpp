@@ -38,6 +38,12 @@ Status BloomFilterIndexReader::load(fs::BlockManager* block_mgr, const std::stri
 
     _bloom_filter_reader = std::make_unique<IndexedColumnReader>(block_mgr, file_name, bf_index_meta);
     RETURN_IF_ERROR(_bloom_filter_reader->load(use_page_cache, kept_in_memory));
+
+    if (bloom_filter_index_meta->has_segment_bloom_filter()) {
+        const std::string& data = bloom_filter_index_meta->segment_bloom_filter();
+        RETURN_IF_ERROR(BloomFilter::create(_algorithm, &_segment_bloom_filter));
+        RETURN_IF_ERROR(_segment_bloom_filter->init(data.data(), data.size(), _hash_strategy));
+    }
     return Status::OK();
 }
 
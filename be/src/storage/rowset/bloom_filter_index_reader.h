@@ -28,6 +28,7 @@
 #include "gen_cpp/segment.pb.h"
 #include "runtime/mem_pool.h"
 #include "storage/column_block.h"
+#include "storage/rowset/bloom_filter.h"
 #include "storage/rowset/common.h"
 #include "storage/rowset/indexed_column_reader.h"
 
@@ -42,7 +43,6 @@ class BlockManager;
 class BloomFilterIndexIterator;
 class IndexedColumnReader;
 class IndexedColumnIterator;
-class BloomFilter;
 
 class BloomFilterIndexReader {
     friend class BloomFilterIndexIterator;
@@ -58,11 +58,17 @@ public:
 
     const TypeInfoPtr& type_info() const { return _typeinfo; }
 
+    // The bloom filter of the whole segment, nullptr if the segment was written without it.
+    const BloomFilter* segment_bloom_filter() const { return _segment_bloom_filter.get(); }
+
     size_t mem_usage() const {
         size_t size = sizeof(BloomFilterIndexReader);
         if (_bloom_filter_reader != nullptr) {
             size += _bloom_filter_reader->mem_usage();
         }
+        if (_segment_bloom_filter != nullptr) {
+            size += _segment_bloom_filter->size();
+        }
         return size;
     }
 
@@ -71,6 +77,7 @@ private:
     BloomFilterAlgorithmPB _algorithm = BLOCK_BLOOM_FILTER;
     HashStrategyPB _hash_strategy = HASH_MURMUR3_X64_64;
     std::unique_ptr<IndexedColumnReader> _bloom_filter_reader;
+    std::unique_ptr<BloomFilter> _segment_bloom_filter;
 };
 
 class BloomFilterIndexIterator {
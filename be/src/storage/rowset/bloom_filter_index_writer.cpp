@@ -21,6 +21,7 @@
 
 #include "storage/rowset/bloom_filter_index_writer.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <utility>
@@ -75,13 +76,13 @@ inline typename CppTypeTraits<type>::CppType get_value(const typename CppTypeTra
 }
 
 template <FieldType type>
-inline void update_bf(BloomFilter* bf, const typename CppTypeTraits<type>::CppType& v) {
+inline uint64_t hash_value(const BloomFilter* bf, const typename CppTypeTraits<type>::CppType& v) {
     using CppType = typename CppTypeTraits<type>::CppType;
     if constexpr (is_slice_type<type>()) {
         const Slice* s = reinterpret_cast<const Slice*>(&v);
-        bf->add_bytes(s->data, s->size);
+        return bf->hash(s->data, s->size);
     } else {
-        bf->add_bytes(reinterpret_cast<const char*>(&v), sizeof(CppType));
+        return bf->hash(reinterpret_cast<const char*>(&v), sizeof(CppType));
     }
 }
 
@@ -90,6 +91,8 @@ inline void update_bf(BloomFilter* bf, const typename CppTypeTraits<type>::CppTy
 // efficiency.
 // This builder builds a bloom filter page by every data page, with a page id index.
 // Meanswhile, It adds an ordinal index to load bloom filter index according to requirement.
+// A bloom filter of the whole segment is also kept in the meta, so a segment not containing the
+// value is skipped without reading any bloom filter page.
 //
 template <FieldType field_type>
 class BloomFilterIndexWriterImpl : public BloomFilterIndexWriter {
@@ -120,7 +123,9 @@ public:
         RETURN_IF_ERROR(bf->init(_values.size(), _bf_options.fpp, _bf_options.strategy));
         bf->set_has_null(_has_null);
         for (auto& v : _values) {
-            update_bf<field_type>(bf.get(), v);
+            uint64_t hash = hash_value<field_type>(bf.get(), v);
+            bf->add_hash(hash);
+            _segment_hashes.push_back(hash);
         }
         _bf_buffer_size += bf->size();
         _bfs.push_back(std::move(bf));
@@ -150,12 +155,25 @@ public:
             bf_writer.add(&data);
         }
         RETURN_IF_ERROR(bf_writer.finish(meta->mutable_bloom_filter()));
+
+        // A value may be in several pages.
+        std::sort(_segment_hashes.begin(), _segment_hashes.end());
+        _segment_hashes.erase(std::unique(_segment_hashes.begin(), _segment_hashes.end()), _segment_hashes.end());
+        std::unique_ptr<BloomFilter> segment_bf;
+        RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, &segment_bf));
+        RETURN_IF_ERROR(segment_bf->init(_segment_hashes.size(), _bf_options.fpp, _bf_options.strategy));
+        segment_bf->set_has_null(_has_null);
+        for (uint64_t hash : _segment_hashes) {
+            segment_bf->add_hash(hash);
+        }
+        meta->set_segment_bloom_filter(segment_bf->data(), segment_bf->size());
         return Status::OK();
     }
 
     uint64_t size() override {
         uint64_t total_size = _bf_buffer_size;
         total_size += _pool.total_allocated_bytes();
+        total_size += _segment_hashes.size() * sizeof(uint64_t);
         return total_size;
     }
 
@@ -168,6 +186,8 @@ private:
     // distinct values
     ValueDict _values;
     std::vector<std::unique_ptr<BloomFilter>> _bfs;
+    // hashes of the distinct values of every page, for the bloom filter of the segment
+    std::vector<uint64_t> _segment_hashes;
 };
 
 } // namespace
@@ -23,6 +23,7 @@
 
 #include "column/fixed_length_column.h"
 #include "column/nullable_column.h"
+#include "storage/vectorized_column_predicate.h"
 
 namespace starrocks {
 
@@ -38,6 +39,25 @@ Status ColumnIterator::decode_dict_codes(const vectorized::Column& codes, vector
     }
 }
 
+Status ColumnIterator::next_batch_with_filter(const vectorized::SparseRange& range,
+                                              const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                              vectorized::Column* dst, uint8_t* selection) {
+    const size_t from = dst->size();
+    RETURN_IF_ERROR(next_batch(range, dst));
+    _evaluate_predicates(predicates, dst, selection, from, dst->size());
+    return Status::OK();
+}
+
+void ColumnIterator::_evaluate_predicates(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                          const vectorized::Column* column, uint8_t* selection, uint16_t from,
+                                          uint16_t to) {
+    DCHECK(!predicates.empty());
+    predicates[0]->evaluate(column, selection, from, to);
+    for (size_t i = 1; i < predicates.size(); i++) {
+        predicates[i]->evaluate_and(column, selection, from, to);
+    }
+}
+
 Status ColumnIterator::fetch_values_by_rowid(const vectorized::Column& rowids, vectorized::Column* values) {
     static_assert(std::is_same_v<uint32_t, rowid_t>);
     const auto& numeric_col = down_cast<const vectorized::FixedLengthColumn<rowid_t>&>(rowids);
@@ -21,6 +21,9 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include "common/status.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/common.h"
@@ -41,12 +44,15 @@ class ReadableBlock;
 } // namespace fs
 
 class ColumnReader;
+class PagePointer;
 
 struct ColumnIteratorOptions {
     fs::ReadableBlock* rblock = nullptr;
     // reader statistics
     OlapReaderStatistics* stats = nullptr;
     bool use_page_cache = false;
+    // Whether to insert the pages read into the page cache if use_page_cache is true.
+    bool fill_page_cache = true;
 
     // check whether column pages are all dictionary encoding.
     bool check_dict_encoding = false;
@@ -100,6 +106,16 @@ public:
         return Status::NotSupported("ColumnIterator Not Support batch read");
     }
 
+    // Like `next_batch`, but also evaluate the |predicates| of this column on the rows read, the result of
+    // the i-th row of |dst| is written to |selection[i]|, as ColumnPredicate::evaluate does.
+    // The predicates can be evaluated on the encoded data of some pages, e.g. the dictionary codes,
+    // if `support_page_predicate_pushdown` returns true. Otherwise, they're evaluated on |dst| after read.
+    virtual Status next_batch_with_filter(const vectorized::SparseRange& range,
+                                          const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                          vectorized::Column* dst, uint8_t* selection);
+
+    virtual bool support_page_predicate_pushdown() const { return false; }
+
     virtual ordinal_t get_current_ordinal() const = 0;
 
     /// for vectorized engine
@@ -112,6 +128,19 @@ public:
         return Status::OK();
     }
 
+    virtual Status get_row_ranges_by_ngram_index(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                                 vectorized::SparseRange* row_ranges) {
+        return Status::OK();
+    }
+
+    // Append the first ordinal and the pointer of each data page covering |range| to |pages|, in ordinal order.
+    // It's used to plan the readahead of the pages that will be read, so the iterators that cannot tell the
+    // pages in advance, e.g. the default value iterator and the array iterator, append nothing.
+    virtual Status get_data_pages(const vectorized::SparseRange& range,
+                                  std::vector<std::pair<ordinal_t, PagePointer>>* pages) {
+        return Status::OK();
+    }
+
     // return true iff all data pages of this column are encoded as dictionary encoding.
     // NOTE: the ColumnIterator must have been initialized with `check_dict_encoding`,
     // otherwise this method will always return false.
@@ -178,6 +207,11 @@ public:
     Status fetch_dict_codes_by_rowid(const vectorized::Column& rowids, vectorized::Column* values);
 
 protected:
+    // Evaluate the AND of |predicates| on the rows [from, to) of |column|.
+    static void _evaluate_predicates(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                     const vectorized::Column* column, uint8_t* selection, uint16_t from,
+                                     uint16_t to);
+
     ColumnIteratorOptions _opts;
 };
 
@@ -30,6 +30,7 @@
 #include "column/column_helper.h"
 #include "column/datum_convert.h"
 #include "common/logging.h"
+#include "storage/roaring2range.h"
 #include "storage/rowset/array_column_iterator.h"
 #include "storage/rowset/binary_dict_page.h" // for BinaryDictPageDecoder
 #include "storage/rowset/bitmap_index_reader.h"
@@ -57,12 +58,20 @@ StatusOr<std::unique_ptr<ColumnReader>> ColumnReader::create(ColumnMetaPB* meta,
 }
 
 ColumnReader::ColumnReader(const private_type&, const Segment* segment)
-        : _zone_map_index(), _ordinal_index(), _bitmap_index(), _bloom_filter_index(), _segment(segment) {
+        : _zone_map_index(),
+          _ordinal_index(),
+          _bitmap_index(),
+          _bloom_filter_index(),
+          _ngram_index(),
+          _segment(segment) {
     mem_tracker()->consume(sizeof(ColumnReader));
 }
 
 ColumnReader::~ColumnReader() {
     int64_t size = sizeof(ColumnReader);
+    if (_dict_compress_codec != nullptr) {
+        size += _dict_compress_codec->mem_usage();
+    }
     if (_flags[kHasOrdinalIndexMetaPos]) {
         size += _ordinal_index.meta->SpaceUsedLong();
         delete _ordinal_index.meta;
@@ -95,6 +104,14 @@ ColumnReader::~ColumnReader() {
         size += _bloom_filter_index.reader->mem_usage();
         delete _bloom_filter_index.reader;
     }
+    if (_flags[kHasNGramIndexMetaPos]) {
+        size += _ngram_index.meta->SpaceUsedLong();
+        delete _ngram_index.meta;
+    }
+    if (_flags[kHasNGramIndexReaderPos]) {
+        size += _ngram_index.reader->mem_usage();
+        delete _ngram_index.reader;
+    }
     mem_tracker()->release(size);
 }
 
@@ -114,6 +131,15 @@ Status ColumnReader::_init(ColumnMetaPB* meta) {
     if (is_scalar_field_type(delegate_type(_column_type))) {
         RETURN_IF_ERROR(EncodingInfo::get(delegate_type(_column_type), meta->encoding(), &_encoding_info));
         RETURN_IF_ERROR(get_block_compression_codec(meta->compression(), &_compress_codec));
+        if (meta->has_compression_dict()) {
+            if (meta->compression() != ZSTD) {
+                return Status::Corruption("compression dictionary is only supported by zstd");
+            }
+            RETURN_IF_ERROR(create_zstd_dict_codec(meta->compression_dict(), &_dict_compress_codec));
+            _compress_codec = _dict_compress_codec.get();
+            mem_tracker()->consume(_dict_compress_codec->mem_usage());
+            meta->clear_compression_dict();
+        }
 
         for (int i = 0; i < meta->indexes_size(); i++) {
             auto* index_meta = meta->mutable_indexes(i);
@@ -139,6 +165,11 @@ Status ColumnReader::_init(ColumnMetaPB* meta) {
                 _flags.set(kHasBloomFilterIndexMetaPos, true);
                 mem_tracker()->consume(_bloom_filter_index.meta->SpaceUsedLong());
                 break;
+            case NGRAM_INDEX:
+                _ngram_index.meta = index_meta->release_ngram_index();
+                _flags.set(kHasNGramIndexMetaPos, true);
+                mem_tracker()->consume(_ngram_index.meta->SpaceUsedLong());
+                break;
             case UNKNOWN_INDEX_TYPE:
                 return Status::Corruption(fmt::format("Bad file {}: unknown index type", file_name()));
             }
@@ -208,6 +239,8 @@ Status ColumnReader::read_page(const ColumnIteratorOptions& iter_opts, const Pag
     opts.stats = iter_opts.stats;
     opts.verify_checksum = true;
     opts.use_page_cache = iter_opts.use_page_cache;
+    opts.fill_page_cache = iter_opts.fill_page_cache;
+    opts.cache_file_id = _segment->page_cache_file_id();
     opts.encoding_type = _encoding_info->encoding();
     opts.kept_in_memory = keep_in_memory();
 
@@ -242,6 +275,20 @@ Status ColumnReader::_parse_zone_map(const ZoneMapPB& zm, vectorized::ZoneMapDet
 Status ColumnReader::bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
                                   vectorized::SparseRange* row_ranges) {
     RETURN_IF_ERROR(_load_bloom_filter_index_once());
+    // Skip reading the bloom filter pages if no value of the segment satisfies the predicates.
+    if (const BloomFilter* segment_bf = _bloom_filter_index.reader->segment_bloom_filter(); segment_bf != nullptr) {
+        bool may_match = false;
+        for (const auto* pred : predicates) {
+            if (pred->support_bloom_filter() && pred->bloom_filter(segment_bf)) {
+                may_match = true;
+                break;
+            }
+        }
+        if (!may_match) {
+            *row_ranges = vectorized::SparseRange();
+            return Status::OK();
+        }
+    }
     vectorized::SparseRange bf_row_ranges;
     std::unique_ptr<BloomFilterIndexIterator> bf_iter;
     RETURN_IF_ERROR(_bloom_filter_index.reader->new_iterator(&bf_iter));
@@ -272,6 +319,32 @@ Status ColumnReader::bloom_filter(const std::vector<const vectorized::ColumnPred
     return Status::OK();
 }
 
+Status ColumnReader::ngram_index_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                        vectorized::SparseRange* row_ranges) {
+    std::vector<std::vector<std::string>> pred_substrings;
+    for (const auto* pred : predicates) {
+        std::vector<std::string> substrings;
+        if (pred->get_ngram_substrings(&substrings)) {
+            pred_substrings.emplace_back(std::move(substrings));
+        }
+    }
+    // Do not load the index if no predicate can use it.
+    RETURN_IF(pred_substrings.empty(), Status::OK());
+    RETURN_IF_ERROR(_load_ngram_index_once());
+    for (const auto& substrings : pred_substrings) {
+        Roaring rows;
+        bool filtered = false;
+        RETURN_IF_ERROR(_ngram_index.reader->filter(substrings, &rows, &filtered));
+        if (filtered) {
+            *row_ranges = row_ranges->intersection(vectorized::roaring2range(rows));
+        }
+        if (row_ranges->empty()) {
+            break;
+        }
+    }
+    return Status::OK();
+}
+
 Status ColumnReader::_load_ordinal_index(bool use_page_cache, bool kept_in_memory) {
     Status st;
     if (_flags[kHasOrdinalIndexMetaPos]) {
@@ -299,6 +372,11 @@ Status ColumnReader::_load_zone_map_index(bool use_page_cache, bool kept_in_memo
         _flags.set(kHasZoneMapIndexReaderPos, true);
         st = _zone_map_index.reader->load(block_manager(), file_name(), index_meta.get(), use_page_cache,
                                           kept_in_memory);
+        if (st.ok()) {
+            // DECIMAL32/DECIMAL64/DECIMAL128 stored as INT32/INT64/INT128
+            st = _zone_map_index.reader->init_zone_map_details(get_type_info(delegate_type(_column_type)),
+                                                               num_rows(), config::zone_map_pages_per_granule);
+        }
         mem_tracker()->consume(_zone_map_index.reader->mem_usage());
     }
     return st;
@@ -366,26 +444,36 @@ Status ColumnReader::_zone_map_filter(const std::vector<const vectorized::Column
                                       const vectorized::ColumnPredicate* del_predicate,
                                       std::unordered_set<uint32_t>* del_partial_filtered_pages,
                                       std::vector<uint32_t>* pages) {
-    const std::vector<ZoneMapPB>& zone_maps = _zone_map_index.reader->page_zone_maps();
-    int32_t page_size = _zone_map_index.reader->num_pages();
-    for (int32_t i = 0; i < page_size; ++i) {
-        const ZoneMapPB& zm = zone_maps[i];
-        vectorized::ZoneMapDetail detail;
-        _parse_zone_map(zm, &detail);
-        bool matched = true;
+    auto matched = [&](const vectorized::ZoneMapDetail& detail) {
         for (const auto* predicate : predicates) {
             if (!predicate->zone_map_filter(detail)) {
-                matched = false;
-                break;
+                return false;
             }
         }
-        if (!matched) {
+        return true;
+    };
+    const std::vector<vectorized::ZoneMapDetail>& zone_maps = _zone_map_index.reader->page_zone_map_details();
+    const std::vector<vectorized::ZoneMapDetail>& granule_zone_maps =
+            _zone_map_index.reader->granule_zone_map_details();
+    const int32_t page_size = _zone_map_index.reader->num_pages();
+    const bool use_granule = !granule_zone_maps.empty() && !predicates.empty();
+    const int32_t pages_per_granule = use_granule ? _zone_map_index.reader->pages_per_granule() : page_size;
+    for (int32_t begin = 0; begin < page_size; begin += pages_per_granule) {
+        // Skip the whole granule if none of its pages can be matched.
+        if (use_granule && !matched(granule_zone_maps[begin / pages_per_granule])) {
             continue;
         }
-        pages->emplace_back(i);
+        const int32_t end = std::min(begin + pages_per_granule, page_size);
+        for (int32_t i = begin; i < end; ++i) {
+            const vectorized::ZoneMapDetail& detail = zone_maps[i];
+            if (!matched(detail)) {
+                continue;
+            }
+            pages->emplace_back(i);
 
-        if (del_predicate && del_predicate->zone_map_filter(detail)) {
-            del_partial_filtered_pages->emplace(i);
+            if (del_predicate && del_predicate->zone_map_filter(detail)) {
+                del_partial_filtered_pages->emplace(i);
+            }
         }
     }
     return Status::OK();
@@ -425,6 +513,21 @@ Status ColumnReader::new_iterator(ColumnIterator** iterator) {
     }
 }
 
+Status ColumnReader::_load_ngram_index(bool use_page_cache, bool kept_in_memory) {
+    Status st;
+    if (_flags[kHasNGramIndexMetaPos]) {
+        SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
+        std::unique_ptr<NGramIndexPB> index_meta(_ngram_index.meta);
+        _flags.set(kHasNGramIndexMetaPos, false);
+        mem_tracker()->release(index_meta->SpaceUsedLong());
+        _ngram_index.reader = new NGramIndexReader();
+        _flags.set(kHasNGramIndexReaderPos, true);
+        st = _ngram_index.reader->load(block_manager(), file_name(), index_meta.get(), use_page_cache, kept_in_memory);
+        mem_tracker()->consume(_ngram_index.reader->mem_usage());
+    }
+    return st;
+}
+
 Status ColumnReader::_load_zone_map_index_once() {
     Status status = _zonemap_index_once.call(
             [this] { return _load_zone_map_index(!config::disable_storage_page_cache, keep_in_memory()); });
@@ -443,6 +546,12 @@ Status ColumnReader::_load_bloom_filter_index_once() {
     return status;
 }
 
+Status ColumnReader::_load_ngram_index_once() {
+    Status status = _ngram_index_once.call(
+            [this] { return _load_ngram_index(!config::disable_storage_page_cache, keep_in_memory()); });
+    return status;
+}
+
 Status ColumnReader::load_ordinal_index_once() {
     // Only load ordinal index.
     // Other indexes like zone map/bitmap/bloomfilter should be load when necessary
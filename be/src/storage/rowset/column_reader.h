@@ -39,6 +39,7 @@
 #include "storage/rowset/bitmap_index_reader.h"
 #include "storage/rowset/bloom_filter_index_reader.h"
 #include "storage/rowset/common.h"
+#include "storage/rowset/ngram_index.h"
 #include "storage/rowset/ordinal_page_index.h" // for OrdinalPageIndexIterator
 #include "storage/rowset/page_handle.h"
 #include "storage/rowset/segment.h"
@@ -116,6 +117,7 @@ public:
     bool has_bloom_filter_index() const {
         return _flags[kHasBloomFilterIndexMetaPos] || _flags[kHasBloomFilterIndexReaderPos];
     }
+    bool has_ngram_index() const { return _flags[kHasNGramIndexMetaPos] || _flags[kHasNGramIndexReaderPos]; }
 
     ZoneMapPB* segment_zone_map() const { return _segment_zone_map.get(); }
 
@@ -147,6 +149,11 @@ public:
     Status bloom_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& p,
                         vectorized::SparseRange* ranges);
 
+    // Remove the rows not containing the substrings required by the predicates from |ranges|.
+    // prerequisite: has_ngram_index().
+    Status ngram_index_filter(const std::vector<const ::starrocks::vectorized::ColumnPredicate*>& p,
+                              vectorized::SparseRange* ranges);
+
     Status load_ordinal_index_once();
 
     uint32_t num_rows() const { return _segment->num_rows(); }
@@ -184,6 +191,8 @@ private:
     constexpr static size_t kIsNullablePos = 8;
     constexpr static size_t kHasAllDictEncodedPos = 9;
     constexpr static size_t kAllDictEncodedPos = 10;
+    constexpr static size_t kHasNGramIndexMetaPos = 11;
+    constexpr static size_t kHasNGramIndexReaderPos = 12;
 
     // Disable copy and assignment
     ColumnReader(const ColumnReader&) = delete;
@@ -197,11 +206,13 @@ private:
     Status _load_zone_map_index_once();
     Status _load_bitmap_index_once();
     Status _load_bloom_filter_index_once();
+    Status _load_ngram_index_once();
 
     Status _load_zone_map_index(bool use_page_cache, bool kept_in_memory);
     Status _load_ordinal_index(bool use_page_cache, bool kept_in_memory);
     Status _load_bitmap_index(bool use_page_cache, bool kept_in_memory);
     Status _load_bloom_filter_index(bool use_page_cache, bool kept_in_memory);
+    Status _load_ngram_index(bool use_page_cache, bool kept_in_memory);
 
     static void _parse_zone_map(const ZoneMapPB& zone_map, WrapperField* min_value_container,
                                 WrapperField* max_value_container);
@@ -224,11 +235,14 @@ private:
     // initialized in init(), used for create PageDecoder
     const EncodingInfo* _encoding_info = nullptr;
     const BlockCompressionCodec* _compress_codec = nullptr; // initialized in init()
+    // the codec with the compression dictionary of the column, if any, which |_compress_codec| points to.
+    std::unique_ptr<BlockCompressionCodec> _dict_compress_codec;
 
     ColumnIndex<ZoneMapIndexPB, ZoneMapIndexReader> _zone_map_index;
     ColumnIndex<OrdinalIndexPB, OrdinalIndexReader> _ordinal_index;
     ColumnIndex<BitmapIndexPB, BitmapIndexReader> _bitmap_index;
     ColumnIndex<BloomFilterIndexPB, BloomFilterIndexReader> _bloom_filter_index;
+    ColumnIndex<NGramIndexPB, NGramIndexReader> _ngram_index;
 
     std::unique_ptr<ZoneMapPB> _segment_zone_map;
 
@@ -237,12 +251,13 @@ private:
 
     // The read operation comprise of compaction, query, checksum and so on.
     // The ordinal index must be loaded before read operation.
-    // zonemap, bitmap, bloomfilter is only necessary for query.
+    // zonemap, bitmap, bloomfilter, ngram is only necessary for query.
     // the other operations can not load these indices.
     StarRocksCallOnce<Status> _ordinal_index_once;
     StarRocksCallOnce<Status> _zonemap_index_once;
     StarRocksCallOnce<Status> _bitmap_index_once;
     StarRocksCallOnce<Status> _bloomfilter_index_once;
+    StarRocksCallOnce<Status> _ngram_index_once;
 
     // Pointer to its father segment, as the column reader
     // is never released before the end of the parent's life cycle,
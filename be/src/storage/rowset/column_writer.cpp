@@ -39,6 +39,7 @@
 #include "storage/rowset/bloom_filter.h"
 #include "storage/rowset/bloom_filter_index_writer.h"
 #include "storage/rowset/encoding_info.h"
+#include "storage/rowset/ngram_index.h"
 #include "storage/rowset/options.h"
 #include "storage/rowset/ordinal_page_index.h"
 #include "storage/rowset/page_builder.h"
@@ -235,6 +236,7 @@ public:
     Status write_zone_map() override { return _scalar_column_writer->write_zone_map(); };
     Status write_bitmap_index() override { return _scalar_column_writer->write_bitmap_index(); };
     Status write_bloom_filter_index() override { return _scalar_column_writer->write_bloom_filter_index(); };
+    Status write_ngram_index() override { return _scalar_column_writer->write_ngram_index(); };
 
     ordinal_t get_next_rowid() const override { return _scalar_column_writer->get_next_rowid(); };
 
@@ -358,6 +360,7 @@ ScalarColumnWriter::~ScalarColumnWriter() {
 
 Status ScalarColumnWriter::init() {
     RETURN_IF_ERROR(get_block_compression_codec(_opts.meta->compression(), &_compress_codec));
+    _pending_compression_dict = _opts.need_compression_dict && _opts.meta->compression() == ZSTD;
 
     if (!_opts.need_speculate_encoding) {
         set_encoding(_opts.meta->encoding());
@@ -386,6 +389,10 @@ Status ScalarColumnWriter::init() {
         RETURN_IF_ERROR(BloomFilterIndexWriter::create(BloomFilterOptions(), get_field()->type_info(),
                                                        &_bloom_filter_index_builder));
     }
+    if (_opts.need_ngram_index && get_field()->type() == OLAP_FIELD_TYPE_VARCHAR) {
+        _has_index_builder = true;
+        _ngram_index_builder = std::make_unique<NGramIndexWriter>(std::max(config::ngram_index_gram_size, 1));
+    }
     return Status::OK();
 }
 
@@ -409,11 +416,17 @@ uint64_t ScalarColumnWriter::estimate_buffer_size() {
     if (_bloom_filter_index_builder != nullptr) {
         size += _bloom_filter_index_builder->size();
     }
+    if (_ngram_index_builder != nullptr) {
+        size += _ngram_index_builder->size();
+    }
     return size;
 }
 
 Status ScalarColumnWriter::finish() {
     RETURN_IF_ERROR(finish_current_page());
+    if (_pending_compression_dict) {
+        RETURN_IF_ERROR(_train_compression_dict());
+    }
     _opts.meta->set_num_rows(_next_rowid);
     _opts.meta->set_total_mem_footprint(_total_mem_footprint);
     return Status::OK();
@@ -509,6 +522,13 @@ Status ScalarColumnWriter::write_bloom_filter_index() {
     return Status::OK();
 }
 
+Status ScalarColumnWriter::write_ngram_index() {
+    if (_ngram_index_builder != nullptr) {
+        return _ngram_index_builder->finish(_wblock, _opts.meta->add_indexes());
+    }
+    return Status::OK();
+}
+
 // write a data page into file and update ordinal index
 Status ScalarColumnWriter::_write_data_page(Page* page) {
     PagePointer pp;
@@ -521,6 +541,50 @@ Status ScalarColumnWriter::_write_data_page(Page* page) {
     return Status::OK();
 }
 
+Status ScalarColumnWriter::_train_compression_dict() {
+    DCHECK(_pending_compression_dict);
+    _pending_compression_dict = false;
+    // All the pages cached are uncompressed, split them into small samples, since zstd learns better from
+    // many small samples than a few large ones.
+    const size_t kSampleSize = 4096;
+    std::vector<Slice> samples;
+    for (Page* page = _pages.head; page != nullptr; page = page->next) {
+        for (auto& data : page->data) {
+            Slice slice = data.slice();
+            for (size_t offset = 0; offset < slice.size; offset += kSampleSize) {
+                samples.emplace_back(slice.data + offset, std::min(kSampleSize, slice.size - offset));
+            }
+        }
+    }
+    std::string dict;
+    Status st = train_zstd_dictionary(samples, std::max(config::zstd_dict_max_size, 256), &dict);
+    if (st.ok()) {
+        RETURN_IF_ERROR(create_zstd_dict_codec(dict, &_dict_compress_codec));
+        _compress_codec = _dict_compress_codec.get();
+        _opts.meta->set_compression_dict(std::move(dict));
+    } else {
+        // too little data to train a dictionary, compress the pages by zstd without dictionary.
+        VLOG(2) << "Fail to train compression dictionary: " << st.to_string();
+    }
+
+    for (Page* page = _pages.head; page != nullptr; page = page->next) {
+        std::vector<Slice> body;
+        for (auto& data : page->data) {
+            body.push_back(data.slice());
+        }
+        faststring compressed_body;
+        RETURN_IF_ERROR(PageIO::compress_page_body(_compress_codec, _opts.compression_min_space_saving, body,
+                                                   &compressed_body));
+        if (compressed_body.size() > 0) {
+            _data_size -= Slice::compute_total_size(body);
+            _data_size += compressed_body.size();
+            page->data.clear();
+            page->data.emplace_back(compressed_body.build());
+        }
+    }
+    return Status::OK();
+}
+
 Status ScalarColumnWriter::finish_current_page() {
     if (_zone_map_index_builder != nullptr) {
         RETURN_IF_ERROR(_zone_map_index_builder->flush());
@@ -569,8 +633,13 @@ Status ScalarColumnWriter::finish_current_page() {
     }
     // trying to compress page body
     faststring compressed_body;
-    RETURN_IF_ERROR(
-            PageIO::compress_page_body(_compress_codec, _opts.compression_min_space_saving, body, &compressed_body));
+    if (_pending_compression_dict) {
+        // keep the page uncompressed until the compression dictionary is trained.
+        _compression_dict_sample_bytes += page->footer.uncompressed_size();
+    } else {
+        RETURN_IF_ERROR(PageIO::compress_page_body(_compress_codec, _opts.compression_min_space_saving, body,
+                                                   &compressed_body));
+    }
     if (compressed_body.size() == 0) {
         // page body is uncompressed
         double space_saving =
@@ -596,6 +665,9 @@ Status ScalarColumnWriter::finish_current_page() {
     }
 
     _push_back_page(page.release());
+    if (_pending_compression_dict && _compression_dict_sample_bytes >= config::zstd_dict_sample_bytes) {
+        RETURN_IF_ERROR(_train_compression_dict());
+    }
 
     if (is_nullable() && _opts.adaptive_page_format) {
         size_t num_data = (_curr_page_format == 1) ? _page_builder->count() : _null_map_builder_v2->data_count();
@@ -741,10 +813,12 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
                     INDEX_ADD_NULLS(_zone_map_index_builder, run);
                     INDEX_ADD_NULLS(_bitmap_index_builder, run);
                     INDEX_ADD_NULLS(_bloom_filter_index_builder, run);
+                    INDEX_ADD_NULLS(_ngram_index_builder, run);
                 } else {
                     INDEX_ADD_VALUES(_zone_map_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bitmap_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bloom_filter_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_ngram_index_builder, pdata, run);
                 }
                 pdata += get_field()->size() * run;
             }
@@ -752,6 +826,7 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
             INDEX_ADD_VALUES(_zone_map_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bitmap_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bloom_filter_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_ngram_index_builder, data, num_written);
         }
 
         _next_rowid += num_written;
@@ -61,6 +61,10 @@ struct ColumnWriterOptions {
     bool need_zone_map = false;
     bool need_bitmap_index = false;
     bool need_bloom_filter = false;
+    // only supported by the VARCHAR column.
+    bool need_ngram_index = false;
+    // Train a dictionary on the first pages to compress all the pages of the column, only used by ZSTD.
+    bool need_compression_dict = false;
     bool adaptive_page_format = false;
     // for char/varchar will speculate encoding in append
     // for others will decide encoding in init method
@@ -78,6 +82,7 @@ class NullFlagsBuilder;
 class OrdinalIndexWriter;
 class PageBuilder;
 class BloomFilterIndexWriter;
+class NGramIndexWriter;
 class ZoneMapIndexWriter;
 
 class ColumnWriter {
@@ -114,6 +119,8 @@ public:
 
     virtual Status write_bloom_filter_index() = 0;
 
+    virtual Status write_ngram_index() = 0;
+
     virtual ordinal_t get_next_rowid() const = 0;
 
     // only invalid in the case of global_dict is not nullptr
@@ -169,6 +176,7 @@ public:
     Status write_zone_map() override;
     Status write_bitmap_index() override;
     Status write_bloom_filter_index() override;
+    Status write_ngram_index() override;
     ordinal_t get_next_rowid() const override { return _next_rowid; }
 
     bool is_global_dict_valid() override { return _is_global_dict_valid; }
@@ -211,6 +219,9 @@ private:
 
     Status _write_data_page(Page* page);
 
+    // Train the compression dictionary on the pages cached, and compress them.
+    Status _train_compression_dict();
+
     ColumnWriterOptions _opts;
     fs::WritableBlock* _wblock;
     uint32_t _curr_page_format;
@@ -223,6 +234,10 @@ private:
     ordinal_t _next_rowid = 0;
 
     const BlockCompressionCodec* _compress_codec = nullptr;
+    // The codec with the compression dictionary. The pages are not compressed until the dictionary is trained.
+    std::unique_ptr<BlockCompressionCodec> _dict_compress_codec;
+    bool _pending_compression_dict = false;
+    uint64_t _compression_dict_sample_bytes = 0;
     const EncodingInfo* _encoding_info = nullptr;
 
     std::unique_ptr<PageBuilder> _page_builder;
@@ -238,7 +253,8 @@ private:
     std::unique_ptr<ZoneMapIndexWriter> _zone_map_index_builder;
     std::unique_ptr<BitmapIndexWriter> _bitmap_index_builder;
     std::unique_ptr<BloomFilterIndexWriter> _bloom_filter_index_builder;
-    // _zone_map_index_builder != NULL || _bitmap_index_builder != NULL || _bloom_filter_index_builder != NULL
+    std::unique_ptr<NGramIndexWriter> _ngram_index_builder;
+    // any of the index builders above except _ordinal_index_builder is not NULL
     bool _has_index_builder = false;
     int64_t _element_ordinal = 0;
     int64_t _previous_ordinal = 0;
@@ -276,6 +292,8 @@ public:
 
     Status write_bloom_filter_index() override { return Status::OK(); }
 
+    Status write_ngram_index() override { return Status::OK(); }
+
     ordinal_t get_next_rowid() const override { return _array_size_writer->get_next_rowid(); }
 
     uint64_t total_mem_footprint() const override;
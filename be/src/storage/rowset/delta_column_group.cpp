@@ -0,0 +1,110 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/delta_column_group.h"
+
+#include <fmt/format.h>
+
+#include "column/chunk.h"
+#include "common/config.h"
+#include "env/env.h"
+#include "gen_cpp/segment.pb.h"
+#include "gutil/strings/substitute.h"
+#include "storage/chunk_helper.h"
+#include "storage/fs/block_manager.h"
+#include "storage/olap_common.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
+#include "storage/rowset/segment_writer.h"
+
+namespace starrocks {
+
+std::string delta_column_file_path(const std::string& segment_path, const DeltaColumnGroupPB& dcg) {
+    auto pos = segment_path.rfind('/');
+    return pos == std::string::npos ? dcg.file_name() : segment_path.substr(0, pos + 1) + dcg.file_name();
+}
+
+Status DeltaColumnGroupWriter::write(const std::shared_ptr<fs::BlockManager>& block_mgr,
+                                     const std::shared_ptr<Segment>& segment, const DeltaColumnGroupList& dcgs,
+                                     int64_t version, const std::vector<uint32_t>& column_ids,
+                                     const std::vector<uint32_t>& rowids, const vectorized::Chunk& values,
+                                     DeltaColumnGroupPB* dcg) {
+    if (column_ids.empty() || values.num_columns() != column_ids.size() || values.num_rows() != rowids.size()) {
+        return Status::InvalidArgument(fmt::format("Mismatched delta columns, #column:{}/{} #row:{}/{}",
+                                                   values.num_columns(), column_ids.size(), values.num_rows(),
+                                                   rowids.size()));
+    }
+    const TabletSchema& tschema = segment->tablet_schema();
+
+    // <rowset id>_<segment id>.dat => <rowset id>_<segment id>_<version>.cols
+    std::string segment_name = segment->file_name().substr(segment->file_name().rfind('/') + 1);
+    segment_name = segment_name.substr(0, segment_name.rfind('.'));
+    dcg->Clear();
+    dcg->set_version(version);
+    dcg->mutable_column_ids()->Add(column_ids.begin(), column_ids.end());
+    dcg->set_file_name(strings::Substitute("$0_$1.cols", segment_name, version));
+
+    // Read the current values of the columns, which may be overridden by the older groups.
+    auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tschema, column_ids);
+    OlapReaderStatistics stats;
+    vectorized::SegmentReadOptions read_opts;
+    read_opts.block_mgr = block_mgr;
+    read_opts.stats = &stats;
+    read_opts.chunk_size = config::vector_chunk_size;
+    read_opts.delta_column_groups = &dcgs;
+    ASSIGN_OR_RETURN(auto iter, segment->new_iterator(schema, read_opts));
+
+    std::unique_ptr<fs::WritableBlock> wblock;
+    fs::CreateBlockOptions wblock_opts({delta_column_file_path(segment->file_name(), *dcg)});
+    wblock_opts.mode = Env::CREATE_OR_OPEN_WITH_TRUNCATE;
+    RETURN_IF_ERROR(block_mgr->create_block(wblock_opts, &wblock));
+    SegmentWriterOptions opts;
+    opts.storage_format_version = config::storage_format_version;
+    SegmentWriter writer(std::move(wblock), segment->id(), &tschema, opts);
+    // The delta column file has no key column, and has as many rows as the segment.
+    SegmentFooterPB footer;
+    footer.set_num_rows(segment->num_rows());
+    RETURN_IF_ERROR(writer.init(column_ids, false, &footer));
+
+    auto chunk = vectorized::ChunkHelper::new_chunk(schema, read_opts.chunk_size);
+    auto output = chunk->clone_empty();
+    rowid_t base = 0;
+    size_t next = 0;
+    while (true) {
+        chunk->reset();
+        Status st = iter->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        RETURN_IF_ERROR(st);
+        const rowid_t end = base + chunk->num_rows();
+        if (next < rowids.size() && rowids[next] < end) {
+            output->reset();
+            rowid_t pos = base;
+            for (; next < rowids.size() && rowids[next] < end; next++) {
+                if (rowids[next] < pos) {
+                    return Status::InvalidArgument("The row ids of the delta columns are not in ascending order");
+                }
+                output->append(*chunk, pos - base, rowids[next] - pos);
+                output->append(values, next, 1);
+                pos = rowids[next] + 1;
+            }
+            output->append(*chunk, pos - base, end - pos);
+            RETURN_IF_ERROR(writer.append_chunk(*output));
+        } else {
+            RETURN_IF_ERROR(writer.append_chunk(*chunk));
+        }
+        base = end;
+    }
+    iter->close();
+    if (base != segment->num_rows() || next != rowids.size()) {
+        return Status::InternalError(fmt::format("Fail to write delta columns of {}, #row:{}/{} #update:{}/{}",
+                                                 segment->file_name(), base, segment->num_rows(), next,
+                                                 rowids.size()));
+    }
+    uint64_t index_size = 0;
+    uint64_t file_size = 0;
+    RETURN_IF_ERROR(writer.finalize_columns(&index_size));
+    return writer.finalize_footer(&file_size);
+}
+
+} // namespace starrocks
@@ -0,0 +1,60 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "gen_cpp/olap_file.pb.h"
+
+namespace starrocks {
+
+class Segment;
+
+namespace fs {
+class BlockManager;
+} // namespace fs
+
+namespace vectorized {
+class Chunk;
+} // namespace vectorized
+
+// Support of the column mode partial update of primary key tablets.
+//
+// Instead of the full rows, a column mode partial update writes the updated columns of all the rows of
+// each segment it touches into a delta column file, whose columns are read in place of the columns of the
+// segment. The delta column groups of a segment are saved in the meta by version, so that the readers of
+// the older versions are not affected, and they are folded into the new segments by compaction.
+//
+// The delta column groups of a segment, ordered by version from newest to oldest.
+using DeltaColumnGroupList = std::vector<DeltaColumnGroupPB>;
+
+// Return the index of the newest group containing column |cid| in |dcgs|, or -1 if not found.
+inline int find_delta_column_group(const DeltaColumnGroupList& dcgs, uint32_t cid) {
+    for (int i = 0; i < dcgs.size(); i++) {
+        for (uint32_t id : dcgs[i].column_ids()) {
+            if (id == cid) {
+                return i;
+            }
+        }
+    }
+    return -1;
+}
+
+// Return the path of the delta column file of |dcg| attached to the segment at |segment_path|.
+std::string delta_column_file_path(const std::string& segment_path, const DeltaColumnGroupPB& dcg);
+
+class DeltaColumnGroupWriter {
+public:
+    // Write the delta column file of the columns |column_ids| of |segment| at |version|, and describe it in
+    // |dcg|. The rows |rowids|, which must be in ascending order, take the values in |values|, whose columns
+    // match |column_ids|, and the other rows keep the values read from |segment| and its groups |dcgs|.
+    static Status write(const std::shared_ptr<fs::BlockManager>& block_mgr, const std::shared_ptr<Segment>& segment,
+                        const DeltaColumnGroupList& dcgs, int64_t version, const std::vector<uint32_t>& column_ids,
+                        const std::vector<uint32_t>& rowids, const vectorized::Chunk& values,
+                        DeltaColumnGroupPB* dcg);
+};
+
+} // namespace starrocks
@@ -64,6 +64,11 @@ public:
         return _col_iter->get_row_ranges_by_zone_map(predicates, del_predicate, row_ranges);
     }
 
+    Status get_data_pages(const vectorized::SparseRange& range,
+                          std::vector<std::pair<ordinal_t, PagePointer>>* pages) override {
+        return _col_iter->get_data_pages(range, pages);
+    }
+
 private:
     ColumnId _cid;
     ColumnIterator* _col_iter;
@@ -166,6 +171,11 @@ public:
         return _col_iter->get_row_ranges_by_zone_map(predicates, del_predicate, row_ranges);
     }
 
+    Status get_data_pages(const vectorized::SparseRange& range,
+                          std::vector<std::pair<ordinal_t, PagePointer>>* pages) override {
+        return _col_iter->get_data_pages(range, pages);
+    }
+
     static Status build_code_convert_map(ScalarColumnIterator* file_column_iter, GlobalDictMap* global_dict,
                                          std::vector<int16_t>* code_convert_map);
 
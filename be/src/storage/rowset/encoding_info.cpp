@@ -25,6 +25,7 @@
 
 #include "gutil/strings/substitute.h"
 #include "storage/olap_common.h"
+#include "storage/rowset/adaptive_numeric_page.h"
 #include "storage/rowset/binary_dict_page.h"
 #include "storage/rowset/binary_plain_page.h"
 #include "storage/rowset/binary_prefix_page.h"
@@ -130,6 +131,32 @@ struct TypeEncodingTraits<type, FOR_ENCODING, CppType,
     }
 };
 
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, DELTA_ENCODING, CppType,
+                          typename std::enable_if<std::is_integral<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new DeltaPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts, PageDecoder** decoder) {
+        *decoder = new DeltaPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, ALP_ENCODING, CppType,
+                          typename std::enable_if<std::is_floating_point<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new AlpPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts, PageDecoder** decoder) {
+        *decoder = new AlpPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
 template <FieldType type>
 struct TypeEncodingTraits<type, PREFIX_ENCODING, Slice> {
     static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
@@ -263,6 +290,16 @@ EncodingInfoResolver::EncodingInfoResolver() {
 
     _add_map<OLAP_FIELD_TYPE_PERCENTILE, PLAIN_ENCODING>();
     _add_map<OLAP_FIELD_TYPE_JSON, PLAIN_ENCODING>();
+
+    // The adaptive encodings are added at last, to not be the default encodings, for they cannot be read by
+    // the older versions.
+    _add_map<OLAP_FIELD_TYPE_INT, DELTA_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_BIGINT, DELTA_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_DATE_V2, DELTA_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_DATETIME, DELTA_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_TIMESTAMP, DELTA_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_FLOAT, ALP_ENCODING>();
+    _add_map<OLAP_FIELD_TYPE_DOUBLE, ALP_ENCODING>();
 }
 
 EncodingInfoResolver::~EncodingInfoResolver() {
@@ -303,4 +340,20 @@ EncodingTypePB EncodingInfo::get_default_encoding(const FieldType& data_type, bo
     return s_encoding_info_resolver.get_default_encoding(data_type, optimize_value_seek);
 }
 
+EncodingTypePB EncodingInfo::get_adaptive_encoding(const FieldType& data_type) {
+    switch (delegate_type(data_type)) {
+    case OLAP_FIELD_TYPE_INT:
+    case OLAP_FIELD_TYPE_BIGINT:
+    case OLAP_FIELD_TYPE_DATE_V2:
+    case OLAP_FIELD_TYPE_DATETIME:
+    case OLAP_FIELD_TYPE_TIMESTAMP:
+        return DELTA_ENCODING;
+    case OLAP_FIELD_TYPE_FLOAT:
+    case OLAP_FIELD_TYPE_DOUBLE:
+        return ALP_ENCODING;
+    default:
+        return DEFAULT_ENCODING;
+    }
+}
+
 } // namespace starrocks
@@ -45,6 +45,10 @@ public:
     // and support fast value seek operation
     static EncodingTypePB get_default_encoding(const FieldType& data_type, bool optimize_value_seek);
 
+    // The encoding adapting to the values of each page, i.e. DELTA_ENCODING for the integers and
+    // ALP_ENCODING for the floating point numbers, or DEFAULT_ENCODING if |data_type| has none.
+    static EncodingTypePB get_adaptive_encoding(const FieldType& data_type);
+
     Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) const {
         return _create_builder_func(opts, builder);
     }
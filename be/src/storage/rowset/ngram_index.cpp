@@ -0,0 +1,143 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/ngram_index.h"
+
+#include <fmt/format.h>
+
+#include <set>
+
+#include "storage/rowset/encoding_info.h"
+#include "storage/rowset/indexed_column_writer.h"
+#include "storage/types.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+void NGramIndexWriter::add_values(const void* values, size_t count) {
+    auto p = reinterpret_cast<const Slice*>(values);
+    for (size_t i = 0; i < count; ++i) {
+        _add_value(p[i]);
+        _rid++;
+    }
+}
+
+void NGramIndexWriter::_add_value(const Slice& value) {
+    for (size_t pos = 0; pos + _gram_size <= value.size; ++pos) {
+        std::string_view gram(value.data + pos, _gram_size);
+        auto iter = _grams.find(gram);
+        if (iter == _grams.end()) {
+            iter = _grams.emplace(std::string(gram), Roaring()).first;
+            _size += _gram_size + sizeof(Roaring);
+        } else if (iter->second.maximum() == _rid) {
+            // the gram occurs more than once in this row.
+            continue;
+        }
+        iter->second.add(_rid);
+        // a row id takes 2 bytes in an array container of roaring bitmap.
+        _size += sizeof(uint16_t);
+    }
+}
+
+Status NGramIndexWriter::finish(fs::WritableBlock* wblock, ColumnIndexMetaPB* index_meta) {
+    index_meta->set_type(NGRAM_INDEX);
+    NGramIndexPB* meta = index_meta->mutable_ngram_index();
+    meta->set_gram_size(_gram_size);
+    BitmapIndexPB* bitmap_meta = meta->mutable_gram_bitmaps();
+    bitmap_meta->set_bitmap_type(BitmapIndexPB::ROARING_BITMAP);
+    bitmap_meta->set_has_null(false);
+
+    { // write dictionary of grams
+        TypeInfoPtr typeinfo = get_type_info(OLAP_FIELD_TYPE_VARCHAR);
+        IndexedColumnWriterOptions options;
+        options.write_ordinal_index = false;
+        options.write_value_index = true;
+        options.encoding = EncodingInfo::get_default_encoding(typeinfo->type(), true);
+        options.compression = CompressionTypePB::LZ4_FRAME;
+
+        IndexedColumnWriter dict_column_writer(options, typeinfo, wblock);
+        RETURN_IF_ERROR(dict_column_writer.init());
+        for (const auto& [gram, bitmap] : _grams) {
+            Slice value(gram);
+            RETURN_IF_ERROR(dict_column_writer.add(&value));
+        }
+        RETURN_IF_ERROR(dict_column_writer.finish(bitmap_meta->mutable_dict_column()));
+    }
+    { // write bitmaps
+        TypeInfoPtr bitmap_typeinfo = get_type_info(OLAP_FIELD_TYPE_OBJECT);
+        IndexedColumnWriterOptions options;
+        options.write_ordinal_index = true;
+        options.write_value_index = false;
+        options.encoding = EncodingInfo::get_default_encoding(bitmap_typeinfo->type(), false);
+        // we already store compressed bitmap, use NO_COMPRESSION to save some cpu
+        options.compression = NO_COMPRESSION;
+
+        IndexedColumnWriter bitmap_column_writer(options, bitmap_typeinfo, wblock);
+        RETURN_IF_ERROR(bitmap_column_writer.init());
+        faststring buf;
+        for (auto& [gram, bitmap] : _grams) {
+            bitmap.runOptimize();
+            buf.resize(bitmap.getSizeInBytes(false));
+            bitmap.write(reinterpret_cast<char*>(buf.data()), false);
+            Slice buf_slice(buf);
+            RETURN_IF_ERROR(bitmap_column_writer.add(&buf_slice));
+        }
+        RETURN_IF_ERROR(bitmap_column_writer.finish(bitmap_meta->mutable_bitmap_column()));
+    }
+    return Status::OK();
+}
+
+Status NGramIndexReader::load(fs::BlockManager* block_mgr, const std::string& file_name, const NGramIndexPB* meta,
+                              bool use_page_cache, bool kept_in_memory) {
+    _gram_size = meta->gram_size();
+    if (_gram_size == 0) {
+        return Status::Corruption(fmt::format("Bad file {}: invalid gram size of n-gram index", file_name));
+    }
+    return _bitmap_index_reader.load(block_mgr, file_name, &meta->gram_bitmaps(), use_page_cache, kept_in_memory);
+}
+
+Status NGramIndexReader::filter(const std::vector<std::string>& substrings, Roaring* rows, bool* filtered) {
+    // The grams are looked up in order, so the dictionary pages are visited sequentially.
+    std::set<std::string_view> grams;
+    for (const auto& str : substrings) {
+        for (size_t pos = 0; pos + _gram_size <= str.size(); ++pos) {
+            grams.emplace(str.data() + pos, _gram_size);
+        }
+    }
+    *filtered = !grams.empty();
+    if (grams.empty()) {
+        return Status::OK();
+    }
+
+    BitmapIndexIterator* iter_ptr = nullptr;
+    RETURN_IF_ERROR(_bitmap_index_reader.new_iterator(&iter_ptr));
+    std::unique_ptr<BitmapIndexIterator> iter(iter_ptr);
+    Roaring result;
+    bool first = true;
+    for (const auto& gram : grams) {
+        Slice value(gram.data(), gram.size());
+        bool exact_match = false;
+        Status st = iter->seek_dictionary(&value, &exact_match);
+        if (st.is_not_found() || (st.ok() && !exact_match)) {
+            // No row contains this gram.
+            *rows = Roaring();
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(st);
+        Roaring bitmap;
+        RETURN_IF_ERROR(iter->read_bitmap(iter->current_ordinal(), &bitmap));
+        if (first) {
+            result = std::move(bitmap);
+            first = false;
+        } else {
+            result &= bitmap;
+        }
+        if (result.isEmpty()) {
+            break;
+        }
+    }
+    *rows = std::move(result);
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -0,0 +1,80 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <roaring/roaring.hh>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/status.h"
+#include "gen_cpp/segment.pb.h"
+#include "storage/rowset/bitmap_index_reader.h"
+#include "storage/rowset/common.h"
+
+namespace starrocks {
+
+namespace fs {
+class BlockManager;
+class WritableBlock;
+} // namespace fs
+
+// Builder for the n-gram index of a string column, which is used to filter the rows by LIKE predicates.
+//
+// The index shares the layout of the bitmap index, except that the ordered dictionary contains all distinct
+// grams, i.e. substrings of |gram_size| bytes, of the column, and the bitmap of a gram contains the rows
+// containing it. E.g. with |gram_size| 3, the values ['abcd', 'bcd', 'xy'] build the dictionary
+// ['abc', 'bcd'] and the bitmaps [0] and [0, 1]. The values shorter than |gram_size| have no gram.
+//
+// A row containing a string must contain every gram of the string, so the candidate rows of
+// `c LIKE '%bcd%'` are the intersection of the bitmaps of its grams.
+class NGramIndexWriter {
+public:
+    explicit NGramIndexWriter(uint32_t gram_size) : _gram_size(gram_size) {}
+
+    NGramIndexWriter(const NGramIndexWriter&) = delete;
+    const NGramIndexWriter& operator=(const NGramIndexWriter&) = delete;
+
+    // |values| is an array of Slice.
+    void add_values(const void* values, size_t count);
+
+    void add_nulls(uint32_t count) { _rid += count; }
+
+    Status finish(fs::WritableBlock* wblock, ColumnIndexMetaPB* index_meta);
+
+    uint64_t size() const { return _size; }
+
+private:
+    void _add_value(const Slice& value);
+
+    const uint32_t _gram_size;
+    rowid_t _rid = 0;
+    uint64_t _size = 0;
+    // gram to the row id list
+    std::map<std::string, Roaring, std::less<>> _grams;
+};
+
+class NGramIndexReader {
+public:
+    NGramIndexReader() = default;
+
+    Status load(fs::BlockManager* block_mgr, const std::string& file_name, const NGramIndexPB* meta,
+                bool use_page_cache, bool kept_in_memory);
+
+    // Get the rows that may contain all the |substrings| into |rows|.
+    // Set |*filtered| to false if none of the |substrings| is long enough to be looked up, in which case
+    // |rows| is not touched.
+    Status filter(const std::vector<std::string>& substrings, Roaring* rows, bool* filtered);
+
+    uint32_t gram_size() const { return _gram_size; }
+
+    size_t mem_usage() const { return sizeof(NGramIndexReader) + _bitmap_index_reader.mem_usage(); }
+
+private:
+    uint32_t _gram_size = 0;
+    BitmapIndexReader _bitmap_index_reader;
+};
+
+} // namespace starrocks
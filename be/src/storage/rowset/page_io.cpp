@@ -35,8 +35,10 @@
 #include "util/coding.h"
 #include "util/crc32c.h"
 #include "util/faststring.h"
+#include "util/io_latency_metrics.h"
 #include "util/runtime_profile.h"
 #include "util/scoped_cleanup.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks {
 
@@ -111,6 +113,28 @@ Status PageIO::write_page(fs::WritableBlock* wblock, const std::vector<Slice>& b
     return Status::OK();
 }
 
+static void record_read_latency(const std::string& path, PageTypePB page_type, int64_t read_ns) {
+    IOType io_type;
+    switch (page_type) {
+    case DATA_PAGE:
+        io_type = IOType::DATA_PAGE;
+        break;
+    case INDEX_PAGE:
+        io_type = IOType::INDEX_PAGE;
+        break;
+    case DICTIONARY_PAGE:
+        io_type = IOType::DICT_PAGE;
+        break;
+    case SHORT_KEY_PAGE:
+        io_type = IOType::SHORT_KEY_PAGE;
+        break;
+    default:
+        return;
+    }
+    auto* io_latency_metrics = IOLatencyMetrics::instance();
+    io_latency_metrics->record(io_latency_metrics->disk_index(path), io_type, read_ns);
+}
+
 Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle* handle, Slice* body,
                                         PageFooterPB* footer) {
     // the function will be used by query or load, current load is not allowed to fail when memory reach the limit,
@@ -122,7 +146,9 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
 
     auto cache = StoragePageCache::instance();
     PageCacheHandle cache_handle;
-    StoragePageCache::CacheKey cache_key(opts.rblock->path(), opts.page_pointer.offset);
+    StoragePageCache::CacheKey cache_key(
+            opts.cache_file_id ? *opts.cache_file_id : StoragePageCache::file_id(opts.rblock->path()),
+            opts.page_pointer.offset);
     if (opts.use_page_cache && cache->lookup(cache_key, &cache_handle)) {
         // we find page in cache, use it
         *handle = PageHandle(std::move(cache_handle));
@@ -148,11 +174,13 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
     std::unique_ptr<char[]> page(new char[page_size + vectorized::Column::APPEND_OVERFLOW_MAX_SIZE]);
     Slice page_slice(page.get(), page_size);
+    int64_t read_ns = 0;
     {
-        SCOPED_RAW_TIMER(&opts.stats->io_ns);
+        SCOPED_RAW_TIMER(&read_ns);
         RETURN_IF_ERROR(opts.rblock->read(opts.page_pointer.offset, page_slice));
         opts.stats->compressed_bytes_read += page_size;
     }
+    opts.stats->io_ns += read_ns;
 
     if (opts.verify_checksum) {
         uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
@@ -170,6 +198,7 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     if (!footer->ParseFromArray(page_slice.data + page_slice.size - 4 - footer_size, footer_size)) {
         return Status::Corruption("Bad page: invalid footer");
     }
+    record_read_latency(opts.rblock->path(), footer->type(), read_ns);
 
     uint32_t body_size = page_slice.size - 4 - footer_size;
     if (body_size != footer->uncompressed_size()) { // need decompress body
@@ -203,11 +232,14 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     RETURN_IF_ERROR(StoragePageDecoder::decode_page(footer, footer_size + 4, opts.encoding_type, &page, &page_slice));
 
     *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
-    if (opts.use_page_cache) {
+    if (opts.use_page_cache && opts.fill_page_cache) {
         // insert this page into cache and return the cache handle
         cache->insert(cache_key, page_slice, &cache_handle, opts.kept_in_memory);
         *handle = PageHandle(std::move(cache_handle));
     } else {
+        if (opts.use_page_cache) {
+            StarRocksMetrics::instance()->page_cache_bypass_total.increment(1);
+        }
         *handle = PageHandle(page_slice);
     }
     page.release(); // memory now managed by handle
@@ -21,11 +21,13 @@
 
 #pragma once
 
+#include <optional>
 #include <vector>
 
 #include "common/logging.h"
 #include "common/status.h"
 #include "gen_cpp/segment.pb.h"
+#include "storage/page_cache.h"
 #include "storage/rowset/page_handle.h"
 #include "storage/rowset/page_pointer.h"
 #include "util/slice.h"
@@ -53,6 +55,10 @@ struct PageReadOptions {
     bool verify_checksum = true;
     // whether to use page cache in read path
     bool use_page_cache = true;
+    // whether to insert the page read into page cache if use_page_cache is true
+    bool fill_page_cache = true;
+    // identifier of the file in page cache, computed from the path of rblock if not set
+    std::optional<StoragePageCache::FileId> cache_file_id;
     // if true, use DURABLE CachePriority in page cache
     // currently used for in memory olap table
     bool kept_in_memory = false;
@@ -0,0 +1,236 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/readahead_block.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+
+#include "common/logging.h"
+#include "storage/olap_common.h"
+#include "util/priority_thread_pool.hpp"
+
+namespace starrocks {
+
+// The pages whose gap is not larger than this are coalesced into one read,
+// since reading the gap is cheaper than issuing another io.
+static constexpr uint64_t kMaxCoalesceGapBytes = 64 * 1024;
+
+struct ReadaheadBlock::Window {
+    enum State { PENDING, LOADING, LOADED, CANCELLED };
+
+    struct IORange {
+        uint64_t offset;
+        uint64_t size;
+        // offset of the range in |buffer|.
+        uint64_t buffer_offset;
+    };
+
+    // The planned pages in [begin, end) are read by this window.
+    size_t begin = 0;
+    size_t end = 0;
+    // Sorted by offset and not overlapped.
+    std::vector<IORange> ranges;
+    std::unique_ptr<uint8_t[]> buffer;
+    uint64_t buffer_size = 0;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    State state = PENDING;
+    Status status;
+
+    // Change the state from PENDING to LOADING, return false if it's loading, loaded or cancelled.
+    bool try_start() {
+        std::lock_guard<std::mutex> l(mutex);
+        if (state != PENDING) {
+            return false;
+        }
+        state = LOADING;
+        return true;
+    }
+};
+
+ReadaheadBlock::ReadaheadBlock(fs::ReadableBlock* block, int64_t window_bytes, PriorityThreadPool* pool,
+                               OlapReaderStatistics* stats)
+        : _block(block), _window_bytes(window_bytes), _pool(pool), _stats(stats) {
+    DCHECK(_block != nullptr);
+    DCHECK_GT(_window_bytes, 0);
+}
+
+ReadaheadBlock::~ReadaheadBlock() {
+    (void)close();
+}
+
+void ReadaheadBlock::set_pages(std::vector<PagePointer> pages) {
+    (void)close();
+    _pages = std::move(pages);
+    _page_indexes.clear();
+    _page_indexes.reserve(_pages.size());
+    for (size_t i = 0; i < _pages.size(); ++i) {
+        // Keep the first one if a page is planned more than once.
+        _page_indexes.emplace(_pages[i].offset, i);
+    }
+}
+
+Status ReadaheadBlock::close() {
+    // The windows may be being loaded by |_pool| and reference |_block|, so they must be
+    // cancelled or finished before |_block| is closed by the owner.
+    if (_current != nullptr) {
+        _cancel(_current.get());
+        _current.reset();
+    }
+    if (_next != nullptr) {
+        _cancel(_next.get());
+        _next.reset();
+    }
+    return Status::OK();
+}
+
+Status ReadaheadBlock::read(uint64_t offset, Slice result) {
+    if (_current != nullptr && _copy_from(*_current, offset, result)) {
+        _stats->readahead_pages++;
+        return Status::OK();
+    }
+
+    auto iter = _page_indexes.find(offset);
+    if (iter == _page_indexes.end() || _pages[iter->second].size != result.size) {
+        return _block->read(offset, result);
+    }
+    const size_t page_index = iter->second;
+
+    if (_current != nullptr) {
+        _cancel(_current.get());
+        _current.reset();
+    }
+    if (_next != nullptr && _next->begin <= page_index && page_index < _next->end) {
+        _current = std::move(_next);
+    } else {
+        // The pages are not read in the planned order, e.g. some pages are skipped by the predicates,
+        // restart the readahead from this page.
+        if (_next != nullptr) {
+            _cancel(_next.get());
+            _next.reset();
+        }
+        _current = _make_window(page_index);
+    }
+
+    Status st = _wait(_current.get());
+    if (!st.ok()) {
+        // Let the underlying block report the error of this page, if any.
+        LOG(WARNING) << "Fail to read ahead " << _block->path() << ": " << st;
+        _current.reset();
+        return _block->read(offset, result);
+    }
+    _stats->readahead_bytes += _current->buffer_size;
+
+    if (_current->end < _pages.size()) {
+        _next = _make_window(_current->end);
+        _submit(_next);
+    }
+
+    bool found = _copy_from(*_current, offset, result);
+    DCHECK(found);
+    _stats->readahead_pages++;
+    return Status::OK();
+}
+
+ReadaheadBlock::WindowPtr ReadaheadBlock::_make_window(size_t begin) {
+    DCHECK_LT(begin, _pages.size());
+    auto window = std::make_shared<Window>();
+    window->begin = begin;
+    size_t end = begin;
+    int64_t bytes = 0;
+    // A window contains at least one page.
+    while (end < _pages.size() && (end == begin || bytes + _pages[end].size <= _window_bytes)) {
+        bytes += _pages[end].size;
+        end++;
+    }
+    window->end = end;
+
+    std::vector<PagePointer> pages(_pages.begin() + begin, _pages.begin() + end);
+    std::sort(pages.begin(), pages.end(),
+              [](const PagePointer& lhs, const PagePointer& rhs) { return lhs.offset < rhs.offset; });
+    for (const auto& page : pages) {
+        if (!window->ranges.empty()) {
+            auto& last = window->ranges.back();
+            if (page.offset <= last.offset + last.size + kMaxCoalesceGapBytes) {
+                last.size = std::max(last.offset + last.size, page.offset + page.size) - last.offset;
+                continue;
+            }
+        }
+        window->ranges.push_back({page.offset, page.size, 0});
+    }
+    for (auto& range : window->ranges) {
+        range.buffer_offset = window->buffer_size;
+        window->buffer_size += range.size;
+    }
+    window->buffer.reset(new uint8_t[window->buffer_size]);
+    return window;
+}
+
+void ReadaheadBlock::_submit(const WindowPtr& window) {
+    for (const auto& range : window->ranges) {
+        _block->will_need(range.offset, range.size);
+    }
+    if (_pool == nullptr) {
+        return;
+    }
+    PriorityThreadPool::Task task;
+    task.work_function = [block = _block, window]() {
+        if (window->try_start()) {
+            _load(block, window.get());
+        }
+    };
+    // If the pool is full, the window is loaded by the caller when it's needed.
+    (void)_pool->try_offer(task);
+}
+
+Status ReadaheadBlock::_wait(Window* window) {
+    if (window->try_start()) {
+        _load(_block, window);
+    }
+    std::unique_lock<std::mutex> l(window->mutex);
+    window->cv.wait(l, [window] { return window->state == Window::LOADED; });
+    return window->status;
+}
+
+void ReadaheadBlock::_cancel(Window* window) {
+    std::unique_lock<std::mutex> l(window->mutex);
+    if (window->state == Window::PENDING) {
+        window->state = Window::CANCELLED;
+        return;
+    }
+    window->cv.wait(l, [window] { return window->state != Window::LOADING; });
+}
+
+void ReadaheadBlock::_load(fs::ReadableBlock* block, Window* window) {
+    Status st;
+    for (const auto& range : window->ranges) {
+        st = block->read(range.offset, Slice(window->buffer.get() + range.buffer_offset, range.size));
+        if (!st.ok()) {
+            break;
+        }
+    }
+    std::lock_guard<std::mutex> l(window->mutex);
+    window->status = std::move(st);
+    window->state = Window::LOADED;
+    window->cv.notify_all();
+}
+
+bool ReadaheadBlock::_copy_from(const Window& window, uint64_t offset, Slice result) const {
+    // Find the last range starting at or before |offset|.
+    auto iter = std::upper_bound(window.ranges.begin(), window.ranges.end(), offset,
+                                 [](uint64_t off, const Window::IORange& range) { return off < range.offset; });
+    if (iter == window.ranges.begin()) {
+        return false;
+    }
+    --iter;
+    if (offset + result.size > iter->offset + iter->size) {
+        return false;
+    }
+    memcpy(result.data, window.buffer.get() + iter->buffer_offset + (offset - iter->offset), result.size);
+    return true;
+}
+
+} // namespace starrocks
@@ -0,0 +1,94 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+#include "storage/fs/block_manager.h"
+#include "storage/rowset/page_pointer.h"
+
+namespace starrocks {
+
+struct OlapReaderStatistics;
+class PriorityThreadPool;
+
+// ReadaheadBlock wraps the ReadableBlock of a segment file and reads ahead the data pages that
+// a SegmentIterator is going to read.
+//
+// The pages are given by set_pages() in the order they will be read, and are split into windows of
+// about |window_bytes|. The pages of a window are sorted by offset and the adjacent ones are coalesced
+// into a single large read, so turning the many small random reads of different columns into a few
+// sequential ones. While the current window is being consumed, the next one is loaded by |pool|.
+// If the next window is still waiting in the queue of |pool| when it's needed, it's loaded by the
+// caller directly instead of waiting for a free thread. The ranges of the next window are also hinted
+// to the underlying block by will_need() when it's made, so the local files have their reads issued
+// by the kernel at once, even if no thread of |pool| is free or |pool| is nullptr.
+//
+// The reads of the pages not planned, e.g. the index pages and the pages of the columns that cannot
+// tell their pages in advance, are passed through to the underlying block.
+//
+// NOTE: unlike other ReadableBlocks, ReadaheadBlock is NOT thread-safe, it's meant to be used by a
+// single SegmentIterator.
+class ReadaheadBlock final : public fs::ReadableBlock {
+public:
+    // Does not take the ownership of |block|, |pool| and |stats|.
+    // If |pool| is nullptr, the windows are loaded synchronously.
+    ReadaheadBlock(fs::ReadableBlock* block, int64_t window_bytes, PriorityThreadPool* pool,
+                   OlapReaderStatistics* stats);
+    ~ReadaheadBlock() override;
+
+    ReadaheadBlock(const ReadaheadBlock&) = delete;
+    ReadaheadBlock& operator=(const ReadaheadBlock&) = delete;
+
+    // Set the data pages to read ahead, in the order they will be read.
+    // The windows loaded or being loaded are discarded.
+    void set_pages(std::vector<PagePointer> pages);
+
+    const fs::BlockId& id() const override { return _block->id(); }
+
+    // The page cache is keyed by the path, so it's kept the same as the underlying block.
+    const std::string& path() const override { return _block->path(); }
+
+    Status close() override;
+
+    fs::BlockManager* block_manager() const override { return _block->block_manager(); }
+
+    Status size(uint64_t* sz) override { return _block->size(sz); }
+
+    Status read(uint64_t offset, Slice result) override;
+
+    void will_need(uint64_t offset, uint64_t size) override { _block->will_need(offset, size); }
+
+private:
+    struct Window;
+    using WindowPtr = std::shared_ptr<Window>;
+
+    // Create the window starting from the |begin|-th planned page.
+    WindowPtr _make_window(size_t begin);
+    // Load |window| by |_pool| if possible.
+    void _submit(const WindowPtr& window);
+    // Wait for |window| to be loaded, load it by the caller if it hasn't been picked up by |_pool|.
+    Status _wait(Window* window);
+    void _cancel(Window* window);
+    // Copy the bytes in [offset, offset + result.size) to |result| if |window| contains them.
+    bool _copy_from(const Window& window, uint64_t offset, Slice result) const;
+
+    static void _load(fs::ReadableBlock* block, Window* window);
+
+    fs::ReadableBlock* _block;
+    const int64_t _window_bytes;
+    PriorityThreadPool* _pool;
+    OlapReaderStatistics* _stats;
+
+    std::vector<PagePointer> _pages;
+    // offset of page => index of the page in _pages.
+    std::unordered_map<uint64_t, size_t> _page_indexes;
+
+    WindowPtr _current;
+    WindowPtr _next;
+};
+
+} // namespace starrocks
@@ -202,8 +202,8 @@ public:
     // hard link all files in this rowset to `dir` to form a new rowset with id `new_rowset_id`.
     virtual Status link_files_to(const std::string& dir, RowsetId new_rowset_id) = 0;
 
-    // copy all files to `dir`
-    virtual Status copy_files_to(const std::string& dir) = 0;
+    // copy all files to `dir`, at most `max_bytes_per_sec` bytes per second if it's positive.
+    virtual Status copy_files_to(const std::string& dir, int64_t max_bytes_per_sec) = 0;
 
     // return whether `path` is one of the files in this rowset
     virtual bool check_path(const std::string& path) = 0;
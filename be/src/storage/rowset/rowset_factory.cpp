@@ -36,7 +36,7 @@ Status RowsetFactory::create_rowset(const TabletSchema* schema, const std::strin
                                     const RowsetMetaSharedPtr& rowset_meta, RowsetSharedPtr* rowset) {
     if (rowset_meta->rowset_type() == BETA_ROWSET) {
         *rowset =
-                BetaRowset::create(ExecEnv::GetInstance()->tablet_meta_mem_tracker(), schema, rowset_path, rowset_meta);
+                BetaRowset::create(ExecEnv::GetInstance()->rowset_mem_tracker(), schema, rowset_path, rowset_meta);
         RETURN_IF_ERROR((*rowset)->init());
         return Status::OK();
     }
@@ -284,6 +284,8 @@ private:
     }
 
     void _init() {
+        // The zone maps of rowset are deprecated and never read, don't keep them in memory.
+        _rowset_meta_pb.clear_zone_maps();
         if (_rowset_meta_pb.deprecated_rowset_id() > 0) {
             _rowset_id.init(_rowset_meta_pb.deprecated_rowset_id());
         } else {
@@ -62,6 +62,23 @@ Status RowsetMetaManager::remove(KVStore* meta, const TabletUid& tablet_uid, con
     return meta->remove(META_COLUMN_FAMILY_INDEX, key);
 }
 
+Status RowsetMetaManager::remove(KVStore* meta, const std::vector<RowsetMetaSharedPtr>& rowset_metas) {
+    if (rowset_metas.empty()) {
+        return Status::OK();
+    }
+    rocksdb::WriteBatch batch;
+    rocksdb::ColumnFamilyHandle* handle = meta->handle(META_COLUMN_FAMILY_INDEX);
+    for (const auto& rowset_meta : rowset_metas) {
+        rocksdb::Status st =
+                batch.Delete(handle, get_rowset_meta_key(rowset_meta->tablet_uid(), rowset_meta->rowset_id()));
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to add rowset meta to delete batch: " << st.ToString();
+            return Status::InternalError("failed to add rowset meta to delete batch");
+        }
+    }
+    return meta->write_batch(&batch);
+}
+
 string RowsetMetaManager::get_rowset_meta_key(const TabletUid& tablet_uid, const RowsetId& rowset_id) {
     return fmt::format("{}{}_{}", ROWSET_PREFIX, tablet_uid.to_string(), rowset_id.to_string());
 }
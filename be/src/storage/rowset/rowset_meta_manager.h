@@ -23,6 +23,7 @@
 
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include "storage/rowset/rowset_meta.h"
 
@@ -41,6 +42,9 @@ public:
 
     static Status remove(KVStore* meta, const TabletUid& tablet_uid, const RowsetId& rowset_id);
 
+    // Removes the metas of |rowset_metas| by one write batch.
+    static Status remove(KVStore* meta, const std::vector<RowsetMetaSharedPtr>& rowset_metas);
+
     static std::string get_rowset_meta_key(const TabletUid& tablet_uid, const RowsetId& rowset_id);
 
     static Status traverse_rowset_metas(
@@ -25,7 +25,10 @@ namespace starrocks::vectorized {
 
 class ColumnPredicate;
 class DeletePredicates;
+class RowidRangeOption;
+class RuntimeRangePruner;
 class Schema;
+class SegmentRowFetcher;
 
 class RowsetReadOptions {
 public:
@@ -36,8 +39,17 @@ public:
 
     std::vector<SeekRange> ranges;
 
+    // If not null, only the segments and rows selected by it are read.
+    const RowidRangeOption* rowid_range_option = nullptr;
+
+    // If not null, the segments read are registered in it, and the last field of the read schema, whose id
+    // is |global_rowid_column_id|, is filled with the global row ids of the rows.
+    SegmentRowFetcher* global_rowid_fetcher = nullptr;
+    ColumnId global_rowid_column_id = 0;
+
     std::unordered_map<ColumnId, PredicateList> predicates;
     std::unordered_map<ColumnId, PredicateList> predicates_for_zone_map;
+    const RuntimeRangePruner* runtime_range_pruner = nullptr;
 
     // whether rowset should return rows in sorted order.
     bool sorted = true;
@@ -54,6 +66,8 @@ public:
     starrocks::RuntimeState* runtime_state = nullptr;
     starrocks::RuntimeProfile* profile = nullptr;
     bool use_page_cache = false;
+    bool fill_page_cache = true;
+    int64_t readahead_bytes = 0;
 
     ColumnIdToGlobalDictMap* global_dictmaps = &EMPTY_GLOBAL_DICTMAPS;
     const std::unordered_set<uint32_t>* unused_output_column_ids = nullptr;
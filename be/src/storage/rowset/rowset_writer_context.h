@@ -30,6 +30,7 @@
 namespace starrocks {
 
 class TabletSchema;
+class ThreadPool;
 
 enum RowsetWriterType { kHorizontal = 0, kVertical = 1 };
 
@@ -78,6 +79,9 @@ public:
 
     vectorized::GlobalDictByNameMaps* global_dicts = nullptr;
 
+    // the pool to encode the columns of the large chunks in parallel
+    ThreadPool* parallel_pool = nullptr;
+
     RowsetWriterType writer_type = kHorizontal;
 };
 
@@ -21,6 +21,8 @@
 
 #include "storage/rowset/scalar_column_iterator.h"
 
+#include "column/binary_column.h"
+#include "column/nullable_column.h"
 #include "storage/rowset/binary_dict_page.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/encoding_info.h"
@@ -43,8 +45,10 @@ Status ScalarColumnIterator::init(const ColumnIteratorOptions& opts) {
 
     if (_reader->column_type() == OLAP_FIELD_TYPE_CHAR) {
         _init_dict_decoder_func = &ScalarColumnIterator::_do_init_dict_decoder<OLAP_FIELD_TYPE_CHAR>;
+        _read_page_with_filter_func = &ScalarColumnIterator::_do_read_page_with_filter<OLAP_FIELD_TYPE_CHAR>;
     } else if (_reader->column_type() == OLAP_FIELD_TYPE_VARCHAR) {
         _init_dict_decoder_func = &ScalarColumnIterator::_do_init_dict_decoder<OLAP_FIELD_TYPE_VARCHAR>;
+        _read_page_with_filter_func = &ScalarColumnIterator::_do_read_page_with_filter<OLAP_FIELD_TYPE_VARCHAR>;
     } else {
         return Status::NotSupported("dict encoding with unsupported field type");
     }
@@ -249,6 +253,157 @@ Status ScalarColumnIterator::next_batch(const vectorized::SparseRange& range, ve
     return Status::OK();
 }
 
+Status ScalarColumnIterator::next_batch_with_filter(const vectorized::SparseRange& range,
+                                                    const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                                    vectorized::Column* dst, uint8_t* selection) {
+    if (_read_page_with_filter_func == nullptr) {
+        return ColumnIterator::next_batch_with_filter(range, predicates, dst, selection);
+    }
+    size_t prev_bytes = dst->byte_size();
+    vectorized::SparseRangeIterator iter = range.new_iterator();
+    size_t end_ord = _page->first_ordinal() + _page->num_rows();
+    bool contain_deleted_row = (dst->delete_state() != DEL_NOT_SATISFIED);
+    vectorized::SparseRange read_range;
+    DCHECK(range.empty() || (range.begin() == _current_ordinal));
+
+    // similar to ScalarColumnIterator::next_batch
+    while (iter.has_more()) {
+        if (_page->remaining() == 0 && iter.begin() == end_ord) {
+            _opts.stats->block_seek_num += 1;
+            bool eos = false;
+            RETURN_IF_ERROR(_load_next_page(&eos));
+            if (eos) {
+                break;
+            }
+            end_ord = _page->first_ordinal() + _page->num_rows();
+        } else if (iter.begin() >= end_ord) {
+            _opts.stats->block_seek_num += 1;
+            RETURN_IF_ERROR(seek_to_ordinal(iter.begin()));
+            end_ord = _page->first_ordinal() + _page->num_rows();
+        }
+
+        _current_ordinal = iter.begin();
+        if (end_ord > _current_ordinal) {
+            vectorized::Range r = iter.next(end_ord - _current_ordinal);
+            read_range.add(vectorized::Range(r.begin() - _page->first_ordinal(), r.end() - _page->first_ordinal()));
+            _current_ordinal += r.span_size();
+        }
+
+        if (iter.begin() >= end_ord) {
+            contain_deleted_row = contain_deleted_row || _contains_deleted_row(_page->page_index());
+            RETURN_IF_ERROR((this->*_read_page_with_filter_func)(read_range, predicates, dst, selection));
+            read_range.clear();
+        }
+    }
+
+    if (!read_range.empty()) {
+        contain_deleted_row = contain_deleted_row || _contains_deleted_row(_page->page_index());
+        RETURN_IF_ERROR((this->*_read_page_with_filter_func)(read_range, predicates, dst, selection));
+        read_range.clear();
+    }
+    dst->set_delete_state(contain_deleted_row ? DEL_PARTIAL_SATISFIED : DEL_NOT_SATISFIED);
+    _opts.stats->bytes_read += (dst->byte_size() - prev_bytes);
+
+    return Status::OK();
+}
+
+template <FieldType Type>
+Status ScalarColumnIterator::_do_read_page_with_filter(
+        const vectorized::SparseRange& range, const std::vector<const vectorized::ColumnPredicate*>& predicates,
+        vectorized::Column* dst, uint8_t* selection) {
+    const size_t from = dst->size();
+    if (_page->encoding_type() != DICT_ENCODING) {
+        // The page falls back to the plain encoding, evaluate the predicates on the values.
+        RETURN_IF_ERROR(_page->read(dst, range));
+        _evaluate_predicates(predicates, dst, selection, from, dst->size());
+        return Status::OK();
+    }
+
+    if (_dict_code_selection_predicates != &predicates) {
+        RETURN_IF_ERROR(_build_dict_code_selection<Type>(predicates));
+    }
+    if (_dict_codes == nullptr) {
+        if (dst->is_nullable()) {
+            _dict_codes = vectorized::NullableColumn::create(vectorized::Int32Column::create(),
+                                                             vectorized::NullColumn::create());
+        } else {
+            _dict_codes = vectorized::Int32Column::create();
+        }
+    }
+    _dict_codes->reset_column();
+    RETURN_IF_ERROR(_page->read_dict_codes(_dict_codes.get(), range));
+
+    vectorized::Column* data_column = dst;
+    const vectorized::Int32Column* codes_column = nullptr;
+    bool has_null = false;
+    if (dst->is_nullable()) {
+        auto nullable_codes = down_cast<vectorized::NullableColumn*>(_dict_codes.get());
+        auto nullable_dst = down_cast<vectorized::NullableColumn*>(dst);
+        nullable_codes->update_has_null();
+        has_null = nullable_codes->has_null();
+        const auto& nulls = nullable_codes->immutable_null_column_data();
+        nullable_dst->null_column_data().insert(nullable_dst->null_column_data().end(), nulls.begin(), nulls.end());
+        nullable_dst->set_has_null(has_null);
+        data_column = nullable_dst->data_column().get();
+        codes_column = down_cast<const vectorized::Int32Column*>(nullable_codes->data_column().get());
+    } else {
+        codes_column = down_cast<const vectorized::Int32Column*>(_dict_codes.get());
+    }
+
+    const int32_t* codes = codes_column->get_data().data();
+    const size_t num_codes = codes_column->size();
+    auto dict = down_cast<BinaryPlainPageDecoder<Type>*>(_dict_decoder.get());
+    _dict_words.clear();
+    _dict_words.reserve(num_codes);
+    for (size_t i = 0; i < num_codes; i++) {
+        if (codes[i] < 0) {
+            // null
+            _dict_words.emplace_back("");
+        } else if constexpr (Type != OLAP_FIELD_TYPE_CHAR) {
+            _dict_words.emplace_back(dict->string_at_index(codes[i]));
+        } else {
+            Slice s = dict->string_at_index(codes[i]);
+            s.size = strnlen(s.data, s.size);
+            _dict_words.emplace_back(s);
+        }
+    }
+    [[maybe_unused]] bool ok = data_column->append_strings(_dict_words);
+    DCHECK(ok);
+
+    if (has_null) {
+        // The result of the predicates on nulls cannot be told by the codes, e.g. `IS NULL`.
+        _evaluate_predicates(predicates, dst, selection, from, dst->size());
+        return Status::OK();
+    }
+    const uint8_t* code_selection = _dict_code_selection.data();
+    for (size_t i = 0; i < num_codes; i++) {
+        selection[from + i] = code_selection[codes[i]];
+    }
+    return Status::OK();
+}
+
+template <FieldType Type>
+Status ScalarColumnIterator::_build_dict_code_selection(
+        const std::vector<const vectorized::ColumnPredicate*>& predicates) {
+    // ColumnPredicate takes the uint16_t indexes, so the words are evaluated in batches.
+    static constexpr size_t kBatchSize = 4096;
+    std::vector<Slice> words;
+    RETURN_IF_ERROR(_fetch_all_dict_words<Type>(&words));
+    _dict_code_selection.resize(words.size());
+    auto column = vectorized::BinaryColumn::create();
+    std::vector<Slice> batch;
+    for (size_t i = 0; i < words.size(); i += kBatchSize) {
+        const size_t n = std::min(kBatchSize, words.size() - i);
+        batch.assign(words.begin() + i, words.begin() + i + n);
+        column->reset_column();
+        [[maybe_unused]] bool ok = column->append_strings(batch);
+        DCHECK(ok);
+        _evaluate_predicates(predicates, column.get(), _dict_code_selection.data() + i, 0, n);
+    }
+    _dict_code_selection_predicates = &predicates;
+    return Status::OK();
+}
+
 Status ScalarColumnIterator::_load_next_page(bool* eos) {
     _page_iter.next();
     if (!_page_iter.valid()) {
@@ -336,6 +491,31 @@ Status ScalarColumnIterator::get_row_ranges_by_bloom_filter(
     return Status::OK();
 }
 
+Status ScalarColumnIterator::get_row_ranges_by_ngram_index(
+        const std::vector<const vectorized::ColumnPredicate*>& predicates, vectorized::SparseRange* row_ranges) {
+    RETURN_IF(!_reader->has_ngram_index(), Status::OK());
+    return _reader->ngram_index_filter(predicates, row_ranges);
+}
+
+Status ScalarColumnIterator::get_data_pages(const vectorized::SparseRange& range,
+                                            std::vector<std::pair<ordinal_t, PagePointer>>* pages) {
+    int32_t last_page_index = -1;
+    for (size_t i = 0; i < range.size(); ++i) {
+        const vectorized::Range r = range[i];
+        OrdinalPageIndexIterator iter;
+        RETURN_IF_ERROR(_reader->seek_at_or_before(r.begin(), &iter));
+        while (iter.valid() && iter.first_ordinal() < r.end()) {
+            // Adjacent ranges may be covered by the same page.
+            if (iter.page_index() != last_page_index) {
+                pages->emplace_back(iter.first_ordinal(), iter.page());
+                last_page_index = iter.page_index();
+            }
+            iter.next();
+        }
+    }
+    return Status::OK();
+}
+
 int ScalarColumnIterator::dict_lookup(const Slice& word) {
     DCHECK(all_page_dict_encoded());
     return (this->*_dict_lookup_func)(word);
@@ -461,6 +641,8 @@ Status ScalarColumnIterator::_do_next_batch_dict_codes(const vectorized::SparseR
 
 template <FieldType Type>
 Status ScalarColumnIterator::_do_decode_dict_codes(const int32_t* codes, size_t size, vectorized::Column* words) {
+    // The empty value of the negative codes, padded like the page data for append_strings_overflow.
+    static const char kEmptyValue[vectorized::Column::APPEND_OVERFLOW_MAX_SIZE] = {};
     auto dict = down_cast<BinaryPlainPageDecoder<Type>*>(_dict_decoder.get());
     std::vector<Slice> slices;
     slices.reserve(size);
@@ -474,11 +656,14 @@ Status ScalarColumnIterator::_do_decode_dict_codes(const int32_t* codes, size_t
                 slices.emplace_back(s);
             }
         } else {
-            slices.emplace_back("");
+            slices.emplace_back(kEmptyValue, 0);
         }
     }
-    [[maybe_unused]] bool ok = words->append_strings(slices);
-    DCHECK(ok);
+    // The dictionary page is allocated with APPEND_OVERFLOW_MAX_SIZE bytes of padding, see PageIO.
+    if (!words->append_strings_overflow(slices, dict->max_value_length())) {
+        [[maybe_unused]] bool ok = words->append_strings(slices);
+        DCHECK(ok);
+    }
     _opts.stats->bytes_read += static_cast<int64_t>(words->byte_size() + BitmapSize(slices.size()));
     return Status::OK();
 }
@@ -50,6 +50,14 @@ public:
 
     Status next_batch(const vectorized::SparseRange& range, vectorized::Column* dst) override;
 
+    Status next_batch_with_filter(const vectorized::SparseRange& range,
+                                  const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                  vectorized::Column* dst, uint8_t* selection) override;
+
+    // The predicates are evaluated on the dictionary words once and looked up by the codes of the
+    // dict-encoded pages, instead of being evaluated on every decoded row.
+    bool support_page_predicate_pushdown() const override { return _init_dict_decoder_func != nullptr; }
+
     ordinal_t get_current_ordinal() const override { return _current_ordinal; }
 
     Status get_row_ranges_by_zone_map(const std::vector<const vectorized::ColumnPredicate*>& predicate,
@@ -59,6 +67,12 @@ public:
     Status get_row_ranges_by_bloom_filter(const std::vector<const vectorized::ColumnPredicate*>& predicates,
                                           vectorized::SparseRange* range) override;
 
+    Status get_row_ranges_by_ngram_index(const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                         vectorized::SparseRange* range) override;
+
+    Status get_data_pages(const vectorized::SparseRange& range,
+                          std::vector<std::pair<ordinal_t, PagePointer>>* pages) override;
+
     bool all_page_dict_encoded() const override { return _all_dict_encoded; }
 
     Status fetch_all_dict_words(std::vector<Slice>* words) const override;
@@ -105,6 +119,15 @@ private:
     template <FieldType Type>
     Status _do_init_dict_decoder();
 
+    // Read the rows in |range| of the current page into |dst| and evaluate |predicates| on them.
+    template <FieldType Type>
+    Status _do_read_page_with_filter(const vectorized::SparseRange& range,
+                                     const std::vector<const vectorized::ColumnPredicate*>& predicates,
+                                     vectorized::Column* dst, uint8_t* selection);
+
+    template <FieldType Type>
+    Status _build_dict_code_selection(const std::vector<const vectorized::ColumnPredicate*>& predicates);
+
     template <FieldType Type>
     Status _fetch_all_dict_words(std::vector<Slice>* words) const;
 
@@ -148,6 +171,17 @@ private:
     Status (ScalarColumnIterator::*_init_dict_decoder_func)() = nullptr;
 
     Status (ScalarColumnIterator::*_fetch_all_dict_words_func)(std::vector<Slice>* words) const = nullptr;
+    Status (ScalarColumnIterator::*_read_page_with_filter_func)(
+            const vectorized::SparseRange& range, const std::vector<const vectorized::ColumnPredicate*>& predicates,
+            vectorized::Column* dst, uint8_t* selection) = nullptr;
+
+    // The result of the predicates on each word of the dictionary, indexed by the dict code.
+    std::vector<uint8_t> _dict_code_selection;
+    // The predicates |_dict_code_selection| is built for.
+    const std::vector<const vectorized::ColumnPredicate*>* _dict_code_selection_predicates = nullptr;
+    // Buffers to read the dict codes of a page and decode them.
+    vectorized::ColumnPtr _dict_codes;
+    std::vector<Slice> _dict_words;
 
     // whether all data pages are dict-encoded.
     bool _all_dict_encoded = false;
@@ -30,6 +30,7 @@
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 
 #include <memory>
+#include <set>
 
 #include "column/schema.h"
 #include "common/logging.h"
@@ -42,12 +43,15 @@
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/default_value_column_iterator.h"
 #include "storage/rowset/page_io.h"
+#include "storage/rowset/segment_meta_cache.h"
 #include "storage/rowset/segment_writer.h" // k_segment_magic_length
 #include "storage/tablet_schema.h"
 #include "storage/type_utils.h"
 #include "storage/vectorized_column_predicate.h"
 #include "util/crc32c.h"
+#include "util/io_latency_metrics.h"
 #include "util/slice.h"
+#include "util/time.h"
 
 bvar::Adder<int> g_open_segments;    // NOLINT
 bvar::Adder<int> g_open_segments_io; // NOLINT
@@ -72,7 +76,7 @@ StatusOr<std::shared_ptr<Segment>> Segment::open(MemTracker* mem_tracker, std::s
             DeleterWithMemTracker<Segment>(mem_tracker));
     mem_tracker->consume(segment->mem_usage());
 
-    RETURN_IF_ERROR(segment->_open(mem_tracker, footer_length_hint, partial_rowset_footer));
+    RETURN_IF_ERROR(segment->_open(footer_length_hint, partial_rowset_footer));
     return std::move(segment);
 }
 
@@ -102,7 +106,11 @@ Status Segment::parse_segment_footer(fs::ReadableBlock* rblock, SegmentFooterPB*
     raw::stl_string_resize_uninitialized(&buff, footer_read_size);
     size_t read_pos = partial_rowset_footer ? partial_rowset_footer->position() : file_size - buff.size();
 
+    auto* io_latency_metrics = IOLatencyMetrics::instance();
+    const int disk_index = io_latency_metrics->disk_index(rblock->path());
+    int64_t start_ns = MonotonicNanos();
     RETURN_IF_ERROR(rblock->read(read_pos, buff));
+    io_latency_metrics->record(disk_index, IOType::SEGMENT_FOOTER, MonotonicNanos() - start_ns);
 
     const uint32_t footer_length = UNALIGNED_LOAD32(buff.data() + buff.size() - 12);
     const uint32_t checksum = UNALIGNED_LOAD32(buff.data() + buff.size() - 8);
@@ -142,7 +150,9 @@ Status Segment::parse_segment_footer(fs::ReadableBlock* rblock, SegmentFooterPB*
         int left_size = (int)footer_length - buff.size();
         std::string buff_2;
         raw::stl_string_resize_uninitialized(&buff_2, left_size);
+        start_ns = MonotonicNanos();
         RETURN_IF_ERROR(rblock->read(file_size - footer_length - 12, buff_2));
+        io_latency_metrics->record(disk_index, IOType::SEGMENT_FOOTER, MonotonicNanos() - start_ns);
         actual_checksum = crc32c::Extend(actual_checksum, buff_2.data(), buff_2.size());
         actual_checksum = crc32c::Extend(actual_checksum, buff.data(), buff.size());
 
@@ -170,22 +180,57 @@ Segment::Segment(const private_type&, std::shared_ptr<fs::BlockManager> blk_mgr,
                  const TabletSchema* tablet_schema, MemTracker* mem_tracker)
         : _block_mgr(std::move(blk_mgr)),
           _fname(std::move(fname)),
+          _page_cache_file_id(StoragePageCache::file_id(_fname)),
           _tablet_schema(tablet_schema),
           _segment_id(segment_id),
           _mem_tracker(mem_tracker) {}
 
-Status Segment::_open(MemTracker* mem_tracker, size_t* footer_length_hint,
-                      const FooterPointerPB* partial_rowset_footer) {
-    SegmentFooterPB footer;
+Segment::~Segment() {
+    if (_footer == nullptr && SegmentMetaCache::instance() != nullptr) {
+        SegmentMetaCache::instance()->erase(_page_cache_file_id);
+    }
+}
+
+Status Segment::_open(size_t* footer_length_hint, const FooterPointerPB* partial_rowset_footer) {
+    if (partial_rowset_footer != nullptr) {
+        _partial_rowset_footer = std::make_unique<FooterPointerPB>(*partial_rowset_footer);
+    }
+    ASSIGN_OR_RETURN(auto footer, _read_footer(footer_length_hint));
+
+    _num_rows = footer->num_rows();
+    _short_key_index_page = PagePointer(footer->short_key_index_page());
+    _init_column_ordinals(*footer);
+    _prepare_adapter_info(*footer);
+    if (SegmentMetaCache::instance() != nullptr) {
+        SegmentMetaCache::instance()->insert(_page_cache_file_id, std::move(footer));
+    } else {
+        _footer = std::move(footer);
+    }
+    return Status::OK();
+}
+
+StatusOr<std::shared_ptr<SegmentFooterPB>> Segment::_read_footer(size_t* footer_length_hint) {
+    auto footer = std::make_shared<SegmentFooterPB>();
     std::unique_ptr<fs::ReadableBlock> rblock;
     RETURN_IF_ERROR(_block_mgr->open_block(_fname, &rblock));
-    RETURN_IF_ERROR(Segment::parse_segment_footer(rblock.get(), &footer, footer_length_hint, partial_rowset_footer));
+    RETURN_IF_ERROR(Segment::parse_segment_footer(rblock.get(), footer.get(), footer_length_hint,
+                                                  _partial_rowset_footer.get()));
+    return footer;
+}
 
-    RETURN_IF_ERROR(_create_column_readers(mem_tracker, &footer));
-    _num_rows = footer.num_rows();
-    _short_key_index_page = PagePointer(footer.short_key_index_page());
-    _prepare_adapter_info();
-    return Status::OK();
+StatusOr<std::shared_ptr<const SegmentFooterPB>> Segment::_get_footer() {
+    if (_footer != nullptr) {
+        return _footer;
+    }
+    SegmentMetaCache* cache = SegmentMetaCache::instance();
+    std::shared_ptr<const SegmentFooterPB> footer = cache != nullptr ? cache->lookup(_page_cache_file_id) : nullptr;
+    if (footer == nullptr) {
+        ASSIGN_OR_RETURN(footer, _read_footer(nullptr));
+        if (cache != nullptr) {
+            cache->insert(_page_cache_file_id, footer);
+        }
+    }
+    return footer;
 }
 
 StatusOr<ChunkIteratorPtr> Segment::_new_iterator(const vectorized::Schema& schema,
@@ -194,17 +239,54 @@ StatusOr<ChunkIteratorPtr> Segment::_new_iterator(const vectorized::Schema& sche
     // trying to prune the current segment by segment-level zone map
     for (const auto& pair : read_options.predicates_for_zone_map) {
         ColumnId column_id = pair.first;
-        if (_column_readers[column_id] == nullptr || !_column_readers[column_id]->has_zone_map()) {
+        // The value columns of primary key tablet may be overridden by the delta column groups,
+        // which are pruned by the page-level zone maps in the segment iterator instead.
+        if ((read_options.is_primary_keys || read_options.delta_column_groups != nullptr) &&
+            column_id >= _tablet_schema->num_key_columns()) {
+            continue;
+        }
+        ASSIGN_OR_RETURN(auto column_reader, _column_reader(column_id));
+        if (column_reader == nullptr || !column_reader->has_zone_map()) {
             continue;
         }
-        if (!_column_readers[column_id]->segment_zone_map_filter(pair.second)) {
-            read_options.stats->segment_stats_filtered += _column_readers[column_id]->num_rows();
+        if (!column_reader->segment_zone_map_filter(pair.second)) {
+            read_options.stats->segment_stats_filtered += column_reader->num_rows();
             return Status::EndOfFile(strings::Substitute("End of file $0, empty iterator", _fname));
         }
     }
     return vectorized::new_segment_iterator(shared_from_this(), schema, read_options);
 }
 
+Status Segment::prune_delete_predicates(const vectorized::DisjunctivePredicates& preds,
+                                        vectorized::DisjunctivePredicates* pruned) {
+    // The zone maps of a segment needing the chunk adapter are not in the types of the predicates.
+    if (_needs_chunk_adapter) {
+        *pruned = preds;
+        return Status::OK();
+    }
+    for (size_t i = 0; i < preds.size(); i++) {
+        std::set<ColumnId> column_ids;
+        preds[i].get_column_ids(&column_ids);
+        bool may_be_satisfied = true;
+        for (ColumnId column_id : column_ids) {
+            ASSIGN_OR_RETURN(auto column_reader, _column_reader(column_id));
+            if (column_reader == nullptr || !column_reader->has_zone_map()) {
+                continue;
+            }
+            std::vector<const vectorized::ColumnPredicate*> column_preds;
+            preds[i].predicates_of_column(column_id, &column_preds);
+            if (!column_reader->segment_zone_map_filter(column_preds)) {
+                may_be_satisfied = false;
+                break;
+            }
+        }
+        if (may_be_satisfied) {
+            pruned->add(preds[i]);
+        }
+    }
+    return Status::OK();
+}
+
 StatusOr<ChunkIteratorPtr> Segment::new_iterator(const vectorized::Schema& schema,
                                                  const vectorized::SegmentReadOptions& read_options) {
     if (read_options.stats == nullptr) {
@@ -260,39 +342,48 @@ Status Segment::_load_index(MemTracker* mem_tracker) {
     });
 }
 
-Status Segment::_create_column_readers(MemTracker* mem_tracker, SegmentFooterPB* footer) {
+void Segment::_init_column_ordinals(const SegmentFooterPB& footer) {
     std::unordered_map<uint32_t, uint32_t> column_id_to_footer_ordinal;
-    for (uint32_t ordinal = 0; ordinal < footer->columns().size(); ++ordinal) {
-        const auto& column_pb = footer->columns(ordinal);
+    for (uint32_t ordinal = 0; ordinal < footer.columns().size(); ++ordinal) {
+        const auto& column_pb = footer.columns(ordinal);
         column_id_to_footer_ordinal.emplace(column_pb.unique_id(), ordinal);
     }
 
-    _column_readers.resize(_tablet_schema->columns().size());
+    _column_footer_ordinals.assign(_tablet_schema->num_columns(), -1);
+    _column_readers.resize(_tablet_schema->num_columns());
     for (uint32_t ordinal = 0; ordinal < _tablet_schema->num_columns(); ++ordinal) {
         const auto& column = _tablet_schema->columns()[ordinal];
         auto iter = column_id_to_footer_ordinal.find(column.unique_id());
-        if (iter == column_id_to_footer_ordinal.end()) {
-            continue;
+        if (iter != column_id_to_footer_ordinal.end()) {
+            _column_footer_ordinals[ordinal] = iter->second;
         }
+    }
+}
 
-        auto res = ColumnReader::create(footer->mutable_columns(iter->second), this);
-        if (!res.ok()) {
-            return res.status();
-        }
-        _column_readers[ordinal] = std::move(res).value();
+StatusOr<ColumnReader*> Segment::_column_reader(ColumnId cid) {
+    DCHECK_LT(cid, _column_footer_ordinals.size());
+    if (_column_footer_ordinals[cid] < 0) {
+        return nullptr;
     }
-    return Status::OK();
+    std::lock_guard<std::mutex> l(_column_readers_lock);
+    if (_column_readers[cid] == nullptr) {
+        ASSIGN_OR_RETURN(auto footer, _get_footer());
+        // ColumnReader takes the index meta away from the ColumnMetaPB, so the cached footer is copied.
+        ColumnMetaPB meta = footer->columns(_column_footer_ordinals[cid]);
+        ASSIGN_OR_RETURN(_column_readers[cid], ColumnReader::create(&meta, this));
+    }
+    return _column_readers[cid].get();
 }
 
-void Segment::_prepare_adapter_info() {
+void Segment::_prepare_adapter_info(const SegmentFooterPB& footer) {
     ColumnId num_columns = _tablet_schema->num_columns();
     _needs_block_adapter = false;
     _needs_chunk_adapter = false;
     std::vector<FieldType> types(num_columns);
     for (ColumnId cid = 0; cid < num_columns; ++cid) {
         FieldType type;
-        if (_column_readers[cid] != nullptr) {
-            type = _column_readers[cid]->column_type();
+        if (_column_footer_ordinals[cid] >= 0) {
+            type = static_cast<FieldType>(footer.columns(_column_footer_ordinals[cid]).type());
         } else {
             // when the default column is used, column reader will be null.
             // And the type will be same with the tablet schema.
@@ -312,7 +403,8 @@ void Segment::_prepare_adapter_info() {
 }
 
 Status Segment::new_column_iterator(uint32_t cid, ColumnIterator** iter) {
-    if (_column_readers[cid] == nullptr) {
+    ASSIGN_OR_RETURN(auto column_reader, _column_reader(cid));
+    if (column_reader == nullptr) {
         const TabletColumn& tablet_column = _tablet_schema->column(cid);
         if (!tablet_column.has_default_value() && !tablet_column.is_nullable()) {
             return Status::InternalError(
@@ -327,12 +419,13 @@ Status Segment::new_column_iterator(uint32_t cid, ColumnIterator** iter) {
         *iter = default_value_iter.release();
         return Status::OK();
     }
-    return _column_readers[cid]->new_iterator(iter);
+    return column_reader->new_iterator(iter);
 }
 
 Status Segment::new_bitmap_index_iterator(uint32_t cid, BitmapIndexIterator** iter) {
-    if (_column_readers[cid] != nullptr && _column_readers[cid]->has_bitmap_index()) {
-        return _column_readers[cid]->new_bitmap_index_iterator(iter);
+    ASSIGN_OR_RETURN(auto column_reader, _column_reader(cid));
+    if (column_reader != nullptr && column_reader->has_bitmap_index()) {
+        return column_reader->new_bitmap_index_iterator(iter);
     }
     return Status::OK();
 }
@@ -23,6 +23,7 @@
 
 #include <cstdint>
 #include <memory> // for unique_ptr
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -51,6 +52,7 @@ class BlockManager;
 
 namespace vectorized {
 class ChunkIterator;
+class DisjunctivePredicates;
 class Schema;
 class SegmentIterator;
 class SegmentReadOptions;
@@ -65,7 +67,8 @@ using ChunkIteratorPtr = std::shared_ptr<vectorized::ChunkIterator>;
 
 // A Segment is used to represent a segment in memory format. When segment is
 // generated, it won't be modified, so this struct aimed to help read operation.
-// It will prepare all ColumnReader to create ColumnIterator as needed.
+// It will create the ColumnReader of a column when the column is read for the first time,
+// from the footer cached in SegmentMetaCache.
 // And user can create a RowwiseIterator through new_iterator function.
 //
 // NOTE: This segment is used to a specified TabletSchema, when TabletSchema
@@ -87,7 +90,7 @@ public:
     Segment(const private_type&, std::shared_ptr<fs::BlockManager> blk_mgr, std::string fname, uint32_t segment_id,
             const TabletSchema* tablet_schema, MemTracker* mem_tracker);
 
-    ~Segment() = default;
+    ~Segment();
 
     // Returns `EndOfFile` if |read_options| has predicate and no record in this segment
     // matched with the predicate.
@@ -129,7 +132,14 @@ public:
 
     size_t num_columns() const { return _column_readers.size(); }
 
-    const ColumnReader* column(size_t i) const { return _column_readers[i].get(); }
+    // Return the ColumnReader of the i-th column of the TabletSchema, which is created on the first call,
+    // or nullptr if this segment has no data for the column.
+    StatusOr<const ColumnReader*> column(size_t i) { return _column_reader(i); }
+
+    // Add the delete predicates in |preds| which may be satisfied by some rows of this segment to |pruned|,
+    // the others are pruned by the segment-level zone maps.
+    Status prune_delete_predicates(const vectorized::DisjunctivePredicates& preds,
+                                   vectorized::DisjunctivePredicates* pruned);
 
     int64_t mem_usage() {
         int64_t size = sizeof(Segment) + _sk_index_handle.mem_usage();
@@ -145,8 +155,12 @@ public:
 
     bool keep_in_memory() const { return _tablet_schema->is_in_memory(); }
 
+    const TabletSchema& tablet_schema() const { return *_tablet_schema; }
+
     const std::string& file_name() const { return _fname; }
 
+    const StoragePageCache::FileId& page_cache_file_id() const { return _page_cache_file_id; }
+
     uint32_t num_rows() const { return _num_rows; }
 
 private:
@@ -158,8 +172,12 @@ private:
     };
 
     // open segment file and read the minimum amount of necessary information (footer)
-    Status _open(MemTracker* mem_tracker, size_t* footer_length_hint, const FooterPointerPB* partial_rowset_footer);
-    Status _create_column_readers(MemTracker* mem_tracker, SegmentFooterPB* footer);
+    Status _open(size_t* footer_length_hint, const FooterPointerPB* partial_rowset_footer);
+    StatusOr<std::shared_ptr<SegmentFooterPB>> _read_footer(size_t* footer_length_hint);
+    // Get the footer from SegmentMetaCache, or read it again if it's evicted.
+    StatusOr<std::shared_ptr<const SegmentFooterPB>> _get_footer();
+    void _init_column_ordinals(const SegmentFooterPB& footer);
+    StatusOr<ColumnReader*> _column_reader(ColumnId cid);
     // Load and decode short key index.
     // May be called multiple times, subsequent calls will no op.
     Status _load_index(MemTracker* mem_tracker);
@@ -167,23 +185,30 @@ private:
     StatusOr<ChunkIteratorPtr> _new_iterator(const vectorized::Schema& schema,
                                              const vectorized::SegmentReadOptions& read_options);
 
-    void _prepare_adapter_info();
+    void _prepare_adapter_info(const SegmentFooterPB& footer);
 
     friend class SegmentIterator;
     friend class vectorized::SegmentIterator;
 
     std::shared_ptr<fs::BlockManager> _block_mgr;
     std::string _fname;
+    const StoragePageCache::FileId _page_cache_file_id;
     const TabletSchema* _tablet_schema;
     uint32_t _segment_id = 0;
     uint32_t _num_rows = 0;
     PagePointer _short_key_index_page;
     MemTracker* _mem_tracker;
-
-    // ColumnReader for each column in TabletSchema. If ColumnReader is nullptr,
-    // This means that this segment has no data for that column, which may be added
-    // after this segment is generated.
+    // the position of the footer of the partial rowset, if any.
+    std::unique_ptr<FooterPointerPB> _partial_rowset_footer;
+    // Only kept when SegmentMetaCache is not created.
+    std::shared_ptr<const SegmentFooterPB> _footer;
+
+    // The ordinal in the footer of each column in TabletSchema. -1 means that this segment
+    // has no data for that column, which may be added after this segment is generated.
+    std::vector<int32_t> _column_footer_ordinals;
+    // ColumnReader for each column in TabletSchema, created on the first read of the column.
     std::vector<std::unique_ptr<ColumnReader>> _column_readers;
+    std::mutex _column_readers_lock;
 
     // used to guarantee that short key index will be loaded at most once in a thread-safe way
     StarRocksCallOnce<Status> _load_index_once;
@@ -16,6 +16,7 @@
 #include "glog/logging.h"
 #include "gutil/casts.h"
 #include "gutil/stl_util.h"
+#include "runtime/exec_env.h"
 #include "runtime/external_scan_context_mgr.h"
 #include "segment_options.h"
 #include "simd/simd.h"
@@ -34,10 +35,14 @@
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/common.h"
 #include "storage/rowset/default_value_column_iterator.h"
+#include "storage/rowset/delta_column_group.h"
 #include "storage/rowset/dictcode_column_iterator.h"
+#include "storage/rowset/readahead_block.h"
 #include "storage/rowset/rowid_column_iterator.h"
 #include "storage/rowset/segment.h"
+#include "storage/runtime_range_pruner.h"
 #include "storage/storage_engine.h"
+#include "storage/tablet_meta_manager.h"
 #include "storage/types.h"
 #include "storage/update_manager.h"
 #include "storage/vectorized_column_predicate.h"
@@ -117,11 +122,27 @@ private:
             return Status::OK();
         }
 
-        Status read_columns(Chunk* chunk, const vectorized::SparseRange& range) {
+        // The result of the pushdown predicates is written to |selection|, if there is any.
+        Status read_columns(Chunk* chunk, const vectorized::SparseRange& range, uint8_t* selection) {
             bool may_has_del_row = chunk->delete_state() != DEL_NOT_SATISFIED;
+            bool selection_inited = false;
             for (size_t i = 0; i < _column_iterators.size(); i++) {
                 const ColumnPtr& col = chunk->get_column_by_index(i);
-                RETURN_IF_ERROR(_column_iterators[i]->next_batch(range, col.get()));
+                const auto* preds = _has_pushdown_predicates ? _pushdown_predicates[i] : nullptr;
+                if (preds == nullptr) {
+                    RETURN_IF_ERROR(_column_iterators[i]->next_batch(range, col.get()));
+                } else if (!selection_inited) {
+                    RETURN_IF_ERROR(_column_iterators[i]->next_batch_with_filter(range, *preds, col.get(), selection));
+                    selection_inited = true;
+                } else {
+                    const size_t from = col->size();
+                    _pushdown_selection.resize(from + range.span_size());
+                    RETURN_IF_ERROR(_column_iterators[i]->next_batch_with_filter(range, *preds, col.get(),
+                                                                                 _pushdown_selection.data()));
+                    for (size_t j = from; j < col->size(); j++) {
+                        selection[j] &= _pushdown_selection[j];
+                    }
+                }
                 may_has_del_row |= (col->delete_state() != DEL_NOT_SATISFIED);
             }
             chunk->set_delete_state(may_has_del_row ? DEL_PARTIAL_SATISFIED : DEL_NOT_SATISFIED);
@@ -166,6 +187,11 @@ private:
 
         // not all dict encode
         bool _has_force_dict_encode{false};
+
+        // The predicates evaluated by the i-th item of |_column_iterators| while reading, or nullptr.
+        std::vector<const std::vector<const ColumnPredicate*>*> _pushdown_predicates;
+        bool _has_pushdown_predicates{false};
+        Buffer<uint8_t> _pushdown_selection;
     };
 
     Status _init();
@@ -174,8 +200,12 @@ private:
     template <bool check_global_dict>
     Status _init_column_iterators(const Schema& schema);
     Status _get_row_ranges_by_keys();
+    // Only keep the rows in _opts.rowid_range, if it is set.
+    void _apply_rowid_range();
     Status _get_row_ranges_by_zone_map();
     Status _get_row_ranges_by_bloom_filter();
+    // Prune the rows not read yet by the predicates added to |_opts.runtime_range_pruner| since the last call.
+    Status _prune_by_runtime_predicates();
 
     uint32_t segment_id() const { return _segment->id(); }
     uint32_t num_rows() const { return _segment->num_rows(); }
@@ -188,9 +218,13 @@ private:
     uint16_t _filter_by_expr_predicates(Chunk* chunk, vector<rowid_t>* rowid);
 
     void _init_column_predicates();
+    // Push down the vectorized predicates to the column iterators that can evaluate them on the pages.
+    void _init_pushdown_predicates();
 
     Status _init_context();
 
+    Status _init_readahead();
+
     template <bool late_materialization>
     Status _build_context(ScanContext* ctx);
 
@@ -217,12 +251,22 @@ private:
     // check field use low_cardinality global dict optimization
     bool _can_using_global_dict(const FieldPtr& field) const;
 
+    Status _get_row_ranges_by_ngram_index();
+
     Status _init_bitmap_index_iterators();
 
     Status _apply_bitmap_index();
 
     Status _apply_del_vector();
 
+    Status _init_delta_column_groups();
+
+    bool _is_delta_column(ColumnId cid) const { return cid < _dcg_of_columns.size() && _dcg_of_columns[cid] >= 0; }
+
+    // Get the segment from which column |cid| is read, i.e, |_segment| or the segment of its newest
+    // delta column group, and the block to read it.
+    Status _get_column_segment(ColumnId cid, Segment** segment, fs::ReadableBlock** rblock);
+
     Status _read(Chunk* chunk, vector<rowid_t>* rowid, size_t n);
 
     Status _read_by_column(size_t n, Chunk* result, vector<rowid_t>* rowids);
@@ -239,14 +283,28 @@ private:
     DelVectorPtr _del_vec;
     roaring_uint32_iterator_t _roaring_iter;
 
+    // The delta column groups of the segment, newest first, and their segments and blocks opened on
+    // the first use.
+    DeltaColumnGroupList _dcgs;
+    std::vector<std::shared_ptr<Segment>> _dcg_segments;
+    std::vector<std::unique_ptr<fs::ReadableBlock>> _dcg_rblocks;
+    // column id => the index in |_dcgs| of the newest group containing the column, or -1.
+    std::vector<int> _dcg_of_columns;
+
     // block for file to read
     std::unique_ptr<fs::ReadableBlock> _rblock;
+    // wraps |_rblock| to read ahead the data pages, nullptr if the readahead is disabled.
+    std::unique_ptr<ReadaheadBlock> _readahead_block;
 
     SparseRange _scan_range;
     SparseRangeIterator _range_iter;
+    // the version of |_opts.runtime_range_pruner| whose predicates have been applied.
+    size_t _runtime_range_pruner_version = 0;
 
     std::vector<const ColumnPredicate*> _vectorized_preds;
     std::vector<const ColumnPredicate*> _branchless_preds;
+    // column id => predicates evaluated by the column iterator, which are removed from |_vectorized_preds|.
+    std::map<ColumnId, std::vector<const ColumnPredicate*>> _pushdown_preds;
     std::vector<const ColumnPredicate*> _expr_ctx_preds; // predicates using ExprContext*
     // _selection is used to accelerate
     Buffer<uint8_t> _selection;
@@ -305,12 +363,19 @@ Status SegmentIterator::_init() {
             roaring_init_iterator(&_del_vec->roaring()->roaring, &_roaring_iter);
         }
     }
+    RETURN_IF_ERROR(_init_delta_column_groups());
 
     _selection.resize(_opts.chunk_size);
     _selected_idx.resize(_opts.chunk_size);
     StarRocksMetrics::instance()->segment_read_total.increment(1);
     // get file handle from file descriptor of segment
     RETURN_IF_ERROR(_opts.block_mgr->open_block(_segment->file_name(), &_rblock));
+    // The pages read through the page cache are mostly hit, so reading them ahead is a waste.
+    if (_opts.readahead_bytes > 0 && !_opts.use_page_cache) {
+        _readahead_block = std::make_unique<ReadaheadBlock>(
+                _rblock.get(), _opts.readahead_bytes, ExecEnv::GetInstance()->segment_readahead_thread_pool(),
+                _opts.stats);
+    }
 
     /// the calling order matters, do not change unless you know why.
 
@@ -327,12 +392,15 @@ Status SegmentIterator::_init() {
     RETURN_IF_ERROR(_apply_bitmap_index());
     RETURN_IF_ERROR(_get_row_ranges_by_zone_map());
     RETURN_IF_ERROR(_get_row_ranges_by_bloom_filter());
+    RETURN_IF_ERROR(_get_row_ranges_by_ngram_index());
     // rewrite stage
     // Rewriting predicates using segment dictionary codes
     _rewrite_predicates();
     RETURN_IF_ERROR(_init_context());
     _init_column_predicates();
+    _init_pushdown_predicates();
     _range_iter = _scan_range.new_iterator();
+    RETURN_IF_ERROR(_init_readahead());
 
     return Status::OK();
 }
@@ -366,13 +434,17 @@ Status SegmentIterator::_init_column_iterators(const Schema& schema) {
                 check_dict_enc = has_predicate;
             }
 
-            RETURN_IF_ERROR(_segment->new_column_iterator(cid, &_column_iterators[cid]));
+            Segment* segment = nullptr;
+            fs::ReadableBlock* rblock = nullptr;
+            RETURN_IF_ERROR(_get_column_segment(cid, &segment, &rblock));
+            RETURN_IF_ERROR(segment->new_column_iterator(cid, &_column_iterators[cid]));
 
             _obj_pool.add(_column_iterators[cid]);
             ColumnIteratorOptions iter_opts;
             iter_opts.stats = _opts.stats;
             iter_opts.use_page_cache = _opts.use_page_cache;
-            iter_opts.rblock = _rblock.get();
+            iter_opts.fill_page_cache = _opts.fill_page_cache;
+            iter_opts.rblock = rblock;
             iter_opts.check_dict_encoding = check_dict_enc;
             iter_opts.reader_type = _opts.reader_type;
             RETURN_IF_ERROR(_column_iterators[cid]->init(iter_opts));
@@ -416,15 +488,60 @@ void SegmentIterator::_init_column_predicates() {
     }
 }
 
+void SegmentIterator::_init_pushdown_predicates() {
+    if (!config::enable_segment_page_predicate_pushdown || _vectorized_preds.empty()) {
+        return;
+    }
+    for (const ColumnPredicate* pred : _vectorized_preds) {
+        const ColumnId cid = pred->column_id();
+        if (_column_iterators[cid]->support_page_predicate_pushdown()) {
+            _pushdown_preds[cid].emplace_back(pred);
+        }
+    }
+    if (_pushdown_preds.empty()) {
+        return;
+    }
+
+    // The dict code iterators read the codes, on which the predicates have been rewritten.
+    for (auto& ctx : _context_list) {
+        for (size_t i = 0; i < ctx._column_iterators.size(); i++) {
+            const ColumnId cid = ctx._read_schema.field(i)->id();
+            if (_pushdown_preds.count(cid) > 0 && ctx._column_iterators[i] != _column_iterators[cid]) {
+                _pushdown_preds.erase(cid);
+            }
+        }
+    }
+    if (_pushdown_preds.empty()) {
+        return;
+    }
+
+    for (auto& ctx : _context_list) {
+        ctx._pushdown_predicates.resize(ctx._column_iterators.size(), nullptr);
+        for (size_t i = 0; i < ctx._column_iterators.size(); i++) {
+            auto iter = _pushdown_preds.find(ctx._read_schema.field(i)->id());
+            if (iter != _pushdown_preds.end()) {
+                ctx._pushdown_predicates[i] = &iter->second;
+                ctx._has_pushdown_predicates = true;
+            }
+        }
+    }
+    _vectorized_preds.erase(std::remove_if(_vectorized_preds.begin(), _vectorized_preds.end(),
+                                           [this](const ColumnPredicate* pred) {
+                                               return _pushdown_preds.count(pred->column_id()) > 0;
+                                           }),
+                            _vectorized_preds.end());
+}
+
 Status SegmentIterator::_get_row_ranges_by_keys() {
     StarRocksMetrics::instance()->segment_row_total.increment(num_rows());
 
     if (_opts.ranges.empty()) {
         _scan_range.add(Range(0, num_rows()));
+        _apply_rowid_range();
         return Status::OK();
     }
     DCHECK_EQ(0, _scan_range.span_size());
-    RETURN_IF_ERROR(_segment->_load_index(StorageEngine::instance()->tablet_meta_mem_tracker()));
+    RETURN_IF_ERROR(_segment->_load_index(_segment->mem_tracker()));
     for (const SeekRange& range : _opts.ranges) {
         rowid_t lower_rowid = 0;
         rowid_t upper_rowid = num_rows();
@@ -443,9 +560,16 @@ Status SegmentIterator::_get_row_ranges_by_keys() {
     }
     _opts.stats->rows_key_range_filtered += num_rows() - _scan_range.span_size();
     StarRocksMetrics::instance()->segment_rows_by_short_key.increment(_scan_range.span_size());
+    _apply_rowid_range();
     return Status::OK();
 }
 
+void SegmentIterator::_apply_rowid_range() {
+    if (_opts.rowid_range != nullptr) {
+        _scan_range = _scan_range.intersection(*_opts.rowid_range);
+    }
+}
+
 Status SegmentIterator::_get_row_ranges_by_zone_map() {
     SparseRange zm_range(0, num_rows());
 
@@ -603,7 +727,7 @@ inline Status SegmentIterator::_read(Chunk* chunk, vector<rowid_t>* rowids, size
     {
         _opts.stats->blocks_load += 1;
         SCOPED_RAW_TIMER(&_opts.stats->block_fetch_ns);
-        RETURN_IF_ERROR(_context->read_columns(chunk, range));
+        RETURN_IF_ERROR(_context->read_columns(chunk, range, _selection.data()));
     }
 
     if (rowids != nullptr) {
@@ -669,6 +793,11 @@ Status SegmentIterator::_do_get_next(Chunk* result, vector<rowid_t>* rowid) {
 
     Chunk* chunk = _context->_read_chunk.get();
 
+    if (_opts.runtime_range_pruner != nullptr &&
+        _opts.runtime_range_pruner->version() != _runtime_range_pruner_version) {
+        RETURN_IF_ERROR(_prune_by_runtime_predicates());
+    }
+
     while ((chunk_start < chunk_capacity) & _range_iter.has_more()) {
         RETURN_IF_ERROR(_read(chunk, rowid, chunk_capacity - chunk_start));
         chunk->check_or_die();
@@ -806,22 +935,30 @@ void SegmentIterator::_switch_context(ScanContext* to) {
 }
 
 uint16_t SegmentIterator::_filter(Chunk* chunk, vector<rowid_t>* rowid, uint16_t from, uint16_t to) {
-    // There must be one predicate, either vectorized or branchless.
-    DCHECK(_vectorized_preds.size() + _branchless_preds.size() > 0 || _del_vec);
+    // There must be one predicate, either vectorized, branchless or pushed down.
+    DCHECK(_vectorized_preds.size() + _branchless_preds.size() + _pushdown_preds.size() > 0 || _del_vec);
 
     SCOPED_RAW_TIMER(&_opts.stats->vec_cond_ns);
 
+    // The pushdown predicates have been evaluated while reading the columns.
+    bool selection_inited = _context->_has_pushdown_predicates;
+
     // first evaluate
     if (!_vectorized_preds.empty()) {
         SCOPED_RAW_TIMER(&_opts.stats->vec_cond_evaluate_ns);
-        const ColumnPredicate* pred = _vectorized_preds[0];
-        Column* c = chunk->get_column_by_id(pred->column_id()).get();
-        pred->evaluate(c, _selection.data(), from, to);
-        for (int i = 1; i < _vectorized_preds.size(); ++i) {
-            pred = _vectorized_preds[i];
-            c = chunk->get_column_by_id(pred->column_id()).get();
+        size_t i = 0;
+        if (!selection_inited) {
+            const ColumnPredicate* pred = _vectorized_preds[0];
+            Column* c = chunk->get_column_by_id(pred->column_id()).get();
+            pred->evaluate(c, _selection.data(), from, to);
+            i = 1;
+        }
+        for (; i < _vectorized_preds.size(); ++i) {
+            const ColumnPredicate* pred = _vectorized_preds[i];
+            Column* c = chunk->get_column_by_id(pred->column_id()).get();
             pred->evaluate_and(c, _selection.data(), from, to);
         }
+        selection_inited = true;
     }
 
     // evaluate brachless
@@ -829,7 +966,7 @@ uint16_t SegmentIterator::_filter(Chunk* chunk, vector<rowid_t>* rowid, uint16_t
         SCOPED_RAW_TIMER(&_opts.stats->branchless_cond_evaluate_ns);
 
         uint16_t selected_size = 0;
-        if (!_vectorized_preds.empty()) {
+        if (selection_inited) {
             for (uint16_t i = from; i < to; ++i) {
                 _selected_idx[selected_size] = i;
                 selected_size += _selection[i];
@@ -1038,6 +1175,33 @@ Status SegmentIterator::_build_context(ScanContext* ctx) {
     return Status::OK();
 }
 
+// Plan the readahead by the data pages of all the columns covering the rows to scan.
+// The pages are sorted by their first ordinals, which is roughly the order in which they're read, since the
+// columns are read chunk by chunk.
+Status SegmentIterator::_init_readahead() {
+    if (_readahead_block == nullptr || _scan_range.empty()) {
+        return Status::OK();
+    }
+    std::vector<std::pair<ordinal_t, PagePointer>> pages;
+    for (const FieldPtr& f : _schema.fields()) {
+        ColumnIterator* iter = _column_iterators[f->id()];
+        // The delta columns are in other files.
+        if (iter != nullptr && !_is_delta_column(f->id())) {
+            RETURN_IF_ERROR(iter->get_data_pages(_scan_range, &pages));
+        }
+    }
+    std::sort(pages.begin(), pages.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second.offset < rhs.second.offset);
+    });
+    std::vector<PagePointer> planned;
+    planned.reserve(pages.size());
+    for (const auto& page : pages) {
+        planned.emplace_back(page.second);
+    }
+    _readahead_block->set_pages(std::move(planned));
+    return Status::OK();
+}
+
 Status SegmentIterator::_init_context() {
     DCHECK_EQ(_predicate_columns, _opts.predicates.size());
     _late_materialization_ratio = config::late_materialization_ratio;
@@ -1236,7 +1400,10 @@ Status SegmentIterator::_init_bitmap_index_iterators() {
     for (const auto& pair : _opts.predicates) {
         ColumnId cid = pair.first;
         if (_bitmap_index_iterators[cid] == nullptr) {
-            RETURN_IF_ERROR(_segment->new_bitmap_index_iterator(cid, &_bitmap_index_iterators[cid]));
+            Segment* segment = nullptr;
+            fs::ReadableBlock* rblock = nullptr;
+            RETURN_IF_ERROR(_get_column_segment(cid, &segment, &rblock));
+            RETURN_IF_ERROR(segment->new_bitmap_index_iterator(cid, &_bitmap_index_iterators[cid]));
             _has_bitmap_index |= (_bitmap_index_iterators[cid] != nullptr);
         }
     }
@@ -1338,6 +1505,56 @@ Status SegmentIterator::_apply_bitmap_index() {
     return Status::OK();
 }
 
+Status SegmentIterator::_init_delta_column_groups() {
+    if (_opts.delta_column_groups != nullptr) {
+        _dcgs = *_opts.delta_column_groups;
+    } else if (_opts.is_primary_keys && _opts.version > 0 && _opts.meta != nullptr) {
+        RETURN_IF_ERROR(TabletMetaManager::get_delta_column_groups(_opts.meta, _opts.tablet_id,
+                                                                   _opts.rowset_id + segment_id(), _opts.version,
+                                                                   &_dcgs));
+    }
+    if (_dcgs.empty()) {
+        return Status::OK();
+    }
+    _dcg_segments.resize(_dcgs.size());
+    _dcg_rblocks.resize(_dcgs.size());
+    _dcg_of_columns.assign(_segment->tablet_schema().num_columns(), -1);
+    // Visit the groups from oldest to newest, so that a column is overridden by its newest group.
+    for (int i = static_cast<int>(_dcgs.size()) - 1; i >= 0; i--) {
+        for (uint32_t cid : _dcgs[i].column_ids()) {
+            if (cid >= _dcg_of_columns.size()) {
+                return Status::Corruption(fmt::format("Invalid column {} in delta column file {}", cid,
+                                                      _dcgs[i].file_name()));
+            }
+            _dcg_of_columns[cid] = i;
+        }
+    }
+    return Status::OK();
+}
+
+Status SegmentIterator::_get_column_segment(ColumnId cid, Segment** segment, fs::ReadableBlock** rblock) {
+    if (!_is_delta_column(cid)) {
+        *segment = _segment.get();
+        *rblock = _readahead_block != nullptr ? _readahead_block.get() : _rblock.get();
+        return Status::OK();
+    }
+    const int idx = _dcg_of_columns[cid];
+    if (_dcg_segments[idx] == nullptr) {
+        std::string path = delta_column_file_path(_segment->file_name(), _dcgs[idx]);
+        ASSIGN_OR_RETURN(auto dcg_segment, Segment::open(_segment->mem_tracker(), _opts.block_mgr, path, segment_id(),
+                                                         &_segment->tablet_schema()));
+        if (dcg_segment->num_rows() != _segment->num_rows()) {
+            return Status::Corruption(fmt::format("Delta column file {} has {} rows, but segment has {} rows", path,
+                                                  dcg_segment->num_rows(), _segment->num_rows()));
+        }
+        RETURN_IF_ERROR(_opts.block_mgr->open_block(path, &_dcg_rblocks[idx]));
+        _dcg_segments[idx] = std::move(dcg_segment);
+    }
+    *segment = _dcg_segments[idx].get();
+    *rblock = _dcg_rblocks[idx].get();
+    return Status::OK();
+}
+
 Status SegmentIterator::_apply_del_vector() {
     if (_opts.is_primary_keys && _opts.version > 0 && _del_vec && !_del_vec->empty()) {
         Roaring row_bitmap = range2roaring(_scan_range);
@@ -1361,11 +1578,63 @@ Status SegmentIterator::_get_row_ranges_by_bloom_filter() {
     return Status::OK();
 }
 
+Status SegmentIterator::_prune_by_runtime_predicates() {
+    std::unordered_map<ColumnId, std::vector<const ColumnPredicate*>> preds;
+    _runtime_range_pruner_version =
+            _opts.runtime_range_pruner->get_predicates_since(_runtime_range_pruner_version, &preds);
+    RETURN_IF(!_range_iter.has_more(), Status::OK());
+
+    // The rows before the current position of |_range_iter| have been read.
+    SparseRange remaining = _scan_range.intersection(SparseRange(_range_iter.begin(), num_rows()));
+    const size_t prev_size = remaining.span_size();
+    for (const auto& [cid, col_preds] : preds) {
+        if (cid >= _column_iterators.size() || _column_iterators[cid] == nullptr) {
+            continue;
+        }
+        SparseRange zm_range;
+        RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(col_preds, nullptr, &zm_range));
+        size_t size_before_zm = remaining.span_size();
+        remaining = remaining.intersection(zm_range);
+        _opts.stats->rows_stats_filtered += size_before_zm - remaining.span_size();
+
+        size_t size_before_bf = remaining.span_size();
+        RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_bloom_filter(col_preds, &remaining));
+        _opts.stats->rows_bf_filtered += size_before_bf - remaining.span_size();
+        if (remaining.empty()) {
+            break;
+        }
+    }
+    if (remaining.span_size() < prev_size) {
+        // `_read` seeks the columns to the beginning of the new range iterator.
+        _scan_range = std::move(remaining);
+        _range_iter = _scan_range.new_iterator();
+    }
+    return Status::OK();
+}
+
+// The n-gram index only tells the rows that may match, so the predicates are kept to be evaluated on the rows.
+Status SegmentIterator::_get_row_ranges_by_ngram_index() {
+    RETURN_IF(_opts.predicates.empty() || _scan_range.empty(), Status::OK());
+    size_t prev_size = _scan_range.span_size();
+    for (const auto& [cid, preds] : _opts.predicates) {
+        ColumnIterator* column_iter = _column_iterators[cid];
+        RETURN_IF_ERROR(column_iter->get_row_ranges_by_ngram_index(preds, &_scan_range));
+        if (_scan_range.empty()) {
+            break;
+        }
+    }
+    _opts.stats->rows_ngram_index_filtered += prev_size - _scan_range.span_size();
+    return Status::OK();
+}
+
 void SegmentIterator::close() {
     _context_list[0].close();
     _context_list[1].close();
     _obj_pool.clear();
+    _readahead_block.reset();
     _rblock.reset();
+    _dcg_rblocks.clear();
+    _dcg_segments.clear();
     _segment.reset();
     _column_decoders.clear();
 
@@ -0,0 +1,88 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/segment_meta_cache.h"
+
+#include <cstring>
+
+#include "gutil/int128.h"
+#include "runtime/mem_tracker.h"
+
+namespace starrocks {
+
+SegmentMetaCache* SegmentMetaCache::_s_instance = nullptr;
+
+namespace {
+
+struct CacheValue {
+    std::shared_ptr<const SegmentFooterPB> footer;
+    MemTracker* mem_tracker;
+    int64_t charge;
+};
+
+struct CacheKeyBuffer {
+    explicit CacheKeyBuffer(const SegmentMetaCache::FileId& file_id) {
+        uint64_t high = Uint128High64(file_id);
+        uint64_t low = Uint128Low64(file_id);
+        memcpy(data, &high, sizeof(high));
+        memcpy(data + sizeof(high), &low, sizeof(low));
+    }
+
+    CacheKey encode() const { return {data, sizeof(data)}; }
+
+    char data[2 * sizeof(uint64_t)];
+};
+
+void delete_cache_value(const CacheKey& /*key*/, void* value) {
+    auto* cache_value = reinterpret_cast<CacheValue*>(value);
+    if (cache_value->mem_tracker != nullptr) {
+        cache_value->mem_tracker->release(cache_value->charge);
+    }
+    delete cache_value;
+}
+
+} // namespace
+
+void SegmentMetaCache::create_global_cache(MemTracker* mem_tracker, size_t capacity) {
+    if (_s_instance == nullptr) {
+        _s_instance = new SegmentMetaCache(mem_tracker, capacity);
+    }
+}
+
+void SegmentMetaCache::release_global_cache() {
+    if (_s_instance != nullptr) {
+        delete _s_instance;
+        _s_instance = nullptr;
+    }
+}
+
+SegmentMetaCache::SegmentMetaCache(MemTracker* mem_tracker, size_t capacity)
+        : _mem_tracker(mem_tracker), _cache(new_lru_cache(capacity)) {}
+
+std::shared_ptr<const SegmentFooterPB> SegmentMetaCache::lookup(const FileId& file_id) {
+    CacheKeyBuffer key(file_id);
+    Cache::Handle* handle = _cache->lookup(key.encode());
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    auto footer = reinterpret_cast<CacheValue*>(_cache->value(handle))->footer;
+    _cache->release(handle);
+    return footer;
+}
+
+void SegmentMetaCache::insert(const FileId& file_id, std::shared_ptr<const SegmentFooterPB> footer) {
+    CacheKeyBuffer key(file_id);
+    const int64_t charge = footer->SpaceUsedLong();
+    auto* value = new CacheValue{std::move(footer), _mem_tracker, charge};
+    if (_mem_tracker != nullptr) {
+        _mem_tracker->consume(charge);
+    }
+    Cache::Handle* handle = _cache->insert(key.encode(), value, charge, delete_cache_value);
+    _cache->release(handle);
+}
+
+void SegmentMetaCache::erase(const FileId& file_id) {
+    CacheKeyBuffer key(file_id);
+    _cache->erase(key.encode());
+}
+
+} // namespace starrocks
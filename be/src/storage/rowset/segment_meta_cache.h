@@ -0,0 +1,54 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+
+#include "gen_cpp/segment.pb.h"
+#include "storage/page_cache.h"
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+class MemTracker;
+
+// A global LRU cache of the parsed footers of the segments, bounded by the memory they take.
+//
+// A Segment only keeps the little of its footer needed by every read after it's opened, and creates the
+// ColumnReader of a column from the cached footer when the column is read for the first time, so that a
+// table of many columns and segments doesn't keep the metadata of the columns never read. The footer of a
+// segment evicted from the cache is read from the file again when it's needed.
+class SegmentMetaCache {
+public:
+    using FileId = StoragePageCache::FileId;
+
+    // Create the global instance with the |capacity| in bytes, of which the memory is consumed by
+    // |mem_tracker|.
+    static void create_global_cache(MemTracker* mem_tracker, size_t capacity);
+
+    static void release_global_cache();
+
+    // Return the global instance, or nullptr if it's not created, in which case the segments keep their
+    // footers in memory.
+    static SegmentMetaCache* instance() { return _s_instance; }
+
+    SegmentMetaCache(MemTracker* mem_tracker, size_t capacity);
+
+    // Return nullptr if the footer of |file_id| is not cached.
+    std::shared_ptr<const SegmentFooterPB> lookup(const FileId& file_id);
+
+    // Cache the |footer| of |file_id|, replacing the old one if any.
+    void insert(const FileId& file_id, std::shared_ptr<const SegmentFooterPB> footer);
+
+    void erase(const FileId& file_id);
+
+    size_t memory_usage() const { return _cache->get_memory_usage(); }
+
+private:
+    static SegmentMetaCache* _s_instance;
+
+    MemTracker* _mem_tracker;
+    std::unique_ptr<Cache> _cache;
+};
+
+} // namespace starrocks
@@ -27,11 +27,15 @@ Status SegmentReadOptions::convert_to(SegmentReadOptions* dst, const std::vector
     // delete predicates
     RETURN_IF_ERROR(delete_predicates.convert_to(&dst->delete_predicates, new_types, obj_pool));
 
+    dst->rowid_range = rowid_range;
     dst->block_mgr = block_mgr;
     dst->stats = stats;
     dst->use_page_cache = use_page_cache;
+    dst->fill_page_cache = fill_page_cache;
+    dst->readahead_bytes = readahead_bytes;
     dst->profile = profile;
     dst->global_dictmaps = global_dictmaps;
+    dst->delta_column_groups = delta_column_groups;
     return Status::OK();
 }
 
@@ -62,6 +66,8 @@ std::string SegmentReadOptions::debug_string() const {
     ss << "],delete_predicates={";
     ss << "},tablet_schema={";
     ss << "},use_page_cache=" << use_page_cache;
+    ss << ",fill_page_cache=" << fill_page_cache;
+    ss << ",readahead_bytes=" << readahead_bytes;
     return ss.str();
 }
 
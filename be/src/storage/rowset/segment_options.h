@@ -9,6 +9,8 @@
 #include "runtime/global_dicts.h"
 #include "storage/disjunctive_predicates.h"
 #include "storage/fs/fs_util.h"
+#include "storage/range.h"
+#include "storage/rowset/delta_column_group.h"
 #include "storage/seek_range.h"
 
 namespace starrocks {
@@ -22,6 +24,7 @@ class KVStore;
 namespace starrocks::vectorized {
 
 class ColumnPredicate;
+class RuntimeRangePruner;
 
 class SegmentReadOptions {
 public:
@@ -31,9 +34,15 @@ public:
 
     std::vector<SeekRange> ranges;
 
+    // If not null, only the rows in it are read, which is applied after |ranges|.
+    const SparseRange* rowid_range = nullptr;
+
     std::unordered_map<ColumnId, PredicateList> predicates;
     std::unordered_map<ColumnId, PredicateList> predicates_for_zone_map;
 
+    // If not null, the predicates arriving later are polled from it to prune the rows not read yet.
+    const RuntimeRangePruner* runtime_range_pruner = nullptr;
+
     DisjunctivePredicates delete_predicates;
 
     // used for updatable tablet to get delvec
@@ -42,6 +51,9 @@ public:
     uint32_t rowset_id = 0;
     int64_t version = 0;
     KVStore* meta = nullptr;
+    // If not null, the delta column groups of the segment, which are used instead of the ones
+    // read from |meta|.
+    const DeltaColumnGroupList* delta_column_groups = nullptr;
 
     // REQUIRED (null is not allowed)
     OlapReaderStatistics* stats = nullptr;
@@ -49,6 +61,10 @@ public:
     RuntimeProfile* profile = nullptr;
 
     bool use_page_cache = false;
+    // Whether to insert the pages read into the page cache if use_page_cache is true.
+    bool fill_page_cache = true;
+    // The window bytes of the data page readahead, 0 means disabled.
+    int64_t readahead_bytes = 0;
 
     Status convert_to(SegmentReadOptions* dst, const std::vector<FieldType>& new_types, ObjectPool* obj_pool) const;
 
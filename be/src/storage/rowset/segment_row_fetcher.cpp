@@ -0,0 +1,185 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/segment_row_fetcher.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <numeric>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "gutil/casts.h"
+#include "storage/chunk_helper.h"
+#include "storage/range.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
+
+namespace starrocks::vectorized {
+
+uint32_t SegmentRowFetcher::add_segment(std::shared_ptr<fs::BlockManager> block_mgr,
+                                        std::shared_ptr<Segment> segment) {
+    std::lock_guard l(_lock);
+    _segments.push_back({std::move(block_mgr), std::move(segment)});
+    return static_cast<uint32_t>(_segments.size() - 1);
+}
+
+size_t SegmentRowFetcher::num_segments() const {
+    std::lock_guard l(_lock);
+    return _segments.size();
+}
+
+Status SegmentRowFetcher::fetch(const Schema& schema, const Int64Column& global_rowids, OlapReaderStatistics* stats,
+                                Chunk* dst) {
+    const auto& ids = global_rowids.get_data();
+    const size_t num_rows = ids.size();
+    if (num_rows == 0) {
+        return Status::OK();
+    }
+
+    // Visit the rows ordered by segment and row id, so that each segment is read once and sequentially.
+    std::vector<uint32_t> order(num_rows);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return ids[a] < ids[b]; });
+
+    // The distinct rows are read into |fetched| in order, and |indexes[i]| is the index of the i-th row
+    // of |global_rowids| in |fetched|.
+    ChunkPtr fetched = ChunkHelper::new_chunk(schema, num_rows);
+    std::vector<uint32_t> indexes(num_rows);
+    size_t pos = 0;
+    while (pos < num_rows) {
+        const uint32_t ordinal = segment_ordinal_of(ids[order[pos]]);
+        SegmentEntry entry;
+        {
+            std::lock_guard l(_lock);
+            if (ordinal >= _segments.size()) {
+                return Status::InvalidArgument(fmt::format("Invalid segment ordinal {} of global row id", ordinal));
+            }
+            entry = _segments[ordinal];
+        }
+
+        SparseRange range;
+        rowid_t range_begin = rowid_of(ids[order[pos]]);
+        rowid_t range_end = range_begin;
+        const uint32_t base = fetched->num_rows();
+        uint32_t num_distinct = 0;
+        for (; pos < num_rows && segment_ordinal_of(ids[order[pos]]) == ordinal; pos++) {
+            const rowid_t rowid = rowid_of(ids[order[pos]]);
+            if (num_distinct > 0 && rowid == range_end - 1) {
+                // duplicated row
+                indexes[order[pos]] = base + num_distinct - 1;
+                continue;
+            }
+            if (rowid != range_end) {
+                range.add(Range(range_begin, range_end));
+                range_begin = rowid;
+            }
+            range_end = rowid + 1;
+            indexes[order[pos]] = base + num_distinct;
+            num_distinct++;
+        }
+        range.add(Range(range_begin, range_end));
+        if (range_end > entry.segment->num_rows()) {
+            return Status::InvalidArgument(fmt::format("Row id {} out of range of segment {} with {} rows",
+                                                       range_end - 1, entry.segment->file_name(),
+                                                       entry.segment->num_rows()));
+        }
+
+        SegmentReadOptions opts;
+        opts.block_mgr = entry.block_mgr;
+        opts.stats = stats;
+        opts.rowid_range = &range;
+        opts.use_page_cache = !config::disable_storage_page_cache;
+        opts.chunk_size = config::vector_chunk_size;
+        ASSIGN_OR_RETURN(auto iter, entry.segment->new_iterator(schema, opts));
+        ChunkPtr chunk = ChunkHelper::new_chunk(schema, opts.chunk_size);
+        while (true) {
+            chunk->reset();
+            Status st = iter->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            RETURN_IF_ERROR(st);
+            fetched->append(*chunk);
+        }
+        iter->close();
+        if (fetched->num_rows() != base + num_distinct) {
+            return Status::InternalError(fmt::format("Fetched {} rows from segment {}, but {} rows are expected",
+                                                     fetched->num_rows() - base, entry.segment->file_name(),
+                                                     num_distinct));
+        }
+    }
+    dst->append_selective(*fetched, indexes.data(), 0, num_rows);
+    return Status::OK();
+}
+
+class GlobalRowidIterator final : public ChunkIterator {
+public:
+    GlobalRowidIterator(ChunkIteratorPtr child, uint32_t segment_ordinal, ColumnId rowid_column_id)
+            : ChunkIterator(schema_with_rowid(child->schema(), rowid_column_id), child->chunk_size()),
+              _child(std::move(child)),
+              _segment_ordinal(segment_ordinal),
+              _rowid_column_id(rowid_column_id) {}
+
+    void close() override { _child->close(); }
+
+    Status init_encoded_schema(ColumnIdToGlobalDictMap& dict_maps) override {
+        RETURN_IF_ERROR(ChunkIterator::init_encoded_schema(dict_maps));
+        return _child->init_encoded_schema(dict_maps);
+    }
+
+    Status init_output_schema(const std::unordered_set<uint32_t>& unused_output_column_ids) override {
+        if (unused_output_column_ids.count(_rowid_column_id) > 0) {
+            return Status::InvalidArgument("The global row id column cannot be unused");
+        }
+        RETURN_IF_ERROR(ChunkIterator::init_output_schema(unused_output_column_ids));
+        return _child->init_output_schema(unused_output_column_ids);
+    }
+
+protected:
+    Status do_get_next(Chunk* chunk) override;
+
+private:
+    static Schema schema_with_rowid(const Schema& schema, ColumnId rowid_column_id) {
+        Schema res = schema;
+        res.append(std::make_shared<Field>(rowid_column_id, "_global_rowid_", OLAP_FIELD_TYPE_BIGINT, false));
+        return res;
+    }
+
+    ChunkIteratorPtr _child;
+    const uint32_t _segment_ordinal;
+    const ColumnId _rowid_column_id;
+    ChunkPtr _chunk;
+    std::vector<uint32_t> _rowids;
+};
+
+Status GlobalRowidIterator::do_get_next(Chunk* chunk) {
+    if (_chunk == nullptr) {
+        _chunk = ChunkHelper::new_chunk(_child->output_schema(), _chunk_size);
+    }
+    _chunk->reset();
+    _rowids.clear();
+    RETURN_IF_ERROR(_child->get_next(_chunk.get(), &_rowids));
+    DCHECK_EQ(_chunk->num_rows(), _rowids.size());
+
+    Columns& input_columns = _chunk->columns();
+    DCHECK_EQ(input_columns.size() + 1, chunk->num_columns());
+    for (size_t i = 0; i < input_columns.size(); i++) {
+        chunk->get_column_by_index(i).swap(input_columns[i]);
+    }
+    auto* rowid_column = down_cast<Int64Column*>(chunk->get_column_by_index(input_columns.size()).get());
+    auto& data = rowid_column->get_data();
+    data.resize(_rowids.size());
+    for (size_t i = 0; i < _rowids.size(); i++) {
+        data[i] = SegmentRowFetcher::encode_global_rowid(_segment_ordinal, _rowids[i]);
+    }
+    return Status::OK();
+}
+
+ChunkIteratorPtr new_global_rowid_iterator(const ChunkIteratorPtr& child, uint32_t segment_ordinal,
+                                           ColumnId rowid_column_id) {
+    return std::make_shared<GlobalRowidIterator>(child, segment_ordinal, rowid_column_id);
+}
+
+} // namespace starrocks::vectorized
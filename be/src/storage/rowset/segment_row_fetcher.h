@@ -0,0 +1,76 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+#include "storage/chunk_iterator.h"
+#include "storage/olap_common.h"
+#include "storage/rowset/common.h"
+
+namespace starrocks {
+class Segment;
+
+namespace fs {
+class BlockManager;
+} // namespace fs
+
+namespace vectorized {
+
+// Support of the late materialization across operators, e.g. joins.
+//
+// Instead of the payload columns, a scan outputs a BIGINT column of global row ids, each of which
+// identifies a row by the ordinal of its segment registered in a |SegmentRowFetcher| and its ordinal
+// in the segment. After the rows are filtered, e.g. by a selective join, the payload columns of the
+// surviving rows are read by |SegmentRowFetcher::fetch|, so that most of the pages are never read.
+//
+// The segments are kept alive by the fetcher until it is destroyed.
+class SegmentRowFetcher {
+public:
+    static int64_t encode_global_rowid(uint32_t segment_ordinal, rowid_t rowid) {
+        return static_cast<int64_t>((static_cast<uint64_t>(segment_ordinal) << 32) | rowid);
+    }
+    static uint32_t segment_ordinal_of(int64_t global_rowid) {
+        return static_cast<uint32_t>(static_cast<uint64_t>(global_rowid) >> 32);
+    }
+    static rowid_t rowid_of(int64_t global_rowid) { return static_cast<rowid_t>(global_rowid); }
+
+    SegmentRowFetcher() = default;
+
+    SegmentRowFetcher(const SegmentRowFetcher&) = delete;
+    const SegmentRowFetcher& operator=(const SegmentRowFetcher&) = delete;
+
+    // Register |segment|, which is read by |block_mgr|, and return its ordinal in the global row ids.
+    // Thread-safe.
+    uint32_t add_segment(std::shared_ptr<fs::BlockManager> block_mgr, std::shared_ptr<Segment> segment);
+
+    size_t num_segments() const;
+
+    // Read the columns in |schema| of the rows in |global_rowids|, and append them to |dst| in the same
+    // order as |global_rowids|. The row ids may be in any order and may be duplicated.
+    // The columns of |dst| must match the fields of |schema|.
+    Status fetch(const Schema& schema, const Int64Column& global_rowids, OlapReaderStatistics* stats, Chunk* dst);
+
+private:
+    struct SegmentEntry {
+        std::shared_ptr<fs::BlockManager> block_mgr;
+        std::shared_ptr<Segment> segment;
+    };
+
+    mutable std::mutex _lock;
+    std::vector<SegmentEntry> _segments;
+};
+
+// Return an iterator outputting the columns of |child| followed by a BIGINT column of the global row ids,
+// whose field id is |rowid_column_id|. |child| must be a segment iterator supporting
+// `get_next(Chunk*, std::vector<uint32_t>*)`, and |segment_ordinal| be the ordinal of its segment
+// returned by |SegmentRowFetcher::add_segment|.
+ChunkIteratorPtr new_global_rowid_iterator(const ChunkIteratorPtr& child, uint32_t segment_ordinal,
+                                           ColumnId rowid_column_id);
+
+} // namespace vectorized
+} // namespace starrocks
@@ -26,11 +26,14 @@
 #include "column/chunk.h"
 #include "column/datum_tuple.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
 #include "common/logging.h" // LOG
 #include "env/env.h"        // Env
 #include "gen_cpp/segment.pb.h"
+#include "runtime/current_thread.h"
 #include "storage/fs/block_manager.h"
 #include "storage/rowset/column_writer.h" // ColumnWriter
+#include "storage/rowset/encoding_info.h"
 #include "storage/rowset/page_io.h"
 #include "storage/schema.h"
 #include "storage/seek_tuple.h"
@@ -38,6 +41,7 @@
 #include "util/crc32c.h"
 #include "util/faststring.h"
 #include "util/json.h"
+#include "util/threadpool.h"
 
 namespace starrocks {
 
@@ -57,8 +61,14 @@ void SegmentWriter::_init_column_meta(ColumnMetaPB* meta, uint32_t column_id, co
     meta->set_unique_id(column.unique_id());
     meta->set_type(column.type());
     meta->set_length(column.length());
-    meta->set_encoding(DEFAULT_ENCODING);
+    meta->set_encoding(config::enable_adaptive_numeric_encoding ? EncodingInfo::get_adaptive_encoding(column.type())
+                                                                : DEFAULT_ENCODING);
     meta->set_compression(LZ4_FRAME);
+    if (config::enable_zstd_dict_compression &&
+        (column.type() == OLAP_FIELD_TYPE_CHAR || column.type() == OLAP_FIELD_TYPE_VARCHAR)) {
+        // the pages will be compressed by zstd with a dictionary, see ScalarColumnWriter.
+        meta->set_compression(ZSTD);
+    }
     meta->set_is_nullable(column.is_nullable());
 
     // TODO(mofei) set the format_version from column
@@ -139,6 +149,8 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
         }
         opts.need_bloom_filter = column.is_bf_column();
         opts.need_bitmap_index = column.has_bitmap_index();
+        opts.need_ngram_index = column.has_ngram_index();
+        opts.need_compression_dict = opts.meta->compression() == ZSTD && config::enable_zstd_dict_compression;
         if (column.type() == FieldType::OLAP_FIELD_TYPE_ARRAY) {
             if (opts.need_bloom_filter) {
                 return Status::NotSupported("Do not support bloom filter for array type");
@@ -146,6 +158,9 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
             if (opts.need_bitmap_index) {
                 return Status::NotSupported("Do not support bitmap index for array type");
             }
+            if (opts.need_ngram_index) {
+                return Status::NotSupported("Do not support n-gram index for array type");
+            }
         }
 
         if (column.type() == FieldType::OLAP_FIELD_TYPE_CHAR && column.type() != FieldType::OLAP_FIELD_TYPE_VARCHAR,
@@ -217,6 +232,7 @@ Status SegmentWriter::finalize_columns(uint64_t* index_size) {
         RETURN_IF_ERROR(column_writer->write_zone_map());
         RETURN_IF_ERROR(column_writer->write_bitmap_index());
         RETURN_IF_ERROR(column_writer->write_bloom_filter_index());
+        RETURN_IF_ERROR(column_writer->write_ngram_index());
         *index_size += _wblock->bytes_appended() - index_offset;
 
         // global dict
@@ -290,9 +306,19 @@ Status SegmentWriter::_write_raw_data(const std::vector<Slice>& slices) {
 
 Status SegmentWriter::append_chunk(const vectorized::Chunk& chunk) {
     DCHECK_EQ(_column_writers.size(), chunk.num_columns());
-    for (size_t i = 0; i < _column_writers.size(); ++i) {
-        const vectorized::Column* col = chunk.get_column_by_index(i).get();
-        RETURN_IF_ERROR(_column_writers[i]->append(*col));
+    if (_opts.parallel_pool != nullptr && _column_writers.size() > 1 &&
+        chunk.num_rows() >= config::segment_writer_parallel_append_min_rows) {
+        // the column writers are independent of each other until finalized
+        MemTracker* mem_tracker = tls_mem_tracker;
+        RETURN_IF_ERROR(parallel_run(_opts.parallel_pool, _column_writers.size(), [&](size_t i) {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            return _column_writers[i]->append(*chunk.get_column_by_index(i));
+        }));
+    } else {
+        for (size_t i = 0; i < _column_writers.size(); ++i) {
+            const vectorized::Column* col = chunk.get_column_by_index(i).get();
+            RETURN_IF_ERROR(_column_writers[i]->append(*col));
+        }
     }
 
     size_t chunk_num_rows = chunk.num_rows();
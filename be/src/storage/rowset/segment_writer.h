@@ -38,6 +38,7 @@ class TabletSchema;
 class TabletColumn;
 class ShortKeyIndexBuilder;
 class MemTracker;
+class ThreadPool;
 
 namespace fs {
 class WritableBlock;
@@ -57,6 +58,9 @@ struct SegmentWriterOptions {
     uint32_t num_rows_per_block = 1024;
     vectorized::GlobalDictByNameMaps* global_dicts = nullptr;
     std::vector<int32_t> referenced_column_ids;
+    // if set, the columns of the large chunks are appended in parallel in this pool,
+    // see config::segment_writer_parallel_append_min_rows
+    ThreadPool* parallel_pool = nullptr;
 };
 
 // SegmentWriter is responsible for writing data into single segment by all or partital columns.
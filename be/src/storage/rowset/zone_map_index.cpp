@@ -21,6 +21,7 @@
 
 #include "storage/rowset/zone_map_index.h"
 
+#include "column/datum_convert.h"
 #include "runtime/mem_pool.h"
 #include "runtime/mem_tracker.h"
 #include "storage/column_block.h"
@@ -221,4 +222,49 @@ Status ZoneMapIndexReader::load(fs::BlockManager* block_mgr, const std::string&
     return Status::OK();
 }
 
+Status ZoneMapIndexReader::init_zone_map_details(const TypeInfoPtr& type_info, size_t num_rows,
+                                                  int32_t pages_per_granule) {
+    _page_zone_map_details.resize(_page_zone_maps.size());
+    for (size_t i = 0; i < _page_zone_maps.size(); ++i) {
+        const ZoneMapPB& zm = _page_zone_maps[i];
+        vectorized::ZoneMapDetail& detail = _page_zone_map_details[i];
+        detail.set_has_null(zm.has_null());
+        if (zm.has_not_null()) {
+            // No MemPool, the slices of the string types refer to |zm|, which is never changed.
+            RETURN_IF_ERROR(vectorized::datum_from_string(type_info.get(), &detail.min_value(), zm.min(), nullptr));
+            RETURN_IF_ERROR(vectorized::datum_from_string(type_info.get(), &detail.max_value(), zm.max(), nullptr));
+        }
+        detail.set_num_rows(num_rows);
+    }
+
+    _granule_zone_map_details.clear();
+    _pages_per_granule = pages_per_granule;
+    if (_pages_per_granule < 2) {
+        return Status::OK();
+    }
+    const size_t num_granules = (_page_zone_map_details.size() + _pages_per_granule - 1) / _pages_per_granule;
+    _granule_zone_map_details.resize(num_granules);
+    for (size_t i = 0; i < _page_zone_map_details.size(); ++i) {
+        const vectorized::ZoneMapDetail& page = _page_zone_map_details[i];
+        vectorized::ZoneMapDetail& granule = _granule_zone_map_details[i / _pages_per_granule];
+        // The zone maps of the data pages without any non-null value have null min and max.
+        if (page.has_not_null()) {
+            if (!granule.has_not_null()) {
+                granule.min_value() = page.min_value();
+                granule.max_value() = page.max_value();
+            } else {
+                if (type_info->cmp(page.min_value(), granule.min_value()) < 0) {
+                    granule.min_value() = page.min_value();
+                }
+                if (type_info->cmp(page.max_value(), granule.max_value()) > 0) {
+                    granule.max_value() = page.max_value();
+                }
+            }
+        }
+        granule.set_has_null(granule.has_null() | page.has_null());
+        granule.set_num_rows(num_rows);
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -32,6 +32,8 @@
 #include "runtime/mem_tracker.h"
 #include "storage/field.h"
 #include "storage/rowset/binary_plain_page.h"
+#include "storage/types.h"
+#include "storage/zone_map_detail.h"
 #include "util/slice.h"
 
 namespace starrocks {
@@ -75,16 +77,38 @@ public:
 
     int32_t num_pages() const { return _page_zone_maps.size(); }
 
+    // Parse the page zone maps of |type_info| once, so that they can be evaluated by the predicates of
+    // every query directly, and build a two-level skip index on them: every |pages_per_granule| adjacent
+    // pages are summarized into a granule, whose zone map is the union of the zone maps of its pages.
+    // A granule not matched by the predicates is skipped without checking its pages, which cuts most of
+    // the zone map evaluations for the selective range filters, e.g. on the time columns.
+    // No granule is built if |pages_per_granule| is less than 2.
+    // |num_rows| is the number of rows of the column, which is set to all the zone map details.
+    Status init_zone_map_details(const TypeInfoPtr& type_info, size_t num_rows, int32_t pages_per_granule);
+
+    // Available after init_zone_map_details().
+    const std::vector<vectorized::ZoneMapDetail>& page_zone_map_details() const { return _page_zone_map_details; }
+    const std::vector<vectorized::ZoneMapDetail>& granule_zone_map_details() const {
+        return _granule_zone_map_details;
+    }
+    int32_t pages_per_granule() const { return _pages_per_granule; }
+
     size_t mem_usage() const {
         size_t size = sizeof(ZoneMapIndexReader);
         for (const auto& zone_map : _page_zone_maps) {
             size += zone_map.SpaceUsedLong();
         }
+        // The min and max values of the string types refer to |_page_zone_maps|.
+        size += (_page_zone_map_details.capacity() + _granule_zone_map_details.capacity()) *
+                sizeof(vectorized::ZoneMapDetail);
         return size;
     }
 
 private:
     std::vector<ZoneMapPB> _page_zone_maps;
+    std::vector<vectorized::ZoneMapDetail> _page_zone_map_details;
+    std::vector<vectorized::ZoneMapDetail> _granule_zone_map_details;
+    int32_t _pages_per_granule = 0;
 };
 
 } // namespace starrocks
@@ -2,6 +2,7 @@
 
 #include "rowset_update_state.h"
 
+#include "common/config.h"
 #include "gutil/strings/substitute.h"
 #include "serde/column_array_serde.h"
 #include "storage/chunk_helper.h"
@@ -244,6 +245,12 @@ Status RowsetUpdateState::_prepare_partial_update_states(Tablet* tablet, Rowset*
     RETURN_IF_ERROR(tablet->updates()->prepare_partial_update_states(tablet, _upserts, &_read_version, &_next_rowset_id,
                                                                      &rss_rowids));
 
+    // In column mode, the updated columns of the rows already in the tablet are written into the delta column
+    // groups of their segments by apply_column_mode, so the missing columns are not read here, and all the rows
+    // take the default values, which are only kept by the new rows.
+    // The keys of a rowset of multiple segments may be duplicated, so only a single segment is supported.
+    _column_mode = config::enable_column_mode_partial_update && num_segments == 1;
+
     int64_t t_read_values = MonotonicMillis();
     size_t total_rows = 0;
     // rows actually needed to be read, excluding rows with default values
@@ -252,7 +259,12 @@ Status RowsetUpdateState::_prepare_partial_update_states(Tablet* tablet, Rowset*
         size_t num_default = 0;
         std::map<uint32_t, std::vector<uint32_t>> rowids_by_rssid;
         vector<uint32_t> idxes;
-        plan_read_by_rssid(_partial_update_states[i].src_rss_rowids, &num_default, &rowids_by_rssid, &idxes);
+        if (_column_mode) {
+            num_default = _partial_update_states[i].src_rss_rowids.size();
+            idxes.resize(num_default, 0);
+        } else {
+            plan_read_by_rssid(_partial_update_states[i].src_rss_rowids, &num_default, &rowids_by_rssid, &idxes);
+        }
         total_rows += _partial_update_states[i].src_rss_rowids.size();
         total_nondefault_rows += _partial_update_states[i].src_rss_rowids.size() - num_default;
         // get column values by rowid, also get default values if needed
@@ -267,9 +279,28 @@ Status RowsetUpdateState::_prepare_partial_update_states(Tablet* tablet, Rowset*
 
     LOG(INFO) << Substitute(
             "prepare PartialUpdateState tablet:$0 read_version:$1 #segment:$2 #row:$3(#non-default:$4) #column:$5 "
-            "time:$6ms(index:$7/value:$8)",
+            "time:$6ms(index:$7/value:$8)$9",
             _tablet_id, _read_version.to_string(), num_segments, total_rows, total_nondefault_rows, read_columns.size(),
-            t_end - t_start, t_read_values - t_read_index, t_end - t_read_values);
+            t_end - t_start, t_read_values - t_read_index, t_end - t_read_values, _column_mode ? " column mode" : "");
+    return Status::OK();
+}
+
+// Get the rssids in |rss_rowids| whose delta column groups are updated after |version|.
+static Status get_rssids_updated_by_column_mode(Tablet* tablet, const std::vector<uint64_t>& rss_rowids,
+                                                int64_t version, std::set<uint32_t>* rssids) {
+    std::set<uint32_t> checked;
+    for (uint64_t rss_rowid : rss_rowids) {
+        uint32_t rssid = rss_rowid >> 32;
+        if (rssid == (uint32_t)-1 || !checked.insert(rssid).second) {
+            continue;
+        }
+        DeltaColumnGroupList dcgs;
+        RETURN_IF_ERROR(TabletMetaManager::get_delta_column_groups(tablet->data_dir()->get_meta(), tablet->tablet_id(),
+                                                                   rssid, INT64_MAX, &dcgs));
+        if (!dcgs.empty() && dcgs[0].version() > version) {
+            rssids->insert(rssid);
+        }
+    }
     return Status::OK();
 }
 
@@ -284,7 +315,8 @@ Status RowsetUpdateState::_check_and_resolve_conflict(Tablet* tablet, Rowset* ro
 
     // _read_version is equal to latest_applied_version which means there is no other rowset is applied
     // the data of write_columns can be write to segment file directly
-    if (latest_applied_version == _read_version) {
+    // If prepared in column mode, the rows already in the tablet have default values, and must be read again.
+    if (latest_applied_version == _read_version && !_column_mode) {
         return Status::OK();
     }
 
@@ -306,13 +338,20 @@ Status RowsetUpdateState::_check_and_resolve_conflict(Tablet* tablet, Rowset* ro
         std::vector<uint32_t> conflict_idxes;
         std::vector<uint64_t> conflict_rowids;
         DCHECK_EQ(num_rows, _partial_update_states[i].src_rss_rowids.size());
+        // the rows may be updated in place by column mode partial updates since _read_version
+        std::set<uint32_t> updated_rssids;
+        if (latest_applied_version != _read_version) {
+            RETURN_IF_ERROR(get_rssids_updated_by_column_mode(tablet, new_rss_rowids[i], _read_version.major(),
+                                                              &updated_rssids));
+        }
         for (size_t j = 0; j < new_rss_rowids[i].size(); ++j) {
             uint64_t new_rss_rowid = new_rss_rowids[i][j];
             uint32_t new_rssid = new_rss_rowid >> 32;
             uint64_t rss_rowid = _partial_update_states[i].src_rss_rowids[j];
             uint32_t rssid = rss_rowid >> 32;
 
-            if (rssid != new_rssid) {
+            if (rssid != new_rssid ||
+                (new_rssid != (uint32_t)-1 && (_column_mode || updated_rssids.count(new_rssid) > 0))) {
                 conflict_idxes.emplace_back(j);
                 conflict_rowids.emplace_back(new_rss_rowid);
             }
@@ -372,6 +411,23 @@ Status RowsetUpdateState::apply(Tablet* tablet, Rowset* rowset, uint32_t rowset_
         }
     }
 
+    RETURN_IF_ERROR(
+            _check_and_resolve_conflict(tablet, rowset, rowset_id, latest_applied_version, read_column_ids, index));
+    RETURN_IF_ERROR(
+            _rewrite_partial_segments(tablet, rowset, rowset_id, read_column_ids, config::rewrite_partial_segment));
+    // Be may crash during the rewrite or after the rewrite
+    // So the data at the end of the segment_file may be illegal
+    // We use partial_rowset_footers to locate the partial_footer so that
+    // the segment can be read normally after be crash during rewrite
+    // If rewrite is finished, the partial_segment_footer should be removed from rowset_meta
+    // to make sure the new full rowset could be read normally after be restarted
+    RETURN_IF_ERROR(_update_rowset_meta(tablet, rowset));
+    return Status::OK();
+}
+
+Status RowsetUpdateState::_rewrite_partial_segments(Tablet* tablet, Rowset* rowset, uint32_t rowset_id,
+                                                    std::vector<uint32_t>& read_column_ids, bool is_rewrite) {
+    const auto& txn_meta = rowset->rowset_meta()->get_meta_pb().txn_meta();
     size_t num_segments = rowset->num_segments();
     DCHECK(num_segments == _upserts.size());
     vector<std::pair<string, string>> rewrite_files;
@@ -380,10 +436,6 @@ Status RowsetUpdateState::apply(Tablet* tablet, Rowset* rowset, uint32_t rowset_
             Env::Default()->delete_file(e.second);
         }
     });
-    bool is_rewrite = config::rewrite_partial_segment;
-    RETURN_IF_ERROR(
-            _check_and_resolve_conflict(tablet, rowset, rowset_id, latest_applied_version, read_column_ids, index));
-
     for (size_t i = 0; i < num_segments; i++) {
         auto src_path = BetaRowset::segment_file_path(tablet->schema_hash_path(), rowset->rowset_id(), i);
         auto dest_path = BetaRowset::segment_temp_file_path(tablet->schema_hash_path(), rowset->rowset_id(), i);
@@ -415,14 +467,106 @@ Status RowsetUpdateState::apply(Tablet* tablet, Rowset* rowset, uint32_t rowset_
     // clean this to prevent DeferOp clean files
     rewrite_files.clear();
     auto beta_rowset = down_cast<BetaRowset*>(rowset);
-    RETURN_IF_ERROR(beta_rowset->reload());
-    // Be may crash during the rewrite or after the rewrite
-    // So the data at the end of the segment_file may be illegal
-    // We use partial_rowset_footers to locate the partial_footer so that
-    // the segment can be read normally after be crash during rewrite
-    // If rewrite is finished, the partial_segment_footer should be removed from rowset_meta
-    // to make sure the new full rowset could be read normally after be restarted
-    RETURN_IF_ERROR(_update_rowset_meta(tablet, rowset));
+    return beta_rowset->reload();
+}
+
+Status RowsetUpdateState::apply_column_mode(Tablet* tablet, Rowset* rowset, uint32_t rowset_id,
+                                            const EditVersion& version, const PrimaryIndex& index) {
+    if (!_column_mode || _upserts.size() != 1 || _partial_update_states.size() != 1) {
+        return Status::InternalError(Substitute("not a column mode partial update rowset:$0", rowset_id));
+    }
+    int64_t t_start = MonotonicMillis();
+    const auto& txn_meta = rowset->rowset_meta()->get_meta_pb().txn_meta();
+    const auto& tschema = tablet->tablet_schema();
+    std::set<uint32_t> update_columns_set(txn_meta.partial_update_column_ids().begin(),
+                                          txn_meta.partial_update_column_ids().end());
+    // columns to be filled with default values for the new rows
+    std::vector<uint32_t> read_column_ids;
+    // columns to be written into delta column groups for the rows already in the tablet
+    std::vector<uint32_t> delta_column_ids;
+    for (uint32_t i = 0; i < tschema.num_columns(); i++) {
+        if (update_columns_set.find(i) == update_columns_set.end()) {
+            read_column_ids.push_back(i);
+        } else if (i >= tschema.num_key_columns()) {
+            delta_column_ids.push_back(i);
+        }
+    }
+
+    // 1. find the rows already in the tablet, grouped by rssid
+    const auto& pks = *_upserts[0];
+    std::vector<uint64_t> rss_rowids(pks.size());
+    index.get(pks, &rss_rowids);
+    std::map<uint32_t, std::vector<RowidSortEntry>> entries_by_rssid;
+    _column_mode_rowids.clear();
+    _delta_column_groups.clear();
+    for (uint32_t i = 0; i < rss_rowids.size(); i++) {
+        uint32_t rssid = rss_rowids[i] >> 32;
+        if (rssid != (uint32_t)-1) {
+            entries_by_rssid[rssid].emplace_back(rss_rowids[i] & ROWID_MASK, i);
+            _column_mode_rowids.push_back(i);
+        }
+    }
+
+    int64_t t_read = MonotonicMillis();
+    if (!_column_mode_rowids.empty() && !delta_column_ids.empty()) {
+        // 2. read the updated columns from the partial segment
+        RowsetReleaseGuard guard(rowset->shared_from_this());
+        auto schema = ChunkHelper::convert_schema_to_format_v2(tschema, delta_column_ids);
+        OlapReaderStatistics stats;
+        auto beta_rowset = down_cast<BetaRowset*>(rowset);
+        ASSIGN_OR_RETURN(auto itrs, beta_rowset->get_segment_iterators2(schema, nullptr, 0, &stats));
+        if (itrs.size() != 1 || itrs[0] == nullptr) {
+            return Status::InternalError(Substitute("no partial segment to read, rowset:$0", rowset_id));
+        }
+        auto values = ChunkHelper::new_chunk(schema, pks.size());
+        auto chunk = ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+        while (true) {
+            chunk->reset();
+            auto st = itrs[0]->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            RETURN_IF_ERROR(st);
+            values->append(*chunk);
+        }
+        itrs[0]->close();
+        if (values->num_rows() != pks.size()) {
+            return Status::InternalError(Substitute("read partial segment: #row:$0 != #key:$1, rowset:$2",
+                                                    values->num_rows(), pks.size(), rowset_id));
+        }
+
+        // 3. write the delta column group of each segment, in the order of rowid
+        for (auto& [rssid, entries] : entries_by_rssid) {
+            std::sort(entries.begin(), entries.end());
+            std::vector<uint32_t> rowids(entries.size());
+            std::vector<uint32_t> idxes(entries.size());
+            for (size_t i = 0; i < entries.size(); i++) {
+                rowids[i] = entries[i].rowid;
+                idxes[i] = entries[i].idx;
+            }
+            auto dcg_values = values->clone_empty(idxes.size());
+            dcg_values->append_selective(*values, idxes.data(), 0, idxes.size());
+            DeltaColumnGroupPB dcg;
+            RETURN_IF_ERROR(tablet->updates()->write_delta_column_group(rssid, version.major(), delta_column_ids,
+                                                                        rowids, *dcg_values, &dcg));
+            _delta_column_groups.emplace_back(rssid, std::move(dcg));
+        }
+    }
+    int64_t t_write = MonotonicMillis();
+
+    // 4. fill the missing columns of the new rows with the default values
+    RETURN_IF_ERROR(
+            _rewrite_partial_segments(tablet, rowset, rowset_id, read_column_ids, config::rewrite_partial_segment));
+    // The rowset meta is saved by the caller along with the delta column groups and the delete vectors in one
+    // batch, so the partial update is applied again if be crashes before that.
+    rowset->rowset_meta()->release_txn_meta();
+    int64_t t_end = MonotonicMillis();
+    LOG(INFO) << Substitute(
+            "apply column mode partial update tablet:$0 rowset:$1 version:$2 #row:$3(#update:$4) #segment:$5 "
+            "#column:$6 time:$7ms(index:$8/delta:$9/rewrite:$10)",
+            tablet->tablet_id(), rowset_id, version.to_string(), pks.size(), _column_mode_rowids.size(),
+            _delta_column_groups.size(), delta_column_ids.size(), t_end - t_start, t_read - t_start, t_write - t_read,
+            t_end - t_write);
     return Status::OK();
 }
 
@@ -7,6 +7,7 @@
 
 #include "storage/olap_common.h"
 #include "storage/primary_index.h"
+#include "storage/rowset/delta_column_group.h"
 #include "storage/tablet_updates.h"
 
 namespace starrocks {
@@ -30,6 +31,25 @@ public:
     Status apply(Tablet* tablet, Rowset* rowset, uint32_t rowset_id, EditVersion latest_applied_version,
                  const PrimaryIndex& index);
 
+    // Whether the partial update is prepared to be applied in column mode, see delta_column_group.h.
+    bool is_column_mode() const { return _column_mode; }
+
+    // Apply the partial update in column mode at |version|: write the updated columns of the rows already
+    // in |index| into the delta column groups of their segments, and fill the missing columns of the new
+    // rows with the default values. The caller should only insert the new rows into the index, delete the
+    // other rows, whose row ids are returned by column_mode_rowids(), from the rowset, and save the delta
+    // column groups along with the rowset meta, whose txn meta is released in memory.
+    Status apply_column_mode(Tablet* tablet, Rowset* rowset, uint32_t rowset_id, const EditVersion& version,
+                             const PrimaryIndex& index);
+
+    // the delta column groups written by apply_column_mode, by rssid
+    const std::vector<std::pair<uint32_t, DeltaColumnGroupPB>>& delta_column_groups() const {
+        return _delta_column_groups;
+    }
+
+    // the rowids of the rows in the rowset updated in the delta column groups by apply_column_mode
+    const std::vector<uint32_t>& column_mode_rowids() const { return _column_mode_rowids; }
+
     const std::vector<ColumnUniquePtr>& upserts() const { return _upserts; }
     const std::vector<ColumnUniquePtr>& deletes() const { return _deletes; }
 
@@ -55,6 +75,9 @@ private:
                                        EditVersion latest_applied_version, std::vector<uint32_t>& read_column_ids,
                                        const PrimaryIndex& index);
 
+    Status _rewrite_partial_segments(Tablet* tablet, Rowset* rowset, uint32_t rowset_id,
+                                     std::vector<uint32_t>& read_column_ids, bool is_rewrite);
+
     Status _update_rowset_meta(Tablet* tablet, Rowset* rowset);
 
     std::once_flag _load_once_flag;
@@ -73,6 +96,11 @@ private:
     // TODO: dump to disk if memory usage is too large
     std::vector<PartialUpdateState> _partial_update_states;
 
+    // states for column mode partial update
+    bool _column_mode = false;
+    std::vector<std::pair<uint32_t, DeltaColumnGroupPB>> _delta_column_groups;
+    std::vector<uint32_t> _column_mode_rowids;
+
     RowsetUpdateState(const RowsetUpdateState&) = delete;
     const RowsetUpdateState& operator=(const RowsetUpdateState&) = delete;
 };
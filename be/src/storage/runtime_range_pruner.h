@@ -0,0 +1,56 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/olap_common.h"
+
+namespace starrocks::vectorized {
+
+class ColumnPredicate;
+
+// The predicates arriving after the segment iterators are initialized, e.g. the min/max values of the join
+// runtime filters which are built after the scan is opened. The segment iterators poll the new predicates
+// before reading each chunk, and prune the rows not read yet by the zone map and bloom filter indexes.
+//
+// The predicates are only used to prune the row ranges, so the caller must still evaluate the filters on
+// the rows read. The predicates are owned by the caller and must outlive the iterators.
+class RuntimeRangePruner {
+public:
+    using PredicateList = std::vector<const ColumnPredicate*>;
+
+    RuntimeRangePruner() = default;
+
+    RuntimeRangePruner(const RuntimeRangePruner&) = delete;
+    const RuntimeRangePruner& operator=(const RuntimeRangePruner&) = delete;
+
+    void add_predicate(ColumnId cid, const ColumnPredicate* pred) {
+        std::lock_guard l(_lock);
+        _predicates.emplace_back(cid, pred);
+        _version.store(_predicates.size(), std::memory_order_release);
+    }
+
+    // Increased by every predicate added.
+    size_t version() const { return _version.load(std::memory_order_acquire); }
+
+    // Get the predicates added after |version| grouped by column, and return the current version.
+    size_t get_predicates_since(size_t version, std::unordered_map<ColumnId, PredicateList>* preds) const {
+        std::lock_guard l(_lock);
+        for (size_t i = version; i < _predicates.size(); i++) {
+            (*preds)[_predicates[i].first].push_back(_predicates[i].second);
+        }
+        return _predicates.size();
+    }
+
+private:
+    mutable std::mutex _lock;
+    std::vector<std::pair<ColumnId, const ColumnPredicate*>> _predicates;
+    std::atomic<size_t> _version{0};
+};
+
+} // namespace starrocks::vectorized
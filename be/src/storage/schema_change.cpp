@@ -23,6 +23,7 @@
 
 #include <signal.h>
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -40,6 +41,8 @@
 #include "storage/tablet_updates.h"
 #include "storage/wrapper_field.h"
 #include "util/defer_op.h"
+#include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "util/unaligned_access.h"
 
 namespace starrocks {
@@ -1435,10 +1438,13 @@ Status SchemaChangeHandler::_do_process_alter_tablet_v2_normal(const TAlterTable
     read_params.skip_aggregation = false;
     read_params.chunk_size = config::vector_chunk_size;
 
-    // open tablet readers out of lock for open is heavy because of io
-    for (auto& tablet_reader : readers) {
-        tablet_reader->set_delete_predicates_version(delete_predicates_version);
-        RETURN_IF_ERROR(tablet_reader->open(read_params));
+    // open tablet readers out of lock for open is heavy because of io.
+    // The linked schema change doesn't read the rowsets, its readers only hold them from being compacted.
+    if (sc_params.sc_sorting || sc_params.sc_directly) {
+        for (auto& tablet_reader : readers) {
+            tablet_reader->set_delete_predicates_version(delete_predicates_version);
+            RETURN_IF_ERROR(tablet_reader->open(read_params));
+        }
     }
 
     sc_params.rowset_readers = std::move(readers);
@@ -1523,13 +1529,11 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
         return Status::InternalError("failed to malloc SchemaChange");
     }
 
-    Status status;
-
-    for (int i = 0; i < sc_params.rowset_readers.size(); ++i) {
+    TabletSharedPtr new_tablet = sc_params.new_tablet;
+    TabletSharedPtr base_tablet = sc_params.base_tablet;
+    auto convert_rowset = [&](size_t i, SchemaChange* procedure) -> StatusOr<RowsetSharedPtr> {
         VLOG(3) << "begin to convert a history rowset. version=" << sc_params.rowsets_to_change[i]->version();
 
-        TabletSharedPtr new_tablet = sc_params.new_tablet;
-        TabletSharedPtr base_tablet = sc_params.base_tablet;
         RowsetWriterContext writer_context(kDataFormatV2, config::storage_format_version);
         writer_context.rowset_id = StorageEngine::instance()->next_rowset_id();
         writer_context.tablet_uid = new_tablet->tablet_uid();
@@ -1548,14 +1552,14 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
         }
 
         std::unique_ptr<RowsetWriter> rowset_writer;
-        status = RowsetFactory::create_rowset_writer(writer_context, &rowset_writer);
-        if (!status.ok()) {
+        Status st = RowsetFactory::create_rowset_writer(writer_context, &rowset_writer);
+        if (!st.ok()) {
             return Status::InternalError("build rowset writer failed");
         }
 
         if (config::enable_schema_change_v2) {
-            auto st = sc_procedure->processV2(sc_params.rowset_readers[i].get(), rowset_writer.get(), new_tablet,
-                                              base_tablet, sc_params.rowsets_to_change[i]);
+            st = procedure->processV2(sc_params.rowset_readers[i].get(), rowset_writer.get(), new_tablet, base_tablet,
+                                      sc_params.rowsets_to_change[i]);
             if (!st.ok()) {
                 LOG(WARNING) << "failed to process the schema change. from tablet "
                              << base_tablet->get_tablet_info().to_string() << " to tablet "
@@ -1564,8 +1568,8 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
                 return st;
             }
         } else {
-            if (!sc_procedure->process(sc_params.rowset_readers[i].get(), rowset_writer.get(), new_tablet, base_tablet,
-                                       sc_params.rowsets_to_change[i])) {
+            if (!procedure->process(sc_params.rowset_readers[i].get(), rowset_writer.get(), new_tablet, base_tablet,
+                                    sc_params.rowsets_to_change[i])) {
                 LOG(WARNING) << "failed to process the version."
                              << " version=" << sc_params.version.first << "-" << sc_params.version.second;
                 return Status::InternalError("process failed");
@@ -1574,9 +1578,67 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
         auto new_rowset = rowset_writer->build();
         if (!new_rowset.ok()) {
             LOG(WARNING) << "failed to build rowset: " << new_rowset.status() << ". exit alter process";
-            break;
+            return new_rowset.status();
         }
         LOG(INFO) << "new rowset has " << (*new_rowset)->num_segments() << " segments";
+        return new_rowset;
+    };
+
+    // The rowsets are converted directly in parallel, each by its own reader and writer, sharing the memory
+    // limit of this task. The sorting schema change is kept serial, for its memory limit is per procedure.
+    size_t num_rowsets = sc_params.rowset_readers.size();
+    std::vector<StatusOr<RowsetSharedPtr>> new_rowsets(num_rowsets, Status::InternalError("rowset not converted"));
+    int parallelism = std::min<int>(config::schema_change_convert_parallelism, num_rowsets);
+    std::unique_ptr<ThreadPool> convert_pool;
+    if (sc_params.sc_directly && parallelism > 1) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("schema_change_convert")
+                                .set_min_threads(1)
+                                .set_max_threads(parallelism)
+                                .build(&convert_pool));
+    }
+    MonotonicStopWatch watch;
+    watch.start();
+    if (convert_pool != nullptr) {
+        MemTracker* mem_tracker = tls_thread_status.mem_tracker();
+        std::atomic<bool> failed{false};
+        for (size_t i = 0; i < num_rowsets; ++i) {
+            auto task = [&, i]() {
+                SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+                if (failed.load()) {
+                    return;
+                }
+                SchemaChangeDirectly procedure(chunk_changer);
+                new_rowsets[i] = convert_rowset(i, &procedure);
+                if (!new_rowsets[i].ok()) {
+                    failed.store(true);
+                }
+            };
+            if (!convert_pool->submit_func(task).ok()) {
+                task();
+            }
+        }
+        convert_pool->wait();
+    } else {
+        for (size_t i = 0; i < num_rowsets; ++i) {
+            new_rowsets[i] = convert_rowset(i, sc_procedure.get());
+            if (!new_rowsets[i].ok()) {
+                break;
+            }
+        }
+    }
+
+    Status status;
+    for (auto& new_rowset : new_rowsets) {
+        if (!new_rowset.ok()) {
+            if (status.ok()) {
+                status = new_rowset.status();
+            }
+            continue;
+        }
+        if (!status.ok()) {
+            StorageEngine::instance()->add_unused_rowset(*new_rowset);
+            continue;
+        }
         status = sc_params.new_tablet->add_rowset(*new_rowset, false);
         if (status.is_already_exist()) {
             LOG(WARNING) << "version already exist, version revert occurred. "
@@ -1589,7 +1651,6 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
                          << " tablet=" << sc_params.new_tablet->full_name() << ", version=" << sc_params.version.first
                          << "-" << sc_params.version.second;
             StorageEngine::instance()->add_unused_rowset(*new_rowset);
-            break;
         } else {
             VLOG(3) << "register new version. tablet=" << sc_params.new_tablet->full_name()
                     << ", version=" << sc_params.version.first << "-" << sc_params.version.second;
@@ -1605,7 +1666,9 @@ Status SchemaChangeHandler::_convert_historical_rowsets(SchemaChangeParams& sc_p
 
     LOG(INFO) << "finish converting rowsets for new_tablet from base_tablet. "
               << "base_tablet=" << sc_params.base_tablet->full_name()
-              << ", new_tablet=" << sc_params.new_tablet->full_name() << ", status is " << status.to_string();
+              << ", new_tablet=" << sc_params.new_tablet->full_name() << ", rowsets=" << num_rowsets
+              << ", parallelism=" << (convert_pool != nullptr ? parallelism : 1)
+              << ", cost=" << watch.elapsed_time() / 1000 / 1000 << "ms, status is " << status.to_string();
 
     return status;
 }
@@ -1749,12 +1812,15 @@ Status SchemaChangeHandler::_parse_request(
             } else if (new_column.has_bitmap_index() != ref_column.has_bitmap_index()) {
                 *sc_directly = true;
                 return Status::OK();
+            } else if (new_column.has_ngram_index() != ref_column.has_ngram_index()) {
+                *sc_directly = true;
+                return Status::OK();
             }
         }
     }
 
-    if (!base_tablet->delete_predicates().empty()) {
-        // there exists delete condition in header, can't do linked schema change
+    if (!_is_delete_predicates_linkable(base_tablet, new_tablet)) {
+        // the delete conditions refer to a column which is dropped or changed, can't do linked schema change
         *sc_directly = true;
     }
 
@@ -1766,6 +1832,39 @@ Status SchemaChangeHandler::_parse_request(
     return Status::OK();
 }
 
+// The linked rowsets keep their delete predicates, which are evaluated against the new schema by the
+// column names, so they must refer to the columns existing in the new schema with the same type.
+bool SchemaChangeHandler::_is_delete_predicates_linkable(const TabletSharedPtr& base_tablet,
+                                                         const TabletSharedPtr& new_tablet) {
+    const TabletSchema& base_schema = base_tablet->tablet_schema();
+    const TabletSchema& new_schema = new_tablet->tablet_schema();
+    auto is_column_kept = [&](const std::string& column_name) {
+        int32_t base_index = base_schema.field_index(column_name);
+        int32_t new_index = new_schema.field_index(column_name);
+        if (base_index < 0 || new_index < 0) {
+            return false;
+        }
+        const TabletColumn& base_column = base_schema.column(base_index);
+        const TabletColumn& new_column = new_schema.column(new_index);
+        return base_column.unique_id() == new_column.unique_id() && base_column.type() == new_column.type();
+    };
+    for (const auto& delete_predicate : base_tablet->delete_predicates()) {
+        for (const auto& sub_predicate : delete_predicate.sub_predicates()) {
+            TCondition condition;
+            if (!DeleteHandler::parse_condition(sub_predicate, &condition) ||
+                !is_column_kept(condition.column_name)) {
+                return false;
+            }
+        }
+        for (const auto& in_predicate : delete_predicate.in_predicates()) {
+            if (!is_column_kept(in_predicate.column_name())) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 Status SchemaChangeHandler::_init_column_mapping(ColumnMapping* column_mapping, const TabletColumn& column_schema,
                                                  const std::string& value) {
     column_mapping->default_value = WrapperField::create(column_schema);
@@ -202,6 +202,8 @@ private:
             ChunkChanger* chunk_changer, bool* sc_sorting, bool* sc_directly,
             const std::unordered_map<std::string, AlterMaterializedViewParam>& materialized_function_map);
 
+    static bool _is_delete_predicates_linkable(const TabletSharedPtr& base_tablet, const TabletSharedPtr& new_tablet);
+
     // default_value for new column is needed
     static Status _init_column_mapping(ColumnMapping* column_mapping, const TabletColumn& column_schema,
                                        const std::string& value);
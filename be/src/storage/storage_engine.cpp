@@ -22,17 +22,23 @@
 #include "storage/storage_engine.h"
 
 #include <algorithm>
+#include <chrono>
 #include <csignal>
+#include <cstdio>
 #include <cstring>
 #include <filesystem>
+#include <fstream>
 #include <memory>
 #include <new>
 #include <queue>
 #include <random>
 #include <set>
+#include <shared_mutex>
+#include <unordered_map>
 
 #include "common/status.h"
 #include "cumulative_compaction.h"
+#include "gutil/strings/util.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
 #include "storage/async_delta_writer_executor.h"
@@ -95,6 +101,14 @@ StorageEngine::StorageEngine(const EngineOptions& options)
         std::lock_guard lock(_gc_mutex);
         return _unused_rowsets.size();
     });
+    REGISTER_GAUGE_STARROCKS_METRIC(unused_rowsets_bytes, [this]() {
+        std::lock_guard lock(_gc_mutex);
+        size_t bytes = 0;
+        for (const auto& [rowset_id, rowset] : _unused_rowsets) {
+            bytes += rowset->data_disk_size();
+        }
+        return bytes;
+    });
 }
 
 StorageEngine::~StorageEngine() {
@@ -495,6 +509,9 @@ void StorageEngine::stop() {
     if (_fd_cache_clean_thread.joinable()) {
         _fd_cache_clean_thread.join();
     }
+    if (_hot_tablets_thread.joinable()) {
+        _hot_tablets_thread.join();
+    }
     if (config::path_gc_check) {
         for (auto& thread : _path_scan_threads) {
             if (thread.joinable()) {
@@ -565,6 +582,69 @@ void StorageEngine::_start_clean_fd_cache() {
     VLOG(10) << "Cleaned file descriptor cache";
 }
 
+// The tablet ids of the hot tablets in a store, one id per line, the most queried first.
+static const char* const kHotTabletsFileName = "hot_tablets";
+
+void StorageEngine::_warmup_hot_tablets() {
+    MonotonicStopWatch watch;
+    watch.start();
+    size_t num_tablets = 0;
+    size_t num_rowsets = 0;
+    for (DataDir* data_dir : get_stores()) {
+        std::ifstream in(data_dir->path() + "/" + kHotTabletsFileName);
+        int64_t tablet_id = 0;
+        while (in >> tablet_id && !_bg_worker_stopped.load(std::memory_order_consume)) {
+            TabletSharedPtr tablet = _tablet_manager->get_tablet(tablet_id);
+            // The rowsets of the primary key tablets are loaded by TabletUpdates when the tablet is loaded.
+            if (tablet == nullptr || tablet->updates() != nullptr) {
+                continue;
+            }
+            std::vector<RowsetSharedPtr> rowsets;
+            {
+                std::shared_lock l(tablet->get_header_lock());
+                Version version(0, tablet->max_version().second);
+                if (!tablet->capture_consistent_rowsets(version, &rowsets).ok()) {
+                    continue;
+                }
+            }
+            // Opens the segments and reads their footers and short key indexes, as the first query would.
+            for (const auto& rowset : rowsets) {
+                if (rowset->load().ok()) {
+                    ++num_rowsets;
+                }
+            }
+            ++num_tablets;
+            std::this_thread::sleep_for(std::chrono::milliseconds(config::storage_warmup_interval_ms));
+        }
+    }
+    LOG(INFO) << "Warmed up " << num_tablets << " hot tablets, " << num_rowsets << " rowsets loaded in "
+              << watch.elapsed_time() / 1000000 << "ms";
+}
+
+void StorageEngine::_save_hot_tablets() {
+    std::unordered_map<DataDir*, std::vector<int64_t>> hot_tablets_per_store;
+    for (const auto& tablet : _tablet_manager->get_hot_tablets(config::storage_warmup_hot_tablet_num)) {
+        hot_tablets_per_store[tablet->data_dir()].push_back(tablet->tablet_id());
+    }
+    for (DataDir* data_dir : get_stores()) {
+        const std::string path = data_dir->path() + "/" + kHotTabletsFileName;
+        const std::string tmp_path = path + ".tmp";
+        {
+            std::ofstream out(tmp_path, std::ios::trunc);
+            for (int64_t tablet_id : hot_tablets_per_store[data_dir]) {
+                out << tablet_id << '\n';
+            }
+            if (!out.good()) {
+                LOG(WARNING) << "Fail to write " << tmp_path;
+                continue;
+            }
+        }
+        if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+            PLOG(WARNING) << "Fail to rename " << tmp_path << " to " << path;
+        }
+    }
+}
+
 void StorageEngine::compaction_check() {
     int checker_one_round_sleep_time_s = 1800;
     while (!bg_worker_stopped()) {
@@ -839,9 +919,8 @@ void StorageEngine::_clean_unused_rowset_metas() {
     auto data_dirs = get_stores();
     for (auto data_dir : data_dirs) {
         (void)RowsetMetaManager::traverse_rowset_metas(data_dir->get_meta(), clean_rowset_func);
-        for (auto& rowset_meta : invalid_rowset_metas) {
-            (void)RowsetMetaManager::remove(data_dir->get_meta(), rowset_meta->tablet_uid(), rowset_meta->rowset_id());
-        }
+        // remove them by one write batch, rather than one write per rowset meta
+        (void)RowsetMetaManager::remove(data_dir->get_meta(), invalid_rowset_metas);
         invalid_rowset_metas.clear();
     }
 }
@@ -912,18 +991,48 @@ Status StorageEngine::_do_sweep(const std::string& scan_root, const time_t& loca
 }
 
 void StorageEngine::start_delete_unused_rowset() {
-    std::lock_guard lock(_gc_mutex);
-    for (auto it = _unused_rowsets.begin(); it != _unused_rowsets.end();) {
-        if (it->second.use_count() != 1) {
-            ++it;
-        } else if (it->second->need_delete_file()) {
-            VLOG(3) << "start to remove rowset:" << it->second->rowset_id()
-                    << ", version:" << it->second->version().first << "-" << it->second->version().second;
-            Status status = it->second->remove();
-            VLOG(3) << "remove rowset:" << it->second->rowset_id() << " finished. status:" << status;
-            it = _unused_rowsets.erase(it);
+    // At most unused_rowset_delete_bytes_per_second_per_disk * unused_rowset_monitor_interval bytes of each data
+    // dir are deleted in one round, the others are left to the next rounds. The files are removed out of
+    // _gc_mutex, and the rowsets are kept in _unused_rowsets until then, so that path gc doesn't take them as
+    // garbage.
+    int64_t bytes_limit_per_disk = config::unused_rowset_delete_bytes_per_second_per_disk *
+                                   std::max(1, config::unused_rowset_monitor_interval);
+    auto stores = get_stores<true>();
+    std::vector<int64_t> bytes_by_store(stores.size(), 0);
+    std::vector<RowsetSharedPtr> rowsets_to_delete;
+    {
+        std::lock_guard lock(_gc_mutex);
+        for (auto& [rowset_id, rowset] : _unused_rowsets) {
+            if (rowset.use_count() != 1 || !rowset->need_delete_file()) {
+                continue;
+            }
+            if (bytes_limit_per_disk > 0) {
+                std::string rowset_path = rowset->rowset_path();
+                auto it = std::find_if(stores.begin(), stores.end(), [&](DataDir* store) {
+                    return HasPrefixString(rowset_path, store->path());
+                });
+                if (it != stores.end()) {
+                    int64_t& bytes = bytes_by_store[it - stores.begin()];
+                    // one rowset is always deleted, even if it's larger than the limit
+                    if (bytes > 0 && bytes + rowset->data_disk_size() > bytes_limit_per_disk) {
+                        continue;
+                    }
+                    bytes += rowset->data_disk_size();
+                }
+            }
+            rowsets_to_delete.push_back(rowset);
         }
     }
+    for (auto& rowset : rowsets_to_delete) {
+        VLOG(3) << "start to remove rowset:" << rowset->rowset_id() << ", version:" << rowset->version().first << "-"
+                << rowset->version().second;
+        Status status = rowset->remove();
+        VLOG(3) << "remove rowset:" << rowset->rowset_id() << " finished. status:" << status;
+    }
+    std::lock_guard lock(_gc_mutex);
+    for (auto& rowset : rowsets_to_delete) {
+        _unused_rowsets.erase(rowset->rowset_id().to_string());
+    }
 }
 
 void StorageEngine::add_unused_rowset(const RowsetSharedPtr& rowset) {
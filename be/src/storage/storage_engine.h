@@ -237,6 +237,9 @@ private:
     // clean file descriptors cache
     void* _fd_cache_clean_callback(void* arg);
 
+    // warm up the tablets recorded before BE stopped, and record the hot tablets periodically
+    void* _hot_tablets_thread_callback(void* arg);
+
     // path gc process function
     void* _path_gc_thread_callback(void* arg);
 
@@ -245,6 +248,8 @@ private:
     void* _tablet_checkpoint_callback(void* arg);
 
     void _start_clean_fd_cache();
+    void _warmup_hot_tablets();
+    void _save_hot_tablets();
     Status _perform_cumulative_compaction(DataDir* data_dir);
     Status _perform_base_compaction(DataDir* data_dir);
     Status _perform_update_compaction(DataDir* data_dir);
@@ -316,6 +321,7 @@ private:
     std::vector<std::thread> _update_compaction_threads;
     // threads to clean all file descriptor not actively in use
     std::thread _fd_cache_clean_thread;
+    std::thread _hot_tablets_thread;
     std::vector<std::thread> _path_gc_threads;
     // threads to scan disk paths
     std::vector<std::thread> _path_scan_threads;
@@ -1269,6 +1269,19 @@ double Tablet::compaction_score(CompactionType type) const {
     }
 }
 
+double Tablet::compaction_io_priority(CompactionType type) const {
+    std::unique_lock wrlock(_meta_lock);
+    if (!_compaction_context) {
+        return 0;
+    }
+    if (type == BASE_COMPACTION) {
+        return _compaction_context->base_io_priority;
+    } else if (type == CUMULATIVE_COMPACTION) {
+        return _compaction_context->cumulative_io_priority;
+    }
+    return 0;
+}
+
 std::shared_ptr<CompactionTask> Tablet::get_compaction(CompactionType type, bool create_if_not_exist) {
     std::shared_lock wrlock(_meta_lock);
     if (!_compaction_context) {
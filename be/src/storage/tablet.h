@@ -241,6 +241,10 @@ public:
 
     // updatable tablet specific operations
     TabletUpdates* updates() { return _updates.get(); }
+
+    // The number of the queries that have read this tablet since BE started.
+    void increase_query_count() { _query_count.fetch_add(1, std::memory_order_relaxed); }
+    int64_t query_count() const { return _query_count.load(std::memory_order_relaxed); }
     Status rowset_commit(int64_t version, const RowsetSharedPtr& rowset);
 
     int64_t mem_usage() { return sizeof(Tablet); }
@@ -259,6 +263,9 @@ public:
 
     double compaction_score(CompactionType type) const;
 
+    // the number of segments merged away per MB rewritten by the compaction of |type|
+    double compaction_io_priority(CompactionType type) const;
+
     std::shared_ptr<CompactionTask> get_compaction(CompactionType type, bool create_if_not_exist);
 
     void stop_compaction();
@@ -357,6 +364,7 @@ private:
     std::atomic<int64_t> _cumulative_point{0};
     std::atomic<int32_t> _newly_created_rowset_num{0};
     std::atomic<int64_t> _last_checkpoint_time{0};
+    std::atomic<int64_t> _query_count{0};
 
     Tablet(const Tablet&) = delete;
     const Tablet& operator=(const Tablet&) = delete;
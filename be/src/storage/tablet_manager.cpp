@@ -28,6 +28,7 @@ DIAGNOSTIC_POP
 #include <fmt/format.h>
 #include <re2/re2.h>
 
+#include <algorithm>
 #include <ctime>
 #include <memory>
 
@@ -421,12 +422,21 @@ Status TabletManager::drop_tablets_on_error_root_path(const std::vector<TabletIn
 }
 
 TabletSharedPtr TabletManager::get_tablet(TTabletId tablet_id, bool include_deleted, std::string* err) {
-    std::shared_lock rlock(_get_tablets_shard_lock(tablet_id));
-    return _get_tablet_unlocked(tablet_id, include_deleted, err);
+    // The shard lock is only held for the lookup in the map, since it's taken for every scan range.
+    TabletSharedPtr tablet;
+    {
+        std::shared_lock rlock(_get_tablets_shard_lock(tablet_id));
+        tablet = _get_tablet_unlocked(tablet_id);
+    }
+    return _check_tablet(tablet_id, std::move(tablet), include_deleted, err);
 }
 
 TabletSharedPtr TabletManager::_get_tablet_unlocked(TTabletId tablet_id, bool include_deleted, std::string* err) {
-    TabletSharedPtr tablet = _get_tablet_unlocked(tablet_id);
+    return _check_tablet(tablet_id, _get_tablet_unlocked(tablet_id), include_deleted, err);
+}
+
+TabletSharedPtr TabletManager::_check_tablet(TTabletId tablet_id, TabletSharedPtr tablet, bool include_deleted,
+                                             std::string* err) {
     if (tablet == nullptr && include_deleted) {
         std::shared_lock rlock(_shutdown_tablets_lock);
         if (auto it = _shutdown_tablets.find(tablet_id); it != _shutdown_tablets.end()) {
@@ -454,8 +464,7 @@ TabletSharedPtr TabletManager::_get_tablet_unlocked(TTabletId tablet_id, bool in
 
 TabletSharedPtr TabletManager::get_tablet(TTabletId tablet_id, const TabletUid& tablet_uid, bool include_deleted,
                                           std::string* err) {
-    std::shared_lock rlock(_get_tablets_shard_lock(tablet_id));
-    TabletSharedPtr tablet = _get_tablet_unlocked(tablet_id, include_deleted, err);
+    TabletSharedPtr tablet = get_tablet(tablet_id, include_deleted, err);
     if (tablet != nullptr && tablet->tablet_uid() == tablet_uid) {
         return tablet;
     }
@@ -542,6 +551,33 @@ bool TabletManager::get_next_batch_tablets(size_t batch_size, std::vector<Tablet
     }
 }
 
+std::vector<TabletSharedPtr> TabletManager::get_hot_tablets(size_t num) {
+    // The counts are copied, since they may be changed by the queries while sorting.
+    std::vector<std::pair<int64_t, TabletSharedPtr>> queried_tablets;
+    for (const auto& tablets_shard : _tablets_shards) {
+        std::shared_lock rlock(tablets_shard.lock);
+        for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+            int64_t query_count = tablet_ptr->query_count();
+            if (query_count > 0) {
+                queried_tablets.emplace_back(query_count, tablet_ptr);
+            }
+        }
+    }
+    auto more_queried = [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; };
+    if (queried_tablets.size() > num) {
+        std::nth_element(queried_tablets.begin(), queried_tablets.begin() + num, queried_tablets.end(), more_queried);
+        queried_tablets.resize(num);
+    }
+    std::sort(queried_tablets.begin(), queried_tablets.end(), more_queried);
+
+    std::vector<TabletSharedPtr> tablets;
+    tablets.reserve(queried_tablets.size());
+    for (auto& [query_count, tablet] : queried_tablets) {
+        tablets.emplace_back(std::move(tablet));
+    }
+    return tablets;
+}
+
 TabletSharedPtr TabletManager::find_best_tablet_to_compaction(CompactionType compaction_type, DataDir* data_dir) {
     int64_t now_ms = UnixMillis();
     const std::string& compaction_type_str = compaction_type == CompactionType::BASE_COMPACTION ? "base" : "cumulative";
@@ -680,7 +716,8 @@ TabletSharedPtr TabletManager::find_best_tablet_to_do_update_compaction(DataDir*
 Status TabletManager::load_tablet_from_meta(DataDir* data_dir, TTabletId tablet_id, TSchemaHash schema_hash,
                                             std::string_view meta_binary, bool update_meta, bool force, bool restore,
                                             bool check_path) {
-    std::unique_lock wlock(_get_tablets_shard_lock(tablet_id));
+    // The meta is parsed and the tablet is initialized out of the shard lock, so that the tablets of a shard can be
+    // loaded in parallel when be starts.
     TabletMetaSharedPtr tablet_meta(new TabletMeta());
     if (Status st = tablet_meta->deserialize(meta_binary); !st.ok()) {
         LOG(WARNING) << "Fail to load tablet because can not parse meta_binary string. "
@@ -751,6 +788,7 @@ Status TabletManager::load_tablet_from_meta(DataDir* data_dir, TTabletId tablet_
         // tablet state is invalid, drop tablet
         return Status::InternalError("tablet in running state but without delta");
     }
+    std::unique_lock wlock(_get_tablets_shard_lock(tablet_id));
     auto st = _add_tablet_unlocked(tablet, update_meta, force);
     LOG_IF(WARNING, !st.ok()) << "Fail to add tablet " << tablet->full_name();
     // no concurrent access here
@@ -1402,6 +1440,7 @@ Status TabletManager::create_tablet_from_meta_snapshot(DataDir* store, TTabletId
         LOG(WARNING) << "Fail to init cloned tablet " << tablet_id << ", try to clear meta store";
         wb.Clear();
         RETURN_IF_ERROR(TabletMetaManager::clear_del_vector(store, &wb, tablet_id));
+        RETURN_IF_ERROR(TabletMetaManager::clear_delta_column_group(store, &wb, tablet_id));
         RETURN_IF_ERROR(TabletMetaManager::clear_rowset(store, &wb, tablet_id));
         RETURN_IF_ERROR(TabletMetaManager::clear_log(store, &wb, tablet_id));
         RETURN_IF_ERROR(TabletMetaManager::remove_tablet_meta(store, &wb, tablet_id, schema_hash));
@@ -147,6 +147,9 @@ public:
     // return true if all tablets visited
     bool get_next_batch_tablets(size_t batch_size, std::vector<TabletSharedPtr>* tablets);
 
+    // Return at most |num| tablets that have been queried, ordered by the query count descendingly.
+    std::vector<TabletSharedPtr> get_hot_tablets(size_t num);
+
 private:
     using TabletMap = std::unordered_map<int64_t, TabletSharedPtr>;
     using TabletSet = std::unordered_set<int64_t>;
@@ -194,6 +197,8 @@ private:
 
     TabletSharedPtr _get_tablet_unlocked(TTabletId tablet_id);
     TabletSharedPtr _get_tablet_unlocked(TTabletId tablet_id, bool include_deleted, std::string* err);
+    // Looks up the shutdown tablets if |tablet| is nullptr and |include_deleted|, and checks the tablet is usable.
+    TabletSharedPtr _check_tablet(TTabletId tablet_id, TabletSharedPtr tablet, bool include_deleted, std::string* err);
 
     TabletSharedPtr _internal_create_tablet_unlocked(AlterTabletType alter_type, const TCreateTabletReq& request,
                                                      bool is_schema_change, const Tablet* base_tablet,
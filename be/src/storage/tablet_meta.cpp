@@ -313,11 +313,16 @@ TabletMeta::TabletMeta(int64_t table_id, int64_t partition_id, int64_t tablet_id
 
         if (tablet_schema.__isset.indexes) {
             for (auto& index : tablet_schema.indexes) {
+                // A column may have both a bitmap index and an n-gram index, so all the indexes are checked.
                 if (index.index_type == TIndexType::type::BITMAP) {
                     DCHECK_EQ(index.columns.size(), 1);
                     if (boost::iequals(tcolumn.column_name, index.columns[0])) {
                         column->set_has_bitmap_index(true);
-                        break;
+                    }
+                } else if (index.index_type == TIndexType::type::NGRAM) {
+                    DCHECK_EQ(index.columns.size(), 1);
+                    if (boost::iequals(tcolumn.column_name, index.columns[0])) {
+                        column->set_has_ngram_index(true);
                     }
                 }
             }
@@ -50,6 +50,7 @@ static const std::string TABLET_META_LOG_PREFIX = "tlg_";
 static const std::string TABLET_META_ROWSET_PREFIX = "trs_";
 static const std::string TABLET_META_PENDING_ROWSET_PREFIX = "tpr_";
 static const std::string TABLET_DELVEC_PREFIX = "dlv_";
+static const std::string TABLET_DELTA_COLUMN_GROUP_PREFIX = "dcg_";
 static const std::string TABLET_PERSISTENT_INDEX_META_PREFIX = "tpi_";
 
 static string encode_meta_log_key(TTabletId id, uint64_t logid);
@@ -60,6 +61,7 @@ static string encode_meta_pending_rowset_key(TTabletId id, int64_t version);
 [[maybe_unused]] static bool decode_meta_pending_rowset_key(std::string_view key, TTabletId* id, int64_t* version);
 std::string encode_del_vector_key(TTabletId tablet_id, uint32_t segment_id, int64_t version);
 void decode_del_vector_key(std::string_view enc_key, TTabletId* tablet_id, uint32_t* segment_id, int64_t* version);
+std::string encode_delta_column_group_key(TTabletId tablet_id, uint32_t segment_id, int64_t version);
 std::string encode_persistent_index_key(TTabletId tablet_id);
 void decode_persistent_index_key(std::string_view enc_key, TTabletId* tablet_id);
 
@@ -668,6 +670,18 @@ void decode_del_vector_key(std::string_view enc_key, TTabletId* tablet_id, uint3
     *version = INT64_MAX - BigEndian::ToHost64(UNALIGNED_LOAD64(enc_key.data() + 16));
 }
 
+// Same layout as the key of delete vector.
+std::string encode_delta_column_group_key(TTabletId tablet_id, uint32_t segment_id, int64_t version) {
+    std::string key;
+    key.reserve(24);
+    key.append(TABLET_DELTA_COLUMN_GROUP_PREFIX);
+    put_fixed64_le(&key, BigEndian::FromHost64(tablet_id));
+    put_fixed32_le(&key, BigEndian::FromHost32(segment_id));
+    int64_t v = std::numeric_limits<int64_t>::max() - version;
+    put_fixed64_le(&key, BigEndian::FromHost64(v));
+    return key;
+}
+
 std::string encode_persistent_index_key(TTabletId tablet_id) {
     std::string key;
     key.reserve(TABLET_PERSISTENT_INDEX_META_PREFIX.length() + sizeof(uint64_t));
@@ -776,6 +790,12 @@ Status TabletMetaManager::rowset_delete(DataDir* store, TTabletId tablet_id, uin
         if (UNLIKELY(!st.ok())) {
             return Status::InternalError("remove delete vector failed");
         }
+        lower = encode_delta_column_group_key(tablet_id, rowset_id + 0, INT64_MAX);
+        upper = encode_delta_column_group_key(tablet_id, rowset_id + segments, INT64_MAX);
+        st = batch.DeleteRange(cf_meta, lower, upper);
+        if (UNLIKELY(!st.ok())) {
+            return Status::InternalError("remove delta column group failed");
+        }
     }
     return meta->write_batch(&batch);
 }
@@ -797,7 +817,9 @@ Status TabletMetaManager::rowset_iterate(DataDir* store, TTabletId tablet_id, co
 Status TabletMetaManager::apply_rowset_commit(DataDir* store, TTabletId tablet_id, int64_t logid,
                                               const EditVersion& version,
                                               vector<std::pair<uint32_t, DelVectorPtr>>& delvecs,
-                                              const PersistentIndexMetaPB& index_meta, bool enable_persistent_index) {
+                                              const vector<std::pair<uint32_t, DeltaColumnGroupPB>>& dcgs,
+                                              const PersistentIndexMetaPB& index_meta, bool enable_persistent_index,
+                                              const RowsetMetaPB* rowset_meta) {
     WriteBatch batch;
     auto handle = store->get_meta()->handle(META_COLUMN_FAMILY_INDEX);
     string logkey = encode_meta_log_key(tablet_id, logid);
@@ -825,6 +847,22 @@ Status TabletMetaManager::apply_rowset_commit(DataDir* store, TTabletId tablet_i
             return to_status(st);
         }
     }
+    for (const auto& [rssid, dcg] : dcgs) {
+        auto dcg_key = encode_delta_column_group_key(tablet_id, rssid, dcg.version());
+        st = batch.Put(handle, dcg_key, dcg.SerializeAsString());
+        if (!st.ok()) {
+            LOG(WARNING) << "rowset_commit failed, rocksdb.batch.put failed";
+            return to_status(st);
+        }
+    }
+    if (rowset_meta != nullptr) {
+        auto rowset_key = encode_meta_rowset_key(tablet_id, rowset_meta->rowset_seg_id());
+        st = batch.Put(handle, rowset_key, rowset_meta->SerializeAsString());
+        if (!st.ok()) {
+            LOG(WARNING) << "rowset_commit failed, rocksdb.batch.put failed";
+            return to_status(st);
+        }
+    }
 
     if (enable_persistent_index) {
         auto meta_key = encode_persistent_index_key(tsid.tablet_id);
@@ -958,6 +996,29 @@ Status TabletMetaManager::delete_del_vector_range(KVStore* meta, TTabletId table
     return meta->write_batch(&batch);
 }
 
+Status TabletMetaManager::get_delta_column_groups(KVStore* meta, TTabletId tablet_id, uint32_t segment_id,
+                                                  int64_t version, DeltaColumnGroupList* dcgs) {
+    std::string lower = encode_delta_column_group_key(tablet_id, segment_id, version);
+    std::string upper = encode_delta_column_group_key(tablet_id, segment_id, 0);
+    Status ret;
+    auto st = meta->iterate_range(META_COLUMN_FAMILY_INDEX, lower, upper,
+                                  [&](std::string_view key, std::string_view value) -> bool {
+                                      DeltaColumnGroupPB dcg;
+                                      if (!dcg.ParseFromArray(value.data(), value.size())) {
+                                          ret = Status::Corruption("corrupted value of delta column group");
+                                          return false;
+                                      }
+                                      dcgs->emplace_back(std::move(dcg));
+                                      return true;
+                                  });
+    if (!st.ok()) {
+        LOG(WARNING) << "fail to iterate rocksdb delta column groups. tablet_id=" << tablet_id
+                     << " segment_id=" << segment_id << " error_code=" << st.to_string();
+        return st;
+    }
+    return ret;
+}
+
 Status TabletMetaManager::put_rowset_meta(DataDir* store, WriteBatch* batch, TTabletId tablet_id,
                                           const RowsetMetaPB& rowset_meta) {
     auto h = store->get_meta()->handle(META_COLUMN_FAMILY_INDEX);
@@ -1002,6 +1063,13 @@ Status TabletMetaManager::clear_del_vector(DataDir* store, WriteBatch* batch, TT
     return to_status(batch->DeleteRange(h, lower, upper));
 }
 
+Status TabletMetaManager::clear_delta_column_group(DataDir* store, WriteBatch* batch, TTabletId tablet_id) {
+    auto lower = encode_delta_column_group_key(tablet_id, 0, INT64_MAX);
+    auto upper = encode_delta_column_group_key(tablet_id, UINT32_MAX, INT64_MAX);
+    auto h = store->get_meta()->handle(META_COLUMN_FAMILY_INDEX);
+    return to_status(batch->DeleteRange(h, lower, upper));
+}
+
 Status TabletMetaManager::remove_tablet_meta(DataDir* store, WriteBatch* batch, TTabletId tablet_id,
                                              TSchemaHash schema_hash) {
     auto k = encode_tablet_meta_key(tablet_id, schema_hash);
@@ -1201,6 +1269,9 @@ Status TabletMetaManager::remove(DataDir* store, TTabletId tablet_id) {
         if (!clear_del_vector(store, &batch, tablet_id).ok()) {
             LOG(WARNING) << "clear delvec add to batch failed";
         }
+        if (!clear_delta_column_group(store, &batch, tablet_id).ok()) {
+            LOG(WARNING) << "clear delta column group add to batch failed";
+        }
         if (!clear_rowset(store, &batch, tablet_id).ok()) {
             LOG(WARNING) << "clear rowset add to batch failed";
         }
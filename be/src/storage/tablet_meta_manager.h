@@ -27,6 +27,7 @@
 #include "storage/data_dir.h"
 #include "storage/kv_store.h"
 #include "storage/olap_define.h"
+#include "storage/rowset/delta_column_group.h"
 #include "storage/tablet_meta.h"
 
 namespace starrocks {
@@ -138,13 +139,17 @@ public:
     // Remove rowset meta from |store|, leave tablet meta unchanged.
     // |rowset_id| is the value returned from `RowsetMeta::get_rowset_seg_id`.
     // |segments| is the number of segments in the rowset, i.e, `Rowset::num_segments`.
-    // All delete vectors that associated with this rowset will be deleted too.
+    // All delete vectors and delta column groups that associated with this rowset will be deleted too.
     static Status rowset_delete(DataDir* store, TTabletId tablet_id, uint32_t rowset_id, uint32_t segments);
 
     // update meta after state of a rowset commit is applied
+    // |dcgs| are the delta column groups written by the apply, the first element of pair is segment id.
+    // |rowset_meta| is the new meta of the applied rowset if it is changed by the apply, or nullptr.
     static Status apply_rowset_commit(DataDir* store, TTabletId tablet_id, int64_t logid, const EditVersion& version,
                                       std::vector<std::pair<uint32_t, DelVectorPtr>>& delvecs,
-                                      const PersistentIndexMetaPB& index_meta, bool enable_persistent_index);
+                                      const std::vector<std::pair<uint32_t, DeltaColumnGroupPB>>& dcgs,
+                                      const PersistentIndexMetaPB& index_meta, bool enable_persistent_index,
+                                      const RowsetMetaPB* rowset_meta);
 
     // traverse all the op logs for a tablet
     static Status traverse_meta_logs(DataDir* store, TTabletId tablet_id,
@@ -165,6 +170,10 @@ public:
     static Status delete_del_vector_range(KVStore* meta, TTabletId tablet_id, uint32_t segment_id,
                                           int64_t start_version, int64_t end_version);
 
+    // Get the delta column groups of |segment_id| whose versions are not greater than |version|, newest first.
+    static Status get_delta_column_groups(KVStore* meta, TTabletId tablet_id, uint32_t segment_id, int64_t version,
+                                          DeltaColumnGroupList* dcgs);
+
     static Status put_rowset_meta(DataDir* store, WriteBatch* batch, TTabletId tablet_id,
                                   const RowsetMetaPB& rowset_meta);
 
@@ -184,6 +193,8 @@ public:
 
     static Status clear_del_vector(DataDir* store, WriteBatch* batch, TTabletId tablet_id);
 
+    static Status clear_delta_column_group(DataDir* store, WriteBatch* batch, TTabletId tablet_id);
+
     static Status remove_tablet_meta(DataDir* store, WriteBatch* batch, TTabletId tablet_id, TSchemaHash schema_hash);
 };
 
@@ -29,6 +29,16 @@ TabletReader::TabletReader(TabletSharedPtr tablet, const Version& version, Schem
           _delete_predicates_version(version),
           _is_vertical_merge(false) {}
 
+TabletReader::TabletReader(TabletSharedPtr tablet, const Version& version, Schema schema,
+                           std::vector<RowsetSharedPtr> captured_rowsets)
+        : ChunkIterator(std::move(schema)),
+          _tablet(tablet),
+          _version(version),
+          _delete_predicates_version(version),
+          _rowsets(std::move(captured_rowsets)),
+          _is_rowsets_captured(true),
+          _is_vertical_merge(false) {}
+
 TabletReader::TabletReader(TabletSharedPtr tablet, const Version& version, Schema schema, bool is_key,
                            RowSourceMaskBuffer* mask_buffer)
         : ChunkIterator(std::move(schema)),
@@ -53,14 +63,17 @@ void TabletReader::close() {
 }
 
 Status TabletReader::prepare() {
-    std::shared_lock l(_tablet->get_header_lock());
-    auto st = _tablet->capture_consistent_rowsets(_version, &_rowsets);
-    if (!st.ok()) {
-        _rowsets.clear();
-        std::stringstream ss;
-        ss << "fail to init reader. tablet=" << _tablet->full_name() << "res=" << st;
-        LOG(WARNING) << ss.str();
-        return Status::InternalError(ss.str().c_str());
+    Status st;
+    if (!_is_rowsets_captured) {
+        std::shared_lock l(_tablet->get_header_lock());
+        st = _tablet->capture_consistent_rowsets(_version, &_rowsets);
+        if (!st.ok()) {
+            _rowsets.clear();
+            std::stringstream ss;
+            ss << "fail to init reader. tablet=" << _tablet->full_name() << "res=" << st;
+            LOG(WARNING) << ss.str();
+            return Status::InternalError(ss.str().c_str());
+        }
     }
     _stats.rowsets_read_count += _rowsets.size();
     Rowset::acquire_readers(_rowsets);
@@ -76,6 +89,9 @@ Status TabletReader::open(const TabletReaderParams& read_params) {
         read_params.reader_type != ReaderType::READER_ALTER_TABLE && !is_compaction(read_params.reader_type)) {
         return Status::NotSupported("reader type not supported now");
     }
+    if (read_params.reader_type == ReaderType::READER_QUERY) {
+        _tablet->increase_query_count();
+    }
     Status st = _init_collector(read_params);
     return st;
 }
@@ -98,7 +114,11 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     RETURN_IF_ERROR(_init_predicates(params));
     RETURN_IF_ERROR(_init_delete_predicates(params, &_delete_predicates));
     RETURN_IF_ERROR(_parse_seek_range(params, &rs_opts.ranges));
+    rs_opts.rowid_range_option = params.rowid_range_option;
+    rs_opts.global_rowid_fetcher = params.global_rowid_fetcher;
+    rs_opts.global_rowid_column_id = params.global_rowid_column_id;
     rs_opts.predicates = _pushdown_predicates;
+    rs_opts.runtime_range_pruner = params.runtime_range_pruner;
     RETURN_IF_ERROR(ZonemapPredicatesRewriter::rewrite_predicate_map(&_obj_pool, rs_opts.predicates,
                                                                      &rs_opts.predicates_for_zone_map));
     rs_opts.sorted = (keys_type != DUP_KEYS && keys_type != PRIMARY_KEYS) && !params.skip_aggregation;
@@ -109,6 +129,8 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
     rs_opts.runtime_state = params.runtime_state;
     rs_opts.profile = params.profile;
     rs_opts.use_page_cache = params.use_page_cache;
+    rs_opts.fill_page_cache = params.fill_page_cache;
+    rs_opts.readahead_bytes = params.readahead_bytes;
     rs_opts.tablet_schema = &_tablet->tablet_schema();
     rs_opts.global_dictmaps = params.global_dictmaps;
     rs_opts.unused_output_column_ids = params.unused_output_column_ids;
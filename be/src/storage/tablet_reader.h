@@ -21,6 +21,10 @@ class RowsetReadOptions;
 class TabletReader final : public ChunkIterator {
 public:
     TabletReader(TabletSharedPtr tablet, const Version& version, Schema schema);
+    // Read |captured_rowsets| instead of capturing the rowsets of |version| in prepare(),
+    // which must be the consistent rowsets of |version|.
+    TabletReader(TabletSharedPtr tablet, const Version& version, Schema schema,
+                 std::vector<RowsetSharedPtr> captured_rowsets);
     TabletReader(TabletSharedPtr tablet, const Version& version, Schema schema, bool is_key,
                  RowSourceMaskBuffer* mask_buffer);
     ~TabletReader() override { close(); }
@@ -32,6 +36,9 @@ public:
 
     void close() override;
 
+    // The rowsets to read, valid after prepare().
+    const std::vector<RowsetSharedPtr>& rowsets() const { return _rowsets; }
+
     const OlapReaderStatistics& stats() const { return _stats; }
     OlapReaderStatistics* mutable_stats() { return &_stats; }
 
@@ -69,6 +76,7 @@ private:
     PredicateList _predicate_free_list;
 
     std::vector<RowsetSharedPtr> _rowsets;
+    bool _is_rowsets_captured = false;
     std::shared_ptr<ChunkIterator> _collect_iter;
 
     OlapReaderStatistics _stats;
@@ -19,6 +19,9 @@ class RuntimeState;
 namespace vectorized {
 
 class ColumnPredicate;
+class RowidRangeOption;
+class RuntimeRangePruner;
+class SegmentRowFetcher;
 
 static inline std::unordered_set<uint32_t> EMPTY_FILTERED_COLUMN_IDS;
 
@@ -37,6 +40,12 @@ struct TabletReaderParams {
     // 2. when read column index page
     //     if config::disable_storage_page_cache is false, we use page cache
     bool use_page_cache = false;
+    // Whether to insert the pages read into the page cache, it's false for the large scans,
+    // which only look up the page cache. Only takes effect when use_page_cache is true.
+    bool fill_page_cache = true;
+    // The window bytes of the data page readahead of segment iterators, 0 means disabled.
+    // It only takes effect when the page cache is not used.
+    int64_t readahead_bytes = 0;
 
     // possible values are "gt", "ge", "eq"
     std::string range;
@@ -45,6 +54,19 @@ struct TabletReaderParams {
     std::vector<OlapTuple> start_key;
     std::vector<OlapTuple> end_key;
     std::vector<const ColumnPredicate*> predicates;
+    // If not null, the predicates added to it after the reader is opened are used to prune the rows
+    // not read yet by the indexes, e.g. the min/max values of the late-arriving join runtime filters.
+    const RuntimeRangePruner* runtime_range_pruner = nullptr;
+
+    // If not null, only the segments and rows selected by it are read.
+    // It must not be used when the rows of different segments need to be merged, e.g. for aggregation.
+    const RowidRangeOption* rowid_range_option = nullptr;
+
+    // If not null, the segments read are registered in it, and the last field of the read schema, whose id
+    // is |global_rowid_column_id|, is filled with the global row ids for the late materialization.
+    // It must not be used when the rows of different segments need to be merged, e.g. for aggregation.
+    SegmentRowFetcher* global_rowid_fetcher = nullptr;
+    ColumnId global_rowid_column_id = 0;
 
     RuntimeState* runtime_state = nullptr;
 
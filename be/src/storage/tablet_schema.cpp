@@ -323,6 +323,7 @@ void TabletColumn::init_from_pb(const ColumnPB& column) {
     _set_flag(kHasBitmapIndexShift, column.has_bitmap_index());
     _set_flag(kHasPrecisionShift, column.has_precision());
     _set_flag(kHasScaleShift, column.has_frac());
+    _set_flag(kHasNGramIndexShift, column.has_ngram_index());
 
     _length = column.length();
 
@@ -374,6 +375,9 @@ void TabletColumn::to_schema_pb(ColumnPB* column) const {
     column->set_is_bf_column(is_bf_column());
     column->set_aggregation(get_string_by_aggregation_type(_aggregation));
     column->set_has_bitmap_index(has_bitmap_index());
+    if (has_ngram_index()) {
+        column->set_has_ngram_index(true);
+    }
     for (int i = 0; i < subcolumn_count(); i++) {
         subcolumn(i).to_schema_pb(column->add_children_columns());
     }
@@ -597,7 +601,7 @@ std::string TabletColumn::debug_string() const {
        << ",precision=" << (has_precision() ? std::to_string(_precision) : "N/A")
        << ",frac=" << (has_scale() ? std::to_string(_scale) : "N/A") << ",length=" << _length
        << ",index_length=" << _index_length << ",is_bf_column=" << is_bf_column()
-       << ",has_bitmap_index=" << has_bitmap_index() << ")";
+       << ",has_bitmap_index=" << has_bitmap_index() << ",has_ngram_index=" << has_ngram_index() << ")";
     return ss.str();
 }
 
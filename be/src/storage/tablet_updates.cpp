@@ -20,6 +20,7 @@
 #include "storage/compaction_utils.h"
 #include "storage/del_vector.h"
 #include "storage/rowset/default_value_column_iterator.h"
+#include "storage/rowset/delta_column_group.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_meta_manager.h"
 #include "storage/rowset/rowset_options.h"
@@ -724,10 +725,35 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
         return;
     }
 
+    // A column mode partial update updates the existing segments in place, which would be lost by a compaction
+    // of them in progress, so fall back to row mode if a compaction is running or waiting to be applied.
+    bool column_mode = false;
+    bool was_running = false;
+    if (state.is_column_mode() && _compaction_running.compare_exchange_strong(was_running, true)) {
+        column_mode = true;
+        std::lock_guard rl(_lock);
+        for (size_t i = _apply_version_idx + 1; i < _edit_version_infos.size(); i++) {
+            if (_edit_version_infos[i]->compaction) {
+                column_mode = false;
+                _compaction_running = false;
+                break;
+            }
+        }
+    }
+    DeferOp reset_compaction_running([&] {
+        if (column_mode) {
+            _compaction_running = false;
+        }
+    });
+
     int64_t t_load = MonotonicMillis();
     EditVersion latest_applied_version;
     get_latest_applied_version(&latest_applied_version);
-    st = state.apply(&_tablet, rowset.get(), rowset_id, latest_applied_version, index);
+    if (column_mode) {
+        st = state.apply_column_mode(&_tablet, rowset.get(), rowset_id, version, index);
+    } else {
+        st = state.apply(&_tablet, rowset.get(), rowset_id, latest_applied_version, index);
+    }
     if (!st.ok()) {
         manager->update_state_cache().remove(state_entry);
         std::string msg = Substitute("_apply_rowset_commit error: apply rowset update state failed: $0 $1",
@@ -747,10 +773,40 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
     }
     index.prepare(version);
     auto& upserts = state.upserts();
-    for (uint32_t i = 0; i < upserts.size(); i++) {
-        if (upserts[i] != nullptr) {
-            index.upsert(rowset_id + i, 0, *upserts[i], &new_deletes);
-            manager->index_cache().update_object_size(index_entry, index.memory_usage());
+    vector<std::pair<uint32_t, DeltaColumnGroupPB>> new_dcgs;
+    if (column_mode) {
+        // only the new rows are inserted into the index, and the others are updated in the delta column groups
+        // of their segments, so they are deleted from the rowset
+        const auto& updated_idxes = state.column_mode_rowids();
+        vector<uint32_t> insert_rowids;
+        insert_rowids.reserve(upserts[0]->size() - updated_idxes.size());
+        for (uint32_t i = 0, j = 0; i < upserts[0]->size(); i++) {
+            if (j < updated_idxes.size() && updated_idxes[j] == i) {
+                j++;
+            } else {
+                insert_rowids.push_back(i);
+            }
+        }
+        auto insert_pks = upserts[0]->clone_empty();
+        insert_pks->append_selective(*upserts[0], insert_rowids.data(), 0, insert_rowids.size());
+        st = index.insert(rowset_id, insert_rowids, *insert_pks);
+        if (!st.ok()) {
+            manager->update_state_cache().remove(state_entry);
+            std::string msg = Substitute("_apply_rowset_commit error: insert into primary index failed: $0 $1",
+                                         st.to_string(), debug_string());
+            LOG(ERROR) << msg;
+            _set_error(msg);
+            return;
+        }
+        manager->index_cache().update_object_size(index_entry, index.memory_usage());
+        new_deletes[rowset_id] = updated_idxes;
+        new_dcgs = state.delta_column_groups();
+    } else {
+        for (uint32_t i = 0; i < upserts.size(); i++) {
+            if (upserts[i] != nullptr) {
+                index.upsert(rowset_id + i, 0, *upserts[i], &new_deletes);
+                manager->index_cache().update_object_size(index_entry, index.memory_usage());
+            }
         }
     }
 
@@ -866,8 +922,10 @@ void TabletUpdates::_apply_rowset_commit(const EditVersionInfo& version_info) {
     {
         std::lock_guard wl(_lock);
         // 4. write meta
-        st = TabletMetaManager::apply_rowset_commit(_tablet.data_dir(), tablet_id, _next_log_id, version, new_del_vecs,
-                                                    index_meta, _tablet.get_enable_persistent_index());
+        // the rowset meta without the txn meta is saved along with the delta column groups in column mode
+        st = TabletMetaManager::apply_rowset_commit(
+                _tablet.data_dir(), tablet_id, _next_log_id, version, new_del_vecs, new_dcgs, index_meta,
+                _tablet.get_enable_persistent_index(), column_mode ? &rowset->rowset_meta()->get_meta_pb() : nullptr);
         if (!st.ok()) {
             std::string msg = Substitute("_apply_rowset_commit error: write meta failed: $0 $1", st.to_string(),
                                          _debug_string(false));
@@ -931,6 +989,11 @@ RowsetSharedPtr TabletUpdates::_get_rowset(uint32_t rowset_id) {
 
 Status TabletUpdates::_wait_for_version(const EditVersion& version, int64_t timeout_ms) {
     std::unique_lock<std::mutex> ul(_lock);
+    return _wait_for_version(version, timeout_ms, ul);
+}
+
+Status TabletUpdates::_wait_for_version(const EditVersion& version, int64_t timeout_ms,
+                                        std::unique_lock<std::mutex>& ul) {
     if (!(_edit_version_infos[_apply_version_idx]->version < version)) {
         return Status::OK();
     }
@@ -1246,7 +1309,8 @@ void TabletUpdates::_apply_compaction_commit(const EditVersionInfo& version_info
         std::lock_guard wl(_lock);
         // 3. write meta
         st = TabletMetaManager::apply_rowset_commit(_tablet.data_dir(), tablet_id, _next_log_id, version_info.version,
-                                                    delvecs, index_meta, _tablet.get_enable_persistent_index());
+                                                    delvecs, {}, index_meta, _tablet.get_enable_persistent_index(),
+                                                    nullptr);
         if (!st.ok()) {
             manager->index_cache().release(index_entry);
             std::string msg = Substitute("_apply_compaction_commit error: write meta failed: $0 $1", st.to_string(),
@@ -1888,9 +1952,8 @@ Status TabletUpdates::get_applied_rowsets(int64_t version, std::vector<RowsetSha
                 Substitute("get_applied_rowsets failed, tablet updates is in error state: tablet:$0 $1",
                            _tablet.tablet_id(), _error_msg));
     }
-    // TODO(cbl): optimize: following code lock _lock twice, should make it just lock once
-    RETURN_IF_ERROR(_wait_for_version(EditVersion(version, 0), 60000));
-    std::lock_guard rl(_lock);
+    std::unique_lock<std::mutex> ul(_lock);
+    RETURN_IF_ERROR(_wait_for_version(EditVersion(version, 0), 60000, ul));
     for (ssize_t i = _apply_version_idx; i >= 0; i--) {
         const auto& edit_version_info = _edit_version_infos[i];
         if (edit_version_info->version.major() == version) {
@@ -2017,6 +2080,7 @@ Status TabletUpdates::link_from(Tablet* base_tablet, int64_t request_version) {
     RETURN_IF_ERROR(TabletMetaManager::clear_rowset(data_dir, &wb, tablet_id));
     RETURN_IF_ERROR(TabletMetaManager::clear_pending_rowset(data_dir, &wb, tablet_id));
     RETURN_IF_ERROR(TabletMetaManager::clear_del_vector(data_dir, &wb, tablet_id));
+    RETURN_IF_ERROR(TabletMetaManager::clear_delta_column_group(data_dir, &wb, tablet_id));
     RETURN_IF_ERROR(TabletMetaManager::put_tablet_meta(data_dir, &wb, meta_pb));
     for (auto& info : new_rowsets) {
         RETURN_IF_ERROR(TabletMetaManager::put_rowset_meta(data_dir, &wb, tablet_id, info.rowset_meta_pb));
@@ -2169,6 +2233,7 @@ Status TabletUpdates::convert_from(const std::shared_ptr<Tablet>& base_tablet, i
     RETURN_IF_ERROR(TabletMetaManager::clear_rowset(data_dir, &wb, tablet_id));
     RETURN_IF_ERROR(TabletMetaManager::clear_pending_rowset(data_dir, &wb, tablet_id));
     RETURN_IF_ERROR(TabletMetaManager::clear_del_vector(data_dir, &wb, tablet_id));
+    RETURN_IF_ERROR(TabletMetaManager::clear_delta_column_group(data_dir, &wb, tablet_id));
     RETURN_IF_ERROR(TabletMetaManager::put_tablet_meta(data_dir, &wb, meta_pb));
     DelVector delvec;
     for (const auto& new_rowset_load_info : new_rowset_load_infos) {
@@ -2258,8 +2323,27 @@ void TabletUpdates::_remove_unused_rowsets() {
 
         _clear_rowset_del_vec_cache(*rowset);
 
-        Status st =
-                TabletMetaManager::rowset_delete(_tablet.data_dir(), _tablet.tablet_id(),
+        // The delta column files are not tracked by the rowset, so collect them before the meta is deleted.
+        std::vector<std::string> dcg_files;
+        Status st;
+        for (uint32_t i = 0; st.ok() && i < rowset->num_segments(); i++) {
+            DeltaColumnGroupList dcgs;
+            st = TabletMetaManager::get_delta_column_groups(_tablet.data_dir()->get_meta(), _tablet.tablet_id(),
+                                                            rowset->rowset_meta()->get_rowset_seg_id() + i,
+                                                            INT64_MAX, &dcgs);
+            auto seg_path = BetaRowset::segment_file_path(rowset->rowset_path(), rowset->rowset_id(), i);
+            for (const auto& dcg : dcgs) {
+                dcg_files.emplace_back(delta_column_file_path(seg_path, dcg));
+            }
+        }
+        if (!st.ok()) {
+            LOG(WARNING) << "Fail to get delta column groups of rowset " << rowset->rowset_id() << ": " << st
+                         << " tablet:" << _tablet.tablet_id();
+            skipped_rowsets.emplace_back(std::move(rowset));
+            continue;
+        }
+
+        st = TabletMetaManager::rowset_delete(_tablet.data_dir(), _tablet.tablet_id(),
                                                  rowset->rowset_meta()->get_rowset_seg_id(), rowset->num_segments());
         if (!st.ok()) {
             LOG(WARNING) << "Fail to delete rowset " << rowset->rowset_id() << ": " << st
@@ -2270,6 +2354,10 @@ void TabletUpdates::_remove_unused_rowsets() {
         rowset->close();
         rowset->set_need_delete_file();
         auto ost = rowset->remove();
+        for (const auto& path : dcg_files) {
+            auto dst = Env::Default()->delete_file(path);
+            LOG_IF(WARNING, !dst.ok()) << "Fail to delete " << path << ": " << dst;
+        }
         VLOG(1) << "remove rowset " << _tablet.tablet_id() << "@" << rowset->rowset_meta()->get_rowset_seg_id() << "@"
                 << rowset->rowset_id() << ": " << ost << " tablet:" << _tablet.tablet_id();
         removed++;
@@ -2552,6 +2640,7 @@ Status TabletUpdates::clear_meta() {
     TabletMetaManager::clear_pending_rowset(data_store, &wb, _tablet.tablet_id());
     TabletMetaManager::clear_rowset(data_store, &wb, _tablet.tablet_id());
     TabletMetaManager::clear_del_vector(data_store, &wb, _tablet.tablet_id());
+    TabletMetaManager::clear_delta_column_group(data_store, &wb, _tablet.tablet_id());
     TabletMetaManager::clear_log(data_store, &wb, _tablet.tablet_id());
     TabletMetaManager::remove_tablet_meta(data_store, &wb, _tablet.tablet_id(), _tablet.schema_hash());
     RETURN_IF_ERROR(meta_store->write_batch(&wb));
@@ -2632,7 +2721,7 @@ Status TabletUpdates::get_column_values(std::vector<uint32_t>& column_ids, bool
         }
         std::string seg_path =
                 BetaRowset::segment_file_path(rowset->rowset_path(), rowset->rowset_id(), rssid - iter->first);
-        auto segment = Segment::open(ExecEnv::GetInstance()->tablet_meta_mem_tracker(), block_mgr, seg_path,
+        auto segment = Segment::open(ExecEnv::GetInstance()->segment_mem_tracker(), block_mgr, seg_path,
                                      rssid - iter->first, &rowset->schema());
         if (!segment.ok()) {
             LOG(WARNING) << "Fail to open " << seg_path << ": " << segment.status();
@@ -2641,15 +2730,34 @@ Status TabletUpdates::get_column_values(std::vector<uint32_t>& column_ids, bool
         if ((*segment)->num_rows() == 0) {
             continue;
         }
+        // The columns updated by column mode partial updates are read from the newest delta column groups.
+        DeltaColumnGroupList dcgs;
+        RETURN_IF_ERROR(TabletMetaManager::get_delta_column_groups(_tablet.data_dir()->get_meta(), _tablet.tablet_id(),
+                                                                   rssid, INT64_MAX, &dcgs));
+        std::vector<std::shared_ptr<Segment>> dcg_segments(dcgs.size());
+        std::vector<std::unique_ptr<fs::ReadableBlock>> dcg_rblocks(dcgs.size());
         ColumnIteratorOptions iter_opts;
         OlapReaderStatistics stats;
         iter_opts.stats = &stats;
         std::unique_ptr<fs::ReadableBlock> rblock;
         RETURN_IF_ERROR(block_mgr->open_block((*segment)->file_name(), &rblock));
-        iter_opts.rblock = rblock.get();
         for (auto i = 0; i < column_ids.size(); ++i) {
+            Segment* column_segment = segment->get();
+            iter_opts.rblock = rblock.get();
+            int dcg_idx = find_delta_column_group(dcgs, column_ids[i]);
+            if (dcg_idx >= 0) {
+                if (dcg_segments[dcg_idx] == nullptr) {
+                    std::string dcg_path = delta_column_file_path(seg_path, dcgs[dcg_idx]);
+                    ASSIGN_OR_RETURN(dcg_segments[dcg_idx],
+                                     Segment::open(ExecEnv::GetInstance()->segment_mem_tracker(), block_mgr,
+                                                   dcg_path, rssid - iter->first, &rowset->schema()));
+                    RETURN_IF_ERROR(block_mgr->open_block(dcg_path, &dcg_rblocks[dcg_idx]));
+                }
+                column_segment = dcg_segments[dcg_idx].get();
+                iter_opts.rblock = dcg_rblocks[dcg_idx].get();
+            }
             ColumnIterator* col_iter_raw_ptr = nullptr;
-            RETURN_IF_ERROR((*segment)->new_column_iterator(column_ids[i], &col_iter_raw_ptr));
+            RETURN_IF_ERROR(column_segment->new_column_iterator(column_ids[i], &col_iter_raw_ptr));
             std::unique_ptr<ColumnIterator> col_iter(col_iter_raw_ptr);
             RETURN_IF_ERROR(col_iter->init(iter_opts));
             RETURN_IF_ERROR(col_iter->fetch_values_by_rowid(rowids.data(), rowids.size(), (*columns)[i].get()));
@@ -2658,6 +2766,38 @@ Status TabletUpdates::get_column_values(std::vector<uint32_t>& column_ids, bool
     return Status::OK();
 }
 
+Status TabletUpdates::write_delta_column_group(uint32_t rssid, int64_t version, const std::vector<uint32_t>& column_ids,
+                                               const std::vector<uint32_t>& rowids, const vectorized::Chunk& values,
+                                               DeltaColumnGroupPB* dcg) {
+    RowsetSharedPtr rowset;
+    uint32_t rowset_seg_id = 0;
+    {
+        std::lock_guard<std::mutex> l(_rowsets_lock);
+        for (const auto& [id, r] : _rowsets) {
+            if (id <= rssid && rssid < id + r->num_segments()) {
+                rowset_seg_id = id;
+                rowset = r;
+                break;
+            }
+        }
+    }
+    if (rowset == nullptr) {
+        std::string msg = Substitute("write_delta_column_group error: rssid $0 not found, tablet:$1", rssid,
+                                     _tablet.tablet_id());
+        LOG(ERROR) << msg;
+        return Status::InternalError(msg);
+    }
+    ASSIGN_OR_RETURN(auto block_mgr, fs::fs_util::block_manager(rowset->rowset_path()));
+    std::string seg_path =
+            BetaRowset::segment_file_path(rowset->rowset_path(), rowset->rowset_id(), rssid - rowset_seg_id);
+    ASSIGN_OR_RETURN(auto segment, Segment::open(ExecEnv::GetInstance()->segment_mem_tracker(), block_mgr,
+                                                 seg_path, rssid - rowset_seg_id, &rowset->schema()));
+    DeltaColumnGroupList dcgs;
+    RETURN_IF_ERROR(TabletMetaManager::get_delta_column_groups(_tablet.data_dir()->get_meta(), _tablet.tablet_id(),
+                                                               rssid, INT64_MAX, &dcgs));
+    return DeltaColumnGroupWriter::write(block_mgr, segment, dcgs, version, column_ids, rowids, values, dcg);
+}
+
 Status TabletUpdates::prepare_partial_update_states(Tablet* tablet, const std::vector<ColumnUniquePtr>& upserts,
                                                     EditVersion* read_version, uint32_t* next_rowset_id,
                                                     std::vector<std::vector<uint64_t>*>* rss_rowids) {
@@ -2703,4 +2843,72 @@ Status TabletUpdates::prepare_partial_update_states(Tablet* tablet, const std::v
     return Status::OK();
 }
 
+Status TabletUpdates::get_rows_by_keys(const vectorized::Column& keys, std::vector<uint32_t>& column_ids,
+                                       std::vector<bool>* found,
+                                       vector<std::unique_ptr<vectorized::Column>>* columns) {
+    if (_error) {
+        return Status::InternalError(
+                Substitute("get_rows_by_keys failed, tablet updates is in error state: tablet:$0 $1",
+                           _tablet.tablet_id(), _error_msg));
+    }
+    // Hold _index_lock so that no rowset commit is applied between the lookup and the reading.
+    std::lock_guard lg(_index_lock);
+    auto manager = StorageEngine::instance()->update_manager();
+    auto index_entry = manager->index_cache().get_or_create(_tablet.tablet_id());
+    index_entry->update_expire_time(MonotonicMillis() + manager->get_cache_expire_ms());
+    auto& index = index_entry->value();
+    auto st = index.load(&_tablet);
+    manager->index_cache().update_object_size(index_entry, index.memory_usage());
+    if (!st.ok()) {
+        manager->index_cache().remove(index_entry);
+        LOG(WARNING) << "get_rows_by_keys error: load primary index failed: " << st << " " << debug_string();
+        return st;
+    }
+    std::vector<uint64_t> rss_rowids(keys.size());
+    index.get(keys, &rss_rowids);
+    manager->index_cache().release(index_entry);
+
+    // get_column_values() returns the rows ordered by (rssid, rowid), |positions| maps them back to the order
+    // of |keys|.
+    std::map<uint32_t, std::vector<std::pair<uint32_t, uint32_t>>> rowid_and_index_by_rssid;
+    found->assign(keys.size(), false);
+    for (uint32_t i = 0; i < keys.size(); i++) {
+        if (rss_rowids[i] != NullIndexValue) {
+            (*found)[i] = true;
+            rowid_and_index_by_rssid[rss_rowids[i] >> 32].emplace_back(rss_rowids[i] & ROWID_MASK, i);
+        }
+    }
+    if (rowid_and_index_by_rssid.empty()) {
+        return Status::OK();
+    }
+    std::map<uint32_t, std::vector<uint32_t>> rowids_by_rssid;
+    std::vector<uint32_t> position_by_index(keys.size());
+    uint32_t num_rows = 0;
+    for (auto& [rssid, rowid_and_index] : rowid_and_index_by_rssid) {
+        std::sort(rowid_and_index.begin(), rowid_and_index.end());
+        auto& rowids = rowids_by_rssid[rssid];
+        for (const auto& [rowid, index] : rowid_and_index) {
+            rowids.push_back(rowid);
+            position_by_index[index] = num_rows++;
+        }
+    }
+    std::vector<uint32_t> positions;
+    positions.reserve(num_rows);
+    for (size_t i = 0; i < keys.size(); i++) {
+        if ((*found)[i]) {
+            positions.push_back(position_by_index[i]);
+        }
+    }
+
+    vector<std::unique_ptr<vectorized::Column>> values(columns->size());
+    for (size_t i = 0; i < columns->size(); i++) {
+        values[i] = (*columns)[i]->clone_empty();
+    }
+    RETURN_IF_ERROR(get_column_values(column_ids, false, rowids_by_rssid, &values));
+    for (size_t i = 0; i < columns->size(); i++) {
+        (*columns)[i]->append_selective(*values[i], positions.data(), 0, positions.size());
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -29,6 +29,7 @@ class Tablet;
 class TTabletInfo;
 
 namespace vectorized {
+class Chunk;
 class ChunkIterator;
 class CompactionState;
 class RowsetReadOptions;
@@ -209,6 +210,19 @@ public:
                              std::map<uint32_t, std::vector<uint32_t>>& rowids_by_rssid,
                              vector<std::unique_ptr<vectorized::Column>>* columns);
 
+    // Write the delta column group of segment |rssid| at |version| for a column mode partial update, in which
+    // the rows |rowids| of the columns |column_ids| take the values |values|, see DeltaColumnGroupWriter.
+    Status write_delta_column_group(uint32_t rssid, int64_t version, const std::vector<uint32_t>& column_ids,
+                                    const std::vector<uint32_t>& rowids, const vectorized::Chunk& values,
+                                    DeltaColumnGroupPB* dcg);
+
+    // Point lookup at the currently applied version, without TabletReader and SegmentIterator: the rows are
+    // located by the primary index, and their columns |column_ids| are read directly from the segments.
+    // |keys| are the encoded primary keys, see PrimaryKeyEncoder. (*found)[i] tells whether keys[i] exists,
+    // and the values of the found keys are appended to |columns| in the order of |keys|.
+    Status get_rows_by_keys(const vectorized::Column& keys, std::vector<uint32_t>& column_ids,
+                            std::vector<bool>* found, vector<std::unique_ptr<vectorized::Column>>* columns);
+
     Status prepare_partial_update_states(Tablet* tablet, const std::vector<ColumnUniquePtr>& upserts,
                                          EditVersion* read_version, uint32_t* next_rowset_id,
                                          std::vector<std::vector<uint64_t>*>* rss_rowids);
@@ -268,8 +282,9 @@ private:
     RowsetSharedPtr _get_rowset(uint32_t rowset_id);
 
     // wait a version to be applied, so reader can read this version
-    // assuming _lock already hold
     Status _wait_for_version(const EditVersion& version, int64_t timeout_ms);
+    // same as above, but |ul| already holds _lock
+    Status _wait_for_version(const EditVersion& version, int64_t timeout_ms, std::unique_lock<std::mutex>& ul);
 
     Status _commit_compaction(std::unique_ptr<CompactionInfo>* info, const RowsetSharedPtr& rowset,
                               EditVersion* commit_version);
@@ -23,7 +23,9 @@
 
 #include <sys/stat.h>
 
+#include <atomic>
 #include <filesystem>
+#include <mutex>
 #include <set>
 
 #include "common/status.h"
@@ -42,6 +44,7 @@
 #include "storage/snapshot_manager.h"
 #include "storage/tablet_updates.h"
 #include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 
 using std::set;
@@ -416,10 +419,14 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
     }
 
     // Get copy from remote
-    uint64_t total_file_size = 0;
-    MonotonicStopWatch watch;
-    watch.start();
-    for (auto& file_name : file_name_list) {
+    // The files except the header are downloaded in parallel, each by its own connection.
+    std::atomic<uint64_t> total_file_size{0};
+    std::mutex status_lock;
+    Status download_status;
+    auto download_file = [&](const std::string& file_name) -> Status {
+        if (ExecEnv::GetInstance()->storage_engine()->bg_worker_stopped()) {
+            return Status::InternalError("Process is going to quit. The download will stop.");
+        }
         auto remote_file_url = remote_url_prefix + file_name;
 
         // get file length
@@ -463,17 +470,52 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
             return Status::OK();
         };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
-    } // Clone files from remote backend
+        return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+    };
+
+    MonotonicStopWatch watch;
+    watch.start();
+    std::unique_ptr<ThreadPool> download_pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("clone_download")
+                            .set_min_threads(1)
+                            .set_max_threads(std::max(1, config::clone_download_concurrency))
+                            .build(&download_pool));
+    for (size_t i = 0; i + 1 < file_name_list.size(); ++i) {
+        const auto& file_name = file_name_list[i];
+        auto task = [&, file_name]() {
+            {
+                std::lock_guard l(status_lock);
+                if (!download_status.ok()) {
+                    return;
+                }
+            }
+            Status st = download_file(file_name);
+            if (!st.ok()) {
+                std::lock_guard l(status_lock);
+                if (download_status.ok()) {
+                    download_status = st;
+                }
+            }
+        };
+        if (!download_pool->submit_func(task).ok()) {
+            task();
+        }
+    }
+    download_pool->wait();
+    RETURN_IF_ERROR(download_status);
+    // The header is downloaded after all the data files.
+    if (!file_name_list.empty()) {
+        RETURN_IF_ERROR(download_file(file_name_list.back()));
+    }
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
     double copy_rate = 0.0;
     if (total_time_ms > 0) {
-        copy_rate = total_file_size / ((double)total_time_ms) / 1000;
+        copy_rate = total_file_size.load() / ((double)total_time_ms) / 1000;
     }
-    LOG(INFO) << "Copied tablet " << _signature << " files=" << file_name_list.size() << ". bytes=" << total_file_size
-              << " cost=" << total_time_ms << " ms"
+    LOG(INFO) << "Copied tablet " << _signature << " files=" << file_name_list.size()
+              << ". bytes=" << total_file_size.load() << " cost=" << total_time_ms << " ms"
               << " rate=" << copy_rate << " MB/s";
     return Status::OK();
 }
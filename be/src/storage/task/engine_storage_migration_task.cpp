@@ -21,6 +21,7 @@
 
 #include "storage/task/engine_storage_migration_task.h"
 
+#include "common/config.h"
 #include "runtime/exec_env.h"
 #include "storage/snapshot_manager.h"
 #include "storage/tablet_meta_manager.h"
@@ -343,13 +344,15 @@ Status EngineStorageMigrationTask::_copy_index_and_data_files(
         const string& schema_hash_path, const TabletSharedPtr& ref_tablet,
         const std::vector<RowsetSharedPtr>& consistent_rowsets) const {
     Status status = Status::OK();
+    // The tablet is still queried from the source path while its files are being copied.
+    const int64_t max_bytes_per_sec = config::storage_medium_migrate_speed_limit_mb_per_sec * 1024 * 1024;
     for (const auto& rs : consistent_rowsets) {
         bool bg_worker_stopped = ExecEnv::GetInstance()->storage_engine()->bg_worker_stopped();
         if (bg_worker_stopped) {
             status = Status::InternalError("Process is going to quit.");
             break;
         }
-        status = rs->copy_files_to(schema_hash_path);
+        status = rs->copy_files_to(schema_hash_path, max_bytes_per_sec);
         if (!status.ok()) {
             break;
         }
@@ -33,6 +33,7 @@
 #include "util/scoped_cleanup.h"
 #include "util/starrocks_metrics.h"
 #include "util/time.h"
+#include "util/trace.h"
 
 namespace starrocks {
 
@@ -213,7 +214,11 @@ Status TxnManager::publish_txn(KVStore* meta, TPartitionId partition_id, TTransa
     pair<int64_t, int64_t> key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, schema_hash, tablet_uid);
     RowsetSharedPtr rowset_ptr = nullptr;
-    std::lock_guard txn_lock(_get_txn_lock(transaction_id));
+    std::unique_lock txn_lock(_get_txn_lock(transaction_id), std::defer_lock);
+    {
+        TRACE_COUNTER_SCOPE_LATENCY_US("txn_lock_wait_us");
+        txn_lock.lock();
+    }
     {
         std::shared_lock rlock(_get_txn_map_lock(transaction_id));
         txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
@@ -235,7 +240,11 @@ Status TxnManager::publish_txn(KVStore* meta, TPartitionId partition_id, TTransa
         // it maybe a fatal error
         rowset_ptr->make_visible(version);
         auto& rowset_meta_pb = rowset_ptr->rowset_meta()->get_meta_pb();
-        Status st = RowsetMetaManager::save(meta, tablet_uid, rowset_meta_pb);
+        Status st;
+        {
+            TRACE_COUNTER_SCOPE_LATENCY_US("save_rowset_meta_us");
+            st = RowsetMetaManager::save(meta, tablet_uid, rowset_meta_pb);
+        }
         if (!st.ok()) {
             LOG(WARNING) << "Fail to save committed rowset. "
                          << "tablet_id: " << tablet_id << ", txn_id: " << transaction_id
@@ -341,6 +350,7 @@ Status TxnManager::persist_tablet_related_txns(const std::vector<TabletSharedPtr
 
     StarRocksMetrics::instance()->txn_persist_total.increment(1);
     StarRocksMetrics::instance()->txn_persist_duration_us.increment(duration_ns / 1000);
+    TRACE_COUNTER_INCREMENT("persist_txn_meta_us", duration_ns / 1000);
     return Status::OK();
 }
 
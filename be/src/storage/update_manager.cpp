@@ -5,6 +5,7 @@
 #include <limits>
 #include <memory>
 
+#include "common/config.h"
 #include "gutil/endian.h"
 #include "storage/chunk_helper.h"
 #include "storage/del_vector.h"
@@ -28,9 +29,19 @@ UpdateManager::UpdateManager(MemTracker* mem_tracker)
 
     _index_cache.set_mem_tracker(_index_cache_mem_tracker.get());
     _update_state_cache.set_mem_tracker(_update_state_mem_tracker.get());
+    if (mem_tracker != nullptr && mem_tracker->has_limit()) {
+        int32_t capacity_percent = std::max(std::min(100, config::update_index_cache_capacity_percent), 0);
+        int32_t max_entry_percent = std::max(std::min(100, config::update_index_cache_max_entry_percent), 0);
+        size_t capacity = mem_tracker->limit() * capacity_percent / 100;
+        _index_cache.set_capacity(capacity);
+        _index_cache.set_max_entry_size(capacity * max_entry_percent / 100);
+    }
 }
 
 UpdateManager::~UpdateManager() {
+    if (_index_preload_thread_pool != nullptr) {
+        _index_preload_thread_pool->shutdown();
+    }
     if (_apply_thread_pool != nullptr) {
         // DynamicCache may be still used by apply thread.
         // Before deconstrut the DynamicCache, apply thread
@@ -53,8 +64,8 @@ UpdateManager::~UpdateManager() {
 }
 
 Status UpdateManager::init() {
-    auto st = ThreadPoolBuilder("update_apply").build(&_apply_thread_pool);
-    return st;
+    RETURN_IF_ERROR(ThreadPoolBuilder("update_apply").build(&_apply_thread_pool));
+    return ThreadPoolBuilder("update_index_preload").build(&_index_preload_thread_pool);
 }
 
 Status UpdateManager::get_del_vec_in_meta(KVStore* meta, const TabletSegmentId& tsid, int64_t version,
@@ -263,15 +274,13 @@ Status UpdateManager::on_rowset_finished(Tablet* tablet, Rowset* rowset) {
         _update_state_cache.remove(state_entry);
     }
     if (st.ok()) {
-        auto index_entry = _index_cache.get_or_create(tablet->tablet_id());
-        st = index_entry->value().load(tablet);
-        index_entry->update_expire_time(MonotonicMillis() + _cache_expire_ms);
-        _index_cache.update_object_size(index_entry, index_entry->value().memory_usage());
-        if (st.ok()) {
-            _index_cache.release(index_entry);
+        if (config::enable_update_index_async_preload && _index_preload_thread_pool != nullptr) {
+            // the index is loaded again in apply if the preloading failed, so there is no need to wait for it
+            auto preload_st = preload_index(std::static_pointer_cast<Tablet>(tablet->shared_from_this()));
+            LOG_IF(WARNING, !preload_st.ok())
+                    << "submit primary index preload error: " << preload_st << " tablet: " << tablet->tablet_id();
         } else {
-            LOG(WARNING) << "load primary index error: " << st << " tablet: " << tablet->tablet_id();
-            _index_cache.remove(index_entry);
+            st = _load_index_to_cache(tablet);
         }
     }
     VLOG(1) << "UpdateManager::on_rowset_finished finish tablet:" << tablet->tablet_id()
@@ -279,6 +288,51 @@ Status UpdateManager::on_rowset_finished(Tablet* tablet, Rowset* rowset) {
     return st;
 }
 
+Status UpdateManager::_load_index_to_cache(Tablet* tablet) {
+    auto index_entry = _index_cache.get_or_create(tablet->tablet_id());
+    auto st = index_entry->value().load(tablet);
+    index_entry->update_expire_time(MonotonicMillis() + _cache_expire_ms);
+    _index_cache.update_object_size(index_entry, index_entry->value().memory_usage());
+    if (st.ok()) {
+        _index_cache.release(index_entry);
+    } else {
+        LOG(WARNING) << "load primary index error: " << st << " tablet: " << tablet->tablet_id();
+        _index_cache.remove(index_entry);
+    }
+    return st;
+}
+
+Status UpdateManager::preload_index(const std::shared_ptr<Tablet>& tablet) {
+    int64_t tablet_id = tablet->tablet_id();
+    {
+        std::lock_guard<std::mutex> lg(_index_preload_lock);
+        if (!_index_preload_tablets.insert(tablet_id).second) {
+            return Status::OK();
+        }
+    }
+    auto st = _index_preload_thread_pool->submit_func([this, tablet, tablet_id]() {
+        auto index_entry = _index_cache.get_or_create(tablet_id);
+        auto& index = index_entry->value();
+        auto st = index.load(tablet.get());
+        index_entry->update_expire_time(MonotonicMillis() + _cache_expire_ms);
+        if (!st.ok()) {
+            // the entry may be used by the apply concurrently, so just unload the index rather than remove the
+            // entry, and let the apply load it again
+            LOG(WARNING) << "preload primary index error: " << st << " tablet: " << tablet_id;
+            index.unload();
+        }
+        _index_cache.update_object_size(index_entry, index.memory_usage());
+        _index_cache.release(index_entry);
+        std::lock_guard<std::mutex> lg(_index_preload_lock);
+        _index_preload_tablets.erase(tablet_id);
+    });
+    if (!st.ok()) {
+        std::lock_guard<std::mutex> lg(_index_preload_lock);
+        _index_preload_tablets.erase(tablet_id);
+    }
+    return st;
+}
+
 void UpdateManager::on_rowset_cancel(Tablet* tablet, Rowset* rowset) {
     string rowset_unique_id = rowset->rowset_id().to_string();
     VLOG(1) << "UpdateManager::on_rowset_error remove state tablet:" << tablet->tablet_id()
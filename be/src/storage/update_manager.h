@@ -4,6 +4,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "storage/olap_common.h"
 #include "storage/primary_index.h"
@@ -50,6 +51,10 @@ public:
 
     void on_rowset_cancel(Tablet* tablet, Rowset* rowset);
 
+    // Load the primary index of |tablet| into the index cache in background, so that the following apply
+    // needn't wait for it. Do nothing if the loading of the index is already pending.
+    Status preload_index(const std::shared_ptr<Tablet>& tablet);
+
     ThreadPool* apply_thread_pool() { return _apply_thread_pool.get(); }
 
     DynamicCache<uint64_t, PrimaryIndex>& index_cache() { return _index_cache; }
@@ -73,6 +78,8 @@ public:
     string topn_memory_stats(size_t topn);
 
 private:
+    Status _load_index_to_cache(Tablet* tablet);
+
     // default 6min
     int64_t _cache_expire_ms = 360000;
 
@@ -95,6 +102,11 @@ private:
 
     std::unique_ptr<ThreadPool> _apply_thread_pool;
 
+    std::unique_ptr<ThreadPool> _index_preload_thread_pool;
+    std::mutex _index_preload_lock;
+    // tablets whose primary indexes are pending to be preloaded
+    std::unordered_set<int64_t> _index_preload_tablets;
+
     UpdateManager(const UpdateManager&) = delete;
     const UpdateManager& operator=(const UpdateManager&) = delete;
 };
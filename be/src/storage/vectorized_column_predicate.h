@@ -3,6 +3,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -172,6 +173,10 @@ public:
         return Status::Cancelled("not implemented");
     }
 
+    // Return true and append the substrings to |substrings| if a row satisfying this predicate must contain all
+    // of them, e.g. `c LIKE '%abc%def'`, so that the rows can be filtered by the n-gram index.
+    virtual bool get_ngram_substrings(std::vector<std::string>* substrings) const { return false; }
+
     // Indicate whether or not the evaluate can be vectorized.
     // If this function return true, evaluate function will be vectorized and can achieve
     // good performance.
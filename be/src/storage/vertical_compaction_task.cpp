@@ -2,6 +2,8 @@
 
 #include "storage/vertical_compaction_task.h"
 
+#include <algorithm>
+#include <deque>
 #include <vector>
 
 #include "column/schema.h"
@@ -17,11 +19,48 @@
 #include "storage/storage_engine.h"
 #include "storage/tablet_reader.h"
 #include "storage/tablet_reader_params.h"
+#include "util/blocking_queue.hpp"
+#include "util/thread.h"
 #include "util/time.h"
 #include "util/trace.h"
 
 namespace starrocks {
 
+// A column group read and merged by its own thread, whose merged chunks are written by the compaction thread.
+struct VerticalCompactionTask::ColumnGroupReader {
+    struct MergedChunk {
+        vectorized::ChunkPtr chunk;
+        size_t del_filtered_rows = 0;
+        size_t merged_rows = 0;
+    };
+
+    ColumnGroupReader(bool is_key_, const std::vector<uint32_t>& column_group_, vectorized::Schema schema_)
+            : is_key(is_key_),
+              column_group(column_group_),
+              schema(std::move(schema_)),
+              chunks(std::max(1, config::vertical_compaction_max_buffered_chunks)) {}
+
+    const bool is_key;
+    const std::vector<uint32_t>& column_group;
+    const vectorized::Schema schema;
+    int32_t chunk_size = 0;
+    RuntimeProfile* profile = nullptr;
+    // the masks written by the key group, or read by the non-key group
+    vectorized::RowSourceMaskBuffer* mask_buffer = nullptr;
+    std::unique_ptr<vectorized::RowSourceMaskBuffer> own_mask_buffer;
+
+    // the merged chunks to write
+    BlockingQueue<MergedChunk> chunks;
+    // the written chunks, reused by the reader
+    UnboundedBlockingQueue<vectorized::ChunkPtr> free_chunks;
+    std::thread thread;
+    // the status of the reader, valid after |thread| is joined
+    Status status;
+    // the statistics of the key group
+    size_t merged_rows = 0;
+    size_t del_filtered_rows = 0;
+};
+
 Status VerticalCompactionTask::run_impl() {
     Statistics statistics;
     RETURN_IF_ERROR(_vertical_compaction_data(&statistics));
@@ -54,24 +93,57 @@ Status VerticalCompactionTask::_vertical_compaction_data(Statistics* statistics)
 
     auto mask_buffer =
             std::make_unique<vectorized::RowSourceMaskBuffer>(_tablet->tablet_id(), _tablet->data_dir()->path());
-    auto source_masks = std::make_unique<std::vector<vectorized::RowSourceMask>>();
     TRACE("[Compaction] compaction prepare finished, max_rows_per_segment:$0, column groups "
           "size:$1",
           max_rows_per_segment, column_groups.size());
 
-    for (size_t i = 0; i < column_groups.size(); ++i) {
+    // The key columns are merged first, which writes the sources of the rows to |mask_buffer|, then the
+    // non-key column groups are merged by the masks, without comparing the keys. Each column group is read
+    // and merged by its own thread, while the merged chunks are written by this thread, so the read, the
+    // merge and the write overlap. The columns of a segment are written one column group after another, so
+    // the non-key column groups are read and merged ahead of the one being written, up to
+    // config::vertical_compaction_max_parallel_column_groups at the same time.
+    {
+        ASSIGN_OR_RETURN(auto key_group, _start_column_group_reader(true, 0, column_groups[0], mask_buffer.get(),
+                                                                    config::compaction_memory_limit_per_worker));
+        RETURN_IF_ERROR(_write_column_group(key_group.get(), output_rs_writer.get(), statistics));
+    }
+
+    const size_t num_groups = column_groups.size();
+    const size_t parallel = std::clamp<int64_t>(config::vertical_compaction_max_parallel_column_groups, 1,
+                                                std::max<int64_t>(1, static_cast<int64_t>(num_groups) - 1));
+    const int64_t mem_limit = config::compaction_memory_limit_per_worker / static_cast<int64_t>(parallel);
+    std::deque<std::unique_ptr<ColumnGroupReader>> readers;
+    size_t next_group = 1;
+    Status st;
+    while (st.ok() && (next_group < num_groups || !readers.empty())) {
+        while (readers.size() < parallel && next_group < num_groups) {
+            auto res = _start_column_group_reader(false, next_group, column_groups[next_group], mask_buffer.get(),
+                                                  mem_limit);
+            if (!res.ok()) {
+                st = res.status();
+                break;
+            }
+            readers.emplace_back(std::move(res).value());
+            next_group++;
+        }
+        if (!st.ok() || readers.empty()) {
+            break;
+        }
         if (should_stop()) {
             LOG(INFO) << "vertical compaction task_id:" << _task_info.task_id << " is stopped.";
-            return Status::Cancelled("vertical compaction task is stopped.");
-        }
-        bool is_key = (i == 0);
-        if (!is_key) {
-            // read mask buffer from the beginning
-            mask_buffer->flip_to_read();
+            st = Status::Cancelled("vertical compaction task is stopped.");
+            break;
         }
-        RETURN_IF_ERROR(_compact_column_group(is_key, i, column_groups[i], output_rs_writer.get(), mask_buffer.get(),
-                                              source_masks.get(), statistics));
+        st = _write_column_group(readers.front().get(), output_rs_writer.get(), statistics);
+        readers.pop_front();
     }
+    // stop the readers ahead, if any
+    for (auto& reader : readers) {
+        reader->chunks.shutdown();
+        reader->thread.join();
+    }
+    RETURN_IF_ERROR(st);
     TRACE("[Compaction] data compacted");
 
     RETURN_IF_ERROR(output_rs_writer->final_flush());
@@ -100,55 +172,135 @@ Status VerticalCompactionTask::_vertical_compaction_data(Statistics* statistics)
     return Status::OK();
 }
 
-Status VerticalCompactionTask::_compact_column_group(bool is_key, int column_group_index,
-                                                     const std::vector<uint32_t>& column_group,
-                                                     RowsetWriter* output_rs_writer,
-                                                     vectorized::RowSourceMaskBuffer* mask_buffer,
-                                                     std::vector<vectorized::RowSourceMask>* source_masks,
-                                                     Statistics* statistics) {
-    vectorized::Schema schema =
-            vectorized::ChunkHelper::convert_schema_to_format_v2(_tablet->tablet_schema(), column_group);
+StatusOr<std::unique_ptr<VerticalCompactionTask::ColumnGroupReader>> VerticalCompactionTask::_start_column_group_reader(
+        bool is_key, int column_group_index, const std::vector<uint32_t>& column_group,
+        vectorized::RowSourceMaskBuffer* mask_buffer, int64_t mem_limit) {
+    auto reader = std::make_unique<ColumnGroupReader>(
+            is_key, column_group,
+            vectorized::ChunkHelper::convert_schema_to_format_v2(_tablet->tablet_schema(), column_group));
+    reader->profile = _runtime_profile.create_child("merge_rowsets");
+    if (is_key) {
+        reader->mask_buffer = mask_buffer;
+    } else {
+        ASSIGN_OR_RETURN(reader->own_mask_buffer, mask_buffer->new_reader());
+        reader->mask_buffer = reader->own_mask_buffer.get();
+    }
+    ASSIGN_OR_RETURN(reader->chunk_size, _calculate_chunk_size_for_column_group(column_group, mem_limit));
+    VLOG(1) << "compaction task_id:" << _task_info.task_id << ", tablet=" << _tablet->tablet_id()
+            << ", column group=" << column_group_index << ", reader chunk size=" << reader->chunk_size;
+
+    MemTracker* mem_tracker = tls_mem_tracker;
+    auto* r = reader.get();
+    reader->thread = std::thread([this, r, mem_tracker] {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+        r->status = _read_column_group(r);
+        // notify the writer the end of the chunks
+        r->chunks.shutdown();
+    });
+    Thread::set_thread_name(reader->thread, "compact_read");
+    return std::move(reader);
+}
+
+Status VerticalCompactionTask::_read_column_group(ColumnGroupReader* group) {
     vectorized::TabletReader reader(std::static_pointer_cast<Tablet>(_tablet->shared_from_this()),
-                                    output_rs_writer->version(), schema, is_key, mask_buffer);
+                                    _task_info.output_version, group->schema, group->is_key, group->mask_buffer);
     RETURN_IF_ERROR(reader.prepare());
     vectorized::TabletReaderParams reader_params;
     DCHECK(compaction_type() == BASE_COMPACTION || compaction_type() == CUMULATIVE_COMPACTION);
     reader_params.reader_type =
             compaction_type() == BASE_COMPACTION ? READER_BASE_COMPACTION : READER_CUMULATIVE_COMPACTION;
-    reader_params.profile = _runtime_profile.create_child("merge_rowsets");
-
-    StatusOr<int32_t> ret = _calculate_chunk_size_for_column_group(column_group);
-    if (!ret.ok()) {
-        return ret.status();
-    }
-    int32_t chunk_size = ret.value();
-    VLOG(1) << "compaction task_id:" << _task_info.task_id << ", tablet=" << _tablet->tablet_id()
-            << ", column group=" << column_group_index << ", reader chunk size=" << chunk_size;
-    reader_params.chunk_size = chunk_size;
+    reader_params.profile = group->profile;
+    reader_params.chunk_size = group->chunk_size;
     RETURN_IF_ERROR(reader.open(reader_params));
 
-    StatusOr<size_t> rows_st = _compact_data(is_key, chunk_size, column_group, schema, &reader, output_rs_writer,
-                                             mask_buffer, source_masks);
-    if (!rows_st.ok()) {
-        return rows_st.status();
-    }
+    auto char_field_indexes = vectorized::ChunkHelper::get_char_field_indexes(group->schema);
+    std::vector<vectorized::RowSourceMask> source_masks;
+    size_t del_filtered_rows = 0;
+    size_t merged_rows = 0;
+    while (LIKELY(!should_stop())) {
+#ifndef BE_TEST
+        Status status = tls_thread_status.mem_tracker()->check_mem_limit("Compaction");
+        if (!status.ok()) {
+            LOG(WARNING) << "fail to execute compaction: " << status.message() << std::endl;
+            return status;
+        }
+#endif
+        ColumnGroupReader::MergedChunk merged;
+        if (group->free_chunks.try_get(&merged.chunk)) {
+            merged.chunk->reset();
+        } else {
+            merged.chunk = vectorized::ChunkHelper::new_chunk(group->schema, group->chunk_size);
+        }
+        Status st = reader.get_next(merged.chunk.get(), &source_masks);
+        if (!st.ok()) {
+            if (st.is_end_of_file()) {
+                break;
+            }
+            LOG(WARNING) << "reader get next error. tablet=" << _tablet->tablet_id() << ", err=" << st.to_string();
+            return Status::InternalError(fmt::format("reader get_next error: {}", st.to_string()));
+        }
 
-    if (is_key && statistics) {
-        statistics->output_rows = rows_st.value();
-        statistics->merged_rows = reader.merged_rows();
-        statistics->filtered_rows = reader.stats().rows_del_filtered;
+        vectorized::ChunkHelper::padding_char_columns(char_field_indexes, group->schema, _tablet->tablet_schema(),
+                                                      merged.chunk.get());
+        if (group->is_key && !source_masks.empty()) {
+            RETURN_IF_ERROR(group->mask_buffer->write(source_masks));
+        }
+        source_masks.clear();
+
+        merged.del_filtered_rows = reader.stats().rows_del_filtered - del_filtered_rows;
+        merged.merged_rows = reader.merged_rows() - merged_rows;
+        del_filtered_rows = reader.stats().rows_del_filtered;
+        merged_rows = reader.merged_rows();
+        if (!group->chunks.blocking_put(std::move(merged))) {
+            // the writer has quit
+            return Status::Cancelled("vertical compaction column group writer quit");
+        }
     }
-
-    RETURN_IF_ERROR(output_rs_writer->flush_columns());
-
-    if (is_key) {
-        RETURN_IF_ERROR(mask_buffer->flush());
+    if (should_stop()) {
+        LOG(INFO) << "vertical compaction task_id:" << _task_info.task_id << ", tablet:" << _task_info.tablet_id
+                  << " is stopped.";
+        return Status::Cancelled("vertical compaction task is stopped.");
+    }
+    if (group->is_key) {
+        group->merged_rows = reader.merged_rows();
+        group->del_filtered_rows = reader.stats().rows_del_filtered;
+        RETURN_IF_ERROR(group->mask_buffer->flush());
     }
     return Status::OK();
 }
 
+Status VerticalCompactionTask::_write_column_group(ColumnGroupReader* group, RowsetWriter* output_rs_writer,
+                                                   Statistics* statistics) {
+    Status st;
+    size_t output_rows = 0;
+    ColumnGroupReader::MergedChunk merged;
+    while (group->chunks.blocking_get(&merged)) {
+        st = output_rs_writer->add_columns(*merged.chunk, group->column_group, group->is_key);
+        if (!st.ok()) {
+            break;
+        }
+        output_rows += merged.chunk->num_rows();
+        _task_info.total_output_num_rows += merged.chunk->num_rows();
+        _task_info.total_del_filtered_rows += merged.del_filtered_rows;
+        _task_info.total_merged_rows += merged.merged_rows;
+        group->free_chunks.put(std::move(merged.chunk));
+    }
+    // stop the reader if failed to write
+    group->chunks.shutdown();
+    group->thread.join();
+    RETURN_IF_ERROR(st);
+    RETURN_IF_ERROR(group->status);
+
+    if (group->is_key && statistics) {
+        statistics->output_rows = output_rows;
+        statistics->merged_rows = group->merged_rows;
+        statistics->filtered_rows = group->del_filtered_rows;
+    }
+    return output_rs_writer->flush_columns();
+}
+
 StatusOr<int32_t> VerticalCompactionTask::_calculate_chunk_size_for_column_group(
-        const std::vector<uint32_t>& column_group) {
+        const std::vector<uint32_t>& column_group, int64_t mem_limit) {
     int64_t total_num_rows = 0;
     int64_t total_mem_footprint = 0;
     for (auto& rowset : _input_rowsets) {
@@ -161,7 +313,7 @@ StatusOr<int32_t> VerticalCompactionTask::_calculate_chunk_size_for_column_group
         auto* beta_rowset = down_cast<BetaRowset*>(rowset.get());
         for (auto& segment : beta_rowset->segments()) {
             for (uint32_t column_index : column_group) {
-                const auto* column_reader = segment->column(column_index);
+                ASSIGN_OR_RETURN(auto column_reader, segment->column(column_index));
                 if (column_reader == nullptr) {
                     continue;
                 }
@@ -170,73 +322,9 @@ StatusOr<int32_t> VerticalCompactionTask::_calculate_chunk_size_for_column_group
         }
     }
     int32_t chunk_size =
-            CompactionUtils::get_read_chunk_size(config::compaction_memory_limit_per_worker, config::vector_chunk_size,
-                                                 total_num_rows, total_mem_footprint, _task_info.input_segments_num);
+            CompactionUtils::get_read_chunk_size(mem_limit, config::vector_chunk_size, total_num_rows,
+                                                 total_mem_footprint, _task_info.input_segments_num);
     return chunk_size;
 }
 
-StatusOr<size_t> VerticalCompactionTask::_compact_data(bool is_key, int32_t chunk_size,
-                                                       const std::vector<uint32_t>& column_group,
-                                                       const vectorized::Schema& schema,
-                                                       vectorized::TabletReader* reader, RowsetWriter* output_rs_writer,
-                                                       vectorized::RowSourceMaskBuffer* mask_buffer,
-                                                       std::vector<vectorized::RowSourceMask>* source_masks) {
-    DCHECK(reader);
-    size_t output_rows = 0;
-    auto chunk = vectorized::ChunkHelper::new_chunk(schema, chunk_size);
-    auto char_field_indexes = vectorized::ChunkHelper::get_char_field_indexes(schema);
-
-    Status status = Status::OK();
-    size_t column_group_del_filtered_rows = 0;
-    size_t column_group_merged_rows = 0;
-    while (LIKELY(!should_stop())) {
-#ifndef BE_TEST
-        status = tls_thread_status.mem_tracker()->check_mem_limit("Compaction");
-        if (!status.ok()) {
-            LOG(WARNING) << "fail to execute compaction: " << status.message() << std::endl;
-            return status;
-        }
-#endif
-
-        chunk->reset();
-        status = reader->get_next(chunk.get(), source_masks);
-        if (!status.ok()) {
-            if (status.is_end_of_file()) {
-                break;
-            } else {
-                LOG(WARNING) << "reader get next error. tablet=" << _tablet->tablet_id()
-                             << ", err=" << status.to_string();
-                return Status::InternalError(fmt::format("reader get_next error: {}", status.to_string()));
-            }
-        }
-
-        vectorized::ChunkHelper::padding_char_columns(char_field_indexes, schema, _tablet->tablet_schema(),
-                                                      chunk.get());
-
-        RETURN_IF_ERROR(output_rs_writer->add_columns(*chunk, column_group, is_key));
-
-        _task_info.total_output_num_rows += chunk->num_rows();
-        _task_info.total_del_filtered_rows += reader->stats().rows_del_filtered - column_group_del_filtered_rows;
-        _task_info.total_merged_rows += reader->merged_rows() - column_group_merged_rows;
-        column_group_del_filtered_rows = reader->stats().rows_del_filtered;
-        column_group_merged_rows = reader->merged_rows();
-
-        if (is_key) {
-            output_rows += chunk->num_rows();
-            if (!source_masks->empty()) {
-                RETURN_IF_ERROR(mask_buffer->write(*source_masks));
-            }
-        }
-        if (!source_masks->empty()) {
-            source_masks->clear();
-        }
-    }
-    if (should_stop()) {
-        LOG(INFO) << "vertical compaction task_id:" << _task_info.task_id << ", tablet:" << _task_info.tablet_id
-                  << " is stopped.";
-        return Status::Cancelled("vertical compaction task is stopped.");
-    }
-    return output_rows;
-}
-
 } // namespace starrocks
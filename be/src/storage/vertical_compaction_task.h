@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "common/status.h"
@@ -14,9 +15,7 @@ namespace starrocks {
 
 class RowsetWriter;
 namespace vectorized {
-class TabletReader;
 class RowSourceMaskBuffer;
-class RowSourceMask;
 } // namespace vectorized
 
 // need a factory of compaction task
@@ -28,18 +27,22 @@ public:
     Status run_impl() override;
 
 private:
+    struct ColumnGroupReader;
+
     Status _vertical_compaction_data(Statistics* statistics);
 
-    Status _compact_column_group(bool is_key, int column_group_index, const std::vector<uint32_t>& column_group,
-                                 RowsetWriter* output_rs_writer, vectorized::RowSourceMaskBuffer* mask_buffer,
-                                 std::vector<vectorized::RowSourceMask>* source_masks, Statistics* statistics);
+    // Start reading and merging |column_group| in a new thread, with the memory limit |mem_limit|.
+    StatusOr<std::unique_ptr<ColumnGroupReader>> _start_column_group_reader(
+            bool is_key, int column_group_index, const std::vector<uint32_t>& column_group,
+            vectorized::RowSourceMaskBuffer* mask_buffer, int64_t mem_limit);
+
+    Status _read_column_group(ColumnGroupReader* group);
 
-    StatusOr<size_t> _compact_data(bool is_key, int32_t chunk_size, const std::vector<uint32_t>& column_group,
-                                   const vectorized::Schema& schema, vectorized::TabletReader* reader,
-                                   RowsetWriter* output_rs_writer, vectorized::RowSourceMaskBuffer* mask_buffer,
-                                   std::vector<vectorized::RowSourceMask>* source_masks);
+    // Write the merged chunks of |group| until its reader finishes.
+    Status _write_column_group(ColumnGroupReader* group, RowsetWriter* output_rs_writer, Statistics* statistics);
 
-    StatusOr<int32_t> _calculate_chunk_size_for_column_group(const std::vector<uint32_t>& column_group);
+    StatusOr<int32_t> _calculate_chunk_size_for_column_group(const std::vector<uint32_t>& column_group,
+                                                             int64_t mem_limit);
 };
 
 } // namespace starrocks
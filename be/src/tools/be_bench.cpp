@@ -0,0 +1,792 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2022-present, StarRocks Limited.
+
+// be_bench runs the SSB/TPC-H like benchmarks on one BE without FE, to measure the changes of the execution
+// engine end to end. It has two operations, both of them open the storage engine of the local be.conf, so
+// they must not run with the BE of the same storage_root_path:
+//
+//   be_bench --bench_operation=gen_data --benchmark=ssb --scale=1 --tablet_id_base=90000
+//     Creates one DUP_KEYS tablet per table, whose tablet id is tablet_id_base plus the index of the table
+//     printed by it, and writes the generated rows into the version 2 of the tablet.
+//
+//   be_bench --bench_operation=run --plan_dir=/path/to/plans --iterations=3
+//     Runs every <query>.json under plan_dir, which is a TExecPlanFragmentParams of a pipeline fragment ending
+//     with a result sink, serialized by TJSONProtocol. The query id, the coordinator and the versions of the
+//     scan ranges are filled by be_bench, so the plans can be written once for the tablets generated above.
+//     The coordinator is a stub frontend in be_bench receiving the profile of the fragment.
+//
+// The generators keep the cardinalities, the value domains and the key orders of the tables, but not the
+// correlations between the columns of dbgen, which is enough to compare the engine before and after a change.
+
+#include <gflags/gflags.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/datum.h"
+#include "common/config.h"
+#include "common/daemon.h"
+#include "common/status.h"
+#include "exec/pipeline/fragment_executor.h"
+#include "gen_cpp/FrontendService.h"
+#include "gen_cpp/InternalService_types.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/date_value.h"
+#include "runtime/exec_env.h"
+#include "runtime/result_buffer_mgr.h"
+#include "service/backend_options.h"
+#include "storage/chunk_helper.h"
+#include "storage/olap_common.h"
+#include "storage/options.h"
+#include "storage/rowset/rowset_factory.h"
+#include "storage/rowset/rowset_writer.h"
+#include "storage/storage_engine.h"
+#include "storage/tablet_manager.h"
+#include "util/file_utils.h"
+#include "util/runtime_profile.h"
+#include "util/thrift_server.h"
+#include "util/thrift_util.h"
+#include "util/uid_util.h"
+
+DEFINE_string(bench_operation, "", "valid operation: gen_data, run");
+DEFINE_string(bench_conf, "", "be.conf of the storage engine, $STARROCKS_HOME/conf/be.conf by default");
+DEFINE_string(benchmark, "ssb", "benchmark of gen_data: ssb, tpch");
+DEFINE_double(scale, 1, "scale factor of gen_data");
+DEFINE_int64(tablet_id_base, 90000, "tablet id of the first table");
+DEFINE_int64(rows_per_segment, 1000000, "rows of one segment written by gen_data");
+DEFINE_int64(gen_seed, 20220601, "seed of the random generators of gen_data");
+DEFINE_string(plan_dir, "", "directory of the <query>.json plans to run");
+DEFINE_string(queries, "", "comma separated queries to run, all the plans under plan_dir by default");
+DEFINE_int32(iterations, 3, "measured runs of every query");
+DEFINE_int32(warmup_iterations, 1, "runs of every query before the measured ones");
+DEFINE_int32(fe_stub_port, 9820, "port of the stub frontend receiving the profiles");
+DEFINE_bool(print_profile, true, "print the profile of the last run of every query");
+
+namespace starrocks {
+
+using strings::Substitute;
+using vectorized::ChunkHelper;
+using vectorized::Column;
+using vectorized::DateValue;
+using vectorized::Datum;
+using vectorized::TimeUnit;
+
+namespace {
+
+// How the values of a column are generated from the index of the row.
+enum class Gen {
+    kSeq,            // row / b + a, b is 1 if it's 0; the first column of every table must be generated by it
+    kUniform,        // uniform in [a, b], b is multiplied by the scale factor if the column is scaled
+    kMoney,          // uniform in [a, b] / 100
+    kDate,           // 1992-01-01 plus uniform days in [a, b]
+    kDateKey,        // yyyymmdd of kDate
+    kDatePart,       // part a of the date 1992-01-01 plus row days: 0 yyyymmdd, 1 year, 2 yyyymm, 3 month,
+                     // 4 week of year, 5 MonYYYY
+    kMod,            // row % a
+    kChoice,         // uniform in choices
+    kCycle,          // choices[row % num_choices]
+    kName,           // choices[0] followed by the 9 digits row + 1
+    kPrefixUniform,  // choices[0] followed by kUniform
+    kText,           // uniform lower case letters of length [a, b]
+};
+
+struct ColumnSpec {
+    const char* name;
+    TPrimitiveType::type type;
+    int len;
+    Gen gen;
+    int64_t a = 0;
+    int64_t b = 0;
+    bool scaled = false;
+    std::vector<std::string> choices = {};
+};
+
+struct TableSpec {
+    const char* name;
+    int64_t base_rows;
+    bool scaled;
+    std::vector<ColumnSpec> columns;
+};
+
+constexpr auto INT = TPrimitiveType::INT;
+constexpr auto BIGINT = TPrimitiveType::BIGINT;
+constexpr auto DOUBLE = TPrimitiveType::DOUBLE;
+constexpr auto DATE = TPrimitiveType::DATE;
+constexpr auto VARCHAR = TPrimitiveType::VARCHAR;
+
+// The days from 1992-01-01 to 1998-12-31.
+constexpr int64_t kNumDays = 2557;
+constexpr int32_t kSchemaHash = 1001;
+
+const std::vector<std::string> kRegions = {"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+const std::vector<std::string> kNations = {"ALGERIA", "ARGENTINA",    "BRAZIL",  "CANADA", "EGYPT",
+                                           "ETHIOPIA", "FRANCE",      "GERMANY", "INDIA",  "INDONESIA",
+                                           "IRAN",    "IRAQ",         "JAPAN",   "JORDAN", "KENYA",
+                                           "MOROCCO", "MOZAMBIQUE",   "PERU",    "CHINA",  "ROMANIA",
+                                           "SAUDI ARABIA", "VIETNAM", "RUSSIA",  "UNITED KINGDOM", "UNITED STATES"};
+const std::vector<std::string> kPriorities = {"1-URGENT", "2-HIGH", "3-MEDIUM", "4-NOT SPECIFIED", "5-LOW"};
+const std::vector<std::string> kShipModes = {"REG AIR", "AIR", "RAIL", "SHIP", "TRUCK", "MAIL", "FOB"};
+const std::vector<std::string> kSegments = {"AUTOMOBILE", "BUILDING", "FURNITURE", "MACHINERY", "HOUSEHOLD"};
+const std::vector<std::string> kColors = {"almond", "antique", "aquamarine", "azure", "beige", "bisque",
+                                          "black",  "blue",    "brown",      "green", "ivory", "red"};
+const std::vector<std::string> kTypes = {"STANDARD ANODIZED TIN",   "SMALL PLATED COPPER",
+                                         "MEDIUM BURNISHED STEEL",  "LARGE BRUSHED BRASS",
+                                         "ECONOMY POLISHED NICKEL", "PROMO ANODIZED STEEL",
+                                         "STANDARD BURNISHED COPPER", "SMALL BRUSHED NICKEL",
+                                         "ECONOMY ANODIZED BRASS"};
+const std::vector<std::string> kContainers = {"SM CASE", "SM BOX", "MED BAG",    "MED PKG",
+                                              "LG CASE", "LG BOX", "JUMBO PACK", "WRAP DRUM"};
+const std::vector<std::string> kCities = {"ALGERIA  0", "ARGENTINA1", "BRAZIL   2", "CANADA   3", "CHINA    4",
+                                          "FRANCE   5", "GERMANY  6", "INDIA    7", "JAPAN    8", "UNITED ST9"};
+const std::vector<std::string> kOrderStatus = {"F", "O", "P"};
+const std::vector<std::string> kFlags = {"A", "N", "R"};
+
+std::vector<TableSpec> ssb_tables() {
+    return {
+            {"lineorder",
+             6000000,
+             true,
+             {{"lo_orderkey", BIGINT, 0, Gen::kSeq, 1, 4},
+              {"lo_linenumber", INT, 0, Gen::kUniform, 1, 7},
+              {"lo_custkey", INT, 0, Gen::kUniform, 1, 30000, true},
+              {"lo_partkey", INT, 0, Gen::kUniform, 1, 200000, true},
+              {"lo_suppkey", INT, 0, Gen::kUniform, 1, 2000, true},
+              {"lo_orderdate", INT, 0, Gen::kDateKey, 0, kNumDays - 1},
+              {"lo_orderpriority", VARCHAR, 16, Gen::kChoice, 0, 0, false, kPriorities},
+              {"lo_shippriority", INT, 0, Gen::kUniform, 0, 0},
+              {"lo_quantity", INT, 0, Gen::kUniform, 1, 50},
+              {"lo_extendedprice", INT, 0, Gen::kUniform, 90000, 10495000},
+              {"lo_ordtotalprice", INT, 0, Gen::kUniform, 90000, 50000000},
+              {"lo_discount", INT, 0, Gen::kUniform, 0, 10},
+              {"lo_revenue", INT, 0, Gen::kUniform, 80000, 10495000},
+              {"lo_supplycost", INT, 0, Gen::kUniform, 54000, 125000},
+              {"lo_tax", INT, 0, Gen::kUniform, 0, 8},
+              {"lo_commitdate", INT, 0, Gen::kDateKey, 0, kNumDays - 1},
+              {"lo_shipmode", VARCHAR, 11, Gen::kChoice, 0, 0, false, kShipModes}}},
+            {"customer",
+             30000,
+             true,
+             {{"c_custkey", INT, 0, Gen::kSeq, 1},
+              {"c_name", VARCHAR, 26, Gen::kName, 0, 0, false, {"Customer#"}},
+              {"c_address", VARCHAR, 41, Gen::kText, 10, 40},
+              {"c_city", VARCHAR, 11, Gen::kChoice, 0, 0, false, kCities},
+              {"c_nation", VARCHAR, 16, Gen::kChoice, 0, 0, false, kNations},
+              {"c_region", VARCHAR, 13, Gen::kChoice, 0, 0, false, kRegions},
+              {"c_phone", VARCHAR, 16, Gen::kText, 15, 15},
+              {"c_mktsegment", VARCHAR, 11, Gen::kChoice, 0, 0, false, kSegments}}},
+            {"supplier",
+             2000,
+             true,
+             {{"s_suppkey", INT, 0, Gen::kSeq, 1},
+              {"s_name", VARCHAR, 26, Gen::kName, 0, 0, false, {"Supplier#"}},
+              {"s_address", VARCHAR, 26, Gen::kText, 10, 25},
+              {"s_city", VARCHAR, 11, Gen::kChoice, 0, 0, false, kCities},
+              {"s_nation", VARCHAR, 16, Gen::kChoice, 0, 0, false, kNations},
+              {"s_region", VARCHAR, 13, Gen::kChoice, 0, 0, false, kRegions},
+              {"s_phone", VARCHAR, 16, Gen::kText, 15, 15}}},
+            {"part",
+             200000,
+             true,
+             {{"p_partkey", INT, 0, Gen::kSeq, 1},
+              {"p_name", VARCHAR, 23, Gen::kText, 10, 22},
+              {"p_mfgr", VARCHAR, 7, Gen::kPrefixUniform, 1, 5, false, {"MFGR#"}},
+              {"p_category", VARCHAR, 8, Gen::kPrefixUniform, 11, 55, false, {"MFGR#"}},
+              {"p_brand", VARCHAR, 10, Gen::kPrefixUniform, 1101, 5540, false, {"MFGR#"}},
+              {"p_color", VARCHAR, 12, Gen::kChoice, 0, 0, false, kColors},
+              {"p_type", VARCHAR, 26, Gen::kChoice, 0, 0, false, kTypes},
+              {"p_size", INT, 0, Gen::kUniform, 1, 50},
+              {"p_container", VARCHAR, 11, Gen::kChoice, 0, 0, false, kContainers}}},
+            {"dates",
+             kNumDays,
+             false,
+             {{"d_datekey", INT, 0, Gen::kDatePart, 0},
+              {"d_year", INT, 0, Gen::kDatePart, 1},
+              {"d_yearmonthnum", INT, 0, Gen::kDatePart, 2},
+              {"d_monthnuminyear", INT, 0, Gen::kDatePart, 3},
+              {"d_weeknuminyear", INT, 0, Gen::kDatePart, 4},
+              {"d_yearmonth", VARCHAR, 8, Gen::kDatePart, 5}}},
+    };
+}
+
+std::vector<TableSpec> tpch_tables() {
+    return {
+            {"lineitem",
+             6000000,
+             true,
+             {{"l_orderkey", BIGINT, 0, Gen::kSeq, 1, 4},
+              {"l_partkey", INT, 0, Gen::kUniform, 1, 200000, true},
+              {"l_suppkey", INT, 0, Gen::kUniform, 1, 10000, true},
+              {"l_linenumber", INT, 0, Gen::kUniform, 1, 7},
+              {"l_quantity", DOUBLE, 0, Gen::kMoney, 100, 5000},
+              {"l_extendedprice", DOUBLE, 0, Gen::kMoney, 90000, 10494950},
+              {"l_discount", DOUBLE, 0, Gen::kMoney, 0, 10},
+              {"l_tax", DOUBLE, 0, Gen::kMoney, 0, 8},
+              {"l_returnflag", VARCHAR, 1, Gen::kChoice, 0, 0, false, kFlags},
+              {"l_linestatus", VARCHAR, 1, Gen::kChoice, 0, 0, false, {"F", "O"}},
+              {"l_shipdate", DATE, 0, Gen::kDate, 1, kNumDays - 1},
+              {"l_commitdate", DATE, 0, Gen::kDate, 30, kNumDays - 1},
+              {"l_receiptdate", DATE, 0, Gen::kDate, 2, kNumDays - 1},
+              {"l_shipinstruct", VARCHAR, 25, Gen::kChoice, 0, 0, false,
+               {"DELIVER IN PERSON", "COLLECT COD", "NONE", "TAKE BACK RETURN"}},
+              {"l_shipmode", VARCHAR, 10, Gen::kChoice, 0, 0, false, kShipModes},
+              {"l_comment", VARCHAR, 44, Gen::kText, 10, 43}}},
+            {"orders",
+             1500000,
+             true,
+             {{"o_orderkey", BIGINT, 0, Gen::kSeq, 1},
+              {"o_custkey", INT, 0, Gen::kUniform, 1, 150000, true},
+              {"o_orderstatus", VARCHAR, 1, Gen::kChoice, 0, 0, false, kOrderStatus},
+              {"o_totalprice", DOUBLE, 0, Gen::kMoney, 85000, 55000000},
+              {"o_orderdate", DATE, 0, Gen::kDate, 0, kNumDays - 152},
+              {"o_orderpriority", VARCHAR, 15, Gen::kChoice, 0, 0, false, kPriorities},
+              {"o_clerk", VARCHAR, 15, Gen::kPrefixUniform, 1, 1000, true, {"Clerk#"}},
+              {"o_shippriority", INT, 0, Gen::kUniform, 0, 0},
+              {"o_comment", VARCHAR, 79, Gen::kText, 19, 78}}},
+            {"customer",
+             150000,
+             true,
+             {{"c_custkey", INT, 0, Gen::kSeq, 1},
+              {"c_name", VARCHAR, 25, Gen::kName, 0, 0, false, {"Customer#"}},
+              {"c_address", VARCHAR, 40, Gen::kText, 10, 40},
+              {"c_nationkey", INT, 0, Gen::kUniform, 0, 24},
+              {"c_phone", VARCHAR, 15, Gen::kText, 15, 15},
+              {"c_acctbal", DOUBLE, 0, Gen::kMoney, -99999, 999999},
+              {"c_mktsegment", VARCHAR, 10, Gen::kChoice, 0, 0, false, kSegments},
+              {"c_comment", VARCHAR, 117, Gen::kText, 29, 116}}},
+            {"part",
+             200000,
+             true,
+             {{"p_partkey", INT, 0, Gen::kSeq, 1},
+              {"p_name", VARCHAR, 55, Gen::kText, 20, 55},
+              {"p_mfgr", VARCHAR, 25, Gen::kPrefixUniform, 1, 5, false, {"Manufacturer#"}},
+              {"p_brand", VARCHAR, 10, Gen::kPrefixUniform, 11, 55, false, {"Brand#"}},
+              {"p_type", VARCHAR, 25, Gen::kChoice, 0, 0, false, kTypes},
+              {"p_size", INT, 0, Gen::kUniform, 1, 50},
+              {"p_container", VARCHAR, 10, Gen::kChoice, 0, 0, false, kContainers},
+              {"p_retailprice", DOUBLE, 0, Gen::kMoney, 90000, 209900},
+              {"p_comment", VARCHAR, 23, Gen::kText, 5, 22}}},
+            {"partsupp",
+             800000,
+             true,
+             {{"ps_partkey", INT, 0, Gen::kSeq, 1, 4},
+              {"ps_suppkey", INT, 0, Gen::kUniform, 1, 10000, true},
+              {"ps_availqty", INT, 0, Gen::kUniform, 1, 9999},
+              {"ps_supplycost", DOUBLE, 0, Gen::kMoney, 100, 100000},
+              {"ps_comment", VARCHAR, 199, Gen::kText, 49, 198}}},
+            {"supplier",
+             10000,
+             true,
+             {{"s_suppkey", INT, 0, Gen::kSeq, 1},
+              {"s_name", VARCHAR, 25, Gen::kName, 0, 0, false, {"Supplier#"}},
+              {"s_address", VARCHAR, 40, Gen::kText, 10, 40},
+              {"s_nationkey", INT, 0, Gen::kUniform, 0, 24},
+              {"s_phone", VARCHAR, 15, Gen::kText, 15, 15},
+              {"s_acctbal", DOUBLE, 0, Gen::kMoney, -99999, 999999},
+              {"s_comment", VARCHAR, 101, Gen::kText, 25, 100}}},
+            {"nation",
+             25,
+             false,
+             {{"n_nationkey", INT, 0, Gen::kSeq, 0},
+              {"n_name", VARCHAR, 25, Gen::kCycle, 0, 0, false, kNations},
+              {"n_regionkey", INT, 0, Gen::kMod, 5},
+              {"n_comment", VARCHAR, 152, Gen::kText, 31, 114}}},
+            {"region",
+             5,
+             false,
+             {{"r_regionkey", INT, 0, Gen::kSeq, 0},
+              {"r_name", VARCHAR, 25, Gen::kCycle, 0, 0, false, kRegions},
+              {"r_comment", VARCHAR, 152, Gen::kText, 31, 115}}},
+    };
+}
+
+class ColumnGenerator {
+public:
+    ColumnGenerator(const ColumnSpec& spec, double scale, int64_t seed) : _spec(spec), _rng(seed) {
+        _max = spec.b;
+        if (spec.scaled) {
+            _max = std::max<int64_t>(spec.a, static_cast<int64_t>(static_cast<double>(spec.b) * scale));
+        }
+    }
+
+    void append(int64_t row, Column* column) {
+        Datum datum;
+        switch (_spec.gen) {
+        case Gen::kSeq:
+            set_integer(row / std::max<int64_t>(_spec.b, 1) + _spec.a, &datum);
+            break;
+        case Gen::kUniform:
+            set_integer(uniform(_spec.a, _max), &datum);
+            break;
+        case Gen::kMoney:
+            datum.set_double(static_cast<double>(uniform(_spec.a, _max)) / 100);
+            break;
+        case Gen::kDate:
+            datum.set_date(day(uniform(_spec.a, _spec.b)));
+            break;
+        case Gen::kDateKey:
+            datum.set_int32(day(uniform(_spec.a, _spec.b)).to_date_literal());
+            break;
+        case Gen::kDatePart:
+            set_date_part(day(row), &datum);
+            break;
+        case Gen::kMod:
+            set_integer(row % _spec.a, &datum);
+            break;
+        case Gen::kChoice:
+            datum.set_slice(Slice(_spec.choices[uniform(0, _spec.choices.size() - 1)]));
+            break;
+        case Gen::kCycle:
+            datum.set_slice(Slice(_spec.choices[row % _spec.choices.size()]));
+            break;
+        case Gen::kName: {
+            char digits[16];
+            snprintf(digits, sizeof(digits), "%09ld", row + 1);
+            _buffer = _spec.choices[0] + digits;
+            datum.set_slice(Slice(_buffer));
+            break;
+        }
+        case Gen::kPrefixUniform:
+            _buffer = _spec.choices[0] + std::to_string(uniform(_spec.a, _max));
+            datum.set_slice(Slice(_buffer));
+            break;
+        case Gen::kText:
+            _buffer.resize(uniform(_spec.a, _spec.b));
+            for (char& c : _buffer) {
+                c = static_cast<char>('a' + uniform(0, 25));
+            }
+            datum.set_slice(Slice(_buffer));
+            break;
+        }
+        column->append_datum(datum);
+    }
+
+private:
+    int64_t uniform(int64_t min, int64_t max) { return std::uniform_int_distribution<int64_t>(min, max)(_rng); }
+
+    static DateValue day(int64_t offset) {
+        return DateValue::create(1992, 1, 1).add<TimeUnit::DAY>(static_cast<int>(offset));
+    }
+
+    void set_integer(int64_t value, Datum* datum) {
+        if (_spec.type == TPrimitiveType::BIGINT) {
+            datum->set_int64(value);
+        } else {
+            datum->set_int32(static_cast<int32_t>(value));
+        }
+    }
+
+    void set_date_part(const DateValue& date, Datum* datum) {
+        static const char* kMonths[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                        "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+        int year = 0;
+        int month = 0;
+        int day = 0;
+        date.to_date(&year, &month, &day);
+        switch (_spec.a) {
+        case 0:
+            datum->set_int32(date.to_date_literal());
+            break;
+        case 1:
+            datum->set_int32(year);
+            break;
+        case 2:
+            datum->set_int32(year * 100 + month);
+            break;
+        case 3:
+            datum->set_int32(month);
+            break;
+        case 4:
+            datum->set_int32((date.julian() - DateValue::create(year, 1, 1).julian()) / 7 + 1);
+            break;
+        default:
+            _buffer = kMonths[month - 1] + std::to_string(year);
+            datum->set_slice(Slice(_buffer));
+            break;
+        }
+    }
+
+    const ColumnSpec& _spec;
+    std::mt19937_64 _rng;
+    int64_t _max;
+    // The slice of the current datum refers to it.
+    std::string _buffer;
+};
+
+Status create_tablet(const TableSpec& table, int64_t tablet_id) {
+    TCreateTabletReq req;
+    req.tablet_id = tablet_id;
+    req.__set_version(1);
+    req.__set_version_hash(0);
+    req.tablet_schema.schema_hash = kSchemaHash;
+    req.tablet_schema.short_key_column_count = 1;
+    req.tablet_schema.keys_type = TKeysType::DUP_KEYS;
+    req.tablet_schema.storage_type = TStorageType::COLUMN;
+    for (size_t i = 0; i < table.columns.size(); ++i) {
+        const auto& spec = table.columns[i];
+        TColumn column;
+        column.column_name = spec.name;
+        column.__set_is_key(i == 0);
+        column.__set_is_allow_null(false);
+        column.column_type.type = spec.type;
+        if (spec.type == TPrimitiveType::VARCHAR) {
+            column.column_type.__set_len(spec.len);
+        }
+        req.tablet_schema.columns.push_back(column);
+    }
+    return StorageEngine::instance()->create_tablet(req);
+}
+
+Status write_table(const TableSpec& table, int64_t tablet_id, double scale, int64_t seed, int64_t* num_rows) {
+    RETURN_IF_ERROR(create_tablet(table, tablet_id));
+    auto* engine = StorageEngine::instance();
+    TabletSharedPtr tablet = engine->tablet_manager()->get_tablet(tablet_id);
+    if (tablet == nullptr) {
+        return Status::NotFound(Substitute("tablet $0 not found after created", tablet_id));
+    }
+
+    RowsetWriterContext writer_context(kDataFormatUnknown, kDataFormatV2);
+    writer_context.rowset_id = engine->next_rowset_id();
+    writer_context.tablet_uid = tablet->tablet_uid();
+    writer_context.tablet_id = tablet->tablet_id();
+    writer_context.tablet_schema_hash = tablet->schema_hash();
+    writer_context.rowset_path_prefix = tablet->schema_hash_path();
+    writer_context.tablet_schema = &(tablet->tablet_schema());
+    writer_context.rowset_state = VISIBLE;
+    writer_context.version = Version(2, 2);
+    std::unique_ptr<RowsetWriter> rowset_writer;
+    RETURN_IF_ERROR(RowsetFactory::create_rowset_writer(writer_context, &rowset_writer));
+
+    std::vector<std::unique_ptr<ColumnGenerator>> generators;
+    for (size_t i = 0; i < table.columns.size(); ++i) {
+        generators.emplace_back(std::make_unique<ColumnGenerator>(table.columns[i], scale, seed + i));
+    }
+    *num_rows = table.scaled ? std::max<int64_t>(1, static_cast<int64_t>(table.base_rows * scale)) : table.base_rows;
+    auto schema = ChunkHelper::convert_schema_to_format_v2(tablet->tablet_schema());
+    int64_t rows_in_segment = 0;
+    for (int64_t row = 0; row < *num_rows;) {
+        auto chunk = ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+        int64_t end = std::min<int64_t>(*num_rows, row + config::vector_chunk_size);
+        for (size_t i = 0; i < generators.size(); ++i) {
+            auto* column = chunk->get_column_by_index(i).get();
+            for (int64_t r = row; r < end; ++r) {
+                generators[i]->append(r, column);
+            }
+        }
+        RETURN_IF_ERROR(rowset_writer->add_chunk(*chunk));
+        rows_in_segment += end - row;
+        if (rows_in_segment >= FLAGS_rows_per_segment) {
+            RETURN_IF_ERROR(rowset_writer->flush());
+            rows_in_segment = 0;
+        }
+        row = end;
+    }
+    RETURN_IF_ERROR(rowset_writer->flush());
+    ASSIGN_OR_RETURN(auto rowset, rowset_writer->build());
+    RETURN_IF_ERROR(tablet->add_rowset(rowset, true));
+    tablet->save_meta();
+    return Status::OK();
+}
+
+int gen_data() {
+    std::vector<TableSpec> tables;
+    if (FLAGS_benchmark == "ssb") {
+        tables = ssb_tables();
+    } else if (FLAGS_benchmark == "tpch") {
+        tables = tpch_tables();
+    } else {
+        std::cerr << "invalid benchmark: " << FLAGS_benchmark << std::endl;
+        return -1;
+    }
+    if (FLAGS_scale <= 0) {
+        std::cerr << "invalid scale: " << FLAGS_scale << std::endl;
+        return -1;
+    }
+    for (size_t i = 0; i < tables.size(); ++i) {
+        const auto& table = tables[i];
+        int64_t tablet_id = FLAGS_tablet_id_base + i;
+        int64_t num_rows = 0;
+        auto start = std::chrono::steady_clock::now();
+        auto st = write_table(table, tablet_id, FLAGS_scale, FLAGS_gen_seed + 1000 * i, &num_rows);
+        if (!st.ok()) {
+            std::cerr << "failed to generate " << table.name << ": " << st.to_string() << std::endl;
+            return -1;
+        }
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << Substitute("table=$0 tablet_id=$1 schema_hash=$2 version=2 rows=$3 time=$4s", table.name,
+                                tablet_id, kSchemaHash, num_rows, elapsed)
+                  << std::endl;
+    }
+    return 0;
+}
+
+// The coordinator of the fragments run by be_bench, it keeps the profile of the last report.
+class ReportCollector : public FrontendServiceNull {
+public:
+    void reportExecStatus(TReportExecStatusResult& result, const TReportExecStatusParams& params) override {
+        std::lock_guard<std::mutex> l(_mutex);
+        if (params.__isset.profile) {
+            _profile = params.profile;
+        }
+        if (params.__isset.done && params.done) {
+            _done = true;
+            _status = Status(params.status);
+            _cv.notify_all();
+        }
+        result.__set_status(TStatus());
+        result.status.__set_status_code(TStatusCode::OK);
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> l(_mutex);
+        _done = false;
+        _profile = TRuntimeProfileTree();
+    }
+
+    // Waits the final report, returns false if it's not received in |timeout|.
+    bool wait(std::chrono::seconds timeout, TRuntimeProfileTree* profile, Status* status) {
+        std::unique_lock<std::mutex> l(_mutex);
+        if (!_cv.wait_for(l, timeout, [this]() { return _done; })) {
+            return false;
+        }
+        *profile = _profile;
+        *status = _status;
+        return true;
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _done = false;
+    Status _status;
+    TRuntimeProfileTree _profile;
+};
+
+Status load_plan(const std::string& path, TExecPlanFragmentParams* params) {
+    std::ifstream file(path);
+    if (!file) {
+        return Status::IOError(Substitute("failed to open $0", path));
+    }
+    std::stringstream json;
+    json << file.rdbuf();
+    try {
+        *params = from_json_string<TExecPlanFragmentParams>(json.str());
+    } catch (std::exception& e) {
+        return Status::InvalidArgument(Substitute("failed to parse $0: $1", path, e.what()));
+    }
+    if (!params->__isset.is_pipeline || !params->is_pipeline) {
+        return Status::NotSupported(Substitute("$0 is not a pipeline fragment", path));
+    }
+    return Status::OK();
+}
+
+// Fills the fields that differ between the runs and the storages.
+Status prepare_plan(TExecPlanFragmentParams* params, const TUniqueId& query_id, const TNetworkAddress& coord) {
+    TUniqueId instance_id = query_id;
+    instance_id.lo += 1;
+    params->params.__set_query_id(query_id);
+    params->params.__set_fragment_instance_id(instance_id);
+    params->__set_coord(coord);
+    params->__set_backend_num(0);
+    params->__set_is_report_success(true);
+    params->query_options.__set_is_report_success(true);
+    params->__isset.query_options = true;
+    for (auto& [node_id, scan_ranges] : params->params.per_node_scan_ranges) {
+        for (auto& scan_range : scan_ranges) {
+            if (!scan_range.scan_range.__isset.internal_scan_range) {
+                continue;
+            }
+            auto& internal = scan_range.scan_range.internal_scan_range;
+            auto tablet = StorageEngine::instance()->tablet_manager()->get_tablet(internal.tablet_id);
+            if (tablet == nullptr) {
+                return Status::NotFound(Substitute("tablet $0 of node $1 not found", internal.tablet_id, node_id));
+            }
+            internal.__set_schema_hash(std::to_string(tablet->schema_hash()));
+            internal.__set_version(std::to_string(tablet->max_version().second));
+            internal.__set_version_hash("0");
+        }
+    }
+    return Status::OK();
+}
+
+Status run_once(ExecEnv* exec_env, ReportCollector* collector, TExecPlanFragmentParams params,
+                const TNetworkAddress& coord, int64_t* elapsed_us, int64_t* num_rows, TRuntimeProfileTree* profile) {
+    TUniqueId query_id = UniqueId::gen_uid().to_thrift();
+    RETURN_IF_ERROR(prepare_plan(&params, query_id, coord));
+    collector->reset();
+
+    auto start = std::chrono::steady_clock::now();
+    pipeline::FragmentExecutor executor;
+    RETURN_IF_ERROR(executor.prepare(exec_env, params));
+    RETURN_IF_ERROR(executor.execute(exec_env));
+    *num_rows = 0;
+    while (true) {
+        TFetchDataResult result;
+        RETURN_IF_ERROR(exec_env->result_mgr()->fetch_data(params.params.fragment_instance_id, &result));
+        *num_rows += result.result_batch.rows.size();
+        if (result.eos) {
+            break;
+        }
+    }
+    *elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)
+                          .count();
+
+    Status status;
+    if (!collector->wait(std::chrono::seconds(60), profile, &status)) {
+        return Status::TimedOut("the final report of the fragment is not received");
+    }
+    return status;
+}
+
+int run(ExecEnv* exec_env) {
+    std::set<std::string> dirs;
+    std::set<std::string> files;
+    auto st = FileUtils::list_dirs_files(FLAGS_plan_dir, &dirs, &files);
+    if (!st.ok()) {
+        std::cerr << "failed to list " << FLAGS_plan_dir << ": " << st.to_string() << std::endl;
+        return -1;
+    }
+    std::vector<std::string> queries;
+    if (!FLAGS_queries.empty()) {
+        std::stringstream ss(FLAGS_queries);
+        for (std::string query; std::getline(ss, query, ',');) {
+            queries.push_back(query);
+        }
+    } else {
+        for (const auto& file : files) {
+            if (file.size() > 5 && file.compare(file.size() - 5, 5, ".json") == 0) {
+                queries.push_back(file.substr(0, file.size() - 5));
+            }
+        }
+    }
+
+    auto collector = std::make_shared<ReportCollector>();
+    ThriftServer server("be_bench_fe", std::make_shared<FrontendServiceProcessor>(collector), FLAGS_fe_stub_port);
+    st = server.start();
+    if (!st.ok()) {
+        std::cerr << "failed to start the stub frontend: " << st.to_string() << std::endl;
+        return -1;
+    }
+    TNetworkAddress coord;
+    coord.__set_hostname("127.0.0.1");
+    coord.__set_port(FLAGS_fe_stub_port);
+
+    int ret = 0;
+    std::cout << "query\trows\tmin_ms\tavg_ms\tmax_ms" << std::endl;
+    for (const auto& query : queries) {
+        TExecPlanFragmentParams params;
+        st = load_plan(FLAGS_plan_dir + "/" + query + ".json", &params);
+        std::vector<int64_t> latencies;
+        int64_t num_rows = 0;
+        TRuntimeProfileTree profile;
+        for (int i = 0; st.ok() && i < FLAGS_warmup_iterations + FLAGS_iterations; ++i) {
+            int64_t elapsed_us = 0;
+            st = run_once(exec_env, collector.get(), params, coord, &elapsed_us, &num_rows, &profile);
+            if (st.ok() && i >= FLAGS_warmup_iterations) {
+                latencies.push_back(elapsed_us);
+            }
+        }
+        if (!st.ok()) {
+            std::cout << query << "\tfailed: " << st.to_string() << std::endl;
+            ret = -1;
+            continue;
+        }
+        if (latencies.empty()) {
+            continue;
+        }
+        auto [min, max] = std::minmax_element(latencies.begin(), latencies.end());
+        double sum = 0;
+        for (auto latency : latencies) {
+            sum += latency;
+        }
+        std::cout << Substitute("$0\t$1\t$2\t$3\t$4", query, num_rows, *min / 1000.0, sum / latencies.size() / 1000,
+                                *max / 1000.0)
+                  << std::endl;
+        if (FLAGS_print_profile && !profile.nodes.empty()) {
+            RuntimeProfile runtime_profile(query);
+            runtime_profile.update(profile);
+            runtime_profile.pretty_print(&std::cout);
+        }
+    }
+    server.stop();
+    return ret;
+}
+
+} // namespace
+
+} // namespace starrocks
+
+int be_bench_main(int argc, char** argv) {
+    using namespace starrocks;
+    gflags::SetUsageMessage("be_bench --bench_operation=gen_data|run [flags], see --helpon=be_bench");
+    google::ParseCommandLineFlags(&argc, &argv, true);
+    if (FLAGS_bench_operation != "gen_data" && FLAGS_bench_operation != "run") {
+        std::cerr << "invalid operation: " << FLAGS_bench_operation << std::endl;
+        return -1;
+    }
+    if (FLAGS_bench_operation == "run" && FLAGS_plan_dir.empty()) {
+        std::cerr << "plan_dir is required by run" << std::endl;
+        return -1;
+    }
+
+    std::string conf = FLAGS_bench_conf;
+    if (conf.empty()) {
+        if (getenv("STARROCKS_HOME") == nullptr) {
+            std::cerr << "you need set STARROCKS_HOME environment variable or bench_conf" << std::endl;
+            return -1;
+        }
+        conf = std::string(getenv("STARROCKS_HOME")) + "/conf/be.conf";
+    }
+    if (!config::init(conf.c_str(), true)) {
+        std::cerr << "failed to read " << conf << std::endl;
+        return -1;
+    }
+    std::vector<StorePath> paths;
+    auto st = parse_conf_store_paths(config::storage_root_path, &paths);
+    if (!st.ok()) {
+        std::cerr << "invalid storage_root_path: " << config::storage_root_path << std::endl;
+        return -1;
+    }
+
+    auto daemon = std::make_unique<Daemon>();
+    daemon->init(argc, argv, paths);
+    if (!BackendOptions::init()) {
+        return -1;
+    }
+
+    auto* exec_env = ExecEnv::GetInstance();
+    EXIT_IF_ERROR(exec_env->init_mem_tracker());
+    EngineOptions options;
+    options.store_paths = paths;
+    options.backend_uid = UniqueId::gen_uid();
+    options.tablet_meta_mem_tracker = exec_env->tablet_meta_mem_tracker();
+    options.schema_change_mem_tracker = exec_env->schema_change_mem_tracker();
+    options.compaction_mem_tracker = exec_env->compaction_mem_tracker();
+    options.update_mem_tracker = exec_env->update_mem_tracker();
+    StorageEngine* engine = nullptr;
+    st = StorageEngine::open(options, &engine);
+    if (!st.ok()) {
+        std::cerr << "failed to open the storage engine: " << st.to_string() << std::endl;
+        return -1;
+    }
+    EXIT_IF_ERROR(ExecEnv::init(exec_env, paths));
+    exec_env->set_storage_engine(engine);
+
+    // The background threads of the storage engine are not started, nothing is compacted during the benchmarks.
+    int ret = FLAGS_bench_operation == "gen_data" ? gen_data() : run(exec_env);
+
+    daemon->stop();
+    engine->stop();
+    delete engine;
+    exec_env->set_storage_engine(nullptr);
+    ExecEnv::destroy(exec_env);
+    return ret;
+}
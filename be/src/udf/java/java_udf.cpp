@@ -105,10 +105,14 @@ void JVMFunctionHelper::_init() {
                                                   "(Ljava/lang/Object;Ljava/lang/reflect/Method;I)[Ljava/lang/Object;");
     _int_batch_call = _env->GetStaticMethodID(_udf_helper_class, "batchCall",
                                               "([Ljava/lang/Object;Ljava/lang/reflect/Method;I)[I");
+    _get_result_from_boxed_array =
+            _env->GetStaticMethodID(_udf_helper_class, "getResultFromBoxedArray",
+                                    "(I[Ljava/lang/Object;ILjava/nio/ByteBuffer;Ljava/nio/ByteBuffer;)V");
     _direct_buffer_class = _env->FindClass("java/nio/ByteBuffer");
     _direct_buffer_clear = _env->GetMethodID(_direct_buffer_class, "clear", "()Ljava/nio/Buffer;");
     DCHECK(_batch_call);
     DCHECK(_batch_call_no_args);
+    DCHECK(_get_result_from_boxed_array);
     DCHECK(_direct_buffer_clear);
 
     _list_get = _env->GetMethodID(_list_class, "get", "(I)Ljava/lang/Object;");
@@ -270,6 +274,13 @@ jobject JVMFunctionHelper::int_batch_call(FunctionContext* ctx, jobject callers,
     return res;
 }
 
+void JVMFunctionHelper::get_result_from_boxed_array(FunctionContext* ctx, int type, jobject result, int num_rows,
+                                                    DirectByteBuffer* null_buff, DirectByteBuffer* data_buff) {
+    _env->CallStaticVoidMethod(_udf_helper_class, _get_result_from_boxed_array, type, result, num_rows,
+                               null_buff->handle(), data_buff->handle());
+    check_call_exception(_env, ctx);
+}
+
 jobject JVMFunctionHelper::list_get(jobject obj, int idx) {
     return _env->CallObjectMethod(obj, _list_get, idx);
 }
@@ -68,6 +68,10 @@ public:
     // callers should be Object[]
     // return: jobject int[]
     jobject int_batch_call(FunctionContext* ctx, jobject callers, jobject method, int rows);
+    // unbox the numeric results into the null buffer and data buffer by one JNI call
+    // result should be Object[]
+    void get_result_from_boxed_array(FunctionContext* ctx, int type, jobject result, int num_rows,
+                                     DirectByteBuffer* null_buff, DirectByteBuffer* data_buff);
 
     // List methods
     jobject list_get(jobject obj, int idx);
@@ -138,6 +142,7 @@ private:
     jmethodID _batch_call;
     jmethodID _batch_call_no_args;
     jmethodID _int_batch_call;
+    jmethodID _get_result_from_boxed_array;
     jclass _direct_buffer_class;
     jmethodID _direct_buffer_clear;
 };
@@ -31,6 +31,7 @@
 
 namespace arrow {
 
+class DataType;
 class RecordBatch;
 class Schema;
 
@@ -39,6 +40,10 @@ class Schema;
 namespace starrocks {
 
 class RowDescriptor;
+struct TypeDescriptor;
+
+// Convert StarRocks type to Arrow type.
+Status convert_to_arrow_type(const TypeDescriptor& type, std::shared_ptr<arrow::DataType>* result);
 
 // Convert StarRocks RowDescriptor to Arrow Schema.
 Status convert_to_arrow_schema(const RowDescriptor& row_desc, std::shared_ptr<arrow::Schema>* result);
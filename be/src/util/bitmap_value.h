@@ -32,6 +32,7 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/config.h"
 #include "common/logging.h"
@@ -781,10 +782,21 @@ public:
      * pointer).
      */
     static Roaring64Map fastunion(size_t n, const Roaring64Map** inputs) {
-        Roaring64Map ans;
-        // not particularly fast
+        // Group the 32-bit bitmaps by the high 32 bits, and union each group at once by Roaring::fastunion,
+        // which merges the containers of the same key together instead of building the intermediate results.
+        std::map<uint32_t, std::vector<const Roaring*>> groups;
         for (size_t lcv = 0; lcv < n; ++lcv) {
-            ans |= *(inputs[lcv]);
+            for (const auto& map_entry : inputs[lcv]->roarings) {
+                groups[map_entry.first].push_back(&map_entry.second);
+            }
+        }
+        Roaring64Map ans;
+        for (const auto& [high, group] : groups) {
+            if (group.size() == 1) {
+                ans.roarings.emplace(high, *group[0]);
+            } else {
+                ans.roarings.emplace(high, Roaring::fastunion(group.size(), group.data()));
+            }
         }
         return ans;
     }
@@ -1108,6 +1120,50 @@ public:
         return *this;
     }
 
+    // Compute the union between the current bitmap and the |n| provided bitmaps at once, e.g. the bitmaps of
+    // a chunk merged into one aggregate state. The roaring bitmaps are merged by Roaring64Map::fastunion in
+    // one pass, the single values and the small sets are added to the result afterwards.
+    void fast_union(size_t n, const BitmapValue* const* values) {
+        std::vector<const detail::Roaring64Map*> bitmaps;
+        for (size_t i = 0; i < n; ++i) {
+            if (values[i]->_type == BITMAP) {
+                bitmaps.push_back(values[i]->_bitmap.get());
+            }
+        }
+        // Nothing to gain from fastunion.
+        if (bitmaps.size() < 2) {
+            for (size_t i = 0; i < n; ++i) {
+                *this |= *values[i];
+            }
+            return;
+        }
+
+        if (_type == BITMAP) {
+            bitmaps.push_back(_bitmap.get());
+        }
+        auto bitmap = std::make_shared<detail::Roaring64Map>(
+                detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data()));
+        if (_type == SINGLE) {
+            bitmap->add(_sv);
+        } else if (_type == SET) {
+            for (const auto& x : _set) {
+                bitmap->add(x);
+            }
+            _set.clear();
+        }
+        for (size_t i = 0; i < n; ++i) {
+            if (values[i]->_type == SINGLE) {
+                bitmap->add(values[i]->_sv);
+            } else if (values[i]->_type == SET) {
+                for (const auto& x : values[i]->_set) {
+                    bitmap->add(x);
+                }
+            }
+        }
+        _bitmap = std::move(bitmap);
+        _type = BITMAP;
+    }
+
     // Note: rhs BitmapValue is only readable after this method
     // Compute the intersection between the current bitmap and the provided bitmap.
     // Possible type transitions are:
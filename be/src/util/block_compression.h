@@ -22,6 +22,8 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "common/status.h"
@@ -63,6 +65,9 @@ public:
     virtual bool exceed_max_input_size(size_t len) const { return false; }
 
     virtual size_t max_input_size() const { return std::numeric_limits<size_t>::max(); }
+
+    // The memory used by the codec, which is only non-zero for the codecs created with a dictionary.
+    virtual size_t mem_usage() const { return 0; }
 };
 
 // Get a BlockCompressionCodec through type.
@@ -73,4 +78,12 @@ public:
 // Return not OK, if error happens.
 Status get_block_compression_codec(CompressionTypePB type, const BlockCompressionCodec** codec);
 
+// Train a zstd dictionary of at most |max_dict_size| bytes from |samples| into |dict|.
+// Return not OK if the samples are too few or too small to train a dictionary.
+Status train_zstd_dictionary(const std::vector<Slice>& samples, size_t max_dict_size, std::string* dict);
+
+// Create a ZSTD codec compressing and decompressing with the dictionary |dict|, which is copied.
+// The data compressed by it can only be decompressed with the same dictionary.
+Status create_zstd_dict_codec(const Slice& dict, std::unique_ptr<BlockCompressionCodec>* codec);
+
 } // namespace starrocks
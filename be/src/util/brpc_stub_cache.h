@@ -21,9 +21,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <vector>
 
+#include "common/config.h"
 #include "gen_cpp/Types_types.h" // TNetworkAddress
 #include "gen_cpp/doris_internal_service.pb.h"
 #include "gen_cpp/internal_service.pb.h"
@@ -33,7 +37,32 @@
 
 namespace starrocks {
 
-// map used
+// MeteredChannel counts the bytes of the requests sent over its connection.
+class MeteredChannel final : public google::protobuf::RpcChannel {
+public:
+    MeteredChannel() : _sent_bytes(MetricUnit::BYTES) {}
+
+    int init(const butil::EndPoint& endpoint, const brpc::ChannelOptions& options) {
+        return _channel.Init(endpoint, &options);
+    }
+
+    void CallMethod(const google::protobuf::MethodDescriptor* method, google::protobuf::RpcController* controller,
+                    const google::protobuf::Message* request, google::protobuf::Message* response,
+                    google::protobuf::Closure* done) override {
+        auto* cntl = static_cast<brpc::Controller*>(controller);
+        _sent_bytes.increment(request->ByteSizeLong() + cntl->request_attachment().size());
+        _channel.CallMethod(method, controller, request, response, done);
+    }
+
+    IntCounter* sent_bytes() { return &_sent_bytes; }
+
+private:
+    brpc::Channel _channel;
+    IntCounter _sent_bytes;
+};
+
+// BrpcStubCache keeps config::brpc_connections_per_endpoint stubs for every endpoint, each of which has its own
+// connection. The callers spread their rpcs over the connections by a shard key, e.g. the fragment instance.
 class BrpcStubCache {
 public:
     BrpcStubCache() {
@@ -44,39 +73,43 @@ public:
         });
     }
     ~BrpcStubCache() {
-        for (auto& stub : _stub_map) {
-            delete stub.second;
+        for (auto& stubs : _stub_map) {
+            for (auto& stub : stubs.second) {
+                StarRocksMetrics::instance()->metrics()->deregister_metric(stub.channel->sent_bytes());
+                delete stub.stub;
+            }
         }
     }
 
-    doris::PBackendService_Stub* get_stub(const butil::EndPoint& endpoint) {
+    doris::PBackendService_Stub* get_stub(const butil::EndPoint& endpoint, int64_t shard_key = 0) {
         std::lock_guard<SpinLock> l(_lock);
-        auto stub_ptr = _stub_map.seek(endpoint);
-        if (stub_ptr != nullptr) {
-            return *stub_ptr;
+        auto stubs_ptr = _stub_map.seek(endpoint);
+        if (stubs_ptr == nullptr) {
+            std::vector<MeteredStub> stubs;
+            const int num_connections = std::max(1, config::brpc_connections_per_endpoint);
+            for (int i = 0; i < num_connections; i++) {
+                auto stub = _create_stub(endpoint, i);
+                if (stub.stub == nullptr) {
+                    for (auto& created : stubs) {
+                        StarRocksMetrics::instance()->metrics()->deregister_metric(created.channel->sent_bytes());
+                        delete created.stub;
+                    }
+                    return nullptr;
+                }
+                stubs.push_back(stub);
+            }
+            stubs_ptr = _stub_map.insert(endpoint, std::move(stubs));
         }
-        // new one stub and insert into map
-        brpc::ChannelOptions options;
-        options.connect_timeout_ms = 3000;
-        // Explicitly set the max_retry
-        // TODO(meegoo): The retry strategy can be customized in the future
-        options.max_retry = 3;
-        std::unique_ptr<brpc::Channel> channel(new brpc::Channel());
-        if (channel->Init(endpoint, &options)) {
-            return nullptr;
-        }
-        auto stub = new doris::PBackendService_Stub(channel.release(), google::protobuf::Service::STUB_OWNS_CHANNEL);
-        _stub_map.insert(endpoint, stub);
-        return stub;
+        return (*stubs_ptr)[static_cast<uint64_t>(shard_key) % stubs_ptr->size()].stub;
     }
 
-    doris::PBackendService_Stub* get_stub(const TNetworkAddress& taddr) {
+    doris::PBackendService_Stub* get_stub(const TNetworkAddress& taddr, int64_t shard_key = 0) {
         butil::EndPoint endpoint;
         if (str2endpoint(taddr.hostname.c_str(), taddr.port, &endpoint)) {
             LOG(WARNING) << "unknown endpoint, hostname=" << taddr.hostname;
             return nullptr;
         }
-        return get_stub(endpoint);
+        return get_stub(endpoint, shard_key);
     }
 
     doris::PBackendService_Stub* get_stub(const std::string& host, int port) {
@@ -89,8 +122,34 @@ public:
     }
 
 private:
+    struct MeteredStub {
+        doris::PBackendService_Stub* stub;
+        MeteredChannel* channel;
+    };
+
+    MeteredStub _create_stub(const butil::EndPoint& endpoint, int connection) {
+        brpc::ChannelOptions options;
+        options.connect_timeout_ms = 3000;
+        // Explicitly set the max_retry
+        // TODO(meegoo): The retry strategy can be customized in the future
+        options.max_retry = 3;
+        // The channels of different connection groups don't share the single connection to the same endpoint.
+        options.connection_group = std::to_string(connection);
+        std::unique_ptr<MeteredChannel> channel(new MeteredChannel());
+        if (channel->init(endpoint, options)) {
+            return {nullptr, nullptr};
+        }
+        MetricLabels labels;
+        labels.add("endpoint", butil::endpoint2str(endpoint).c_str()).add("connection", std::to_string(connection));
+        StarRocksMetrics::instance()->metrics()->register_metric("brpc_connection_sent_bytes", labels,
+                                                                 channel->sent_bytes());
+        MeteredChannel* metered_channel = channel.get();
+        auto stub = new doris::PBackendService_Stub(channel.release(), google::protobuf::Service::STUB_OWNS_CHANNEL);
+        return {stub, metered_channel};
+    }
+
     SpinLock _lock;
-    butil::FlatMap<butil::EndPoint, doris::PBackendService_Stub*> _stub_map;
+    butil::FlatMap<butil::EndPoint, std::vector<MeteredStub>> _stub_map;
 };
 
 } // namespace starrocks
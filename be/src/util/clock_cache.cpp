@@ -0,0 +1,321 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "util/clock_cache.h"
+
+#include <rapidjson/document.h>
+
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+ClockCacheShard::ClockCacheShard() : _buckets(16, nullptr) {}
+
+ClockCacheShard::~ClockCacheShard() {
+    prune();
+}
+
+ClockHandle** ClockCacheShard::_find_pointer(const CacheKey& key, uint32_t hash) {
+    ClockHandle** ptr = &_buckets[hash & (_buckets.size() - 1)];
+    while (*ptr != nullptr && ((*ptr)->hash != hash || key != (*ptr)->key())) {
+        ptr = &(*ptr)->next_hash;
+    }
+    return ptr;
+}
+
+void ClockCacheShard::_resize() {
+    std::vector<ClockHandle*> new_buckets(_buckets.size() * 2, nullptr);
+    for (ClockHandle* h : _buckets) {
+        while (h != nullptr) {
+            ClockHandle* next = h->next_hash;
+            ClockHandle** ptr = &new_buckets[h->hash & (new_buckets.size() - 1)];
+            h->next_hash = *ptr;
+            *ptr = h;
+            h = next;
+        }
+    }
+    _buckets.swap(new_buckets);
+}
+
+void ClockCacheShard::_ring_append(ClockHandle* e) {
+    // Make "e" the last entry to be checked by the clock hand.
+    if (_hand == nullptr) {
+        e->next = e->prev = e;
+        _hand = e;
+    } else {
+        e->next = _hand;
+        e->prev = _hand->prev;
+        e->prev->next = e;
+        e->next->prev = e;
+    }
+}
+
+void ClockCacheShard::_ring_remove(ClockHandle* e) {
+    if (e->next == e) {
+        _hand = nullptr;
+    } else {
+        if (_hand == e) {
+            _hand = e->next;
+        }
+        e->next->prev = e->prev;
+        e->prev->next = e->next;
+    }
+    e->prev = e->next = nullptr;
+}
+
+bool ClockCacheShard::_remove_from_cache(ClockHandle* e) {
+    DCHECK(e->in_cache);
+    ClockHandle** ptr = _find_pointer(e->key(), e->hash);
+    DCHECK_EQ(*ptr, e);
+    *ptr = e->next_hash;
+    --_elems;
+    _ring_remove(e);
+    e->in_cache = false;
+    _usage.store(_usage.load(std::memory_order_relaxed) - e->charge, std::memory_order_relaxed);
+    return e->refs.fetch_sub(1, std::memory_order_acq_rel) == 1;
+}
+
+void ClockCacheShard::_evict(size_t charge, std::vector<ClockHandle*>* deleted) {
+    // The normal entries are evicted first. Each sweep goes around the clock at most twice, the first
+    // round clears the reference bits and the second one evicts the entries not referenced since then.
+    for (bool evict_durable : {false, true}) {
+        size_t steps = 2 * static_cast<size_t>(_elems);
+        while (_usage.load(std::memory_order_relaxed) + charge > _capacity && _hand != nullptr && steps-- > 0) {
+            ClockHandle* e = _hand;
+            _hand = e->next;
+            // No new handle can be returned while the lock is held exclusively, so an entry only
+            // referenced by the cache stays unused.
+            if (e->refs.load(std::memory_order_acquire) > 1) {
+                continue;
+            }
+            if (e->priority == CachePriority::DURABLE && !evict_durable) {
+                continue;
+            }
+            if (e->referenced.exchange(false, std::memory_order_relaxed)) {
+                continue;
+            }
+            if (_remove_from_cache(e)) {
+                deleted->push_back(e);
+            }
+        }
+    }
+}
+
+Cache::Handle* ClockCacheShard::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
+                                       void (*deleter)(const CacheKey& key, void* value), CachePriority priority) {
+    void* mem = malloc(sizeof(ClockHandle) - 1 + key.size());
+    auto* e = new (mem) ClockHandle();
+    e->value = value;
+    e->deleter = deleter;
+    e->next_hash = nullptr;
+    e->next = e->prev = nullptr;
+    e->charge = charge;
+    e->key_length = key.size();
+    e->refs.store(2, std::memory_order_relaxed); // one for the returned handle, one for the cache.
+    // A new entry is evicted by the first sweep unless it's looked up again, so a large scan
+    // doesn't flush the entries used repeatedly.
+    e->referenced.store(false, std::memory_order_relaxed);
+    e->in_cache = true;
+    e->hash = hash;
+    e->priority = priority;
+    memcpy(e->key_data, key.data(), key.size());
+
+    std::vector<ClockHandle*> last_ref_list;
+    {
+        std::unique_lock l(_mutex);
+
+        // Note that the cache might get larger than its capacity if not enough space was freed
+        _evict(charge, &last_ref_list);
+
+        ClockHandle** ptr = _find_pointer(key, hash);
+        ClockHandle* old = *ptr;
+        if (old != nullptr && _remove_from_cache(old)) {
+            last_ref_list.push_back(old);
+        }
+        // The table may be changed by removing the old entry.
+        ptr = _find_pointer(key, hash);
+        e->next_hash = *ptr;
+        *ptr = e;
+        if (++_elems > _buckets.size()) {
+            // Since each cache entry is fairly large, we aim for a small average linked list length (<= 1).
+            _resize();
+        }
+        _ring_append(e);
+        _usage.store(_usage.load(std::memory_order_relaxed) + charge, std::memory_order_relaxed);
+    }
+
+    // we free the entries here outside of mutex for performance reasons
+    for (auto entry : last_ref_list) {
+        entry->free();
+    }
+    return reinterpret_cast<Cache::Handle*>(e);
+}
+
+Cache::Handle* ClockCacheShard::lookup(const CacheKey& key, uint32_t hash) {
+    std::shared_lock l(_mutex);
+    _lookup_count.fetch_add(1, std::memory_order_relaxed);
+    ClockHandle* e = *_find_pointer(key, hash);
+    if (e != nullptr) {
+        e->refs.fetch_add(1, std::memory_order_relaxed);
+        // Avoid writing the cache line shared by the concurrent lookups if the bit is already set.
+        if (!e->referenced.load(std::memory_order_relaxed)) {
+            e->referenced.store(true, std::memory_order_relaxed);
+        }
+        _hit_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    return reinterpret_cast<Cache::Handle*>(e);
+}
+
+void ClockCacheShard::release(Cache::Handle* handle) {
+    if (handle == nullptr) {
+        return;
+    }
+    auto* e = reinterpret_cast<ClockHandle*>(handle);
+    // The entry in the cache is also referenced by the cache, so only the entries removed from the
+    // cache can be freed here.
+    if (e->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        DCHECK(!e->in_cache);
+        e->free();
+    }
+}
+
+void ClockCacheShard::erase(const CacheKey& key, uint32_t hash) {
+    ClockHandle* e = nullptr;
+    bool last_ref = false;
+    {
+        std::unique_lock l(_mutex);
+        e = *_find_pointer(key, hash);
+        if (e != nullptr) {
+            last_ref = _remove_from_cache(e);
+        }
+    }
+    // free handle out of mutex, when last_ref is true, e must not be nullptr
+    if (last_ref) {
+        e->free();
+    }
+}
+
+int ClockCacheShard::prune() {
+    std::vector<ClockHandle*> last_ref_list;
+    {
+        std::unique_lock l(_mutex);
+        std::vector<ClockHandle*> unused;
+        ClockHandle* e = _hand;
+        for (uint32_t i = 0; i < _elems; ++i, e = e->next) {
+            if (e->refs.load(std::memory_order_acquire) == 1) {
+                unused.push_back(e);
+            }
+        }
+        for (auto entry : unused) {
+            if (_remove_from_cache(entry)) {
+                last_ref_list.push_back(entry);
+            }
+        }
+    }
+    for (auto entry : last_ref_list) {
+        entry->free();
+    }
+    return last_ref_list.size();
+}
+
+inline uint32_t ShardedClockCache::_hash_slice(const CacheKey& s) {
+    return s.hash(s.data(), s.size(), 0);
+}
+
+uint32_t ShardedClockCache::_shard(uint32_t hash) {
+    return hash >> (32 - kNumClockShardBits);
+}
+
+ShardedClockCache::ShardedClockCache(size_t capacity) {
+    const size_t per_shard = (capacity + (kNumClockShards - 1)) / kNumClockShards;
+    for (auto& shard : _shards) {
+        shard.set_capacity(per_shard);
+    }
+}
+
+Cache::Handle* ShardedClockCache::insert(const CacheKey& key, void* value, size_t charge,
+                                         void (*deleter)(const CacheKey& key, void* value), CachePriority priority) {
+    const uint32_t hash = _hash_slice(key);
+    return _shards[_shard(hash)].insert(key, hash, value, charge, deleter, priority);
+}
+
+Cache::Handle* ShardedClockCache::lookup(const CacheKey& key) {
+    const uint32_t hash = _hash_slice(key);
+    return _shards[_shard(hash)].lookup(key, hash);
+}
+
+void ShardedClockCache::release(Handle* handle) {
+    auto* h = reinterpret_cast<ClockHandle*>(handle);
+    _shards[_shard(h->hash)].release(handle);
+}
+
+void ShardedClockCache::erase(const CacheKey& key) {
+    const uint32_t hash = _hash_slice(key);
+    _shards[_shard(hash)].erase(key, hash);
+}
+
+void* ShardedClockCache::value(Handle* handle) {
+    return reinterpret_cast<ClockHandle*>(handle)->value;
+}
+
+Slice ShardedClockCache::value_slice(Handle* handle) {
+    auto* clock_handle = reinterpret_cast<ClockHandle*>(handle);
+    return Slice((char*)clock_handle->value, clock_handle->charge);
+}
+
+uint64_t ShardedClockCache::new_id() {
+    return _last_id.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+void ShardedClockCache::prune() {
+    int num_prune = 0;
+    for (auto& shard : _shards) {
+        num_prune += shard.prune();
+    }
+    VLOG(7) << "Successfully prune cache, clean " << num_prune << " entries.";
+}
+
+size_t ShardedClockCache::get_memory_usage() {
+    size_t total_usage = 0;
+    for (const auto& shard : _shards) {
+        total_usage += shard.get_usage();
+    }
+    return total_usage;
+}
+
+void ShardedClockCache::get_cache_status(rapidjson::Document* document) {
+    for (const auto& shard : _shards) {
+        size_t capacity = shard.get_capacity();
+        size_t usage = shard.get_usage();
+        rapidjson::Value shard_info(rapidjson::kObjectType);
+        shard_info.AddMember("capacity", static_cast<double>(capacity), document->GetAllocator());
+        shard_info.AddMember("usage", static_cast<double>(usage), document->GetAllocator());
+
+        float usage_ratio = 0.0f;
+        if (0 != capacity) {
+            usage_ratio = static_cast<float>(usage) / static_cast<float>(capacity);
+        }
+        shard_info.AddMember("usage_ratio", usage_ratio, document->GetAllocator());
+
+        size_t lookup_count = shard.get_lookup_count();
+        size_t hit_count = shard.get_hit_count();
+        shard_info.AddMember("lookup_count", static_cast<double>(lookup_count), document->GetAllocator());
+        shard_info.AddMember("hit_count", static_cast<double>(hit_count), document->GetAllocator());
+
+        float hit_ratio = 0.0f;
+        if (0 != lookup_count) {
+            hit_ratio = static_cast<float>(hit_count) / static_cast<float>(lookup_count);
+        }
+        shard_info.AddMember("hit_ratio", hit_ratio, document->GetAllocator());
+        document->PushBack(shard_info, document->GetAllocator());
+    }
+}
+
+Cache* new_clock_cache(size_t capacity) {
+    return new ShardedClockCache(capacity);
+}
+
+} // namespace starrocks
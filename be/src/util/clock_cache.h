@@ -0,0 +1,123 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <atomic>
+#include <shared_mutex>
+#include <vector>
+
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+// Create a new cache with a fixed size capacity. This implementation of Cache uses the CLOCK
+// eviction policy, lookups only take the shard lock in shared mode.
+extern Cache* new_clock_cache(size_t capacity);
+
+// An entry is a variable length heap-allocated structure. The entries in the cache are kept in a
+// circular doubly linked list, which is swept by the clock hand in the insertion order.
+struct ClockHandle {
+    void* value;
+    void (*deleter)(const CacheKey&, void* value);
+    ClockHandle* next_hash;
+    ClockHandle* next;
+    ClockHandle* prev;
+    size_t charge;
+    size_t key_length;
+    // One for the cache if it's in the cache, and one for each handle returned to the users.
+    std::atomic<uint32_t> refs;
+    // Set by the lookups, and cleared by the clock hand, which only evicts the unreferenced entries.
+    std::atomic<bool> referenced;
+    bool in_cache;
+    uint32_t hash;
+    CachePriority priority;
+    char key_data[1]; // Beginning of key
+
+    CacheKey key() const { return CacheKey(key_data, key_length); }
+
+    void free() {
+        (*deleter)(key(), value);
+        this->~ClockHandle();
+        ::free(this);
+    }
+};
+
+// A single shard of sharded cache.
+//
+// Unlike LRUCache, a hit doesn't move the entry in a list, so lookup() only takes the lock in shared
+// mode, and release() takes no lock. insert(), erase() and prune() take the lock in exclusive mode.
+class ClockCacheShard {
+public:
+    ClockCacheShard();
+    ~ClockCacheShard();
+
+    // Separate from constructor so caller can easily make an array of ClockCacheShard
+    void set_capacity(size_t capacity) { _capacity = capacity; }
+
+    // Like Cache methods, but with an extra "hash" parameter.
+    Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
+                          void (*deleter)(const CacheKey& key, void* value),
+                          CachePriority priority = CachePriority::NORMAL);
+    Cache::Handle* lookup(const CacheKey& key, uint32_t hash);
+    void release(Cache::Handle* handle);
+    void erase(const CacheKey& key, uint32_t hash);
+    int prune();
+
+    uint64_t get_lookup_count() const { return _lookup_count.load(std::memory_order_relaxed); }
+    uint64_t get_hit_count() const { return _hit_count.load(std::memory_order_relaxed); }
+    size_t get_usage() const { return _usage.load(std::memory_order_relaxed); }
+    size_t get_capacity() const { return _capacity; }
+
+private:
+    ClockHandle** _find_pointer(const CacheKey& key, uint32_t hash);
+    void _resize();
+    void _ring_append(ClockHandle* e);
+    void _ring_remove(ClockHandle* e);
+    // Removes |e| from the hash table and the ring, and drops the reference of the cache.
+    // Returns true if it's the last reference.
+    bool _remove_from_cache(ClockHandle* e);
+    void _evict(size_t charge, std::vector<ClockHandle*>* deleted);
+
+    // Initialized before use.
+    size_t _capacity{0};
+
+    // _mutex protects the following state, _usage is only modified with it held exclusively.
+    std::shared_mutex _mutex;
+    std::atomic<size_t> _usage{0};
+    // The next entry to be checked by the clock, nullptr if the cache is empty.
+    ClockHandle* _hand{nullptr};
+    std::vector<ClockHandle*> _buckets;
+    uint32_t _elems{0};
+
+    std::atomic<uint64_t> _lookup_count{0};
+    std::atomic<uint64_t> _hit_count{0};
+};
+
+static const int kNumClockShardBits = 6;
+static const int kNumClockShards = 1 << kNumClockShardBits;
+
+class ShardedClockCache : public Cache {
+public:
+    explicit ShardedClockCache(size_t capacity);
+    ~ShardedClockCache() override = default;
+    Handle* insert(const CacheKey& key, void* value, size_t charge, void (*deleter)(const CacheKey& key, void* value),
+                   CachePriority priority = CachePriority::NORMAL) override;
+    Handle* lookup(const CacheKey& key) override;
+    void release(Handle* handle) override;
+    void erase(const CacheKey& key) override;
+    void* value(Handle* handle) override;
+    Slice value_slice(Handle* handle) override;
+    uint64_t new_id() override;
+    void prune() override;
+    size_t get_memory_usage() override;
+    void get_cache_status(rapidjson::Document* document) override;
+
+private:
+    static uint32_t _hash_slice(const CacheKey& s);
+    static uint32_t _shard(uint32_t hash);
+
+    ClockCacheShard _shards[kNumClockShards];
+    std::atomic<uint64_t> _last_id{0};
+};
+
+} // namespace starrocks
@@ -38,6 +38,7 @@
 #include <spe.h>
 #endif
 
+#include <pthread.h>
 #include <sched.h>
 #include <sys/sysinfo.h>
 #include <unistd.h>
@@ -311,6 +312,26 @@ int CpuInfo::get_current_core() {
 #endif
 }
 
+bool CpuInfo::bind_current_thread_to_numa_node(int node) {
+    DCHECK_LE(0, node);
+    DCHECK_LT(node, max_num_numa_nodes_);
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int core : numa_node_to_cores_[node]) {
+        CPU_SET(core, &cpu_set);
+    }
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (ret != 0) {
+        LOG(WARNING) << "fail to bind thread to numa node " << node << ", error=" << ret;
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
 void CpuInfo::_get_cache_info(long cache_sizes[NUM_CACHE_LEVELS], long cache_line_sizes[NUM_CACHE_LEVELS]) {
 #ifdef __APPLE__
     // On Mac OS X use sysctl() to get the cache sizes
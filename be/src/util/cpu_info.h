@@ -141,6 +141,10 @@ public:
         return numa_node_core_idx_[core];
     }
 
+    /// Binds the current thread to the cores of NUMA node 'node', which must be in the range
+    /// [0, GetMaxNumNumaNodes()). Returns false if it isn't supported or fails.
+    static bool bind_current_thread_to_numa_node(int node);
+
     /// Returns the model name of the cpu (e.g. Intel i7-2600)
     static std::string model_name() {
         DCHECK(initialized_);
@@ -0,0 +1,201 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "util/ddsketch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "common/logging.h"
+#include "util/coding.h"
+
+namespace starrocks {
+
+static const double kGamma = (1 + DDSketch::kRelativeAccuracy) / (1 - DDSketch::kRelativeAccuracy);
+static const double kLogGamma = std::log(kGamma);
+// The estimate of the bucket (gamma^(i-1), gamma^i] whose relative error is at most alpha.
+static const double kBucketValueFactor = 2 / (1 + kGamma);
+// The buckets added beyond the needed ones when the buckets are extended, to avoid copying the counts
+// for each new bucket.
+static constexpr int32_t kExtendBuckets = 64;
+
+int32_t DDSketch::_bucket_index(double value) {
+    return static_cast<int32_t>(std::ceil(std::log(value) / kLogGamma));
+}
+
+double DDSketch::_bucket_value(int32_t index) {
+    return std::exp(index * kLogGamma) * kBucketValueFactor;
+}
+
+void DDSketch::Store::extend(int32_t low, int32_t high) {
+    if (!counts.empty()) {
+        low = std::min(low, offset);
+        high = std::max(high, offset + static_cast<int32_t>(counts.size()) - 1);
+    }
+    if (high - low + 1 > kMaxBuckets) {
+        low = high - kMaxBuckets + 1;
+    } else if (!counts.empty()) {
+        // Leave some room on the side being extended.
+        int32_t room = std::min(kExtendBuckets, kMaxBuckets - (high - low + 1));
+        if (low < offset) {
+            low -= room;
+        } else {
+            high += room;
+        }
+    }
+
+    std::vector<uint64_t> new_counts(high - low + 1, 0);
+    for (size_t i = 0; i < counts.size(); ++i) {
+        int32_t index = std::max(offset + static_cast<int32_t>(i), low);
+        new_counts[index - low] += counts[i];
+    }
+    counts.swap(new_counts);
+    offset = low;
+}
+
+void DDSketch::Store::add(int32_t index, uint64_t count) {
+    const auto num_buckets = static_cast<int32_t>(counts.size());
+    if (counts.empty() || index >= offset + num_buckets || (index < offset && num_buckets < kMaxBuckets)) {
+        extend(index, index);
+    }
+    // The index is lower than the kept buckets if they are collapsed.
+    counts[std::max(index, offset) - offset] += count;
+    total += count;
+}
+
+void DDSketch::Store::merge(const Store& other) {
+    if (other.counts.empty()) {
+        return;
+    }
+    const auto num_buckets = static_cast<int32_t>(counts.size());
+    int32_t other_high = other.offset + static_cast<int32_t>(other.counts.size()) - 1;
+    if (counts.empty() || other_high >= offset + num_buckets || (other.offset < offset && num_buckets < kMaxBuckets)) {
+        extend(other.offset, other_high);
+    }
+    for (size_t i = 0; i < other.counts.size(); ++i) {
+        int32_t index = std::max(other.offset + static_cast<int32_t>(i), offset);
+        counts[index - offset] += other.counts[i];
+    }
+    total += other.total;
+}
+
+size_t DDSketch::Store::serialize_size() const {
+    size_t size = sizeof(int32_t) + varint_length(counts.size());
+    for (uint64_t count : counts) {
+        size += varint_length(count);
+    }
+    return size;
+}
+
+uint8_t* DDSketch::Store::serialize(uint8_t* writer) const {
+    memcpy(writer, &offset, sizeof(int32_t));
+    writer += sizeof(int32_t);
+    writer = encode_varint64(writer, counts.size());
+    for (uint64_t count : counts) {
+        writer = encode_varint64(writer, count);
+    }
+    return writer;
+}
+
+const uint8_t* DDSketch::Store::deserialize(const uint8_t* reader) {
+    memcpy(&offset, reader, sizeof(int32_t));
+    reader += sizeof(int32_t);
+    uint64_t num_buckets = 0;
+    reader = decode_varint64_ptr(reader, reader + 10, &num_buckets);
+    DCHECK_LE(num_buckets, kMaxBuckets);
+    counts.resize(num_buckets);
+    total = 0;
+    for (size_t i = 0; i < num_buckets; ++i) {
+        reader = decode_varint64_ptr(reader, reader + 10, &counts[i]);
+        total += counts[i];
+    }
+    return reader;
+}
+
+void DDSketch::add(double value, uint64_t count) {
+    if (!std::isfinite(value) || count == 0) {
+        return;
+    }
+    _min = std::min(_min, value);
+    _max = std::max(_max, value);
+    if (value >= std::numeric_limits<double>::min()) {
+        _positive.add(_bucket_index(value), count);
+    } else if (value <= -std::numeric_limits<double>::min()) {
+        _negative.add(_bucket_index(-value), count);
+    } else {
+        _zero_count += count;
+    }
+}
+
+void DDSketch::add_batch(const double* values, size_t num_values) {
+    for (size_t i = 0; i < num_values; ++i) {
+        add(values[i], 1);
+    }
+}
+
+void DDSketch::merge(const DDSketch& other) {
+    if (other.empty()) {
+        return;
+    }
+    _positive.merge(other._positive);
+    _negative.merge(other._negative);
+    _zero_count += other._zero_count;
+    _min = std::min(_min, other._min);
+    _max = std::max(_max, other._max);
+}
+
+double DDSketch::quantile(double q) const {
+    uint64_t total = count();
+    if (total == 0) {
+        return 0;
+    }
+    q = std::clamp(q, 0.0, 1.0);
+    // the 0-based rank of the value.
+    double rank = q * (total - 1);
+    uint64_t seen = 0;
+    double result = _max;
+    bool found = false;
+    for_each_bucket([&](double value, uint64_t count) {
+        if (found) {
+            return;
+        }
+        seen += count;
+        if (seen > rank) {
+            result = value;
+            found = true;
+        }
+    });
+    // The estimates of the lowest and highest buckets may be out of the range of the values.
+    return std::clamp(result, _min, _max);
+}
+
+size_t DDSketch::serialize_size() const {
+    return varint_length(_zero_count) + sizeof(double) * 2 + _positive.serialize_size() +
+           _negative.serialize_size();
+}
+
+size_t DDSketch::serialize(uint8_t* writer) const {
+    uint8_t* begin = writer;
+    writer = encode_varint64(writer, _zero_count);
+    memcpy(writer, &_min, sizeof(double));
+    writer += sizeof(double);
+    memcpy(writer, &_max, sizeof(double));
+    writer += sizeof(double);
+    writer = _positive.serialize(writer);
+    writer = _negative.serialize(writer);
+    return writer - begin;
+}
+
+size_t DDSketch::deserialize(const uint8_t* reader) {
+    const uint8_t* begin = reader;
+    reader = decode_varint64_ptr(reader, reader + 10, &_zero_count);
+    memcpy(&_min, reader, sizeof(double));
+    reader += sizeof(double);
+    memcpy(&_max, reader, sizeof(double));
+    reader += sizeof(double);
+    reader = _positive.deserialize(reader);
+    reader = _negative.deserialize(reader);
+    return reader - begin;
+}
+
+} // namespace starrocks
@@ -0,0 +1,98 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace starrocks {
+
+// DDSketch is a quantile sketch with relative error guarantees, see
+// DDSketch: A Fast and Fully-Mergeable Quantile Sketch with Relative-Error Guarantees (VLDB 2019).
+//
+// A positive value x is counted in the bucket ceil(log_gamma(x)), gamma = (1 + alpha) / (1 - alpha), so
+// every value is estimated within the relative error alpha by the bucket it falls in. The negative values
+// are counted by their absolute values in another store. Each store keeps at most kMaxBuckets buckets, the
+// lowest buckets are collapsed into one if there are more, which only loses the accuracy of the values
+// closest to zero.
+//
+// Unlike TDigest, adding a value only increases a counter, merging two sketches only adds the counters of
+// the same buckets, and the serialized size is bounded by the number of buckets.
+class DDSketch {
+public:
+    static constexpr double kRelativeAccuracy = 0.01;
+    static constexpr int32_t kMaxBuckets = 2048;
+
+    // NaN and infinities are ignored.
+    void add(double value) { add(value, 1); }
+    void add(double value, uint64_t count);
+    void add_batch(const double* values, size_t num_values);
+
+    void merge(const DDSketch& other);
+
+    uint64_t count() const { return _zero_count + _positive.total + _negative.total; }
+    bool empty() const { return count() == 0; }
+
+    // Returns 0 if the sketch is empty.
+    double quantile(double q) const;
+
+    // Calls |func| with the estimated value and the count of each non-empty bucket in ascending order
+    // of the values.
+    template <typename Func>
+    void for_each_bucket(Func&& func) const;
+
+    size_t serialize_size() const;
+    // Returns the serialized size.
+    size_t serialize(uint8_t* writer) const;
+    // Returns the size read from |reader|.
+    size_t deserialize(const uint8_t* reader);
+
+private:
+    struct Store {
+        // The buckets lower than the highest one - kMaxBuckets are collapsed into the lowest kept one.
+        void add(int32_t index, uint64_t count);
+        void merge(const Store& other);
+        // Makes the buckets cover [low, high].
+        void extend(int32_t low, int32_t high);
+
+        size_t serialize_size() const;
+        uint8_t* serialize(uint8_t* writer) const;
+        const uint8_t* deserialize(const uint8_t* reader);
+
+        // the bucket index of counts[0].
+        int32_t offset = 0;
+        std::vector<uint64_t> counts;
+        uint64_t total = 0;
+    };
+
+    static int32_t _bucket_index(double value);
+    static double _bucket_value(int32_t index);
+
+    Store _positive;
+    // counts the absolute values of the negative values.
+    Store _negative;
+    uint64_t _zero_count = 0;
+    double _min = std::numeric_limits<double>::max();
+    double _max = std::numeric_limits<double>::lowest();
+};
+
+template <typename Func>
+void DDSketch::for_each_bucket(Func&& func) const {
+    for (size_t i = _negative.counts.size(); i > 0; --i) {
+        if (_negative.counts[i - 1] > 0) {
+            func(-_bucket_value(_negative.offset + static_cast<int32_t>(i) - 1), _negative.counts[i - 1]);
+        }
+    }
+    if (_zero_count > 0) {
+        func(0.0, _zero_count);
+    }
+    for (size_t i = 0; i < _positive.counts.size(); ++i) {
+        if (_positive.counts[i] > 0) {
+            func(_bucket_value(_positive.offset + static_cast<int32_t>(i)), _positive.counts[i]);
+        }
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,77 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace starrocks::vectorized {
+
+// DenseIntSet is a set of integers whose range is small compared with the number of values, like a list of
+// consecutive ids. The membership is a bounds check and a load from a byte per value of the range, instead of
+// hashing the value and probing a hash table.
+//
+// One byte rather than one bit per value, as the byte load is cheaper than the shift and mask, and the range is
+// limited anyway.
+template <typename T>
+class DenseIntSet {
+public:
+    static_assert(std::is_integral_v<T>);
+
+    using value_type = T;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    // The range is dense enough if it's at most kMaxRangePerValue times the number of values, or it's small anyway.
+    static constexpr uint64_t kMaxRangePerValue = 64;
+    static constexpr uint64_t kSmallRange = 4096;
+    static constexpr uint64_t kMaxRange = 1 << 22;
+
+    // Returns false and leaves the set empty if the values are not dense.
+    bool init(std::vector<T> values) {
+        _values.clear();
+        _exists.clear();
+        if (values.empty()) {
+            return false;
+        }
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+
+        uint64_t range = _offset(values.back(), values.front()) + 1;
+        if (range == 0 || range > kMaxRange || (range > kSmallRange && range > values.size() * kMaxRangePerValue)) {
+            return false;
+        }
+        _min = values.front();
+        _exists.assign(range, 0);
+        for (T v : values) {
+            _exists[_offset(v, _min)] = 1;
+        }
+        _values = std::move(values);
+        return true;
+    }
+
+    bool contains(T v) const {
+        uint64_t offset = _offset(v, _min);
+        return offset < _exists.size() && _exists[offset];
+    }
+
+    bool empty() const { return _values.empty(); }
+    size_t size() const { return _values.size(); }
+    const_iterator begin() const { return _values.begin(); }
+    const_iterator end() const { return _values.end(); }
+
+private:
+    // The wrapping difference, values below the minimum are mapped beyond the range.
+    static uint64_t _offset(T v, T min) {
+        return static_cast<uint64_t>(static_cast<int64_t>(v)) - static_cast<uint64_t>(static_cast<int64_t>(min));
+    }
+
+    T _min = 0;
+    std::vector<uint8_t> _exists;
+    // the sorted distinct values.
+    std::vector<T> _values;
+};
+
+} // namespace starrocks::vectorized
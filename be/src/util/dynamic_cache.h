@@ -251,6 +251,13 @@ public:
         return _evict();
     }
 
+    // when the cache is full, the unused objects larger than |max_entry_size| are evicted first, so that
+    // a few huge objects cannot monopolize the cache, 0 means no limit
+    void set_max_entry_size(size_t max_entry_size) {
+        std::lock_guard<std::mutex> lg(_lock);
+        _max_entry_size = max_entry_size;
+    }
+
     std::vector<std::pair<Key, size_t>> get_entry_sizes() const {
         std::lock_guard<std::mutex> lg(_lock);
         std::vector<std::pair<Key, size_t>> ret(_map.size());
@@ -265,11 +272,20 @@ public:
 
 private:
     bool _evict() {
+        if (_max_entry_size > 0 && _size > _capacity) {
+            _evict_if([this](const Entry* entry) { return entry->_size > _max_entry_size; });
+        }
+        return _evict_if([](const Entry*) { return true; });
+    }
+
+    // evict the unused objects satisfying |pred| in LRU order until the cache is not full
+    template <class Pred>
+    bool _evict_if(const Pred& pred) {
         auto itr = _list.begin();
         while (_size > _capacity && itr != _list.end()) {
             Entry* entry = (*itr);
             // no need to check iobj != obj, cause obj is in use, so _ref > 1
-            if (entry->_ref == 1) {
+            if (entry->_ref == 1 && pred(entry)) {
                 // no usage, can remove
                 _map.erase(entry->key());
                 itr = _list.erase(itr);
@@ -291,6 +307,7 @@ private:
     size_t _object_size;
     std::atomic<size_t> _size;
     size_t _capacity = 0;
+    size_t _max_entry_size = 0;
 
     MemTracker* _mem_tracker = nullptr;
 };
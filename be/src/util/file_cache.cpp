@@ -25,6 +25,7 @@
 
 #include "env/env.h"
 #include "gutil/strings/substitute.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks {
 
@@ -39,11 +40,13 @@ FileCache<FileType>::FileCache(std::string cache_name, std::shared_ptr<Cache> ca
 template <class FileType>
 bool FileCache<FileType>::lookup(const std::string& file_name, OpenedFileHandle<FileType>* file_handle) {
     DCHECK(_cache != nullptr);
+    StarRocksMetrics::instance()->fd_cache_lookup_total.increment(1);
     CacheKey key(file_name);
     auto lru_handle = _cache->lookup(key);
     if (lru_handle == nullptr) {
         return false;
     }
+    StarRocksMetrics::instance()->fd_cache_hit_total.increment(1);
     *file_handle = OpenedFileHandle<FileType>(_cache.get(), lru_handle);
     return true;
 }
@@ -52,7 +55,12 @@ template <class FileType>
 void FileCache<FileType>::insert(const std::string& file_name, FileType* file,
                                  OpenedFileHandle<FileType>* file_handle) {
     DCHECK(_cache != nullptr);
-    auto deleter = [](const CacheKey& key, void* value) { delete (FileType*)value; };
+    // The file is closed once it's evicted and no handle refers to it.
+    auto deleter = [](const CacheKey& key, void* value) {
+        StarRocksMetrics::instance()->fd_cache_evict_total.increment(1);
+        delete (FileType*)value;
+    };
+    StarRocksMetrics::instance()->fd_cache_insert_total.increment(1);
     CacheKey key(file_name);
     auto lru_handle = _cache->insert(key, file, 1, deleter);
     *file_handle = OpenedFileHandle<FileType>(_cache.get(), lru_handle);
@@ -28,15 +28,18 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <chrono>
 #include <filesystem>
 #include <iomanip>
 #include <sstream>
+#include <thread>
 
 #include "env/env.h"
 #include "gutil/strings/split.h"
 #include "gutil/strings/strip.h"
 #include "gutil/strings/substitute.h"
 #include "util/defer_op.h"
+#include "util/time.h"
 
 namespace starrocks {
 
@@ -205,21 +208,23 @@ Status FileUtils::split_pathes(const char* path, std::vector<std::string>* path_
     return Status::OK();
 }
 
-Status FileUtils::copy_file(const std::string& src_path, const std::string& dst_path) {
+Status FileUtils::copy_file(const std::string& src_path, const std::string& dst_path, int64_t max_bytes_per_sec) {
     ASSIGN_OR_RETURN(auto src_env, Env::CreateSharedFromString(src_path));
     ASSIGN_OR_RETURN(auto dst_env, Env::CreateSharedFromString(dst_path));
     ASSIGN_OR_RETURN(auto src_file, src_env->new_sequential_file(src_path));
     ASSIGN_OR_RETURN(auto dst_file, dst_env->new_writable_file(dst_path));
-    RETURN_IF_ERROR(copy(src_file.get(), dst_file.get()));
+    RETURN_IF_ERROR(copy(src_file.get(), dst_file.get(), 8192, max_bytes_per_sec));
     RETURN_IF_ERROR(dst_file->sync());
     RETURN_IF_ERROR(dst_file->close());
     return Status::OK();
 }
 
-StatusOr<int64_t> FileUtils::copy(SequentialFile* src, WritableFile* dest, size_t buff_size) {
+StatusOr<int64_t> FileUtils::copy(SequentialFile* src, WritableFile* dest, size_t buff_size,
+                                  int64_t max_bytes_per_sec) {
     char* buf = new char[buff_size];
     std::unique_ptr<char[]> guard(buf);
     int64_t ncopy = 0;
+    const int64_t start_us = MonotonicMicros();
     while (true) {
         ASSIGN_OR_RETURN(auto nread, src->read(buf, buff_size));
         if (nread == 0) {
@@ -227,6 +232,14 @@ StatusOr<int64_t> FileUtils::copy(SequentialFile* src, WritableFile* dest, size_
         }
         ncopy += nread;
         RETURN_IF_ERROR(dest->append(Slice(buf, nread)));
+        if (max_bytes_per_sec > 0) {
+            // Sleep until the average speed since the start falls back to the limit.
+            const int64_t expected_us = ncopy * 1'000'000 / max_bytes_per_sec;
+            const int64_t elapsed_us = MonotonicMicros() - start_us;
+            if (elapsed_us < expected_us) {
+                std::this_thread::sleep_for(std::chrono::microseconds(expected_us - elapsed_us));
+            }
+        }
     }
     return ncopy;
 }
@@ -107,11 +107,15 @@ public:
     // will split to ['/home/disk1', '/home/disk2']
     static Status split_pathes(const char* path, std::vector<std::string>* path_vec);
 
-    // copy the file from src path to dest path, it will overwrite the existing files
-    static Status copy_file(const std::string& src_path, const std::string& dest_path);
+    // copy the file from src path to dest path, it will overwrite the existing files.
+    // If |max_bytes_per_sec| is positive, the copy is throttled to that speed.
+    static Status copy_file(const std::string& src_path, const std::string& dest_path,
+                            int64_t max_bytes_per_sec = 0);
 
     // Return the number of bytes copied on success.
-    static StatusOr<int64_t> copy(SequentialFile* src, WritableFile* dest, size_t buff_size = 8192);
+    // If |max_bytes_per_sec| is positive, the copy is throttled to that speed.
+    static StatusOr<int64_t> copy(SequentialFile* src, WritableFile* dest, size_t buff_size = 8192,
+                                  int64_t max_bytes_per_sec = 0);
 
     // calc md5sum of a local file
     static Status md5sum(const std::string& file, std::string* md5sum);
@@ -104,6 +104,8 @@ public:
         return lazy_emplace(key, f);
     }
 
+    iterator find(KeyType key, size_t hashval) { return find(key); }
+
     struct HashFunction {
         size_t operator()(KeyType key) { return static_cast<size_t>(key); }
     };
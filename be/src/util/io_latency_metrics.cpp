@@ -0,0 +1,93 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "util/io_latency_metrics.h"
+
+#include "common/logging.h"
+#include "util/starrocks_metrics.h"
+
+namespace starrocks {
+
+static const char* io_type_name(IOType type) {
+    switch (type) {
+    case IOType::PREAD:
+        return "pread";
+    case IOType::DATA_PAGE:
+        return "data_page";
+    case IOType::INDEX_PAGE:
+        return "index_page";
+    case IOType::DICT_PAGE:
+        return "dict_page";
+    case IOType::SHORT_KEY_PAGE:
+        return "short_key_page";
+    case IOType::SEGMENT_FOOTER:
+        return "segment_footer";
+    case IOType::HDFS_READ:
+        return "hdfs_read";
+    case IOType::S3_READ:
+        return "s3_read";
+    default:
+        return "unknown";
+    }
+}
+
+IOLatencyMetrics* IOLatencyMetrics::instance() {
+    static IOLatencyMetrics metrics;
+    return &metrics;
+}
+
+IOLatencyMetrics::IOLatencyMetrics() {
+    std::lock_guard<std::mutex> l(_mutex);
+    _add_disk("", "other", false);
+    _add_disk("", "remote", true);
+}
+
+void IOLatencyMetrics::register_disk(const std::string& path) {
+    std::lock_guard<std::mutex> l(_mutex);
+    int num_disks = _num_disks.load(std::memory_order_relaxed);
+    for (int i = kRemoteDisk + 1; i < num_disks; ++i) {
+        if (_disks[i].path == path) {
+            return;
+        }
+    }
+    if (num_disks == kMaxDisks) {
+        LOG(WARNING) << "too many disks to record the io latency, the reads of " << path << " are labeled as other";
+        return;
+    }
+    _add_disk(path, path, false);
+}
+
+void IOLatencyMetrics::_add_disk(const std::string& path, const std::string& label, bool is_remote) {
+    int index = _num_disks.load(std::memory_order_relaxed);
+    Disk& disk = _disks[index];
+    disk.path = path;
+    for (int i = 0; i < static_cast<int>(IOType::NUM_TYPES); ++i) {
+        auto type = static_cast<IOType>(i);
+        bool remote_type = type == IOType::HDFS_READ || type == IOType::S3_READ;
+        if (remote_type != is_remote) {
+            continue;
+        }
+        disk.histograms[i] = std::make_unique<HistogramMetric>(MetricUnit::MICROSECONDS);
+        MetricLabels labels;
+        labels.add("disk", label).add("type", io_type_name(type));
+        StarRocksMetrics::instance()->metrics()->register_metric("storage_io_latency_us", labels,
+                                                                 disk.histograms[i].get());
+    }
+    _num_disks.store(index + 1, std::memory_order_release);
+}
+
+int IOLatencyMetrics::disk_index(const std::string& file_path) const {
+    int num_disks = _num_disks.load(std::memory_order_acquire);
+    int best = kOtherDisk;
+    size_t best_length = 0;
+    for (int i = kRemoteDisk + 1; i < num_disks; ++i) {
+        const std::string& path = _disks[i].path;
+        if (path.size() > best_length && file_path.compare(0, path.size(), path) == 0 &&
+            (file_path.size() == path.size() || file_path[path.size()] == '/' || path.back() == '/')) {
+            best = i;
+            best_length = path.size();
+        }
+    }
+    return best;
+}
+
+} // namespace starrocks
@@ -0,0 +1,77 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "util/metrics.h"
+
+namespace starrocks {
+
+// The classes of the storage reads whose latencies are recorded.
+enum class IOType {
+    // The preads of the local files.
+    PREAD = 0,
+    // The pages of the segment files read by PageIO, classified by the page type in the footer.
+    DATA_PAGE,
+    INDEX_PAGE,
+    DICT_PAGE,
+    SHORT_KEY_PAGE,
+    SEGMENT_FOOTER,
+    HDFS_READ,
+    S3_READ,
+    NUM_TYPES
+};
+
+// IOLatencyMetrics keeps the latency histograms of the storage reads, in microseconds, labeled by the disk
+// and the IOType, e.g. storage_io_latency_us_bucket{disk="/data1/storage",type="data_page",le="128"}.
+//
+// The disk of a local file is the longest registered path which prefixes it, or "other" if there is none.
+// The HDFS and S3 reads are labeled by the disk "remote".
+class IOLatencyMetrics {
+public:
+    static constexpr int kMaxDisks = 64;
+    static constexpr int kOtherDisk = 0;
+    static constexpr int kRemoteDisk = 1;
+
+    static IOLatencyMetrics* instance();
+
+    // Register the root path of a DataDir. The disks are never removed.
+    void register_disk(const std::string& path);
+
+    // Return the index of the disk |file_path| belongs to.
+    int disk_index(const std::string& file_path) const;
+
+    // Return nullptr if |type| isn't recorded for the disk, e.g. the HDFS reads of a local disk.
+    HistogramMetric* histogram(int disk_index, IOType type) const {
+        return _disks[disk_index].histograms[static_cast<int>(type)].get();
+    }
+
+    void record(int disk_index, IOType type, int64_t latency_ns) {
+        if (auto* hist = histogram(disk_index, type); hist != nullptr) {
+            hist->add(latency_ns / 1000);
+        }
+    }
+
+private:
+    IOLatencyMetrics();
+
+    struct Disk {
+        std::string path;
+        std::array<std::unique_ptr<HistogramMetric>, static_cast<int>(IOType::NUM_TYPES)> histograms;
+    };
+
+    // Called with _mutex held.
+    void _add_disk(const std::string& path, const std::string& label, bool is_remote);
+
+    std::mutex _mutex;
+    Disk _disks[kMaxDisks];
+    // The disks in [0, _num_disks) are immutable once published.
+    std::atomic<int> _num_disks{0};
+};
+
+} // namespace starrocks
@@ -183,6 +183,50 @@ Metric* MetricRegistry::get_metric(const std::string& name, const MetricLabels&
     return nullptr;
 }
 
+int64_t HistogramMetric::count() const {
+    int64_t count = 0;
+    for (int i = 0; i < kNumBuckets; ++i) {
+        count += bucket_count(i);
+    }
+    return count;
+}
+
+int64_t HistogramMetric::quantile(double q) const {
+    int64_t counts[kNumBuckets];
+    int64_t total = 0;
+    for (int i = 0; i < kNumBuckets; ++i) {
+        counts[i] = bucket_count(i);
+        total += counts[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    auto rank = static_cast<int64_t>(q * total);
+    int64_t seen = 0;
+    for (int i = 0; i < kNumBuckets; ++i) {
+        seen += counts[i];
+        if (seen > rank) {
+            return bucket_upper_bound(i);
+        }
+    }
+    return bucket_upper_bound(kNumBuckets - 1);
+}
+
+std::string HistogramMetric::to_string() const {
+    std::stringstream ss;
+    ss << "count=" << count() << " sum=" << sum() << " p50=" << quantile(0.5) << " p99=" << quantile(0.99)
+       << " p999=" << quantile(0.999);
+    return ss.str();
+}
+
+void HistogramMetric::write_value(rj::Value& metric_obj, rj::Document::AllocatorType& allocator) {
+    metric_obj.AddMember("count", rj::Value(count()), allocator);
+    metric_obj.AddMember("sum", rj::Value(sum()), allocator);
+    metric_obj.AddMember("p50", rj::Value(quantile(0.5)), allocator);
+    metric_obj.AddMember("p99", rj::Value(quantile(0.99)), allocator);
+    metric_obj.AddMember("p999", rj::Value(quantile(0.999)), allocator);
+}
+
 bool MetricRegistry::register_hook(const std::string& name, const std::function<void()>& hook) {
     std::unique_lock lock(_mutex);
     auto it = _hooks.emplace(name, hook);
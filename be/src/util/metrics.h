@@ -32,6 +32,7 @@ DIAGNOSTIC_IGNORE("-Wclass-memaccess")
 DIAGNOSTIC_POP
 #include <rapidjson/rapidjson.h>
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <iomanip>
@@ -213,6 +214,46 @@ public:
     virtual ~LockGauge() = default;
 };
 
+// Histogram whose buckets are bounded by the powers of 2, i.e. the i-th bucket counts the values in
+// (2^(i-1), 2^i] and the last bucket counts all the larger values. It's exported as a prometheus histogram,
+// so the quantiles over any time window can be computed by histogram_quantile() at the server side.
+class HistogramMetric : public Metric {
+public:
+    static constexpr int kNumBuckets = 26;
+
+    explicit HistogramMetric(MetricUnit unit) : Metric(MetricType::HISTOGRAM, unit) {}
+    ~HistogramMetric() override = default;
+
+    std::string to_string() const override;
+    void write_value(rj::Value& metric_obj, rj::Document::AllocatorType& allocator) override;
+
+    void add(int64_t value) {
+        _buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        _sum.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    static int bucket_index(int64_t value) {
+        if (value <= 1) {
+            return 0;
+        }
+        // ceil(log2(value))
+        int index = 64 - __builtin_clzll(static_cast<uint64_t>(value - 1));
+        return std::min(index, kNumBuckets - 1);
+    }
+    // The inclusive upper bound of the i-th bucket, the last bucket is unbounded actually.
+    static int64_t bucket_upper_bound(int i) { return static_cast<int64_t>(1) << i; }
+
+    int64_t bucket_count(int i) const { return _buckets[i].load(std::memory_order_relaxed); }
+    int64_t count() const;
+    int64_t sum() const { return _sum.load(std::memory_order_relaxed); }
+    // Estimate the quantile by the upper bound of the bucket it falls in, 0 if there is no value.
+    int64_t quantile(double q) const;
+
+private:
+    std::atomic<int64_t> _buckets[kNumBuckets]{};
+    std::atomic<int64_t> _sum{0};
+};
+
 // one key-value pair used to
 struct MetricLabel {
     std::string name;
@@ -436,5 +477,8 @@ private:
 #define METRIC_DEFINE_DOUBLE_GAUGE(metric_name, unit) \
     starrocks::DoubleGauge metric_name { unit }
 
+#define METRIC_DEFINE_HISTOGRAM(metric_name, unit) \
+    starrocks::HistogramMetric metric_name { unit }
+
 #define METRIC_DEFINE_TCMALLOC_GAUGE(metric_name, tcmalloc_var) \
     starrocks::TcmallocMetric metric_name { tcmalloc_var }
@@ -2,53 +2,106 @@
 
 #pragma once
 
+#include <cmath>
+
+#include "common/config.h"
+#include "ddsketch.h"
+#include "gutil/casts.h"
 #include "tdigest.h"
 
 namespace starrocks {
 class PercentileValue {
 public:
-    PercentileValue() { _type = TDIGEST; }
+    PercentileValue() { _type = config::percentile_use_ddsketch ? DDSKETCH : TDIGEST; }
 
-    explicit PercentileValue(const Slice& src) {
-        switch (*src.data) {
-        case PercentileDataType::TDIGEST:
-            _type = TDIGEST;
-            break;
-        default:
-            DCHECK(false);
+    explicit PercentileValue(const Slice& src) { deserialize(src.data); }
+
+    void add(float value) {
+        if (_type == DDSKETCH) {
+            _ddsketch.add(value);
+        } else {
+            _tdigest.add(value);
         }
-        _tdigest.deserialize(src.data + 1);
     }
 
-    void add(float value) { _tdigest.add(value); }
+    void add_batch(const double* values, size_t num_values) {
+        if (_type == DDSKETCH) {
+            _ddsketch.add_batch(values, num_values);
+        } else {
+            for (size_t i = 0; i < num_values; ++i) {
+                _tdigest.add(implicit_cast<float>(values[i]));
+            }
+        }
+    }
 
-    void merge(const PercentileValue* other) { _tdigest.merge(&other->_tdigest); }
+    void merge(const PercentileValue* other) {
+        if (_type == other->_type) {
+            if (_type == DDSKETCH) {
+                _ddsketch.merge(other->_ddsketch);
+            } else {
+                _tdigest.merge(&other->_tdigest);
+            }
+            return;
+        }
+        // The values are built with different percentile_use_ddsketch, e.g. the stored ones and the new ones.
+        if (_empty()) {
+            *this = *other;
+        } else if (_type == DDSKETCH) {
+            for (const auto* centroids : {&other->_tdigest.processed(), &other->_tdigest.unprocessed()}) {
+                for (const auto& centroid : *centroids) {
+                    _ddsketch.add(centroid.mean(), std::llround(centroid.weight()));
+                }
+            }
+        } else {
+            other->_ddsketch.for_each_bucket([this](double value, uint64_t count) { _tdigest.add(value, count); });
+        }
+    }
 
     uint64_t serialize_size() const {
         //_type 1 bytes
+        if (_type == DDSKETCH) {
+            return 1 + _ddsketch.serialize_size();
+        }
         return 1 + _tdigest.serialize_size();
     }
 
     size_t serialize(uint8_t* writer) const {
         *(writer) = _type;
-        return _tdigest.serialize(writer + 1);
+        if (_type == DDSKETCH) {
+            return 1 + _ddsketch.serialize(writer + 1);
+        }
+        return 1 + _tdigest.serialize(writer + 1);
     }
+
     void deserialize(const char* type_reader) {
         switch (*type_reader) {
         case PercentileDataType::TDIGEST:
             _type = TDIGEST;
+            _tdigest.deserialize(type_reader + 1);
+            break;
+        case PercentileDataType::DDSKETCH:
+            _type = DDSKETCH;
+            _ddsketch.deserialize((const uint8_t*)type_reader + 1);
             break;
         default:
             DCHECK(false);
         }
-        _tdigest.deserialize(type_reader + 1);
     }
 
-    Value quantile(Value q) { return _tdigest.quantile(q); }
+    Value quantile(Value q) {
+        if (_type == DDSKETCH) {
+            return implicit_cast<Value>(_ddsketch.quantile(q));
+        }
+        return _tdigest.quantile(q);
+    }
 
 private:
-    enum PercentileDataType { TDIGEST = 0 };
+    bool _empty() const { return _type == DDSKETCH ? _ddsketch.empty() : _tdigest.totalWeight() == 0; }
+
+    // Persisted in PERCENTILE columns, don't change the existing values.
+    enum PercentileDataType { TDIGEST = 0, DDSKETCH = 1 };
     TDigest _tdigest;
+    DDSketch _ddsketch;
     PercentileDataType _type;
 };
 } // namespace starrocks
@@ -2669,6 +2669,18 @@ public:
         inner.set_.clear();
     }
 
+    // extension - iterates only the specified submap, until end()
+    // ----------------------------------------
+    iterator begin(std::size_t submap_index) {
+        auto it = iterator(&sets_[submap_index], &sets_[submap_index] + 1, sets_[submap_index].set_.begin());
+        it.skip_empty();
+        return it;
+    }
+
+    // extension - the size of only the specified submap
+    // ----------------------------------------
+    size_t size(std::size_t submap_index) const { return sets_[submap_index].set_.size(); }
+
     // This overload kicks in when the argument is an rvalue of insertable and
     // decomposable type other than init_type.
     //
@@ -842,9 +842,7 @@ inline int32_t RleBatchDecoder<T>::GetBatch(T* values, int32_t batch_num) {
         if (num_repeats > 0) {
             int32_t num_repeats_to_set = std::min(num_repeats, batch_num - num_consumed);
             T repeated_value = GetRepeatedValue(num_repeats_to_set);
-            for (int i = 0; i < num_repeats_to_set; ++i) {
-                values[num_consumed + i] = repeated_value;
-            }
+            std::fill_n(values + num_consumed, num_repeats_to_set, repeated_value);
             num_consumed += num_repeats_to_set;
             continue;
         }
@@ -0,0 +1,48 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "util/slow_op_trace.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/logging.h"
+#include "util/metrics.h"
+#include "util/starrocks_metrics.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+// The counters are registered on the first slow operation of each kind, and never freed.
+static IntCounter* slow_op_counter(const char* op_name) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::unique_ptr<IntCounter>> counters;
+    std::lock_guard<std::mutex> l(mutex);
+    auto& counter = counters[op_name];
+    if (counter == nullptr) {
+        counter = std::make_unique<IntCounter>(MetricUnit::OPERATIONS);
+        StarRocksMetrics::instance()->metrics()->register_metric("slow_operations_total",
+                                                                 MetricLabels().add("op", op_name), counter.get());
+    }
+    return counter.get();
+}
+
+ScopedSlowOpTrace::ScopedSlowOpTrace(const char* op_name, int64_t threshold_ms)
+        : _op_name(op_name),
+          _threshold_ms(threshold_ms),
+          _start_ns(MonotonicNanos()),
+          _trace(new Trace),
+          _adopt_trace(_trace.get()) {}
+
+ScopedSlowOpTrace::~ScopedSlowOpTrace() {
+    int64_t elapsed_ms = (MonotonicNanos() - _start_ns) / 1000000;
+    if (_threshold_ms <= 0 || elapsed_ms < _threshold_ms) {
+        return;
+    }
+    slow_op_counter(_op_name)->increment(1);
+    LOG(WARNING) << "Slow operation " << _op_name << " took " << elapsed_ms << "ms, trace:" << std::endl
+                 << _trace->DumpToString(Trace::INCLUDE_ALL);
+}
+
+} // namespace starrocks
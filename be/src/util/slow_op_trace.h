@@ -0,0 +1,39 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#pragma once
+
+#include <cstdint>
+
+#include "gutil/ref_counted.h"
+#include "util/trace.h"
+
+// Trace the operation in the current scope, and log the trace if it takes longer than |threshold_ms|.
+// |op_name| must be a string which stays alive forever, typically a compile-time constant.
+#define SCOPED_SLOW_OP_TRACE(op_name, threshold_ms) starrocks::ScopedSlowOpTrace _slow_op_trace(op_name, threshold_ms)
+
+namespace starrocks {
+
+// ScopedSlowOpTrace adopts a new Trace on the current thread (or bthread) for the duration of its scope.
+// When the scope takes longer than the threshold, the whole trace, including the timestamped TRACE()
+// messages and the trace counters such as the lock wait and the IO time, is logged, and the
+// slow_operations_total{op=<op_name>} counter is incremented. A non-positive threshold disables the logging,
+// but the trace is still adopted, so the children threads can attach to it by Trace::CurrentTrace().
+class ScopedSlowOpTrace {
+public:
+    ScopedSlowOpTrace(const char* op_name, int64_t threshold_ms);
+    ~ScopedSlowOpTrace();
+
+    Trace* trace() const { return _trace.get(); }
+
+private:
+    const char* const _op_name;
+    const int64_t _threshold_ms;
+    const int64_t _start_ns;
+    scoped_refptr<Trace> _trace;
+    ScopedAdoptTrace _adopt_trace;
+
+    ScopedSlowOpTrace(const ScopedSlowOpTrace&) = delete;
+    const ScopedSlowOpTrace& operator=(const ScopedSlowOpTrace&) = delete;
+};
+
+} // namespace starrocks
@@ -128,6 +128,11 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
                              &meta_write_request_duration_us);
     _metrics.register_metric("meta_request_duration", MetricLabels().add("type", "read"),
                              &meta_read_request_duration_us);
+    _metrics.register_metric("meta_write_stall_total", MetricLabels().add("condition", "delayed"),
+                             &meta_write_delayed_total);
+    _metrics.register_metric("meta_write_stall_total", MetricLabels().add("condition", "stopped"),
+                             &meta_write_stopped_total);
+    REGISTER_STARROCKS_METRIC(meta_write_stall_duration_us);
 
     _metrics.register_metric("segment_read", MetricLabels().add("type", "segment_total_read_times"),
                              &segment_read_total);
@@ -137,6 +142,23 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     _metrics.register_metric("segment_read", MetricLabels().add("type", "segment_rows_read_by_zone_map"),
                              &segment_rows_read_by_zone_map);
 
+    _metrics.register_metric("page_cache", MetricLabels().add("type", "lookup"), &page_cache_lookup_total);
+    _metrics.register_metric("page_cache", MetricLabels().add("type", "hit"), &page_cache_hit_total);
+    _metrics.register_metric("page_cache", MetricLabels().add("type", "insert"), &page_cache_insert_total);
+    _metrics.register_metric("page_cache", MetricLabels().add("type", "evict"), &page_cache_evict_total);
+    _metrics.register_metric("page_cache", MetricLabels().add("type", "bypass"), &page_cache_bypass_total);
+
+    _metrics.register_metric("block_cache", MetricLabels().add("type", "lookup"), &block_cache_lookup_total);
+    _metrics.register_metric("block_cache", MetricLabels().add("type", "hit"), &block_cache_hit_total);
+    _metrics.register_metric("block_cache", MetricLabels().add("type", "insert"), &block_cache_insert_total);
+    _metrics.register_metric("block_cache", MetricLabels().add("type", "evict"), &block_cache_evict_total);
+    _metrics.register_metric("block_cache", MetricLabels().add("type", "bypass"), &block_cache_bypass_total);
+
+    _metrics.register_metric("fd_cache", MetricLabels().add("type", "lookup"), &fd_cache_lookup_total);
+    _metrics.register_metric("fd_cache", MetricLabels().add("type", "hit"), &fd_cache_hit_total);
+    _metrics.register_metric("fd_cache", MetricLabels().add("type", "insert"), &fd_cache_insert_total);
+    _metrics.register_metric("fd_cache", MetricLabels().add("type", "evict"), &fd_cache_evict_total);
+
     _metrics.register_metric("txn_request", MetricLabels().add("type", "begin"), &txn_begin_request_total);
     _metrics.register_metric("txn_request", MetricLabels().add("type", "commit"), &txn_commit_request_total);
     _metrics.register_metric("txn_request", MetricLabels().add("type", "rollback"), &txn_rollback_request_total);
@@ -120,6 +120,10 @@ public:
     METRIC_DEFINE_INT_COUNTER(meta_write_request_duration_us, MetricUnit::MICROSECONDS);
     METRIC_DEFINE_INT_COUNTER(meta_read_request_total, MetricUnit::REQUESTS);
     METRIC_DEFINE_INT_COUNTER(meta_read_request_duration_us, MetricUnit::MICROSECONDS);
+    // The write stalls of the meta stores and the time they lasted.
+    METRIC_DEFINE_INT_COUNTER(meta_write_delayed_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(meta_write_stopped_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(meta_write_stall_duration_us, MetricUnit::MICROSECONDS);
 
     // Counters for segment_v2
     // -----------------------
@@ -132,6 +136,28 @@ public:
     // total number of rows selected by zone map index
     METRIC_DEFINE_INT_COUNTER(segment_rows_read_by_zone_map, MetricUnit::ROWS);
 
+    // Counters for storage page cache
+    METRIC_DEFINE_INT_COUNTER(page_cache_lookup_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(page_cache_hit_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(page_cache_insert_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(page_cache_evict_total, MetricUnit::OPERATIONS);
+    // total number of pages not inserted since they are read by large scans
+    METRIC_DEFINE_INT_COUNTER(page_cache_bypass_total, MetricUnit::OPERATIONS);
+
+    // Counters for the local disk cache of the remote file blocks
+    METRIC_DEFINE_INT_COUNTER(block_cache_lookup_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(block_cache_hit_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(block_cache_insert_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(block_cache_evict_total, MetricUnit::OPERATIONS);
+    // total number of blocks not inserted since the writes can't keep up
+    METRIC_DEFINE_INT_COUNTER(block_cache_bypass_total, MetricUnit::OPERATIONS);
+
+    // Counters for the cache of the opened files, the evictions are the closed files
+    METRIC_DEFINE_INT_COUNTER(fd_cache_lookup_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(fd_cache_hit_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(fd_cache_insert_total, MetricUnit::OPERATIONS);
+    METRIC_DEFINE_INT_COUNTER(fd_cache_evict_total, MetricUnit::OPERATIONS);
+
     METRIC_DEFINE_INT_COUNTER(txn_begin_request_total, MetricUnit::OPERATIONS);
     METRIC_DEFINE_INT_COUNTER(txn_commit_request_total, MetricUnit::OPERATIONS);
     METRIC_DEFINE_INT_COUNTER(txn_rollback_request_total, MetricUnit::OPERATIONS);
@@ -204,6 +230,7 @@ public:
     // Size of some global containers
     METRIC_DEFINE_UINT_GAUGE(rowset_count_generated_and_in_use, MetricUnit::ROWSETS);
     METRIC_DEFINE_UINT_GAUGE(unused_rowsets_count, MetricUnit::ROWSETS);
+    METRIC_DEFINE_UINT_GAUGE(unused_rowsets_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_UINT_GAUGE(broker_count, MetricUnit::NOUNIT);
     METRIC_DEFINE_UINT_GAUGE(data_stream_receiver_count, MetricUnit::NOUNIT);
     METRIC_DEFINE_UINT_GAUGE(fragment_endpoint_count, MetricUnit::NOUNIT);
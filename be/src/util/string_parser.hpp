@@ -198,6 +198,27 @@ private:
     template <typename T>
     static inline T string_to_float_internal(const char* s, int len, ParseResult* result);
 
+    // Parses the plain decimals like "-123.456" with at most 19 digits. When the digits are exactly
+    // representable in a double and the scale is an exact power of ten, one division gives the correctly
+    // rounded value. Returns false for the other strings, which are left to string_to_float_internal.
+    template <typename T>
+    static inline bool string_to_float_fast_path(const char* s, int len, T* value);
+
+    // Whether the 8 bytes of the little-endian word are all ascii digits.
+    static inline bool is_eight_digits(uint64_t chunk) {
+        return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+                (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+    }
+
+    // Converts the 8 ascii digits of the little-endian word, the first digit is the most significant one.
+    static inline uint32_t parse_eight_digits(uint64_t chunk) {
+        chunk -= 0x3030303030303030ULL;
+        chunk = (chunk * 10 + (chunk >> 8)) & 0x00FF00FF00FF00FFULL;
+        chunk = (chunk * 100 + (chunk >> 16)) & 0x0000FFFF0000FFFFULL;
+        chunk = (chunk * 10000 + (chunk >> 32)) & 0x00000000FFFFFFFFULL;
+        return static_cast<uint32_t>(chunk);
+    }
+
     // parses a string for 'true' or 'false', case insensitive
     // Return PARSE_FAILURE on leading whitespace. Trailing whitespace is allowed.
     static inline bool string_to_bool_internal(const char* s, int len, ParseResult* result);
@@ -406,7 +427,17 @@ inline T StringParser::string_to_int_no_overflow(const char* s, int len, ParseRe
         *result = PARSE_FAILURE;
         return 0;
     }
-    for (int i = 1; i < len; ++i) {
+    int i = 1;
+    // Eight digits at a time for the long numbers, e.g. the ids and the unix timestamps.
+    for (; i + 8 <= len; i += 8) {
+        uint64_t chunk;
+        memcpy(&chunk, s + i, sizeof(chunk));
+        if (!is_eight_digits(chunk)) {
+            break;
+        }
+        val = val * 100000000 + parse_eight_digits(chunk);
+    }
+    for (; i < len; ++i) {
         if (LIKELY(s[i] >= '0' && s[i] <= '9')) {
             T digit = s[i] - '0';
             val = val * 10 + digit;
@@ -423,6 +454,38 @@ inline T StringParser::string_to_int_no_overflow(const char* s, int len, ParseRe
     return val;
 }
 
+template <typename T>
+inline bool StringParser::string_to_float_fast_path(const char* s, int len, T* value) {
+    static constexpr double kPowersOf10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                             1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    bool negative = s[0] == '-';
+    int i = (s[0] == '-' || s[0] == '+') ? 1 : 0;
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int scale = 0;
+    bool decimal = false;
+    for (; i < len; ++i) {
+        char c = s[i];
+        if (c >= '0' && c <= '9') {
+            if (++num_digits > 19) {
+                return false;
+            }
+            mantissa = mantissa * 10 + (c - '0');
+            scale += decimal;
+        } else if (c == '.' && !decimal) {
+            decimal = true;
+        } else {
+            return false;
+        }
+    }
+    if (num_digits == 0 || mantissa > (1ULL << 53) || scale > 22) {
+        return false;
+    }
+    double val = static_cast<double>(mantissa) / kPowersOf10[scale];
+    *value = static_cast<T>(negative ? -val : val);
+    return true;
+}
+
 template <typename T>
 inline T StringParser::string_to_float_internal(const char* s, int len, ParseResult* result) {
     if (UNLIKELY(len <= 0)) {
@@ -430,6 +493,12 @@ inline T StringParser::string_to_float_internal(const char* s, int len, ParseRes
         return 0;
     }
 
+    T fast_value;
+    if (string_to_float_fast_path<T>(s, len, &fast_value)) {
+        *result = PARSE_SUCCESS;
+        return fast_value;
+    }
+
     // Use double here to not lose precision while accumulating the result
     double val = 0;
     bool negative = false;
@@ -31,6 +31,7 @@
 #include "column/column_pool.h"
 #include "gutil/strings/split.h" // for string split
 #include "gutil/strtoint.h"      //  for atoi64
+#include "runtime/current_thread.h"
 
 namespace starrocks {
 
@@ -87,6 +88,8 @@ public:
     METRIC_DEFINE_INT_GAUGE(chunk_allocator_mem_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_INT_GAUGE(clone_mem_bytes, MetricUnit::BYTES);
     METRIC_DEFINE_INT_GAUGE(consistency_mem_bytes, MetricUnit::BYTES);
+    // The number of times the thread-local cached consumption was propagated to the mem trackers.
+    METRIC_DEFINE_INT_GAUGE(mem_tracker_flushes, MetricUnit::NOUNIT);
 
     // column pool metrics.
     METRIC_DEFINE_INT_GAUGE(column_pool_total_bytes, MetricUnit::BYTES);
@@ -261,6 +264,7 @@ void SystemMetrics::_install_memory_metrics(MetricRegistry* registry) {
     registry->register_metric("chunk_allocator_mem_bytes", &_memory_metrics->chunk_allocator_mem_bytes);
     registry->register_metric("clone_mem_bytes", &_memory_metrics->clone_mem_bytes);
     registry->register_metric("consistency_mem_bytes", &_memory_metrics->consistency_mem_bytes);
+    registry->register_metric("mem_tracker_flushes", &_memory_metrics->mem_tracker_flushes);
 
     registry->register_metric("total_column_pool_bytes", &_memory_metrics->column_pool_total_bytes);
     registry->register_metric("local_column_pool_bytes", &_memory_metrics->column_pool_local_bytes);
@@ -349,6 +353,7 @@ void SystemMetrics::_update_memory_metrics() {
         _memory_metrics->consistency_mem_bytes.set_value(
                 ExecEnv::GetInstance()->consistency_mem_tracker()->consumption());
     }
+    _memory_metrics->mem_tracker_flushes.set_value(CurrentThread::mem_tracker_flushes());
 
 #define UPDATE_COLUMN_POOL_METRIC(var, type)                                         \
     value = vectorized::describe_column_pool<vectorized::type>().central_free_bytes; \
@@ -21,6 +21,8 @@
 
 #include "util/threadpool.h"
 
+#include <bvar/bvar.h>
+
 #include <limits>
 #include <ostream>
 
@@ -233,7 +235,9 @@ ThreadPool::ThreadPool(const ThreadPoolBuilder& builder)
           _num_threads_pending_start(0),
           _active_threads(0),
           _total_queued_tasks(0),
-          _tokenless(new_token(ExecutionMode::CONCURRENT)) {}
+          _tokenless(new_token(ExecutionMode::CONCURRENT)),
+          _queue_wait_latency(
+                  std::make_unique<bvar::LatencyRecorder>("starrocks_thread_pool", _name + "_queue_wait")) {}
 
 ThreadPool::~ThreadPool() {
     // There should only be one live token: the one used in tokenless submission.
@@ -509,6 +513,8 @@ void ThreadPool::dispatch_thread() {
 
         l.unlock();
 
+        *_queue_wait_latency << (MonoTime::Now() - task.submit_time).ToMicroseconds();
+
         // Execute the task
         task.runnable->run();
 
@@ -577,4 +583,27 @@ std::ostream& operator<<(std::ostream& o, ThreadPoolToken::State s) {
     return o << ThreadPoolToken::state_to_string(s);
 }
 
+Status parallel_run(ThreadPool* pool, size_t n, const std::function<Status(size_t)>& task) {
+    std::vector<Status> statuses(n);
+    std::unique_ptr<ThreadPoolToken> token;
+    if (pool != nullptr && n > 1) {
+        token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    }
+    for (size_t i = 1; i < n; i++) {
+        if (token == nullptr || !token->submit_func([&statuses, &task, i] { statuses[i] = task(i); }).ok()) {
+            statuses[i] = task(i);
+        }
+    }
+    if (n > 0) {
+        statuses[0] = task(0);
+    }
+    if (token != nullptr) {
+        token->wait();
+    }
+    for (const auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -31,11 +31,16 @@
 #include <string>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "common/status.h"
 #include "gutil/ref_counted.h"
 #include "util/monotime.h"
 
+namespace bvar {
+class LatencyRecorder;
+} // namespace bvar
+
 namespace starrocks {
 
 class Thread;
@@ -199,6 +204,9 @@ public:
         return _num_threads + _num_threads_pending_start;
     }
 
+    // Return the maximum number of threads this pool could run concurrently.
+    int max_threads() const { return _max_threads; }
+
 private:
     friend class ThreadPoolBuilder;
     friend class ThreadPoolToken;
@@ -320,6 +328,10 @@ private:
     // ExecutionMode::CONCURRENT token used by the pool for tokenless submission.
     std::unique_ptr<ThreadPoolToken> _tokenless;
 
+    // Time the tasks spent in the queue before picked up by a worker, exposed as
+    // "starrocks_thread_pool_<name>_queue_wait_*".
+    std::unique_ptr<bvar::LatencyRecorder> _queue_wait_latency;
+
     ThreadPool(const ThreadPool&) = delete;
     const ThreadPool& operator=(const ThreadPool&) = delete;
 };
@@ -434,4 +446,9 @@ private:
     const ThreadPoolToken& operator=(const ThreadPoolToken&) = delete;
 };
 
+// Run task(0), ..., task(n - 1) concurrently in |pool| and the calling thread, and wait for all of them
+// to complete. The tasks rejected by |pool|, or all the tasks if |pool| is nullptr, are run in the calling
+// thread. Return the first error of the tasks by index.
+Status parallel_run(ThreadPool* pool, size_t n, const std::function<Status(size_t)>& task);
+
 } // namespace starrocks
@@ -22,6 +22,7 @@
 
 #include "util/timezone_utils.h"
 
+#include <algorithm>
 #include <charconv>
 #include <string_view>
 #include <utility>
@@ -175,4 +176,48 @@ int64_t TimezoneUtils::to_utc_offset(const cctz::time_zone& ctz) {
     return a.cs - b.cs;
 }
 
+static const cctz::civil_second kUnixEpochCivil(1970, 1, 1, 0, 0, 0);
+
+static cctz::time_point<cctz::seconds> to_time_point(int64_t seconds) {
+    static const auto epoch =
+            std::chrono::time_point_cast<cctz::seconds>(std::chrono::system_clock::from_time_t(0));
+    return epoch + cctz::seconds(seconds);
+}
+
+static int64_t to_unix_seconds(const cctz::time_point<cctz::seconds>& tp) {
+    return (tp - to_time_point(0)).count();
+}
+
+void TimezoneOffsetCache::_refresh(int64_t utc_seconds) {
+    const auto tp = to_time_point(utc_seconds);
+    _offset = _ctz.lookup(tp).offset;
+
+    // The instant of a transition is the utc time of the first local time after it.
+    auto transition_seconds = [this](const cctz::time_zone::civil_transition& trans) {
+        const auto lookup = _ctz.lookup(trans.to);
+        return to_unix_seconds(lookup.kind == cctz::time_zone::civil_lookup::UNIQUE ? lookup.pre : lookup.trans);
+    };
+    cctz::time_zone::civil_transition trans;
+    _begin = kMinSeconds;
+    if (_ctz.prev_transition(tp + cctz::seconds(1), &trans)) {
+        _begin = std::max(kMinSeconds, transition_seconds(trans));
+    }
+    _end = kMaxSeconds;
+    if (_ctz.next_transition(tp, &trans)) {
+        _end = std::min(kMaxSeconds, transition_seconds(trans));
+    }
+    if (utc_seconds < _begin || utc_seconds >= _end) {
+        // Out of the range of the cache, e.g. the far past. Only the looked up value is cached.
+        _begin = utc_seconds;
+        _end = utc_seconds + 1;
+    }
+}
+
+int64_t TimezoneOffsetCache::_local_to_utc_slow(int64_t local_seconds) {
+    const int64_t utc_seconds = to_unix_seconds(cctz::convert(kUnixEpochCivil + local_seconds, _ctz));
+    // The next local times are likely close to this one.
+    _refresh(utc_seconds);
+    return utc_seconds;
+}
+
 } // namespace starrocks
@@ -24,6 +24,7 @@
 
 #include <re2/re2.h>
 
+#include <limits>
 #include <string_view>
 
 #include "cctz/time_zone.h"
@@ -48,4 +49,49 @@ private:
     // RE2 obj is thread safe
     static RE2 time_zone_offset_format_reg;
 };
+
+// TimezoneOffsetCache caches the utc offset of a time zone between two of its transitions, so converting
+// a run of close timestamps, e.g. the sorted or clustered event times of a chunk, looks up cctz only when
+// the run crosses a transition. The seconds are counted from the unix epoch, and the local ones are the
+// civil time of the zone counted as if it were utc.
+class TimezoneOffsetCache {
+public:
+    explicit TimezoneOffsetCache(const cctz::time_zone& ctz) : _ctz(ctz) {}
+
+    int64_t utc_to_local(int64_t utc_seconds) {
+        if (utc_seconds < _begin || utc_seconds >= _end) {
+            _refresh(utc_seconds);
+        }
+        return utc_seconds + _offset;
+    }
+
+    // The same as cctz::convert(civil_second, ctz): a skipped or repeated local time takes the offset
+    // before the transition.
+    int64_t local_to_utc(int64_t local_seconds) {
+        // Far enough from the transitions, the local time maps to a single utc time with the cached offset,
+        // because no offset of the zone differs from another by more than kMaxOffsetChange.
+        int64_t utc_seconds = local_seconds - _offset;
+        if (utc_seconds >= _begin + kMaxOffsetChange && utc_seconds < _end - kMaxOffsetChange) {
+            return utc_seconds;
+        }
+        return _local_to_utc_slow(local_seconds);
+    }
+
+private:
+    static constexpr int64_t kMaxOffsetChange = 2 * 24 * 3600;
+    // Far from the overflow when adding or subtracting kMaxOffsetChange.
+    static constexpr int64_t kMinSeconds = std::numeric_limits<int64_t>::min() / 2;
+    static constexpr int64_t kMaxSeconds = std::numeric_limits<int64_t>::max() / 2;
+
+    // Caches the offset of the transitions around |utc_seconds|.
+    void _refresh(int64_t utc_seconds);
+
+    int64_t _local_to_utc_slow(int64_t local_seconds);
+
+    cctz::time_zone _ctz;
+    int64_t _offset = 0;
+    // The offset is valid for the utc seconds in [_begin, _end), empty at first.
+    int64_t _begin = 0;
+    int64_t _end = 0;
+};
 } // namespace starrocks
\ No newline at end of file
@@ -21,6 +21,7 @@
 
 #include "util/trace.h"
 
+#include <bthread/bthread.h>
 #include <glog/logging.h>
 #include <rapidjson/rapidjson.h>
 
@@ -45,7 +46,25 @@ using strings::internal::SubstituteArg;
 
 namespace starrocks {
 
-__thread Trace* Trace::threadlocal_trace_;
+// The current trace is kept in the bthread-local storage rather than a __thread variable, because the RPC
+// handlers run in bthreads, which may be resumed by another pthread after blocking. It works as the
+// thread-local storage when called in a pthread.
+static bthread_key_t trace_key() {
+    static bthread_key_t key = [] {
+        bthread_key_t k;
+        CHECK_EQ(0, bthread_key_create(&k, nullptr));
+        return k;
+    }();
+    return key;
+}
+
+Trace* Trace::CurrentTrace() {
+    return static_cast<Trace*>(bthread_getspecific(trace_key()));
+}
+
+void Trace::SetCurrentTrace(Trace* trace) {
+    CHECK_EQ(0, bthread_setspecific(trace_key(), trace));
+}
 
 Trace::Trace()
 
@@ -179,8 +179,9 @@ public:
     // Return a copy of the current set of related "child" traces.
     std::vector<std::pair<StringPiece, scoped_refptr<Trace>>> ChildTraces() const;
 
-    // Return the current trace attached to this thread, if there is one.
-    static Trace* CurrentTrace() { return threadlocal_trace_; }
+    // Return the current trace attached to this thread, if there is one. When called in a bthread,
+    // it's the trace attached to the bthread, which follows the bthread across the worker pthreads.
+    static Trace* CurrentTrace();
 
     // Simple function to dump the current trace to stderr, if one is
     // available. This is meant for usage when debugging in gdb via
@@ -195,10 +196,9 @@ private:
     friend class RefCountedThreadSafe<Trace>;
     ~Trace();
 
-    // The current trace for this thread. Threads should only set this using
-    // using ScopedAdoptTrace, which handles reference counting the underlying
-    // object.
-    static __thread Trace* threadlocal_trace_;
+    // Set the current trace for this thread (or bthread). Threads should only set this
+    // using ScopedAdoptTrace, which handles reference counting the underlying object.
+    static void SetCurrentTrace(Trace* trace);
 
     // Allocate a new entry from the arena, with enough space to hold a
     // message of length 'len'.
@@ -233,8 +233,8 @@ private:
 // on the same thread)
 class ScopedAdoptTrace {
 public:
-    explicit ScopedAdoptTrace(Trace* t) : old_trace_(Trace::threadlocal_trace_) {
-        Trace::threadlocal_trace_ = t;
+    explicit ScopedAdoptTrace(Trace* t) : old_trace_(Trace::CurrentTrace()) {
+        Trace::SetCurrentTrace(t);
         if (t) {
             t->AddRef();
         }
@@ -242,10 +242,11 @@ public:
     }
 
     ~ScopedAdoptTrace() {
-        if (Trace::threadlocal_trace_) {
-            Trace::threadlocal_trace_->Release();
+        Trace* t = Trace::CurrentTrace();
+        if (t) {
+            t->Release();
         }
-        Trace::threadlocal_trace_ = old_trace_;
+        Trace::SetCurrentTrace(old_trace_);
         DFAKE_SCOPED_LOCK_THREAD_LOCKED(ctor_dtor_);
     }
 
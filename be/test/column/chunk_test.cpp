@@ -146,6 +146,26 @@ TEST_F(ChunkTest, test_basic) {
     ASSERT_EQ(100, chunk->num_rows());
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunkTest, test_filter) {
+    auto chunk = std::make_unique<Chunk>(make_columns(2), make_schema(2));
+
+    Buffer<uint8_t> selection(100, 1);
+    ASSERT_EQ(100, chunk->filter(selection));
+    check_column(reinterpret_cast<FixedLengthColumn<int32_t>*>(chunk->get_column_by_index(1).get()), 1);
+
+    for (size_t i = 0; i < selection.size(); i++) {
+        selection[i] = i % 2;
+    }
+    ASSERT_EQ(50, chunk->filter(selection));
+    ASSERT_EQ(50, chunk->num_rows());
+
+    selection.assign(50, 0);
+    ASSERT_EQ(0, chunk->filter(selection));
+    ASSERT_EQ(0, chunk->get_column_by_index(0)->size());
+    ASSERT_EQ(0, chunk->get_column_by_index(1)->size());
+}
+
 // NOLINTNEXTLINE
 TEST_F(ChunkTest, test_append_column) {
     auto chunk = std::make_unique<Chunk>(make_columns(2), make_schema(2));
@@ -272,6 +292,30 @@ TEST_F(ChunkTest, test_append_chunk_safe) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunkTest, test_clone_empty_shares_slot_map) {
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(make_column(0), 1);
+    chunk->append_column(make_column(1), 2);
+
+    auto cloned = chunk->clone_empty_with_slot();
+    ASSERT_EQ(&chunk->get_slot_id_to_index_map(), &cloned->get_slot_id_to_index_map());
+    ASSERT_EQ(0, cloned->num_rows());
+    ASSERT_TRUE(cloned->is_slot_exist(2));
+
+    // The map is copied when the slots of the cloned chunk are changed.
+    cloned->append_column(make_column(0)->clone_empty(), 3);
+    ASSERT_NE(&chunk->get_slot_id_to_index_map(), &cloned->get_slot_id_to_index_map());
+    ASSERT_TRUE(cloned->is_slot_exist(3));
+    ASSERT_FALSE(chunk->is_slot_exist(3));
+    ASSERT_EQ(2, chunk->num_columns());
+
+    Chunk moved(std::move(*cloned));
+    ASSERT_EQ(3, moved.num_columns());
+    ASSERT_EQ(0, cloned->num_columns());
+    ASSERT_FALSE(cloned->is_slot_exist(1));
+}
+
 // NOLINTNEXTLINE
 TEST_F(ChunkTest, test_clone_unique) {
     auto chunk = std::make_shared<Chunk>();
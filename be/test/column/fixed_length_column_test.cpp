@@ -27,6 +27,7 @@
 #include "column/const_column.h"
 #include "column/nullable_column.h"
 #include "exec/vectorized/sorting/sorting.h"
+#include "util/hash_util.hpp"
 
 namespace starrocks::vectorized {
 
@@ -553,6 +554,31 @@ TEST(FixedLengthColumnTest, test_xor_checksum) {
     ASSERT_EQ(checksum, expected_checksum);
 }
 
+TEST(FixedLengthColumnTest, test_crc32_hash_date_and_timestamp) {
+    auto dates = DateColumn::create();
+    dates->append(DateValue::create(2021, 1, 1));
+    dates->append(DateValue::create(1998, 12, 31));
+    auto timestamps = TimestampColumn::create();
+    timestamps->append(TimestampValue::create(2021, 1, 1, 12, 30, 59));
+    TimestampValue with_microsecond;
+    ASSERT_TRUE(with_microsecond.from_string("2021-01-01 12:30:59.123456", 26));
+    timestamps->append(with_microsecond);
+
+    // Must be the same as the hash of the string representations.
+    std::vector<uint32_t> hashes(2, 0);
+    dates->crc32_hash(hashes.data(), 0, 2);
+    for (size_t i = 0; i < 2; i++) {
+        std::string str = dates->get_data()[i].to_string();
+        ASSERT_EQ(HashUtil::zlib_crc_hash(str.data(), str.size(), 0), hashes[i]);
+    }
+    hashes.assign(2, 0);
+    timestamps->crc32_hash(hashes.data(), 0, 2);
+    for (size_t i = 0; i < 2; i++) {
+        std::string str = timestamps->get_data()[i].to_string();
+        ASSERT_EQ(HashUtil::zlib_crc_hash(str.data(), str.size(), 0), hashes[i]);
+    }
+}
+
 TEST(FixedLengthColumnTest, test_compare_row) {
     auto column = FixedLengthColumn<int32_t>::create();
     for (int i = 0; i <= 100; i++) {
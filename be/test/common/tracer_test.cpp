@@ -19,4 +19,64 @@ TEST_F(TracerTest, BasicTest) {
     tracer->shutdown();
 }
 
+TEST_F(TracerTest, TraceParent) {
+    auto tracer = std::make_unique<Tracer>("TracerTest");
+    auto span = tracer->start_trace("test");
+    const auto ctx = span->GetContext();
+    std::string trace_parent = Tracer::to_trace_parent(ctx);
+    ASSERT_EQ(55, trace_parent.size());
+    ASSERT_EQ("00-", trace_parent.substr(0, 3));
+    ASSERT_EQ("-01", trace_parent.substr(52));
+
+    auto parsed = Tracer::from_trace_parent(trace_parent);
+    ASSERT_TRUE(parsed.IsValid());
+    ASSERT_TRUE(parsed.IsRemote());
+    ASSERT_TRUE(parsed.IsSampled());
+    ASSERT_EQ(ctx.trace_id(), parsed.trace_id());
+    ASSERT_EQ(ctx.span_id(), parsed.span_id());
+
+    auto child = tracer->add_span("child", parsed);
+    ASSERT_EQ(ctx.trace_id(), child->GetContext().trace_id());
+
+    ASSERT_FALSE(Tracer::from_trace_parent("").IsValid());
+    ASSERT_FALSE(Tracer::from_trace_parent(trace_parent.substr(1)).IsValid());
+    ASSERT_FALSE(Tracer::from_trace_parent("00-" + std::string(32, 'x') + trace_parent.substr(35)).IsValid());
+    ASSERT_EQ("", Tracer::to_trace_parent(SpanContext::GetInvalid()));
+    child->End();
+    span->End();
+    tracer->shutdown();
+}
+
+TEST_F(TracerTest, QueryTraceContext) {
+    TracerOptions options{"localhost", 6831};
+    options.sample_ratio = 0.5;
+    auto tracer = std::make_unique<Tracer>("TracerTest", options);
+    int num_sampled = 0;
+    for (int64_t i = 0; i < 1000; ++i) {
+        TUniqueId query_id;
+        query_id.__set_hi(i * 7919);
+        query_id.__set_lo(i);
+        auto ctx = tracer->query_trace_context(query_id);
+        ASSERT_TRUE(ctx.IsValid());
+        // The decision is the same on all the backends.
+        ASSERT_EQ(ctx.IsSampled(), tracer->query_trace_context(query_id).IsSampled());
+        num_sampled += ctx.IsSampled();
+        // The spans of the query are in the same trace.
+        auto span = tracer->add_span("fragment_instance", ctx);
+        ASSERT_EQ(ctx.trace_id(), span->GetContext().trace_id());
+        ASSERT_EQ(ctx.IsSampled(), span->IsRecording());
+        span->End();
+    }
+    ASSERT_GT(num_sampled, 400);
+    ASSERT_LT(num_sampled, 600);
+
+    // Tracing is disabled without the endpoint.
+    auto disabled = std::make_unique<Tracer>("TracerTest", TracerOptions{"", 6831});
+    ASSERT_FALSE(disabled->is_enabled());
+    TUniqueId query_id;
+    ASSERT_FALSE(disabled->query_trace_context(query_id).IsSampled());
+    ASSERT_FALSE(disabled->start_trace("test")->IsRecording());
+    tracer->shutdown();
+}
+
 } // namespace starrocks
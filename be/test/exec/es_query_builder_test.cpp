@@ -28,6 +28,8 @@
 
 #include "common/logging.h"
 #include "exec/es/es_predicate.h"
+#include "exec/es/es_scan_reader.h"
+#include "exec/es/es_scroll_query.h"
 #include "rapidjson/document.h"
 #include "rapidjson/rapidjson.h"
 #include "rapidjson/stringbuffer.h"
@@ -656,4 +658,29 @@ TEST_F(BooleanQueryBuilderTest, validate_compound_and) {
             "{\"fv\":[\"8.0\",\"16.0\"]}}]}}]}}]}},{\"wildcard\":{\"content\":\"a*e*g?\"}}]}}]}}";
     ASSERT_STREQ(expected_json.c_str(), actual_bool_json.c_str());
 }
+
+TEST_F(BooleanQueryBuilderTest, sliced_scroll_query) {
+    std::map<std::string, std::string> properties;
+    properties[ESScanReader::KEY_BATCH_SIZE] = "100";
+    std::vector<std::string> fields = {"k1"};
+    std::vector<EsPredicate*> predicates;
+    std::map<std::string, std::string> docvalue_context;
+    bool doc_value_mode = true;
+
+    std::string dsl = ESScrollQueryBuilder::build(properties, fields, predicates, docvalue_context, &doc_value_mode);
+    ASSERT_FALSE(doc_value_mode);
+    rapidjson::Document doc;
+    doc.Parse<0>(dsl.c_str());
+    ASSERT_FALSE(doc.HasMember("slice"));
+
+    properties[ESScanReader::KEY_SLICE_ID] = "1";
+    properties[ESScanReader::KEY_SLICE_MAX] = "4";
+    dsl = ESScrollQueryBuilder::build(properties, fields, predicates, docvalue_context, &doc_value_mode);
+    doc.Parse<0>(dsl.c_str());
+    ASSERT_TRUE(doc.HasMember("slice"));
+    ASSERT_EQ(1, doc["slice"]["id"].GetInt());
+    ASSERT_EQ(4, doc["slice"]["max"].GetInt());
+    ASSERT_EQ(100, doc["size"].GetInt());
+}
+
 } // namespace starrocks
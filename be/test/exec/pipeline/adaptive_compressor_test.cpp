@@ -0,0 +1,104 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/exchange/adaptive_compressor.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "util/block_compression.h"
+
+namespace starrocks::pipeline {
+
+class AdaptiveCompressorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _sample_interval = config::adaptive_exchange_compression_sample_interval;
+        config::adaptive_exchange_compression_sample_interval = 1;
+        for (int i = 0; i < 10000; i++) {
+            _data += std::to_string(i % 97) + "," + std::to_string(i * 7 % 1000) + "\n";
+        }
+    }
+
+    void TearDown() override { config::adaptive_exchange_compression_sample_interval = _sample_interval; }
+
+    void check_decompress(CompressionTypePB type, const raw::RawString& compressed) {
+        const BlockCompressionCodec* codec = nullptr;
+        ASSERT_TRUE(get_block_compression_codec(type, &codec).ok());
+        std::string uncompressed(_data.size(), '\0');
+        Slice output{uncompressed.data(), uncompressed.size()};
+        ASSERT_TRUE(codec->decompress(Slice(compressed.data(), compressed.size()), &output).ok());
+        ASSERT_EQ(_data, std::string(output.data, output.size));
+    }
+
+    int32_t _sample_interval = 0;
+    std::string _data;
+};
+
+// NOLINTNEXTLINE
+TEST_F(AdaptiveCompressorTest, not_adaptive) {
+    AdaptiveCompressor compressor(CompressionTypePB::LZ4, false);
+    ASSERT_TRUE(compressor.init().ok());
+    raw::RawString output;
+    CompressionTypePB type;
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(compressor.compress(_data, [] { return 0.0; }, &output, &type).ok());
+        ASSERT_EQ(CompressionTypePB::LZ4, type);
+        check_decompress(type, output);
+    }
+    ASSERT_EQ(0, compressor.num_switches());
+}
+
+// NOLINTNEXTLINE
+TEST_F(AdaptiveCompressorTest, no_compression) {
+    AdaptiveCompressor compressor(CompressionTypePB::NO_COMPRESSION, true);
+    ASSERT_TRUE(compressor.init().ok());
+    raw::RawString output;
+    CompressionTypePB type;
+    ASSERT_TRUE(compressor.compress(_data, [] { return 1000.0; }, &output, &type).ok());
+    ASSERT_EQ(CompressionTypePB::NO_COMPRESSION, type);
+    ASSERT_EQ(CompressionTypePB::NO_COMPRESSION, compressor.compress_type());
+}
+
+// NOLINTNEXTLINE
+TEST_F(AdaptiveCompressorTest, unknown_network_cost) {
+    AdaptiveCompressor compressor(CompressionTypePB::LZ4, true);
+    ASSERT_TRUE(compressor.init().ok());
+    raw::RawString output;
+    CompressionTypePB type;
+    ASSERT_TRUE(compressor.compress(_data, [] { return -1.0; }, &output, &type).ok());
+    ASSERT_EQ(CompressionTypePB::LZ4, type);
+    check_decompress(type, output);
+    ASSERT_EQ(0, compressor.num_switches());
+}
+
+// NOLINTNEXTLINE
+TEST_F(AdaptiveCompressorTest, fast_network) {
+    AdaptiveCompressor compressor(CompressionTypePB::LZ4, true);
+    ASSERT_TRUE(compressor.init().ok());
+    raw::RawString output;
+    CompressionTypePB type;
+    // Sending is free, so compression only costs.
+    ASSERT_TRUE(compressor.compress(_data, [] { return 0.0; }, &output, &type).ok());
+    ASSERT_EQ(CompressionTypePB::NO_COMPRESSION, type);
+    ASSERT_EQ(CompressionTypePB::NO_COMPRESSION, compressor.compress_type());
+    ASSERT_EQ(1, compressor.num_switches());
+}
+
+// NOLINTNEXTLINE
+TEST_F(AdaptiveCompressorTest, slow_network) {
+    AdaptiveCompressor lz4_compressor(CompressionTypePB::LZ4, true);
+    ASSERT_TRUE(lz4_compressor.init().ok());
+    raw::RawString output;
+    CompressionTypePB type;
+    // Sending is so expensive that the codec with the best ratio is picked.
+    ASSERT_TRUE(lz4_compressor.compress(_data, [] { return 1e6; }, &output, &type).ok());
+    ASSERT_NE(CompressionTypePB::NO_COMPRESSION, type);
+    ASSERT_EQ(type, lz4_compressor.compress_type());
+    check_decompress(type, output);
+
+    // Switch back once the network becomes fast.
+    ASSERT_TRUE(lz4_compressor.compress(_data, [] { return 0.0; }, &output, &type).ok());
+    ASSERT_EQ(CompressionTypePB::NO_COMPRESSION, type);
+}
+
+} // namespace starrocks::pipeline
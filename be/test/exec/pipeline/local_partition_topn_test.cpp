@@ -0,0 +1,96 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/sort/local_partition_topn_context.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/object_pool.h"
+#include "exprs/expr_context.h"
+#include "exprs/vectorized/column_ref.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+
+namespace starrocks::pipeline {
+
+class LocalPartitionTopnTest : public testing::Test {
+public:
+    void SetUp() override {
+        TUniqueId fragment_id;
+        TQueryOptions query_options;
+        query_options.batch_size = config::vector_chunk_size;
+        TQueryGlobals query_globals;
+        _runtime_state = std::make_shared<RuntimeState>(fragment_id, query_options, query_globals, nullptr);
+        _runtime_state->init_instance_mem_tracker();
+    }
+
+protected:
+    // slot 0 is the partition key, slot 1 is the order-by column.
+    static ChunkPtr _make_chunk(const std::vector<int32_t>& keys, const std::vector<int32_t>& values) {
+        auto key_column = Int32Column::create();
+        auto value_column = Int32Column::create();
+        key_column->append_numbers(keys.data(), keys.size() * sizeof(int32_t));
+        value_column->append_numbers(values.data(), values.size() * sizeof(int32_t));
+        Chunk::SlotHashMap map;
+        map[0] = 0;
+        map[1] = 1;
+        return std::make_shared<Chunk>(Columns{key_column, value_column}, map);
+    }
+
+    std::shared_ptr<RuntimeState> _runtime_state;
+    ObjectPool _pool;
+};
+
+TEST_F(LocalPartitionTopnTest, keep_top_rows_of_each_partition) {
+    TypeDescriptor type_desc(TYPE_INT);
+    std::vector<ExprContext*> partition_exprs{_pool.add(new ExprContext(_pool.add(new ColumnRef(type_desc, 0))))};
+    SortExecExprs sort_exec_exprs;
+    sort_exec_exprs._lhs_ordering_expr_ctxs.push_back(
+            _pool.add(new ExprContext(_pool.add(new ColumnRef(type_desc, 1)))));
+    std::vector<bool> is_asc{true};
+    std::vector<bool> is_null_first{false};
+    std::string sort_keys;
+
+    LocalPartitionTopnContext ctx(_runtime_state.get(), partition_exprs, sort_exec_exprs, is_asc, is_null_first,
+                                  sort_keys, 3);
+
+    // 3 partitions, the values of each partition arrive in descending order over two chunks.
+    for (int round = 0; round < 2; ++round) {
+        std::vector<int32_t> keys;
+        std::vector<int32_t> values;
+        for (int32_t v = 99 - round * 50; v >= 50 - round * 50; --v) {
+            for (int32_t k = 0; k < 3; ++k) {
+                keys.push_back(k);
+                values.push_back(v + k * 1000);
+            }
+        }
+        auto chunk = _make_chunk(keys, values);
+        ASSERT_OK(ctx.push_chunk(chunk, chunk));
+    }
+    ASSERT_EQ(3, ctx.num_partitions());
+    ASSERT_FALSE(ctx.is_sink_complete());
+    ASSERT_OK(ctx.done());
+    ASSERT_TRUE(ctx.is_sink_complete());
+
+    std::map<int32_t, std::vector<int32_t>> results;
+    while (!ctx.is_output_finished()) {
+        ASSIGN_OR_ABORT(auto chunk, ctx.pull_chunk());
+        if (chunk == nullptr) {
+            continue;
+        }
+        for (size_t i = 0; i < chunk->num_rows(); ++i) {
+            results[chunk->get_column_by_slot_id(0)->get(i).get_int32()].push_back(
+                    chunk->get_column_by_slot_id(1)->get(i).get_int32());
+        }
+    }
+    ASSERT_EQ(3, results.size());
+    for (int32_t k = 0; k < 3; ++k) {
+        std::vector<int32_t> expected{k * 1000, k * 1000 + 1, k * 1000 + 2};
+        ASSERT_EQ(expected, results[k]);
+    }
+}
+
+} // namespace starrocks::pipeline
@@ -0,0 +1,135 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/morsel.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "common/config.h"
+#include "gutil/casts.h"
+#include "testutil/parallel_test.h"
+
+namespace starrocks::pipeline {
+
+static Morsels _gen_morsels(size_t num_morsels) {
+    Morsels morsels;
+    for (size_t i = 0; i < num_morsels; ++i) {
+        TScanRangeParams scan_range;
+        scan_range.scan_range.internal_scan_range.tablet_id = i;
+        morsels.emplace_back(std::make_unique<ScanMorsel>(1, scan_range));
+    }
+    return morsels;
+}
+
+static int64_t _tablet_id_of(const MorselPtr& morsel) {
+    return down_cast<ScanMorsel*>(morsel.get())->get_olap_scan_range()->tablet_id;
+}
+
+PARALLEL_TEST(MorselQueueTest, test_split_by_size) {
+    MorselQueue queue(_gen_morsels(7));
+    auto split_queues = queue.split_by_size(3);
+    ASSERT_EQ(3, split_queues.size());
+    ASSERT_EQ(3, split_queues[0]->num_morsels());
+    ASSERT_EQ(2, split_queues[1]->num_morsels());
+    ASSERT_EQ(2, split_queues[2]->num_morsels());
+
+    // Take the local morsels first.
+    auto morsel = split_queues[1]->try_get();
+    ASSERT_TRUE(morsel.has_value());
+    ASSERT_EQ(1, _tablet_id_of(morsel.value()));
+    ASSERT_EQ(0, split_queues[1]->num_stolen_morsels());
+}
+
+PARALLEL_TEST(MorselQueueTest, test_steal) {
+    MorselQueue queue(_gen_morsels(7));
+    auto split_queues = queue.split_by_size(3);
+
+    // The first queue takes all the morsels, including the ones of the other queues.
+    std::set<int64_t> tablet_ids;
+    while (!split_queues[0]->empty()) {
+        auto morsel = split_queues[0]->try_get();
+        ASSERT_TRUE(morsel.has_value());
+        tablet_ids.emplace(_tablet_id_of(morsel.value()));
+    }
+    ASSERT_EQ(7, tablet_ids.size());
+    ASSERT_EQ(4, split_queues[0]->num_stolen_morsels());
+
+    for (auto& split_queue : split_queues) {
+        ASSERT_TRUE(split_queue->empty());
+        ASSERT_FALSE(split_queue->try_get().has_value());
+    }
+}
+
+PARALLEL_TEST(MorselQueueTest, test_rowid_range_option) {
+    vectorized::RowidRangeOption option;
+    RowsetId rowset_id1;
+    rowset_id1.init(1);
+    RowsetId rowset_id2;
+    rowset_id2.init(2);
+    RowsetId rowset_id3;
+    rowset_id3.init(3);
+
+    option.add(rowset_id1, 1, vectorized::SparseRange(0, 100));
+    option.add(rowset_id1, 1, vectorized::SparseRange(200, 300));
+    option.add(rowset_id2, 0, vectorized::SparseRange(10, 20));
+    ASSERT_EQ(2, option.num_segments());
+    ASSERT_EQ(210, option.num_rows());
+
+    ASSERT_TRUE(option.contains_rowset(rowset_id1));
+    ASSERT_TRUE(option.contains_rowset(rowset_id2));
+    ASSERT_FALSE(option.contains_rowset(rowset_id3));
+
+    const auto* range = option.get_segment_rowid_range(rowset_id1, 1);
+    ASSERT_TRUE(range != nullptr);
+    ASSERT_EQ(vectorized::SparseRange({{0, 100}, {200, 300}}), *range);
+    ASSERT_TRUE(option.get_segment_rowid_range(rowset_id1, 0) == nullptr);
+    ASSERT_TRUE(option.get_segment_rowid_range(rowset_id3, 1) == nullptr);
+}
+
+static TScanRangeParams _gen_hdfs_scan_range(THdfsFileFormat::type format, int64_t offset, int64_t length) {
+    TScanRangeParams scan_range;
+    auto& hdfs_scan_range = scan_range.scan_range.hdfs_scan_range;
+    hdfs_scan_range.__set_file_format(format);
+    hdfs_scan_range.__set_offset(offset);
+    hdfs_scan_range.__set_length(length);
+    scan_range.scan_range.__isset.hdfs_scan_range = true;
+    return scan_range;
+}
+
+TEST(MorselQueueTest, test_split_hdfs_scan_range) {
+    int64_t min_split_size = config::pipeline_min_split_hdfs_scan_range_size;
+    config::pipeline_min_split_hdfs_scan_range_size = 100;
+
+    std::vector<TScanRangeParams> scan_ranges;
+    scan_ranges.emplace_back(_gen_hdfs_scan_range(THdfsFileFormat::PARQUET, 0, 1000));
+    scan_ranges.emplace_back(_gen_hdfs_scan_range(THdfsFileFormat::ORC, 500, 250));
+    scan_ranges.emplace_back(_gen_hdfs_scan_range(THdfsFileFormat::ORC, 0, 150));
+    scan_ranges.emplace_back(_gen_hdfs_scan_range(THdfsFileFormat::TEXT, 0, 1000));
+
+    // The split size is max(100, 2400 / (8 * 4)) = 100.
+    Morsels morsels = convert_hdfs_scan_range_to_morsels(scan_ranges, 1, 8);
+    ASSERT_EQ(10 + 3 + 1 + 1, morsels.size());
+    std::vector<std::pair<int64_t, int64_t>> ranges;
+    for (const auto& morsel : morsels) {
+        const auto* hdfs_scan_range = down_cast<ScanMorsel*>(morsel.get())->get_hdfs_scan_range();
+        ranges.emplace_back(hdfs_scan_range->offset, hdfs_scan_range->length);
+    }
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(std::pair<int64_t, int64_t>(i * 100, 100), ranges[i]);
+    }
+    ASSERT_EQ(std::pair<int64_t, int64_t>(500, 100), ranges[10]);
+    ASSERT_EQ(std::pair<int64_t, int64_t>(600, 100), ranges[11]);
+    ASSERT_EQ(std::pair<int64_t, int64_t>(700, 50), ranges[12]);
+    // Too small to split.
+    ASSERT_EQ(std::pair<int64_t, int64_t>(0, 150), ranges[13]);
+    // Not an ORC or Parquet file.
+    ASSERT_EQ(std::pair<int64_t, int64_t>(0, 1000), ranges[14]);
+
+    // Not split without parallelism.
+    ASSERT_EQ(scan_ranges.size(), convert_hdfs_scan_range_to_morsels(scan_ranges, 1, 1).size());
+
+    config::pipeline_min_split_hdfs_scan_range_size = min_split_size;
+}
+
+} // namespace starrocks::pipeline
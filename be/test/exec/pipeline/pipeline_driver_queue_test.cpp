@@ -4,11 +4,15 @@
 
 #include <gtest/gtest.h>
 
+#include <set>
 #include <thread>
 
+#include "common/config.h"
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/workgroup/work_group.h"
+#include "gen_cpp/WorkGroup_types.h"
 #include "testutil/parallel_test.h"
+#include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 
@@ -109,6 +113,147 @@ PARALLEL_TEST(QuerySharedDriverQueueTest, test_take_close) {
     consumer_thread->join();
 }
 
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_basic) {
+    // With a single local queue, the order is the same as QuerySharedDriverQueue.
+    WorkStealingDriverQueue queue(1);
+
+    // Prepare drivers.
+    auto driver71 = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, -1);
+    _set_driver_level(driver71.get(), 7);
+    driver71->driver_acct().update_last_time_spent(5'000'000L * 1);
+
+    auto driver72 = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, -1);
+    _set_driver_level(driver72.get(), 7 + WorkStealingDriverQueue::QUEUE_SIZE);
+    driver72->driver_acct().update_last_time_spent(5'000'000L * 1);
+
+    auto driver61 = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, -1);
+    _set_driver_level(driver61.get(), 6);
+    driver61->driver_acct().update_last_time_spent(30'000'000L * WorkStealingDriverQueue::RATIO_OF_ADJACENT_QUEUE);
+
+    auto driver51 = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, -1);
+    _set_driver_level(driver51.get(), 5);
+    driver51->driver_acct().update_last_time_spent(20'000'000L * WorkStealingDriverQueue::RATIO_OF_ADJACENT_QUEUE *
+                                                   WorkStealingDriverQueue::RATIO_OF_ADJACENT_QUEUE);
+
+    std::vector<DriverRawPtr> in_drivers = {driver71.get(), driver72.get(), driver61.get(), driver51.get()};
+    std::vector<DriverRawPtr> out_drivers = {driver71.get(), driver72.get(), driver51.get(), driver61.get()};
+
+    // Put back drivers to queue.
+    for (auto* in_driver : in_drivers) {
+        queue.update_statistics(in_driver);
+        queue.put_back(in_driver);
+    }
+    ASSERT_EQ(in_drivers.size(), queue.size());
+
+    // Take drivers from queue.
+    for (auto* out_driver : out_drivers) {
+        auto maybe_driver = queue.take(0);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(out_driver, maybe_driver.value());
+    }
+    ASSERT_TRUE(queue.empty());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_steal) {
+    WorkStealingDriverQueue queue(4);
+
+    std::vector<std::shared_ptr<PipelineDriver>> drivers;
+    for (int i = 0; i < 4; ++i) {
+        drivers.emplace_back(std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, -1));
+        queue.put_back(drivers.back().get());
+    }
+
+    // The drivers are spread over all the local queues, and worker 0 steals the drivers in the other ones.
+    std::set<DriverRawPtr> taken_drivers;
+    for (int i = 0; i < 4; ++i) {
+        auto maybe_driver = queue.take(0);
+        ASSERT_TRUE(maybe_driver.ok());
+        taken_drivers.emplace(maybe_driver.value());
+    }
+    ASSERT_EQ(4, taken_drivers.size());
+    ASSERT_EQ(3, queue.num_steals());
+    ASSERT_TRUE(queue.empty());
+
+    // The driver put back from the executor thread goes to the local queue of this thread,
+    // so it needn't be stolen.
+    queue.put_back_from_executor(drivers[1].get());
+    auto maybe_driver = queue.take(0);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(drivers[1].get(), maybe_driver.value());
+    ASSERT_EQ(3, queue.num_steals());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_numa_aware) {
+    // The local queues 0 and 2 belong to node 0, and the local queues 1 and 3 belong to node 1.
+    WorkStealingDriverQueue queue(4, 2);
+    ASSERT_EQ(2, queue.num_numa_nodes());
+    ASSERT_EQ(0, queue.numa_node_of_worker(2));
+    ASSERT_EQ(1, queue.numa_node_of_worker(3));
+
+    FragmentContext fragment_ctx0;
+    FragmentContext fragment_ctx1;
+    ASSERT_EQ(0, fragment_ctx0.assign_numa_node(0));
+    ASSERT_EQ(1, fragment_ctx1.assign_numa_node(1));
+    ASSERT_EQ(1, fragment_ctx1.assign_numa_node(0));
+
+    std::vector<std::shared_ptr<PipelineDriver>> drivers;
+    for (int i = 0; i < 4; ++i) {
+        auto* fragment_ctx = i % 2 == 0 ? &fragment_ctx0 : &fragment_ctx1;
+        drivers.emplace_back(std::make_shared<PipelineDriver>(_gen_operators(), nullptr, fragment_ctx, -1));
+        queue.put_back(drivers.back().get());
+    }
+
+    // Worker 0 takes the drivers of node 0 first, and then steals the ones of node 1.
+    for (int i = 0; i < 4; ++i) {
+        auto maybe_driver = queue.take(0);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(i < 2 ? &fragment_ctx0 : &fragment_ctx1, maybe_driver.value()->fragment_ctx());
+    }
+    ASSERT_EQ(2, queue.num_remote_steals());
+    ASSERT_TRUE(queue.empty());
+
+    // The driver stolen from node 1 goes back to node 1, even if it is put back by worker 0.
+    queue.put_back_from_executor(drivers[1].get());
+    auto maybe_driver = queue.take(1);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(drivers[1].get(), maybe_driver.value());
+    ASSERT_EQ(2, queue.num_remote_steals());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_take_block) {
+    WorkStealingDriverQueue queue(4);
+
+    // Prepare drivers.
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, -1);
+    _set_driver_level(driver1.get(), 1);
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue, &driver1] {
+        auto maybe_driver = queue.take(3);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver1.get(), maybe_driver.value());
+    });
+
+    sleep(1);
+    queue.update_statistics(driver1.get());
+    queue.put_back(driver1.get());
+
+    consumer_thread->join();
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_take_close) {
+    WorkStealingDriverQueue queue(4);
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue] {
+        auto maybe_driver = queue.take(0);
+        ASSERT_TRUE(maybe_driver.status().is_cancelled());
+    });
+
+    sleep(1);
+    queue.close();
+
+    consumer_thread->join();
+}
+
 class DriverQueueWithWorkGroupTest : public ::testing::Test {
 public:
     void SetUp() override {
@@ -241,4 +386,67 @@ TEST_F(DriverQueueWithWorkGroupTest, test_take_close) {
     consumer_thread->join();
 }
 
+TEST_F(DriverQueueWithWorkGroupTest, test_cpu_hard_limit) {
+    const int64_t origin_period_us = config::pipeline_cpu_hard_limit_period_us;
+    config::pipeline_cpu_hard_limit_period_us = 1000;
+    DeferOp reset_period([origin_period_us] { config::pipeline_cpu_hard_limit_period_us = origin_period_us; });
+
+    TWorkGroup twg;
+    twg.__set_name("wg_hard_limit");
+    twg.__set_id(400);
+    twg.__set_version(workgroup::WorkGroup::DEFAULT_VERSION);
+    twg.__set_cpu_core_limit(1);
+    twg.__set_mem_limit(0.5);
+    twg.__set_concurrency_limit(10);
+    twg.__set_workgroup_type(workgroup::WorkGroupType::WG_NORMAL);
+    twg.__set_cpu_hard_limit(1);
+    auto hard_wg = workgroup::WorkGroupManager::instance()->add_workgroup(std::make_shared<workgroup::WorkGroup>(twg));
+    ASSERT_TRUE(hard_wg->has_cpu_hard_limit());
+
+    DriverQueueWithWorkGroup queue;
+
+    // hard_wg uses up the cpu bandwidth of about 10 periods.
+    auto hard_driver = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, -1);
+    hard_driver->driver_acct().update_last_time_spent(10'000'000L);
+    hard_driver->set_workgroup(hard_wg);
+    queue.update_statistics(hard_driver.get());
+    ASSERT_TRUE(hard_wg->is_cpu_throttled());
+    ASSERT_EQ(1, hard_wg->num_cpu_throttled_periods());
+
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), nullptr, nullptr, -1);
+    driver1->driver_acct().update_last_time_spent(20'000'000L);
+    driver1->set_workgroup(_wg1);
+    queue.update_statistics(driver1.get());
+
+    queue.put_back(hard_driver.get());
+    queue.put_back(driver1.get());
+
+    // The throttled workgroup is skipped, even if its vruntime is smaller.
+    auto maybe_driver = queue.take(0);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(driver1.get(), maybe_driver.value());
+
+    // The driver of hard_wg can be taken after the cpu bandwidth is refilled.
+    maybe_driver = queue.take(0);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(hard_driver.get(), maybe_driver.value());
+    ASSERT_FALSE(hard_wg->is_cpu_throttled());
+    ASSERT_GT(hard_wg->cpu_throttled_time_ns(), 0);
+}
+
+TEST(DurationHistogramTest, test_quantile) {
+    DurationHistogram histogram;
+    ASSERT_EQ(0, histogram.quantile(0.5));
+    for (int i = 0; i < 99; ++i) {
+        histogram.add(1000);
+    }
+    histogram.add(5'000'000);
+    ASSERT_EQ(100, histogram.count());
+    // 1000 is in the bucket [512, 1024).
+    ASSERT_EQ(1024, histogram.quantile(0.5));
+    ASSERT_EQ(1024, histogram.quantile(0.9));
+    ASSERT_EQ(5'000'000, histogram.quantile(1));
+    ASSERT_EQ(0, histogram.to_string().find("count=100, "));
+}
+
 } // namespace starrocks::pipeline
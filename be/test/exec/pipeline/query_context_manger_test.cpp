@@ -193,5 +193,47 @@ TEST(QueryContextManagerTest, testMulitiThreadOperations) {
     query_ctx_mgr->remove(query_id);
     ASSERT_TRUE(query_ctx_mgr->get(query_id) == nullptr);
 }
+
+TEST(QueryContextManagerTest, testResourceUsage) {
+    auto parent_mem_tracker = std::make_shared<MemTracker>(MemTracker::QUERY_POOL, 1073741824L, "parent", nullptr);
+    auto query_ctx_mgr = std::make_shared<QueryContextManager>(6);
+    ASSERT_TRUE(query_ctx_mgr->init().ok());
+    for (int i = 0; i < 3; ++i) {
+        TUniqueId query_id;
+        query_id.hi = 100;
+        query_id.lo = i;
+        auto* query_ctx = query_ctx_mgr->get_or_register(query_id);
+        query_ctx->set_total_fragments(1);
+        query_ctx->set_expire_seconds(300);
+        query_ctx->extend_lifetime();
+        query_ctx->init_mem_tracker(parent_mem_tracker->limit(), parent_mem_tracker.get());
+
+        query_ctx->incr_cpu_ns(10 * i);
+        query_ctx->incr_cpu_ns(1);
+        query_ctx->incr_scan_usage(100, 1000);
+        query_ctx->incr_spill_bytes(i);
+        query_ctx->incr_network_sent_bytes(20);
+        query_ctx->incr_network_received_bytes(30);
+        query_ctx->mem_tracker()->consume(64);
+        query_ctx->mem_tracker()->release(32);
+    }
+
+    auto query_contexts = query_ctx_mgr->list_all();
+    ASSERT_EQ(3, query_contexts.size());
+    for (const auto& query_ctx : query_contexts) {
+        int64_t i = query_ctx->query_id().lo;
+        ASSERT_EQ(10 * i + 1, query_ctx->cpu_ns());
+        ASSERT_EQ(100, query_ctx->scan_rows());
+        ASSERT_EQ(1000, query_ctx->scan_bytes());
+        ASSERT_EQ(i, query_ctx->spill_bytes());
+        ASSERT_EQ(20, query_ctx->network_sent_bytes());
+        ASSERT_EQ(30, query_ctx->network_received_bytes());
+        ASSERT_EQ(32, query_ctx->current_mem_bytes());
+        ASSERT_EQ(64, query_ctx->peak_mem_bytes());
+        // Not bound to any workgroup.
+        ASSERT_EQ("", query_ctx->workgroup_name());
+        query_ctx->mem_tracker()->release(32);
+    }
+}
 } // namespace pipeline
 } // namespace starrocks
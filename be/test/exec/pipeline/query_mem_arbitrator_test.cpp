@@ -0,0 +1,85 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/query_mem_arbitrator.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "runtime/mem_tracker.h"
+#include "testutil/parallel_test.h"
+
+namespace starrocks::pipeline {
+
+static constexpr int64_t kMB = 1024 * 1024;
+
+PARALLEL_TEST(QueryMemArbitratorTest, test_reserve_without_limit) {
+    MemTracker tracker(-1, "query");
+    QueryMemArbitrator arbitrator(&tracker);
+    MemConsumer consumer(&arbitrator, "agg", true);
+
+    ASSERT_TRUE(consumer.try_reserve(1024 * kMB));
+    ASSERT_FALSE(consumer.is_spill_requested());
+    ASSERT_EQ(1024 * kMB, arbitrator.total_reserved_bytes());
+
+    consumer.update_usage(10 * kMB);
+    ASSERT_EQ(10 * kMB, consumer.reserved_bytes());
+    ASSERT_EQ(10 * kMB, arbitrator.total_reserved_bytes());
+}
+
+PARALLEL_TEST(QueryMemArbitratorTest, test_choose_victim) {
+    const int64_t limit = static_cast<int64_t>(100 * kMB / config::spill_query_mem_limit_ratio);
+    MemTracker tracker(limit, "query");
+    QueryMemArbitrator arbitrator(&tracker);
+    MemConsumer agg(&arbitrator, "agg", true);
+    MemConsumer sort(&arbitrator, "sort", true);
+    MemConsumer join(&arbitrator, "join_build", false);
+
+    ASSERT_TRUE(agg.try_reserve(50 * kMB));
+    ASSERT_TRUE(sort.try_reserve(30 * kMB));
+    ASSERT_EQ(80 * kMB, arbitrator.total_reserved_bytes());
+
+    // The non-spillable join fails to reserve, and the consumer reserving the most memory is the victim.
+    ASSERT_FALSE(join.try_reserve(40 * kMB));
+    ASSERT_TRUE(agg.is_spill_requested());
+    ASSERT_FALSE(sort.is_spill_requested());
+    ASSERT_FALSE(join.is_spill_requested());
+    ASSERT_EQ(1, arbitrator.num_spill_requests());
+
+    // No new victim is chosen until the requested one spills.
+    ASSERT_FALSE(join.try_reserve(kMB));
+    ASSERT_EQ(1, arbitrator.num_spill_requests());
+
+    // agg spills.
+    agg.update_usage(0);
+    ASSERT_FALSE(agg.is_spill_requested());
+    ASSERT_EQ(71 * kMB, arbitrator.total_reserved_bytes());
+    ASSERT_TRUE(join.try_reserve(kMB));
+}
+
+PARALLEL_TEST(QueryMemArbitratorTest, test_small_consumer_not_victim) {
+    const int64_t limit = static_cast<int64_t>(100 * kMB / config::spill_query_mem_limit_ratio);
+    MemTracker tracker(limit, "query");
+    QueryMemArbitrator arbitrator(&tracker);
+    MemConsumer agg(&arbitrator, "agg", true);
+
+    ASSERT_TRUE(agg.try_reserve(kMB));
+    tracker.consume(100 * kMB);
+    ASSERT_FALSE(agg.try_reserve(kMB));
+    // It isn't worth spilling so little memory.
+    ASSERT_FALSE(agg.is_spill_requested());
+    ASSERT_EQ(0, arbitrator.num_spill_requests());
+    tracker.release(100 * kMB);
+}
+
+PARALLEL_TEST(QueryMemArbitratorTest, test_unregister) {
+    MemTracker tracker(-1, "query");
+    QueryMemArbitrator arbitrator(&tracker);
+    {
+        MemConsumer agg(&arbitrator, "agg", true);
+        agg.try_reserve(10 * kMB);
+        ASSERT_EQ(10 * kMB, arbitrator.total_reserved_bytes());
+    }
+    ASSERT_EQ(0, arbitrator.total_reserved_bytes());
+}
+
+} // namespace starrocks::pipeline
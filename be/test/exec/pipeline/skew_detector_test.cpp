@@ -0,0 +1,57 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/pipeline/exchange/skew_detector.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::pipeline {
+
+// NOLINTNEXTLINE
+TEST(SkewDetectorTest, uniform) {
+    SkewDetector detector(4, 1);
+    std::vector<uint32_t> hash_values(4096);
+    for (uint32_t i = 0; i < hash_values.size(); i++) {
+        hash_values[i] = i;
+    }
+    detector.update(hash_values.data(), hash_values.size());
+    ASSERT_EQ(4096, detector.num_sampled_rows());
+    ASSERT_TRUE(detector.hot_keys().empty());
+    ASSERT_EQ(0, detector.estimated_hot_rows());
+}
+
+// NOLINTNEXTLINE
+TEST(SkewDetectorTest, hot_key) {
+    SkewDetector detector(4, 2);
+    // Key 7 takes half of the rows, and the other keys are distinct.
+    std::vector<uint32_t> hash_values(1000);
+    uint32_t next_key = 100;
+    for (int chunk = 0; chunk < 8; chunk++) {
+        for (size_t i = 0; i < hash_values.size(); i++) {
+            // Every other sampled row is hot, since one of every 2 rows is sampled.
+            hash_values[i] = (i / 2) % 2 == 0 ? 7 : next_key++;
+        }
+        detector.update(hash_values.data(), hash_values.size());
+    }
+    ASSERT_EQ(4000, detector.num_sampled_rows());
+    ASSERT_EQ(std::vector<uint32_t>{7}, detector.hot_keys());
+    ASSERT_GE(detector.estimated_hot_rows(), 3000);
+    ASSERT_LE(detector.estimated_hot_rows(), 4000);
+}
+
+// NOLINTNEXTLINE
+TEST(SkewDetectorTest, too_few_rows) {
+    SkewDetector detector(4, 1);
+    std::vector<uint32_t> hash_values(100, 7);
+    detector.update(hash_values.data(), hash_values.size());
+    ASSERT_TRUE(detector.hot_keys().empty());
+}
+
+// NOLINTNEXTLINE
+TEST(SkewDetectorTest, single_receiver) {
+    SkewDetector detector(1, 1);
+    std::vector<uint32_t> hash_values(4096, 7);
+    detector.update(hash_values.data(), hash_values.size());
+    ASSERT_TRUE(detector.hot_keys().empty());
+}
+
+} // namespace starrocks::pipeline
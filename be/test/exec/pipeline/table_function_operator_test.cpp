@@ -70,12 +70,13 @@ public:
     ~TestNormalOperatorFactory() override = default;
 
     OperatorPtr create(int32_t degree_of_parallelism, int32_t driver_sequence) override {
-        return std::make_shared<TableFunctionOperator>(this, _id, _plan_node_id, *_tnode);
+        return std::make_shared<TableFunctionOperator>(this, _id, _plan_node_id, *_tnode, _conjunct_ctxs);
     }
 
 private:
     CounterPtr _counter;
     TPlanNode* _tnode = nullptr;
+    std::vector<ExprContext*> _conjunct_ctxs;
 };
 
 void TableFunctionOperatorTest::SetUp() {
@@ -155,7 +156,8 @@ void TableFunctionOperatorTest::SetUp() {
 TEST_F(TableFunctionOperatorTest, check_mem_leak) {
     CounterPtr counter_ptr = std::make_shared<Counter>();
     TestNormalOperatorFactory factory(1, 1, counter_ptr, &_tnode);
-    TableFunctionOperator op(&factory, 1, 1, _tnode);
+    std::vector<ExprContext*> conjunct_ctxs;
+    TableFunctionOperator op(&factory, 1, 1, _tnode, conjunct_ctxs);
     ASSERT_TRUE(op.prepare(&_runtime_state).ok());
     op.close(&_runtime_state);
 }
@@ -238,6 +238,184 @@ TEST(HashMapTest, Insert) {
     }
 }
 
+TEST(HashMapTest, InsertFixedSize24) {
+    // tinyint + smallint + date + int + nullable bigint, which is too long for SliceKey16
+    const int chunk_size = 64;
+    using TestAggHashMap = FixedSize24SliceAggHashMap<PhmapSeed1>;
+    AggHashMapWithSerializedKeyFixedSize<TestAggHashMap> key(chunk_size);
+    key.has_null_column = true;
+    MemPool pool;
+    std::vector<std::pair<PrimitiveType, bool>> types = {
+            {TYPE_TINYINT, false}, {TYPE_SMALLINT, false}, {TYPE_DATE, false}, {TYPE_INT, false}, {TYPE_BIGINT, true}};
+    Columns key_columns;
+    for (auto type : types) {
+        key_columns.emplace_back(ColumnHelper::create_column(TypeDescriptor(type.first), type.second));
+    }
+    const int num_rows = 48;
+    for (int i = 0; i < num_rows; ++i) {
+        key_columns[0]->append_datum(Datum((int8_t)(i % 2)));
+        key_columns[1]->append_datum(Datum((int16_t)(i % 4)));
+        key_columns[2]->append_datum(Datum(DateValue::create(2021, 1, 1 + i % 4)));
+        key_columns[3]->append_datum(Datum((int32_t)(i % 8)));
+        if (i % 16 == 0) {
+            ASSERT_TRUE(key_columns[4]->append_nulls(1));
+        } else {
+            key_columns[4]->append_datum(Datum((int64_t)(i % 16)));
+        }
+    }
+    // every 16 rows have the same keys
+    key.fixed_byte_size = 0;
+    Buffer<AggDataPtr> agg_states(chunk_size);
+    key.compute_agg_states(
+            num_rows, key_columns, &pool, [&]() { return pool.allocate(16); }, &agg_states);
+    ASSERT_EQ(16, key.hash_map.size());
+    for (int i = 16; i < num_rows; ++i) {
+        ASSERT_EQ(agg_states[i - 16], agg_states[i]);
+    }
+
+    std::vector<TestAggHashMap::key_type> resv;
+    for (auto [k, _] : key.hash_map) {
+        resv.emplace_back(k);
+    }
+    Columns res_columns;
+    for (auto type : types) {
+        res_columns.emplace_back(ColumnHelper::create_column(TypeDescriptor(type.first), type.second));
+    }
+    key.insert_keys_to_columns(resv, res_columns, resv.size());
+    std::set<std::string> expected;
+    std::set<std::string> actual;
+    for (int i = 0; i < num_rows; ++i) {
+        std::string row;
+        for (auto& column : key_columns) {
+            row += column->debug_item(i) + ",";
+        }
+        expected.insert(row);
+    }
+    for (int i = 0; i < resv.size(); ++i) {
+        std::string row;
+        for (auto& column : res_columns) {
+            row += column->debug_item(i) + ",";
+        }
+        actual.insert(row);
+    }
+    ASSERT_EQ(expected, actual);
+}
+
+TEST(HashMapTest, SerializedKeyPrefetch) {
+    // the keys of a large hash map are hashed by chunk and their buckets are prefetched
+    const int chunk_size = 4096;
+    SerializedKeyAggHashMap<PhmapSeed1> key(chunk_size);
+    MemPool pool;
+    Buffer<AggDataPtr> agg_states(chunk_size);
+    auto allocate = [&]() { return pool.allocate(16); };
+    auto make_key_columns = [&](int start) {
+        auto c1 = Int32Column::create();
+        auto c2 = BinaryColumn::create();
+        for (int i = start; i < start + chunk_size; i++) {
+            c1->append(i);
+            c2->append(std::to_string(i));
+        }
+        return Columns{c1, c2};
+    };
+
+    for (int start = 0; start < 4 * chunk_size; start += chunk_size) {
+        key.compute_agg_states(chunk_size, make_key_columns(start), &pool, allocate, &agg_states);
+    }
+    ASSERT_EQ(4 * chunk_size, key.hash_map.size());
+    ASSERT_GE(key.hash_map.bucket_count(), prefetch_threhold);
+
+    // half of the keys are found
+    std::vector<uint8_t> not_founds;
+    Buffer<AggDataPtr> agg_states3(chunk_size);
+    key.compute_agg_states(chunk_size, make_key_columns(chunk_size * 7 / 2), allocate, &agg_states3, &not_founds);
+    ASSERT_EQ(4 * chunk_size, key.hash_map.size());
+    for (int i = 0; i < chunk_size; i++) {
+        ASSERT_EQ(i < chunk_size / 2 ? 0 : 1, not_founds[i]);
+    }
+
+    key.compute_agg_states(chunk_size, make_key_columns(chunk_size * 3), &pool, allocate, &agg_states);
+    for (int i = 0; i < chunk_size / 2; i++) {
+        ASSERT_EQ(agg_states[chunk_size / 2 + i], agg_states3[i]);
+    }
+}
+
+TEST(HashMapTest, PartitionedSelection) {
+    const int chunk_size = 200;
+    Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1> key(chunk_size);
+    MemPool pool;
+    Buffer<AggDataPtr> agg_states(chunk_size);
+    auto allocate = [&]() { return pool.allocate(16); };
+
+    auto column = Int32Column::create();
+    for (int i = 0; i < chunk_size / 2; i++) {
+        column->append(i);
+    }
+    Columns key_columns{column};
+    key.compute_agg_states(column->size(), key_columns, &pool, allocate, &agg_states);
+    ASSERT_EQ(chunk_size / 2, key.hash_map.size());
+
+    // the new keys of the even partitions are aggregated, and the others are streamed
+    AggHashMapPartitionStats stats;
+    for (size_t p = 0; p < AggHashMapPartitionStats::MAX_PARTITIONS; p += 2) {
+        stats.aggregating[p] = 1;
+    }
+    for (int i = 0; i < chunk_size / 2; i++) {
+        column->append(i + 1000);
+    }
+    std::vector<uint8_t> not_founds;
+    key.compute_agg_states_by_partition(column->size(), key_columns, &pool, allocate, &agg_states, &not_founds,
+                                        &stats);
+    int64_t num_aggregated = 0;
+    for (int i = 0; i < chunk_size; i++) {
+        int32_t k = column->get_data()[i];
+        size_t partition = key.hash_map.subidx(key.hash_map.hash(k));
+        bool found = key.hash_map.find(k) != key.hash_map.end();
+        if (i < chunk_size / 2) {
+            ASSERT_TRUE(found);
+            ASSERT_EQ(0, not_founds[i]);
+        } else {
+            ASSERT_EQ(stats.aggregating[partition] != 0, found);
+            ASSERT_EQ(found ? 0 : 1, not_founds[i]);
+            num_aggregated += found;
+        }
+        if (found) {
+            ASSERT_EQ(key.hash_map.find(k)->second, agg_states[i]);
+        }
+    }
+    ASSERT_EQ(num_aggregated, stats.aggregated_new_key_rows);
+    double input_rows = 0;
+    double new_key_rows = 0;
+    for (size_t p = 0; p < AggHashMapPartitionStats::MAX_PARTITIONS; p++) {
+        input_rows += stats.input_rows[p];
+        new_key_rows += stats.new_key_rows[p];
+    }
+    ASSERT_EQ(chunk_size, input_rows);
+    ASSERT_EQ(chunk_size / 2, new_key_rows);
+}
+
+TEST(HashMapTest, TwoLevelSubmapIterate) {
+    Int32AggTwoLevelHashMap<PhmapSeed1> hash_map;
+    for (int32_t i = 0; i < 10000; i++) {
+        hash_map.emplace(i, nullptr);
+    }
+
+    // every key is iterated once by its sub map
+    std::set<int32_t> keys;
+    size_t num_keys = 0;
+    for (size_t submap = 0; submap < hash_map.subcnt(); submap++) {
+        size_t num_submap_keys = 0;
+        for (auto it = hash_map.begin(submap); it != hash_map.end(); ++it) {
+            ASSERT_EQ(submap, hash_map.subidx(hash_map.hash(it->first)));
+            keys.insert(it->first);
+            num_submap_keys++;
+        }
+        ASSERT_EQ(hash_map.size(submap), num_submap_keys);
+        num_keys += num_submap_keys;
+    }
+    ASSERT_EQ(hash_map.size(), num_keys);
+    ASSERT_EQ(hash_map.size(), keys.size());
+}
+
 TEST(HashMapTest, TwoLevelConvert) {
     std::vector<std::string> keys(1000);
     for (int i = 0; i < 1000; i++) {
@@ -12,6 +12,7 @@
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
 #include "exec/vectorized/arrow_to_starrocks_converter.h"
+#include "simd/simd.h"
 
 #define ASSERT_STATUS_OK(stmt)    \
     do {                          \
@@ -1233,4 +1234,51 @@ PARALLEL_TEST(ArrowConverterTest, test_map_to_json) {
     }
 }
 
+PARALLEL_TEST(ArrowConverterTest, test_fill_null_column_and_filter) {
+    arrow::Int32Builder builder;
+    for (int i = 0; i < 100; ++i) {
+        if (i % 3 == 0 || (i >= 40 && i < 60)) {
+            ASSERT_TRUE(builder.AppendNull().ok());
+        } else {
+            ASSERT_TRUE(builder.Append(i).ok());
+        }
+    }
+    std::shared_ptr<arrow::Array> array;
+    ASSERT_TRUE(builder.Finish(&array).ok());
+
+    // The slices start at the bits not aligned to bytes.
+    for (int64_t slice_offset : {0, 3, 13}) {
+        auto slice = array->Slice(slice_offset);
+        for (size_t start : {0, 1, 5, 8}) {
+            const size_t num_elements = slice->length() - start;
+            auto null_column = NullColumn::create();
+            null_column->append(DATUM_NOT_NULL);
+            size_t null_count = fill_null_column(slice.get(), start, num_elements, null_column.get(), 1);
+            ASSERT_EQ(num_elements + 1, null_column->size());
+
+            Column::Filter filter(num_elements + 1, 0);
+            fill_filter(slice.get(), start, num_elements, &filter, 1);
+
+            size_t expected_null_count = 0;
+            for (size_t i = 0; i < num_elements; ++i) {
+                bool is_null = slice->IsNull(start + i);
+                expected_null_count += is_null;
+                ASSERT_EQ(static_cast<uint8_t>(is_null), null_column->get_data()[i + 1]);
+                ASSERT_EQ(static_cast<uint8_t>(!is_null), filter[i + 1]);
+            }
+            ASSERT_EQ(expected_null_count, null_count);
+        }
+    }
+
+    // No validity bitmap.
+    arrow::Int32Builder not_null_builder;
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_TRUE(not_null_builder.Append(i).ok());
+    }
+    ASSERT_TRUE(not_null_builder.Finish(&array).ok());
+    auto null_column = NullColumn::create();
+    ASSERT_EQ(0, fill_null_column(array.get(), 2, 18, null_column.get(), 0));
+    ASSERT_EQ(0, SIMD::count_nonzero(null_column->get_data()));
+}
+
 } // namespace starrocks::vectorized
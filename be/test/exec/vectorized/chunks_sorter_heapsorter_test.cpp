@@ -14,8 +14,10 @@
 #include "column/vectorized_fwd.h"
 #include "common/object_pool.h"
 #include "exec/vectorized/chunk_sorter_heapsorter.h"
+#include "exec/vectorized/topn_runtime_filter.h"
 #include "exprs/expr_context.h"
 #include "exprs/vectorized/column_ref.h"
+#include "runtime/descriptors.h"
 #include "runtime/primitive_type.h"
 #include "runtime/primitive_type_infra.h"
 #include "runtime/types.h"
@@ -299,4 +301,55 @@ TEST_F(HeapChunkSorterTest, single_column_order_by_nullable_test) {
     }
 }
 
+TEST_F(HeapChunkSorterTest, topn_boundary_test) {
+    std::vector<bool> is_asc = {false};
+    std::vector<bool> null_first = {false};
+    TypeDescriptor type_desc(TYPE_INT);
+    std::vector<ExprContext*> sort_exprs;
+    sort_exprs.push_back(_pool.add(new ExprContext(_pool.add(new ColumnRef(type_desc, 0)))));
+
+    auto make_chunk = [](int32_t begin, int32_t end) {
+        auto column = Int32Column::create();
+        for (int32_t i = begin; i < end; ++i) {
+            column->append(i);
+        }
+        Chunk::SlotHashMap map;
+        map[0] = 0;
+        return std::make_shared<Chunk>(Columns{column}, map);
+    };
+
+    HeapChunkSorter sorter(_runtime_state.get(), &sort_exprs, &is_asc, &null_first, "", 0, 10);
+    sorter.setup_runtime(_pool.add(new RuntimeProfile("")));
+    Datum boundary;
+    sorter.update(nullptr, make_chunk(0, 5));
+    ASSERT_FALSE(sorter.get_topn_boundary(&boundary));
+    sorter.update(nullptr, make_chunk(5, 100));
+    ASSERT_TRUE(sorter.get_topn_boundary(&boundary));
+    ASSERT_EQ(90, boundary.get_int32());
+
+    // Only the tighter boundaries are kept.
+    TopnRuntimeFilter topn_filter(0, type_desc, false);
+    ASSERT_EQ(0, topn_filter.version());
+    topn_filter.update(boundary);
+    ASSERT_EQ(1, topn_filter.version());
+    topn_filter.update(Datum(int32_t(80)));
+    ASSERT_EQ(1, topn_filter.version());
+    topn_filter.update(Datum(int32_t(95)));
+    ASSERT_EQ(2, topn_filter.version());
+
+    TSlotDescriptor t_slot;
+    t_slot.__set_id(0);
+    t_slot.__set_colName("v");
+    t_slot.__set_slotType(type_desc.to_thrift());
+    SlotDescriptor slot(t_slot);
+    TCondition condition;
+    size_t version = 0;
+    ASSERT_TRUE(topn_filter.get_condition(&slot, &condition, &version));
+    ASSERT_EQ(2, version);
+    ASSERT_EQ("v", condition.column_name);
+    ASSERT_EQ(">=", condition.condition_op);
+    ASSERT_EQ(std::vector<std::string>{"95"}, condition.condition_values);
+    ASSERT_TRUE(condition.is_index_filter_only);
+}
+
 } // namespace starrocks::vectorized
@@ -7,8 +7,10 @@
 #include "column/column_helper.h"
 #include "column/datum_tuple.h"
 #include "column/nullable_column.h"
+#include "common/config.h"
 #include "exec/vectorized/chunks_sorter_full_sort.h"
 #include "exec/vectorized/chunks_sorter_topn.h"
+#include "exec/vectorized/sorting/merge.h"
 #include "exec/vectorized/sorting/sort_helper.h"
 #include "exec/vectorized/sorting/sort_permute.h"
 #include "exec/vectorized/sorting/sorting.h"
@@ -16,6 +18,9 @@
 #include "fmt/core.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "storage/olap_define.h"
+#include "util/defer_op.h"
+#include "util/file_utils.h"
 #include "util/json.h"
 
 namespace starrocks::vectorized {
@@ -201,6 +206,61 @@ TEST_F(ChunksSorterTest, full_sort_incremental) {
     clear_sort_exprs(sort_exprs);
 }
 
+// NOLINTNEXTLINE
+TEST_F(ChunksSorterTest, full_sort_with_spill) {
+    std::string tmp_dir = config::storage_root_path + TMP_PREFIX;
+    FileUtils::create_dir(tmp_dir);
+    // spill every chunk as a sorted run
+    int64_t old_spill_limit = config::spill_operator_mem_limit_bytes;
+    config::spill_operator_mem_limit_bytes = 0;
+    DeferOp defer([&]() {
+        config::spill_operator_mem_limit_bytes = old_spill_limit;
+        FileUtils::remove(tmp_dir);
+    });
+
+    TUniqueId fragment_id;
+    TQueryOptions query_options;
+    query_options.batch_size = 4;
+    query_options.enable_spilling = true;
+    TQueryGlobals query_globals;
+    RuntimeState runtime_state(fragment_id, query_options, query_globals, nullptr);
+    runtime_state.init_instance_mem_tracker();
+
+    std::vector<bool> is_asc{true, false};
+    std::vector<bool> is_null_first{true, true};
+    std::vector<ExprContext*> sort_exprs;
+    sort_exprs.push_back(new ExprContext(_expr_region.get()));
+    sort_exprs.push_back(new ExprContext(_expr_cust_key.get()));
+
+    ChunksSorterFullSort sorter(&runtime_state, &sort_exprs, &is_asc, &is_null_first, "");
+    sorter.set_spill_enabled(true);
+    ASSERT_TRUE(sorter.update(&runtime_state, _chunk_1).ok());
+    ASSERT_TRUE(sorter.update(&runtime_state, _chunk_2).ok());
+    ASSERT_TRUE(sorter.update(&runtime_state, _chunk_3).ok());
+    ASSERT_TRUE(sorter.done(&runtime_state).ok());
+    ASSERT_TRUE(sorter.has_spilled());
+    ASSERT_EQ(16, sorter.get_partition_rows());
+
+    std::vector<std::unique_ptr<SimpleChunkSortCursor>> cursors;
+    sorter.create_sorted_cursors(&cursors);
+    ASSERT_EQ(3, cursors.size());
+
+    std::vector<int32_t> result;
+    SortDescs sort_desc({1, -1}, {-1, 1});
+    auto st = merge_sorted_cursor_cascade(sort_desc, std::move(cursors), [&](ChunkUniquePtr chunk) {
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            result.push_back(chunk->get(i).get(0).get_int32());
+        }
+        return Status::OK();
+    });
+    ASSERT_TRUE(st.ok());
+    ASSERT_TRUE(sorter.spill_status().ok());
+    std::vector<int32_t> expected{71, 70, 69, 58, 56, 55, 54, 52, 49, 41, 24, 16, 12, 6, 4, 2};
+    EXPECT_EQ(expected, result);
+
+    clear_sort_exprs(sort_exprs);
+}
+
 static ColumnPtr make_int32_column(const std::vector<int32_t>& xs) {
     auto column = Int32Column::create();
     for (auto x : xs) {
@@ -0,0 +1,99 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/vectorized/cross_join_range_predicate.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/nullable_column.h"
+
+namespace starrocks::vectorized {
+
+static constexpr SlotId kProbeSlotId = 1;
+static constexpr SlotId kBuildSlotId = 2;
+static constexpr SlotId kPayloadSlotId = 3;
+
+static ChunkPtr create_build_chunk() {
+    // build values: 5, NULL, 1, 3, 3, NULL, 9
+    auto build_column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    auto payload_column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false);
+    std::vector<int32_t> values{5, 0, 1, 3, 3, 0, 9};
+    for (int32_t i = 0; i < values.size(); i++) {
+        if (i == 1 || i == 5) {
+            build_column->append_nulls(1);
+        } else {
+            build_column->append_datum(Datum(values[i]));
+        }
+        payload_column->append_datum(Datum(i));
+    }
+    Chunk::SlotHashMap slot_map{{kBuildSlotId, 0}, {kPayloadSlotId, 1}};
+    return std::make_shared<Chunk>(Columns{build_column, payload_column}, slot_map);
+}
+
+static ChunkPtr create_probe_chunk(const std::vector<int32_t>& values) {
+    auto probe_column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    for (int32_t value : values) {
+        probe_column->append_datum(Datum(value));
+    }
+    probe_column->append_nulls(1);
+    Chunk::SlotHashMap slot_map{{kProbeSlotId, 0}};
+    return std::make_shared<Chunk>(Columns{probe_column}, slot_map);
+}
+
+// NOLINTNEXTLINE
+TEST(CrossJoinRangePredicateTest, sort_build_chunk) {
+    CrossJoinRangePredicate predicate(kProbeSlotId, kBuildSlotId, TYPE_INT, TExprOpcode::LT);
+    bool cancel = false;
+    ChunkPtr build_chunk = create_build_chunk();
+    ASSERT_TRUE(predicate.sort_build_chunk(cancel, &build_chunk).ok());
+    ASSERT_EQ(7, build_chunk->num_rows());
+
+    const auto& build_column = build_chunk->get_column_by_slot_id(kBuildSlotId);
+    ASSERT_TRUE(build_column->is_null(0));
+    ASSERT_TRUE(build_column->is_null(1));
+    std::vector<int32_t> expected{1, 3, 3, 5, 9};
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i], build_column->get(i + 2).get_int32());
+    }
+    // The other columns are permuted together with the build slot.
+    const auto& payload_column = build_chunk->get_column_by_slot_id(kPayloadSlotId);
+    ASSERT_EQ(2, payload_column->get(2).get_int32());
+    ASSERT_EQ(0, payload_column->get(5).get_int32());
+    ASSERT_EQ(6, payload_column->get(6).get_int32());
+}
+
+// NOLINTNEXTLINE
+TEST(CrossJoinRangePredicateTest, build_range) {
+    bool cancel = false;
+    ChunkPtr probe_chunk = create_probe_chunk({0, 3, 10});
+    // Sorted build values: NULL, NULL, 1, 3, 3, 5, 9
+    struct Case {
+        TExprOpcode::type op;
+        std::vector<std::pair<size_t, size_t>> ranges;
+    };
+    std::vector<Case> cases{
+            // probe < build
+            {TExprOpcode::LT, {{2, 7}, {5, 7}, {7, 7}}},
+            // probe <= build
+            {TExprOpcode::LE, {{2, 7}, {3, 7}, {7, 7}}},
+            // probe > build
+            {TExprOpcode::GT, {{2, 2}, {2, 3}, {2, 7}}},
+            // probe >= build
+            {TExprOpcode::GE, {{2, 2}, {2, 5}, {2, 7}}},
+    };
+    for (const auto& c : cases) {
+        CrossJoinRangePredicate predicate(kProbeSlotId, kBuildSlotId, TYPE_INT, c.op);
+        ChunkPtr build_chunk = create_build_chunk();
+        ASSERT_TRUE(predicate.sort_build_chunk(cancel, &build_chunk).ok());
+        for (size_t i = 0; i < c.ranges.size(); i++) {
+            ASSERT_EQ(c.ranges[i], predicate.build_range(*probe_chunk, i, *build_chunk))
+                    << "op=" << c.op << ", probe row=" << i;
+        }
+        // A null probe row matches nothing.
+        auto [begin, end] = predicate.build_range(*probe_chunk, 3, *build_chunk);
+        ASSERT_EQ(begin, end);
+    }
+}
+
+} // namespace starrocks::vectorized
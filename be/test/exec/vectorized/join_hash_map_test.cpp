@@ -6,6 +6,9 @@
 
 #include "runtime/descriptor_helper.h"
 #include "runtime/exec_env.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
+#include "util/threadpool.h"
 
 namespace starrocks::vectorized {
 class JoinHashMapTest : public ::testing::Test {
@@ -929,6 +932,98 @@ TEST_F(JoinHashMapTest, JoinBuildProbeFuncNullable) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, PartitionedJoinBuildProbeFunc) {
+    JoinHashTableItems table_items;
+    HashTableProbeState probe_state;
+    auto runtime_state = create_runtime_state();
+    runtime_state->init_instance_mem_tracker();
+
+    // every key appears twice
+    const uint32_t row_count = 200000;
+    auto type = TypeDescriptor::from_primtive_type(PrimitiveType::TYPE_INT);
+    auto build_column = ColumnHelper::create_column(type, false);
+    build_column->append_default();
+    build_column->append(*JoinHashMapTest::create_int32_column(row_count / 2, 0), 0, row_count / 2);
+    build_column->append(*JoinHashMapTest::create_int32_column(row_count / 2, 0), 0, row_count / 2);
+    table_items.key_columns.emplace_back(build_column);
+    table_items.row_count = row_count;
+
+    JoinBuildFunc<TYPE_INT>::prepare(nullptr, &table_items);
+    ASSERT_GT(table_items.bucket_size, JOIN_HASH_MAP_PARTITION_BUCKETS);
+    ASSERT_TRUE(table_items.enable_prefetch);
+    ASSERT_EQ(row_count + 1, table_items.build_buckets.size());
+    JoinBuildFunc<TYPE_INT>::construct_hash_table(runtime_state.get(), &table_items, &probe_state);
+    JoinHashMapHelper::link_partitioned_rows(&table_items);
+    ASSERT_TRUE(table_items.build_buckets.empty());
+
+    // the same as the hash table linked in the order of the rows
+    const auto& data = ColumnHelper::as_raw_column<Int32Column>(table_items.key_columns[0])->get_data();
+    Buffer<uint32_t> first(table_items.bucket_size, 0);
+    Buffer<uint32_t> next(row_count + 1, 0);
+    for (uint32_t i = 1; i <= row_count; i++) {
+        uint32_t bucket = JoinHashMapHelper::calc_bucket_num<int32_t>(data[i], table_items.bucket_size);
+        next[i] = first[bucket];
+        first[bucket] = i;
+    }
+    ASSERT_EQ(first, table_items.first);
+    ASSERT_EQ(next, table_items.next);
+
+    const uint32_t probe_row_count = runtime_state->chunk_size();
+    auto probe_column = JoinHashMapTest::create_int32_column(probe_row_count, 0);
+    Columns probe_columns{probe_column};
+    probe_state.key_columns = &probe_columns;
+    probe_state.probe_row_count = probe_row_count;
+    probe_state.buckets.resize(probe_row_count);
+    probe_state.next.resize(probe_row_count, 0);
+    JoinProbeFunc<TYPE_INT>::prepare(runtime_state.get(), &probe_state);
+    JoinProbeFunc<TYPE_INT>::lookup_init(table_items, &probe_state);
+    for (uint32_t i = 0; i < probe_row_count; i++) {
+        std::vector<uint32_t> found;
+        for (uint32_t index = probe_state.next[i]; index != 0; index = table_items.next[index]) {
+            if (data[index] == static_cast<int32_t>(i)) {
+                found.push_back(index);
+            }
+        }
+        ASSERT_EQ((std::vector<uint32_t>{i + 1 + row_count / 2, i + 1}), found);
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, ParallelPartitionedJoinBuildFunc) {
+    auto old_min_rows = config::pipeline_hash_join_parallel_build_min_rows;
+    config::pipeline_hash_join_parallel_build_min_rows = 10000;
+    DeferOp defer([&]() { config::pipeline_hash_join_parallel_build_min_rows = old_min_rows; });
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPoolBuilder("join_build").set_max_threads(4).build(&pool));
+
+    auto runtime_state = create_runtime_state();
+    runtime_state->init_instance_mem_tracker();
+    const uint32_t row_count = 300000;
+    auto type = TypeDescriptor::from_primtive_type(PrimitiveType::TYPE_INT);
+    auto build_column = ColumnHelper::create_column(type, false);
+    build_column->append_default();
+    build_column->append(*JoinHashMapTest::create_int32_column(row_count / 3, 0), 0, row_count / 3);
+    build_column->append(*JoinHashMapTest::create_int32_column(row_count / 3, 0), 0, row_count / 3);
+    build_column->append(*JoinHashMapTest::create_int32_column(row_count / 3, 0), 0, row_count / 3);
+
+    // build the same hash table with and without the pool
+    JoinHashTableItems table_items[2];
+    HashTableProbeState probe_state[2];
+    for (int k = 0; k < 2; k++) {
+        table_items[k].key_columns.emplace_back(build_column);
+        table_items[k].row_count = row_count;
+        table_items[k].build_pool = k == 0 ? nullptr : pool.get();
+        JoinBuildFunc<TYPE_INT>::prepare(nullptr, &table_items[k]);
+        ASSERT_TRUE(table_items[k].enable_prefetch);
+        JoinBuildFunc<TYPE_INT>::construct_hash_table(runtime_state.get(), &table_items[k], &probe_state[k]);
+        JoinHashMapHelper::link_partitioned_rows(&table_items[k]);
+        ASSERT_TRUE(table_items[k].build_buckets.empty());
+    }
+    ASSERT_EQ(table_items[0].first, table_items[1].first);
+    ASSERT_EQ(table_items[0].next, table_items[1].next);
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, DirectMappingJoinBuildProbeFunc) {
     TDescriptorTableBuilder row_desc_builder;
@@ -1693,6 +1788,66 @@ TEST_F(JoinHashMapTest, OneKeyJoinHashTable) {
     hash_table.close();
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, JoinHashTableStats) {
+    auto runtime_profile = create_runtime_profile();
+    auto runtime_state = create_runtime_state();
+    std::shared_ptr<ObjectPool> object_pool = std::make_shared<ObjectPool>();
+    config::vector_chunk_size = 4096;
+
+    TDescriptorTableBuilder row_desc_builder;
+    add_tuple_descriptor(&row_desc_builder, PrimitiveType::TYPE_INT, false);
+    add_tuple_descriptor(&row_desc_builder, PrimitiveType::TYPE_INT, false);
+
+    std::shared_ptr<RowDescriptor> row_desc = create_row_desc(object_pool, &row_desc_builder, false);
+    std::shared_ptr<RowDescriptor> probe_row_desc = create_probe_desc(object_pool, &row_desc_builder, false);
+    std::shared_ptr<RowDescriptor> build_row_desc = create_build_desc(object_pool, &row_desc_builder, false);
+
+    HashTableParam param;
+    param.with_other_conjunct = false;
+    param.join_type = TJoinOp::INNER_JOIN;
+    param.row_desc = row_desc.get();
+    param.join_keys.emplace_back(JoinKeyDesc{&_int_type, false, nullptr});
+    param.probe_row_desc = probe_row_desc.get();
+    param.build_row_desc = build_row_desc.get();
+    param.search_ht_timer = ADD_TIMER(runtime_profile, "SearchHashTableTime");
+    param.output_build_column_timer = ADD_TIMER(runtime_profile, "OutputBuildColumnTime");
+    param.output_probe_column_timer = ADD_TIMER(runtime_profile, "OutputProbeColumnTime");
+    param.output_tuple_column_timer = ADD_TIMER(runtime_profile, "OutputTupleColumnTime");
+
+    JoinHashTable hash_table;
+    hash_table.create(param);
+    ASSERT_EQ(0, hash_table.compute_stats().bucket_count);
+
+    // Every key is built twice.
+    for (int i = 0; i < 2; i++) {
+        auto build_chunk = create_int32_build_chunk(10, false);
+        Columns build_keys_column{build_chunk->columns()[0]};
+        hash_table.append_chunk(runtime_state.get(), build_chunk, build_keys_column);
+    }
+    hash_table.build(runtime_state.get());
+
+    JoinHashTableStats stats = hash_table.compute_stats();
+    ASSERT_EQ(hash_table.get_bucket_size(), stats.bucket_count);
+    ASSERT_EQ(20, stats.row_count);
+    ASSERT_GT(stats.used_bucket_count, 0);
+    ASSERT_LE(stats.used_bucket_count, 10);
+    ASSERT_DOUBLE_EQ(20.0 / stats.bucket_count, stats.load_factor());
+    ASSERT_GE(stats.avg_chain_length(), 2.0);
+    // All the buckets are sampled for such a small table.
+    ASSERT_GE(stats.avg_probe_length, stats.avg_chain_length());
+    ASSERT_GE(stats.max_probe_length, 2);
+
+    JoinHashTableStatsCounters counters;
+    counters.init(runtime_profile.get());
+    hash_table.update_stats_counters(counters);
+    ASSERT_EQ("key32", *runtime_profile->get_info_string("HashMapType"));
+    ASSERT_EQ(stats.used_bucket_count, counters.used_buckets->value());
+    ASSERT_EQ(stats.max_probe_length, counters.max_probe_length->value());
+
+    hash_table.close();
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, OneNullableKeyJoinHashTable) {
     auto runtime_profile = create_runtime_profile();
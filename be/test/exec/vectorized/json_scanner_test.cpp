@@ -758,6 +758,39 @@ TEST_F(JsonScannerTest, test_ndjson_expanded_with_json_root) {
     EXPECT_EQ("['v5', 'server', {\"ip\": \"10.10.0.5\", \"value\": \"50\"}]", chunk->debug_row(4));
 }
 
+TEST_F(JsonScannerTest, test_ndjson_with_simple_jsonpath) {
+    std::vector<TypeDescriptor> types;
+    types.emplace_back(TypeDescriptor::create_varchar_type(20));
+    types.emplace_back(TypeDescriptor::create_varchar_type(20));
+    types.emplace_back(TypeDescriptor::create_varchar_type(20));
+
+    std::vector<TBrokerRangeDesc> ranges;
+    TBrokerRangeDesc range;
+    range.format_type = TFileFormatType::FORMAT_JSON;
+    range.strip_outer_array = false;
+    range.__isset.strip_outer_array = false;
+    range.__isset.jsonpaths = true;
+    // The json paths are not in the order of the object keys, and "$.none" does not exist.
+    range.jsonpaths = "[\"$.kind\", \"$.none\", \"$.k1\"]";
+    range.__isset.json_root = false;
+    range.__set_path("./be/test/exec/test_data/json_scanner/test_ndjson.json");
+    ranges.emplace_back(range);
+
+    auto scanner = create_json_scanner(types, ranges, {"kind", "none", "k1"});
+
+    Status st;
+    st = scanner->open();
+    ASSERT_TRUE(st.ok());
+
+    ChunkPtr chunk = scanner->get_next().value();
+    EXPECT_EQ(3, chunk->num_columns());
+    EXPECT_EQ(5, chunk->num_rows());
+
+    EXPECT_EQ("['server', NULL, 'v1']", chunk->debug_row(0));
+    EXPECT_EQ("['server', NULL, 'v2']", chunk->debug_row(1));
+    EXPECT_EQ("['server', NULL, 'v5']", chunk->debug_row(4));
+}
+
 // this test covers json_scanner.cpp:_construct_row_in_object_order.
 TEST_F(JsonScannerTest, test_construct_row_in_object_order) {
     std::vector<TypeDescriptor> types;
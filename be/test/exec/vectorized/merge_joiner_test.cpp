@@ -0,0 +1,150 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/vectorized/merge_joiner.h"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+
+#include "column/column_helper.h"
+#include "exprs/expr_context.h"
+#include "exprs/vectorized/column_ref.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks::vectorized {
+
+// Left tuple: (k0 nullable int, v0 int), right tuple: (k1 nullable int, v1 int).
+static constexpr SlotId kLeftKeySlotId = 0;
+static constexpr SlotId kLeftValueSlotId = 1;
+static constexpr SlotId kRightKeySlotId = 2;
+static constexpr SlotId kRightValueSlotId = 3;
+static constexpr int32_t kNull = -1;
+
+class MergeJoinerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        TDescriptorTableBuilder desc_builder;
+        for (int i = 0; i < 2; i++) {
+            TTupleDescriptorBuilder tuple_builder;
+            tuple_builder.add_slot(
+                    TSlotDescriptorBuilder().type(TYPE_INT).column_name("k").column_pos(0).nullable(true).build());
+            tuple_builder.add_slot(
+                    TSlotDescriptorBuilder().type(TYPE_INT).column_name("v").column_pos(1).nullable(false).build());
+            tuple_builder.build(&desc_builder);
+        }
+        DescriptorTbl* tbl = nullptr;
+        ASSERT_TRUE(DescriptorTbl::create(&_pool, desc_builder.desc_tbl(), &tbl, config::vector_chunk_size).ok());
+        _left_row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{0}, std::vector<bool>{false});
+        _right_row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{1}, std::vector<bool>{false});
+
+        _left_expr_ctxs.push_back(
+                _pool.add(new ExprContext(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), kLeftKeySlotId)))));
+        _right_expr_ctxs.push_back(
+                _pool.add(new ExprContext(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), kRightKeySlotId)))));
+
+        TQueryOptions query_options;
+        // A small chunk size splits the output of a run.
+        query_options.batch_size = 4;
+        _runtime_state = std::make_unique<RuntimeState>(TUniqueId(), query_options, TQueryGlobals(), nullptr);
+    }
+
+    static ChunkPtr create_chunk(SlotId key_slot_id, SlotId value_slot_id, const std::vector<int32_t>& keys,
+                                 int32_t first_value) {
+        auto key_column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+        auto value_column = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false);
+        for (int32_t i = 0; i < keys.size(); i++) {
+            if (keys[i] == kNull) {
+                key_column->append_nulls(1);
+            } else {
+                key_column->append_datum(Datum(keys[i]));
+            }
+            value_column->append_datum(Datum(first_value + i));
+        }
+        Chunk::SlotHashMap slot_map{{key_slot_id, 0}, {value_slot_id, 1}};
+        return std::make_shared<Chunk>(Columns{key_column, value_column}, slot_map);
+    }
+
+    // Returns the (left value, right value) pairs of the output, the right value is kNull if it's absent.
+    std::vector<std::pair<int32_t, int32_t>> join(TJoinOp::type join_op) {
+        // Left keys: NULL, 1, 2, 2, 4, 5
+        std::deque<ChunkPtr> left_chunks{create_chunk(kLeftKeySlotId, kLeftValueSlotId, {kNull, 1}, 0),
+                                         create_chunk(kLeftKeySlotId, kLeftValueSlotId, {2, 2, 4, 5}, 2)};
+        // Right keys: NULL, 2, 2, 2, 3, 5, 5, the run of 2 and 5 spans chunks.
+        std::deque<ChunkPtr> right_chunks{create_chunk(kRightKeySlotId, kRightValueSlotId, {kNull, 2}, 0),
+                                          create_chunk(kRightKeySlotId, kRightValueSlotId, {2}, 2),
+                                          create_chunk(kRightKeySlotId, kRightValueSlotId, {2, 3, 5}, 3),
+                                          create_chunk(kRightKeySlotId, kRightValueSlotId, {5}, 6)};
+
+        MergeJoiner joiner(join_op, _left_expr_ctxs, _right_expr_ctxs, *_left_row_desc, *_right_row_desc);
+        std::vector<std::pair<int32_t, int32_t>> rows;
+        while (!joiner.is_finished()) {
+            if (joiner.need_left()) {
+                if (left_chunks.empty()) {
+                    joiner.set_left_eos();
+                } else {
+                    EXPECT_TRUE(joiner.push_left(_runtime_state.get(), left_chunks.front()).ok());
+                    left_chunks.pop_front();
+                }
+            } else if (joiner.need_right()) {
+                if (right_chunks.empty()) {
+                    joiner.set_right_eos();
+                } else {
+                    EXPECT_TRUE(joiner.push_right(_runtime_state.get(), right_chunks.front()).ok());
+                    right_chunks.pop_front();
+                }
+            } else {
+                ChunkPtr chunk;
+                EXPECT_TRUE(joiner.pull(_runtime_state.get(), &chunk).ok());
+                if (chunk == nullptr) {
+                    continue;
+                }
+                EXPECT_LE(chunk->num_rows(), _runtime_state->chunk_size());
+                for (size_t i = 0; i < chunk->num_rows(); i++) {
+                    int32_t left_value = chunk->get_column_by_slot_id(kLeftValueSlotId)->get(i).get_int32();
+                    int32_t right_value = kNull;
+                    if (chunk->is_slot_exist(kRightValueSlotId)) {
+                        Datum datum = chunk->get_column_by_slot_id(kRightValueSlotId)->get(i);
+                        right_value = datum.is_null() ? kNull : datum.get_int32();
+                    }
+                    rows.emplace_back(left_value, right_value);
+                }
+            }
+        }
+        return rows;
+    }
+
+    ObjectPool _pool;
+    std::unique_ptr<RowDescriptor> _left_row_desc;
+    std::unique_ptr<RowDescriptor> _right_row_desc;
+    std::vector<ExprContext*> _left_expr_ctxs;
+    std::vector<ExprContext*> _right_expr_ctxs;
+    std::unique_ptr<RuntimeState> _runtime_state;
+};
+
+// NOLINTNEXTLINE
+TEST_F(MergeJoinerTest, inner_join) {
+    std::vector<std::pair<int32_t, int32_t>> expected{{2, 1}, {2, 2}, {2, 3}, {3, 1}, {3, 2}, {3, 3}, {5, 5}, {5, 6}};
+    ASSERT_EQ(expected, join(TJoinOp::INNER_JOIN));
+}
+
+// NOLINTNEXTLINE
+TEST_F(MergeJoinerTest, left_outer_join) {
+    std::vector<std::pair<int32_t, int32_t>> expected{{0, kNull}, {1, kNull}, {2, 1}, {2, 2}, {2, 3}, {3, 1},
+                                                      {3, 2},     {3, 3},     {4, kNull}, {5, 5}, {5, 6}};
+    ASSERT_EQ(expected, join(TJoinOp::LEFT_OUTER_JOIN));
+}
+
+// NOLINTNEXTLINE
+TEST_F(MergeJoinerTest, left_semi_join) {
+    std::vector<std::pair<int32_t, int32_t>> expected{{2, kNull}, {3, kNull}, {5, kNull}};
+    ASSERT_EQ(expected, join(TJoinOp::LEFT_SEMI_JOIN));
+}
+
+// NOLINTNEXTLINE
+TEST_F(MergeJoinerTest, left_anti_join) {
+    std::vector<std::pair<int32_t, int32_t>> expected{{0, kNull}, {1, kNull}, {4, kNull}};
+    ASSERT_EQ(expected, join(TJoinOp::LEFT_ANTI_JOIN));
+}
+
+} // namespace starrocks::vectorized
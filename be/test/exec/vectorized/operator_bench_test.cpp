@@ -0,0 +1,500 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "common/config.h"
+#include "exec/vectorized/aggregate/agg_hash_variant.h"
+#include "exec/vectorized/join_hash_map.h"
+#include "exprs/vectorized/runtime_filter.h"
+#include "exprs/vectorized/runtime_filter_bank.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/mem_pool.h"
+#include "runtime/runtime_state.h"
+#include "serde/protobuf_serde.h"
+#include "util/block_compression.h"
+
+// Benchmarks of the hash join, the aggregation hash maps, the runtime filters and the exchange serialization.
+// The inputs are parameterized by the cardinality of the keys, and the percentage of the null keys, the width
+// of the keys is decided by the key types of each case.
+namespace starrocks::vectorized {
+
+static constexpr int kBenchChunkSize = 4096;
+static constexpr int kBenchNumChunks = 16;
+
+static TypeDescriptor bench_type_desc(PrimitiveType type) {
+    if (type == TYPE_VARCHAR) {
+        return TypeDescriptor::create_varchar_type(TypeDescriptor::MAX_VARCHAR_LENGTH);
+    }
+    return TypeDescriptor(type);
+}
+
+static void append_key(Column* column, PrimitiveType type, int64_t value) {
+    switch (type) {
+    case TYPE_TINYINT:
+        column->append_datum(Datum(static_cast<int8_t>(value)));
+        break;
+    case TYPE_INT:
+        column->append_datum(Datum(static_cast<int32_t>(value)));
+        break;
+    case TYPE_BIGINT:
+        // Spread the keys over the whole range to avoid the trivial hash values of the small integers.
+        column->append_datum(Datum(static_cast<int64_t>(value * 0x9E3779B97F4A7C15ULL)));
+        break;
+    case TYPE_VARCHAR: {
+        // 16 bytes strings.
+        char buf[32];
+        int len = snprintf(buf, sizeof(buf), "key-%012ld", static_cast<long>(value));
+        column->append_datum(Datum(Slice(buf, len)));
+        break;
+    }
+    default:
+        CHECK(false) << "not supported type: " << type;
+    }
+}
+
+// Generates a chunk of |num_rows| rows, whose columns are of |types| and use the slot ids from |first_slot_id|.
+// If |sequential| is true, the keys are start, start + 1, ..., otherwise they are drawn from [0, cardinality).
+// |null_percent| percent of the keys are null.
+static ChunkPtr gen_chunk(const std::vector<PrimitiveType>& types, SlotId first_slot_id, size_t num_rows,
+                          bool sequential, int64_t start, int64_t cardinality, int null_percent, std::mt19937_64& rng) {
+    std::uniform_int_distribution<int64_t> key_dist(0, cardinality - 1);
+    std::uniform_int_distribution<int> percent_dist(0, 99);
+    auto chunk = std::make_shared<Chunk>();
+    for (size_t c = 0; c < types.size(); c++) {
+        ColumnPtr column = ColumnHelper::create_column(bench_type_desc(types[c]), null_percent > 0);
+        column->reserve(num_rows);
+        for (size_t i = 0; i < num_rows; i++) {
+            if (null_percent > 0 && percent_dist(rng) < null_percent) {
+                column->append_nulls(1);
+            } else {
+                int64_t key = sequential ? start + i : key_dist(rng);
+                append_key(column.get(), types[c], key + c);
+            }
+        }
+        chunk->append_column(std::move(column), first_slot_id + c);
+    }
+    return chunk;
+}
+
+static std::vector<ChunkPtr> gen_chunks(const std::vector<PrimitiveType>& types, SlotId first_slot_id,
+                                        size_t num_rows, bool sequential, int64_t cardinality, int null_percent) {
+    std::mt19937_64 rng(0);
+    std::vector<ChunkPtr> chunks;
+    for (size_t start = 0; start < num_rows; start += kBenchChunkSize) {
+        size_t rows = std::min<size_t>(kBenchChunkSize, num_rows - start);
+        chunks.emplace_back(gen_chunk(types, first_slot_id, rows, sequential, start, cardinality, null_percent, rng));
+    }
+    return chunks;
+}
+
+// Runs the benchmark with each pair of the cardinalities and the null percentages.
+static void bench_args(benchmark::internal::Benchmark* bench, const std::vector<int64_t>& cardinalities,
+                       const std::vector<int64_t>& null_percents) {
+    bench->ArgNames({"cardinality", "null_percent"})->Unit(benchmark::kMillisecond);
+    for (int64_t cardinality : cardinalities) {
+        for (int64_t null_percent : null_percents) {
+            bench->Args({cardinality, null_percent});
+        }
+    }
+}
+
+static std::shared_ptr<RuntimeState> create_bench_runtime_state() {
+    TUniqueId fragment_id;
+    TQueryOptions query_options;
+    query_options.batch_size = kBenchChunkSize;
+    TQueryGlobals query_globals;
+    auto runtime_state = std::make_shared<RuntimeState>(fragment_id, query_options, query_globals, nullptr);
+    runtime_state->init_instance_mem_tracker();
+    return runtime_state;
+}
+
+// ============================== hash join ==============================
+
+// The probe side is the tuple 0, whose slots are [0, num_keys), and the build side is the tuple 1, whose slots
+// are [num_keys, 2 * num_keys). Both sides only have the join keys.
+class JoinBenchContext {
+public:
+    JoinBenchContext(const std::vector<PrimitiveType>& key_types, bool nullable) : key_types(key_types) {
+        config::vector_chunk_size = kBenchChunkSize;
+        runtime_state = create_bench_runtime_state();
+        _profile = std::make_shared<RuntimeProfile>("JoinBench");
+
+        TDescriptorTableBuilder table_builder;
+        for (int tuple = 0; tuple < 2; tuple++) {
+            TTupleDescriptorBuilder tuple_builder;
+            for (size_t i = 0; i < key_types.size(); i++) {
+                TSlotDescriptorBuilder slot_builder;
+                if (key_types[i] == TYPE_VARCHAR) {
+                    slot_builder.string_type(255);
+                } else {
+                    slot_builder.type(key_types[i]);
+                }
+                tuple_builder.add_slot(
+                        slot_builder.column_name("c" + std::to_string(i)).column_pos(i).nullable(nullable).build());
+            }
+            tuple_builder.build(&table_builder);
+        }
+        DescriptorTbl* tbl = nullptr;
+        CHECK(DescriptorTbl::create(&_object_pool, table_builder.desc_tbl(), &tbl, kBenchChunkSize).ok());
+        _row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{0, 1}, std::vector<bool>{false, false});
+        _probe_row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{0}, std::vector<bool>{false});
+        _build_row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{1}, std::vector<bool>{false});
+
+        for (PrimitiveType type : key_types) {
+            _key_type_descs.emplace_back(bench_type_desc(type));
+        }
+        param.join_type = TJoinOp::INNER_JOIN;
+        param.row_desc = _row_desc.get();
+        param.probe_row_desc = _probe_row_desc.get();
+        param.build_row_desc = _build_row_desc.get();
+        for (const auto& type_desc : _key_type_descs) {
+            param.join_keys.emplace_back(JoinKeyDesc{&type_desc, false, nullptr});
+        }
+        param.search_ht_timer = ADD_TIMER(_profile, "SearchHashTableTime");
+        param.output_build_column_timer = ADD_TIMER(_profile, "OutputBuildColumnTime");
+        param.output_probe_column_timer = ADD_TIMER(_profile, "OutputProbeColumnTime");
+        param.output_tuple_column_timer = ADD_TIMER(_profile, "OutputTupleColumnTime");
+    }
+
+    void build(JoinHashTable* hash_table, const std::vector<ChunkPtr>& build_chunks) {
+        hash_table->create(param);
+        for (const auto& chunk : build_chunks) {
+            hash_table->append_chunk(runtime_state.get(), chunk, chunk->columns());
+        }
+        CHECK(hash_table->build(runtime_state.get()).ok());
+    }
+
+    const std::vector<PrimitiveType> key_types;
+    std::shared_ptr<RuntimeState> runtime_state;
+    HashTableParam param;
+
+private:
+    ObjectPool _object_pool;
+    std::shared_ptr<RuntimeProfile> _profile;
+    std::unique_ptr<RowDescriptor> _row_desc;
+    std::unique_ptr<RowDescriptor> _probe_row_desc;
+    std::unique_ptr<RowDescriptor> _build_row_desc;
+    std::vector<TypeDescriptor> _key_type_descs;
+};
+
+// range(0): the number of the build rows, each of them has a distinct key.
+// range(1): the percentage of the null keys.
+static void BM_join_build(benchmark::State& state, std::vector<PrimitiveType> key_types) {
+    const int64_t cardinality = state.range(0);
+    const int null_percent = state.range(1);
+    JoinBenchContext ctx(key_types, null_percent > 0);
+    auto build_chunks = gen_chunks(key_types, key_types.size(), cardinality, true, cardinality, null_percent);
+
+    for (auto _ : state) {
+        JoinHashTable hash_table;
+        ctx.build(&hash_table, build_chunks);
+        benchmark::DoNotOptimize(hash_table.get_bucket_size());
+        hash_table.close();
+    }
+    state.SetItemsProcessed(state.iterations() * cardinality);
+}
+
+// Half of the probe keys are found in the hash table.
+static void BM_join_probe(benchmark::State& state, std::vector<PrimitiveType> key_types) {
+    const int64_t cardinality = state.range(0);
+    const int null_percent = state.range(1);
+    JoinBenchContext ctx(key_types, null_percent > 0);
+    auto build_chunks = gen_chunks(key_types, key_types.size(), cardinality, true, cardinality, null_percent);
+    auto probe_chunks =
+            gen_chunks(key_types, 0, kBenchChunkSize * kBenchNumChunks, false, cardinality * 2, null_percent);
+
+    JoinHashTable hash_table;
+    ctx.build(&hash_table, build_chunks);
+    int64_t output_rows = 0;
+    for (auto _ : state) {
+        for (const auto& chunk : probe_chunks) {
+            ChunkPtr probe_chunk = chunk;
+            Columns key_columns = chunk->columns();
+            bool has_remain = true;
+            while (has_remain) {
+                ChunkPtr result = std::make_shared<Chunk>();
+                CHECK(hash_table.probe(ctx.runtime_state.get(), key_columns, &probe_chunk, &result, &has_remain)
+                              .ok());
+                output_rows += result->num_rows();
+            }
+        }
+    }
+    hash_table.close();
+    state.SetItemsProcessed(state.iterations() * kBenchChunkSize * kBenchNumChunks);
+    state.counters["output_rows"] = benchmark::Counter(output_rows, benchmark::Counter::kAvgIterations);
+}
+
+static void join_bench_args(benchmark::internal::Benchmark* bench) {
+    bench_args(bench, {1 << 10, 1 << 16, 1 << 20}, {0, 10});
+}
+
+static void join_key8_bench_args(benchmark::internal::Benchmark* bench) {
+    bench_args(bench, {100}, {0, 10});
+}
+
+// keyboolean and the other types of the same key widths are not listed.
+BENCHMARK_CAPTURE(BM_join_build, key8, std::vector<PrimitiveType>{TYPE_TINYINT})->Apply(join_key8_bench_args);
+BENCHMARK_CAPTURE(BM_join_build, key32, std::vector<PrimitiveType>{TYPE_INT})->Apply(join_bench_args);
+BENCHMARK_CAPTURE(BM_join_build, key64, std::vector<PrimitiveType>{TYPE_BIGINT})->Apply(join_bench_args);
+BENCHMARK_CAPTURE(BM_join_build, keystring, std::vector<PrimitiveType>{TYPE_VARCHAR})->Apply(join_bench_args);
+BENCHMARK_CAPTURE(BM_join_build, fixed64, std::vector<PrimitiveType>{TYPE_INT, TYPE_INT})->Apply(join_bench_args);
+BENCHMARK_CAPTURE(BM_join_build, fixed128, std::vector<PrimitiveType>{TYPE_BIGINT, TYPE_BIGINT})
+        ->Apply(join_bench_args);
+BENCHMARK_CAPTURE(BM_join_build, slice, std::vector<PrimitiveType>{TYPE_INT, TYPE_VARCHAR})->Apply(join_bench_args);
+
+BENCHMARK_CAPTURE(BM_join_probe, key8, std::vector<PrimitiveType>{TYPE_TINYINT})->Apply(join_key8_bench_args);
+BENCHMARK_CAPTURE(BM_join_probe, key32, std::vector<PrimitiveType>{TYPE_INT})->Apply(join_bench_args);
+BENCHMARK_CAPTURE(BM_join_probe, key64, std::vector<PrimitiveType>{TYPE_BIGINT})->Apply(join_bench_args);
+BENCHMARK_CAPTURE(BM_join_probe, keystring, std::vector<PrimitiveType>{TYPE_VARCHAR})->Apply(join_bench_args);
+BENCHMARK_CAPTURE(BM_join_probe, fixed64, std::vector<PrimitiveType>{TYPE_INT, TYPE_INT})->Apply(join_bench_args);
+BENCHMARK_CAPTURE(BM_join_probe, fixed128, std::vector<PrimitiveType>{TYPE_BIGINT, TYPE_BIGINT})
+        ->Apply(join_bench_args);
+BENCHMARK_CAPTURE(BM_join_probe, slice, std::vector<PrimitiveType>{TYPE_INT, TYPE_VARCHAR})->Apply(join_bench_args);
+
+// ============================== aggregation ==============================
+
+// range(0): the number of the distinct keys.
+// range(1): the percentage of the null keys, only the variants of nullable keys accept the null keys.
+template <typename HashMapWithKey>
+static void do_agg_hash_map_bench(benchmark::State& state, const std::vector<PrimitiveType>& key_types) {
+    const int64_t cardinality = state.range(0);
+    const int null_percent = state.range(1);
+    auto chunks = gen_chunks(key_types, 0, kBenchChunkSize * kBenchNumChunks, false, cardinality, null_percent);
+    Buffer<AggDataPtr> agg_states(kBenchChunkSize);
+
+    size_t num_groups = 0;
+    for (auto _ : state) {
+        HashMapWithKey hash_map_with_key(kBenchChunkSize);
+        if constexpr (std::is_same_v<HashMapWithKey, SerializedKeyFixedSize8AggHashMap<PhmapSeed1>> ||
+                      std::is_same_v<HashMapWithKey, SerializedKeyFixedSize16AggHashMap<PhmapSeed1>>) {
+            // The same as Aggregator::_init_agg_hash_variant: the fixed byte size is only set without the null keys.
+            hash_map_with_key.has_null_column = null_percent > 0;
+            hash_map_with_key.fixed_byte_size = null_percent > 0 ? 0 : key_types.size() * sizeof(int32_t);
+        }
+        MemPool pool;
+        auto allocate = [&]() { return pool.allocate(16); };
+        for (const auto& chunk : chunks) {
+            hash_map_with_key.compute_agg_states(chunk->num_rows(), chunk->columns(), &pool, allocate, &agg_states);
+        }
+        num_groups = hash_map_with_key.hash_map.size();
+    }
+    state.SetItemsProcessed(state.iterations() * kBenchChunkSize * kBenchNumChunks);
+    state.counters["groups"] = num_groups;
+}
+
+static void agg_not_null_args(benchmark::internal::Benchmark* bench) {
+    bench_args(bench, {1 << 4, 1 << 10, 1 << 16, 1 << 20}, {0});
+}
+
+static void agg_nullable_args(benchmark::internal::Benchmark* bench) {
+    bench_args(bench, {1 << 4, 1 << 10, 1 << 16, 1 << 20}, {0, 10, 50});
+}
+
+static void agg_null_only_args(benchmark::internal::Benchmark* bench) {
+    bench_args(bench, {1 << 4, 1 << 10, 1 << 16, 1 << 20}, {10});
+}
+
+#define AGG_HASH_MAP_BENCH(NAME, HASH_MAP, ...)                                          \
+    static void BM_agg_hash_map_##NAME(benchmark::State& state) {                         \
+        do_agg_hash_map_bench<HASH_MAP>(state, std::vector<PrimitiveType>{__VA_ARGS__}); \
+    }                                                                                    \
+    BENCHMARK(BM_agg_hash_map_##NAME)
+
+AGG_HASH_MAP_BENCH(int32, Int32AggHashMapWithOneNumberKey<PhmapSeed1>, TYPE_INT)->Apply(agg_not_null_args);
+AGG_HASH_MAP_BENCH(int64, Int64AggHashMapWithOneNumberKey<PhmapSeed1>, TYPE_BIGINT)->Apply(agg_not_null_args);
+AGG_HASH_MAP_BENCH(null_int32, NullInt32AggHashMapWithOneNumberKey<PhmapSeed1>, TYPE_INT)->Apply(agg_nullable_args);
+AGG_HASH_MAP_BENCH(null_int64, NullInt64AggHashMapWithOneNumberKey<PhmapSeed1>, TYPE_BIGINT)
+        ->Apply(agg_nullable_args);
+AGG_HASH_MAP_BENCH(two_level_int32, Int32TwoLevelAggHashMapWithOneNumberKey<PhmapSeed1>, TYPE_INT)
+        ->Apply(agg_not_null_args);
+AGG_HASH_MAP_BENCH(string, OneStringAggHashMap<PhmapSeed1>, TYPE_VARCHAR)->Apply(agg_not_null_args);
+AGG_HASH_MAP_BENCH(null_string, NullOneStringAggHashMap<PhmapSeed1>, TYPE_VARCHAR)->Apply(agg_nullable_args);
+AGG_HASH_MAP_BENCH(serialized, SerializedKeyAggHashMap<PhmapSeed1>, TYPE_INT, TYPE_VARCHAR)->Apply(agg_nullable_args);
+AGG_HASH_MAP_BENCH(two_level_serialized, SerializedKeyTwoLevelAggHashMap<PhmapSeed1>, TYPE_INT, TYPE_VARCHAR)
+        ->Apply(agg_nullable_args);
+AGG_HASH_MAP_BENCH(fixed_size8, SerializedKeyFixedSize8AggHashMap<PhmapSeed1>, TYPE_INT, TYPE_INT)
+        ->Apply(agg_not_null_args);
+// Two nullable int keys need 10 bytes.
+AGG_HASH_MAP_BENCH(fixed_size16, SerializedKeyFixedSize16AggHashMap<PhmapSeed1>, TYPE_INT, TYPE_INT)
+        ->Apply(agg_null_only_args);
+
+// ============================== runtime filter ==============================
+
+// range(0): the number of the build rows, each of them has a distinct key.
+// range(1): the percentage of the null keys.
+static void BM_runtime_filter_build(benchmark::State& state, PrimitiveType type) {
+    const int64_t cardinality = state.range(0);
+    const int null_percent = state.range(1);
+    auto chunks = gen_chunks({type}, 0, cardinality, true, cardinality, null_percent);
+
+    for (auto _ : state) {
+        ObjectPool pool;
+        JoinRuntimeFilter* filter = RuntimeFilterHelper::create_runtime_bloom_filter(&pool, type);
+        filter->init(cardinality);
+        for (const auto& chunk : chunks) {
+            CHECK(RuntimeFilterHelper::fill_runtime_bloom_filter(chunk->get_column_by_index(0), type, filter, 0, false)
+                          .ok());
+        }
+        benchmark::DoNotOptimize(filter);
+    }
+    state.SetItemsProcessed(state.iterations() * cardinality);
+}
+
+// Half of the probe keys pass the filter.
+static void BM_runtime_filter_probe(benchmark::State& state, PrimitiveType type) {
+    const int64_t cardinality = state.range(0);
+    const int null_percent = state.range(1);
+    auto build_chunks = gen_chunks({type}, 0, cardinality, true, cardinality, null_percent);
+    auto probe_chunks = gen_chunks({type}, 0, kBenchChunkSize * kBenchNumChunks, false, cardinality * 2, null_percent);
+
+    ObjectPool pool;
+    JoinRuntimeFilter* filter = RuntimeFilterHelper::create_runtime_bloom_filter(&pool, type);
+    filter->init(cardinality);
+    for (const auto& chunk : build_chunks) {
+        CHECK(RuntimeFilterHelper::fill_runtime_bloom_filter(chunk->get_column_by_index(0), type, filter, 0, false)
+                      .ok());
+    }
+
+    JoinRuntimeFilter::RunningContext ctx;
+    int64_t selected_rows = 0;
+    for (auto _ : state) {
+        for (const auto& chunk : probe_chunks) {
+            ctx.selection.assign(chunk->num_rows(), 1);
+            selected_rows += filter->evaluate(chunk->get_column_by_index(0).get(), &ctx);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kBenchChunkSize * kBenchNumChunks);
+    state.counters["selected_rows"] = benchmark::Counter(selected_rows, benchmark::Counter::kAvgIterations);
+}
+
+static void runtime_filter_bench_args(benchmark::internal::Benchmark* bench) {
+    bench_args(bench, {1 << 10, 1 << 16, 1 << 20}, {0, 10});
+}
+
+BENCHMARK_CAPTURE(BM_runtime_filter_build, int32, TYPE_INT)->Apply(runtime_filter_bench_args);
+BENCHMARK_CAPTURE(BM_runtime_filter_build, int64, TYPE_BIGINT)->Apply(runtime_filter_bench_args);
+BENCHMARK_CAPTURE(BM_runtime_filter_build, string, TYPE_VARCHAR)->Apply(runtime_filter_bench_args);
+BENCHMARK_CAPTURE(BM_runtime_filter_probe, int32, TYPE_INT)->Apply(runtime_filter_bench_args);
+BENCHMARK_CAPTURE(BM_runtime_filter_probe, int64, TYPE_BIGINT)->Apply(runtime_filter_bench_args);
+BENCHMARK_CAPTURE(BM_runtime_filter_probe, string, TYPE_VARCHAR)->Apply(runtime_filter_bench_args);
+
+// ============================== exchange serialization ==============================
+
+static const std::vector<PrimitiveType> kSerdeTypes{TYPE_INT, TYPE_BIGINT, TYPE_VARCHAR};
+
+static serde::ProtobufChunkMeta serde_chunk_meta(bool nullable) {
+    serde::ProtobufChunkMeta meta;
+    for (size_t i = 0; i < kSerdeTypes.size(); i++) {
+        meta.types.emplace_back(bench_type_desc(kSerdeTypes[i]));
+        meta.is_nulls.emplace_back(nullable);
+        meta.is_consts.emplace_back(false);
+        meta.slot_id_to_index[i] = i;
+    }
+    return meta;
+}
+
+// Serializes the chunks and compresses them, like ExchangeSinkOperator::serialize_chunk.
+// range(0): the cardinality of the values, the lower cardinality the more compressible.
+// range(1): the percentage of the nulls.
+static void BM_chunk_serialize(benchmark::State& state, CompressionTypePB compress_type) {
+    const int64_t cardinality = state.range(0);
+    const int null_percent = state.range(1);
+    auto chunks = gen_chunks(kSerdeTypes, 0, kBenchChunkSize * kBenchNumChunks, false, cardinality, null_percent);
+    const BlockCompressionCodec* codec = nullptr;
+    CHECK(get_block_compression_codec(compress_type, &codec).ok());
+
+    std::string compressed;
+    int64_t uncompressed_bytes = 0;
+    int64_t compressed_bytes = 0;
+    for (auto _ : state) {
+        for (const auto& chunk : chunks) {
+            auto res = serde::ProtobufChunkSerde::serialize_without_meta(*chunk);
+            CHECK(res.ok());
+            const std::string& data = res->data();
+            uncompressed_bytes += data.size();
+            if (codec == nullptr) {
+                compressed_bytes += data.size();
+                continue;
+            }
+            compressed.resize(codec->max_compressed_len(data.size()));
+            Slice output(compressed.data(), compressed.size());
+            CHECK(codec->compress(Slice(data), &output).ok());
+            compressed_bytes += output.size;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kBenchChunkSize * kBenchNumChunks);
+    state.SetBytesProcessed(uncompressed_bytes);
+    state.counters["ratio"] = compressed_bytes == 0 ? 0 : static_cast<double>(uncompressed_bytes) / compressed_bytes;
+}
+
+// Decompresses the chunks and deserializes them, like DataStreamRecvr.
+static void BM_chunk_deserialize(benchmark::State& state, CompressionTypePB compress_type) {
+    const int64_t cardinality = state.range(0);
+    const int null_percent = state.range(1);
+    auto chunks = gen_chunks(kSerdeTypes, 0, kBenchChunkSize * kBenchNumChunks, false, cardinality, null_percent);
+    const BlockCompressionCodec* codec = nullptr;
+    CHECK(get_block_compression_codec(compress_type, &codec).ok());
+
+    // pairs of the compressed data and the uncompressed size.
+    std::vector<std::pair<std::string, size_t>> serialized_chunks;
+    for (const auto& chunk : chunks) {
+        auto res = serde::ProtobufChunkSerde::serialize_without_meta(*chunk);
+        CHECK(res.ok());
+        std::string data = res->data();
+        size_t uncompressed_size = data.size();
+        if (codec != nullptr) {
+            std::string compressed(codec->max_compressed_len(data.size()), 0);
+            Slice output(compressed.data(), compressed.size());
+            CHECK(codec->compress(Slice(data), &output).ok());
+            compressed.resize(output.size);
+            data = std::move(compressed);
+        }
+        serialized_chunks.emplace_back(std::move(data), uncompressed_size);
+    }
+
+    auto meta = serde_chunk_meta(null_percent > 0);
+    serde::ProtobufChunkDeserializer deserializer(meta);
+    std::string uncompressed;
+    int64_t uncompressed_bytes = 0;
+    for (auto _ : state) {
+        for (const auto& [data, uncompressed_size] : serialized_chunks) {
+            std::string_view buff = data;
+            if (codec != nullptr) {
+                uncompressed.resize(uncompressed_size);
+                Slice output(uncompressed.data(), uncompressed.size());
+                CHECK(codec->decompress(Slice(data), &output).ok());
+                buff = std::string_view(output.data, output.size);
+            }
+            auto chunk = deserializer.deserialize(buff);
+            CHECK(chunk.ok());
+            benchmark::DoNotOptimize(chunk->num_rows());
+            uncompressed_bytes += uncompressed_size;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kBenchChunkSize * kBenchNumChunks);
+    state.SetBytesProcessed(uncompressed_bytes);
+}
+
+static void serde_bench_args(benchmark::internal::Benchmark* bench) {
+    bench_args(bench, {1 << 4, 1 << 16, 1 << 30}, {0, 10});
+}
+
+BENCHMARK_CAPTURE(BM_chunk_serialize, no_compression, CompressionTypePB::NO_COMPRESSION)->Apply(serde_bench_args);
+BENCHMARK_CAPTURE(BM_chunk_serialize, lz4, CompressionTypePB::LZ4)->Apply(serde_bench_args);
+BENCHMARK_CAPTURE(BM_chunk_serialize, lz4_frame, CompressionTypePB::LZ4_FRAME)->Apply(serde_bench_args);
+BENCHMARK_CAPTURE(BM_chunk_serialize, snappy, CompressionTypePB::SNAPPY)->Apply(serde_bench_args);
+BENCHMARK_CAPTURE(BM_chunk_serialize, zstd, CompressionTypePB::ZSTD)->Apply(serde_bench_args);
+BENCHMARK_CAPTURE(BM_chunk_deserialize, no_compression, CompressionTypePB::NO_COMPRESSION)->Apply(serde_bench_args);
+BENCHMARK_CAPTURE(BM_chunk_deserialize, lz4, CompressionTypePB::LZ4)->Apply(serde_bench_args);
+BENCHMARK_CAPTURE(BM_chunk_deserialize, lz4_frame, CompressionTypePB::LZ4_FRAME)->Apply(serde_bench_args);
+BENCHMARK_CAPTURE(BM_chunk_deserialize, snappy, CompressionTypePB::SNAPPY)->Apply(serde_bench_args);
+BENCHMARK_CAPTURE(BM_chunk_deserialize, zstd, CompressionTypePB::ZSTD)->Apply(serde_bench_args);
+
+} // namespace starrocks::vectorized
+
+BENCHMARK_MAIN();
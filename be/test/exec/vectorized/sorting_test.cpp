@@ -175,6 +175,84 @@ TEST(SortingTest, append_by_permutation_int) {
     ASSERT_EQ(2048, merged->get(1).get_int32());
 }
 
+TEST(SortingTest, build_tie_for_column) {
+    Int32Column::Ptr ints = Int32Column::create();
+    BinaryColumn::Ptr strs = BinaryColumn::create();
+    for (int32_t v : {1, 1, 1, 2, 2, 3}) {
+        ints->append(v);
+    }
+    for (const char* v : {"a", "a", "b", "b", "b", "b"}) {
+        strs->append_string(v);
+    }
+
+    Tie tie(6, 1);
+    build_tie_for_column(ints, &tie);
+    ASSERT_EQ(Tie({1, 1, 1, 0, 1, 0}), tie);
+    build_tie_for_column(strs, &tie);
+    ASSERT_EQ(Tie({1, 1, 0, 0, 1, 0}), tie);
+    // A constant column is a single run.
+    build_tie_for_column(ConstColumn::create(ints, 6), &tie);
+    ASSERT_EQ(Tie({1, 1, 0, 0, 1, 0}), tie);
+}
+
+TEST(SortingTest, radix_sort_columns) {
+    std::mt19937 rand(0);
+    const size_t num_rows = kRadixSortMinRows * 2;
+    auto nullable_int = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto big_int = Int64Column::create();
+    auto tiny_int = Int8Column::create();
+    auto large_int = Int128Column::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        if (rand() % 10 == 0) {
+            nullable_int->append_nulls(1);
+        } else {
+            nullable_int->append_datum(Datum(int32_t(rand() % 20) - 10));
+        }
+        big_int->append(int64_t(rand()) - int64_t(rand()) * 1024);
+        tiny_int->append(int8_t(rand() % 256 - 128));
+        large_int->append(int128_t(int64_t(rand()) - (1L << 30)) * (int128_t(1) << 70));
+    }
+
+    for (const Columns& columns : std::vector<Columns>{{nullable_int, big_int}, {tiny_int, nullable_int, large_int}}) {
+        size_t bits = 0;
+        ASSERT_TRUE(radix_sort_supported(columns, &bits));
+        for (int order : {1, -1}) {
+            for (int null_first : {1, -1}) {
+                std::vector<int> sort_orders(columns.size(), order);
+                std::vector<int> null_firsts(columns.size(), null_first);
+                sort_orders.back() = -order;
+
+                Permutation perm;
+                ASSERT_TRUE(radix_sort_columns(false, columns, sort_orders, null_firsts, bits, &perm).ok());
+                ASSERT_EQ(num_rows, perm.size());
+                auto cmp = [&](const PermutationItem& lhs, const PermutationItem& rhs) {
+                    for (size_t col = 0; col < columns.size(); col++) {
+                        int x = columns[col]->compare_at(lhs.index_in_chunk, rhs.index_in_chunk, *columns[col],
+                                                         null_firsts[col]);
+                        if (x != 0) {
+                            return x * sort_orders[col] < 0;
+                        }
+                    }
+                    return false;
+                };
+                ASSERT_TRUE(std::is_sorted(perm.begin(), perm.end(), cmp));
+                std::vector<uint32_t> indexes;
+                for (auto& item : perm) {
+                    indexes.push_back(item.index_in_chunk);
+                }
+                std::sort(indexes.begin(), indexes.end());
+                for (uint32_t i = 0; i < num_rows; i++) {
+                    ASSERT_EQ(i, indexes[i]);
+                }
+            }
+        }
+    }
+
+    size_t bits = 0;
+    ASSERT_FALSE(radix_sort_supported({BinaryColumn::create()}, &bits));
+    ASSERT_FALSE(radix_sort_supported({DoubleColumn::create()}, &bits));
+}
+
 static void clear_sort_exprs(std::vector<ExprContext*>& exprs) {
     for (ExprContext* ctx : exprs) {
         delete ctx;
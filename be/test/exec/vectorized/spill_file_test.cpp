@@ -0,0 +1,179 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exec/vectorized/spill/spill_file.h"
+
+#include <gtest/gtest.h>
+
+#include "column/binary_column.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/config.h"
+#include "storage/olap_define.h"
+#include "util/file_utils.h"
+
+namespace starrocks::vectorized {
+
+class SpillFileTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _tmp_dir = config::storage_root_path + TMP_PREFIX;
+        FileUtils::create_dir(_tmp_dir);
+    }
+
+    void TearDown() override {
+        if (!_tmp_dir.empty()) {
+            FileUtils::remove(_tmp_dir);
+        }
+    }
+
+    static ChunkPtr create_chunk(int32_t start, int32_t num_rows) {
+        auto c0 = Int32Column::create();
+        auto c1 = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+        for (int32_t i = start; i < start + num_rows; i++) {
+            c0->append(i);
+            if (i % 3 == 0) {
+                (void)c1->append_nulls(1);
+            } else {
+                std::string s = "str_" + std::to_string(i);
+                c1->append_datum(Datum(Slice(s)));
+            }
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(c0), 1);
+        chunk->append_column(std::move(c1), 2);
+        return chunk;
+    }
+
+    std::string _tmp_dir;
+};
+
+// NOLINTNEXTLINE
+TEST_F(SpillFileTest, write_and_read) {
+    auto res = SpillFile::create(_tmp_dir, "test");
+    ASSERT_TRUE(res.ok()) << res.status().to_string();
+    auto file = std::move(res.value());
+
+    ASSERT_TRUE(file->append(*create_chunk(0, 100)).ok());
+    ASSERT_TRUE(file->append(*create_chunk(100, 50)).ok());
+    ASSERT_EQ(2, file->num_chunks());
+    ASSERT_EQ(150, file->num_rows());
+    ASSERT_TRUE(file->flip_to_read().ok());
+
+    auto prototype = create_chunk(0, 0);
+    int32_t next = 0;
+    while (true) {
+        auto chunk_or = file->read(*prototype);
+        if (chunk_or.status().is_end_of_file()) {
+            break;
+        }
+        ASSERT_TRUE(chunk_or.ok());
+        auto& chunk = chunk_or.value();
+        ASSERT_EQ(2, chunk->num_columns());
+        for (size_t i = 0; i < chunk->num_rows(); i++, next++) {
+            ASSERT_EQ(next, chunk->get_column_by_slot_id(1)->get(i).get_int32());
+            const auto& c1 = chunk->get_column_by_slot_id(2);
+            if (next % 3 == 0) {
+                ASSERT_TRUE(c1->is_null(i));
+            } else {
+                ASSERT_EQ("str_" + std::to_string(next), c1->get(i).get_slice().to_string());
+            }
+        }
+    }
+    ASSERT_EQ(150, next);
+}
+
+// NOLINTNEXTLINE
+TEST_F(SpillFileTest, raw_bytes) {
+    auto res = SpillFile::create(_tmp_dir, "test");
+    ASSERT_TRUE(res.ok()) << res.status().to_string();
+    auto file = std::move(res.value());
+
+    std::string data;
+    std::string block_0(100, 'a');
+    auto offset_0 = file->append_raw(block_0.data(), block_0.size());
+    ASSERT_TRUE(offset_0.ok());
+    ASSERT_EQ(0, offset_0.value());
+    // Read before all the bytes are appended.
+    ASSERT_TRUE(file->read_raw(offset_0.value(), block_0.size(), &data).ok());
+    ASSERT_EQ(block_0, data);
+
+    std::string block_1 = "exchange";
+    auto offset_1 = file->append_raw(block_1.data(), block_1.size());
+    ASSERT_TRUE(offset_1.ok());
+    ASSERT_EQ(100, offset_1.value());
+    ASSERT_TRUE(file->read_raw(offset_1.value(), block_1.size(), &data).ok());
+    ASSERT_EQ(block_1, data);
+    ASSERT_TRUE(file->read_raw(offset_0.value(), block_0.size(), &data).ok());
+    ASSERT_EQ(block_0, data);
+    ASSERT_EQ(108, file->num_bytes());
+}
+
+// NOLINTNEXTLINE
+TEST_F(SpillFileTest, read_at) {
+    auto res = SpillFile::create(_tmp_dir, "test");
+    ASSERT_TRUE(res.ok()) << res.status().to_string();
+    auto file = std::move(res.value());
+    auto prototype = create_chunk(0, 0);
+
+    int64_t offset_0 = file->num_bytes();
+    ASSERT_TRUE(file->append(*create_chunk(0, 100)).ok());
+    // Read while appending.
+    auto chunk_or = file->read_at(offset_0, *prototype);
+    ASSERT_TRUE(chunk_or.ok()) << chunk_or.status().to_string();
+    ASSERT_EQ(100, chunk_or.value()->num_rows());
+
+    int64_t offset_1 = file->num_bytes();
+    ASSERT_TRUE(file->append(*create_chunk(100, 50)).ok());
+    for (int64_t offset : {offset_1, offset_0, offset_1}) {
+        chunk_or = file->read_at(offset, *prototype);
+        ASSERT_TRUE(chunk_or.ok()) << chunk_or.status().to_string();
+        const auto& chunk = chunk_or.value();
+        int32_t start = offset == offset_0 ? 0 : 100;
+        ASSERT_EQ(offset == offset_0 ? 100 : 50, chunk->num_rows());
+        for (size_t i = 0; i < chunk->num_rows(); i++) {
+            ASSERT_EQ(static_cast<int32_t>(start + i), chunk->get_column_by_slot_id(1)->get(i).get_int32());
+            ASSERT_EQ((start + i) % 3 == 0, chunk->get_column_by_slot_id(2)->is_null(i));
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+TEST_F(SpillFileTest, partitioned) {
+    const size_t num_partitions = 4;
+    PartitionedSpillFiles files("test", num_partitions, 16);
+    for (int32_t i = 0; i < 10; i++) {
+        auto chunk = create_chunk(i * 100, 100);
+        ASSERT_TRUE(files.append(chunk, {chunk->get_column_by_slot_id(1)}).ok());
+    }
+    ASSERT_TRUE(files.finish().ok());
+    ASSERT_EQ(1000, files.num_rows());
+
+    auto prototype = create_chunk(0, 0);
+    std::vector<uint32_t> partitions;
+    size_t total_rows = 0;
+    for (size_t p = 0; p < num_partitions; p++) {
+        SpillFile* file = files.partition(p);
+        if (file == nullptr) {
+            continue;
+        }
+        while (true) {
+            auto chunk_or = file->read(*prototype);
+            if (chunk_or.status().is_end_of_file()) {
+                break;
+            }
+            ASSERT_TRUE(chunk_or.ok());
+            auto& chunk = chunk_or.value();
+            // every row must be in the partition computed by its key
+            PartitionedSpillFiles::compute_partitions({chunk->get_column_by_slot_id(1)}, chunk->num_rows(),
+                                                      num_partitions, &partitions);
+            for (auto partition : partitions) {
+                ASSERT_EQ(p, partition);
+            }
+            total_rows += chunk->num_rows();
+        }
+        files.release_partition(p);
+    }
+    ASSERT_EQ(1000, total_rows);
+}
+
+} // namespace starrocks::vectorized
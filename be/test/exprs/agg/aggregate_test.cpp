@@ -354,6 +354,40 @@ TEST_F(AggregateTest, test_decimal_sum) {
     }
 }
 
+TEST_F(AggregateTest, test_decimal64_sum_wide_values) {
+    const auto* func = get_aggregate_function("decimal_sum", TYPE_DECIMAL64, TYPE_DECIMAL128, false,
+                                              TFunctionBinaryType::BUILTIN, 3);
+    auto* ctx = FunctionContext::create_test_context(
+            {FunctionContext::TypeDesc{.type = TYPE_DECIMAL64, .precision = 18, .scale = 0}},
+            FunctionContext::TypeDesc{.type = TYPE_DECIMAL128, .precision = 38, .scale = 0});
+    std::unique_ptr<FunctionContext> gc_ctx(ctx);
+
+    // The sum exceeds the range of int64, and the values have both signs.
+    auto column = Decimal64Column::create(18, 0);
+    int128_t expected = 0;
+    for (int i = 0; i < 4096; i++) {
+        int64_t v = (i % 3 == 0) ? -(INT64_MAX - i) : (INT64_MAX - 7 * i);
+        column->append(v);
+        expected += v;
+    }
+    const Column* row_column = column.get();
+
+    auto state = ManagedAggrState::create(ctx, func);
+    func->update_batch_single_state(ctx, row_column->size(), &row_column, state->state());
+    auto result_column = Decimal128Column::create(38, 0);
+    func->finalize_to_column(ctx, state->state(), result_column.get());
+    ASSERT_EQ(expected, result_column->get_data()[0]);
+
+    auto frame_state = ManagedAggrState::create(ctx, func);
+    func->update_batch_single_state(ctx, frame_state->state(), &row_column, 0, 4096, 100, 4000);
+    expected = 0;
+    for (int i = 100; i < 4000; i++) {
+        expected += column->get_data()[i];
+    }
+    func->finalize_to_column(ctx, frame_state->state(), result_column.get());
+    ASSERT_EQ(expected, result_column->get_data()[1]);
+}
+
 TEST_F(AggregateTest, test_avg) {
     const AggregateFunction* func = get_aggregate_function("avg", TYPE_SMALLINT, TYPE_DOUBLE, false);
     test_agg_function<int16_t, double>(ctx, func, 524076 / 1026.0, 2499500 / 1000.0, 3023576 / 2026.0);
@@ -908,6 +942,38 @@ TEST_F(AggregateTest, test_sum_nullable) {
     ASSERT_EQ(4950, result_data.get_data()[0]);
 }
 
+TEST_F(AggregateTest, test_nullable_update_batch) {
+    using NullableSumInt64 = NullableAggregateFunctionState<SumAggregateState<int64_t>>;
+    const AggregateFunction* sum_null = get_aggregate_function("sum", TYPE_INT, TYPE_BIGINT, true);
+    // Two groups, the states of the rows are interleaved.
+    auto state0 = ManagedAggrState::create(ctx, sum_null);
+    auto state1 = ManagedAggrState::create(ctx, sum_null);
+    auto state2 = ManagedAggrState::create(ctx, sum_null);
+    std::vector<AggDataPtr> states;
+    auto data_column = Int32Column::create();
+    for (int i = 0; i < 100; i++) {
+        data_column->append(i);
+        states.push_back(i % 2 ? state1->state() : state0->state());
+    }
+
+    // A non-nullable column.
+    const Column* row_column = data_column.get();
+    sum_null->update_batch(ctx, data_column->size(), 0, &row_column, states.data());
+    // A nullable column without null.
+    auto column = NullableColumn::create(data_column->clone_shared(), NullColumn::create(data_column->size(), 0));
+    row_column = column.get();
+    sum_null->update_batch(ctx, column->size(), 0, &row_column, states.data());
+
+    auto* null_state0 = (NullableSumInt64*)state0->state();
+    auto* null_state1 = (NullableSumInt64*)state1->state();
+    auto* null_state2 = (NullableSumInt64*)state2->state();
+    ASSERT_FALSE(null_state0->is_null);
+    ASSERT_FALSE(null_state1->is_null);
+    ASSERT_TRUE(null_state2->is_null);
+    ASSERT_EQ(2 * 2450, *reinterpret_cast<const int64_t*>(null_state0->nested_state()));
+    ASSERT_EQ(2 * 2500, *reinterpret_cast<const int64_t*>(null_state1->nested_state()));
+}
+
 TEST_F(AggregateTest, test_count_nullable) {
     const AggregateFunction* func = get_aggregate_function("count", TYPE_BIGINT, TYPE_BIGINT, true);
     auto state = ManagedAggrState::create(ctx, func);
@@ -929,6 +995,53 @@ TEST_F(AggregateTest, test_count_nullable) {
     ASSERT_EQ(512, result);
 }
 
+TEST_F(AggregateTest, test_window_retract) {
+    using NullableSumInt64 = NullableAggregateFunctionState<SumAggregateState<int64_t>>;
+    const AggregateFunction* sum_null = get_aggregate_function("sum", TYPE_INT, TYPE_BIGINT, true);
+    const AggregateFunction* count_null = get_aggregate_function("count", TYPE_BIGINT, TYPE_BIGINT, true);
+    ASSERT_TRUE(sum_null->support_incremental_window_update());
+    ASSERT_TRUE(sum_null->support_retract());
+    ASSERT_TRUE(count_null->support_retract());
+    ASSERT_FALSE(get_aggregate_function("sum", TYPE_DOUBLE, TYPE_DOUBLE, true)->support_retract());
+    ASSERT_FALSE(get_aggregate_function("max", TYPE_INT, TYPE_INT, true)->support_retract());
+
+    auto data_column = Int32Column::create();
+    auto null_column = NullColumn::create();
+    for (int i = 0; i < 100; i++) {
+        data_column->append(i);
+        null_column->append(i % 3 == 0 ? 1 : 0);
+    }
+    auto column = NullableColumn::create(std::move(data_column), std::move(null_column));
+    const Column* row_column = column.get();
+
+    // The frame of 5 rows slides by retracting the first row and adding the next one.
+    auto sum_state = ManagedAggrState::create(ctx, sum_null);
+    auto count_state = ManagedAggrState::create(ctx, count_null);
+    const int64_t frame_size = 5;
+    sum_null->update_batch_single_state(ctx, sum_state->state(), &row_column, 0, 100, 0, frame_size);
+    count_null->update_batch_single_state(ctx, count_state->state(), &row_column, 0, 100, 0, frame_size);
+    for (int64_t start = 1; start + frame_size <= 100; start++) {
+        sum_null->retract_batch_single_state(ctx, sum_state->state(), &row_column, start - 1, start);
+        sum_null->update_batch_single_state(ctx, sum_state->state(), &row_column, 0, 100, start + frame_size - 1,
+                                            start + frame_size);
+        count_null->retract_batch_single_state(ctx, count_state->state(), &row_column, start - 1, start);
+        count_null->update_batch_single_state(ctx, count_state->state(), &row_column, 0, 100,
+                                              start + frame_size - 1, start + frame_size);
+
+        int64_t expected_sum = 0;
+        int64_t expected_count = 0;
+        for (int64_t i = start; i < start + frame_size; i++) {
+            if (i % 3 != 0) {
+                expected_sum += i;
+                expected_count++;
+            }
+        }
+        auto* null_state = (NullableSumInt64*)sum_state->state();
+        ASSERT_EQ(expected_sum, *reinterpret_cast<const int64_t*>(null_state->nested_state()));
+        ASSERT_EQ(expected_count, *reinterpret_cast<int64_t*>(count_state->state()));
+    }
+}
+
 TEST_F(AggregateTest, test_bitmap_nullable) {
     const AggregateFunction* bitmap_null = get_aggregate_function("bitmap_union_int", TYPE_INT, TYPE_BIGINT, true);
     auto state = ManagedAggrState::create(ctx, bitmap_null);
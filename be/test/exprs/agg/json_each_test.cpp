@@ -78,4 +78,10 @@ TEST_F(JsonEachTest, json_each_array) {
     // clang-format on
     test_impl(input, expect);
 }
+
+TEST_F(JsonEachTest, json_each_scalar) {
+    // A scalar generates no result, but still has an offset.
+    test_impl("1", {});
+    test_impl(R"("str")", {});
+}
 } // namespace starrocks::vectorized
\ No newline at end of file
@@ -672,6 +672,39 @@ TEST_F(ArrayFunctionsTest, array_contains_nullable_array) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(ArrayFunctionsTest, array_contains_const_target) {
+    // array_contains([1, 2, 3], 3)
+    // array_contains([], 3)
+    // array_contains([NULL, 3, 3], 3)
+    // array_contains([NULL, 4], 3)
+    // array_contains(NULL, 3)
+    auto array = ColumnHelper::create_column(TYPE_ARRAY_INT, true);
+    array->append_datum(DatumArray{1, 2, 3});
+    array->append_datum(DatumArray{});
+    array->append_datum(DatumArray{Datum(), 3, 3});
+    array->append_datum(DatumArray{Datum(), 4});
+    array->append_datum(Datum());
+
+    auto target = ColumnHelper::create_const_column<TYPE_INT>(3, 5);
+
+    auto result = ArrayFunctions::array_contains(nullptr, {array, target});
+    ASSERT_EQ(5, result->size());
+    EXPECT_EQ(1, result->get(0).get_int8());
+    EXPECT_EQ(0, result->get(1).get_int8());
+    EXPECT_EQ(1, result->get(2).get_int8());
+    EXPECT_EQ(0, result->get(3).get_int8());
+    EXPECT_TRUE(result->get(4).is_null());
+
+    result = ArrayFunctions::array_position(nullptr, {array, target});
+    ASSERT_EQ(5, result->size());
+    EXPECT_EQ(3, result->get(0).get_int32());
+    EXPECT_EQ(0, result->get(1).get_int32());
+    EXPECT_EQ(2, result->get(2).get_int32());
+    EXPECT_EQ(0, result->get(3).get_int32());
+    EXPECT_TRUE(result->get(4).is_null());
+}
+
 // NOLINTNEXTLINE
 TEST_F(ArrayFunctionsTest, array_position_empty_array) {
     // array_position([], 1) : 0
@@ -0,0 +1,134 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exprs/vectorized/common_sub_expr.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::vectorized {
+
+class CommonSubExprTest : public ::testing::Test {
+protected:
+    static TExprNode slot_ref(SlotId slot_id) {
+        TSlotRef ref;
+        ref.__set_slot_id(slot_id);
+        ref.__set_tuple_id(0);
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::SLOT_REF);
+        node.__set_num_children(0);
+        node.__set_slot_ref(ref);
+        return node;
+    }
+
+    static TExprNode function(const std::string& name, int num_children) {
+        TFunction fn;
+        fn.name.__set_function_name(name);
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+        node.__set_num_children(num_children);
+        node.__set_fn(fn);
+        return node;
+    }
+
+    static TExprNode string_literal(const std::string& value) {
+        TStringLiteral literal;
+        literal.__set_value(value);
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::STRING_LITERAL);
+        node.__set_num_children(0);
+        node.__set_string_literal(literal);
+        return node;
+    }
+
+    static TExpr make_expr(std::vector<TExprNode> nodes) {
+        TExpr expr;
+        expr.__set_nodes(std::move(nodes));
+        return expr;
+    }
+
+    static SlotId ref_slot(const TExprNode& node) {
+        EXPECT_EQ(TExprNodeType::SLOT_REF, node.node_type);
+        return node.slot_ref.slot_id;
+    }
+};
+
+// NOLINTNEXTLINE
+TEST_F(CommonSubExprTest, test_extract) {
+    // concat(upper(s1), 'x'), length(upper(s1))
+    std::vector<TExpr> exprs;
+    exprs.push_back(make_expr({function("concat", 2), function("upper", 1), slot_ref(1), string_literal("x")}));
+    exprs.push_back(make_expr({function("length", 1), function("upper", 1), slot_ref(1)}));
+    std::vector<std::pair<SlotId, TExpr>> common_exprs;
+
+    ASSERT_EQ(1, extract_common_sub_exprs(&exprs, &common_exprs, 100, 0));
+    ASSERT_EQ(1, common_exprs.size());
+    ASSERT_EQ(100, common_exprs[0].first);
+    ASSERT_EQ(2, common_exprs[0].second.nodes.size());
+    ASSERT_EQ("upper", common_exprs[0].second.nodes[0].fn.name.function_name);
+    ASSERT_EQ(1, ref_slot(common_exprs[0].second.nodes[1]));
+
+    ASSERT_EQ(3, exprs[0].nodes.size());
+    ASSERT_EQ(100, ref_slot(exprs[0].nodes[1]));
+    ASSERT_EQ(TExprNodeType::STRING_LITERAL, exprs[0].nodes[2].node_type);
+    ASSERT_EQ(2, exprs[1].nodes.size());
+    ASSERT_EQ(100, ref_slot(exprs[1].nodes[1]));
+}
+
+// NOLINTNEXTLINE
+TEST_F(CommonSubExprTest, test_extract_nested) {
+    // a(f(g(s1))), b(f(g(s1))), c(g(s1))
+    std::vector<TExpr> exprs;
+    exprs.push_back(make_expr({function("a", 1), function("f", 1), function("g", 1), slot_ref(1)}));
+    exprs.push_back(make_expr({function("b", 1), function("f", 1), function("g", 1), slot_ref(1)}));
+    exprs.push_back(make_expr({function("c", 1), function("g", 1), slot_ref(1)}));
+    std::vector<std::pair<SlotId, TExpr>> common_exprs;
+
+    // f(g(s1)) is extracted first, then g(s1) in it, which is evaluated ahead.
+    ASSERT_EQ(2, extract_common_sub_exprs(&exprs, &common_exprs, 100, 0));
+    ASSERT_EQ(2, common_exprs.size());
+    ASSERT_EQ(101, common_exprs[0].first);
+    ASSERT_EQ("g", common_exprs[0].second.nodes[0].fn.name.function_name);
+    ASSERT_EQ(100, common_exprs[1].first);
+    ASSERT_EQ(2, common_exprs[1].second.nodes.size());
+    ASSERT_EQ("f", common_exprs[1].second.nodes[0].fn.name.function_name);
+    ASSERT_EQ(101, ref_slot(common_exprs[1].second.nodes[1]));
+
+    ASSERT_EQ(100, ref_slot(exprs[0].nodes[1]));
+    ASSERT_EQ(100, ref_slot(exprs[1].nodes[1]));
+    ASSERT_EQ(101, ref_slot(exprs[2].nodes[1]));
+}
+
+// NOLINTNEXTLINE
+TEST_F(CommonSubExprTest, test_reuse_common_expr) {
+    // The planner extracted upper(s1) into slot 50, but missed the one in length(upper(s1)).
+    std::vector<TExpr> exprs;
+    exprs.push_back(make_expr({function("length", 1), function("upper", 1), slot_ref(1)}));
+    std::vector<std::pair<SlotId, TExpr>> common_exprs;
+    common_exprs.emplace_back(50, make_expr({function("upper", 1), slot_ref(1)}));
+
+    ASSERT_EQ(0, extract_common_sub_exprs(&exprs, &common_exprs, 100, 0));
+    ASSERT_EQ(1, common_exprs.size());
+    ASSERT_EQ(2, exprs[0].nodes.size());
+    ASSERT_EQ(50, ref_slot(exprs[0].nodes[1]));
+}
+
+// NOLINTNEXTLINE
+TEST_F(CommonSubExprTest, test_not_extract) {
+    std::vector<TExpr> exprs;
+    // The roots of the output expressions are not replaced.
+    exprs.push_back(make_expr({function("upper", 1), slot_ref(1)}));
+    exprs.push_back(make_expr({function("upper", 1), slot_ref(1)}));
+    // The nondeterministic functions are evaluated at each occurrence.
+    exprs.push_back(make_expr({function("a", 1), function("rand", 1), slot_ref(2)}));
+    exprs.push_back(make_expr({function("b", 1), function("rand", 1), slot_ref(2)}));
+    // The constant ones are cheap.
+    exprs.push_back(make_expr({function("a", 1), function("upper", 1), string_literal("x")}));
+    exprs.push_back(make_expr({function("b", 1), function("upper", 1), string_literal("x")}));
+    std::vector<TExpr> origin_exprs = exprs;
+    std::vector<std::pair<SlotId, TExpr>> common_exprs;
+
+    ASSERT_EQ(0, extract_common_sub_exprs(&exprs, &common_exprs, 100, 0));
+    ASSERT_TRUE(common_exprs.empty());
+    ASSERT_EQ(origin_exprs, exprs);
+}
+
+} // namespace starrocks::vectorized
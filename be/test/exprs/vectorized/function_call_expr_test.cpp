@@ -7,9 +7,13 @@
 #include <math.h>
 
 #include "butil/time.h"
+#include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "common/config.h"
 #include "exprs/vectorized/cast_expr.h"
+#include "exprs/vectorized/column_ref.h"
+#include "exprs/vectorized/literal.h"
 #include "exprs/vectorized/mock_vectorized_expr.h"
 
 namespace starrocks {
@@ -265,5 +269,71 @@ TEST_F(VectorizedFunctionCallExprTest, prepareFaileCase) {
     exprContext.close(nullptr);
 }
 
+TEST_F(VectorizedFunctionCallExprTest, stringFunctionDictEvaluationTest) {
+    // upper(s) and concat_ws('-', s) of a low-cardinality column and a high-cardinality one.
+    auto make_function = [&](const std::string& name, int64_t fid) {
+        TFunction function;
+        TFunctionName function_name;
+        function_name.__set_db_name("db");
+        function_name.__set_function_name(name);
+        function.__set_name(function_name);
+        function.__set_binary_type(TFunctionBinaryType::BUILTIN);
+        function.__set_has_var_args(false);
+        function.__set_fid(fid);
+        TExprNode node = expr_node;
+        node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+        node.__set_type(gen_type_desc(TPrimitiveType::VARCHAR));
+        node.__set_fn(function);
+        return node;
+    };
+    TExprNode separator_node;
+    separator_node.__set_node_type(TExprNodeType::STRING_LITERAL);
+    separator_node.__set_num_children(0);
+    separator_node.__set_type(gen_type_desc(TPrimitiveType::VARCHAR));
+    TStringLiteral separator;
+    separator.__set_value("-");
+    separator_node.__set_string_literal(separator);
+
+    for (int cardinality : {7, 1000}) {
+        auto values = BinaryColumn::create();
+        auto nulls = NullColumn::create();
+        for (int i = 0; i < 1000; ++i) {
+            values->append("value_" + std::to_string(i % cardinality));
+            nulls->append(i % 11 == 0);
+        }
+        Chunk chunk;
+        chunk.append_column(NullableColumn::create(values, nulls), 1);
+
+        for (bool is_concat_ws : {false, true}) {
+            VectorizedFunctionCallExpr expr(is_concat_ws ? make_function("concat_ws", 30260)
+                                                         : make_function("upper", 30150));
+            VectorizedLiteral literal(separator_node);
+            ColumnRef column_ref(TypeDescriptor::create_varchar_type(64), 1);
+            if (is_concat_ws) {
+                expr.add_child(&literal);
+            }
+            expr.add_child(&column_ref);
+
+            ExprContext context(&expr);
+            context._is_clone = true;
+            ASSERT_TRUE(expr.prepare(nullptr, &context).ok());
+            ASSERT_TRUE(expr.open(nullptr, &context, FunctionContext::FunctionStateScope::THREAD_LOCAL).ok());
+            ASSERT_EQ(is_concat_ws ? 1 : 0, expr._dict_arg_index);
+
+            config::enable_function_dict_evaluation = true;
+            ColumnPtr result = expr.evaluate(&context, &chunk);
+            config::enable_function_dict_evaluation = false;
+            ColumnPtr expected = expr.evaluate(&context, &chunk);
+            config::enable_function_dict_evaluation = true;
+
+            ASSERT_EQ(expected->size(), result->size());
+            for (size_t i = 0; i < expected->size(); ++i) {
+                ASSERT_EQ(expected->debug_item(i), result->debug_item(i));
+            }
+            context.close(nullptr);
+        }
+    }
+}
+
 } // namespace vectorized
 } // namespace starrocks
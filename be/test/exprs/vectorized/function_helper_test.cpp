@@ -106,4 +106,27 @@ TEST_F(FunctionHelperTest, testMergeNotNullableColumnMergeWithNullColumn) {
         }
     }
 }
+
+TEST_F(FunctionHelperTest, testUnionNullableColumnWithoutNulls) {
+    auto v1 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto v2 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    for (int i = 0; i < 10; ++i) {
+        v1->append_datum(Datum(i));
+        if (i % 3 == 0) {
+            v2->append_nulls(1);
+        } else {
+            v2->append_datum(Datum(i));
+        }
+    }
+    ASSERT_FALSE(v1->has_null());
+
+    auto check = [](const NullColumnPtr& result) {
+        ASSERT_EQ(10, result->size());
+        for (int i = 0; i < 10; ++i) {
+            ASSERT_EQ(i % 3 == 0, result->get_data()[i]);
+        }
+    };
+    check(FunctionHelper::union_nullable_column(v1, v2));
+    check(FunctionHelper::union_nullable_column(v2, v1));
+}
 } // namespace starrocks::vectorized
\ No newline at end of file
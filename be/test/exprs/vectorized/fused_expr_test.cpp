@@ -0,0 +1,169 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "exprs/vectorized/fused_expr.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/object_pool.h"
+#include "exprs/vectorized/arithmetic_expr.h"
+#include "exprs/vectorized/binary_predicate.h"
+#include "exprs/vectorized/column_ref.h"
+#include "exprs/vectorized/compound_predicate.h"
+#include "exprs/vectorized/literal.h"
+
+namespace starrocks::vectorized {
+
+class FusedExprTest : public ::testing::Test {
+protected:
+    Expr* slot_ref(PrimitiveType type, SlotId slot_id) {
+        return _pool.add(new ColumnRef(TypeDescriptor(type), slot_id));
+    }
+
+    Expr* int_literal(int32_t value) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::INT_LITERAL);
+        node.__set_num_children(0);
+        node.__set_type(gen_type_desc(TPrimitiveType::INT));
+        TIntLiteral literal;
+        literal.__set_value(value);
+        node.__set_int_literal(literal);
+        return _pool.add(new VectorizedLiteral(node));
+    }
+
+    Expr* arithmetic(TExprOpcode::type op, TPrimitiveType::type type, Expr* lhs, Expr* rhs) {
+        TExprNode node = make_node(TExprNodeType::ARITHMETIC_EXPR, op, type, type);
+        return add_children(VectorizedArithmeticExprFactory::from_thrift(node), lhs, rhs);
+    }
+
+    Expr* compare(TExprOpcode::type op, TPrimitiveType::type child_type, Expr* lhs, Expr* rhs) {
+        TExprNode node = make_node(TExprNodeType::BINARY_PRED, op, TPrimitiveType::BOOLEAN, child_type);
+        return add_children(VectorizedBinaryPredicateFactory::from_thrift(node), lhs, rhs);
+    }
+
+    Expr* compound(TExprOpcode::type op, Expr* lhs, Expr* rhs) {
+        TExprNode node =
+                make_node(TExprNodeType::COMPOUND_PRED, op, TPrimitiveType::BOOLEAN, TPrimitiveType::BOOLEAN);
+        return add_children(VectorizedCompoundPredicateFactory::from_thrift(node), lhs, rhs);
+    }
+
+    // The values are i * step % 97, and every |null_every| row is null if it's positive.
+    template <typename ColumnType>
+    static ColumnPtr make_column(size_t num_rows, int step, int null_every) {
+        auto data = ColumnType::create();
+        auto nulls = NullColumn::create();
+        for (size_t i = 0; i < num_rows; ++i) {
+            data->append(static_cast<int>(i * step % 97));
+            nulls->append(null_every > 0 && i % null_every == 0);
+        }
+        if (null_every <= 0) {
+            return data;
+        }
+        return NullableColumn::create(std::move(data), std::move(nulls));
+    }
+
+    static void assert_same_result(const ColumnPtr& expected, const ColumnPtr& actual) {
+        ASSERT_EQ(expected->size(), actual->size());
+        ASSERT_EQ(expected->is_nullable(), actual->is_nullable());
+        for (size_t i = 0; i < expected->size(); ++i) {
+            ASSERT_EQ(expected->debug_item(i), actual->debug_item(i)) << "row " << i;
+        }
+    }
+
+private:
+    static TExprNode make_node(TExprNodeType::type node_type, TExprOpcode::type op, TPrimitiveType::type type,
+                               TPrimitiveType::type child_type) {
+        TExprNode node;
+        node.__set_node_type(node_type);
+        node.__set_opcode(op);
+        node.__set_num_children(2);
+        node.__set_type(gen_type_desc(type));
+        node.__set_child_type(child_type);
+        return node;
+    }
+
+    Expr* add_children(Expr* expr, Expr* lhs, Expr* rhs) {
+        _pool.add(expr);
+        expr->_children.push_back(lhs);
+        expr->_children.push_back(rhs);
+        return expr;
+    }
+
+    ObjectPool _pool;
+};
+
+// NOLINTNEXTLINE
+TEST_F(FusedExprTest, test_evaluate) {
+    // (a * b + c > d) AND (e < 50) OR (e = f)
+    Expr* sum = arithmetic(TExprOpcode::ADD, TPrimitiveType::BIGINT,
+                           arithmetic(TExprOpcode::MULTIPLY, TPrimitiveType::BIGINT, slot_ref(TYPE_BIGINT, 1),
+                                      slot_ref(TYPE_BIGINT, 2)),
+                           slot_ref(TYPE_BIGINT, 3));
+    Expr* lhs = compound(TExprOpcode::COMPOUND_AND, compare(TExprOpcode::GT, TPrimitiveType::BIGINT, sum,
+                                                            slot_ref(TYPE_BIGINT, 4)),
+                         compare(TExprOpcode::LT, TPrimitiveType::INT, slot_ref(TYPE_INT, 5), int_literal(50)));
+    Expr* root = compound(TExprOpcode::COMPOUND_OR, lhs,
+                          compare(TExprOpcode::EQ, TPrimitiveType::INT, slot_ref(TYPE_INT, 5), slot_ref(TYPE_INT, 6)));
+
+    std::unique_ptr<FusedExpr> fused = FusedExpr::compile(root);
+    ASSERT_TRUE(fused != nullptr);
+
+    // More than one tile, with both nullable and not nullable inputs.
+    const size_t num_rows = 1500;
+    Chunk chunk;
+    chunk.append_column(make_column<Int64Column>(num_rows, 3, 7), 1);
+    chunk.append_column(make_column<Int64Column>(num_rows, 5, 0), 2);
+    chunk.append_column(make_column<Int64Column>(num_rows, 11, 5), 3);
+    chunk.append_column(make_column<Int64Column>(num_rows, 13, 0), 4);
+    chunk.append_column(make_column<Int32Column>(num_rows, 17, 3), 5);
+    chunk.append_column(make_column<Int32Column>(num_rows, 19, 0), 6);
+
+    ColumnPtr expected = root->evaluate(nullptr, &chunk);
+    ColumnPtr actual = fused->evaluate(&chunk);
+    ASSERT_TRUE(actual != nullptr);
+    ASSERT_TRUE(actual->has_null());
+    assert_same_result(expected, actual);
+
+    // The arithmetic of the not nullable columns.
+    Expr* product = arithmetic(TExprOpcode::SUBTRACT, TPrimitiveType::BIGINT,
+                               arithmetic(TExprOpcode::MULTIPLY, TPrimitiveType::BIGINT, slot_ref(TYPE_BIGINT, 2),
+                                          slot_ref(TYPE_BIGINT, 4)),
+                               slot_ref(TYPE_BIGINT, 2));
+    fused = FusedExpr::compile(product);
+    ASSERT_TRUE(fused != nullptr);
+    actual = fused->evaluate(&chunk);
+    ASSERT_TRUE(actual != nullptr);
+    ASSERT_FALSE(actual->is_nullable());
+    assert_same_result(product->evaluate(nullptr, &chunk), actual);
+}
+
+// NOLINTNEXTLINE
+TEST_F(FusedExprTest, test_not_supported) {
+    // A single operator.
+    ASSERT_TRUE(FusedExpr::compile(compare(TExprOpcode::LT, TPrimitiveType::INT, slot_ref(TYPE_INT, 1),
+                                           slot_ref(TYPE_INT, 2))) == nullptr);
+
+    // Division is null on zero divisor.
+    Expr* div = arithmetic(TExprOpcode::DIVIDE, TPrimitiveType::DOUBLE, slot_ref(TYPE_DOUBLE, 1),
+                           slot_ref(TYPE_DOUBLE, 2));
+    ASSERT_TRUE(FusedExpr::compile(compare(TExprOpcode::LT, TPrimitiveType::DOUBLE, div, slot_ref(TYPE_DOUBLE, 3))) ==
+                nullptr);
+
+    // The constant input column falls back to the tree evaluation.
+    Expr* root = compare(TExprOpcode::LT, TPrimitiveType::BIGINT,
+                         arithmetic(TExprOpcode::ADD, TPrimitiveType::BIGINT, slot_ref(TYPE_BIGINT, 1),
+                                    slot_ref(TYPE_BIGINT, 2)),
+                         slot_ref(TYPE_BIGINT, 3));
+    std::unique_ptr<FusedExpr> fused = FusedExpr::compile(root);
+    ASSERT_TRUE(fused != nullptr);
+    Chunk chunk;
+    chunk.append_column(make_column<Int64Column>(10, 1, 0), 1);
+    chunk.append_column(ColumnHelper::create_const_column<TYPE_BIGINT>(1, 10), 2);
+    chunk.append_column(make_column<Int64Column>(10, 2, 0), 3);
+    ASSERT_TRUE(fused->evaluate(&chunk) == nullptr);
+}
+
+} // namespace starrocks::vectorized
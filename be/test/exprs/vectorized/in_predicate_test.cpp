@@ -5,10 +5,15 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <set>
+
 #include "butil/time.h"
 #include "column/binary_column.h"
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "common/object_pool.h"
+#include "exprs/vectorized/in_const_predicate.hpp"
 #include "exprs/vectorized/mock_vectorized_expr.h"
 
 namespace starrocks {
@@ -257,5 +262,95 @@ TEST_F(VectorizedInPredicateTest, inConstPred) {
     }
 }
 
+TEST_F(VectorizedInPredicateTest, intInLookupMode) {
+    expr_node.child_type = TPrimitiveType::INT;
+    expr_node.opcode = TExprOpcode::FILTER_IN;
+    expr_node.type = gen_type_desc(TPrimitiveType::INT);
+    expr_node.in_predicate.is_not_in = false;
+
+    // The rows are -50..49, every 7th one is null.
+    auto data = Int32Column::create();
+    auto nulls = NullColumn::create();
+    for (int i = -50; i < 50; i++) {
+        data->append(i);
+        nulls->append((i + 50) % 7 == 0);
+    }
+    auto nullable = NullableColumn::create(data, nulls);
+
+    auto check = [&](const std::vector<int32_t>& values, in_const_pred_detail::LookupMode mode) {
+        ObjectPool pool;
+        auto expr = std::unique_ptr<Expr>(VectorizedInPredicateFactory::from_thrift(expr_node));
+        std::set<int32_t> value_set(values.begin(), values.end());
+        for (const ColumnPtr& lhs : {ColumnPtr(data), ColumnPtr(nullable)}) {
+            expr->_children.clear();
+            expr->_children.push_back(pool.add(new MockExpr(expr_node, lhs)));
+            for (int32_t v : values) {
+                expr->_children.push_back(pool.add(new MockConstVectorizedExpr<TYPE_INT>(expr_node, v)));
+            }
+            ASSERT_TRUE(expr->prepare(nullptr, nullptr).ok());
+            ASSERT_TRUE(expr->open(nullptr, nullptr, FunctionContext::FunctionStateScope::THREAD_LOCAL).ok());
+            ASSERT_EQ(mode, down_cast<VectorizedInConstPredicate<TYPE_INT>*>(expr.get())->_lookup_mode());
+
+            ColumnPtr result = expr->evaluate(nullptr, nullptr);
+            ASSERT_EQ(lhs->size(), result->size());
+            for (size_t i = 0; i < lhs->size(); i++) {
+                if (lhs->is_null(i)) {
+                    ASSERT_TRUE(result->is_null(i));
+                } else {
+                    ASSERT_EQ(value_set.count(data->get_data()[i]) > 0, result->get(i).get_int8()) << i;
+                }
+            }
+        }
+    };
+
+    check({3, -7, 49, 3}, in_const_pred_detail::LookupMode::SMALL);
+    check({-50, -40, -30, -20, -10, 0, 10, 20, 30, 40, 1000}, in_const_pred_detail::LookupMode::DENSE);
+    check({-50, 2, 4, 6, 8, 10, 12, 14, 16, 1000000000}, in_const_pred_detail::LookupMode::HASH_SET);
+}
+
+TEST_F(VectorizedInPredicateTest, sliceInLargeSet) {
+    expr_node.child_type = TPrimitiveType::VARCHAR;
+    expr_node.opcode = TExprOpcode::FILTER_IN;
+    expr_node.type = gen_type_desc(TPrimitiveType::VARCHAR);
+    expr_node.in_predicate.is_not_in = false;
+
+    // The set is large enough to prefetch the buckets, the even numbers in [0, 20000).
+    std::vector<std::string> values;
+    for (int i = 0; i < 20000; i += 2) {
+        values.emplace_back(std::to_string(i));
+    }
+    auto data = BinaryColumn::create();
+    auto nulls = NullColumn::create();
+    for (int i = 0; i < 1000; i++) {
+        data->append(std::to_string(i * 37));
+        nulls->append(i % 5 == 0);
+    }
+    auto nullable = NullableColumn::create(data, nulls);
+
+    ObjectPool pool;
+    auto expr = std::unique_ptr<Expr>(VectorizedInPredicateFactory::from_thrift(expr_node));
+    for (const ColumnPtr& lhs : {ColumnPtr(data), ColumnPtr(nullable)}) {
+        expr->_children.clear();
+        expr->_children.push_back(pool.add(new MockExpr(expr_node, lhs)));
+        for (const auto& v : values) {
+            expr->_children.push_back(pool.add(new MockConstVectorizedExpr<TYPE_VARCHAR>(expr_node, Slice(v))));
+        }
+        ASSERT_TRUE(expr->prepare(nullptr, nullptr).ok());
+        ASSERT_TRUE(expr->open(nullptr, nullptr, FunctionContext::FunctionStateScope::THREAD_LOCAL).ok());
+        ASSERT_TRUE(down_cast<VectorizedInConstPredicate<TYPE_VARCHAR>*>(expr.get())->_use_prefetch());
+
+        ColumnPtr result = expr->evaluate(nullptr, nullptr);
+        ASSERT_EQ(lhs->size(), result->size());
+        for (size_t i = 0; i < lhs->size(); i++) {
+            if (lhs->is_null(i)) {
+                ASSERT_TRUE(result->is_null(i));
+            } else {
+                int v = i * 37;
+                ASSERT_EQ(v < 20000 && v % 2 == 0, result->get(i).get_int8()) << i;
+            }
+        }
+    }
+}
+
 } // namespace vectorized
 } // namespace starrocks
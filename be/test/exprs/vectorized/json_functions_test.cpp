@@ -302,6 +302,32 @@ TEST_F(JsonFunctionsTest, get_json_emptyTest) {
     }
 }
 
+TEST_F(JsonFunctionsTest, get_json_const_pathTest) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    Columns columns;
+    auto jsons = BinaryColumn::create();
+    jsons->append("{\"k1\":{\"k2\":[1, 2]}, \"k3\":3}");
+    jsons->append("{\"k3\":3}");
+    jsons->append("{\"k1\":{\"k2\":[3, 4, 5]}}");
+    jsons->append("[{\"k1\":{\"k2\":[6, 7]}}]");
+    columns.emplace_back(jsons);
+    columns.emplace_back(ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice("$.k1.k2[1]"), jsons->size()));
+
+    // The path is parsed once by the prepare, and used by all the rows.
+    ctx.get()->impl()->set_constant_columns(columns);
+    ASSERT_TRUE(JsonFunctions::json_path_prepare(ctx.get(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+    ASSERT_TRUE(ctx->get_function_state(FunctionContext::FRAGMENT_LOCAL) != nullptr);
+
+    ColumnPtr result = JsonFunctions::get_json_int(ctx.get(), columns);
+    ASSERT_EQ(4, result->size());
+    ASSERT_EQ("2", result->debug_item(0));
+    ASSERT_TRUE(result->is_null(1));
+    ASSERT_EQ("4", result->debug_item(2));
+    ASSERT_EQ("7", result->debug_item(3));
+
+    ASSERT_TRUE(JsonFunctions::json_path_close(ctx.get(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+}
+
 // Test compatibility of float and double
 TEST_F(JsonFunctionsTest, json_float_double) {
     namespace vpack = arangodb::velocypack;
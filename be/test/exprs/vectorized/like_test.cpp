@@ -4,7 +4,11 @@
 #include <gtest/gtest.h>
 
 #include "butil/time.h"
+#include "column/chunk.h"
+#include "exprs/vectorized/column_ref.h"
+#include "exprs/vectorized/compound_predicate.h"
 #include "exprs/vectorized/like_predicate.h"
+#include "exprs/vectorized/literal.h"
 #include "exprs/vectorized/mock_vectorized_expr.h"
 
 namespace starrocks {
@@ -471,5 +475,111 @@ TEST_F(LikeTest, rowsPatternRegex) {
                         .ok());
 }
 
+class MultiPatternMatcherTest : public ::testing::Test {
+protected:
+    // The predicate `slot LIKE pattern` or `slot REGEXP pattern`.
+    Expr* predicate(const std::string& name, SlotId slot_id, const std::string& pattern) {
+        TFunction fn;
+        fn.name.__set_function_name(name);
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+        node.__set_num_children(2);
+        node.__set_type(gen_type_desc(TPrimitiveType::BOOLEAN));
+        node.__set_fn(fn);
+        Expr* expr = _pool.add(new MockExpr(node, nullptr));
+
+        TExprNode literal_node;
+        literal_node.__set_node_type(TExprNodeType::STRING_LITERAL);
+        literal_node.__set_num_children(0);
+        literal_node.__set_type(gen_type_desc(TPrimitiveType::VARCHAR));
+        TStringLiteral literal;
+        literal.__set_value(pattern);
+        literal_node.__set_string_literal(literal);
+
+        expr->_children.push_back(_pool.add(new ColumnRef(TypeDescriptor::create_varchar_type(64), slot_id)));
+        expr->_children.push_back(_pool.add(new VectorizedLiteral(literal_node)));
+        return expr;
+    }
+
+    Expr* or_predicate(Expr* lhs, Expr* rhs) {
+        TExprNode node;
+        node.__set_node_type(TExprNodeType::COMPOUND_PRED);
+        node.__set_opcode(TExprOpcode::COMPOUND_OR);
+        node.__set_num_children(2);
+        node.__set_type(gen_type_desc(TPrimitiveType::BOOLEAN));
+        Expr* expr = _pool.add(VectorizedCompoundPredicateFactory::from_thrift(node));
+        expr->_children.push_back(lhs);
+        expr->_children.push_back(rhs);
+        return expr;
+    }
+
+private:
+    ObjectPool _pool;
+};
+
+TEST_F(MultiPatternMatcherTest, substrings) {
+    Expr* root = or_predicate(or_predicate(predicate("like", 1, "%bc%"), predicate("like", 1, "%error\\_%")),
+                              predicate("regexp", 1, "timeout"));
+    auto matcher = MultiPatternMatcher::create(root);
+    ASSERT_TRUE(matcher != nullptr);
+    ASSERT_EQ(3, matcher->num_patterns());
+    ASSERT_TRUE(matcher->_substrings_only);
+
+    auto str = BinaryColumn::create();
+    auto null = NullColumn::create();
+    // "ab" and "cd" must not match %bc% across the rows.
+    std::vector<std::string> values = {"ab", "cd", "xbcx", "", "an error_1", "an error1", "read timeout", "bc", "x"};
+    std::vector<uint8_t> expected = {0, 0, 1, 0, 1, 0, 1, 1, 0};
+    for (size_t i = 0; i < values.size(); ++i) {
+        str->append(values[i]);
+        null->append(i == 2);
+    }
+    Chunk chunk;
+    chunk.append_column(NullableColumn::create(str, null), 1);
+
+    ColumnPtr result = matcher->evaluate(nullptr, &chunk);
+    ASSERT_TRUE(result->is_nullable());
+    ASSERT_EQ(values.size(), result->size());
+    auto v = ColumnHelper::cast_to<TYPE_BOOLEAN>(ColumnHelper::as_column<NullableColumn>(result)->data_column());
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(i == 2, result->is_null(i));
+        ASSERT_EQ(expected[i], v->get_data()[i]) << values[i];
+    }
+}
+
+TEST_F(MultiPatternMatcherTest, regexes) {
+    Expr* root = or_predicate(predicate("like", 1, "a%z"), predicate("regexp", 1, "[0-9]+x"));
+    auto matcher = MultiPatternMatcher::create(root);
+    ASSERT_TRUE(matcher != nullptr);
+    ASSERT_FALSE(matcher->_substrings_only);
+
+    auto str = BinaryColumn::create();
+    std::vector<std::string> values = {"abcz", "abcz\n", "12x", "x", "", "az", "za"};
+    std::vector<uint8_t> expected = {1, 0, 1, 0, 0, 1, 0};
+    for (const auto& value : values) {
+        str->append(value);
+    }
+    Chunk chunk;
+    chunk.append_column(str, 1);
+
+    ColumnPtr result = matcher->evaluate(nullptr, &chunk);
+    ASSERT_FALSE(result->is_nullable());
+    auto v = ColumnHelper::cast_to<TYPE_BOOLEAN>(result);
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(expected[i], v->get_data()[i]) << values[i];
+    }
+}
+
+TEST_F(MultiPatternMatcherTest, not_supported) {
+    // A single predicate.
+    ASSERT_TRUE(MultiPatternMatcher::create(predicate("like", 1, "%a%")) == nullptr);
+    // The predicates on different columns.
+    ASSERT_TRUE(MultiPatternMatcher::create(or_predicate(predicate("like", 1, "%a%"), predicate("like", 2, "%b%"))) ==
+                nullptr);
+    // Other functions.
+    ASSERT_TRUE(MultiPatternMatcher::create(or_predicate(predicate("like", 1, "%a%"), predicate("upper", 1, "b"))) ==
+                nullptr);
+}
+
 } // namespace vectorized
 } // namespace starrocks
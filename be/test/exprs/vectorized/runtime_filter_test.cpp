@@ -329,5 +329,204 @@ TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterMerge3) {
     EXPECT_EQ(pbf0->max_value(), Slice("dd", 2));
 }
 
+TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterBitset) {
+    RuntimeBloomFilter<TYPE_INT> bf0;
+    JoinRuntimeFilter* rf0 = &bf0;
+    auto column = Int32Column::create();
+    for (int i = 100; i < 200; i += 3) {
+        column->append(i);
+    }
+    bf0.init(column->size());
+    RuntimeFilterHelper::fill_runtime_bloom_filter(column, TYPE_INT, rf0, 0, false);
+    EXPECT_TRUE(bf0.has_bitset());
+    EXPECT_EQ(bf0.bitset().count(), column->size());
+    EXPECT_EQ(bf0.min_value(), 100);
+    EXPECT_EQ(bf0.max_value(), 198);
+    for (int i = 90; i < 210; i++) {
+        EXPECT_EQ(bf0.test_data(i), i >= 100 && i < 200 && (i - 100) % 3 == 0);
+    }
+
+    size_t max_size = RuntimeFilterHelper::max_runtime_filter_serialized_size(rf0);
+    std::vector<uint8_t> buffer(max_size, 0);
+    size_t actual_size = RuntimeFilterHelper::serialize_runtime_filter(rf0, buffer.data());
+    buffer.resize(actual_size);
+
+    JoinRuntimeFilter* rf1 = nullptr;
+    ObjectPool pool;
+    RuntimeFilterHelper::deserialize_runtime_filter(&pool, &rf1, buffer.data(), actual_size);
+    EXPECT_TRUE(rf1->check_equal(*rf0));
+    EXPECT_TRUE(static_cast<RuntimeBloomFilter<TYPE_INT>*>(rf1)->has_bitset());
+}
+
+TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterBitsetSparse) {
+    RuntimeBloomFilter<TYPE_BIGINT> bf0;
+    JoinRuntimeFilter* rf0 = &bf0;
+    auto column = Int64Column::create();
+    for (int64_t i = 0; i < 100; i++) {
+        column->append(i * 1000);
+    }
+    bf0.init(column->size());
+    RuntimeFilterHelper::fill_runtime_bloom_filter(column, TYPE_BIGINT, rf0, 0, false);
+    EXPECT_FALSE(bf0.has_bitset());
+    for (int64_t i = 0; i < 100; i++) {
+        EXPECT_TRUE(bf0.test_data(i * 1000));
+    }
+}
+
+TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterBitsetMerge) {
+    // merge of two dense ranges keeps the bitset.
+    RuntimeBloomFilter<TYPE_INT> bf0;
+    RuntimeBloomFilter<TYPE_INT> bf1;
+    {
+        auto column0 = Int32Column::create();
+        auto column1 = Int32Column::create();
+        for (int i = 0; i < 100; i++) {
+            column0->append(i);
+            column1->append(i + 50);
+        }
+        bf0.init(column0->size());
+        RuntimeFilterHelper::fill_runtime_bloom_filter(column0, TYPE_INT, &bf0, 0, false);
+        bf1.init(column1->size());
+        RuntimeFilterHelper::fill_runtime_bloom_filter(column1, TYPE_INT, &bf1, 0, false);
+    }
+    EXPECT_TRUE(bf0.has_bitset());
+    EXPECT_TRUE(bf1.has_bitset());
+    bf0.merge(&bf1);
+    EXPECT_TRUE(bf0.has_bitset());
+    EXPECT_EQ(bf0.bitset().count(), 150);
+    EXPECT_EQ(bf0.min_value(), 0);
+    EXPECT_EQ(bf0.max_value(), 149);
+    for (int i = 0; i < 150; i++) {
+        EXPECT_TRUE(bf0.test_data(i));
+    }
+
+    // merge of a bitset and a bloom filter falls back to the bloom filter.
+    RuntimeBloomFilter<TYPE_INT> bf2;
+    bf2.init(100);
+    for (int i = 0; i < 100; i++) {
+        int value = i * 10000;
+        bf2.insert(&value);
+    }
+    EXPECT_FALSE(bf2.has_bitset());
+    bf0.merge(&bf2);
+    EXPECT_FALSE(bf0.has_bitset());
+    for (int i = 0; i < 150; i++) {
+        EXPECT_TRUE(bf0.test_data(i));
+    }
+    for (int i = 0; i < 100; i++) {
+        EXPECT_TRUE(bf0.test_data(i * 10000));
+    }
+}
+
+TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterBitsetConcat) {
+    ObjectPool pool;
+    RuntimeBloomFilter<TYPE_INT> bf0;
+    RuntimeBloomFilter<TYPE_INT> bf1;
+    {
+        auto column0 = Int32Column::create();
+        for (int i = 0; i < 100; i++) {
+            column0->append(i);
+        }
+        bf0.init(column0->size());
+        RuntimeFilterHelper::fill_runtime_bloom_filter(column0, TYPE_INT, &bf0, 0, false);
+        bf1.init(100);
+        for (int i = 0; i < 100; i++) {
+            int value = i * 10000;
+            bf1.insert(&value);
+        }
+    }
+    auto* rf = bf0.create_empty(&pool);
+    rf->init_min_max();
+    rf->concat(&bf0);
+    rf->concat(&bf1);
+
+    size_t max_size = RuntimeFilterHelper::max_runtime_filter_serialized_size(rf);
+    std::vector<uint8_t> buffer(max_size, 0);
+    size_t actual_size = RuntimeFilterHelper::serialize_runtime_filter(rf, buffer.data());
+    buffer.resize(actual_size);
+    JoinRuntimeFilter* rf1 = nullptr;
+    RuntimeFilterHelper::deserialize_runtime_filter(&pool, &rf1, buffer.data(), actual_size);
+    EXPECT_TRUE(rf1->check_equal(*rf));
+
+    auto* out = static_cast<RuntimeBloomFilter<TYPE_INT>*>(rf1);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_TRUE(out->test_data_with_hash(i, 0));
+        EXPECT_TRUE(out->test_data_with_hash(i * 10000, 1));
+    }
+    EXPECT_FALSE(out->test_data_with_hash(100, 0));
+}
+
+TEST_F(RuntimeFilterTest, TestFilterZonemapWithMinMax) {
+    RuntimeBloomFilter<TYPE_INT> bf0;
+    bf0.init(100);
+    for (int i = 100; i < 1000; i += 100) {
+        bf0.insert(&i);
+    }
+    auto min_column = Int32Column::create();
+    auto max_column = Int32Column::create();
+    auto filter_zonemap = [&](int32_t min_value, int32_t max_value) {
+        min_column->resize(0);
+        max_column->resize(0);
+        min_column->append(min_value);
+        max_column->append(max_value);
+        return RuntimeFilterHelper::filter_zonemap_with_min_max(TYPE_INT, &bf0, min_column.get(), max_column.get());
+    };
+    EXPECT_TRUE(filter_zonemap(0, 99));
+    EXPECT_TRUE(filter_zonemap(901, 2000));
+    EXPECT_FALSE(filter_zonemap(0, 100));
+    EXPECT_FALSE(filter_zonemap(150, 160));
+    // the type of the probe slot is different
+    EXPECT_FALSE(RuntimeFilterHelper::filter_zonemap_with_min_max(TYPE_BIGINT, &bf0, min_column.get(),
+                                                                   max_column.get()));
+
+    // the gap of a bitset can be filtered
+    RuntimeBloomFilter<TYPE_INT> bf1;
+    auto column = Int32Column::create();
+    for (int i = 0; i < 100; i++) {
+        column->append(i < 50 ? i : i + 100);
+    }
+    bf1.init(column->size());
+    RuntimeFilterHelper::fill_runtime_bloom_filter(column, TYPE_INT, &bf1, 0, false);
+    EXPECT_TRUE(bf1.has_bitset());
+    EXPECT_TRUE(bf1.bitset().test_range(0, 10));
+    EXPECT_FALSE(bf1.bitset().test_range(50, 149));
+    EXPECT_TRUE(bf1.bitset().test_range(50, 150));
+    EXPECT_FALSE(bf1.bitset().test_range(200, 300));
+}
+
+TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterMinMaxOnly) {
+    RuntimeBloomFilter<TYPE_INT> bf0;
+    bf0.init(100);
+    for (int i = 0; i < 100; i++) {
+        int value = i * 10;
+        bf0.insert(&value);
+    }
+    ObjectPool pool;
+    auto* rf = bf0.create_min_max_only(&pool);
+    EXPECT_LT(RuntimeFilterHelper::max_runtime_filter_serialized_size(rf),
+              RuntimeFilterHelper::max_runtime_filter_serialized_size(&bf0));
+    EXPECT_EQ(rf->min_value(), 0);
+    EXPECT_EQ(rf->max_value(), 990);
+    for (int i = 0; i <= 990; i++) {
+        EXPECT_TRUE(rf->test_data(i));
+    }
+    EXPECT_FALSE(rf->test_data(-1));
+    EXPECT_FALSE(rf->test_data(991));
+
+    // concat of the min/max only filter and the bloom filter
+    RuntimeBloomFilter<TYPE_INT> bf1;
+    bf1.init(100);
+    for (int i = 0; i < 100; i++) {
+        int value = i * 20;
+        bf1.insert(&value);
+    }
+    auto* out = bf0.create_empty(&pool);
+    out->init_min_max();
+    out->concat(rf);
+    out->concat(&bf1);
+    EXPECT_TRUE(out->test_data_with_hash(5, 0));
+    EXPECT_TRUE(out->test_data_with_hash(1980, 1));
+}
+
 } // namespace vectorized
 } // namespace starrocks
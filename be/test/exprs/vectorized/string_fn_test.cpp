@@ -1097,6 +1097,38 @@ PARALLEL_TEST(VecStringFunctionsTest, utf8LengthChineseTest) {
     }
 }
 
+PARALLEL_TEST(VecStringFunctionsTest, utf8LengthNullableTest) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    // The ASCII column and the column with a non-ASCII row.
+    for (const std::string& last : {std::string("abc"), std::string("中文abc")}) {
+        Columns columns;
+        auto str = BinaryColumn::create();
+        auto null = NullColumn::create();
+        std::vector<int> expected;
+        for (int j = 0; j < 20; ++j) {
+            str->append(std::string(j * 3, 'x'));
+            null->append(j % 3 == 0);
+            expected.push_back(j * 3);
+        }
+        str->append(last);
+        null->append(0);
+        expected.push_back(last.size() == 3 ? 3 : 5);
+        columns.emplace_back(NullableColumn::create(str, null));
+
+        ColumnPtr result = StringFunctions::utf8_length(ctx.get(), columns);
+        ASSERT_EQ(21, result->size());
+        ASSERT_TRUE(result->is_nullable());
+
+        auto v = ColumnHelper::cast_to<TYPE_INT>(ColumnHelper::as_column<NullableColumn>(result)->data_column());
+        for (int k = 0; k < 21; ++k) {
+            ASSERT_EQ(k < 20 && k % 3 == 0, result->is_null(k));
+            if (!result->is_null(k)) {
+                ASSERT_EQ(expected[k], v->get_data()[k]);
+            }
+        }
+    }
+}
+
 PARALLEL_TEST(VecStringFunctionsTest, upperTest) {
     std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
     Columns columns;
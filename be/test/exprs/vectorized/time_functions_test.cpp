@@ -14,10 +14,12 @@
 #include "column/fixed_length_column.h"
 #include "column/vectorized_fwd.h"
 #include "exprs/vectorized/mock_vectorized_expr.h"
+#include "runtime/datetime_value.h"
 #include "runtime/runtime_state.h"
 #include "runtime/time_types.h"
 #include "testutil/function_utils.h"
 #include "udf/udf.h"
+#include "util/timezone_utils.h"
 
 namespace starrocks {
 namespace vectorized {
@@ -1569,6 +1571,55 @@ TEST_F(TimeFunctionsTest, convertTzConstTest) {
                     .ok());
 }
 
+TEST_F(TimeFunctionsTest, convertTzConstDstTest) {
+    // Every 7 minutes over both the daylight saving transitions of New York in 2021.
+    auto tc = TimestampColumn::create();
+    TimestampValue begin = TimestampValue::create(2021, 3, 13, 0, 0, 0);
+    for (int64_t seconds = 0; seconds < 240 * 24 * 3600; seconds += 7 * 60) {
+        TimestampValue ts;
+        ts.from_unix_second(begin.to_unix_second() + seconds);
+        tc->append(ts);
+    }
+
+    Columns columns;
+    columns.emplace_back(tc);
+    columns.emplace_back(ColumnHelper::create_const_column<TYPE_VARCHAR>("America/New_York", 1));
+    columns.emplace_back(ColumnHelper::create_const_column<TYPE_VARCHAR>("Europe/London", 1));
+
+    _utils->get_fn_ctx()->impl()->set_constant_columns(columns);
+    _utils->get_fn_ctx()->impl()->_arg_types.emplace_back(FunctionContext::TypeDesc{TYPE_DATETIME});
+    _utils->get_fn_ctx()->impl()->_arg_types.emplace_back(FunctionContext::TypeDesc{TYPE_VARCHAR});
+    _utils->get_fn_ctx()->impl()->_arg_types.emplace_back(FunctionContext::TypeDesc{TYPE_VARCHAR});
+
+    ASSERT_TRUE(
+            TimeFunctions::convert_tz_prepare(_utils->get_fn_ctx(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                    .ok());
+    ColumnPtr result = TimeFunctions::convert_tz(_utils->get_fn_ctx(), columns);
+    ASSERT_TRUE(
+            TimeFunctions::convert_tz_close(_utils->get_fn_ctx(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                    .ok());
+
+    // The same as converting each value with cctz, including the skipped and repeated local times.
+    cctz::time_zone from;
+    cctz::time_zone to;
+    ASSERT_TRUE(TimezoneUtils::find_cctz_time_zone("America/New_York", from));
+    ASSERT_TRUE(TimezoneUtils::find_cctz_time_zone("Europe/London", to));
+    auto values = ColumnHelper::cast_to<TYPE_DATETIME>(result);
+    ASSERT_EQ(tc->size(), values->size());
+    for (size_t i = 0; i < tc->size(); ++i) {
+        int year, month, day, hour, minute, second, usec;
+        tc->get_data()[i].to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
+        int64_t timestamp;
+        DateTimeValue(TIME_DATETIME, year, month, day, hour, minute, second, usec).unix_timestamp(&timestamp, from);
+        DateTimeValue expected;
+        expected.from_unixtime(timestamp, to);
+        ASSERT_EQ(TimestampValue::create(expected.year(), expected.month(), expected.day(), expected.hour(),
+                                         expected.minute(), expected.second()),
+                  values->get_data()[i])
+                << tc->get_data()[i].to_string();
+    }
+}
+
 TEST_F(TimeFunctionsTest, utctimestampTest) {
     {
         ColumnPtr ptr = TimeFunctions::utc_timestamp(_utils->get_fn_ctx(), Columns());
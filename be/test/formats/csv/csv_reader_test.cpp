@@ -0,0 +1,85 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "formats/csv/csv_reader.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+namespace starrocks::vectorized {
+
+// Reads the records of a string, |fill_size| bytes per fill.
+class StringCSVReader final : public CSVReader {
+public:
+    StringCSVReader(std::string data, size_t fill_size, const string& row_delimiter, const string& column_separator)
+            : CSVReader(row_delimiter, column_separator), _data(std::move(data)), _fill_size(fill_size) {}
+
+protected:
+    Status _fill_buffer() override {
+        size_t n = std::min({_fill_size, _buff.free_space(), _data.size() - _offset});
+        if (n == 0) {
+            return Status::EndOfFile("");
+        }
+        memcpy(_buff.limit(), _data.data() + _offset, n);
+        _buff.add_limit(n);
+        _offset += n;
+        return Status::OK();
+    }
+
+private:
+    std::string _data;
+    size_t _fill_size;
+    size_t _offset = 0;
+};
+
+// NOLINTNEXTLINE
+TEST(CSVReaderTest, test_split_record) {
+    // Longer than a vector, and the separators are at the boundaries of the vectors.
+    std::string record;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 20; i++) {
+        expected.emplace_back(std::string(i % 4 == 0 ? 0 : 30 + i % 3, 'a' + i));
+        record += expected.back();
+        record += i + 1 < 20 ? "," : "";
+    }
+
+    StringCSVReader reader("", 1, "\n", ",");
+    CSVReader::Fields fields;
+    reader.split_record(Slice(record), &fields);
+    ASSERT_EQ(expected.size(), fields.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(expected[i], fields[i].to_string());
+    }
+
+    StringCSVReader multi_reader("", 1, "\n", "||");
+    fields.clear();
+    multi_reader.split_record(Slice("a||||bc||"), &fields);
+    ASSERT_EQ(4, fields.size());
+    ASSERT_EQ("a", fields[0].to_string());
+    ASSERT_EQ("", fields[1].to_string());
+    ASSERT_EQ("bc", fields[2].to_string());
+    ASSERT_EQ("", fields[3].to_string());
+}
+
+// NOLINTNEXTLINE
+TEST(CSVReaderTest, test_next_buffered_record) {
+    StringCSVReader reader("a,b\nc,d\ne,f\n", 8, "\n", ",");
+    CSVReader::Record record;
+    ASSERT_FALSE(reader.next_buffered_record(&record));
+
+    // Fills the first 8 bytes.
+    ASSERT_TRUE(reader.next_record(&record).ok());
+    ASSERT_EQ("a,b", record.to_string());
+    CSVReader::Record buffered_record;
+    ASSERT_TRUE(reader.next_buffered_record(&buffered_record));
+    ASSERT_EQ("c,d", buffered_record.to_string());
+    // The records returned before are still valid.
+    ASSERT_EQ("a,b", record.to_string());
+    ASSERT_FALSE(reader.next_buffered_record(&record));
+
+    ASSERT_TRUE(reader.next_record(&record).ok());
+    ASSERT_EQ("e,f", record.to_string());
+    ASSERT_TRUE(reader.next_record(&record).is_end_of_file());
+}
+
+} // namespace starrocks::vectorized
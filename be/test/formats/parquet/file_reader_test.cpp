@@ -10,10 +10,12 @@
 #include "env/env.h"
 #include "exprs/expr_context.h"
 #include "exprs/vectorized/binary_predicate.h"
+#include "formats/file_meta_cache.h"
 #include "formats/parquet/column_chunk_reader.h"
 #include "formats/parquet/metadata.h"
 #include "formats/parquet/page_reader.h"
 #include "runtime/descriptor_helper.h"
+#include "util/defer_op.h"
 
 namespace starrocks::parquet {
 
@@ -555,6 +557,35 @@ TEST_F(FileReaderTest, TestGetNext) {
     ASSERT_TRUE(status.is_end_of_file());
 }
 
+TEST_F(FileReaderTest, TestFooterCache) {
+    FileMetaCache::create_global_cache(nullptr, 1024 * 1024);
+    DeferOp release_cache([] { FileMetaCache::release_global_cache(); });
+    auto file = _create_file(_file_path);
+    auto file_id = io::BlockCache::file_id(file->filename(), 1, _file_size);
+    ASSERT_EQ(nullptr,
+              FileMetaCache::instance()->lookup<FileMetaData>(FileMetaCache::MetaType::PARQUET_FOOTER, file_id));
+
+    auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(), _file_size, 1);
+    ASSERT_TRUE(file_reader->init(*_create_param()).ok());
+    auto file_metadata =
+            FileMetaCache::instance()->lookup<FileMetaData>(FileMetaCache::MetaType::PARQUET_FOOTER, file_id);
+    ASSERT_NE(nullptr, file_metadata);
+    ASSERT_EQ(4, file_metadata->num_rows());
+
+    // The second reader gets the footer from the cache.
+    file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(), _file_size, 1);
+    ASSERT_TRUE(file_reader->init(*_create_param()).ok());
+    auto chunk = _create_chunk();
+    ASSERT_TRUE(file_reader->get_next(&chunk).ok());
+    ASSERT_EQ(4, chunk->num_rows());
+
+    // Another version of the file doesn't hit.
+    auto new_file_id = io::BlockCache::file_id(file->filename(), 2, _file_size);
+    ASSERT_EQ(nullptr,
+              FileMetaCache::instance()->lookup<FileMetaData>(FileMetaCache::MetaType::PARQUET_FOOTER, new_file_id));
+    ASSERT_EQ(nullptr, FileMetaCache::instance()->lookup<std::string>(FileMetaCache::MetaType::ORC_FILE_TAIL, file_id));
+}
+
 TEST_F(FileReaderTest, TestGetNextPartition) {
     // create file
     auto file = _create_file(_file_path);
@@ -23,23 +23,16 @@ public:
 class MockColumnReader : public ColumnReader {
 public:
     MockColumnReader() = default;
-    explicit MockColumnReader(tparquet::Type::type type) : _type(type) {}
+    explicit MockColumnReader(tparquet::Type::type type, size_t num_rows = 12) : _num_rows(num_rows), _type(type) {}
     ~MockColumnReader() override = default;
 
     Status prepare_batch(size_t* num_records, ColumnContentType content_type, vectorized::Column* column) override {
-        if (_step > 1) {
+        if (_next_row >= _num_rows) {
             *num_records = 0;
             return Status::EndOfFile("");
         }
-        size_t start = 0;
-        size_t num_rows = 0;
-        if (_step == 0) {
-            start = 0;
-            num_rows = 8;
-        } else if (_step == 1) {
-            start = 8;
-            num_rows = 4;
-        }
+        size_t start = _next_row;
+        size_t num_rows = std::min(*num_records, _num_rows - _next_row);
 
         if (_type == tparquet::Type::type::INT32) {
             _append_int32_column(column, start, num_rows);
@@ -55,11 +48,16 @@ public:
             _append_double_column(column, start, num_rows);
         }
 
-        _step++;
+        _next_row += num_rows;
         *num_records = num_rows;
         return Status::OK();
     }
 
+    Status skip_rows(size_t num_rows) override {
+        _next_row += num_rows;
+        return Status::OK();
+    }
+
     Status finish_batch() override { return Status::OK(); }
 
     void get_levels(int16_t** def_levels, int16_t** rep_levels, size_t* num_levels) override {}
@@ -105,7 +103,8 @@ private:
         }
     }
 
-    int _step = 0;
+    size_t _num_rows;
+    size_t _next_row = 0;
     tparquet::Type::type _type = tparquet::Type::type::INT32;
 };
 
@@ -404,4 +403,95 @@ TEST_F(GroupReaderTest, TestGetNext) {
     _check_chunk(param, chunk, 8, 4);
 }
 
+TEST_F(GroupReaderTest, TestGetNextRowRanges) {
+    auto* file = _create_file();
+    auto* param = _create_group_reader_param();
+
+    FileMetaData* file_meta;
+    Status status = _create_filemeta(&file_meta, param);
+    ASSERT_TRUE(status.ok());
+
+    auto* group_reader = _pool.add(new GroupReader(config::vector_chunk_size, file, file_meta, 0));
+    status = group_reader->init(*param);
+    ASSERT_TRUE(status.is_end_of_file());
+
+    replace_column_readers(group_reader, param);
+    group_reader->_read_chunk = _create_chunk(param);
+    // The rows [0, 2), [5, 9) and [11, 12) are filtered by the page indexes.
+    group_reader->_param.row_ranges = {{2, 5}, {9, 11}};
+    int64_t page_skip_rows = g_hdfs_scan_stats.page_skip_rows;
+
+    auto chunk = _create_chunk(param);
+    size_t row_count = 8;
+    status = group_reader->get_next(&chunk, &row_count);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(row_count, 3);
+    _check_chunk(param, chunk, 2, 3);
+
+    chunk = _create_chunk(param);
+    row_count = 8;
+    status = group_reader->get_next(&chunk, &row_count);
+    ASSERT_TRUE(status.is_end_of_file());
+    ASSERT_EQ(row_count, 2);
+    _check_chunk(param, chunk, 9, 2);
+    ASSERT_EQ(6, g_hdfs_scan_stats.page_skip_rows - page_skip_rows);
+}
+
+TEST_F(GroupReaderTest, TestReadLazyColumn) {
+    auto* file = _create_file();
+    auto* param = _create_group_reader_param();
+
+    FileMetaData* file_meta;
+    Status status = _create_filemeta(&file_meta, param);
+    ASSERT_TRUE(status.ok());
+
+    auto* group_reader = _pool.add(new GroupReader(config::vector_chunk_size, file, file_meta, 0));
+
+    // The selected rows are read run by run, and the other rows are skipped.
+    {
+        MockColumnReader column_reader(tparquet::Type::type::INT32, 100);
+        vectorized::Filter filter(100, 0);
+        std::fill(filter.begin() + 10, filter.begin() + 50, 1);
+        std::fill(filter.begin() + 80, filter.end(), 1);
+        auto column = vectorized::ColumnHelper::create_column(TypeDescriptor::from_primtive_type(TYPE_INT), true);
+        status = group_reader->_read_lazy_column(&column_reader, filter, 60, column.get());
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(60, column->size());
+        for (size_t i = 0; i < 40; i++) {
+            ASSERT_EQ(static_cast<int32_t>(10 + i), column->get(i).get_int32());
+        }
+        for (size_t i = 0; i < 20; i++) {
+            ASSERT_EQ(static_cast<int32_t>(80 + i), column->get(40 + i).get_int32());
+        }
+        ASSERT_EQ(100, column_reader._next_row);
+    }
+
+    // A fragmented filter is applied after all the rows are read.
+    {
+        MockColumnReader column_reader(tparquet::Type::type::INT32);
+        vectorized::Filter filter(12, 0);
+        for (size_t i = 0; i < 12; i += 2) {
+            filter[i] = 1;
+        }
+        auto column = vectorized::ColumnHelper::create_column(TypeDescriptor::from_primtive_type(TYPE_INT), true);
+        status = group_reader->_read_lazy_column(&column_reader, filter, 6, column.get());
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(6, column->size());
+        for (size_t i = 0; i < 6; i++) {
+            ASSERT_EQ(static_cast<int32_t>(2 * i), column->get(i).get_int32());
+        }
+    }
+
+    // Nothing is read if no row is selected.
+    {
+        MockColumnReader column_reader(tparquet::Type::type::INT32);
+        vectorized::Filter filter(12, 0);
+        auto column = vectorized::ColumnHelper::create_column(TypeDescriptor::from_primtive_type(TYPE_INT), true);
+        status = group_reader->_read_lazy_column(&column_reader, filter, 0, column.get());
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(0, column->size());
+        ASSERT_EQ(12, column_reader._next_row);
+    }
+}
+
 } // namespace starrocks::parquet
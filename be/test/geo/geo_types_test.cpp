@@ -116,6 +116,12 @@ TEST_F(GeoTypesTest, polygon_contains) {
         auto res = polygon->contains(&point);
         ASSERT_FALSE(res);
     }
+    {
+        // far away from the polygon, rejected by its bounding cap.
+        GeoPoint point;
+        point.from_coord(-170, -60);
+        ASSERT_FALSE(polygon->contains(&point));
+    }
 
     std::string buf;
     polygon->encode_to(&buf);
@@ -124,6 +130,12 @@ TEST_F(GeoTypesTest, polygon_contains) {
         std::unique_ptr<GeoShape> shape(GeoShape::from_encoded(buf.data(), buf.size()));
         ASSERT_EQ(GEO_SHAPE_POLYGON, shape->type());
         LOG(INFO) << "polygon=" << shape->as_wkt();
+
+        GeoPoint point;
+        point.from_coord(20, 20);
+        ASSERT_TRUE(shape->contains(&point));
+        point.from_coord(-170, -60);
+        ASSERT_FALSE(shape->contains(&point));
     }
 
     {
@@ -23,6 +23,7 @@
 
 #include <gtest/gtest.h>
 
+#include "common/config.h"
 #include "http/http_channel.h"
 #include "http/http_request.h"
 #include "http/http_response.h"
@@ -71,6 +72,26 @@ TEST_F(MetricsActionTest, prometheus_output) {
     action.handle(&request);
 }
 
+TEST_F(MetricsActionTest, prometheus_histogram) {
+    MetricRegistry registry("test");
+    HistogramMetric latency(MetricUnit::MICROSECONDS);
+    latency.add(3);
+    latency.add(100);
+    registry.register_metric("latency_us", MetricLabels().add("disk", "/data1"), &latency);
+    std::string expect = "# TYPE test_latency_us histogram\n";
+    for (int i = 0; i < HistogramMetric::kNumBuckets; ++i) {
+        std::string le = i + 1 < HistogramMetric::kNumBuckets ? std::to_string(int64_t(1) << i) : "+Inf";
+        int count = (i >= 2) + (i >= 7);
+        expect += "test_latency_us_bucket{disk=\"/data1\",le=\"" + le + "\"} " + std::to_string(count) + "\n";
+    }
+    expect += "test_latency_us_sum{disk=\"/data1\"} 103\n";
+    expect += "test_latency_us_count{disk=\"/data1\"} 2\n";
+    s_expect_response = expect.c_str();
+    HttpRequest request(_evhttp_req);
+    MetricsAction action(&registry);
+    action.handle(&request);
+}
+
 TEST_F(MetricsActionTest, prometheus_no_prefix) {
     MetricRegistry registry("");
     IntGauge cpu_idle(MetricUnit::PERCENT);
@@ -95,6 +116,32 @@ TEST_F(MetricsActionTest, prometheus_no_name) {
     action.handle(&request);
 }
 
+TEST_F(MetricsActionTest, prometheus_cached) {
+    int32_t old_ttl = config::metrics_cache_ttl_ms;
+    MetricRegistry registry("test");
+    IntGauge cpu_idle(MetricUnit::PERCENT);
+    cpu_idle.set_value(50);
+    registry.register_metric("cpu_idle", &cpu_idle);
+    MetricsAction action(&registry);
+    HttpRequest request(_evhttp_req);
+
+    config::metrics_cache_ttl_ms = 3600 * 1000;
+    s_expect_response =
+            "# TYPE test_cpu_idle gauge\n"
+            "test_cpu_idle 50\n";
+    action.handle(&request);
+    // the cached output is returned
+    cpu_idle.set_value(60);
+    action.handle(&request);
+
+    config::metrics_cache_ttl_ms = 0;
+    s_expect_response =
+            "# TYPE test_cpu_idle gauge\n"
+            "test_cpu_idle 60\n";
+    action.handle(&request);
+    config::metrics_cache_ttl_ms = old_ttl;
+}
+
 } // namespace starrocks
 
 int main(int argc, char** argv) {
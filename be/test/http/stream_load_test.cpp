@@ -26,12 +26,16 @@
 #include <gtest/gtest.h>
 #include <rapidjson/document.h>
 
+#include <mutex>
+#include <thread>
+
 #include "gen_cpp/FrontendService_types.h"
 #include "gen_cpp/HeartbeatService_types.h"
 #include "http/http_channel.h"
 #include "http/http_request.h"
 #include "runtime/exec_env.h"
 #include "runtime/stream_load/load_stream_mgr.h"
+#include "runtime/stream_load/stream_load_context.h"
 #include "runtime/stream_load/stream_load_executor.h"
 #include "runtime/thread_resource_mgr.h"
 #include "util/brpc_stub_cache.h"
@@ -41,6 +45,7 @@ class mg_connection;
 
 namespace starrocks {
 
+static std::mutex k_response_lock;
 static std::string k_response_str;
 
 // Send Unauthorized status with basic challenge
@@ -51,6 +56,7 @@ void HttpChannel::send_error(HttpRequest* request, HttpStatus status) {}
 void HttpChannel::send_reply(HttpRequest* request, HttpStatus status) {}
 
 void HttpChannel::send_reply(HttpRequest* request, HttpStatus status, const std::string& content) {
+    std::lock_guard l(k_response_lock);
     k_response_str = content;
 }
 
@@ -267,4 +273,102 @@ TEST_F(StreamLoadActionTest, plan_fail) {
     ASSERT_STREQ("Fail", doc["Status"].GetString());
 }
 
+TEST_F(StreamLoadActionTest, group_commit) {
+    config::stream_load_group_commit_interval_ms = 500;
+    k_stream_load_begin_result.txnId = 1000;
+    StreamLoadAction action(&_env);
+
+    const int kNumLoads = 4;
+    std::vector<std::string> labels(kNumLoads);
+    std::vector<int64_t> txn_ids(kNumLoads);
+    std::vector<Status> statuses(kNumLoads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kNumLoads; i++) {
+        threads.emplace_back([&, i] {
+            HttpRequest request(evhttp_request_new(nullptr, nullptr));
+            struct evhttp_request ev_req;
+            ev_req.remote_host = nullptr;
+            evhttp_request* origin_ev_req = request._ev_req;
+            request._ev_req = &ev_req;
+            request._headers.emplace(HttpHeaders::AUTHORIZATION, "Basic cm9vdDo=");
+            request._headers.emplace(HttpHeaders::CONTENT_LENGTH, "0");
+            request._headers.emplace(HTTP_GROUP_COMMIT, "true");
+            request.set_handler(&action);
+            action.on_header(&request);
+            action.handle(&request);
+
+            auto* ctx = (StreamLoadContext*)request.handler_ctx();
+            labels[i] = ctx->label;
+            txn_ids[i] = ctx->txn_id;
+            statuses[i] = ctx->status;
+            evhttp_request_free(origin_ev_req);
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    // all the loads are committed in the transaction of the group
+    for (int i = 0; i < kNumLoads; i++) {
+        ASSERT_TRUE(statuses[i].ok()) << statuses[i].to_string();
+        ASSERT_EQ(0, labels[i].find("group_commit_"));
+        ASSERT_EQ(labels[0], labels[i]);
+        ASSERT_EQ(1000, txn_ids[i]);
+    }
+}
+
+TEST_F(StreamLoadActionTest, group_commit_fail) {
+    config::stream_load_group_commit_interval_ms = 10;
+    StreamLoadAction action(&_env);
+
+    HttpRequest request(_evhttp_req);
+    struct evhttp_request ev_req;
+    ev_req.remote_host = nullptr;
+    request._ev_req = &ev_req;
+    request._headers.emplace(HttpHeaders::AUTHORIZATION, "Basic cm9vdDo=");
+    request._headers.emplace(HttpHeaders::CONTENT_LENGTH, "0");
+    request._headers.emplace(HTTP_GROUP_COMMIT, "true");
+    k_stream_load_plan_status = Status::InternalError("TestFail");
+    request.set_handler(&action);
+    action.on_header(&request);
+    action.handle(&request);
+
+    rapidjson::Document doc;
+    doc.Parse(k_response_str.c_str());
+    ASSERT_STREQ("Fail", doc["Status"].GetString());
+}
+
+TEST_F(StreamLoadActionTest, group_commit_fallback) {
+    StreamLoadAction action(&_env);
+    {
+        // the label of a group commit load is generated by the group
+        HttpRequest request(_evhttp_req);
+        request._headers.emplace(HttpHeaders::AUTHORIZATION, "Basic cm9vdDo=");
+        request._headers.emplace(HttpHeaders::CONTENT_LENGTH, "0");
+        request._headers.emplace(HTTP_GROUP_COMMIT, "true");
+        request._headers.emplace(HTTP_LABEL_KEY, "label1");
+        request.set_handler(&action);
+        ASSERT_EQ(-1, action.on_header(&request));
+    }
+    {
+        // the json loads are loaded in their own transactions
+        HttpRequest request(evhttp_request_new(nullptr, nullptr));
+        struct evhttp_request ev_req;
+        ev_req.remote_host = nullptr;
+        evhttp_request* origin_ev_req = request._ev_req;
+        request._ev_req = &ev_req;
+        request._headers.emplace(HttpHeaders::AUTHORIZATION, "Basic cm9vdDo=");
+        request._headers.emplace(HttpHeaders::CONTENT_LENGTH, "0");
+        request._headers.emplace(HTTP_GROUP_COMMIT, "true");
+        request._headers.emplace(HTTP_FORMAT_KEY, "json");
+        request.set_handler(&action);
+        action.on_header(&request);
+        action.handle(&request);
+
+        auto* ctx = (StreamLoadContext*)request.handler_ctx();
+        ASSERT_TRUE(ctx->status.ok());
+        ASSERT_FALSE(ctx->group_commit);
+        evhttp_request_free(origin_ev_req);
+    }
+}
+
 } // namespace starrocks
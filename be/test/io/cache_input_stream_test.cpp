@@ -0,0 +1,114 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "io/cache_input_stream.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "io/array_input_stream.h"
+#include "util/file_utils.h"
+
+namespace starrocks::io {
+
+class CacheInputStreamTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(FileUtils::remove_all(kDir).ok());
+        for (int i = 0; i < 1000; i++) {
+            _data += static_cast<char>('a' + i % 26);
+        }
+    }
+
+    void TearDown() override { ASSERT_TRUE(FileUtils::remove_all(kDir).ok()); }
+
+    std::shared_ptr<SeekableInputStream> new_stream() {
+        return std::make_shared<ArrayInputStream>(_data.data(), _data.size());
+    }
+
+    static constexpr const char* kDir = "./ut_dir/block_cache_test";
+    std::string _data;
+};
+
+// NOLINTNEXTLINE
+TEST_F(CacheInputStreamTest, test_read) {
+    // 2 directories of 3 blocks of 100 bytes.
+    BlockCache cache({std::string(kDir) + "/0", std::string(kDir) + "/1"}, 300, 100);
+    ASSERT_TRUE(cache.init().ok());
+    ASSERT_EQ(600, cache.capacity());
+    auto file_id = BlockCache::file_id("hdfs://path/to/file", 1, _data.size());
+
+    CacheInputStream stream(new_stream(), &cache, file_id);
+    std::string buf(250, '\0');
+    ASSERT_TRUE(stream.read_at_fully(50, buf.data(), 250).ok());
+    ASSERT_EQ(_data.substr(50, 250), buf);
+    cache.wait_for_writes();
+    // Blocks 0, 1 and 2 are cached as a whole.
+    ASSERT_EQ(300, cache.used_bytes());
+
+    CacheInputStream cached_stream(new_stream(), &cache, file_id);
+    ASSERT_TRUE(cached_stream.read_at_fully(0, buf.data(), 250).ok());
+    ASSERT_EQ(_data.substr(0, 250), buf);
+    auto statistics = cached_stream.get_numeric_statistics().value();
+    ASSERT_EQ(2, statistics->size());
+    ASSERT_EQ("BlockCacheHitBytes", statistics->name(0));
+    ASSERT_EQ(250, statistics->value(0));
+    ASSERT_EQ(0, statistics->value(1));
+
+    // Another version of the file doesn't hit.
+    CacheInputStream new_version_stream(new_stream(), &cache, BlockCache::file_id("hdfs://path/to/file", 2, 1000));
+    ASSERT_TRUE(new_version_stream.read_at_fully(0, buf.data(), 100).ok());
+    statistics = new_version_stream.get_numeric_statistics().value();
+    ASSERT_EQ(0, statistics->value(0));
+    ASSERT_EQ(100, statistics->value(1));
+}
+
+// NOLINTNEXTLINE
+TEST_F(CacheInputStreamTest, test_evict) {
+    BlockCache cache({kDir}, 200, 100);
+    ASSERT_TRUE(cache.init().ok());
+    auto file_id = BlockCache::file_id("hdfs://path/to/file", 1, _data.size());
+
+    CacheInputStream stream(new_stream(), &cache, file_id);
+    char c;
+    for (int block : {0, 1, 0, 2}) {
+        ASSERT_TRUE(stream.read_at_fully(block * 100, &c, 1).ok());
+        ASSERT_EQ(_data[block * 100], c);
+        cache.wait_for_writes();
+    }
+    // Block 1 is the least recently used one, which is evicted by block 2.
+    ASSERT_EQ(200, cache.used_bytes());
+    ASSERT_TRUE(cache.read(file_id, 0, 0, &c, 1).ok());
+    ASSERT_TRUE(cache.read(file_id, 1, 0, &c, 1).is_not_found());
+    ASSERT_TRUE(cache.read(file_id, 2, 0, &c, 1).ok());
+}
+
+// NOLINTNEXTLINE
+TEST_F(CacheInputStreamTest, test_read_sequentially) {
+    BlockCache cache({kDir}, 1000, 64);
+    ASSERT_TRUE(cache.init().ok());
+    CacheInputStream stream(new_stream(), &cache, BlockCache::file_id("hdfs://path/to/file", 1, _data.size()));
+    std::string buf(300, '\0');
+    ASSERT_EQ(300, stream.read(buf.data(), 300).value());
+    ASSERT_EQ(300, stream.position().value());
+    ASSERT_TRUE(stream.seek(900).ok());
+    // Read until the end of the file.
+    ASSERT_EQ(100, stream.read(buf.data(), 300).value());
+    ASSERT_EQ(_data.substr(900), buf.substr(0, 100));
+    ASSERT_EQ(0, stream.read(buf.data(), 300).value());
+}
+
+// NOLINTNEXTLINE
+TEST_F(CacheInputStreamTest, test_admission) {
+    std::string tables = config::block_cache_admission_tables;
+    config::block_cache_admission_tables = "db1.t1, t2";
+    ASSERT_TRUE(BlockCache::is_admitted("db1", "t1"));
+    ASSERT_FALSE(BlockCache::is_admitted("db2", "t1"));
+    ASSERT_TRUE(BlockCache::is_admitted("db2", "t2"));
+    config::block_cache_admission_tables = "*";
+    ASSERT_TRUE(BlockCache::is_admitted("db2", "t1"));
+    config::block_cache_admission_tables = "";
+    ASSERT_FALSE(BlockCache::is_admitted("db1", "t1"));
+    config::block_cache_admission_tables = tables;
+}
+
+} // namespace starrocks::io
@@ -141,6 +141,37 @@ TEST_F(S3OutputStreamTest, test_multipart_upload) {
     delete_object(kObjectName);
 }
 
+TEST_F(S3OutputStreamTest, test_multipart_upload_parts_in_flight) {
+    const char* kObjectName = "test_multipart_upload_parts_in_flight";
+    delete_object(kObjectName);
+    const int64_t kPartSize = 5 * 1024 * 1024;
+    const int kNumParts = 6;
+    S3OutputStream os(g_s3client, kBucketName, kObjectName, kPartSize, kPartSize);
+    S3InputStream is(g_s3client, kBucketName, kObjectName);
+
+    // More parts than experimental_s3_max_upload_parts_in_flight, each filled with its part number.
+    for (int i = 0; i < kNumParts; ++i) {
+        std::string part(kPartSize, static_cast<char>('0' + i));
+        ASSERT_OK(os.write(part.data(), part.size()));
+    }
+    ASSERT_OK(os.close());
+
+    std::string buff(kPartSize, '\0');
+    for (int i = 0; i < kNumParts; ++i) {
+        int64_t nread = 0;
+        while (nread < kPartSize) {
+            ASSIGN_OR_ABORT(auto length, is.read(buff.data() + nread, kPartSize - nread));
+            ASSERT_GT(length, 0);
+            nread += length;
+        }
+        ASSERT_EQ(std::string(kPartSize, static_cast<char>('0' + i)), buff);
+    }
+    ASSIGN_OR_ABORT(auto length, is.read(buff.data(), buff.size()));
+    ASSERT_EQ(0, length);
+
+    delete_object(kObjectName);
+}
+
 TEST_F(S3OutputStreamTest, test_skip) {
     char buff[32];
     const char* kObjectName = "test_multipart_upload";
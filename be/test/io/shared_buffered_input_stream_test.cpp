@@ -0,0 +1,131 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "io/shared_buffered_input_stream.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstring>
+
+#include "util/threadpool.h"
+
+namespace starrocks::io {
+
+// A stream over a string which counts the positional reads, and is safe to read concurrently.
+class CountingInputStream final : public SeekableInputStream {
+public:
+    explicit CountingInputStream(std::string data) : _data(std::move(data)) {}
+
+    StatusOr<int64_t> read(void* data, int64_t count) override {
+        ASSIGN_OR_RETURN(int64_t nread, read_at(_offset, data, count));
+        _offset += nread;
+        return nread;
+    }
+
+    StatusOr<int64_t> read_at(int64_t offset, void* data, int64_t count) override {
+        _num_reads++;
+        count = std::min<int64_t>(count, std::max<int64_t>(0, _data.size() - offset));
+        memcpy(data, _data.data() + offset, count);
+        return count;
+    }
+
+    Status seek(int64_t position) override {
+        _offset = position;
+        return Status::OK();
+    }
+
+    StatusOr<int64_t> position() override { return _offset; }
+
+    StatusOr<int64_t> get_size() override { return _data.size(); }
+
+    int num_reads() const { return _num_reads; }
+
+private:
+    std::string _data;
+    int64_t _offset = 0;
+    std::atomic<int> _num_reads = 0;
+};
+
+class SharedBufferedInputStreamTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (int i = 0; i < 1000; i++) {
+            _data += static_cast<char>('a' + i % 26);
+        }
+        _stream = std::make_shared<CountingInputStream>(_data);
+    }
+
+    std::string _data;
+    std::shared_ptr<CountingInputStream> _stream;
+};
+
+// NOLINTNEXTLINE
+TEST_F(SharedBufferedInputStreamTest, test_coalesce) {
+    SharedBufferedInputStream stream(_stream, 10, 200);
+    stream.set_io_ranges({{300, 50}, {0, 100}, {105, 20}, {120, 30}, {500, 300}, {355, 160}});
+
+    // [0, 150) is coalesced, [300, 350) and [355, 515) are not, since the coalesced range would be too large,
+    // and [500, 800) is too large to prefetch.
+    const auto& ranges = stream.coalesced_ranges();
+    ASSERT_EQ(3, ranges.size());
+    ASSERT_EQ(0, ranges[0].offset);
+    ASSERT_EQ(150, ranges[0].size);
+    ASSERT_EQ(300, ranges[1].offset);
+    ASSERT_EQ(50, ranges[1].size);
+    ASSERT_EQ(355, ranges[2].offset);
+    ASSERT_EQ(160, ranges[2].size);
+}
+
+// NOLINTNEXTLINE
+TEST_F(SharedBufferedInputStreamTest, test_read) {
+    SharedBufferedInputStream stream(_stream, 10, 200);
+    stream.set_io_ranges({{0, 100}, {105, 20}, {500, 300}});
+    ASSERT_TRUE(stream.prefetch(nullptr).ok());
+    ASSERT_EQ(1, _stream->num_reads());
+    ASSERT_EQ(125, stream.prefetched_bytes());
+
+    // Served from memory.
+    std::string buf(100, '\0');
+    ASSERT_TRUE(stream.read_at_fully(10, buf.data(), 100).ok());
+    ASSERT_EQ(_data.substr(10, 100), buf);
+    ASSERT_TRUE(stream.seek(100).ok());
+    ASSERT_EQ(25, stream.read(buf.data(), 25).value());
+    ASSERT_EQ(_data.substr(100, 25), buf.substr(0, 25));
+    ASSERT_EQ(125, stream.position().value());
+    ASSERT_EQ(1, _stream->num_reads());
+
+    // Read from the underlying stream.
+    ASSERT_EQ(100, stream.read_at(600, buf.data(), 100).value());
+    ASSERT_EQ(_data.substr(600, 100), buf);
+    ASSERT_EQ(2, _stream->num_reads());
+    // Partially prefetched.
+    ASSERT_EQ(100, stream.read_at(100, buf.data(), 100).value());
+    ASSERT_EQ(_data.substr(100, 100), buf);
+    ASSERT_EQ(3, _stream->num_reads());
+}
+
+// NOLINTNEXTLINE
+TEST_F(SharedBufferedInputStreamTest, test_concurrent_prefetch) {
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_TRUE(ThreadPoolBuilder("prefetch").set_max_threads(4).build(&pool).ok());
+
+    SharedBufferedInputStream stream(_stream, 0, 100);
+    std::vector<SharedBufferedInputStream::IORange> ranges;
+    for (int i = 0; i < 10; i++) {
+        ranges.push_back({i * 100, 50});
+    }
+    stream.set_io_ranges(ranges);
+    ASSERT_TRUE(stream.prefetch(pool.get()).ok());
+    ASSERT_EQ(10, _stream->num_reads());
+    ASSERT_EQ(500, stream.prefetched_bytes());
+
+    std::string buf(50, '\0');
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(stream.read_at_fully(i * 100, buf.data(), 50).ok());
+        ASSERT_EQ(_data.substr(i * 100, 50), buf);
+    }
+    ASSERT_EQ(10, _stream->num_reads());
+    pool->shutdown();
+}
+
+} // namespace starrocks::io
@@ -0,0 +1,78 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/arrow_result_writer.h"
+
+#include <arrow/array.h>
+#include <arrow/io/memory.h>
+#include <arrow/ipc/reader.h>
+#include <arrow/record_batch.h>
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "exprs/expr_context.h"
+#include "exprs/vectorized/column_ref.h"
+#include "gen_cpp/InternalService_types.h"
+#include "runtime/buffer_control_block.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+class ArrowResultWriterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _exprs.push_back(new vectorized::ColumnRef(TypeDescriptor(TYPE_INT), 1));
+        _expr_ctxs.push_back(new ExprContext(_exprs.back()));
+    }
+
+    void TearDown() override {
+        for (ExprContext* ctx : _expr_ctxs) {
+            delete ctx;
+        }
+        for (Expr* expr : _exprs) {
+            delete expr;
+        }
+    }
+
+    std::vector<Expr*> _exprs;
+    std::vector<ExprContext*> _expr_ctxs;
+};
+
+// NOLINTNEXTLINE
+TEST_F(ArrowResultWriterTest, append_chunk) {
+    BufferControlBlock sinker(TUniqueId(), 1024);
+    ASSERT_TRUE(sinker.init().ok());
+    RuntimeProfile profile("ArrowResultWriterTest");
+    ArrowResultWriter writer(&sinker, _expr_ctxs, &profile);
+    ASSERT_TRUE(writer.init(nullptr).ok());
+
+    auto column = vectorized::Int32Column::create();
+    for (int i = 0; i < 100; i++) {
+        column->append(i);
+    }
+    vectorized::Chunk chunk;
+    chunk.append_column(column, 1);
+    ASSERT_TRUE(writer.append_chunk(&chunk).ok());
+    ASSERT_TRUE(writer.close().ok());
+
+    TFetchDataResult result;
+    ASSERT_TRUE(sinker.get_batch(&result).ok());
+    ASSERT_EQ(1, result.result_batch.rows.size());
+
+    const std::string& ipc = result.result_batch.rows[0];
+    arrow::io::BufferReader buffer_reader(reinterpret_cast<const uint8_t*>(ipc.data()), ipc.size());
+    auto reader = arrow::ipc::RecordBatchStreamReader::Open(&buffer_reader);
+    ASSERT_TRUE(reader.ok());
+    std::shared_ptr<arrow::RecordBatch> record_batch;
+    ASSERT_TRUE((*reader)->ReadNext(&record_batch).ok());
+    ASSERT_TRUE(record_batch != nullptr);
+    ASSERT_EQ(1, record_batch->num_columns());
+    ASSERT_EQ(100, record_batch->num_rows());
+    auto array = std::static_pointer_cast<arrow::Int32Array>(record_batch->column(0));
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(i, array->Value(i));
+    }
+}
+
+} // namespace starrocks
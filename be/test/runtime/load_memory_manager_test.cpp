@@ -0,0 +1,24 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/load_memory_manager.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+TEST(LoadMemoryManagerTest, test_pick_memtables_to_flush) {
+    // the largest are picked first
+    auto indexes = LoadMemoryManager::pick_memtables_to_flush({10, 300, 20, 200, 0, 100}, 150);
+    ASSERT_EQ((std::vector<size_t>{1, 3}), indexes);
+
+    indexes = LoadMemoryManager::pick_memtables_to_flush({10, 300, 20, 200, 0, 100}, 1000);
+    ASSERT_TRUE(indexes.empty());
+
+    // the empty ones are never picked
+    indexes = LoadMemoryManager::pick_memtables_to_flush({10, 0, 20}, 0);
+    ASSERT_EQ((std::vector<size_t>{2, 0}), indexes);
+
+    ASSERT_TRUE(LoadMemoryManager::pick_memtables_to_flush({}, 0).empty());
+}
+
+} // namespace starrocks
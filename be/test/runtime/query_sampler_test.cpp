@@ -0,0 +1,60 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "runtime/query_sampler.h"
+
+#include <gtest/gtest.h>
+
+#include <ctime>
+
+#include "runtime/current_thread.h"
+
+namespace starrocks {
+
+static void burn_cpu(clock_t duration) {
+    volatile int64_t sum = 0;
+    clock_t start = clock();
+    while (clock() - start < duration) {
+        for (int i = 0; i < 10000; ++i) {
+            sum += i;
+        }
+    }
+}
+
+TEST(QuerySamplerTest, sample) {
+    TUniqueId query_id;
+    query_id.__set_hi(1);
+    query_id.__set_lo(2);
+    TUniqueId other_query_id;
+    other_query_id.__set_hi(3);
+    other_query_id.__set_lo(4);
+    TUniqueId fragment_instance_id;
+    fragment_instance_id.__set_hi(5);
+    fragment_instance_id.__set_lo(6);
+
+    ThreadProfilingTag prev_tag = tls_profiling_tag;
+    ASSERT_FALSE(QuerySampler::start(query_id, 0).ok());
+    ASSERT_TRUE(QuerySampler::start(query_id, 1000).ok());
+    ASSERT_FALSE(QuerySampler::start(query_id, 1000).ok());
+    {
+        SCOPED_THREAD_LOCAL_PROFILING_TAG_SETTER(other_query_id, fragment_instance_id);
+        burn_cpu(CLOCKS_PER_SEC / 10);
+    }
+    {
+        SCOPED_THREAD_LOCAL_PROFILING_TAG_SETTER(query_id, fragment_instance_id);
+        tls_profiling_tag.plan_node_id = 7;
+        burn_cpu(CLOCKS_PER_SEC / 2);
+    }
+    // The tag is restored.
+    ASSERT_EQ(prev_tag.query_id_hi, tls_profiling_tag.query_id_hi);
+    ASSERT_EQ(prev_tag.plan_node_id, tls_profiling_tag.plan_node_id);
+
+    std::string stacks = QuerySampler::stop(nullptr);
+    ASSERT_FALSE(stacks.empty());
+    ASSERT_EQ(0, stacks.find("fragment_instance=" + print_id(fragment_instance_id) + ";plan_node=7;"));
+    ASSERT_EQ(std::string::npos, stacks.find("plan_node=-1"));
+
+    // Nothing is sampled after stop.
+    ASSERT_EQ("", QuerySampler::stop(nullptr));
+}
+
+} // namespace starrocks
@@ -25,6 +25,7 @@
 
 #include <thread>
 
+#include "runtime/stream_load/json_stream_load_pipe.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
 #include "util/monotime.h"
@@ -191,6 +192,26 @@ PARALLEL_TEST(StreamLoadPipeTest, append_and_flush) {
     ASSERT_TRUE(eof);
 }
 
+PARALLEL_TEST(StreamLoadPipeTest, append_and_flush_small_messages) {
+    StreamLoadPipe pipe(/*max_buffered_bytes=*/1024, /*min_chunk_size=*/1024);
+
+    for (int i = 0; i < 100; ++i) {
+        auto msg = std::to_string(i);
+        ASSERT_OK(pipe.append_and_flush(msg.data(), msg.size()));
+    }
+    pipe.finish();
+
+    std::unique_ptr<uint8_t[]> buf;
+    size_t buf_cap = 0;
+    size_t buf_sz = 0;
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_OK(pipe.read_one_message(&buf, &buf_cap, &buf_sz, 0));
+        ASSERT_EQ(std::to_string(i), std::string_view(reinterpret_cast<char*>(buf.get()), buf_sz));
+    }
+    ASSERT_OK(pipe.read_one_message(&buf, &buf_cap, &buf_sz, 0));
+    ASSERT_EQ(0, buf_sz);
+}
+
 PARALLEL_TEST(StreamLoadPipeTest, append_large_chunk) {
     StreamLoadPipe pipe(/*max_buffered_bytes=*/6, /*min_chunk_size=*/4);
 
@@ -214,4 +235,46 @@ PARALLEL_TEST(StreamLoadPipeTest, append_large_chunk) {
     producer.join();
 }
 
+static std::vector<std::string> append_json_and_read_messages(JsonStreamLoadPipe* pipe, const std::string& body,
+                                                              size_t piece_size) {
+    for (size_t pos = 0; pos < body.size(); pos += piece_size) {
+        CHECK(pipe->append(body.data() + pos, std::min(piece_size, body.size() - pos)).ok());
+    }
+    CHECK(pipe->finish().ok());
+
+    std::vector<std::string> messages;
+    std::unique_ptr<uint8_t[]> buf;
+    size_t buf_cap = 0;
+    size_t buf_sz = 0;
+    while (true) {
+        CHECK(pipe->read_one_message(&buf, &buf_cap, &buf_sz, 0).ok());
+        if (buf_sz == 0) {
+            break;
+        }
+        messages.emplace_back(reinterpret_cast<char*>(buf.get()), buf_sz);
+    }
+    return messages;
+}
+
+PARALLEL_TEST(StreamLoadPipeTest, json_outer_array) {
+    JsonStreamLoadPipe pipe(/*max_buffered_bytes=*/1024, /*min_chunk_size=*/16);
+    std::string body = R"(  [{"k": 1, "v": "a,]"}, {"k": 2, "v": "b\"}"}, {"k": 3, "v": [1, 2]}] )";
+    auto messages = append_json_and_read_messages(&pipe, body, 3);
+    ASSERT_EQ(3, messages.size());
+    ASSERT_EQ(R"([{"k": 1, "v": "a,]"}])", messages[0]);
+    ASSERT_EQ(R"([ {"k": 2, "v": "b\"}"}])", messages[1]);
+    ASSERT_EQ(R"([ {"k": 3, "v": [1, 2]}])", messages[2]);
+}
+
+PARALLEL_TEST(StreamLoadPipeTest, json_value_stream) {
+    JsonStreamLoadPipe pipe(/*max_buffered_bytes=*/1024, /*min_chunk_size=*/20);
+    std::string body = "{\"k\": 1, \"v\": \"{\"}\n{\"k\": 2}\n{\"k\": 3, \"v\": {\"x\": 1}}\n{\"k\": 4";
+    auto messages = append_json_and_read_messages(&pipe, body, 5);
+    ASSERT_EQ(3, messages.size());
+    ASSERT_EQ("{\"k\": 1, \"v\": \"{\"}\n{\"k\": 2}", messages[0]);
+    ASSERT_EQ("\n{\"k\": 3, \"v\": {\"x\": 1}}", messages[1]);
+    // The incomplete value is sent as is.
+    ASSERT_EQ("\n{\"k\": 4", messages[2]);
+}
+
 } // namespace starrocks
@@ -302,4 +302,59 @@ TEST_F(SortedChunksMergerTest, three_suppliers) {
     }
 }
 
+TEST_F(SortedChunksMergerTest, three_suppliers_for_pipeline) {
+    ChunkSuppliers suppliers;
+    ChunkProbeSuppliers probe_suppliers;
+    ChunkHasSuppliers has_suppliers;
+    std::vector<ChunkPtr> chunks = {_chunk_1, _chunk_2, _chunk_3};
+    std::vector<bool> arrived(chunks.size(), false);
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        auto supplier = [](Chunk** cnk) -> Status { return Status::OK(); };
+        auto probe_supplier = [&chunks, i](Chunk** cnk) -> bool {
+            if (chunks[i] == nullptr) {
+                *cnk = nullptr;
+                return false;
+            }
+            *cnk = chunks[i]->clone_unique().release();
+            chunks[i] = nullptr;
+            return true;
+        };
+        auto has_supplier = [&arrived, i]() -> bool { return arrived[i]; };
+        suppliers.push_back(supplier);
+        probe_suppliers.push_back(probe_supplier);
+        has_suppliers.push_back(has_supplier);
+    }
+
+    SortedChunksMerger merger(_runtime_state.get(), true);
+    ASSERT_TRUE(merger.init_for_pipeline(suppliers, probe_suppliers, has_suppliers, &_sort_exprs, &_is_asc,
+                                         &_is_null_first)
+                        .ok());
+
+    // Nothing could be merged until every supplier has data.
+    arrived[0] = arrived[1] = true;
+    ASSERT_FALSE(merger.is_data_ready());
+    std::atomic<bool> eos{false};
+    bool should_exit = false;
+    ChunkPtr page;
+    ASSERT_TRUE(merger.get_next_for_pipeline(&page, &eos, &should_exit).ok());
+    ASSERT_FALSE(eos);
+    ASSERT_TRUE(should_exit);
+    ASSERT_EQ(0, page->num_rows());
+
+    arrived[2] = true;
+    ASSERT_TRUE(merger.is_data_ready());
+    std::vector<int32_t> keys;
+    while (!eos) {
+        should_exit = false;
+        ASSERT_TRUE(merger.get_next_for_pipeline(&page, &eos, &should_exit).ok());
+        ASSERT_FALSE(should_exit);
+        for (size_t i = 0; i < page->num_rows(); ++i) {
+            keys.push_back(page->get(i).get(0).get_int32());
+        }
+    }
+
+    std::vector<int32_t> permutation = {71, 70, 69, 54, 4, 56, 55, 49, 41, 16, 52, 58, 24, 12, 2, 6};
+    ASSERT_EQ(permutation, keys);
+}
+
 } // namespace starrocks::vectorized
@@ -83,4 +83,57 @@ PARALLEL_TEST(ProtobufChunkSerde, test_serde) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ProtobufChunkSerde, test_deserialize_reuse_columns) {
+    auto chunk = std::make_unique<vectorized::Chunk>(make_columns(2), make_schema(2));
+    StatusOr<ChunkPB> res = serde::ProtobufChunkSerde::serialize_without_meta(*chunk);
+    ASSERT_TRUE(res.ok()) << res.status();
+
+    ProtobufChunkMeta meta;
+    meta.slot_id_to_index[0] = 0;
+    meta.slot_id_to_index[1] = 1;
+    meta.is_nulls.resize(2, false);
+    meta.is_consts.resize(2, false);
+    meta.types.resize(2, TypeDescriptor(PrimitiveType::TYPE_INT));
+
+    ProtobufChunkDeserializer deserializer(meta);
+    vectorized::Chunk new_chunk;
+    ASSERT_TRUE(deserializer.deserialize(res->data(), &new_chunk).ok());
+    ASSERT_EQ(2, new_chunk.num_columns());
+    auto* column0 = new_chunk.get_column_by_index(0).get();
+
+    // the columns of a recycled chunk are reused, and their contents are overwritten
+    new_chunk.reset();
+    ASSERT_TRUE(deserializer.deserialize(res->data(), &new_chunk).ok());
+    ASSERT_EQ(column0, new_chunk.get_column_by_index(0).get());
+    ASSERT_EQ(chunk->num_rows(), new_chunk.num_rows());
+    for (size_t i = 0; i < chunk->columns().size(); ++i) {
+        for (size_t j = 0; j < chunk->columns()[i]->size(); ++j) {
+            ASSERT_EQ(chunk->columns()[i]->get(j).get_int32(), new_chunk.columns()[i]->get(j).get_int32());
+        }
+    }
+}
+
+// NOLINTNEXTLINE
+PARALLEL_TEST(ProtobufChunkSerde, test_serialize_data_to_external_buffer) {
+    auto chunk = std::make_unique<vectorized::Chunk>(make_columns(2), make_schema(2));
+    StatusOr<ChunkPB> res = serde::ProtobufChunkSerde::serialize(*chunk);
+    ASSERT_TRUE(res.ok()) << res.status();
+
+    // The data written to the buffer owned by the caller is the same as ChunkPB::data.
+    std::string buffer(serde::ProtobufChunkSerde::max_serialized_size(*chunk), '\0');
+    auto* begin = reinterpret_cast<uint8_t*>(buffer.data());
+    uint8_t* end = serde::ProtobufChunkSerde::serialize_data(*chunk, begin);
+    ASSERT_NE(nullptr, end);
+    ASSERT_EQ(res->serialized_size(), end - begin);
+    ASSERT_EQ(res->data(), buffer);
+
+    ChunkPB meta_pb;
+    serde::ProtobufChunkSerde::serialize_meta(*chunk, &meta_pb);
+    ASSERT_EQ(res->slot_id_map_size(), meta_pb.slot_id_map_size());
+    ASSERT_EQ(res->is_nulls_size(), meta_pb.is_nulls_size());
+    ASSERT_EQ(res->is_consts_size(), meta_pb.is_consts_size());
+    ASSERT_FALSE(meta_pb.has_data());
+}
+
 } // namespace starrocks::serde
@@ -22,6 +22,7 @@
 #include "simd/simd.h"
 
 #include "gtest/gtest.h"
+#include "simd/gather.h"
 
 namespace starrocks::vectorized {
 
@@ -76,4 +77,27 @@ TEST_F(SIMDTest, count_nonzero) {
     EXPECT_EQ(30u, SIMD::count_nonzero(numbers));
 }
 
+TEST_F(SIMDTest, gather_values) {
+    std::vector<int32_t> dict32;
+    std::vector<double> dict64;
+    for (int i = 0; i < 100; i++) {
+        dict32.emplace_back(i * 3);
+        dict64.emplace_back(i * 0.5);
+    }
+    // 37 is not a multiple of the vector width, so the tail is gathered one by one.
+    std::vector<uint32_t> indexes;
+    for (int i = 0; i < 37; i++) {
+        indexes.emplace_back((i * 7) % 100);
+    }
+
+    std::vector<int32_t> values32(indexes.size());
+    SIMDGather::gather(values32.data(), dict32.data(), indexes.data(), indexes.size());
+    std::vector<double> values64(indexes.size());
+    SIMDGather::gather(values64.data(), dict64.data(), indexes.data(), indexes.size());
+    for (size_t i = 0; i < indexes.size(); i++) {
+        EXPECT_EQ(dict32[indexes[i]], values32[i]);
+        EXPECT_EQ(dict64[indexes[i]], values64[i]);
+    }
+}
+
 } // namespace starrocks::vectorized
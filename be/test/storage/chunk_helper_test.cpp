@@ -5,6 +5,7 @@
 #include "column/binary_column.h"
 #include "column/chunk.h"
 #include "column/column.h"
+#include "column/column_pool.h"
 #include "column/field.h"
 #include "column/nullable_column.h"
 #include "column/schema.h"
@@ -226,5 +227,24 @@ TEST_F(ChunkHelperTest, NewChunkWithTuple) {
     ASSERT_EQ(chunk->get_column_by_slot_id(8)->get_name(), "binary");
 }
 
+TEST_F(ChunkHelperTest, NewChunkPooledWithSlots) {
+    auto* tuple_desc = _create_tuple_desc();
+
+    auto chunk = ChunkHelper::new_chunk_pooled(tuple_desc->slots(), 1024);
+    ASSERT_EQ(chunk->num_columns(), 9);
+    ASSERT_EQ(chunk->get_column_by_slot_id(2)->get_name(), "integral-4");
+    ASSERT_EQ(chunk->get_column_by_slot_id(7)->get_name(), "binary");
+    auto* column = chunk->get_column_by_slot_id(2).get();
+    column->append_default(10);
+    chunk.reset();
+
+    // The columns are returned to the pool and reused by the next chunk of the same slots.
+    chunk = ChunkHelper::new_chunk_pooled(tuple_desc->slots(), 1024);
+    ASSERT_EQ(column, chunk->get_column_by_slot_id(2).get());
+    ASSERT_EQ(0, chunk->get_column_by_slot_id(2)->size());
+    chunk.reset();
+    TEST_clear_all_columns_this_thread();
+}
+
 } // namespace vectorized
 } // namespace starrocks
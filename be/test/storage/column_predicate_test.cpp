@@ -1630,6 +1630,50 @@ TEST(ColumnPredicateTest, test_in) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST(ColumnPredicateTest, test_in_large_set) {
+    // The even numbers in [0, 20000), dense for the integers, and large enough to prefetch for the strings.
+    std::vector<std::string> values;
+    for (int i = 0; i < 20000; i += 2) {
+        values.emplace_back(std::to_string(i));
+    }
+    for (auto type : {OLAP_FIELD_TYPE_INT, OLAP_FIELD_TYPE_BIGINT, OLAP_FIELD_TYPE_VARCHAR}) {
+        std::unique_ptr<ColumnPredicate> p(new_column_in_predicate(get_type_info(type), 0, values));
+        auto c = ChunkHelper::column_from_field_type(type, true);
+        std::string expected;
+        for (int i = -10; i < 1000; i++) {
+            int v = i * 37;
+            if (i % 5 == 0) {
+                (void)c->append_nulls(1);
+            } else if (type == OLAP_FIELD_TYPE_INT) {
+                c->append_datum(Datum(static_cast<int32_t>(v)));
+            } else if (type == OLAP_FIELD_TYPE_BIGINT) {
+                c->append_datum(Datum(static_cast<int64_t>(v)));
+            } else {
+                std::string s = std::to_string(v);
+                c->append_datum(Datum(Slice(s)));
+            }
+            bool found = i % 5 != 0 && v >= 0 && v < 20000 && v % 2 == 0;
+            expected += expected.empty() ? "" : ",";
+            expected += found ? "1" : "0";
+        }
+
+        std::vector<uint8_t> buff(c->size());
+        p->evaluate(c.get(), buff.data(), 0, c->size());
+        ASSERT_EQ(expected, to_string(buff)) << type;
+
+        std::vector<uint16_t> sel(c->size());
+        for (uint16_t i = 0; i < sel.size(); i++) {
+            sel[i] = i;
+        }
+        uint16_t sel_size = p->evaluate_branchless(c.get(), sel.data(), sel.size());
+        ASSERT_EQ(std::count(buff.begin(), buff.end(), 1), sel_size);
+        for (uint16_t i = 0; i < sel_size; i++) {
+            ASSERT_EQ(1, buff[sel[i]]);
+        }
+    }
+}
+
 // NOLINTNEXTLINE
 TEST(ColumnPredicateTest, test_no_in) {
     {
@@ -0,0 +1,122 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/compaction_io_budget.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace starrocks {
+
+class CompactionIOBudgetTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _old_budget_mb = config::compaction_io_budget_mb_per_disk;
+        _old_ratio = config::compaction_backoff_query_latency_ratio;
+        _old_interval_sec = config::compaction_query_latency_check_interval_sec;
+    }
+
+    void TearDown() override {
+        config::compaction_io_budget_mb_per_disk = _old_budget_mb;
+        config::compaction_backoff_query_latency_ratio = _old_ratio;
+        config::compaction_query_latency_check_interval_sec = _old_interval_sec;
+    }
+
+    static constexpr int64_t kMB = 1024 * 1024;
+
+    int64_t _old_budget_mb = 0;
+    double _old_ratio = 0;
+    int32_t _old_interval_sec = 0;
+};
+
+TEST_F(CompactionIOBudgetTest, test_no_limit) {
+    config::compaction_io_budget_mb_per_disk = 0;
+    CompactionIOBudget budget;
+    budget.charge("/disk1", 1024 * kMB, 0);
+    ASSERT_TRUE(budget.can_start("/disk1", 0));
+    ASSERT_EQ(0, budget.budget_bytes_per_second());
+}
+
+TEST_F(CompactionIOBudgetTest, test_budget_of_disks) {
+    config::compaction_io_budget_mb_per_disk = 100;
+    CompactionIOBudget budget;
+    ASSERT_EQ(100 * kMB, budget.budget_bytes_per_second());
+    ASSERT_TRUE(budget.can_start("/disk1", 1000));
+    // in debt of 200MB
+    budget.charge("/disk1", 300 * kMB, 1000);
+    ASSERT_FALSE(budget.can_start("/disk1", 1000));
+    ASSERT_FALSE(budget.can_start("/disk1", 3000));
+    ASSERT_TRUE(budget.can_start("/disk1", 3001));
+    // the other disk is not affected
+    ASSERT_TRUE(budget.can_start("/disk2", 1000));
+
+    // the task read and wrote 100MB more than charged
+    budget.finish("/disk1", 300 * kMB, 200 * kMB, 200 * kMB, 2000000);
+    ASSERT_FALSE(budget.can_start("/disk1", 3900));
+    ASSERT_TRUE(budget.can_start("/disk1", 4100));
+    ASSERT_DOUBLE_EQ(200 * kMB, budget.throughput("/disk1"));
+    ASSERT_EQ(0, budget.throughput("/disk2"));
+
+    // at most one second of budget is accumulated
+    budget.charge("/disk1", 150 * kMB, 100000);
+    ASSERT_FALSE(budget.can_start("/disk1", 100000));
+
+    // the charge of a task not run is returned
+    budget.finish("/disk1", 150 * kMB, 0, 0, 0);
+    ASSERT_TRUE(budget.can_start("/disk1", 100000));
+    ASSERT_DOUBLE_EQ(200 * kMB, budget.throughput("/disk1"));
+}
+
+TEST_F(CompactionIOBudgetTest, test_backoff) {
+    config::compaction_io_budget_mb_per_disk = 100;
+    config::compaction_backoff_query_latency_ratio = 1.5;
+    CompactionIOBudget budget;
+    budget.update_query_latency(1000);
+    ASSERT_EQ(1.0, budget.backoff_factor());
+    budget.update_query_latency(1400);
+    ASSERT_EQ(1.0, budget.backoff_factor());
+
+    budget.update_query_latency(3000);
+    ASSERT_EQ(0.5, budget.backoff_factor());
+    ASSERT_EQ(50 * kMB, budget.budget_bytes_per_second());
+    for (int i = 0; i < 10; i++) {
+        budget.update_query_latency(10000);
+    }
+    ASSERT_EQ(CompactionIOBudget::kMinBackoffFactor, budget.backoff_factor());
+
+    // recover gradually
+    budget.update_query_latency(1000);
+    double factor = budget.backoff_factor();
+    ASSERT_GT(factor, CompactionIOBudget::kMinBackoffFactor);
+    ASSERT_LT(factor, 1.0);
+    for (int i = 0; i < 10; i++) {
+        budget.update_query_latency(1000);
+    }
+    ASSERT_EQ(1.0, budget.backoff_factor());
+
+    // never back off
+    config::compaction_backoff_query_latency_ratio = 0;
+    budget.update_query_latency(100000);
+    ASSERT_EQ(1.0, budget.backoff_factor());
+}
+
+TEST_F(CompactionIOBudgetTest, test_sample_query_latency) {
+    config::compaction_backoff_query_latency_ratio = 1.5;
+    config::compaction_query_latency_check_interval_sec = 10;
+    CompactionIOBudget budget;
+    budget.sample_query_latency(100, 100000, 0);
+    // 1000us per fragment
+    budget.sample_query_latency(200, 200000, 10000);
+    ASSERT_EQ(1.0, budget.backoff_factor());
+    // too early to sample
+    budget.sample_query_latency(300, 1200000, 15000);
+    ASSERT_EQ(1.0, budget.backoff_factor());
+    // 10000us per fragment
+    budget.sample_query_latency(300, 1200000, 20000);
+    ASSERT_EQ(0.5, budget.backoff_factor());
+    // no fragment
+    budget.sample_query_latency(300, 1200000, 30000);
+    ASSERT_EQ(0.5, budget.backoff_factor());
+}
+
+} // namespace starrocks
@@ -32,6 +32,7 @@
 #include "gtest/gtest.h"
 #include "storage/olap_define.h"
 #include "util/logging.h"
+#include "util/time.h"
 
 #ifndef BE_TEST
 #define BE_TEST
@@ -82,6 +83,18 @@ TEST_F(FileUtilsTest, TestCopyFile) {
     ASSERT_EQ(4194317, std::filesystem::file_size(dst_file_name));
 }
 
+TEST_F(FileUtilsTest, TestCopyFileWithSpeedLimit) {
+    std::string src_file_name = _s_test_data_path + "/speed_limit_src.txt";
+    save_string_file(src_file_name, std::string(1 << 20, 'a'));
+
+    std::string dst_file_name = _s_test_data_path + "/speed_limit_dst.txt";
+    const int64_t start_ms = MonotonicMillis();
+    // 1MB at 10MB/s takes 100ms at least.
+    ASSERT_TRUE(FileUtils::copy_file(src_file_name, dst_file_name, 10 * 1024 * 1024).ok());
+    ASSERT_GE(MonotonicMillis() - start_ms, 100);
+    ASSERT_EQ(1 << 20, std::filesystem::file_size(dst_file_name));
+}
+
 TEST_F(FileUtilsTest, TestRemove) {
     // remove_all
     ASSERT_TRUE(FileUtils::remove_all("./file_test").ok());
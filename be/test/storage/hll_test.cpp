@@ -23,6 +23,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include "util/hash_util.hpp"
 #include "util/slice.h"
 
@@ -208,4 +212,64 @@ TEST_F(TestHll, InvalidPtr) {
     }
 }
 
+TEST_F(TestHll, SparseInMemory) {
+    // Build the same registers in the full format by merging them into a full HLL value.
+    auto to_full = [](const HyperLogLog& hll) {
+        HyperLogLog full;
+        for (int i = 0; i < 64 * 1024; ++i) {
+            full.update(hash(1024 * 1024 + i));
+        }
+        std::memset(full._registers.data, 0, HLL_REGISTERS_COUNT);
+        full.merge(hll);
+        return full;
+    };
+
+    HyperLogLog sparse_hll;
+    for (int i = 0; i < 500; ++i) {
+        sparse_hll.update(hash(i));
+    }
+    ASSERT_EQ(HLL_DATA_SPARSE, sparse_hll._type);
+    ASSERT_EQ(nullptr, sparse_hll._registers.data);
+    ASSERT_TRUE(std::is_sorted(sparse_hll._sparse_registers.begin(), sparse_hll._sparse_registers.end()));
+
+    HyperLogLog full_hll = to_full(sparse_hll);
+    ASSERT_EQ(HLL_DATA_FULL, full_hll._type);
+    ASSERT_EQ(full_hll.estimate_cardinality(), sparse_hll.estimate_cardinality());
+
+    // The serialized binaries are the same as the ones of the full registers.
+    std::vector<uint8_t> sparse_buf(sparse_hll.max_serialized_size());
+    std::vector<uint8_t> full_buf(full_hll.max_serialized_size());
+    size_t sparse_len = sparse_hll.serialize(sparse_buf.data());
+    size_t full_len = full_hll.serialize(full_buf.data());
+    ASSERT_EQ(HLL_DATA_SPARSE, sparse_buf[0]);
+    ASSERT_EQ(full_len, sparse_len);
+    ASSERT_EQ(0, memcmp(sparse_buf.data(), full_buf.data(), sparse_len));
+
+    HyperLogLog deserialized(Slice(sparse_buf.data(), sparse_len));
+    ASSERT_EQ(HLL_DATA_SPARSE, deserialized._type);
+    ASSERT_EQ(sparse_hll._sparse_registers, deserialized._sparse_registers);
+
+    // Merge two sparse values.
+    HyperLogLog other_hll;
+    for (int i = 250; i < 750; ++i) {
+        other_hll.update(hash(i));
+    }
+    ASSERT_EQ(HLL_DATA_SPARSE, other_hll._type);
+    HyperLogLog merged_hll = sparse_hll;
+    merged_hll.merge(other_hll);
+    ASSERT_EQ(HLL_DATA_SPARSE, merged_hll._type);
+    HyperLogLog merged_full_hll = to_full(sparse_hll);
+    merged_full_hll.merge(other_hll);
+    ASSERT_EQ(merged_full_hll.estimate_cardinality(), merged_hll.estimate_cardinality());
+
+    // Becomes full with too many registers.
+    for (int i = 0; i < 4096; ++i) {
+        merged_hll.update(hash(i));
+    }
+    ASSERT_EQ(HLL_DATA_FULL, merged_hll._type);
+    ASSERT_TRUE(merged_hll._sparse_registers.empty());
+    auto cardinality = merged_hll.estimate_cardinality();
+    ASSERT_TRUE(cardinality > 4000 && cardinality < 4200);
+}
+
 } // namespace starrocks
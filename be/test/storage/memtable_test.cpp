@@ -17,7 +17,9 @@
 #include "storage/rowset/rowset_writer_context.h"
 #include "storage/schema.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 #include "util/file_utils.h"
+#include "util/threadpool.h"
 
 namespace starrocks::vectorized {
 
@@ -202,8 +204,10 @@ public:
         writer_context.tablet_schema = _schema.get();
         writer_context.version.first = 10;
         writer_context.version.second = 10;
+        writer_context.parallel_pool = _parallel_pool.get();
         ASSERT_TRUE(RowsetFactory::create_rowset_writer(writer_context, &_writer).ok());
         _mem_table.reset(new MemTable(1, _schema.get(), _slots, _writer.get(), _mem_tracker.get()));
+        _mem_table->set_parallel_pool(_parallel_pool.get());
     }
 
     void TearDown() override {
@@ -217,6 +221,7 @@ public:
     unique_ptr<MemTracker> _mem_tracker;
     shared_ptr<TabletSchema> _schema;
     const std::vector<SlotDescriptor*>* _slots = nullptr;
+    unique_ptr<ThreadPool> _parallel_pool;
     unique_ptr<RowsetWriter> _writer;
     unique_ptr<MemTable> _mem_table;
 };
@@ -405,4 +410,63 @@ TEST_F(MemTableTest, testPrimaryKeysSizeLimitCompositePK) {
     ASSERT_FALSE(_mem_table->finalize().ok());
 }
 
+TEST_F(MemTableTest, testUniqKeysParallelSort) {
+    const string path = "./ut_dir/MemTableTest_testUniqKeysParallelSort";
+    auto old_rows_per_partition = config::memtable_parallel_sort_rows_per_partition;
+    auto old_append_min_rows = config::segment_writer_parallel_append_min_rows;
+    DeferOp defer([&]() {
+        config::memtable_parallel_sort_rows_per_partition = old_rows_per_partition;
+        config::segment_writer_parallel_append_min_rows = old_append_min_rows;
+    });
+    config::memtable_parallel_sort_rows_per_partition = 300;
+    config::segment_writer_parallel_append_min_rows = 100;
+    ASSERT_OK(ThreadPoolBuilder("ut_parallel").set_max_threads(4).build(&_parallel_pool));
+    MySetUp("pk int,pv int", "pk int,pv int", 1, KeysType::UNIQUE_KEYS, path);
+
+    // the row |i| has key |i % n| and value |i|
+    const size_t n = 1000;
+    shared_ptr<Chunk> chunk = ChunkHelper::new_chunk(*_slots, 2 * n);
+    for (int i = 0; i < 2 * n; i++) {
+        chunk->get_column_by_index(0)->append_datum(Datum((int32_t)(i % n)));
+        chunk->get_column_by_index(1)->append_datum(Datum((int32_t)i));
+    }
+    // insert the rows of the newer values after the older ones
+    vector<uint32_t> indexes;
+    for (int i = 0; i < 2 * n; i++) {
+        indexes.emplace_back(i);
+    }
+    std::random_shuffle(indexes.begin(), indexes.begin() + n);
+    std::random_shuffle(indexes.begin() + n, indexes.end());
+    _mem_table->insert(*chunk, indexes.data(), 0, indexes.size());
+    ASSERT_OK(_mem_table->finalize());
+    ASSERT_OK(_mem_table->flush());
+    RowsetSharedPtr rowset = *_writer->build();
+
+    unique_ptr<Schema> read_schema = create_schema("pk int,pv int", 1);
+    OlapReaderStatistics stats;
+    vectorized::RowsetReadOptions rs_opts;
+    rs_opts.sorted = false;
+    rs_opts.use_page_cache = false;
+    rs_opts.stats = &stats;
+    auto itr = rowset->new_iterator(*read_schema, rs_opts);
+    ASSERT_TRUE(itr.ok()) << itr.status().to_string();
+    auto read_chunk = ChunkHelper::new_chunk(*read_schema, 4096);
+    int expected_key = 0;
+    while (true) {
+        Status st = (*itr)->get_next(read_chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(st);
+        for (size_t i = 0; i < read_chunk->num_rows(); i++) {
+            ASSERT_EQ(expected_key, read_chunk->get_column_by_index(0)->get(i).get_int32());
+            // the replace aggregation keeps the newest value
+            ASSERT_EQ(expected_key + n, read_chunk->get_column_by_index(1)->get(i).get_int32());
+            expected_key++;
+        }
+        read_chunk->reset();
+    }
+    ASSERT_EQ(n, expected_key);
+}
+
 } // namespace starrocks::vectorized
@@ -115,6 +115,59 @@ TEST_F(MergeIteratorTest, heap_merge_no_overlapping) {
     ASSERT_TRUE(iter->get_next(chunk.get()).is_end_of_file());
 }
 
+// NOLINTNEXTLINE
+TEST_F(MergeIteratorTest, heap_merge_runs) {
+    // long runs, interleaved rows and equal keys across children, split into small chunks.
+    std::vector<std::vector<int32_t>> inputs(3);
+    for (int32_t i = 0; i < 100; i++) {
+        inputs[0].push_back(i);
+    }
+    for (int32_t i = 50; i < 60; i++) {
+        inputs[1].push_back(i);
+        inputs[1].push_back(i);
+    }
+    for (int32_t i = 90; i < 200; i += 3) {
+        inputs[1].push_back(i);
+    }
+    for (int32_t i = 0; i < 300; i += 7) {
+        inputs[2].push_back(i);
+    }
+
+    std::vector<ChunkIteratorPtr> children;
+    std::vector<std::pair<int32_t, uint16_t>> expected;
+    for (uint16_t i = 0; i < inputs.size(); i++) {
+        auto sub = std::make_shared<VectorChunkIterator>(_schema, COL_INT(inputs[i]));
+        sub->chunk_size(7);
+        children.emplace_back(sub);
+        for (int32_t v : inputs[i]) {
+            expected.emplace_back(v, i);
+        }
+    }
+    // rows with the same key are ordered by their children.
+    std::sort(expected.begin(), expected.end());
+
+    auto iter = new_heap_merge_iterator(children);
+    iter->init_encoded_schema(EMPTY_GLOBAL_DICTMAPS);
+
+    std::vector<RowSourceMask> source_masks;
+    std::vector<int32_t> real;
+    ChunkPtr chunk = ChunkHelper::new_chunk(iter->schema(), config::vector_chunk_size);
+    while (iter->get_next(chunk.get(), &source_masks).ok()) {
+        ASSERT_LE(chunk->num_rows(), 7);
+        ColumnPtr& c = chunk->get_column_by_index(0);
+        for (size_t i = 0; i < c->size(); i++) {
+            real.push_back(c->get(i).get_int32());
+        }
+        chunk->reset();
+    }
+    ASSERT_EQ(expected.size(), real.size());
+    ASSERT_EQ(expected.size(), source_masks.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i].first, real[i]);
+        EXPECT_EQ(expected[i].second, source_masks[i].get_source_num());
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(MergeIteratorTest, merge_one) {
     auto sub1 = std::make_shared<VectorChunkIterator>(_schema, COL_INT({1, 1, 2, 3, 4, 5}));
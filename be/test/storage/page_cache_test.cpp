@@ -23,7 +23,9 @@
 
 #include <gtest/gtest.h>
 
+#include "common/config.h"
 #include "runtime/mem_tracker.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks {
 
@@ -94,4 +96,43 @@ TEST_F(StoragePageCacheTest, normal) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(StoragePageCacheTest, file_id) {
+    StoragePageCache cache(_mem_tracker.get(), kNumShards * 2048);
+
+    const std::string fname = "/data/0200000000000001a24d9de1c5e06a2f5a5b34afd4a0eb8f_0.dat";
+    StoragePageCache::FileId file_id = StoragePageCache::file_id(fname);
+    ASSERT_EQ(file_id, StoragePageCache::file_id(fname));
+    ASSERT_NE(file_id, StoragePageCache::file_id(fname + "1"));
+
+    const int64_t hits_before = StarRocksMetrics::instance()->page_cache_hit_total.value();
+    {
+        PageCacheHandle handle;
+        Slice data(new char[1024], 1024);
+        cache.insert(StoragePageCache::CacheKey(file_id, 4096), data, &handle, false);
+    }
+    {
+        // The key built from the file name is the same as the one built from the file id.
+        PageCacheHandle handle;
+        ASSERT_TRUE(cache.lookup(StoragePageCache::CacheKey(fname, 4096), &handle));
+        ASSERT_FALSE(cache.lookup(StoragePageCache::CacheKey(file_id, 0), &handle));
+    }
+    ASSERT_EQ(hits_before + 1, StarRocksMetrics::instance()->page_cache_hit_total.value());
+}
+
+// NOLINTNEXTLINE
+TEST_F(StoragePageCacheTest, large_scan) {
+    StoragePageCache cache(_mem_tracker.get(), 1000);
+    const double old_ratio = config::storage_page_cache_large_scan_ratio;
+
+    config::storage_page_cache_large_scan_ratio = 0.5;
+    ASSERT_FALSE(cache.is_large_scan(500));
+    ASSERT_TRUE(cache.is_large_scan(501));
+
+    config::storage_page_cache_large_scan_ratio = 0;
+    ASSERT_FALSE(cache.is_large_scan(1000000));
+
+    config::storage_page_cache_large_scan_ratio = old_ratio;
+}
+
 } // namespace starrocks
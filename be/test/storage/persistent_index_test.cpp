@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "env/env_memory.h"
 #include "storage/chunk_helper.h"
 #include "storage/fs/file_block_manager.h"
@@ -237,7 +239,7 @@ PARALLEL_TEST(PersistentIndexTest, test_mutable_flush_to_immutable) {
     // test insert
     ASSERT_TRUE(idx->insert(keys.size(), keys.data(), values.data()).ok());
 
-    ASSERT_TRUE(idx->flush_to_immutable_index(".", EditVersion(1, 1)).ok());
+    ASSERT_TRUE(idx->flush_to_immutable_index(".", EditVersion(1, 1), false).ok());
 
     std::unique_ptr<fs::ReadableBlock> rb;
     ASSIGN_OR_ABORT(auto block_mgr, fs::fs_util::block_manager("posix://"));
@@ -274,6 +276,60 @@ PARALLEL_TEST(PersistentIndexTest, test_mutable_flush_to_immutable) {
     ASSERT_TRUE(idx_loaded->check_not_exist(10, check_not_exist_keys.data()).ok());
 }
 
+PARALLEL_TEST(PersistentIndexTest, test_mutable_flush_to_immutable_tier) {
+    using Key = uint64_t;
+    int N = 200000;
+    vector<Key> keys(N);
+    vector<IndexValue> values(N);
+    for (int i = 0; i < N; i++) {
+        keys[i] = i;
+        values[i] = i * 2;
+    }
+    ASSIGN_OR_ABORT(auto idx, MutableIndex::create(sizeof(Key)));
+    ASSERT_OK(idx->insert(N / 2, keys.data(), values.data()));
+    // erase the first 1/4 keys and some keys not in the index
+    vector<Key> erase_keys;
+    for (int i = 0; i < N / 4; i++) {
+        erase_keys.emplace_back(i);
+        erase_keys.emplace_back(N + i);
+    }
+    vector<IndexValue> erase_old_values(erase_keys.size());
+    KeysInfo erase_not_found;
+    size_t num_erased = 0;
+    ASSERT_OK(idx->erase(erase_keys.size(), erase_keys.data(), erase_old_values.data(), &erase_not_found,
+                         &num_erased));
+    ASSERT_EQ(N / 4, num_erased);
+
+    // the tier file keeps the deleted keys and the bloom filters
+    ASSERT_OK(idx->flush_to_immutable_index(".", EditVersion(2, 1), true));
+    std::unique_ptr<fs::ReadableBlock> rb;
+    ASSIGN_OR_ABORT(auto block_mgr, fs::fs_util::block_manager("posix://"));
+    ASSERT_OK(block_mgr->open_block("./index.l1.2.1", &rb));
+    ASSIGN_OR_ABORT(auto idx_loaded, ImmutableIndex::load(std::move(rb)));
+    ASSERT_GT(idx_loaded->memory_usage(), 0);
+
+    KeysInfo keys_info;
+    for (size_t i = 0; i < N; i++) {
+        keys_info.key_idxes.emplace_back(i);
+        keys_info.hashes.emplace_back(key_index_hash(&keys[i], sizeof(Key)));
+    }
+    vector<IndexValue> get_values(N);
+    size_t num_found = 0;
+    KeysInfo next_level;
+    ASSERT_OK(idx_loaded->get(N, keys.data(), keys_info, get_values.data(), &num_found, &next_level));
+    ASSERT_EQ(N / 4, num_found);
+    for (size_t i = 0; i < N / 2; i++) {
+        ASSERT_EQ(i < N / 4 ? NullIndexValue : values[i], get_values[i]);
+    }
+    // only the keys never inserted or erased need to be checked in the next level
+    ASSERT_EQ(N / 2, next_level.size());
+    std::sort(next_level.key_idxes.begin(), next_level.key_idxes.end());
+    for (size_t i = 0; i < next_level.size(); i++) {
+        ASSERT_EQ(N / 2 + i, next_level.key_idxes[i]);
+    }
+    ASSERT_TRUE(FileUtils::remove("./index.l1.2.1").ok());
+}
+
 TabletSharedPtr create_tablet(int64_t tablet_id, int32_t schema_hash) {
     TCreateTabletReq request;
     request.tablet_id = tablet_id;
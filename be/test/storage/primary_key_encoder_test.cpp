@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include "column/binary_column.h"
 #include "column/chunk.h"
 #include "column/datum.h"
 #include "column/schema.h"
@@ -114,6 +115,60 @@ TEST(PrimaryKeyEncoderTest, testEncodeComposite) {
     }
 }
 
+TEST(PrimaryKeyEncoderTest, testEncodeFixedSizeComposite) {
+    auto sc = create_key_schema({OLAP_FIELD_TYPE_INT, OLAP_FIELD_TYPE_BIGINT, OLAP_FIELD_TYPE_SMALLINT,
+                                 OLAP_FIELD_TYPE_BOOL, OLAP_FIELD_TYPE_LARGEINT});
+    ASSERT_EQ(31, PrimaryKeyEncoder::get_encoded_fixed_size(*sc));
+    unique_ptr<vectorized::Column> dest;
+    PrimaryKeyEncoder::create_column(*sc, &dest);
+    const int n = 1000;
+    auto pchunk = vectorized::ChunkHelper::new_chunk(*sc, n);
+    for (int i = 0; i < n; i++) {
+        vectorized::Datum tmp;
+        tmp.set_int32(i * 2343 - 100000);
+        pchunk->columns()[0]->append_datum(tmp);
+        tmp.set_int64(-(int64_t)i * 1000000007);
+        pchunk->columns()[1]->append_datum(tmp);
+        tmp.set_int16(i % 300 - 150);
+        pchunk->columns()[2]->append_datum(tmp);
+        tmp.set_uint8(i % 2);
+        pchunk->columns()[3]->append_datum(tmp);
+        tmp.set_int128((int128_t)i << 70);
+        pchunk->columns()[4]->append_datum(tmp);
+    }
+    // encode in two batches into the same column
+    PrimaryKeyEncoder::encode(*sc, *pchunk, 0, n / 2, dest.get());
+    PrimaryKeyEncoder::encode(*sc, *pchunk, n / 2, n - n / 2, dest.get());
+    ASSERT_EQ(n, dest->size());
+    auto dchunk = pchunk->clone_empty_with_schema();
+    PrimaryKeyEncoder::decode(*sc, *dest, 0, n, dchunk.get());
+    ASSERT_EQ(n, dchunk->num_rows());
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < sc->num_key_fields(); j++) {
+            ASSERT_EQ(0, pchunk->get_column_by_index(j)->compare_at(i, i, *dchunk->get_column_by_index(j), -1))
+                    << "row " << i << " column " << j;
+        }
+    }
+
+    // the encoded keys keep the order of the composite keys
+    auto& bdest = down_cast<vectorized::BinaryColumn&>(*dest);
+    for (int i = 1; i < n; i++) {
+        int expected = pchunk->get_column_by_index(0)->compare_at(i - 1, i, *pchunk->get_column_by_index(0), -1);
+        ASSERT_EQ(expected < 0, bdest.get_slice(i - 1).compare(bdest.get_slice(i)) < 0) << "row " << i;
+    }
+
+    // the same encoding by selective
+    vector<uint32_t> indexes{999, 0, 3, 3, 500};
+    unique_ptr<vectorized::Column> sdest;
+    PrimaryKeyEncoder::create_column(*sc, &sdest);
+    PrimaryKeyEncoder::encode_selective(*sc, *pchunk, indexes.data(), indexes.size(), sdest.get());
+    ASSERT_EQ(indexes.size(), sdest->size());
+    auto& bsdest = down_cast<vectorized::BinaryColumn&>(*sdest);
+    for (int i = 0; i < indexes.size(); i++) {
+        ASSERT_EQ(bdest.get_slice(indexes[i]), bsdest.get_slice(i));
+    }
+}
+
 TEST(PrimaryKeyEncoderTest, testEncodeCompositeLimit) {
     {
         auto sc = create_key_schema(
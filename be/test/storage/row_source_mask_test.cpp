@@ -217,4 +217,41 @@ TEST_F(RowSourceMaskTest, memory_masks_with_persistence) {
     ASSERT_FALSE(buffer.has_same_source(mask.get_source_num(), 4));
 }
 
+// NOLINTNEXTLINE
+TEST_F(RowSourceMaskTest, independent_readers) {
+    for (int64_t max_memory_bytes : {1024, 1}) {
+        RowSourceMaskBuffer buffer(2, config::storage_root_path);
+        config::max_row_source_mask_memory_bytes = max_memory_bytes;
+        std::vector<RowSourceMask> source_masks;
+        source_masks.emplace_back(RowSourceMask(0, false));
+        source_masks.emplace_back(RowSourceMask(1, true));
+        ASSERT_TRUE(buffer.write(source_masks).ok());
+        source_masks.clear();
+        source_masks.emplace_back(RowSourceMask(2, false));
+        ASSERT_TRUE(buffer.write(source_masks).ok());
+        ASSERT_TRUE(buffer.flush().ok());
+
+        auto reader1 = buffer.new_reader();
+        auto reader2 = buffer.new_reader();
+        ASSERT_TRUE(reader1.ok());
+        ASSERT_TRUE(reader2.ok());
+
+        // the readers are interleaved and do not affect each other
+        std::vector<uint16_t> sources1;
+        std::vector<uint16_t> sources2;
+        for (int i = 0; i < 3; ++i) {
+            ASSERT_TRUE((*reader1)->has_remaining().value());
+            sources1.push_back((*reader1)->current().get_source_num());
+            (*reader1)->advance();
+            ASSERT_TRUE((*reader2)->has_remaining().value());
+            sources2.push_back((*reader2)->current().get_source_num());
+            (*reader2)->advance();
+        }
+        ASSERT_EQ((std::vector<uint16_t>{0, 1, 2}), sources1);
+        ASSERT_EQ((std::vector<uint16_t>{0, 1, 2}), sources2);
+        ASSERT_FALSE((*reader1)->has_remaining().value());
+        ASSERT_FALSE((*reader2)->has_remaining().value());
+    }
+}
+
 } // namespace starrocks::vectorized
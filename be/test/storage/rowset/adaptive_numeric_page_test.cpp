@@ -0,0 +1,170 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/adaptive_numeric_page.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "storage/chunk_helper.h"
+#include "storage/rowset/encoding_info.h"
+#include "storage/rowset/options.h"
+
+namespace starrocks {
+
+class AdaptiveNumericPageTest : public testing::Test {
+public:
+    // Encode |src| into a page, decode it back and return the mode of the page.
+    template <FieldType Type, class PageBuilderType, class PageDecoderType>
+    uint8_t test_encode_decode(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        PageBuilderType builder(builder_options);
+        size_t size = builder.add(reinterpret_cast<const uint8_t*>(src.data()), src.size());
+        EXPECT_EQ(src.size(), size);
+        OwnedSlice page = builder.finish()->build();
+        EXPECT_EQ(size, builder.count());
+        CppType first;
+        CppType last;
+        EXPECT_TRUE(builder.get_first_value(&first).ok());
+        EXPECT_TRUE(builder.get_last_value(&last).ok());
+        EXPECT_EQ(0, memcmp(&src.front(), &first, sizeof(CppType)));
+        EXPECT_EQ(0, memcmp(&src.back(), &last, sizeof(CppType)));
+
+        PageDecoderOptions decoder_options;
+        PageDecoderType decoder(page.slice(), decoder_options);
+        EXPECT_TRUE(decoder.init().ok());
+        EXPECT_EQ(size, decoder.count());
+
+        auto column = vectorized::ChunkHelper::column_from_field_type(Type, false);
+        size_t n = size;
+        EXPECT_TRUE(decoder.next_batch(&n, column.get()).ok());
+        EXPECT_EQ(size, n);
+        for (size_t i = 0; i < size; i++) {
+            CppType v = column->get(i).get<CppType>();
+            EXPECT_EQ(0, memcmp(&src[i], &v, sizeof(CppType))) << "Fail at index " << i;
+        }
+
+        if (size < 20) {
+            return static_cast<uint8_t>(page.slice().data[sizeof(uint32_t)]);
+        }
+        // Read some ranges after seek.
+        auto column1 = vectorized::ChunkHelper::column_from_field_type(Type, false);
+        vectorized::SparseRange range;
+        range.add(vectorized::Range(size / 3, size / 2));
+        range.add(vectorized::Range(size - 10, size));
+        EXPECT_TRUE(decoder.seek_to_position_in_page(size / 3).ok());
+        EXPECT_TRUE(decoder.next_batch(range, column1.get()).ok());
+        EXPECT_EQ(range.span_size(), column1->size());
+        size_t offset = 0;
+        vectorized::SparseRangeIterator iter = range.new_iterator();
+        while (iter.has_more()) {
+            vectorized::Range r = iter.next(size);
+            for (size_t i = r.begin(); i < r.end(); i++) {
+                CppType v = column1->get(offset++).get<CppType>();
+                EXPECT_EQ(0, memcmp(&src[i], &v, sizeof(CppType))) << "Fail at index " << i;
+            }
+        }
+        EXPECT_EQ(size, decoder.current_index());
+        return static_cast<uint8_t>(page.slice().data[sizeof(uint32_t)]);
+    }
+
+    template <FieldType Type>
+    uint8_t test_delta(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        return test_encode_decode<Type, DeltaPageBuilder<Type>, DeltaPageDecoder<Type>>(src);
+    }
+
+    template <FieldType Type>
+    uint8_t test_alp(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        return test_encode_decode<Type, AlpPageBuilder<Type>, AlpPageDecoder<Type>>(src);
+    }
+};
+
+TEST_F(AdaptiveNumericPageTest, test_delta_encoding) {
+    const size_t size = 10000;
+    // timestamps in microseconds increasing by about 1 second
+    std::vector<int64_t> timestamps(size);
+    int64_t ts = 1640995200000000L;
+    for (size_t i = 0; i < size; i++) {
+        ts += 1000000 + random() % 1000;
+        timestamps[i] = ts;
+    }
+    ASSERT_EQ(ADAPTIVE_PAGE_ENCODED, test_delta<OLAP_FIELD_TYPE_BIGINT>(timestamps));
+
+    // overflow of the deltas
+    std::vector<int64_t> extremes(size);
+    for (size_t i = 0; i < size; i++) {
+        extremes[i] = i % 2 == 0 ? std::numeric_limits<int64_t>::max() : std::numeric_limits<int64_t>::min();
+    }
+    test_delta<OLAP_FIELD_TYPE_BIGINT>(extremes);
+
+    std::vector<int32_t> sequence(size);
+    for (size_t i = 0; i < size; i++) {
+        sequence[i] = 12345 - static_cast<int32_t>(i) * 7;
+    }
+    ASSERT_EQ(ADAPTIVE_PAGE_ENCODED, test_delta<OLAP_FIELD_TYPE_INT>(sequence));
+
+    // random values are stored plainly
+    std::vector<int32_t> randoms(size);
+    for (size_t i = 0; i < size; i++) {
+        randoms[i] = static_cast<int32_t>(random()) * (i % 2 == 0 ? 1 : -1);
+    }
+    ASSERT_EQ(ADAPTIVE_PAGE_PLAIN, test_delta<OLAP_FIELD_TYPE_INT>(randoms));
+
+    test_delta<OLAP_FIELD_TYPE_INT>({1});
+    test_delta<OLAP_FIELD_TYPE_INT>({1, 2});
+}
+
+TEST_F(AdaptiveNumericPageTest, test_alp_encoding) {
+    const size_t size = 10000;
+    // prices of 2 decimal places
+    std::vector<double> prices(size);
+    for (size_t i = 0; i < size; i++) {
+        prices[i] = static_cast<double>(random() % 1000000) / 100;
+    }
+    ASSERT_EQ(ADAPTIVE_PAGE_ENCODED, test_alp<OLAP_FIELD_TYPE_DOUBLE>(prices));
+
+    // some exceptions
+    std::vector<double> with_exceptions = prices;
+    with_exceptions[1] = std::nan("");
+    with_exceptions[100] = -0.0;
+    with_exceptions[1000] = std::numeric_limits<double>::infinity();
+    with_exceptions[5000] = 1.0 / 3;
+    with_exceptions[size - 1] = 1e300;
+    ASSERT_EQ(ADAPTIVE_PAGE_ENCODED, test_alp<OLAP_FIELD_TYPE_DOUBLE>(with_exceptions));
+
+    std::vector<float> metrics(size);
+    for (size_t i = 0; i < size; i++) {
+        metrics[i] = static_cast<float>(random() % 10000) / 10;
+    }
+    ASSERT_EQ(ADAPTIVE_PAGE_ENCODED, test_alp<OLAP_FIELD_TYPE_FLOAT>(metrics));
+
+    // random doubles are stored plainly
+    std::vector<double> randoms(size);
+    for (size_t i = 0; i < size; i++) {
+        randoms[i] = static_cast<double>(random()) / random();
+    }
+    ASSERT_EQ(ADAPTIVE_PAGE_PLAIN, test_alp<OLAP_FIELD_TYPE_DOUBLE>(randoms));
+
+    test_alp<OLAP_FIELD_TYPE_DOUBLE>({1.5});
+}
+
+TEST_F(AdaptiveNumericPageTest, test_encoding_info) {
+    ASSERT_EQ(DELTA_ENCODING, EncodingInfo::get_adaptive_encoding(OLAP_FIELD_TYPE_DATETIME));
+    ASSERT_EQ(ALP_ENCODING, EncodingInfo::get_adaptive_encoding(OLAP_FIELD_TYPE_DOUBLE));
+    ASSERT_EQ(DEFAULT_ENCODING, EncodingInfo::get_adaptive_encoding(OLAP_FIELD_TYPE_VARCHAR));
+    // The default encodings are not changed.
+    ASSERT_EQ(BIT_SHUFFLE, EncodingInfo::get_default_encoding(OLAP_FIELD_TYPE_DOUBLE, false));
+
+    const EncodingInfo* info = nullptr;
+    ASSERT_TRUE(EncodingInfo::get(OLAP_FIELD_TYPE_BIGINT, DELTA_ENCODING, &info).ok());
+    ASSERT_EQ(DELTA_ENCODING, info->encoding());
+    ASSERT_TRUE(EncodingInfo::get(OLAP_FIELD_TYPE_FLOAT, ALP_ENCODING, &info).ok());
+    ASSERT_FALSE(EncodingInfo::get(OLAP_FIELD_TYPE_VARCHAR, ALP_ENCODING, &info).ok());
+}
+
+} // namespace starrocks
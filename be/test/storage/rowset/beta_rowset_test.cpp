@@ -302,6 +302,46 @@ TEST_F(BetaRowsetTest, FinalMergeTest) {
     }
 }
 
+TEST_F(BetaRowsetTest, FlushChunkOverlapTest) {
+    TabletSchema tablet_schema;
+    create_tablet_schema(&tablet_schema);
+    auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+
+    // Flushes a sorted chunk of keys [begin, end) for each range.
+    auto write_rowset = [&](int64_t rowset_id, const std::vector<std::pair<int32_t, int32_t>>& ranges) {
+        RowsetWriterContext writer_context(kDataFormatV2, kDataFormatV2);
+        create_rowset_writer_context(&tablet_schema, &writer_context);
+        writer_context.rowset_id.init(rowset_id);
+        writer_context.segments_overlap = OVERLAP_UNKNOWN;
+
+        std::unique_ptr<RowsetWriter> rowset_writer;
+        CHECK(RowsetFactory::create_rowset_writer(writer_context, &rowset_writer).ok());
+        for (const auto& [begin, end] : ranges) {
+            auto chunk = vectorized::ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+            auto& cols = chunk->columns();
+            for (int32_t i = begin; i < end; i++) {
+                cols[0]->append_datum(vectorized::Datum(i));
+                cols[1]->append_datum(vectorized::Datum(i));
+                cols[2]->append_datum(vectorized::Datum(i));
+            }
+            CHECK(rowset_writer->flush_chunk(*chunk).ok());
+        }
+        return rowset_writer->build().value();
+    };
+
+    auto rowset = write_rowset(10001, {{0, 100}, {100, 200}, {200, 300}});
+    ASSERT_EQ(3, rowset->rowset_meta()->num_segments());
+    ASSERT_EQ(NONOVERLAPPING, rowset->rowset_meta()->segments_overlap());
+
+    rowset = write_rowset(10002, {{0, 100}, {50, 150}});
+    ASSERT_EQ(2, rowset->rowset_meta()->num_segments());
+    ASSERT_EQ(OVERLAP_UNKNOWN, rowset->rowset_meta()->segments_overlap());
+
+    // The equal keys in different segments are overlapping.
+    rowset = write_rowset(10003, {{0, 100}, {99, 200}});
+    ASSERT_EQ(OVERLAP_UNKNOWN, rowset->rowset_meta()->segments_overlap());
+}
+
 TEST_F(BetaRowsetTest, VerticalWriteTest) {
     TabletSchema tablet_schema;
     create_tablet_schema(&tablet_schema);
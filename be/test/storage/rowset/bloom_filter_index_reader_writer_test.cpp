@@ -150,6 +150,19 @@ protected:
             // test nullptr
             ASSERT_TRUE(bf->test_bytes(nullptr, 1));
 
+            // segment
+            const BloomFilter* segment_bf = reader->segment_bloom_filter();
+            ASSERT_TRUE(segment_bf != nullptr);
+            for (int i = 0; i < num; ++i) {
+                if (is_slice_type) {
+                    Slice* value = (Slice*)(val + i);
+                    ASSERT_TRUE(segment_bf->test_bytes(value->data, value->size));
+                } else {
+                    ASSERT_TRUE(segment_bf->test_bytes((char*)&val[i], sizeof(CppType)));
+                }
+            }
+            ASSERT_TRUE(segment_bf->test_bytes(nullptr, 1));
+
             delete reader;
         }
     }
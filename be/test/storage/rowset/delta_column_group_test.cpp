@@ -0,0 +1,180 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/delta_column_group.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "column/chunk.h"
+#include "common/config.h"
+#include "env/env_memory.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/mem_tracker.h"
+#include "storage/chunk_helper.h"
+#include "storage/fs/file_block_manager.h"
+#include "storage/page_cache.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
+#include "storage/rowset/segment_writer.h"
+#include "storage/tablet_schema_helper.h"
+#include "testutil/assert.h"
+
+namespace starrocks::vectorized {
+
+class DeltaColumnGroupTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _env = std::make_shared<EnvMemory>();
+        _block_mgr = std::make_shared<fs::FileBlockManager>(_env, fs::BlockManagerOptions());
+        ASSERT_TRUE(_env->create_dir(kSegmentDir).ok());
+        StoragePageCache::create_global_cache(&_page_cache_mem_tracker, 1000000000);
+
+        _tablet_schema._cols.push_back(create_int_key(1));
+        _tablet_schema._cols.push_back(create_int_value(2));
+        _tablet_schema._cols.push_back(create_int_value(3));
+        _tablet_schema._num_key_columns = 1;
+        _tablet_schema._num_short_key_columns = 1;
+    }
+
+    void TearDown() override { StoragePageCache::release_global_cache(); }
+
+    // The value of column |cid| of row |rid| is `rid * 10 + cid`.
+    std::shared_ptr<Segment> build_segment(size_t num_rows) {
+        std::string file_name = strings::Substitute("$0/seg_0.dat", kSegmentDir);
+        std::unique_ptr<fs::WritableBlock> wblock;
+        fs::CreateBlockOptions block_opts({file_name});
+        EXPECT_OK(_block_mgr->create_block(block_opts, &wblock));
+        SegmentWriterOptions opts;
+        opts.num_rows_per_block = 100;
+        SegmentWriter writer(std::move(wblock), 0, &_tablet_schema, opts);
+        EXPECT_OK(writer.init());
+
+        auto schema = ChunkHelper::convert_schema_to_format_v2(_tablet_schema);
+        auto chunk = ChunkHelper::new_chunk(schema, num_rows);
+        for (rowid_t rid = 0; rid < num_rows; ++rid) {
+            for (int cid = 0; cid < 3; ++cid) {
+                chunk->get_column_by_index(cid)->append_datum(Datum((int32_t)(rid * 10 + cid)));
+            }
+        }
+        EXPECT_OK(writer.append_chunk(*chunk));
+        uint64_t file_size, index_size, footer_position;
+        EXPECT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+        auto segment = *Segment::open(&_tablet_meta_mem_tracker, _block_mgr, file_name, 0, &_tablet_schema);
+        EXPECT_EQ(num_rows, segment->num_rows());
+        return segment;
+    }
+
+    // Write the values |values| of the rows |rowids| of column 2.
+    DeltaColumnGroupPB write_dcg(const std::shared_ptr<Segment>& segment, const DeltaColumnGroupList& dcgs,
+                                 int64_t version, const std::vector<uint32_t>& rowids,
+                                 const std::vector<int32_t>& values) {
+        auto schema = ChunkHelper::convert_schema_to_format_v2(_tablet_schema, {2});
+        auto chunk = ChunkHelper::new_chunk(schema, values.size());
+        for (int32_t v : values) {
+            chunk->get_column_by_index(0)->append_datum(Datum(v));
+        }
+        DeltaColumnGroupPB dcg;
+        EXPECT_OK(DeltaColumnGroupWriter::write(_block_mgr, segment, dcgs, version, {2}, rowids, *chunk, &dcg));
+        return dcg;
+    }
+
+    // Read all the columns of |segment| overridden by |dcgs|.
+    std::vector<std::vector<int32_t>> read(const std::shared_ptr<Segment>& segment, const DeltaColumnGroupList& dcgs) {
+        OlapReaderStatistics stats;
+        SegmentReadOptions read_opts;
+        read_opts.block_mgr = _block_mgr;
+        read_opts.stats = &stats;
+        read_opts.delta_column_groups = &dcgs;
+        auto schema = ChunkHelper::convert_schema_to_format_v2(_tablet_schema);
+        auto iter = *segment->new_iterator(schema, read_opts);
+        std::vector<std::vector<int32_t>> rows;
+        auto chunk = ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+        while (true) {
+            chunk->reset();
+            Status st = iter->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            EXPECT_OK(st);
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                rows.push_back({chunk->get_column_by_index(0)->get(i).get_int32(),
+                                chunk->get_column_by_index(1)->get(i).get_int32(),
+                                chunk->get_column_by_index(2)->get(i).get_int32()});
+            }
+        }
+        iter->close();
+        return rows;
+    }
+
+    const std::string kSegmentDir = "/delta_column_group_test";
+    std::shared_ptr<EnvMemory> _env = nullptr;
+    std::shared_ptr<fs::FileBlockManager> _block_mgr = nullptr;
+    MemTracker _page_cache_mem_tracker;
+    MemTracker _tablet_meta_mem_tracker;
+    TabletSchema _tablet_schema;
+};
+
+TEST_F(DeltaColumnGroupTest, test_write_and_read) {
+    const size_t num_rows = 5000;
+    auto segment = build_segment(num_rows);
+
+    DeltaColumnGroupList dcgs;
+    auto dcg1 = write_dcg(segment, dcgs, 3, {0, 5, 4095, 4999}, {-1, -2, -3, -4});
+    ASSERT_EQ(3, dcg1.version());
+    ASSERT_EQ(1, dcg1.column_ids_size());
+    ASSERT_EQ(2, dcg1.column_ids(0));
+    ASSERT_EQ("seg_0_3.cols", dcg1.file_name());
+    ASSERT_EQ(kSegmentDir + "/seg_0_3.cols", delta_column_file_path(segment->file_name(), dcg1));
+    dcgs.insert(dcgs.begin(), dcg1);
+    ASSERT_EQ(0, find_delta_column_group(dcgs, 2));
+    ASSERT_EQ(-1, find_delta_column_group(dcgs, 1));
+
+    auto rows = read(segment, dcgs);
+    ASSERT_EQ(num_rows, rows.size());
+    for (int32_t rid = 0; rid < num_rows; rid++) {
+        ASSERT_EQ(rid * 10, rows[rid][0]);
+        ASSERT_EQ(rid * 10 + 1, rows[rid][1]);
+    }
+    ASSERT_EQ(-1, rows[0][2]);
+    ASSERT_EQ(-2, rows[5][2]);
+    ASSERT_EQ(-3, rows[4095][2]);
+    ASSERT_EQ(-4, rows[4999][2]);
+    ASSERT_EQ(62, rows[6][2]);
+
+    // the newer group keeps the values of the older one for the rows not updated
+    auto dcg2 = write_dcg(segment, dcgs, 5, {5, 6}, {-20, -30});
+    dcgs.insert(dcgs.begin(), dcg2);
+    rows = read(segment, dcgs);
+    ASSERT_EQ(num_rows, rows.size());
+    ASSERT_EQ(-1, rows[0][2]);
+    ASSERT_EQ(-20, rows[5][2]);
+    ASSERT_EQ(-30, rows[6][2]);
+    ASSERT_EQ(-4, rows[4999][2]);
+    ASSERT_EQ(72, rows[7][2]);
+
+    // the readers of the older versions are not affected
+    rows = read(segment, {dcg1});
+    ASSERT_EQ(-2, rows[5][2]);
+    ASSERT_EQ(62, rows[6][2]);
+    rows = read(segment, {});
+    ASSERT_EQ(52, rows[5][2]);
+}
+
+TEST_F(DeltaColumnGroupTest, test_invalid_rowids) {
+    auto segment = build_segment(100);
+    auto schema = ChunkHelper::convert_schema_to_format_v2(_tablet_schema, {2});
+    auto chunk = ChunkHelper::new_chunk(schema, 2);
+    chunk->get_column_by_index(0)->append_datum(Datum((int32_t)1));
+    chunk->get_column_by_index(0)->append_datum(Datum((int32_t)2));
+    DeltaColumnGroupPB dcg;
+    // not in ascending order
+    ASSERT_FALSE(DeltaColumnGroupWriter::write(_block_mgr, segment, {}, 2, {2}, {3, 1}, *chunk, &dcg).ok());
+    // out of range
+    ASSERT_FALSE(DeltaColumnGroupWriter::write(_block_mgr, segment, {}, 2, {2}, {1, 100}, *chunk, &dcg).ok());
+    // mismatched number of rows
+    ASSERT_FALSE(DeltaColumnGroupWriter::write(_block_mgr, segment, {}, 2, {2}, {1}, *chunk, &dcg).ok());
+}
+
+} // namespace starrocks::vectorized
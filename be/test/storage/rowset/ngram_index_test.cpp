@@ -0,0 +1,88 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/ngram_index.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "env/env_memory.h"
+#include "runtime/mem_tracker.h"
+#include "storage/fs/file_block_manager.h"
+#include "storage/page_cache.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+class NGramIndexTest : public testing::Test {
+public:
+    const std::string kTestDir = "/ngram_index_test";
+
+protected:
+    void SetUp() override {
+        StoragePageCache::create_global_cache(&_tracker, 1000000000);
+        _env = std::make_shared<EnvMemory>();
+        _block_mgr = std::make_shared<fs::FileBlockManager>(_env, fs::BlockManagerOptions());
+        ASSERT_TRUE(_env->create_dir(kTestDir).ok());
+    }
+    void TearDown() override { StoragePageCache::release_global_cache(); }
+
+    void write_index_file(const std::string& file_name, const std::vector<std::string>& values, size_t null_count,
+                          ColumnIndexMetaPB* meta) {
+        std::unique_ptr<fs::WritableBlock> wblock;
+        fs::CreateBlockOptions opts({file_name});
+        ASSERT_TRUE(_block_mgr->create_block(opts, &wblock).ok());
+
+        NGramIndexWriter writer(3);
+        std::vector<Slice> slices(values.begin(), values.end());
+        writer.add_nulls(null_count);
+        writer.add_values(slices.data(), slices.size());
+        ASSERT_GT(writer.size(), 0);
+        ASSERT_TRUE(writer.finish(wblock.get(), meta).ok());
+        ASSERT_EQ(NGRAM_INDEX, meta->type());
+        ASSERT_EQ(3, meta->ngram_index().gram_size());
+        ASSERT_TRUE(wblock->close().ok());
+    }
+
+    std::shared_ptr<EnvMemory> _env = nullptr;
+    std::shared_ptr<fs::FileBlockManager> _block_mgr = nullptr;
+    MemTracker _tracker;
+};
+
+TEST_F(NGramIndexTest, test_filter) {
+    std::string file_name = kTestDir + "/filter";
+    // The first 2 rows are null.
+    std::vector<std::string> values{"starrocks", "rocksdb", "abcabcabc", "ab", "", "rockstar"};
+    ColumnIndexMetaPB meta;
+    write_index_file(file_name, values, 2, &meta);
+
+    NGramIndexReader reader;
+    ASSERT_TRUE(reader.load(_block_mgr.get(), file_name, &meta.ngram_index(), true, false).ok());
+    ASSERT_EQ(3, reader.gram_size());
+
+    auto filter = [&](const std::vector<std::string>& substrings, bool* filtered) {
+        Roaring rows;
+        EXPECT_TRUE(reader.filter(substrings, &rows, filtered).ok());
+        return rows;
+    };
+
+    bool filtered = false;
+    ASSERT_EQ(Roaring::bitmapOf(3, 2, 3, 7), filter({"rocks"}, &filtered));
+    ASSERT_TRUE(filtered);
+    ASSERT_EQ(Roaring::bitmapOf(2, 2, 7), filter({"star", "rock"}, &filtered));
+    ASSERT_EQ(Roaring::bitmapOf(1, 4), filter({"cab"}, &filtered));
+    // Some grams do not exist.
+    ASSERT_TRUE(filter({"stars"}, &filtered).isEmpty());
+    ASSERT_TRUE(filter({"rockx"}, &filtered).isEmpty());
+    ASSERT_TRUE(filtered);
+    ASSERT_TRUE(filter({"zzz"}, &filtered).isEmpty());
+
+    // The substrings shorter than the gram size cannot be looked up.
+    Roaring rows = Roaring::bitmapOf(1, 100);
+    ASSERT_TRUE(reader.filter({"ab", "x"}, &rows, &filtered).ok());
+    ASSERT_FALSE(filtered);
+    ASSERT_EQ(Roaring::bitmapOf(1, 100), rows);
+}
+
+} // namespace starrocks
@@ -0,0 +1,150 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/readahead_block.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/fs/block_id.h"
+#include "storage/olap_common.h"
+#include "util/priority_thread_pool.hpp"
+
+namespace starrocks {
+
+// A block of the in-memory |_data|, which counts the reads and the hints.
+class MemoryReadableBlock final : public fs::ReadableBlock {
+public:
+    explicit MemoryReadableBlock(std::string data) : _data(std::move(data)) {}
+
+    const fs::BlockId& id() const override { return _id; }
+    const std::string& path() const override { return _path; }
+    Status close() override { return Status::OK(); }
+    fs::BlockManager* block_manager() const override { return nullptr; }
+    Status size(uint64_t* sz) override {
+        *sz = _data.size();
+        return Status::OK();
+    }
+    Status read(uint64_t offset, Slice result) override {
+        _num_reads++;
+        if (offset + result.size > _data.size()) {
+            return Status::IOError("read out of range");
+        }
+        memcpy(result.data, _data.data() + offset, result.size);
+        return Status::OK();
+    }
+
+    void will_need(uint64_t offset, uint64_t size) override {
+        _num_hints++;
+        _hinted_bytes += size;
+    }
+
+    int64_t num_reads() const { return _num_reads; }
+    int64_t num_hints() const { return _num_hints; }
+    int64_t hinted_bytes() const { return _hinted_bytes; }
+
+private:
+    const std::string _data;
+    const fs::BlockId _id;
+    const std::string _path = "memory_block";
+    std::atomic<int64_t> _num_reads = 0;
+    std::atomic<int64_t> _num_hints = 0;
+    std::atomic<int64_t> _hinted_bytes = 0;
+};
+
+class ReadaheadBlockTest : public testing::Test {
+public:
+    void SetUp() override {
+        _data.resize(kNumPages * kPageSize);
+        for (size_t i = 0; i < _data.size(); ++i) {
+            _data[i] = static_cast<char>(i * 7 + i / kPageSize);
+        }
+        _block = std::make_unique<MemoryReadableBlock>(_data);
+        // The pages of two columns interleave in the file.
+        for (size_t i = 0; i < kNumPages / 2; ++i) {
+            _pages.emplace_back(i * kPageSize, kPageSize);
+            _pages.emplace_back((i + kNumPages / 2) * kPageSize, kPageSize);
+        }
+    }
+
+protected:
+    void _read_and_check(ReadaheadBlock* block, const PagePointer& page) {
+        std::string buf(page.size, '\0');
+        ASSERT_TRUE(block->read(page.offset, Slice(buf.data(), buf.size())).ok());
+        ASSERT_EQ(_data.substr(page.offset, page.size), buf);
+    }
+
+    static constexpr size_t kNumPages = 64;
+    // Large enough for the gap between the pages of two columns not to be coalesced.
+    static constexpr size_t kPageSize = 64 * 1024;
+
+    std::string _data;
+    std::unique_ptr<MemoryReadableBlock> _block;
+    std::vector<PagePointer> _pages;
+    OlapReaderStatistics _stats;
+};
+
+TEST_F(ReadaheadBlockTest, test_coalesce) {
+    ReadaheadBlock block(_block.get(), 16 * kPageSize, nullptr, &_stats);
+    block.set_pages(_pages);
+    for (const auto& page : _pages) {
+        _read_and_check(&block, page);
+    }
+    // Each window of 16 pages contains two contiguous runs of pages, which are too far from each other
+    // to be coalesced.
+    ASSERT_EQ(kNumPages / 16 * 2, _block->num_reads());
+    ASSERT_EQ(kNumPages, _stats.readahead_pages);
+    ASSERT_EQ(kNumPages * kPageSize, _stats.readahead_bytes);
+    // The ranges of every window but the first one, which is read at once, are hinted before read.
+    ASSERT_EQ((kNumPages / 16 - 1) * 2, _block->num_hints());
+    ASSERT_EQ((kNumPages - 16) * kPageSize, _block->hinted_bytes());
+}
+
+TEST_F(ReadaheadBlockTest, test_skip_and_unplanned) {
+    ReadaheadBlock block(_block.get(), 4 * kPageSize, nullptr, &_stats);
+    block.set_pages(_pages);
+
+    _read_and_check(&block, _pages[0]);
+    // Skip some pages, the readahead restarts from the page read.
+    _read_and_check(&block, _pages[20]);
+    _read_and_check(&block, _pages[21]);
+    // Going back is also fine.
+    _read_and_check(&block, _pages[1]);
+    const int64_t num_reads = _block->num_reads();
+
+    // A read not planned is passed through.
+    std::string buf(100, '\0');
+    const uint64_t offset = 50 * kPageSize + kPageSize / 2;
+    ASSERT_TRUE(block.read(offset, Slice(buf.data(), buf.size())).ok());
+    ASSERT_EQ(_data.substr(offset, buf.size()), buf);
+    ASSERT_EQ(num_reads + 1, _block->num_reads());
+
+    // A read out of range fails.
+    ASSERT_FALSE(block.read(_data.size() - 10, Slice(buf.data(), buf.size())).ok());
+}
+
+TEST_F(ReadaheadBlockTest, test_async) {
+    PriorityThreadPool pool("readahead_test", 2, 16);
+    {
+        ReadaheadBlock block(_block.get(), 8 * kPageSize, &pool, &_stats);
+        block.set_pages(_pages);
+        for (const auto& page : _pages) {
+            _read_and_check(&block, page);
+        }
+        ASSERT_EQ(kNumPages, _stats.readahead_pages);
+    }
+    {
+        // Destroy the block while the windows are being loaded.
+        ReadaheadBlock block(_block.get(), 8 * kPageSize, &pool, &_stats);
+        block.set_pages(_pages);
+        _read_and_check(&block, _pages[0]);
+    }
+    pool.shutdown();
+    pool.join();
+}
+
+} // namespace starrocks
@@ -0,0 +1,292 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <string>
+
+#include "column/chunk.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "env/env_memory.h"
+#include "fmt/format.h"
+#include "runtime/mem_tracker.h"
+#include "storage/chunk_helper.h"
+#include "storage/chunk_iterator.h"
+#include "storage/fs/file_block_manager.h"
+#include "storage/olap_common.h"
+#include "storage/page_cache.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_iterator.h"
+#include "storage/rowset/segment_options.h"
+#include "storage/rowset/segment_writer.h"
+#include "storage/tablet_schema.h"
+#include "storage/vectorized_column_predicate.h"
+
+// Benchmarks of writing and reading a segment of synthetic data, with the encodings chosen by default for the
+// column types. The segment has a sorted BIGINT key column and a value column of the benchmarked type, whose
+// values are parameterized by the cardinality and the sortedness.
+namespace starrocks {
+
+static constexpr size_t kSegmentBenchRows = 1 << 20;
+static constexpr size_t kSegmentBenchChunkSize = 4096;
+
+enum SegmentBenchIndex { kNoIndex, kBloomFilterIndex, kBitmapIndex };
+
+enum SegmentBenchScan {
+    kFullScan,
+    // v < the 1% smallest value, pruned by the zone maps if the values are sorted.
+    kZoneMapScan,
+    // v = a value, with the bloom filter index.
+    kBloomFilterScan,
+    // v = a value, with the bitmap index.
+    kBitmapIndexScan,
+};
+
+static FieldType value_field_type(const std::string& type) {
+    if (type == "INT") {
+        return OLAP_FIELD_TYPE_INT;
+    } else if (type == "BIGINT") {
+        return OLAP_FIELD_TYPE_BIGINT;
+    }
+    return OLAP_FIELD_TYPE_VARCHAR;
+}
+
+// The text of the |i|-th value, which keeps the order of |i| for the strings.
+static std::string value_text(const std::string& type, int64_t i) {
+    if (type == "VARCHAR") {
+        return fmt::format("value-{:012d}", i);
+    }
+    return std::to_string(i);
+}
+
+static TabletSchema bench_tablet_schema(const std::string& value_type, SegmentBenchIndex index) {
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(DUP_KEYS);
+    schema_pb.set_num_short_key_columns(1);
+    schema_pb.set_num_rows_per_row_block(1024);
+    schema_pb.set_next_column_unique_id(3);
+
+    ColumnPB* key = schema_pb.add_column();
+    key->set_unique_id(1);
+    key->set_name("k");
+    key->set_type("BIGINT");
+    key->set_is_key(true);
+    key->set_length(8);
+    key->set_index_length(8);
+    key->set_is_nullable(false);
+
+    ColumnPB* value = schema_pb.add_column();
+    value->set_unique_id(2);
+    value->set_name("v");
+    value->set_type(value_type);
+    value->set_is_key(false);
+    value->set_aggregation("NONE");
+    value->set_length(value_type == "INT" ? 4 : (value_type == "BIGINT" ? 8 : 64));
+    value->set_is_nullable(false);
+    value->set_is_bf_column(index == kBloomFilterIndex);
+    value->set_has_bitmap_index(index == kBitmapIndex);
+    return TabletSchema(schema_pb);
+}
+
+class SegmentBenchContext {
+public:
+    SegmentBenchContext(std::string value_type, SegmentBenchIndex index)
+            : value_type(std::move(value_type)), tablet_schema(bench_tablet_schema(this->value_type, index)) {
+        config::vector_chunk_size = kSegmentBenchChunkSize;
+        _env = std::make_shared<EnvMemory>();
+        block_mgr = std::make_shared<fs::FileBlockManager>(_env, fs::BlockManagerOptions());
+        CHECK(_env->create_dir(kSegmentDir).ok());
+        _page_cache_mem_tracker = std::make_unique<MemTracker>();
+        _tablet_meta_mem_tracker = std::make_unique<MemTracker>();
+        StoragePageCache::create_global_cache(_page_cache_mem_tracker.get(), 1000000000);
+    }
+
+    ~SegmentBenchContext() { StoragePageCache::release_global_cache(); }
+
+    // The values of the i-th row are (i, value), the value is the i-th of the |cardinality| distinct values
+    // if |sorted|, otherwise a random one of them.
+    std::vector<vectorized::ChunkPtr> gen_chunks(int64_t cardinality, bool sorted) const {
+        std::mt19937_64 rng(0);
+        std::uniform_int_distribution<int64_t> value_dist(0, cardinality - 1);
+        auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+        std::vector<vectorized::ChunkPtr> chunks;
+        for (size_t start = 0; start < kSegmentBenchRows; start += kSegmentBenchChunkSize) {
+            auto chunk = vectorized::ChunkHelper::new_chunk(schema, kSegmentBenchChunkSize);
+            auto& key_column = chunk->get_column_by_index(0);
+            auto& value_column = chunk->get_column_by_index(1);
+            for (size_t i = start; i < start + kSegmentBenchChunkSize; i++) {
+                key_column->append_datum(vectorized::Datum(static_cast<int64_t>(i)));
+                int64_t value = sorted ? static_cast<int64_t>(i * cardinality / kSegmentBenchRows) : value_dist(rng);
+                if (value_type == "INT") {
+                    value_column->append_datum(vectorized::Datum(static_cast<int32_t>(value)));
+                } else if (value_type == "BIGINT") {
+                    value_column->append_datum(vectorized::Datum(value));
+                } else {
+                    std::string text = value_text(value_type, value);
+                    value_column->append_datum(vectorized::Datum(Slice(text)));
+                }
+            }
+            chunks.emplace_back(std::move(chunk));
+        }
+        return chunks;
+    }
+
+    // Writes |chunks| into a new segment, and returns its file name.
+    std::string write_segment(const std::vector<vectorized::ChunkPtr>& chunks, uint64_t* file_size) {
+        // Each segment has its own file name, the pages in the page cache are keyed by the file names.
+        std::string file_name = fmt::format("{}/segment_{}.dat", kSegmentDir, _next_segment_id++);
+        std::unique_ptr<fs::WritableBlock> wblock;
+        CHECK(block_mgr->create_block(fs::CreateBlockOptions({file_name}), &wblock).ok());
+        SegmentWriterOptions opts;
+        SegmentWriter writer(std::move(wblock), 0, &tablet_schema, opts);
+        CHECK(writer.init().ok());
+        for (const auto& chunk : chunks) {
+            CHECK(writer.append_chunk(*chunk).ok());
+        }
+        uint64_t index_size = 0;
+        uint64_t footer_position = 0;
+        CHECK(writer.finalize(file_size, &index_size, &footer_position).ok());
+        return file_name;
+    }
+
+    std::shared_ptr<Segment> open_segment(const std::string& file_name) {
+        auto segment = Segment::open(_tablet_meta_mem_tracker.get(), block_mgr, file_name, 0, &tablet_schema);
+        CHECK(segment.ok()) << segment.status();
+        return std::move(segment).value();
+    }
+
+    void delete_segment(const std::string& file_name) { CHECK(_env->delete_file(file_name).ok()); }
+
+    const std::string value_type;
+    const TabletSchema tablet_schema;
+    std::shared_ptr<fs::FileBlockManager> block_mgr;
+
+private:
+    const std::string kSegmentDir = "/segment_bench";
+    std::shared_ptr<EnvMemory> _env;
+    std::unique_ptr<MemTracker> _page_cache_mem_tracker;
+    std::unique_ptr<MemTracker> _tablet_meta_mem_tracker;
+    int _next_segment_id = 0;
+};
+
+// range(0): the cardinality of the values.
+// range(1): whether the values are sorted.
+static void BM_segment_write(benchmark::State& state, std::string value_type) {
+    const int64_t cardinality = state.range(0);
+    const bool sorted = state.range(1);
+    SegmentBenchContext ctx(value_type, kNoIndex);
+    auto chunks = ctx.gen_chunks(cardinality, sorted);
+    size_t raw_bytes = 0;
+    for (const auto& chunk : chunks) {
+        raw_bytes += chunk->bytes_usage();
+    }
+
+    uint64_t file_size = 0;
+    for (auto _ : state) {
+        std::string file_name = ctx.write_segment(chunks, &file_size);
+        state.PauseTiming();
+        ctx.delete_segment(file_name);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kSegmentBenchRows);
+    state.SetBytesProcessed(state.iterations() * raw_bytes);
+    state.counters["file_size"] = file_size;
+    state.counters["compression_ratio"] = file_size == 0 ? 0 : static_cast<double>(raw_bytes) / file_size;
+}
+
+// range(0): the cardinality of the values.
+// range(1): whether the values are sorted.
+static void BM_segment_scan(benchmark::State& state, std::string value_type, SegmentBenchScan scan) {
+    const int64_t cardinality = state.range(0);
+    const bool sorted = state.range(1);
+    SegmentBenchIndex index = kNoIndex;
+    if (scan == kBloomFilterScan) {
+        index = kBloomFilterIndex;
+    } else if (scan == kBitmapIndexScan) {
+        index = kBitmapIndex;
+    }
+    SegmentBenchContext ctx(value_type, index);
+    uint64_t file_size = 0;
+    auto segment = ctx.open_segment(ctx.write_segment(ctx.gen_chunks(cardinality, sorted), &file_size));
+
+    auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(ctx.tablet_schema);
+    auto type_info = get_type_info(value_field_type(value_type));
+    ObjectPool pool;
+    const vectorized::ColumnPredicate* predicate = nullptr;
+    if (scan == kZoneMapScan) {
+        predicate = pool.add(vectorized::new_column_lt_predicate(
+                type_info, 1, Slice(value_text(value_type, std::max<int64_t>(1, cardinality / 100)))));
+    } else if (scan == kBloomFilterScan || scan == kBitmapIndexScan) {
+        std::string operand = value_text(value_type, cardinality / 2);
+        predicate = pool.add(vectorized::new_column_eq_predicate(type_info, 1, Slice(operand)));
+    }
+
+    OlapReaderStatistics stats;
+    size_t num_rows = 0;
+    auto chunk = vectorized::ChunkHelper::new_chunk(schema, kSegmentBenchChunkSize);
+    for (auto _ : state) {
+        vectorized::SegmentReadOptions seg_opts;
+        seg_opts.block_mgr = ctx.block_mgr;
+        seg_opts.stats = &stats;
+        if (predicate != nullptr) {
+            seg_opts.predicates[1].push_back(predicate);
+            seg_opts.predicates_for_zone_map[1].push_back(predicate);
+        }
+        auto iter = new_segment_iterator(segment, schema, seg_opts);
+        while (true) {
+            chunk->reset();
+            Status st = iter->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            CHECK(st.ok()) << st;
+            num_rows += chunk->num_rows();
+        }
+        iter->close();
+    }
+    state.SetItemsProcessed(state.iterations() * kSegmentBenchRows);
+    state.SetBytesProcessed(state.iterations() * file_size);
+    state.counters["output_rows"] = benchmark::Counter(num_rows, benchmark::Counter::kAvgIterations);
+    state.counters["zone_map_filtered"] =
+            benchmark::Counter(stats.rows_stats_filtered, benchmark::Counter::kAvgIterations);
+    state.counters["bf_filtered"] = benchmark::Counter(stats.rows_bf_filtered, benchmark::Counter::kAvgIterations);
+    state.counters["bitmap_filtered"] =
+            benchmark::Counter(stats.rows_bitmap_index_filtered, benchmark::Counter::kAvgIterations);
+}
+
+static void segment_bench_args(benchmark::internal::Benchmark* bench) {
+    bench->ArgNames({"cardinality", "sorted"})->Unit(benchmark::kMillisecond);
+    for (int64_t cardinality : {1 << 4, 1 << 10, 1 << 16, 1 << 20}) {
+        for (int64_t sorted : {0, 1}) {
+            bench->Args({cardinality, sorted});
+        }
+    }
+}
+
+BENCHMARK_CAPTURE(BM_segment_write, int, std::string("INT"))->Apply(segment_bench_args);
+BENCHMARK_CAPTURE(BM_segment_write, bigint, std::string("BIGINT"))->Apply(segment_bench_args);
+BENCHMARK_CAPTURE(BM_segment_write, varchar, std::string("VARCHAR"))->Apply(segment_bench_args);
+
+BENCHMARK_CAPTURE(BM_segment_scan, int_full, std::string("INT"), kFullScan)->Apply(segment_bench_args);
+BENCHMARK_CAPTURE(BM_segment_scan, bigint_full, std::string("BIGINT"), kFullScan)->Apply(segment_bench_args);
+BENCHMARK_CAPTURE(BM_segment_scan, varchar_full, std::string("VARCHAR"), kFullScan)->Apply(segment_bench_args);
+
+BENCHMARK_CAPTURE(BM_segment_scan, int_zone_map, std::string("INT"), kZoneMapScan)->Apply(segment_bench_args);
+BENCHMARK_CAPTURE(BM_segment_scan, varchar_zone_map, std::string("VARCHAR"), kZoneMapScan)
+        ->Apply(segment_bench_args);
+
+BENCHMARK_CAPTURE(BM_segment_scan, int_bloom_filter, std::string("INT"), kBloomFilterScan)
+        ->Apply(segment_bench_args);
+BENCHMARK_CAPTURE(BM_segment_scan, varchar_bloom_filter, std::string("VARCHAR"), kBloomFilterScan)
+        ->Apply(segment_bench_args);
+
+BENCHMARK_CAPTURE(BM_segment_scan, int_bitmap_index, std::string("INT"), kBitmapIndexScan)
+        ->Apply(segment_bench_args);
+BENCHMARK_CAPTURE(BM_segment_scan, varchar_bitmap_index, std::string("VARCHAR"), kBitmapIndexScan)
+        ->Apply(segment_bench_args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
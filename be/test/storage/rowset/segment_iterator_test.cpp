@@ -6,8 +6,10 @@
 #include <string>
 #include <unordered_map>
 
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "env/env_memory.h"
+#include "fmt/format.h"
 #include "gtest/gtest.h"
 #include "storage/chunk_helper.h"
 #include "storage/chunk_iterator.h"
@@ -18,7 +20,9 @@
 #include "storage/rowset/segment.h"
 #include "storage/rowset/segment_options.h"
 #include "storage/rowset/segment_writer.h"
+#include "storage/runtime_range_pruner.h"
 #include "storage/tablet_schema_helper.h"
+#include "storage/vectorized_column_predicate.h"
 #include "testutil/assert.h"
 #include "util/defer_op.h"
 
@@ -315,4 +319,166 @@ TEST_F(SegmentIteratorTest, TestGlobalDictNoLocalDict) {
     res_chunk->reset();
 }
 
+// The dictionary of the string column is full after some pages, so the column is not all dict-encoded,
+// and the predicates are evaluated by the dict codes of the pages before that.
+TEST_F(SegmentIteratorTest, TestPagePredicatePushdown) {
+    const size_t num_rows = 200000;
+    std::vector<std::string> values;
+    values.reserve(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        values.push_back(fmt::format("page-predicate-pushdown-{:08d}", i));
+    }
+
+    TabletColumn c1 = create_int_key(1);
+    TabletColumn c2 = create_with_default_value<OLAP_FIELD_TYPE_VARCHAR>("");
+    TabletSchema tablet_schema = create_schema({c1, c2});
+
+    std::string file_name = kSegmentDir + "/page_predicate_pushdown";
+    std::unique_ptr<fs::WritableBlock> wblock;
+    fs::CreateBlockOptions wblock_opts({file_name});
+    ASSERT_OK(_block_mgr->create_block(wblock_opts, &wblock));
+    SegmentWriterOptions opts;
+    SegmentWriter writer(std::move(wblock), 0, &tablet_schema, opts);
+    ASSERT_OK(writer.init());
+
+    const int32_t chunk_size = config::vector_chunk_size;
+    auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+    auto chunk = vectorized::ChunkHelper::new_chunk(schema, chunk_size);
+    for (size_t i = 0; i < num_rows; i += chunk_size) {
+        chunk->reset();
+        auto& cols = chunk->columns();
+        for (size_t j = i; j < std::min<size_t>(i + chunk_size, num_rows); ++j) {
+            cols[0]->append_datum(vectorized::Datum(static_cast<int32_t>(j)));
+            cols[1]->append_datum(vectorized::Datum(Slice(values[j])));
+        }
+        ASSERT_OK(writer.append_chunk(*chunk));
+    }
+    uint64_t file_size = 0;
+    uint64_t index_size = 0;
+    uint64_t footer_position = 0;
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+
+    auto segment = *Segment::open(_tablet_meta_mem_tracker.get(), _block_mgr, file_name, 0, &tablet_schema);
+    ASSERT_EQ(num_rows, segment->num_rows());
+
+    auto read_rows = [&](size_t lower, size_t upper) {
+        ObjectPool pool;
+        OlapReaderStatistics stats;
+        vectorized::SegmentReadOptions seg_opts;
+        seg_opts.block_mgr = _block_mgr;
+        seg_opts.stats = &stats;
+        auto type_varchar = get_type_info(OLAP_FIELD_TYPE_VARCHAR);
+        seg_opts.predicates[1].push_back(
+                pool.add(vectorized::new_column_ge_predicate(type_varchar, 1, Slice(values[lower]))));
+        seg_opts.predicates[1].push_back(
+                pool.add(vectorized::new_column_lt_predicate(type_varchar, 1, Slice(values[upper]))));
+
+        auto chunk_iter = new_segment_iterator(segment, schema, seg_opts);
+        auto res_chunk = vectorized::ChunkHelper::new_chunk(chunk_iter->schema(), chunk_size);
+        size_t count = 0;
+        while (true) {
+            res_chunk->reset();
+            Status st = chunk_iter->get_next(res_chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            CHECK(st.ok()) << st;
+            for (size_t i = 0; i < res_chunk->num_rows(); ++i) {
+                auto key = static_cast<size_t>(res_chunk->get_column_by_index(0)->get(i).get_int32());
+                CHECK_EQ(values[key], res_chunk->get_column_by_index(1)->get(i).get_slice().to_string());
+                CHECK(lower <= key && key < upper);
+            }
+            count += res_chunk->num_rows();
+        }
+        chunk_iter->close();
+        return count;
+    };
+
+    for (bool enable_pushdown : {true, false}) {
+        config::enable_segment_page_predicate_pushdown = enable_pushdown;
+        // in the dict-encoded pages
+        ASSERT_EQ(1000u, read_rows(100, 1100));
+        // across the dict-encoded and plain-encoded pages
+        ASSERT_EQ(num_rows - 1000, read_rows(500, num_rows - 500));
+        // in the plain-encoded pages
+        ASSERT_EQ(1000u, read_rows(num_rows - 1500, num_rows - 500));
+    }
+    config::enable_segment_page_predicate_pushdown = true;
+}
+
+TEST_F(SegmentIteratorTest, TestRuntimeRangePruner) {
+    const size_t num_rows = 200000;
+    TabletColumn c1 = create_int_key(1);
+    TabletSchema tablet_schema = create_schema({c1});
+
+    std::string file_name = kSegmentDir + "/runtime_range_pruner";
+    std::unique_ptr<fs::WritableBlock> wblock;
+    fs::CreateBlockOptions wblock_opts({file_name});
+    ASSERT_OK(_block_mgr->create_block(wblock_opts, &wblock));
+    SegmentWriterOptions opts;
+    SegmentWriter writer(std::move(wblock), 0, &tablet_schema, opts);
+    ASSERT_OK(writer.init());
+
+    const int32_t chunk_size = config::vector_chunk_size;
+    auto schema = vectorized::ChunkHelper::convert_schema_to_format_v2(tablet_schema);
+    auto chunk = vectorized::ChunkHelper::new_chunk(schema, chunk_size);
+    for (size_t i = 0; i < num_rows; i += chunk_size) {
+        chunk->reset();
+        for (size_t j = i; j < std::min<size_t>(i + chunk_size, num_rows); ++j) {
+            chunk->get_column_by_index(0)->append_datum(vectorized::Datum(static_cast<int32_t>(j)));
+        }
+        ASSERT_OK(writer.append_chunk(*chunk));
+    }
+    uint64_t file_size = 0;
+    uint64_t index_size = 0;
+    uint64_t footer_position = 0;
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+
+    auto segment = *Segment::open(_tablet_meta_mem_tracker.get(), _block_mgr, file_name, 0, &tablet_schema);
+    ASSERT_EQ(num_rows, segment->num_rows());
+
+    ObjectPool pool;
+    OlapReaderStatistics stats;
+    vectorized::RuntimeRangePruner pruner;
+    vectorized::SegmentReadOptions seg_opts;
+    seg_opts.block_mgr = _block_mgr;
+    seg_opts.stats = &stats;
+    seg_opts.runtime_range_pruner = &pruner;
+
+    auto chunk_iter = new_segment_iterator(segment, schema, seg_opts);
+    auto res_chunk = vectorized::ChunkHelper::new_chunk(chunk_iter->schema(), chunk_size);
+    ASSERT_OK(chunk_iter->get_next(res_chunk.get()));
+    ASSERT_EQ(0, res_chunk->get_column_by_index(0)->get(0).get_int32());
+    size_t count = res_chunk->num_rows();
+
+    // A runtime filter `c1 >= 150000` arrives after the first chunk is read.
+    const int32_t lower = 150000;
+    auto type_int = get_type_info(OLAP_FIELD_TYPE_INT);
+    pruner.add_predicate(0, pool.add(vectorized::new_column_ge_predicate(type_int, 0, "150000")));
+    ASSERT_EQ(1, pruner.version());
+
+    size_t num_matched = 0;
+    int32_t prev = res_chunk->get_column_by_index(0)->get(count - 1).get_int32();
+    while (true) {
+        res_chunk->reset();
+        Status st = chunk_iter->get_next(res_chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(st);
+        for (size_t i = 0; i < res_chunk->num_rows(); ++i) {
+            int32_t key = res_chunk->get_column_by_index(0)->get(i).get_int32();
+            ASSERT_GT(key, prev);
+            prev = key;
+            num_matched += key >= lower;
+        }
+        count += res_chunk->num_rows();
+    }
+    chunk_iter->close();
+    // The pages before the lower bound are skipped, and the rows of the runtime filter are all read.
+    ASSERT_EQ(num_rows - lower, num_matched);
+    ASSERT_LT(count, num_rows);
+    ASSERT_EQ(num_rows - count, stats.rows_stats_filtered);
+}
+
 } // namespace starrocks
@@ -0,0 +1,147 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "storage/rowset/segment_row_fetcher.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "env/env_memory.h"
+#include "gutil/strings/substitute.h"
+#include "runtime/mem_tracker.h"
+#include "storage/chunk_helper.h"
+#include "storage/fs/file_block_manager.h"
+#include "storage/page_cache.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
+#include "storage/rowset/segment_writer.h"
+#include "storage/tablet_schema_helper.h"
+#include "testutil/assert.h"
+
+namespace starrocks::vectorized {
+
+class SegmentRowFetcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _env = std::make_shared<EnvMemory>();
+        _block_mgr = std::make_shared<fs::FileBlockManager>(_env, fs::BlockManagerOptions());
+        ASSERT_TRUE(_env->create_dir(kSegmentDir).ok());
+        StoragePageCache::create_global_cache(&_page_cache_mem_tracker, 1000000000);
+
+        _tablet_schema._cols.push_back(create_int_key(1));
+        _tablet_schema._cols.push_back(create_int_value(2));
+        _tablet_schema._num_key_columns = 1;
+        _tablet_schema._num_short_key_columns = 1;
+    }
+
+    void TearDown() override { StoragePageCache::release_global_cache(); }
+
+    // The value of column |cid| of row |rid| in segment |seg_id| is `seg_id * 1000000 + rid * 10 + cid`.
+    static int32_t value_of(uint32_t seg_id, rowid_t rid, int cid) { return seg_id * 1000000 + rid * 10 + cid; }
+
+    std::shared_ptr<Segment> build_segment(uint32_t seg_id, size_t num_rows) {
+        std::string file_name = strings::Substitute("$0/seg_$1.dat", kSegmentDir, seg_id);
+        std::unique_ptr<fs::WritableBlock> wblock;
+        fs::CreateBlockOptions block_opts({file_name});
+        EXPECT_OK(_block_mgr->create_block(block_opts, &wblock));
+        SegmentWriterOptions opts;
+        opts.num_rows_per_block = 100;
+        SegmentWriter writer(std::move(wblock), seg_id, &_tablet_schema, opts);
+        EXPECT_OK(writer.init());
+
+        auto schema = ChunkHelper::convert_schema_to_format_v2(_tablet_schema);
+        auto chunk = ChunkHelper::new_chunk(schema, num_rows);
+        for (rowid_t rid = 0; rid < num_rows; ++rid) {
+            for (int cid = 0; cid < 2; ++cid) {
+                chunk->get_column_by_index(cid)->append_datum(Datum(value_of(seg_id, rid, cid)));
+            }
+        }
+        EXPECT_OK(writer.append_chunk(*chunk));
+        uint64_t file_size, index_size, footer_position;
+        EXPECT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+        auto segment = *Segment::open(&_tablet_meta_mem_tracker, _block_mgr, file_name, seg_id, &_tablet_schema);
+        EXPECT_EQ(num_rows, segment->num_rows());
+        return segment;
+    }
+
+    const std::string kSegmentDir = "/segment_row_fetcher_test";
+    std::shared_ptr<EnvMemory> _env = nullptr;
+    std::shared_ptr<fs::FileBlockManager> _block_mgr = nullptr;
+    MemTracker _page_cache_mem_tracker;
+    MemTracker _tablet_meta_mem_tracker;
+    TabletSchema _tablet_schema;
+};
+
+TEST_F(SegmentRowFetcherTest, test_fetch) {
+    const size_t num_rows = 5000;
+    const ColumnId kRowidColumnId = 100;
+    SegmentRowFetcher fetcher;
+    auto segment0 = build_segment(0, num_rows);
+    auto segment1 = build_segment(1, num_rows);
+    ASSERT_EQ(0, fetcher.add_segment(_block_mgr, segment0));
+    ASSERT_EQ(1, fetcher.add_segment(_block_mgr, segment1));
+    ASSERT_EQ(2, fetcher.num_segments());
+
+    // Scan the key column of segment 1 with the global row ids, and keep every 7th row.
+    OlapReaderStatistics stats;
+    SegmentReadOptions read_opts;
+    read_opts.block_mgr = _block_mgr;
+    read_opts.stats = &stats;
+    auto key_schema = ChunkHelper::convert_schema_to_format_v2(_tablet_schema, {0});
+    auto iter = new_global_rowid_iterator(*segment1->new_iterator(key_schema, read_opts), 1, kRowidColumnId);
+    ASSERT_EQ(2, iter->schema().num_fields());
+    ASSERT_EQ(kRowidColumnId, iter->schema().field(1)->id());
+
+    auto global_rowids = Int64Column::create();
+    auto chunk = ChunkHelper::new_chunk(iter->schema(), config::vector_chunk_size);
+    size_t scanned = 0;
+    while (true) {
+        chunk->reset();
+        Status st = iter->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(st);
+        for (size_t i = 0; i < chunk->num_rows(); i++, scanned++) {
+            ASSERT_EQ(value_of(1, scanned, 0), chunk->get_column_by_index(0)->get(i).get_int32());
+            int64_t global_rowid = chunk->get_column_by_index(1)->get(i).get_int64();
+            ASSERT_EQ(SegmentRowFetcher::encode_global_rowid(1, scanned), global_rowid);
+            if (scanned % 7 == 0) {
+                global_rowids->append(global_rowid);
+            }
+        }
+    }
+    iter->close();
+    ASSERT_EQ(num_rows, scanned);
+
+    // Mix the rows of segment 0 in any order with duplicates.
+    std::vector<rowid_t> seg0_rowids{4999, 3, 3, 0, 1024, 1025, 3};
+    for (rowid_t rid : seg0_rowids) {
+        global_rowids->append(SegmentRowFetcher::encode_global_rowid(0, rid));
+    }
+
+    auto value_schema = ChunkHelper::convert_schema_to_format_v2(_tablet_schema, {1});
+    auto fetched = ChunkHelper::new_chunk(value_schema, global_rowids->size());
+    ASSERT_OK(fetcher.fetch(value_schema, *global_rowids, &stats, fetched.get()));
+    ASSERT_EQ(global_rowids->size(), fetched->num_rows());
+    for (size_t i = 0; i < fetched->num_rows(); i++) {
+        int64_t global_rowid = global_rowids->get_data()[i];
+        int32_t expected = value_of(SegmentRowFetcher::segment_ordinal_of(global_rowid),
+                                    SegmentRowFetcher::rowid_of(global_rowid), 1);
+        ASSERT_EQ(expected, fetched->get_column_by_index(0)->get(i).get_int32()) << "row " << i;
+    }
+
+    // invalid global row ids
+    auto invalid = Int64Column::create();
+    invalid->append(SegmentRowFetcher::encode_global_rowid(2, 0));
+    ASSERT_FALSE(fetcher.fetch(value_schema, *invalid, &stats, fetched.get()).ok());
+    invalid->resize(0);
+    invalid->append(SegmentRowFetcher::encode_global_rowid(0, num_rows));
+    ASSERT_FALSE(fetcher.fetch(value_schema, *invalid, &stats, fetched.get()).ok());
+}
+
+} // namespace starrocks::vectorized
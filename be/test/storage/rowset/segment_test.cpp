@@ -38,10 +38,12 @@
 #include "storage/olap_common.h"
 #include "storage/rowset/column_iterator.h"
 #include "storage/rowset/column_reader.h"
+#include "storage/rowset/segment_meta_cache.h"
 #include "storage/rowset/segment_options.h"
 #include "storage/rowset/segment_writer.h"
 #include "storage/tablet_schema.h"
 #include "storage/tablet_schema_helper.h"
+#include "storage/vectorized_column_predicate.h"
 #include "testutil/assert.h"
 #include "util/file_utils.h"
 
@@ -188,13 +190,74 @@ TEST_F(SegmentReaderWriterTest, TestBloomFilterIndexUniqueModel) {
     SegmentWriterOptions opts1;
     shared_ptr<Segment> seg1;
     build_segment(opts1, schema, schema, 100, DefaultIntGenerator, &seg1);
-    ASSERT_TRUE(seg1->column(3)->has_bloom_filter_index());
+    ASSERT_TRUE((*seg1->column(3))->has_bloom_filter_index());
 
     // for base segment
     SegmentWriterOptions opts2;
     shared_ptr<Segment> seg2;
     build_segment(opts2, schema, schema, 100, DefaultIntGenerator, &seg2);
-    ASSERT_TRUE(seg2->column(3)->has_bloom_filter_index());
+    ASSERT_TRUE((*seg2->column(3))->has_bloom_filter_index());
+}
+
+TEST_F(SegmentReaderWriterTest, TestLazyColumnReader) {
+    SegmentMetaCache::create_global_cache(_tablet_meta_mem_tracker.get(), 1024 * 1024);
+    SegmentMetaCache* cache = SegmentMetaCache::instance();
+    TabletSchema build_schema = create_schema({create_int_key(1), create_int_key(2), create_int_value(3)});
+    // the column 4 is added after the segment is written.
+    TabletSchema query_schema =
+            create_schema({create_int_key(1), create_int_key(2), create_int_value(3), create_int_value(4)});
+
+    SegmentWriterOptions opts;
+    shared_ptr<Segment> segment;
+    build_segment(opts, build_schema, query_schema, 100, DefaultIntGenerator, &segment);
+    ASSERT_EQ(4, segment->num_columns());
+    ASSERT_NE(nullptr, cache->lookup(segment->page_cache_file_id()));
+
+    ASSIGN_OR_ABORT(auto column_reader, segment->column(0));
+    ASSERT_NE(nullptr, column_reader);
+    ASSERT_EQ(100, column_reader->num_rows());
+    // The reader is created only once.
+    ASSERT_EQ(column_reader, *segment->column(0));
+    ASSERT_EQ(nullptr, *segment->column(3));
+
+    // The footer is read again after it's evicted.
+    cache->erase(segment->page_cache_file_id());
+    ASSIGN_OR_ABORT(column_reader, segment->column(2));
+    ASSERT_NE(nullptr, column_reader);
+    ASSERT_EQ(OLAP_FIELD_TYPE_INT, column_reader->column_type());
+    ASSERT_NE(nullptr, cache->lookup(segment->page_cache_file_id()));
+
+    auto file_id = segment->page_cache_file_id();
+    segment.reset();
+    ASSERT_EQ(nullptr, cache->lookup(file_id));
+    SegmentMetaCache::release_global_cache();
+}
+
+TEST_F(SegmentReaderWriterTest, TestPruneDeletePredicates) {
+    TabletSchema schema = create_schema({create_int_key(1), create_int_key(2), create_int_value(3)});
+    SegmentWriterOptions opts;
+    shared_ptr<Segment> segment;
+    // column 0 is in [0, 990] and column 1 is in [1, 991].
+    build_segment(opts, schema, schema, 100, DefaultIntGenerator, &segment);
+
+    auto type_info = get_type_info(OLAP_FIELD_TYPE_INT);
+    std::unique_ptr<vectorized::ColumnPredicate> c0_eq(vectorized::new_column_eq_predicate(type_info, 0, "5000"));
+    std::unique_ptr<vectorized::ColumnPredicate> c0_gt(vectorized::new_column_gt_predicate(type_info, 0, "500"));
+    std::unique_ptr<vectorized::ColumnPredicate> c1_eq(vectorized::new_column_eq_predicate(type_info, 1, "11"));
+    std::unique_ptr<vectorized::ColumnPredicate> c1_lt(vectorized::new_column_lt_predicate(type_info, 1, "0"));
+
+    vectorized::DisjunctivePredicates preds;
+    preds.add(vectorized::ConjunctivePredicates({c0_eq.get()}));
+    preds.add(vectorized::ConjunctivePredicates({c0_gt.get(), c1_eq.get()}));
+    preds.add(vectorized::ConjunctivePredicates({c0_gt.get(), c1_lt.get()}));
+
+    vectorized::DisjunctivePredicates pruned;
+    ASSERT_OK(segment->prune_delete_predicates(preds, &pruned));
+    ASSERT_EQ(1, pruned.size());
+    std::vector<const vectorized::ColumnPredicate*> column_preds;
+    pruned[0].predicates_of_column(1, &column_preds);
+    ASSERT_EQ(1, column_preds.size());
+    ASSERT_EQ(c1_eq.get(), column_preds[0]);
 }
 
 TEST_F(SegmentReaderWriterTest, TestHorizontalWrite) {
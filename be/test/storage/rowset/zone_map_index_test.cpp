@@ -154,6 +154,28 @@ TEST_F(ColumnZoneMapTest, NormalTestIntPage) {
 
     ASSERT_EQ(true, zone_maps[2].has_null());
     ASSERT_EQ(false, zone_maps[2].has_not_null());
+
+    // the first granule contains the first two pages, the second one contains the last page.
+    ASSERT_OK(column_zone_map.init_zone_map_details(get_type_info(OLAP_FIELD_TYPE_INT), 20, 2));
+    const auto& details = column_zone_map.page_zone_map_details();
+    ASSERT_EQ(3, details.size());
+    ASSERT_EQ(1, details[0].min_value().get_int32());
+    ASSERT_EQ(22, details[0].max_value().get_int32());
+    ASSERT_FALSE(details[0].has_null());
+    ASSERT_TRUE(details[2].has_null());
+    ASSERT_FALSE(details[2].has_not_null());
+
+    const auto& granules = column_zone_map.granule_zone_map_details();
+    ASSERT_EQ(2, granules.size());
+    ASSERT_EQ(1, granules[0].min_value().get_int32());
+    ASSERT_EQ(31, granules[0].max_value().get_int32());
+    ASSERT_TRUE(granules[0].has_null());
+    ASSERT_TRUE(granules[1].has_null());
+    ASSERT_FALSE(granules[1].has_not_null());
+
+    ASSERT_OK(column_zone_map.init_zone_map_details(get_type_info(OLAP_FIELD_TYPE_INT), 20, 0));
+    ASSERT_EQ(3, column_zone_map.page_zone_map_details().size());
+    ASSERT_TRUE(column_zone_map.granule_zone_map_details().empty());
     delete field;
 }
 
@@ -345,6 +345,7 @@ public:
     void test_issue_4181(bool enable_persistent_index);
     void test_snapshot_with_empty_rowset(bool enable_persistent_index);
     void test_get_column_values(bool enable_persistent_index);
+    void test_get_rows_by_keys(bool enable_persistent_index);
 
 protected:
     TabletSharedPtr _tablet;
@@ -1858,4 +1859,49 @@ TEST_F(TabletUpdatesTest, get_column_values_with_persistent_index) {
     test_get_column_values(true);
 }
 
+void TabletUpdatesTest::test_get_rows_by_keys(bool enable_persistent_index) {
+    srand(GetCurrentTimeMicros());
+    _tablet = create_tablet(rand(), rand());
+    _tablet->set_enable_persistent_index(enable_persistent_index);
+    std::vector<int64_t> keys;
+    for (int i = 0; i < 3000; i++) {
+        keys.push_back(i);
+    }
+    // [0, 3000) in 3 segments, then [1000, 2000) is rewritten and [0, 10) is deleted
+    ASSERT_TRUE(_tablet->rowset_commit(2, create_rowsets(_tablet, keys, 1000)).ok());
+    std::vector<int64_t> rewritten_keys(keys.begin() + 1000, keys.begin() + 2000);
+    ASSERT_TRUE(_tablet->rowset_commit(3, create_rowset(_tablet, rewritten_keys)).ok());
+    vectorized::Int64Column deletes;
+    deletes.append_numbers(keys.data(), sizeof(int64_t) * 10);
+    ASSERT_TRUE(_tablet->rowset_commit(4, create_rowset(_tablet, {}, &deletes)).ok());
+    std::vector<RowsetSharedPtr> rowsets;
+    ASSERT_OK(_tablet->updates()->get_applied_rowsets(4, &rowsets));
+
+    vectorized::Int64Column lookup_keys;
+    for (int64_t key : {2501, 5, 1500, 99999, 20}) {
+        lookup_keys.append(key);
+    }
+    std::vector<uint32_t> read_column_ids = {1, 2};
+    std::vector<std::unique_ptr<vectorized::Column>> read_columns;
+    for (auto column_id : read_column_ids) {
+        const auto& tablet_column = _tablet->tablet_schema().column(column_id);
+        auto column =
+                vectorized::ChunkHelper::column_from_field_type(tablet_column.type(), tablet_column.is_nullable());
+        read_columns.emplace_back(column->clone_empty());
+    }
+    std::vector<bool> found;
+    ASSERT_OK(_tablet->updates()->get_rows_by_keys(lookup_keys, read_column_ids, &found, &read_columns));
+    ASSERT_EQ(std::vector<bool>({true, false, true, false, true}), found);
+    ASSERT_EQ("[2, 1, 21]", read_columns[0]->debug_string());
+    ASSERT_EQ("[503, 502, 22]", read_columns[1]->debug_string());
+}
+
+TEST_F(TabletUpdatesTest, get_rows_by_keys) {
+    test_get_rows_by_keys(false);
+}
+
+TEST_F(TabletUpdatesTest, get_rows_by_keys_with_persistent_index) {
+    test_get_rows_by_keys(true);
+}
+
 } // namespace starrocks
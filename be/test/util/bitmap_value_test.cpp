@@ -23,6 +23,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "util/coding.h"
 #define private public
@@ -66,6 +67,48 @@ TEST(BitmapValueTest, bitmap_union) {
     ASSERT_EQ(5, bitmap2.cardinality());
 }
 
+TEST(BitmapValueTest, bitmap_fast_union) {
+    // bitmaps with several high 32 bits, small sets and single values.
+    std::vector<BitmapValue> values;
+    BitmapValue expected;
+    for (uint64_t i = 0; i < 8; ++i) {
+        BitmapValue bitmap;
+        for (uint64_t j = 0; j < 100; ++j) {
+            bitmap.add((j % 3) * (uint64_t(1) << 32) + i * 50 + j);
+        }
+        values.emplace_back(std::move(bitmap));
+    }
+    values.emplace_back();
+    values.emplace_back(uint64_t(10000));
+    values.emplace_back(BitmapValue({20000, 20001, 20002}));
+    BitmapValue set;
+    set.add(30000);
+    set.add(30001);
+    values.emplace_back(std::move(set));
+    ASSERT_EQ(BitmapValue::SET, values.back()._type);
+
+    std::vector<const BitmapValue*> pointers;
+    for (const auto& value : values) {
+        expected |= value;
+        pointers.push_back(&value);
+    }
+
+    for (auto& initial : {BitmapValue(), BitmapValue(uint64_t(1)), BitmapValue({2, 3, 4})}) {
+        BitmapValue result = initial;
+        result.fast_union(pointers.size(), pointers.data());
+        BitmapValue expected_result = initial;
+        expected_result |= expected;
+        ASSERT_EQ(BitmapValue::BITMAP, result._type);
+        ASSERT_EQ(expected_result.to_string(), result.to_string());
+    }
+
+    // falls back to merging one by one without enough bitmaps.
+    BitmapValue result;
+    result.fast_union(2, pointers.data() + 8);
+    ASSERT_EQ(BitmapValue::SINGLE, result._type);
+    ASSERT_EQ(10000, result._sv);
+}
+
 TEST(BitmapValueTest, bitmap_intersect) {
     BitmapValue empty;
     BitmapValue single(1024);
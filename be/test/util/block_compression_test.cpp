@@ -24,6 +24,9 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "gen_cpp/segment.pb.h"
 
@@ -192,4 +195,54 @@ TEST_F(BlockCompressionTest, multi) {
     test_multi_slices(starrocks::CompressionTypePB::GZIP);
 }
 
+TEST_F(BlockCompressionTest, zstd_dict) {
+    // json-like values sharing the keys
+    auto generate_json = [](int i) {
+        return "{\"user_id\": " + std::to_string(i) + ", \"name\": \"" + generate_str(8) +
+               "\", \"status\": \"active\", \"tags\": [\"" + generate_str(4) + "\"]}";
+    };
+    std::vector<std::string> values;
+    for (int i = 0; i < 10000; ++i) {
+        values.push_back(generate_json(i));
+    }
+    std::vector<Slice> samples(values.begin(), values.end());
+    std::string dict;
+    ASSERT_TRUE(train_zstd_dictionary(samples, 4096, &dict).ok());
+    ASSERT_GT(dict.size(), 0);
+    ASSERT_LE(dict.size(), 4096);
+
+    std::unique_ptr<BlockCompressionCodec> dict_codec;
+    ASSERT_TRUE(create_zstd_dict_codec(dict, &dict_codec).ok());
+    ASSERT_GT(dict_codec->mem_usage(), dict.size());
+    const BlockCompressionCodec* codec = nullptr;
+    ASSERT_TRUE(get_block_compression_codec(starrocks::CompressionTypePB::ZSTD, &codec).ok());
+
+    // a small page
+    std::string orig;
+    for (int i = 0; i < 5; ++i) {
+        orig.append(generate_json(100000 + i));
+    }
+    std::string compressed(dict_codec->max_compressed_len(orig.size()), '\0');
+    Slice compressed_slice(compressed);
+    ASSERT_TRUE(dict_codec->compress(orig, &compressed_slice).ok());
+
+    std::string compressed_without_dict(codec->max_compressed_len(orig.size()), '\0');
+    Slice compressed_without_dict_slice(compressed_without_dict);
+    ASSERT_TRUE(codec->compress(orig, &compressed_without_dict_slice).ok());
+    ASSERT_LT(compressed_slice.size, compressed_without_dict_slice.size);
+
+    std::string uncompressed(orig.size(), '\0');
+    Slice uncompressed_slice(uncompressed);
+    ASSERT_TRUE(dict_codec->decompress(compressed_slice, &uncompressed_slice).ok());
+    ASSERT_EQ(orig, uncompressed);
+
+    // cannot be decompressed without the dictionary
+    uncompressed_slice = Slice(uncompressed);
+    ASSERT_FALSE(codec->decompress(compressed_slice, &uncompressed_slice).ok());
+
+    // too few samples
+    std::vector<Slice> few_samples(samples.begin(), samples.begin() + 2);
+    ASSERT_FALSE(train_zstd_dictionary(few_samples, 4096, &dict).ok());
+}
+
 } // namespace starrocks
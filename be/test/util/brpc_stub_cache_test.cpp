@@ -47,6 +47,26 @@ TEST_F(BrpcStubCacheTest, normal) {
     ASSERT_EQ(stub1, stub3);
 }
 
+TEST_F(BrpcStubCacheTest, shard) {
+    int32_t num_connections = config::brpc_connections_per_endpoint;
+    config::brpc_connections_per_endpoint = 3;
+    BrpcStubCache cache;
+    TNetworkAddress address;
+    address.hostname = "127.0.0.1";
+    address.port = 123;
+    auto stub0 = cache.get_stub(address, 0);
+    auto stub1 = cache.get_stub(address, 1);
+    auto stub2 = cache.get_stub(address, 2);
+    ASSERT_NE(nullptr, stub0);
+    ASSERT_NE(stub0, stub1);
+    ASSERT_NE(stub0, stub2);
+    ASSERT_NE(stub1, stub2);
+    ASSERT_EQ(stub0, cache.get_stub(address));
+    ASSERT_EQ(stub1, cache.get_stub(address, 4));
+    ASSERT_EQ(stub2, cache.get_stub(address, 5));
+    config::brpc_connections_per_endpoint = num_connections;
+}
+
 TEST_F(BrpcStubCacheTest, invalid) {
     BrpcStubCache cache;
     TNetworkAddress address;
@@ -0,0 +1,227 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "util/clock_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace starrocks {
+
+class ClockCacheTest : public testing::Test {
+public:
+    static ClockCacheTest* _s_current;
+
+    static void Deleter(const CacheKey& key, void* v) {
+        _s_current->_deleted_keys.push_back(std::stoi(key.to_string()));
+        _s_current->_deleted_values.push_back(static_cast<int>(reinterpret_cast<uintptr_t>(v)));
+    }
+
+    static const int kCacheSize = 1000;
+    std::vector<int> _deleted_keys;
+    std::vector<int> _deleted_values;
+    std::unique_ptr<Cache> _cache;
+
+    ClockCacheTest() : _cache(new_clock_cache(kCacheSize)) { _s_current = this; }
+
+    int Lookup(int key) {
+        Cache::Handle* handle = _cache->lookup(CacheKey(std::to_string(key)));
+        const int r = (handle == nullptr) ? -1 : static_cast<int>(reinterpret_cast<uintptr_t>(_cache->value(handle)));
+        if (handle != nullptr) {
+            _cache->release(handle);
+        }
+        return r;
+    }
+
+    void Insert(int key, int value, int charge, CachePriority priority = CachePriority::NORMAL) {
+        _cache->release(_cache->insert(CacheKey(std::to_string(key)), reinterpret_cast<void*>(value), charge,
+                                       &ClockCacheTest::Deleter, priority));
+    }
+
+    void Erase(int key) { _cache->erase(CacheKey(std::to_string(key))); }
+};
+ClockCacheTest* ClockCacheTest::_s_current;
+
+TEST_F(ClockCacheTest, HitAndMiss) {
+    ASSERT_EQ(-1, Lookup(100));
+
+    Insert(100, 101, 1);
+    ASSERT_EQ(101, Lookup(100));
+    ASSERT_EQ(-1, Lookup(200));
+
+    Insert(200, 201, 1);
+    ASSERT_EQ(101, Lookup(100));
+    ASSERT_EQ(201, Lookup(200));
+
+    Insert(100, 102, 1);
+    ASSERT_EQ(102, Lookup(100));
+    ASSERT_EQ(201, Lookup(200));
+
+    ASSERT_EQ(1, _deleted_keys.size());
+    ASSERT_EQ(100, _deleted_keys[0]);
+    ASSERT_EQ(101, _deleted_values[0]);
+}
+
+TEST_F(ClockCacheTest, Erase) {
+    Erase(200);
+    ASSERT_EQ(0, _deleted_keys.size());
+
+    Insert(100, 101, 1);
+    Insert(200, 201, 1);
+    Erase(100);
+    ASSERT_EQ(-1, Lookup(100));
+    ASSERT_EQ(201, Lookup(200));
+    ASSERT_EQ(1, _deleted_keys.size());
+    ASSERT_EQ(100, _deleted_keys[0]);
+
+    Erase(100);
+    ASSERT_EQ(1, _deleted_keys.size());
+}
+
+TEST_F(ClockCacheTest, EntriesArePinned) {
+    Insert(100, 101, 1);
+    Cache::Handle* h1 = _cache->lookup(CacheKey("100"));
+    ASSERT_EQ(101, reinterpret_cast<uintptr_t>(_cache->value(h1)));
+
+    Insert(100, 102, 1);
+    Cache::Handle* h2 = _cache->lookup(CacheKey("100"));
+    ASSERT_EQ(102, reinterpret_cast<uintptr_t>(_cache->value(h2)));
+    ASSERT_EQ(0, _deleted_keys.size());
+
+    _cache->release(h1);
+    ASSERT_EQ(1, _deleted_keys.size());
+    ASSERT_EQ(101, _deleted_values[0]);
+
+    Erase(100);
+    ASSERT_EQ(-1, Lookup(100));
+    ASSERT_EQ(1, _deleted_keys.size());
+
+    _cache->release(h2);
+    ASSERT_EQ(2, _deleted_keys.size());
+    ASSERT_EQ(102, _deleted_values[1]);
+}
+
+TEST_F(ClockCacheTest, PinnedEntriesAreNotEvicted) {
+    Insert(100, 101, 1);
+    Cache::Handle* h = _cache->lookup(CacheKey("100"));
+    for (int i = 0; i < 2 * kCacheSize; i++) {
+        Insert(1000 + i, 2000 + i, 1);
+    }
+    ASSERT_EQ(101, Lookup(100));
+    _cache->release(h);
+    ASSERT_EQ(101, Lookup(100));
+}
+
+TEST_F(ClockCacheTest, EvictionPolicy) {
+    Insert(100, 101, 1);
+    Insert(200, 201, 1);
+
+    // Frequently used entry must be kept around, and the entry never looked up is evicted by a scan
+    for (int i = 0; i < 2 * kCacheSize; i++) {
+        Insert(1000 + i, 2000 + i, 1);
+        ASSERT_EQ(101, Lookup(100));
+    }
+
+    ASSERT_EQ(101, Lookup(100));
+    ASSERT_EQ(-1, Lookup(200));
+}
+
+TEST_F(ClockCacheTest, EvictionPolicyWithDurable) {
+    Insert(100, 101, 1);
+    Insert(200, 201, 1, CachePriority::DURABLE);
+    Insert(300, 301, 1);
+
+    for (int i = 0; i < 2 * kCacheSize; i++) {
+        Insert(1000 + i, 2000 + i, 1);
+        ASSERT_EQ(101, Lookup(100));
+    }
+
+    ASSERT_EQ(-1, Lookup(300));
+    ASSERT_EQ(101, Lookup(100));
+    ASSERT_EQ(201, Lookup(200));
+}
+
+TEST_F(ClockCacheTest, HeavyEntries) {
+    const int kLight = 1;
+    const int kHeavy = 10;
+    int added = 0;
+    int index = 0;
+    while (added < 2 * kCacheSize) {
+        const int weight = (index & 1) ? kLight : kHeavy;
+        Insert(index, 1000 + index, weight);
+        added += weight;
+        index++;
+    }
+
+    int cached_weight = 0;
+    for (int i = 0; i < index; i++) {
+        const int weight = (i & 1 ? kLight : kHeavy);
+        int r = Lookup(i);
+        if (r >= 0) {
+            cached_weight += weight;
+            ASSERT_EQ(1000 + i, r);
+        }
+    }
+    // Each shard may exceed its capacity by less than one heavy entry.
+    ASSERT_LE(cached_weight, kCacheSize + kNumClockShards * kHeavy);
+    ASSERT_EQ(cached_weight, _cache->get_memory_usage());
+}
+
+TEST_F(ClockCacheTest, Prune) {
+    Insert(100, 101, 1);
+    Insert(200, 201, 1);
+    Cache::Handle* h = _cache->lookup(CacheKey("100"));
+
+    _cache->prune();
+    ASSERT_EQ(1, _deleted_keys.size());
+    ASSERT_EQ(200, _deleted_keys[0]);
+    ASSERT_EQ(1, _cache->get_memory_usage());
+
+    _cache->release(h);
+    ASSERT_EQ(101, Lookup(100));
+}
+
+TEST(ClockCacheConcurrencyTest, ConcurrentLookupAndInsert) {
+    static std::atomic<int64_t> s_num_entries{0};
+    auto deleter = [](const CacheKey& key, void* v) { s_num_entries.fetch_sub(1); };
+    {
+        std::unique_ptr<Cache> cache(new_clock_cache(1024));
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; t++) {
+            threads.emplace_back([&cache, &deleter, t]() {
+                for (int i = 0; i < 100000; i++) {
+                    int key = (i * 7 + t) % 4096;
+                    std::string key_str = std::to_string(key);
+                    Cache::Handle* h = cache->lookup(CacheKey(key_str));
+                    if (h != nullptr) {
+                        ASSERT_EQ(key, reinterpret_cast<uintptr_t>(cache->value(h)));
+                        cache->release(h);
+                    } else {
+                        s_num_entries.fetch_add(1);
+                        cache->release(cache->insert(CacheKey(key_str), reinterpret_cast<void*>(key), 1, deleter));
+                    }
+                    if (i % 1000 == 0) {
+                        cache->erase(CacheKey(key_str));
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        ASSERT_EQ(cache->get_memory_usage(), s_num_entries.load());
+    }
+    ASSERT_EQ(0, s_num_entries.load());
+}
+
+TEST_F(ClockCacheTest, NewId) {
+    uint64_t a = _cache->new_id();
+    uint64_t b = _cache->new_id();
+    ASSERT_NE(a, b);
+}
+
+} // namespace starrocks
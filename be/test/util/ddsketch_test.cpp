@@ -0,0 +1,116 @@
+// This file is licensed under the Elastic License 2.0. Copyright 2021-present, StarRocks Limited.
+
+#include "util/ddsketch.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "util/percentile_value.h"
+
+namespace starrocks {
+
+static void check_quantiles(const DDSketch& sketch, std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    for (double q : {0.0, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 1.0}) {
+        double expected = values[static_cast<size_t>(q * (values.size() - 1))];
+        double actual = sketch.quantile(q);
+        ASSERT_LE(std::abs(actual - expected), std::abs(expected) * DDSketch::kRelativeAccuracy + 1e-9)
+                << "q=" << q << " expected=" << expected << " actual=" << actual;
+    }
+}
+
+TEST(DDSketchTest, quantile) {
+    std::mt19937_64 rng(0);
+    std::lognormal_distribution<double> distribution(0, 2);
+    std::vector<double> values;
+    DDSketch sketch;
+    for (int i = 0; i < 100000; ++i) {
+        double value = distribution(rng);
+        // some negative values and zeros.
+        if (i % 10 == 0) {
+            value = -value;
+        } else if (i % 97 == 0) {
+            value = 0;
+        }
+        values.push_back(value);
+    }
+    sketch.add_batch(values.data(), values.size());
+    ASSERT_EQ(values.size(), sketch.count());
+    check_quantiles(sketch, values);
+
+    DDSketch empty;
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(0, empty.quantile(0.5));
+}
+
+TEST(DDSketchTest, merge_and_serialize) {
+    std::mt19937_64 rng(1);
+    std::uniform_real_distribution<double> distribution(-1000, 100000);
+    std::vector<double> values;
+    std::vector<DDSketch> sketches(8);
+    for (int i = 0; i < 80000; ++i) {
+        double value = distribution(rng);
+        values.push_back(value);
+        sketches[i % sketches.size()].add(value);
+    }
+
+    DDSketch merged;
+    for (const auto& sketch : sketches) {
+        std::vector<uint8_t> buffer(sketch.serialize_size());
+        ASSERT_EQ(buffer.size(), sketch.serialize(buffer.data()));
+        DDSketch deserialized;
+        ASSERT_EQ(buffer.size(), deserialized.deserialize(buffer.data()));
+        ASSERT_EQ(sketch.count(), deserialized.count());
+        merged.merge(deserialized);
+    }
+    ASSERT_EQ(values.size(), merged.count());
+    check_quantiles(merged, values);
+}
+
+TEST(DDSketchTest, collapse) {
+    // The values span more than kMaxBuckets buckets, the lowest ones are collapsed.
+    DDSketch sketch;
+    std::vector<double> values;
+    for (int i = -300; i <= 300; ++i) {
+        values.push_back(std::pow(10.0, i / 10.0));
+    }
+    sketch.add_batch(values.data(), values.size());
+    ASSERT_EQ(values.size(), sketch.count());
+    ASSERT_LE(sketch.serialize_size(), sizeof(double) * 2 + 64 + DDSketch::kMaxBuckets * 2);
+    // The high quantiles are still accurate.
+    double expected = values[static_cast<size_t>(0.9 * (values.size() - 1))];
+    ASSERT_NEAR(expected, sketch.quantile(0.9), expected * DDSketch::kRelativeAccuracy);
+    ASSERT_NEAR(values.back(), sketch.quantile(1), values.back() * DDSketch::kRelativeAccuracy);
+}
+
+TEST(DDSketchTest, percentile_value) {
+    config::percentile_use_ddsketch = true;
+    PercentileValue ddsketch_value;
+    for (int i = 1; i <= 1000; ++i) {
+        ddsketch_value.add(i);
+    }
+    config::percentile_use_ddsketch = false;
+    PercentileValue tdigest_value;
+    for (int i = 1001; i <= 2000; ++i) {
+        tdigest_value.add(i);
+    }
+
+    std::vector<uint8_t> buffer(ddsketch_value.serialize_size());
+    ASSERT_EQ(buffer.size(), ddsketch_value.serialize(buffer.data()));
+    PercentileValue deserialized(Slice(buffer.data(), buffer.size()));
+    ASSERT_NEAR(500, deserialized.quantile(0.5), 500 * DDSketch::kRelativeAccuracy);
+
+    // Merge the values of different types.
+    deserialized.merge(&tdigest_value);
+    ASSERT_NEAR(1000, deserialized.quantile(0.5), 1000 * 0.02);
+
+    PercentileValue empty;
+    empty.merge(&ddsketch_value);
+    ASSERT_NEAR(500, empty.quantile(0.5), 500 * DDSketch::kRelativeAccuracy);
+}
+
+} // namespace starrocks
@@ -56,4 +56,44 @@ TEST(DynamicCacheTest, cache) {
     ASSERT_TRUE(cache.get(19) == nullptr);
 }
 
+TEST(DynamicCacheTest, max_entry_size) {
+    DynamicCache<int32_t, int64_t> cache(10);
+    cache.set_max_entry_size(3);
+    for (int i = 0; i < 4; i++) {
+        auto e = cache.get_or_create(i);
+        cache.update_object_size(e, i == 1 ? 4 : 1);
+        cache.release(e);
+    }
+    ASSERT_EQ(7, cache.size());
+    // the large entry 1 is evicted before the older entry 0
+    auto e = cache.get_or_create(4);
+    cache.update_object_size(e, 4);
+    cache.release(e);
+    ASSERT_EQ(7, cache.size());
+    ASSERT_TRUE(cache.get(1) == nullptr);
+    for (int i : {0, 2, 3, 4}) {
+        e = cache.get(i);
+        ASSERT_TRUE(e != nullptr);
+        cache.release(e);
+    }
+    e = cache.get_or_create(5);
+    cache.update_object_size(e, 3);
+    cache.release(e);
+    ASSERT_EQ(10, cache.size());
+    e = cache.get_or_create(6);
+    cache.update_object_size(e, 2);
+    cache.release(e);
+    ASSERT_EQ(8, cache.size());
+    ASSERT_TRUE(cache.get(4) == nullptr);
+    // fall back to LRU when there is no large entry left to evict
+    e = cache.get_or_create(7);
+    cache.update_object_size(e, 3);
+    cache.release(e);
+    ASSERT_EQ(10, cache.size());
+    ASSERT_TRUE(cache.get(0) == nullptr);
+    e = cache.get(2);
+    ASSERT_TRUE(e != nullptr);
+    cache.release(e);
+}
+
 } // namespace starrocks
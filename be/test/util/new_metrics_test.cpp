@@ -22,6 +22,7 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <limits>
 #include <thread>
 
 #include "common/config.h"
@@ -185,6 +186,31 @@ TEST_F(MetricsTest, Gauge) {
     }
 }
 
+TEST_F(MetricsTest, Histogram) {
+    ASSERT_EQ(0, HistogramMetric::bucket_index(0));
+    ASSERT_EQ(0, HistogramMetric::bucket_index(1));
+    ASSERT_EQ(1, HistogramMetric::bucket_index(2));
+    ASSERT_EQ(2, HistogramMetric::bucket_index(3));
+    ASSERT_EQ(2, HistogramMetric::bucket_index(4));
+    ASSERT_EQ(3, HistogramMetric::bucket_index(5));
+    ASSERT_EQ(HistogramMetric::kNumBuckets - 1, HistogramMetric::bucket_index(std::numeric_limits<int64_t>::max()));
+
+    HistogramMetric histogram(MetricUnit::MICROSECONDS);
+    ASSERT_EQ(0, histogram.quantile(0.5));
+    for (int i = 0; i < 990; ++i) {
+        histogram.add(100);
+    }
+    for (int i = 0; i < 10; ++i) {
+        histogram.add(5000);
+    }
+    ASSERT_EQ(1000, histogram.count());
+    ASSERT_EQ(990 * 100 + 10 * 5000, histogram.sum());
+    ASSERT_EQ(128, histogram.quantile(0.5));
+    ASSERT_EQ(128, histogram.quantile(0.98));
+    ASSERT_EQ(8192, histogram.quantile(0.999));
+    ASSERT_EQ("count=1000 sum=149000 p50=128 p99=8192 p999=8192", histogram.to_string());
+}
+
 TEST_F(MetricsTest, MetricLabel) {
     std::string put("put");
     MetricLabel label("type", put);
@@ -237,6 +237,17 @@ TEST(StringToInt, Limit) {
                             StringParser::PARSE_SUCCESS);
 }
 
+TEST(StringToInt, LongDigits) {
+    // The digits are parsed eight at a time, with the rest and the trailing whitespace one by one.
+    test_int_value<int64_t>("123456789", 123456789, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("12345678901234567", 12345678901234567, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("-100000000000000001", -100000000000000001, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("000000000000000042", 42, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("123456789x12345", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("1234567890:2345", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("12345678 90", 0, StringParser::PARSE_FAILURE);
+}
+
 TEST(StringToUnsignedInt, Basic) {
     test_unsigned_int_value<uint8_t>("123", 123, StringParser::PARSE_SUCCESS);
     test_unsigned_int_value<uint16_t>("123", 123, StringParser::PARSE_SUCCESS);
@@ -512,6 +523,24 @@ TEST(StringToFloat, Basic) {
     test_all_float_variants("ThisIsANaN", StringParser::PARSE_FAILURE);
 }
 
+TEST(StringToFloat, PlainDecimal) {
+    // The plain decimals, parsed by the fast path, are correctly rounded as strtod.
+    uint64_t x = 88172645463325252ULL;
+    for (int i = 0; i < 10000; ++i) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        std::string s = std::to_string(x % 100000000000ULL);
+        size_t scale = (x >> 40) % std::min<size_t>(s.size() + 1, 12);
+        s.insert(s.size() - scale, ".");
+        test_float_value<double>(s, StringParser::PARSE_SUCCESS);
+        test_float_value<float>(s, StringParser::PARSE_SUCCESS);
+        test_float_value<double>("-" + s, StringParser::PARSE_SUCCESS);
+    }
+    test_all_float_variants("0.0000000000000000000001", StringParser::PARSE_SUCCESS);
+    test_all_float_variants("1.", StringParser::PARSE_SUCCESS);
+}
+
 TEST(StringToFloat, InvalidLeadingTrailing) {
     // Test that trailing garbage is not allowed.
     test_float_value<double>("123xyz   ", StringParser::PARSE_FAILURE);
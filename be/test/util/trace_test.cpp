@@ -21,6 +21,7 @@
 
 #include "util/trace.h"
 
+#include <bthread/bthread.h>
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 #include <rapidjson/document.h>
@@ -43,6 +44,8 @@
 #include "util/countdown_latch.h"
 #include "util/monotime.h"
 #include "util/scoped_cleanup.h"
+#include "util/slow_op_trace.h"
+#include "util/starrocks_metrics.h"
 #include "util/stopwatch.hpp"
 #include "util/thread.h"
 #include "util/trace_metrics.h"
@@ -141,4 +144,49 @@ TEST_F(TraceTest, TestTraceMetrics) {
     EXPECT_GE(m["test_scope_us"], 80 * 1000);
 }
 
+// The trace adopted by a bthread follows it after it's resumed, maybe by another pthread.
+TEST_F(TraceTest, TestBthread) {
+    scoped_refptr<Trace> trace(new Trace);
+    auto fn = [](void* arg) -> void* {
+        auto* t = static_cast<Trace*>(arg);
+        ADOPT_TRACE(t);
+        for (int i = 0; i < 10; i++) {
+            bthread_usleep(1000);
+            if (Trace::CurrentTrace() != t) {
+                return nullptr;
+            }
+            TRACE("round $0", i);
+        }
+        return t;
+    };
+    bthread_t tid;
+    ASSERT_EQ(0, bthread_start_background(&tid, nullptr, fn, trace.get()));
+    void* ret = nullptr;
+    ASSERT_EQ(0, bthread_join(tid, &ret));
+    EXPECT_EQ(trace.get(), ret);
+    EXPECT_EQ(nullptr, Trace::CurrentTrace());
+    EXPECT_NE(std::string::npos, trace->DumpToString(Trace::NO_FLAGS).find("round 9"));
+}
+
+TEST_F(TraceTest, TestSlowOpTrace) {
+    auto* registry = StarRocksMetrics::instance()->metrics();
+    auto labels = MetricLabels().add("op", "test.slow_op");
+    {
+        SCOPED_SLOW_OP_TRACE("test.slow_op", 1000);
+        EXPECT_NE(nullptr, Trace::CurrentTrace());
+        TRACE("fast");
+    }
+    EXPECT_EQ(nullptr, Trace::CurrentTrace());
+    EXPECT_EQ(nullptr, registry->get_metric("slow_operations_total", labels));
+
+    for (int i = 0; i < 2; i++) {
+        SCOPED_SLOW_OP_TRACE("test.slow_op", 1);
+        TRACE_COUNTER_SCOPE_LATENCY_US("test_sleep_us");
+        SleepFor(MonoDelta::FromMilliseconds(10));
+    }
+    auto* counter = static_cast<IntCounter*>(registry->get_metric("slow_operations_total", labels));
+    ASSERT_NE(nullptr, counter);
+    EXPECT_EQ(2, counter->value());
+}
+
 } // namespace starrocks
@@ -59,13 +59,14 @@ public class AlterWorkGroupStmt extends DdlStmt {
                 throw new SemanticException("type of WorkGroup is immutable");
             }
             if (changedProperties.getCpuCoreLimit() == null &&
+                    changedProperties.getCpuHardLimit() == null &&
                     changedProperties.getMemLimit() == null &&
                     changedProperties.getConcurrencyLimit() == null &&
                     changedProperties.getBigQueryCpuCoreSecondLimit() == null &&
                     changedProperties.getBigQueryMemLimit() == null &&
                     changedProperties.getBigQueryScanRowsLimit() == null) {
                 throw new SemanticException(
-                        "At least one of ('cpu_core_limit', 'mem_limit', 'concurrency_limit','big_query_mem_limit' , 'big_query_scan_rows_limit', 'big_query_cpu_core_second_limit', hould be specified");
+                        "At least one of ('cpu_core_limit', 'cpu_hard_limit', 'mem_limit', 'concurrency_limit','big_query_mem_limit' , 'big_query_scan_rows_limit', 'big_query_cpu_core_second_limit', hould be specified");
             }
         }
     }
@@ -53,9 +53,10 @@ public class IndexDef {
     }
 
     public void analyze() throws AnalysisException {
-        if (indexType == IndexDef.IndexType.BITMAP) {
+        if (indexType == IndexDef.IndexType.BITMAP || indexType == IndexDef.IndexType.NGRAM) {
             if (columns == null || columns.size() != 1) {
-                throw new AnalysisException("bitmap index can only apply to a single column.");
+                throw new AnalysisException(
+                        indexType.toString().toLowerCase() + " index can only apply to a single column.");
             }
             if (Strings.isNullOrEmpty(indexName)) {
                 throw new AnalysisException("index name cannot be blank.");
@@ -137,6 +138,16 @@ public class IndexDef {
                         "BITMAP index only used in columns of DUP_KEYS/PRIMARY_KEYS table or key columns of"
                                 + " UNIQUE_KEYS/AGG_KEYS table. invalid column: " + indexColName);
             }
+        } else if (indexType == IndexType.NGRAM) {
+            String indexColName = column.getName();
+            if (column.getPrimitiveType() != PrimitiveType.VARCHAR) {
+                throw new AnalysisException(column.getPrimitiveType() + " is not supported in ngram index. "
+                        + "invalid column: " + indexColName);
+            } else if ((keysType == KeysType.AGG_KEYS || keysType == KeysType.UNIQUE_KEYS) && !column.isKey()) {
+                throw new AnalysisException(
+                        "NGRAM index only used in columns of DUP_KEYS/PRIMARY_KEYS table or key columns of"
+                                + " UNIQUE_KEYS/AGG_KEYS table. invalid column: " + indexColName);
+            }
         } else {
             throw new AnalysisException("Unsupported index type: " + indexType);
         }
@@ -155,6 +166,16 @@ public class IndexDef {
                         "BITMAP index only used in columns of DUP_KEYS/PRIMARY_KEYS table or key columns of"
                                 + " UNIQUE_KEYS/AGG_KEYS table. invalid column: " + indexColName);
             }
+        } else if (indexType == IndexType.NGRAM) {
+            String indexColName = column.getName();
+            if (column.getPrimitiveType() != PrimitiveType.VARCHAR) {
+                throw new SemanticException(column.getPrimitiveType() + " is not supported in ngram index. "
+                        + "invalid column: " + indexColName);
+            } else if ((keysType == KeysType.AGG_KEYS || keysType == KeysType.UNIQUE_KEYS) && !column.isKey()) {
+                throw new SemanticException(
+                        "NGRAM index only used in columns of DUP_KEYS/PRIMARY_KEYS table or key columns of"
+                                + " UNIQUE_KEYS/AGG_KEYS table. invalid column: " + indexColName);
+            }
         } else {
             throw new SemanticException("Unsupported index type: " + indexType);
         }
@@ -162,5 +183,7 @@ public class IndexDef {
 
     public enum IndexType {
         BITMAP,
+        // The n-gram index of a VARCHAR column, which filters the rows by the LIKE predicates.
+        NGRAM,
     }
 }
@@ -24,6 +24,7 @@ public class WorkGroup implements Writable {
     public static final String QUERY_TYPE = "query_type";
     public static final String SOURCE_IP = "source_ip";
     public static final String CPU_CORE_LIMIT = "cpu_core_limit";
+    public static final String CPU_HARD_LIMIT = "cpu_hard_limit";
     public static final String MEM_LIMIT = "mem_limit";
     public static final String BIG_QUERY_MEM_LIMIT = "big_query_mem_limit";
     public static final String BIG_QUERY_SCAN_ROWS_LIMIT = "big_query_scan_rows_limit";
@@ -51,6 +52,8 @@ public class WorkGroup implements Writable {
     private long id;
     @SerializedName(value = "cpuCoreLimit")
     private Integer cpuCoreLimit;
+    @SerializedName(value = "cpuHardLimit")
+    private Double cpuHardLimit;
     @SerializedName(value = "memLimit")
     private Double memLimit;
     @SerializedName(value = "bigQueryMemLimit")
@@ -146,6 +149,9 @@ public class WorkGroup implements Writable {
         if (cpuCoreLimit != null) {
             twg.setCpu_core_limit(cpuCoreLimit);
         }
+        if (cpuHardLimit != null) {
+            twg.setCpu_hard_limit(cpuHardLimit);
+        }
         if (memLimit != null) {
             twg.setMem_limit(memLimit);
         }
@@ -180,6 +186,14 @@ public class WorkGroup implements Writable {
         this.cpuCoreLimit = cpuCoreLimit;
     }
 
+    public Double getCpuHardLimit() {
+        return cpuHardLimit;
+    }
+
+    public void setCpuHardLimit(double cpuHardLimit) {
+        this.cpuHardLimit = cpuHardLimit;
+    }
+
     public Double getMemLimit() {
         return memLimit;
     }
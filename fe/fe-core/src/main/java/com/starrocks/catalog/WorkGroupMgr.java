@@ -225,6 +225,10 @@ public class WorkGroupMgr implements Writable {
                 if (cpuCoreLimit != null) {
                     wg.setCpuCoreLimit(cpuCoreLimit);
                 }
+                Double cpuHardLimit = changedProperties.getCpuHardLimit();
+                if (cpuHardLimit != null) {
+                    wg.setCpuHardLimit(cpuHardLimit);
+                }
                 Double memLimit = changedProperties.getMemLimit();
                 if (memLimit != null) {
                     wg.setMemLimit(memLimit);
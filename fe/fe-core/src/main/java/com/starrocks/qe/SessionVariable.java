@@ -107,6 +107,8 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     // see comment of `starrocks_max_scan_key_num` and `max_pushdown_conditions_per_column` in BE config
     public static final String MAX_SCAN_KEY_NUM = "max_scan_key_num";
     public static final String MAX_PUSHDOWN_CONDITIONS_PER_COLUMN = "max_pushdown_conditions_per_column";
+    // see comment of `segment_readahead_bytes` in BE config
+    public static final String SEGMENT_READAHEAD_BYTES = "segment_readahead_bytes";
 
     // use new execution engine instead of the old one if enable_pipeline_engine is true,
     // the new execution engine split a fragment into pipelines, then create several drivers
@@ -393,6 +395,9 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
     private int maxScanKeyNum = -1;
     @VariableMgr.VarAttr(name = MAX_PUSHDOWN_CONDITIONS_PER_COLUMN)
     private int maxPushdownConditionsPerColumn = -1;
+    // -1 means unset, BE will use its config value
+    @VariableMgr.VarAttr(name = SEGMENT_READAHEAD_BYTES)
+    private long segmentReadaheadBytes = -1;
 
     @VariableMgr.VarAttr(name = HASH_JOIN_PUSH_DOWN_RIGHT_TABLE)
     private boolean hashJoinPushDownRightTable = true;
@@ -979,6 +984,9 @@ public class SessionVariable implements Serializable, Writable, Cloneable {
         if (maxPushdownConditionsPerColumn > -1) {
             tResult.setMax_pushdown_conditions_per_column(maxPushdownConditionsPerColumn);
         }
+        if (segmentReadaheadBytes > -1) {
+            tResult.setSegment_readahead_bytes(segmentReadaheadBytes);
+        }
         tResult.setEnable_spilling(enableSpilling);
 
         // Compression Type
@@ -303,9 +303,10 @@ public class CreateTableAnalyzer {
         IndexDef.IndexType indexType = indexDef.getIndexType();
         List<String> columns = indexDef.getColumns();
         String indexName = indexDef.getIndexName();
-        if (indexType == IndexDef.IndexType.BITMAP) {
+        if (indexType == IndexDef.IndexType.BITMAP || indexType == IndexDef.IndexType.NGRAM) {
             if (columns == null || columns.size() != 1) {
-                throw new SemanticException("bitmap index can only apply to a single column.");
+                throw new SemanticException(
+                        indexType.toString().toLowerCase() + " index can only apply to a single column.");
             }
             if (Strings.isNullOrEmpty(indexName)) {
                 throw new SemanticException("index name cannot be blank.");
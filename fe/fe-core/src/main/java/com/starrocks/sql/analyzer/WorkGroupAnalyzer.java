@@ -109,6 +109,14 @@ public class WorkGroupAnalyzer {
                 workgroup.setCpuCoreLimit(Integer.parseInt(value));
                 continue;
             }
+            if (key.equalsIgnoreCase(WorkGroup.CPU_HARD_LIMIT)) {
+                double cpuHardLimit = Double.parseDouble(value);
+                if (cpuHardLimit < 0) {
+                    throw new SemanticException("cpu_hard_limit should greater than 0 or equal to 0");
+                }
+                workgroup.setCpuHardLimit(cpuHardLimit);
+                continue;
+            }
             if (key.equalsIgnoreCase(WorkGroup.MEM_LIMIT)) {
                 double memLimit;
                 if (value.endsWith("%")) {
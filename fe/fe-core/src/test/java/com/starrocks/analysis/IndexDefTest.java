@@ -22,6 +22,10 @@
 package com.starrocks.analysis;
 
 import com.google.common.collect.Lists;
+import com.starrocks.catalog.Column;
+import com.starrocks.catalog.KeysType;
+import com.starrocks.catalog.ScalarType;
+import com.starrocks.catalog.Type;
 import com.starrocks.common.AnalysisException;
 import org.junit.Assert;
 import org.junit.Before;
@@ -65,6 +69,27 @@ public class IndexDefTest {
         }
     }
 
+    @Test
+    public void testNGramIndex() throws AnalysisException {
+        IndexDef ngramDef = new IndexDef("index2", Lists.newArrayList("col1"), IndexDef.IndexType.NGRAM, "");
+        ngramDef.analyze();
+        Assert.assertEquals("INDEX index2 (`col1`) USING NGRAM COMMENT ''", ngramDef.toSql());
+        ngramDef.checkColumn(new Column("col1", ScalarType.createVarcharType(10)), KeysType.DUP_KEYS);
+        try {
+            ngramDef.checkColumn(new Column("col1", Type.INT), KeysType.DUP_KEYS);
+            Assert.fail("No exception throws.");
+        } catch (AnalysisException e) {
+            Assert.assertTrue(e.getMessage().contains("is not supported in ngram index"));
+        }
+        try {
+            ngramDef = new IndexDef("index2", Lists.newArrayList("col1", "col2"), IndexDef.IndexType.NGRAM, "");
+            ngramDef.analyze();
+            Assert.fail("No exception throws.");
+        } catch (AnalysisException e) {
+            Assert.assertTrue(e.getMessage().contains("ngram index can only apply to a single column"));
+        }
+    }
+
     @Test
     public void toSql() {
         Assert.assertEquals("INDEX index1 (`col1`) USING BITMAP COMMENT 'balabala'", def.toSql());
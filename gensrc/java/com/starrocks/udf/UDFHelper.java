@@ -261,6 +261,45 @@ public class UDFHelper {
         return strings;
     }
 
+    // unbox the results into the null buffer and data buffer, which are direct buffers of the BE column,
+    // to avoid calling JNI for each row
+    public static void getResultFromBoxedArray(int type, Object[] boxed, int numRows, ByteBuffer nullBuffer,
+                                               ByteBuffer dataBuffer) {
+        dataBuffer.order(ByteOrder.LITTLE_ENDIAN);
+        for (int i = 0; i < numRows; ++i) {
+            Object value = boxed[i];
+            if (value == null) {
+                nullBuffer.put(i, (byte) 1);
+                continue;
+            }
+            switch (type) {
+                case TYPE_BOOLEAN:
+                    dataBuffer.put(i, (byte) ((Boolean) value ? 1 : 0));
+                    break;
+                case TYPE_TINYINT:
+                    dataBuffer.put(i, (Byte) value);
+                    break;
+                case TYPE_SMALLINT:
+                    dataBuffer.putShort(i * 2, (Short) value);
+                    break;
+                case TYPE_INT:
+                    dataBuffer.putInt(i * 4, (Integer) value);
+                    break;
+                case TYPE_BIGINT:
+                    dataBuffer.putLong(i * 8, (Long) value);
+                    break;
+                case TYPE_FLOAT:
+                    dataBuffer.putFloat(i * 4, (Float) value);
+                    break;
+                case TYPE_DOUBLE:
+                    dataBuffer.putDouble(i * 8, (Double) value);
+                    break;
+                default:
+                    throw new RuntimeException("Unsupported UDF TYPE:" + type);
+            }
+        }
+    }
+
     // use batch reflect batch call method to reduce JNI call costs
     // TODO: we need to find a more efficient way of calling
     public static void batchUpdateSingle(Object o, Method method, Object state, Object[] column)
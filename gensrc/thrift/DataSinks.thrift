@@ -42,7 +42,9 @@ enum TDataSinkType {
 enum TResultSinkType {
     MYSQL_PROTOCAL,
     FILE,
-    STATISTIC
+    STATISTIC,
+    // Every result batch is one row of serialized arrow ipc stream.
+    ARROW
 }
 
 struct TResultFileSinkOptions {
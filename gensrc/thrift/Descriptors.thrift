@@ -115,7 +115,8 @@ enum THdfsCompression {
 }
 
 enum TIndexType {
-  BITMAP
+  BITMAP,
+  NGRAM
 }
 
 // Mapping from names defined by Avro to the enum.
@@ -163,6 +163,9 @@ struct TQueryOptions {
   // For load degree of parallel
   56: optional i32 load_dop;
   57: optional i64 runtime_filter_scan_wait_time_ms;
+  // see BE config `segment_readahead_bytes` for details
+  // if set, this will overwrite the BE config.
+  58: optional i64 segment_readahead_bytes;
 }
 
 
@@ -224,6 +224,9 @@ struct THdfsScanRange {
     
     // for iceberg table scanrange should contains the full path of file
     8: optional string full_path
+
+    // the modification time of the file, which identifies its version in the block cache of the backend
+    9: optional i64 modification_time
 }
 
 // Specification of an individual data range which is held in its entirety
@@ -553,6 +556,10 @@ struct TSortNode {
   // in order to eliminate time-consuming LocalMergeSortSourceOperator and parallelize
   // AnalyticNode
   22: optional list<Exprs.TExpr> analytic_partition_exprs
+  // For pipeline execution engine, keep at most partition_limit rows of each partition by partition_exprs,
+  // which is planned below the exchange for the predicates like ROW_NUMBER() OVER (PARTITION BY ...) <= N
+  23: optional list<Exprs.TExpr> partition_exprs
+  24: optional i64 partition_limit
 }
 
 enum TAnalyticWindowType {
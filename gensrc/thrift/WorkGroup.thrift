@@ -22,6 +22,12 @@ struct TWorkGroup {
   11: optional i64 big_query_mem_limit
   12: optional i64 big_query_scan_rows_limit
   13: optional i64 big_query_cpu_core_second_limit
+  // The hard cap of cpu usage in number of cores, the workgroup is throttled once exceeding it in a period.
+  // Unset or non-positive means no hard cap.
+  14: optional double cpu_hard_limit
+  // Cpu throttling statistics reported by BE.
+  15: optional i64 cpu_throttled_time_ns
+  16: optional i64 num_cpu_throttled_periods
 }
 
 enum TWorkGroupOpType {